@@ -17,6 +17,10 @@
  * 1332 22.04.2010 GFH  deactivate CH4 value regulation if natural gas operation
  * 1332 23.04.2010 GFH  deactivate CH4 value load reduction if natural gas operation
  * 1343 23.12.2010 GFH  set CH4.MixerOffset to "0" if CH4 has a wire break
+ *      16.10.2026      control loop reads parameters from snapshot CH4_Params
+ *      16.10.2026      snapshot refreshed by parameter change notification
+ *      17.10.2026      CH4_Calibrating(), CH4_LoadRed() and CH4_Supervision() replaced by
+ *                      the descriptors CH4_Protection[] evaluated by PROT_control()
  * 
  */
 
@@ -32,11 +36,15 @@
 #include "GBV.h"
 #include "PAR.h"
 #include "PMS.h"
+#include "PROT.h"
+#include "TMR.h"
 #include "modbusappl.h"
 
 
 // CH4 data structure for global use
 t_CH4 CH4;
+// snapshot of the parameters used by CH4
+t_CH4_params CH4_Params;
 
 // Local variables
 static STATE myState 	 = 0;
@@ -47,295 +55,43 @@ static DU32  myStateCnt  = 0;
 
 
 // ************************************************************* 
-// ***********   CH4 measurement under calibration   ***********
+// ******************   CH4 protections   **********************
 // *************************************************************
 // *                                                           *
-// *              Freeze CH4 value, but stop if timeout        *
+// * CH4.Calibrating:    freeze CH4 value, but stop if timeout *
+// *   input values:     CH4.DI_CalibrateCH4, MBA.bCH4Calibrating
+// *   Stop condition:   STOPCONDITION_50166                   *
+// * CH4.CH4ValueTooLow: stop engine due to too low CH4 value  *
+// *   input values:     CH4.CH4Value                          *
+// *   Stop condition:   STOPCONDITION_50167                   *
+// * CH4.CH4ValueLow:    load reduction due to low CH4 value   *
+// *   input values:     CH4.CH4Value                          *
+// *   Stop condition:   STOPCONDITION_50168                   *
 // *                                                           *
+// * evaluated by PROT_control() every 100ms                   *
 // *************************************************************
-// *** function name:     CH4_Calibrating()                  ***
-// *** protection struct: CH4.Calibrating                    ***
-// *** input values:      CH4.DI_CalibrateCH4                ***
-// *** Stop condition:    STOPCONDITION_50166                ***
-// *************************************************************
-#ifdef a
-#undef a
-#endif
-#define a CH4.Calibrating
+#define CH4_NBR_OF_PROTECTIONS	3
 
-static void CH4_Calibrating(void)
+static const t_PROT_desc CH4_Protection[CH4_NBR_OF_PROTECTIONS] =
 {
-   // if state has changed, clear state timer and remember new state
-   if (a.State != a.LastState )
-   { 
-   	 
-     a.StateTimer = 0;
-     a.LastState  = a.State;
-   }
-   else // count the state timecounter by adding 100ms
-   {
-     if (a.StateTimer < (MAX_DU32-1000)) a.StateTimer += 100L; 
-   }    
-
-   if (  ( CH4.CH4ValueAvailable )
-      && ( CH4.OptionAndActive )									// CH4 option selected
-      && ( !CH4.WireBreakAI )
-      && ( !GAS.GasTypeBActive ) )                                  // poor gas is active
-   {
-       // check input and set a.Exceeded accordingly
-       if ( ( (DI_FUNCT[CH4_CALIBRATING].Assigned == ASSIGNED) && CH4.DI_CalibrateCH4 ) // calibrating digital input assigned
-       		|| ( (MBA.WriteConfigurationDigital & MBA_CONFIG_CH4_CALIBATING) && MBA.bCH4Calibrating) // calibrating modbus assigned
-       	  )
-           a.Exceeded = TRUE;
-       else 
-           a.Exceeded = FALSE;
-   }
-   else
-       a.Exceeded = FALSE;
-       
-   switch(a.State)
-   {
-      case COLD: // no condition is pending
-           if ( a.Exceeded ) 
-               a.State = HOT;
-           break;
-           	
-      case HOT: // condition present, the delay time is running
-           // in this state freeze the CH4 value
-           if (!a.Exceeded ) a.State = COLD; // condition is gone, return to COLD	
-           if (a.StateTimer >= CH4_CALIBRATING_TIMEOUT)  // after delay time, trip the protection function
-           { 
-           	   a.State = TRIP; 
-           } 	
-           break;
-           	
-      case TRIP: // the delay time has tripped, condition is still pending
-           // calibration timeout -> engine stopping
-           STOP_Set(STOPCONDITION_50166); // set SC
-           STOP_Tripped[STOPCONDITION_50166] = TRUE; // tripped = cannot be acknowledged
-           if (!a.Exceeded)
-               a.State = RECOVER;	
-           break;
-           
-      case RECOVER:
-           STOP_Tripped[STOPCONDITION_50166] = FALSE; // can be acknowledged
-           if ( a.Exceeded )
-               a.State = TRIP;
-           if (a.StateTimer >= CH4_CALIBRATING_REC_DELAY) 
-           { a.State = COLD;   
-           }	
-           break;    
-    }
+	// CH4 measurement under calibration, CH4.Calibrating.Exceeded set by CH4_control_100ms
+	{ &CH4.Calibrating, 0, 0, 0L, 0, 0,
+	  &CH4.MonitoringActive, 0, 0,
+	  CH4_CALIBRATING_TIMEOUT, CH4_CALIBRATING_REC_DELAY, STOPCONDITION_50166, TMR_TASK_100MS,
+	  PROT_RECOVER | PROT_TRIPPED },
 
-} // end of void CH4_Calibrating()
+	// CH4 value too low -> stop
+	{ &CH4.CH4ValueTooLow, &CH4.CH4Value, &CH4_Params.StopLimit, 0L, CH4_TOO_LOW_HYST, 0,
+	  &CH4.MonitoringActive, 0, &GAS.GasTypeBActive,
+	  CH4_TOO_LOW_DELAY, CH4_TOO_LOW_REC_DELAY, STOPCONDITION_50167, TMR_TASK_100MS,
+	  PROT_BELOW | PROT_RECOVER | PROT_AUTO_CLEAR | PROT_ACK_RECOVER | PROT_TRIPPED },
 
-// ************************************************************* 
-// **************    CH4 value low -> load reduction    ********
-// *************************************************************
-// *                                                           *
-// *              load reduction due to low CH4 value          *
-// *                                                           *
-// *************************************************************
-// *** function name:     CH4_LoadRed()                      ***
-// *** protection struct: CH4.CH4ValueLow                    ***
-// *** input values:      CH4.CH4Value                       ***
-// *** Stop condition:    STOPCONDITION_50168                ***
-// *************************************************************
-#ifdef a
-#undef a
-#endif
-#define a CH4.CH4ValueLow
-
-static void CH4_LoadRed(void)
-{
-   // if state has changed, clear state timer and remember new state
-   if (a.State != a.LastState )
-   { 
-   	 
-     a.StateTimer = 0;
-     a.LastState  = a.State;
-   }
-   else // count the state timecounter by adding 100ms
-   {
-     if (a.StateTimer < (MAX_DU32-1000)) a.StateTimer += 100L; 
-   }    
-
-   // define Limit
-   a.Limit = (DS16)PARA[ParRefInd[CH4_LIMIT_FOR_MAXLOAD__PARREFIND]].Value; // in 0,1% CH4 
-   
-   if (  ( CH4.CH4ValueAvailable )
-      && ( CH4.OptionAndActive )									// CH4 option selected
-      && ( !CH4.WireBreakAI )
-      && ( !GAS.GasTypeBActive ) )                                  // poor gas is active
-   {
-       // check input and set a.Exceeded accordingly
-       if ( CH4.CH4Value < a.Limit ) 
-           a.Exceeded = TRUE;
-       else 
-           a.Exceeded = FALSE;
-   }
-   else
-       a.Exceeded = FALSE;
-       
-   switch(a.State)
-   {
-      case COLD: // no condition is pending
-           if ( a.Exceeded ) 
-               a.State = HOT;
-           else
-               STOP_Clear(STOPCONDITION_50168); // auto acknowledge
-           break;
-           	
-      case HOT: // condition present, the delay time is running
-           if (!a.Exceeded ) a.State = COLD; // condition is gone, return to COLD	
-           if (a.StateTimer >= CH4_LOW_DELAY)  // after delay time, trip the protection function
-           { 
-           	   a.State = TRIP; 
-           } 	
-           if (GAS.GasTypeBActive)
-           {
-           		a.State = COLD;
-           		STOP_Tripped[STOPCONDITION_50168] = FALSE; // can be acknowledged
-           }
-           break;
-           	
-      case TRIP: // the delay time has tripped, condition is still pending
-           // calibration timeout -> engine stopping
-           STOP_Set(STOPCONDITION_50168); // set SC
-           STOP_Tripped[STOPCONDITION_50168] = TRUE; // tripped = cannot be acknowledged
-           if (!a.Exceeded)
-              a.State = RECOVER;	
-
-           if (GAS.GasTypeBActive)
-           {
-           		a.State = COLD;
-           		STOP_Tripped[STOPCONDITION_50168] = FALSE; // can be acknowledged
-           }	
-           break;
-           
-      case RECOVER:
-           STOP_Tripped[STOPCONDITION_50168] = FALSE; // can be acknowledged
-           if ( a.Exceeded )
-               a.State = TRIP;
-           if (a.StateTimer >= CH4_LOW_REC_DELAY) 
-           { a.State = COLD;   
-           }	
-           if (!STOP_is_Set(STOPCONDITION_50168) ) a.State = COLD; // has been acknowledged while in RECOVER
-           
-           if (GAS.GasTypeBActive)
-           {
-           		a.State = COLD;
-           }
-           break;  
-    }
-
-} // end of void CH4_LoadRed()
-
-
-// ************************************************************* 
-// **************    CH4 value too low -> stop    **************
-// *************************************************************
-// *                                                           *
-// *              Stop engine due to too low CH4 value         *
-// *                                                           *
-// *************************************************************
-// *** function name:     CH4_Supervision()                  ***
-// *** protection struct: CH4.CH4ValueTooLow                 ***
-// *** input values:      CH4.CH4Value                       ***
-// *** Stop condition:    STOPCONDITION_50167                ***
-// *************************************************************
-#ifdef a
-#undef a
-#endif
-#define a CH4.CH4ValueTooLow
-
-static void CH4_Supervision(void)
-{
-   // if state has changed, clear state timer and remember new state
-   if (a.State != a.LastState )
-   { 
-   	 
-     a.StateTimer = 0;
-     a.LastState  = a.State;
-   }
-   else // count the state timecounter by adding 100ms
-   {
-     if (a.StateTimer < (MAX_DU32-1000)) a.StateTimer += 100L; 
-   }    
-
-   // define Limit
-   if (a.State < TRIP)
-       a.Limit = (DS16)PARA[ParRefInd[CH4_STOP_LIMIT__PARREFIND]].Value; // in 0,1% CH4
-   else
-       a.Limit = (DS16)PARA[ParRefInd[CH4_STOP_LIMIT__PARREFIND]].Value + CH4_TOO_LOW_HYST; // in 0,1% CH4
-
-   if (  ( CH4.CH4ValueAvailable )
-      && ( CH4.OptionAndActive )									// CH4 option selected
-      && ( !CH4.WireBreakAI )
-      && ( !GAS.GasTypeBActive ) )                                  // poor gas is active
-   {
-       // check input and set a.Exceeded accordingly
-       if ( CH4.CH4Value < a.Limit ) 
-           a.Exceeded = TRUE;
-       else 
-           a.Exceeded = FALSE;
-   }
-   else
-       a.Exceeded = FALSE;
-       
-   switch(a.State)
-   {
-      case COLD: // no condition is pending
-           if ( a.Exceeded ) 
-               a.State = HOT;
-           else
-               STOP_Clear(STOPCONDITION_50167); // auto acknowledge
-           break;
-           	
-      case HOT: // condition present, the delay time is running
-           if (!a.Exceeded ) a.State = COLD; // condition is gone, return to COLD	
-           if (a.StateTimer >= CH4_TOO_LOW_DELAY)  // after delay time, trip the protection function
-           { 
-           	   a.State = TRIP; 
-           } 	
-           if (GAS.GasTypeBActive)
-           {
-           		a.State = COLD;
-           		STOP_Tripped[STOPCONDITION_50167] = FALSE; // can be acknowledged
-           }
-           break;
-           	
-      case TRIP: // the delay time has tripped, condition is still pending
-           // calibration timeout -> engine stopping
-           STOP_Set(STOPCONDITION_50167); // set SC
-           STOP_Tripped[STOPCONDITION_50167] = TRUE; // tripped = cannot be acknowledged
-           if (!a.Exceeded)
-               a.State = RECOVER;	
-
-           if (GAS.GasTypeBActive)
-           {
-           		a.State = COLD;
-           		STOP_Tripped[STOPCONDITION_50167] = FALSE; // can be acknowledged
-           }	
-           break;
-           
-      case RECOVER:
-           STOP_Tripped[STOPCONDITION_50167] = FALSE; // can be acknowledged
-           if ( a.Exceeded )
-               a.State = TRIP;
-           if (a.StateTimer >= CH4_TOO_LOW_REC_DELAY) 
-           { a.State = COLD;   
-           }	
-           if (!STOP_is_Set(STOPCONDITION_50167) ) a.State = COLD; // has been acknowledged while in RECOVER
-           
-           if (GAS.GasTypeBActive)
-           {
-           		a.State = COLD;
-           }
-           break;   
-    }
-
-} // end of void CH4_CH4_Supervision()
+	// CH4 value low -> load reduction
+	{ &CH4.CH4ValueLow, &CH4.CH4Value, &CH4_Params.LimitForMaxload, 0L, 0, 0,
+	  &CH4.MonitoringActive, &CH4.LoadRedEnable, &GAS.GasTypeBActive,
+	  CH4_LOW_DELAY, CH4_LOW_REC_DELAY, STOPCONDITION_50168, TMR_TASK_100MS,
+	  PROT_BELOW | PROT_RECOVER | PROT_AUTO_CLEAR | PROT_ACK_RECOVER | PROT_TRIPPED }
+};
 
 
 
@@ -358,39 +114,39 @@ void CH4_control_100ms(void)
     
     DS32 NominalPower;
 
-    CH4.Option = PARA[ParRefInd[CH4_OPTION_CONTROL__PARREFIND]].Value;
+    CH4.Option = CH4_Params.OptionControl;
     CH4.OptionAndActive = CH4.Option
-    		&& (!GBV.Active || PARA[ParRefInd[GBV_PAR_CH4_OPTION_ACTIVE__PARREFIND]].Value);
+    		&& (!GBV.Active || CH4_Params.GbvParCh4OptionActive);
 /*
     CH4.CH4ValueAvailable = ( (AI_I_FUNCT[CH4_VALUE].Assigned == ASSIGNED)
-	        					|| (PARA[ParRefInd[MBA_CONFIGURATION_ANALOG__PARREFIND]].Value & MBA_CONFIG_CH4_VALUE)
-	        					|| (PMS.EngineIDConfigured[ARC.nEngineId-1] && (PARA[ParRefInd[PMS_REG_CH4__PARREFIND]].Value != 0L) ) );
+	        					|| (PAR_VALUE(MBA_CONFIGURATION_ANALOG__PARREFIND) & MBA_CONFIG_CH4_VALUE)
+	        					|| (PMS.EngineIDConfigured[ARC.nEngineId-1] && (PAR_VALUE(PMS_REG_CH4__PARREFIND) != 0L) ) );
 */
     // always true
     // at least take parameter value
     CH4.CH4ValueAvailable = TRUE;
     
     if (PMS.EngineIDConfigured[ARC.nEngineId-1] // PMS function
-	    && (PARA[ParRefInd[PMS_REG_CH4__PARREFIND]].Value != 0L))
+	    && (CH4_Params.PmsRegCh4 != 0L))
 	{
 		NominalPower = PMS.NominalPowerTotal*1000L;
 	}
 	else
 	{
-		NominalPower = (DS32)PARA[ParRefInd[GEN_NOMINAL_LOAD__PARREFIND]].Value;
+		NominalPower = (DS32)CH4_Params.GenNominalLoad;
 	}
 
     if (CH4.Option)	// CH4 option selected
     {
 	    if ( PMS.EngineIDConfigured[ARC.nEngineId-1]
-			&& (     PARA[ParRefInd[PMS_REG_CH4__PARREFIND]].Value != 0L)
-			&& ((DU8)PARA[ParRefInd[PMS_REG_CH4__PARREFIND]].Value != ARC.nEngineId) )
+			&& (     CH4_Params.PmsRegCh4 != 0L)
+			&& ((DU8)CH4_Params.PmsRegCh4 != ARC.nEngineId) )
 	    {
 	    	CH4.WireBreakAI = FALSE;
 
 	    	// take CH4 value from ARCnet in 0.1%
 	    	CH4_Internal = PMS.CH4Value;
-	    	STOP_Tripped[STOPCONDITION_50165] = FALSE;
+	    	STOP_SetTripped(STOPCONDITION_50165, FALSE);
 	    }
 	    else if (MBA.WriteConfigurationAnalog & MBA_CONFIG_CH4_VALUE)
 	    {
@@ -398,7 +154,7 @@ void CH4_control_100ms(void)
 
 	    	// take CH4 value from modbus in 0.1%
 	    	CH4_Internal = MBA.sCH4Value;
-	    	STOP_Tripped[STOPCONDITION_50165] = FALSE;
+	    	STOP_SetTripped(STOPCONDITION_50165, FALSE);
 	    }
 	    else if (AI_I_FUNCT[CH4_VALUE].Assigned == ASSIGNED)
 	    {
@@ -414,10 +170,10 @@ void CH4_control_100ms(void)
 			if( CH4.AI_I_CH4Value > 3500 )
 			{
 			  // no wire break
-			  STOP_Tripped[STOPCONDITION_50165] = FALSE; // can be acknowledged
+			  STOP_SetTripped(STOPCONDITION_50165, FALSE); // can be acknowledged
 
 			  CH4_Internal = (((DS32)(CH4.AI_I_CH4Value - CH4_VALUE_ZERO)
-				* (DS32)PARA[ParRefInd[CH4_PERCENT_VALUE_FOR_20mA__PARREFIND]].Value + 10000)/20000);	// rmiIET
+				* (DS32)CH4_Params.PercentValueFor20mA + 10000)/20000);	// rmiIET
 			}
 			else
 			{
@@ -426,11 +182,11 @@ void CH4_control_100ms(void)
 			  if (!GAS.GasTypeBActive) // poor gas is active
 			  {
 				  STOP_Set(STOPCONDITION_50165);
-				  STOP_Tripped[STOPCONDITION_50165] = TRUE; // tripped = cannot be acknowledged
+				  STOP_SetTripped(STOPCONDITION_50165, TRUE); // tripped = cannot be acknowledged
 			  }
 			  else
 			  {
-				  STOP_Tripped[STOPCONDITION_50165] = FALSE;
+				  STOP_SetTripped(STOPCONDITION_50165, FALSE);
 			  }
 			}
 	    }
@@ -438,25 +194,25 @@ void CH4_control_100ms(void)
 		{
 	    	CH4.WireBreakAI = FALSE;
 
-			CH4_Internal = PARA[ParRefInd[CH4_MEASURED_VALUE__PARREFIND]].Value;
-			STOP_Tripped[STOPCONDITION_50165] = FALSE;
+			CH4_Internal = CH4_Params.MeasuredValue;
+			STOP_SetTripped(STOPCONDITION_50165, FALSE);
 		}
     }
 	else
 	{
     	CH4.WireBreakAI = FALSE;
 
-		CH4_Internal = PARA[ParRefInd[CH4_MEASURED_VALUE__PARREFIND]].Value;
-		STOP_Tripped[STOPCONDITION_50165] = FALSE;
+		CH4_Internal = CH4_Params.MeasuredValue;
+		STOP_SetTripped(STOPCONDITION_50165, FALSE);
 	}
 
 
 	// CH4 regulation from ARCnet
 	if (PMS.EngineIDConfigured[ARC.nEngineId-1] // PMS function
-	    && (      PARA[ParRefInd[PMS_REG_CH4__PARREFIND]].Value != 0L)				// CH4 regulation from ARCnet
-	    && ( (DU8)PARA[ParRefInd[PMS_REG_CH4__PARREFIND]].Value != ARC.nEngineId) )	// not my Id
+	    && (      CH4_Params.PmsRegCh4 != 0L)				// CH4 regulation from ARCnet
+	    && ( (DU8)CH4_Params.PmsRegCh4 != ARC.nEngineId) )	// not my Id
     {
-    	CH4.MaxPower_CH4 = (DS32)ARC_MP_CH4((DU8)PARA[ParRefInd[PMS_REG_CH4__PARREFIND]].Value) * 1000L;
+    	CH4.MaxPower_CH4 = (DS32)ARC_MP_CH4((DU8)CH4_Params.PmsRegCh4) * 1000L;
     }
 	// CH4 regulation not from ARCnet
 	else
@@ -469,38 +225,38 @@ void CH4_control_100ms(void)
 			if (CH4.WireBreakAI)
 			{
 				CH4.MaxPower_CH4 = NominalPower
-					* PARA[ParRefInd[CH4_MINLOAD__PARREFIND]].Value / 1000;
+					* CH4_Params.Minload / 1000;
 			}
 			else
 			{
 				// calculate max power due to CH4 value
 
 				// calculate difference to full load limit
-				CH4Diff =   (DS16)PARA[ParRefInd[CH4_LIMIT_FOR_MAXLOAD__PARREFIND]].Value
+				CH4Diff =   (DS16)CH4_Params.LimitForMaxload
 						  - CH4.CH4Value; // in 0,1% CH4
 				if (CH4Diff < 0)
 				{
 					// full load allowed
 					CH4.MaxPower_CH4 = NominalPower; // set to nominal power, no load reduction
 				}
-				else if (CH4_Internal < (DS16)PARA[ParRefInd[CH4_LIMIT_FOR_MINLOAD__PARREFIND]].Value)
+				else if (CH4_Internal < (DS16)CH4_Params.LimitForMinload)
 				{
 					// CH4 is lower than min
 					CH4.MaxPower_CH4 = NominalPower
-						* PARA[ParRefInd[CH4_MINLOAD__PARREFIND]].Value / 1000; // set to min load
+						* CH4_Params.Minload / 1000; // set to min load
 					// set marker for power reduced by CH4 here
 				}
-				else if (PARA[ParRefInd[CH4_LIMIT_FOR_MAXLOAD__PARREFIND]].Value != PARA[ParRefInd[CH4_LIMIT_FOR_MINLOAD__PARREFIND]].Value)
+				else if (CH4_Params.LimitForMaxload != CH4_Params.LimitForMinload)
 				{
 					// derate power according to settings CH4_LIMIT_FOR_MAXLOAD__PARREFIND, CH4_MINLOAD__PARREFIND,
 					// and CH4_LIMIT_FOR_MINLOAD__PARREFIND
 					DeltaP  =   NominalPower
-							  *( (DS32)1000 - (DS32)PARA[ParRefInd[CH4_MINLOAD__PARREFIND]].Value) / 1000; // size of proportional derating range
-					DeltaCH4 =  (DS16)PARA[ParRefInd[CH4_LIMIT_FOR_MAXLOAD__PARREFIND]].Value
-							  - (DS16)PARA[ParRefInd[CH4_LIMIT_FOR_MINLOAD__PARREFIND]].Value; // in 0,1% CH4
+							  *( (DS32)1000 - (DS32)CH4_Params.Minload) / 1000; // size of proportional derating range
+					DeltaCH4 =  (DS16)CH4_Params.LimitForMaxload
+							  - (DS16)CH4_Params.LimitForMinload; // in 0,1% CH4
 					CH4.MaxPower_CH4 =  ( NominalPower
-										  * PARA[ParRefInd[CH4_MINLOAD__PARREFIND]].Value / 1000 )
-										+ ( DeltaP / DeltaCH4 ) * ( CH4.CH4Value - (DS16)PARA[ParRefInd[CH4_LIMIT_FOR_MINLOAD__PARREFIND]].Value );
+										  * CH4_Params.Minload / 1000 )
+										+ ( DeltaP / DeltaCH4 ) * ( CH4.CH4Value - (DS16)CH4_Params.LimitForMinload );
 
 					if (CH4.MaxPower_CH4 < 0) CH4.MaxPower_CH4 = 0;   // never set MaxPower below zero
 					// set marker for power reduced by CH4 here
@@ -508,7 +264,7 @@ void CH4_control_100ms(void)
 				else // wrong setting -> set to min load
 				{
 					CH4.MaxPower_CH4 = NominalPower
-						* PARA[ParRefInd[CH4_MINLOAD__PARREFIND]].Value / 1000;
+						* CH4_Params.Minload / 1000;
 				}
 			}
 		}
@@ -526,15 +282,18 @@ void CH4_control_100ms(void)
     // else freeze the CH4.CH4Value where it is (= do nothing)
     
     
+    // CH4 value monitored
+    CH4.MonitoringActive = (  ( CH4.CH4ValueAvailable )
+                           && ( CH4.OptionAndActive )				// CH4 option selected
+                           && ( !CH4.WireBreakAI )
+                           && ( !GAS.GasTypeBActive ) );             // poor gas is active
+
     // adjust mixer starting position
-    if (  ( CH4.CH4ValueAvailable )
-       && ( CH4.OptionAndActive )									// CH4 option selected
-       && ( !CH4.WireBreakAI )
-       && ( !GAS.GasTypeBActive ) )                                  // poor gas is active
+    if ( CH4.MonitoringActive )
     {
     	// CH4 option selected, CH4 input assigned
-        CH4.MixerOffset  = ( ( (DS16)PARA[ParRefInd[CH4_STANDARD_MIX__PARREFIND]].Value
-                               - CH4.CH4Value) * (DS16)PARA[ParRefInd[CH4_MIX_ADJUSTMENT__PARREFIND]].Value / 10 ); 
+        CH4.MixerOffset  = ( ( (DS16)CH4_Params.StandardMix
+                               - CH4.CH4Value) * (DS16)CH4_Params.MixAdjustment / 10 ); 
     }
     else
     {
@@ -544,22 +303,17 @@ void CH4_control_100ms(void)
     
     
     
+    // calibrating digital input or modbus -> check calibration timeout
+    CH4.Calibrating.Exceeded = (  ( (DI_FUNCT[CH4_CALIBRATING].Assigned == ASSIGNED) && CH4.DI_CalibrateCH4 ) // calibrating digital input assigned
+                               || ( (MBA.WriteConfigurationDigital & MBA_CONFIG_CH4_CALIBATING) && MBA.bCH4Calibrating) ); // calibrating modbus assigned
+
+    // load reduction because of too low CH4 value only monitored if we regulate
+    CH4.LoadRedEnable = (  !PMS.EngineIDConfigured[ARC.nEngineId-1]   // no PMS function
+                        || ((DU8)CH4_Params.PmsRegCh4 == ARC.nEngineId) // we have to regulate
+                        || (CH4_Params.PmsRegCh4 == 0L) );        // no ID for regulation assigned
+
     // call supervision state functions
-    CH4_Calibrating();        // check if calibrating, set stopcondition if timed out
-    CH4_Supervision();        // stop because of too low CH4 value
-    
-    if (!PMS.EngineIDConfigured[ARC.nEngineId-1]   // no PMS function
-       || ((DU8)PARA[ParRefInd[PMS_REG_CH4__PARREFIND]].Value == ARC.nEngineId) // we have to regulate
-	   || (PARA[ParRefInd[PMS_REG_CH4__PARREFIND]].Value == 0L)) // no ID for regulation assigned
-	{
-	    CH4_LoadRed();            // load reduction because of too low CH4 value
-	    
-	}
-	else // no monitoring of load reduction
-	{
-		CH4.CH4ValueLow.State    = COLD;
-		STOP_Tripped[STOPCONDITION_50168] = FALSE;
-	}
+    PROT_control(CH4_Protection, CH4_NBR_OF_PROTECTIONS);
     
     if (myStateCnt < ( MAX_DU32 - 1000 )) myStateCnt = myStateCnt + 100;
     if (myState != 0) myState(SIG_DO);
@@ -567,8 +321,30 @@ void CH4_control_100ms(void)
 
 
 
+// copy the parameters used by the control loop into CH4_Params
+void CH4_ReadParameters(void)
+{
+	CH4_Params.LimitForMaxload       = PAR_VALUE(CH4_LIMIT_FOR_MAXLOAD__PARREFIND);
+	CH4_Params.LimitForMinload       = PAR_VALUE(CH4_LIMIT_FOR_MINLOAD__PARREFIND);
+	CH4_Params.MeasuredValue         = PAR_VALUE(CH4_MEASURED_VALUE__PARREFIND);
+	CH4_Params.Minload               = PAR_VALUE(CH4_MINLOAD__PARREFIND);
+	CH4_Params.MixAdjustment         = PAR_VALUE(CH4_MIX_ADJUSTMENT__PARREFIND);
+	CH4_Params.OptionControl         = PAR_VALUE(CH4_OPTION_CONTROL__PARREFIND);
+	CH4_Params.PercentValueFor20mA   = PAR_VALUE(CH4_PERCENT_VALUE_FOR_20mA__PARREFIND);
+	CH4_Params.StandardMix           = PAR_VALUE(CH4_STANDARD_MIX__PARREFIND);
+	CH4_Params.StopLimit             = PAR_VALUE(CH4_STOP_LIMIT__PARREFIND);
+	CH4_Params.GbvParCh4OptionActive = PAR_VALUE(GBV_PAR_CH4_OPTION_ACTIVE__PARREFIND);
+	CH4_Params.GenNominalLoad        = PAR_VALUE(GEN_NOMINAL_LOAD__PARREFIND);
+	CH4_Params.PmsRegCh4             = PAR_VALUE(PMS_REG_CH4__PARREFIND);
+}
+
+
 void CH4_init(void)
 {
+	// (PAR.init happens before CH4_init, so the snapshot is valid from here on)
+	CH4_ReadParameters();
+	// refresh on parameter change (HMI, modbus or file transfer)
+	PAR_RegisterListener(PAR_NOTIFY_TASK_100MS, PAR_LISTEN_ALL, PAR_LISTEN_ALL, CH4_ReadParameters);
 	
 	// Initialization of the CH4 struct
 	CH4.CH4Value                        = 0;  // 0,0% CH4 when starting up
@@ -576,6 +352,9 @@ void CH4_init(void)
 	CH4.MaxPower_CH4                    = 0L; //
 	CH4.MixerOffset                     = 0;  // initially no change of the starting position
 	
+	CH4.MonitoringActive                = FALSE;
+	CH4.LoadRedEnable                   = TRUE;
+
 	CH4.Calibrating.State               = COLD;
 	CH4.CH4ValueLow.State               = COLD;
 	CH4.CH4ValueTooLow.State            = COLD;
@@ -12,6 +12,8 @@
  * 
  * changes:51
  * 1332 22.04.2010 GFH  deactivate CH4 value regulation if natural gas operation
+ *      16.10.2026      parameter snapshot CH4_Params
+ *      17.10.2026      protections as t_PROT_vars (PROT.h), CH4.MonitoringActive, CH4.LoadRedEnable
  */
 
 
@@ -23,19 +25,11 @@
 #include "deif_types.h"
 #include "appl_types.h"
 #include "ELM.h"				//definition of  t_protection_state
+#include "PROT.h"				//definition of  t_PROT_vars
 
 extern void CH4_init(void);
 extern void CH4_control_100ms(void);
-
-// internal values of each protection
-struct CH4_protection
-{
-	t_protection_state State;
-    t_protection_state LastState;
-    DU32               StateTimer;
-    DS16               Limit;
-    DBOOL              Exceeded;
-};
+extern void CH4_ReadParameters(void);
 
 // global Variables of CH4
 typedef struct CH4struct
@@ -52,9 +46,11 @@ typedef struct CH4struct
 
    DS16      CH4Value;           // in 0,1% CH4 (0...1000 = 0,0...100,0%)
    DS32      MaxPower_CH4;       // max. power due to CH4 value
-   struct CH4_protection  Calibrating;
-   struct CH4_protection  CH4ValueLow;
-   struct CH4_protection  CH4ValueTooLow;
+   DBOOL     MonitoringActive;   // CH4 value available and used, protections released
+   DBOOL     LoadRedEnable;      // load reduction monitored by this engine (PMS)
+   t_PROT_vars  Calibrating;
+   t_PROT_vars  CH4ValueLow;
+   t_PROT_vars  CH4ValueTooLow;
    DS16      MixerOffset;        // offset to mixer position in 0,1% of total
    
    DBOOL CH4ValueAvailable;
@@ -65,6 +61,27 @@ typedef struct CH4struct
 
 extern t_CH4 CH4;
 
+// parameter snapshot of CH4
+// filled by CH4_ReadParameters(), used by the control loop instead of PARA[ParRefInd[...]]
+typedef struct CH4paramsstruct
+{
+   DS32      LimitForMaxload;
+   DS32      LimitForMinload;
+   DS32      MeasuredValue;
+   DS32      Minload;
+   DS32      MixAdjustment;
+   DS32      OptionControl;
+   DS32      PercentValueFor20mA;
+   DS32      StandardMix;
+   DS32      StopLimit;
+   // parameters of other modules
+   DS32      GbvParCh4OptionActive;
+   DS32      GenNominalLoad;
+   DS32      PmsRegCh4;
+} t_CH4_params;
+
+extern t_CH4_params CH4_Params;
+
 // constants
 
 // raw value for 0% CH4
@@ -0,0 +1,169 @@
+/**
+ * @file CYL_ext.c
+ * @ingroup Application
+ * One pass supervision of the cylinder temperatures for CYL.c
+ *
+ * @remarks
+ * The temperatures of both sides are copied into one array (CYL.Temp, side A first), and
+ * the result of each limit comparison is one bitmask over the cylinders (CYL.Exceeded[]).
+ * The limits are one array per protection function (CYL.Prot[].Limit[]), so the loops read
+ * contiguous arrays, have no branches per cylinder and can be vectorized by the compiler.
+ *
+ * CYL_Supervision() is called by CYL_control_100ms() (CYL.c) after CYL.Assigned and the
+ * limits (CYL_A(i, Supervision, Limit), CYL_B()) are set, and before the state machines
+ * of the protections run on their bits of CYL.Exceeded[] (CYL_A_EXCEEDED(), CYL_B_EXCEEDED()):
+ *
+ *   1. min, max, sum and number of the valid cylinders of each side in one pass
+ *   2. averages, filtered averages, TMax
+ *   3. all limit comparisons of a cylinder in one pass -> CYL.Exceeded[]
+ *
+ * tools/bench_cyl.c compares it with the comparisons per cylinder, for 20 and 24 cylinders.
+ *
+ * @date 17-oct-2026
+ *
+ * changes:
+ *      17.10.2026      first version
+ *      17.10.2026      on the protections of CYL.A[] / CYL.B[], limits per cylinder
+ *      17.10.2026      limits as arrays per protection function again (CYL.Prot[]), up to 24 cylinders
+ *
+ */
+
+#include "options.h"
+#include "deif_types.h"
+#include "appl_types.h"
+
+#include "CYL.h"
+
+#if (OPTION_CYLINDER_MONITORING == TRUE)
+
+
+// min, max, sum and number of the valid cylinders of one side in one pass, returns the valid ones
+static DU32 Statistics(const DS16 *pTemp, DU32 Assigned, DU8 Count, t_CYL_side *pSide)
+{
+	DS16 Min = 32767;
+	DS16 Max = -32767;
+	DS32 Sum = 0L;
+	DU8 Number = 0;
+	DU32 Valid = 0;
+	DU32 Bit = 1;
+	DS16 T;
+	DU8 v;
+	DU8 i;
+
+	// the bit of the cylinder is shifted along, no shift by i (conditional moves, no branches)
+	for (i = 0; i < Count; i++, Bit <<= 1)
+	{
+		T = pTemp[i];
+		v = (DU8)((Assigned & Bit) && (T != -32768));
+
+		Valid  |= v ? Bit : 0;
+		Min     = (v && (T < Min)) ? T : Min;
+		Max     = (v && (T > Max)) ? T : Max;
+		Sum    += v ? T : 0;
+		Number += v;
+	}
+
+	pSide->Min   = Number ? Min : -32768;
+	pSide->Max   = Number ? Max : -32768;
+	pSide->Sum   = Sum;
+	pSide->Count = Number;
+
+	return (Valid);
+}
+
+// average of one side, -32768 if no cylinder is valid, and its moving average
+static DS16 Average(t_CYL_side *pSide, DS16 *pFiltered)
+{
+	DS16 Value;
+
+	if (pSide->Count == 0)
+		return (-32768); // keep last filtered value
+
+	Value = (DS16)(pSide->Sum / pSide->Count);
+
+	// sum of the last CYL_NUMBER_OF_AVERAGE_VALUES_FOR_FILTERING values
+	pSide->HistorySum += Value - pSide->History[pSide->HistoryIndex];
+	pSide->History[pSide->HistoryIndex] = Value;
+	if (++pSide->HistoryIndex >= CYL_NUMBER_OF_AVERAGE_VALUES_FOR_FILTERING)
+		pSide->HistoryIndex = 0;
+	if (pSide->HistoryCount < CYL_NUMBER_OF_AVERAGE_VALUES_FOR_FILTERING)
+		pSide->HistoryCount++;
+
+	*pFiltered = (DS16)(pSide->HistorySum / pSide->HistoryCount);
+
+	return (Value);
+}
+
+// all limit comparisons of the cylinders of one side, First..First+Count-1, Average of the side
+// sets their bits in CYL.Exceeded[]
+static void Compare(DU8 First, DU8 Count, DS16 Average)
+{
+	const DS16 *pStop  = &CYL.Prot[CYL_OVERTEMP_STOP].Limit[First];
+	const DS16 *pOver  = &CYL.Prot[CYL_OVERTEMP].Limit[First];
+	const DS16 *pUnder = &CYL.Prot[CYL_UNDERTEMP].Limit[First];
+	const DS16 *pDev   = &CYL.Prot[CYL_AVR_DEVIATION].Limit[First];
+	const DS16 *pTemp  = &CYL.Temp[First];
+	DU32 StopMask = 0, OverMask = 0, UnderMask = 0, DevMask = 0;
+	DU32 Valid = CYL.Valid >> First;
+	DU32 Dev = (Average != -32768) ? Valid : 0;		// no average, no deviation
+	DU32 Bit = 1;
+	DS32 T, Diff;
+	DU8 i;
+
+	for (i = 0; i < Count; i++, Bit <<= 1)
+	{
+		T    = pTemp[i];
+		Diff = T - Average;
+		if (Diff < 0)
+			Diff = -Diff;
+
+		StopMask  |= (T > pStop[i]) ? Bit : 0;
+		OverMask  |= (T > pOver[i]) ? Bit : 0;
+		UnderMask |= (T < pUnder[i]) ? Bit : 0;
+		DevMask   |= (Diff > pDev[i]) ? Bit : 0;
+	}
+
+	CYL.Exceeded[CYL_OVERTEMP_STOP] |= (StopMask & Valid) << First;
+	CYL.Exceeded[CYL_OVERTEMP]      |= (OverMask & Valid) << First;
+	CYL.Exceeded[CYL_UNDERTEMP]     |= (UnderMask & Valid) << First;
+	CYL.Exceeded[CYL_AVR_DEVIATION] |= (DevMask & Dev) << First;
+}
+
+// supervision of all cylinders, sets CYL.Exceeded[]
+void CYL_Supervision(void)
+{
+	DS16 AverageA, AverageB;
+	DU8 s, i;
+
+	// inputs of both sides into one array
+	for (i = 0; i < CYL_NBR_OF_CYLINDERS_A; i++)
+		CYL.Temp[CYL_FIRST_A + i] = CYL.TempA[i].Value;
+	for (i = 0; i < CYL_NBR_OF_CYLINDERS_B; i++)
+		CYL.Temp[CYL_FIRST_B + i] = CYL.TempB[i].Value;
+
+	for (s = 0; s < CYL_NBR_OF_SUPERVISIONS; s++)
+		CYL.Exceeded[s] = 0;
+
+	CYL.Valid  = Statistics(&CYL.Temp[CYL_FIRST_A], CYL.Assigned >> CYL_FIRST_A, CYL_NBR_OF_CYLINDERS_A, &CYL.SideA) << CYL_FIRST_A;
+	CYL.Valid |= Statistics(&CYL.Temp[CYL_FIRST_B], CYL.Assigned >> CYL_FIRST_B, CYL_NBR_OF_CYLINDERS_B, &CYL.SideB) << CYL_FIRST_B;
+
+	CYL.NumberOfAssignedCylindersA = CYL.SideA.Count;
+	CYL.NumberOfAssignedCylindersB = CYL.SideB.Count;
+
+	AverageA = Average(&CYL.SideA, &CYL.TxxxAverageAFilteredValue);
+	AverageB = Average(&CYL.SideB, &CYL.TxxxAverageBFilteredValue);
+	CYL.TxxxAverageA = AverageA;
+	CYL.TxxxAverageB = AverageB;
+
+	if ((CYL.SideA.Count + CYL.SideB.Count) != 0)
+		CYL.CylinderAverageTemp = (DS16)((CYL.SideA.Sum + CYL.SideB.Sum) / (CYL.SideA.Count + CYL.SideB.Count));
+	else
+		CYL.CylinderAverageTemp = -32768;
+
+	CYL.TMax = (CYL.SideA.Max > CYL.SideB.Max) ? CYL.SideA.Max : CYL.SideB.Max;
+
+	Compare(CYL_FIRST_A, CYL_NBR_OF_CYLINDERS_A, AverageA);
+	Compare(CYL_FIRST_B, CYL_NBR_OF_CYLINDERS_B, AverageB);
+}
+
+#endif // OPTION_CYLINDER_MONITORING
@@ -0,0 +1,401 @@
+/**
+ * @file LAT.c
+ * @ingroup Application
+ * Trip latency instrumentation (OPTION_TRIP_LATENCY)
+ *
+ * @remarks
+ * A trip passes these stages, each stamped with TMR_Wheel[TMR_TASK_20MS].Now:
+ *
+ *   LAT_EXCEEDED   a protection of PROT_control() goes from COLD to HOT
+ *   LAT_STOP_SET   the flag of its stop condition is set (STOP_Aggr_On, STOP_ext.c)
+ *   LAT_MAIN       the next state change of MAIN (transit, MAIN_CONTROL.c)
+ *   LAT_BREAKER    the next rising edge of a breaker open / trip command (MAIN_control_20ms)
+ *
+ * The ticks from the start of the trip to each later stage go into the histogram of the
+ * stop condition. A stop condition set without a protection of PROT_control() starts
+ * at LAT_STOP_SET. MAIN and breaker stages not reached within LAT_TIMEOUT are counted
+ * as missed (e.g. a warning which does not stop the engine).
+ *
+ * An exceedance only takes a slot in LAT.Exceedance[] of the task of the protection,
+ * PROT_control() frees it when the protection is COLD again (LAT_Cancel), so an
+ * exceedance which does not trip neither takes a record nor is the start of a later
+ * STOP_Set. Records are allocated by LAT_StopSet() only, in the commit of the 20ms task
+ * (single writer of the stop conditions), from the pool of the task whose changes it
+ * writes (STOP_CommitTask); the first LAT_RECORDS_PER_TASK stop conditions of a
+ * task get a record, further ones are counted in LAT.Lost[]. One task writes the slots
+ * of a task, a record is filled before Used[] counts it.
+ *
+ * LAT_ReadRegister() is the register view for Modbus and the Bing-Bang service
+ * LAT_BING_SERVICE, LAT_Dump() prints the records of a host simulation run.
+ *
+ * @date 17-oct-2026
+ *
+ * changes:
+ *      17.10.2026      first version
+ *      17.10.2026      exceedances apart from the records, records per task
+ *      17.10.2026      records allocated in the 20ms commit, pool of STOP_CommitTask
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <bing_bang.h>
+#include "options.h"
+#include "deif_types.h"
+#include "appl_types.h"
+#include "STOPCONDITIONS.h"
+#include "debug.h"
+
+#include "LAT.h"
+#include "TMR.h"
+
+#if (OPTION_TRIP_LATENCY == TRUE)
+
+#define PENDING(Stage)		((DU8)(1 << (Stage)))
+#define NOW()				(TMR_Wheel[TMR_TASK_20MS].Now)
+
+// latencies for global use
+t_LAT LAT;
+
+
+// slot of SCIndex in the exceedances of Task, 0 if none
+static t_LAT_exceedance *FindExceedance(DU8 Task, DU16 SCIndex)
+{
+	DU8 i;
+
+	for (i = 0; i < LAT_NBR_OF_EXCEEDANCES; i++)
+	{
+		if (LAT.Exceedance[Task][i].SCIndex == SCIndex)
+			return (&LAT.Exceedance[Task][i]);
+	}
+	return (0);
+}
+
+// n-th record over the pools of all tasks, 0 if none
+static t_LAT_record *Nth(DU16 n)
+{
+	DU8 Task;
+
+	for (Task = 0; Task < TMR_NBR_OF_TASKS; Task++)
+	{
+		if (n < LAT.Used[Task])
+			return (&LAT.Record[Task][n]);
+		n -= LAT.Used[Task];
+	}
+	return (0);
+}
+
+// sum of a counter per task (LAT.Used, LAT.Lost)
+static DU16 Sum(const DU16 *pCount)
+{
+	DU32 Total = 0;
+	DU8 Task;
+
+	for (Task = 0; Task < TMR_NBR_OF_TASKS; Task++)
+		Total += pCount[Task];
+	return ((Total > 0xFFFF) ? 0xFFFF : (DU16)Total);
+}
+
+// bin of the histogram for Ticks
+static DU8 Bin(DU32 Ticks)
+{
+	DU8 b = 0;
+
+	while (Ticks && (b < (LAT_NBR_OF_BINS - 1)))
+	{
+		Ticks >>= 1;
+		b++;
+	}
+	return (b);
+}
+
+// Stage of the trip of r reached now
+static void Stamp(t_LAT_record *r, DU8 Stage)
+{
+	DU32 Ticks;
+	DU8 s = Stage - LAT_STOP_SET;
+
+	r->Time[Stage] = NOW();
+	r->Pending &= ~PENDING(Stage);
+
+	// the start is the exceedance or the stop condition itself
+	Ticks = r->Time[Stage] - r->Time[r->FromExceedance ? LAT_EXCEEDED : LAT_STOP_SET];
+	if (Ticks > 0xFFFF)
+		Ticks = 0xFFFF;
+
+	r->Last[s] = (DU16)Ticks;
+	if (r->Last[s] > r->Max[s])
+		r->Max[s] = r->Last[s];
+	if (r->Hist[s][Bin(Ticks)] < 0xFFFF)
+		r->Hist[s][Bin(Ticks)]++;
+}
+
+static short Service(DU8 client, DU32 length)
+{
+	DU16 First = 0;
+	DU16 Count = 0;
+	DU16 i;
+	if (client);
+
+	// request: first register, number of registers (high byte first)
+	if (length == 4)
+	{
+		First  = (DU16)(ReadInt8FromBing() << 8);
+		First |= (DU16)ReadInt8FromBing();
+		Count  = (DU16)(ReadInt8FromBing() << 8);
+		Count |= (DU16)ReadInt8FromBing();
+	}
+	if (First >= LAT_NBR_OF_REGISTERS)
+		Count = 0;
+	else if (Count > (LAT_NBR_OF_REGISTERS - First))
+		Count = LAT_NBR_OF_REGISTERS - First;
+	if (Count > 120)
+		Count = 120;
+
+	AddLenToBang(4 + 2 * Count);  // Telegram length
+	AddInt16ToBang(LAT_BING_SERVICE);
+	AddInt16ToBang(0); // Service request accepted
+	for (i = 0; i < Count; i++)
+		AddInt16ToBang(LAT_ReadRegister(First + i));
+
+	return 0;
+}
+
+void LAT_init(void)
+{
+	LAT_Reset();
+
+	if (BbRegisterServiceHandler((ServiceHandler_t)Service, LAT_BING_SERVICE) != 0)
+		PRINT1("\nTrip latency not added to Bing Bang handler!");
+}
+
+void LAT_Reset(void)
+{
+	DU8 Task, i;
+
+	memset(&LAT, 0, sizeof(LAT));
+	for (Task = 0; Task < TMR_NBR_OF_TASKS; Task++)
+	{
+		for (i = 0; i < LAT_NBR_OF_EXCEEDANCES; i++)
+			LAT.Exceedance[Task][i].SCIndex = LAT_NO_INDEX;
+	}
+}
+
+// protection of SCIndex in Task goes from COLD to HOT
+void LAT_Exceeded(DU16 SCIndex, DU8 Task)
+{
+	t_LAT_exceedance *e;
+
+	if (Task >= TMR_NBR_OF_TASKS)
+		return;
+
+	// all in use: the oldest protections which stay HOT lose their start
+	e = FindExceedance(Task, SCIndex);
+	if (e == 0)
+		e = FindExceedance(Task, LAT_NO_INDEX);
+	if (e == 0)
+	{
+		e = &LAT.Exceedance[Task][LAT.ExceedanceNext[Task]];
+		LAT.ExceedanceNext[Task] = (LAT.ExceedanceNext[Task] + 1) % LAT_NBR_OF_EXCEEDANCES;
+	}
+
+	e->SCIndex = LAT_NO_INDEX;
+	e->Time    = NOW();
+	e->SCIndex = SCIndex;
+}
+
+// protection of SCIndex in Task is COLD again, after the commit of its last STOP_Set
+void LAT_Cancel(DU16 SCIndex, DU8 Task)
+{
+	t_LAT_exceedance *e;
+
+	if (Task >= TMR_NBR_OF_TASKS)
+		return;
+
+	e = FindExceedance(Task, SCIndex);
+	if (e)
+		e->SCIndex = LAT_NO_INDEX;
+}
+
+// flag of SCIndex changed from clear to set, in the 20ms commit of the changes of a task
+void LAT_StopSet(DU16 SCIndex)
+{
+	t_LAT_exceedance *e;
+	t_LAT_record *r = 0;
+	DU8 Task = (STOP_CommitTask != STOP_CYCLE_NONE) ? STOP_CommitTask : STOP_Cycle_Running();
+	DU8 t;
+	DU16 i;
+
+	// power up, before the tasks run: pool of the 20ms task
+	if (Task >= TMR_NBR_OF_TASKS)
+		Task = TMR_TASK_20MS;
+
+	for (i = 0; i < LAT.Used[Task]; i++)
+	{
+		if (LAT.Record[Task][i].SCIndex == SCIndex)
+		{
+			r = &LAT.Record[Task][i];
+			break;
+		}
+	}
+
+	if (r == 0)
+	{
+		if (LAT.Used[Task] >= LAT_RECORDS_PER_TASK)
+		{
+			if (LAT.Lost[Task] < 0xFFFF)
+				LAT.Lost[Task]++;
+			return;
+		}
+		r = &LAT.Record[Task][LAT.Used[Task]];
+		memset(r, 0, sizeof(*r));
+		r->SCIndex = SCIndex;
+		LAT.Used[Task]++;
+	}
+
+	for (t = 0; t < TMR_NBR_OF_TASKS; t++)
+	{
+		e = FindExceedance(t, SCIndex);
+		if (e)
+			break;
+	}
+
+	r->FromExceedance = (e != 0);
+	if (r->Trips < 0xFFFF)
+		r->Trips++;
+
+	r->Time[LAT_STOP_SET] = NOW();
+	if (e)
+	{
+		r->Time[LAT_EXCEEDED] = e->Time;
+		Stamp(r, LAT_STOP_SET);
+		// used up; a slot of another task is freed by its own task (LAT_Cancel)
+		if (t == STOP_Cycle_Running())
+			e->SCIndex = LAT_NO_INDEX;
+	}
+
+	r->Pending = PENDING(LAT_MAIN) | PENDING(LAT_BREAKER);
+}
+
+// state change of MAIN
+void LAT_MainReaction(void)
+{
+	t_LAT_record *r;
+	DU16 i;
+
+	for (i = 0; (r = Nth(i)) != 0; i++)
+	{
+		if (r->Pending & PENDING(LAT_MAIN))
+			Stamp(r, LAT_MAIN);
+	}
+}
+
+// at the end of MAIN_control_20ms, BreakerCommand: a breaker is commanded to open / trip
+void LAT_control_20ms(DBOOL BreakerCommand)
+{
+	t_LAT_record *r;
+	DBOOL Edge = BreakerCommand && !LAT.BreakerCommand;
+	DU8 Stage;
+	DU16 i;
+
+	LAT.BreakerCommand = BreakerCommand;
+
+	for (i = 0; (r = Nth(i)) != 0; i++)
+	{
+		if (!(r->Pending & (PENDING(LAT_MAIN) | PENDING(LAT_BREAKER))))
+			continue;
+
+		if (Edge && (r->Pending & PENDING(LAT_BREAKER)))
+			Stamp(r, LAT_BREAKER);
+
+		if ((NOW() - r->Time[LAT_STOP_SET]) < LAT_TIMEOUT)
+			continue;
+
+		for (Stage = LAT_MAIN; Stage <= LAT_BREAKER; Stage++)
+		{
+			if ((r->Pending & PENDING(Stage)) && (r->Missed[Stage - LAT_STOP_SET] < 0xFFFF))
+				r->Missed[Stage - LAT_STOP_SET]++;
+		}
+		r->Pending = 0;
+	}
+}
+
+// register view: LAT_HEADER_REGISTERS (records, lost, bins, ms per tick; records and
+// lost summed over the tasks), then for each record the code (high, low word),
+// index, trips and for LAT_STOP_SET, LAT_MAIN, LAT_BREAKER last, max, missed (ticks)
+// and the histogram; unused registers are 0
+DU16 LAT_ReadRegister(DU16 Address)
+{
+	const t_LAT_record *r;
+	DU32 Code;
+	DU16 s;
+
+	switch (Address)
+	{
+		case 0: return (Sum(LAT.Used));
+		case 1: return (Sum(LAT.Lost));
+		case 2: return (LAT_NBR_OF_BINS);
+		case 3: return (TMR_CycleTime[TMR_TASK_20MS]);
+		default: break;
+	}
+
+	if (Address >= LAT_NBR_OF_REGISTERS)
+		return (0);
+
+	Address -= LAT_HEADER_REGISTERS;
+	r = Nth(Address / LAT_RECORD_REGISTERS);
+	if (r == 0)
+		return (0);
+
+	Address %= LAT_RECORD_REGISTERS;
+
+	switch (Address)
+	{
+		case 0: Code = STOP_GetCode(r->SCIndex); return ((DU16)(Code >> 16));
+		case 1: Code = STOP_GetCode(r->SCIndex); return ((DU16)Code);
+		case 2: return (r->SCIndex);
+		case 3: return (r->Trips);
+		default: break;
+	}
+
+	Address -= 4;
+	s        = Address / LAT_STAGE_REGISTERS;
+	Address %= LAT_STAGE_REGISTERS;
+
+	switch (Address)
+	{
+		case 0: return (r->Last[s]);
+		case 1: return (r->Max[s]);
+		case 2: return (r->Missed[s]);
+		default: return (r->Hist[s][Address - 3]);
+	}
+}
+
+// print all records, e.g. at the end of a host simulation run
+void LAT_Dump(void)
+{
+	static const char * const StageName[LAT_NBR_OF_STAGES - 1] = { "stop set", "MAIN", "breaker" };
+	const t_LAT_record *r;
+	DU16 i;
+	DU8 s, b;
+
+	printf("\n trip latency, ticks of %u ms, %u records, lost per task %u %u %u",
+		   (unsigned)TMR_CycleTime[TMR_TASK_20MS], (unsigned)Sum(LAT.Used), (unsigned)LAT.Lost[TMR_TASK_20MS],
+		   (unsigned)LAT.Lost[TMR_TASK_100MS], (unsigned)LAT.Lost[TMR_TASK_1000MS]);
+
+	for (i = 0; (r = Nth(i)) != 0; i++)
+	{
+		printf("\n SC %lu  index %u  trips %u", (unsigned long)STOP_GetCode(r->SCIndex),
+			   (unsigned)r->SCIndex, (unsigned)r->Trips);
+		for (s = 0; s < (LAT_NBR_OF_STAGES - 1); s++)
+		{
+			printf("\n   %-8s  last %5u  max %5u  missed %5u  hist", StageName[s],
+				   (unsigned)r->Last[s], (unsigned)r->Max[s], (unsigned)r->Missed[s]);
+			for (b = 0; b < LAT_NBR_OF_BINS; b++)
+				printf(" %u", (unsigned)r->Hist[s][b]);
+		}
+	}
+	printf("\n");
+}
+
+#endif // OPTION_TRIP_LATENCY
@@ -0,0 +1,113 @@
+/**
+ * @file LAT.h
+ * @ingroup Application
+ * Trip latency from the exceedance to the stop condition, MAIN and the breaker (OPTION_TRIP_LATENCY)
+ *
+ * @remarks
+ * The stages of a trip are stamped with the tick of the 20ms timer wheel, the latencies
+ * from the start (exceedance, else STOP_Set) are counted in a histogram per stop condition.
+ * The hooks LAT_xxx() are empty without OPTION_TRIP_LATENCY.
+ * @date 17-oct-2026
+ *
+ * changes:
+ *      17.10.2026      first version
+ *      17.10.2026      exceedances per task apart from the records, records per task
+ */
+
+#ifndef LAT_H_
+#define LAT_H_
+
+
+#include "options.h"
+#include "deif_types.h"
+#include "appl_types.h"
+#include "TMR.h"
+
+#if (OPTION_TRIP_LATENCY == TRUE)
+
+// stages of a trip
+#define LAT_EXCEEDED			0		// protection COLD -> HOT (PROT_control)
+#define LAT_STOP_SET			1		// stop condition flag set (STOP_Aggr_On)
+#define LAT_MAIN				2		// next state change of MAIN (transit)
+#define LAT_BREAKER				3		// next open / trip command of a breaker (MAIN_control_20ms)
+#define LAT_NBR_OF_STAGES		4
+
+// bin 0: same tick, bin b: 2^(b-1) .. 2^b - 1 ticks of 20ms, the last bin is open
+#define LAT_NBR_OF_BINS			12
+#define LAT_RECORDS_PER_TASK	12		// stop conditions with a histogram, set in the cycle of a task
+#define LAT_NBR_OF_RECORDS		(TMR_NBR_OF_TASKS * LAT_RECORDS_PER_TASK)
+#define LAT_NBR_OF_EXCEEDANCES	8		// per task: protections gone HOT, until COLD again
+#define LAT_TIMEOUT				1500	// ticks (30s), MAIN / breaker stage counted as missed
+#define LAT_NO_INDEX			0xFFFF	// free exceedance
+
+#define LAT_BING_SERVICE		0x0F	// Bing-Bang service: registers of LAT_ReadRegister()
+
+// register view (Modbus, Bing-Bang): header, then LAT_RECORD_REGISTERS per record
+#define LAT_HEADER_REGISTERS	4		// used records, lost trips, bins, ms per tick
+#define LAT_STAGE_REGISTERS		(3 + LAT_NBR_OF_BINS)	// last, max, missed, histogram
+#define LAT_RECORD_REGISTERS	(4 + (LAT_NBR_OF_STAGES - 1) * LAT_STAGE_REGISTERS)	// code (2), index, trips
+#define LAT_NBR_OF_REGISTERS	(LAT_HEADER_REGISTERS + LAT_NBR_OF_RECORDS * LAT_RECORD_REGISTERS)
+
+// exceedance of a protection which has not gone COLD again
+typedef struct
+{
+	DU16	SCIndex;							// LAT_NO_INDEX: free
+	DU32	Time;
+} t_LAT_exceedance;
+
+// latencies of one stop condition, index 0 of the stage arrays is LAT_STOP_SET
+typedef struct
+{
+	DU16	SCIndex;
+	DU8		Pending;							// bit per stage still to come (LAT_MAIN, LAT_BREAKER)
+	DU8		FromExceedance;						// start of the trip is LAT_EXCEEDED
+	DU32	Time[LAT_NBR_OF_STAGES];			// 20ms ticks of the stages of the last trip
+	DU16	Trips;
+	DU16	Last[LAT_NBR_OF_STAGES - 1];		// ticks from the start
+	DU16	Max[LAT_NBR_OF_STAGES - 1];
+	DU16	Missed[LAT_NBR_OF_STAGES - 1];		// stage not reached within LAT_TIMEOUT
+	DU16	Hist[LAT_NBR_OF_STAGES - 1][LAT_NBR_OF_BINS];
+} t_LAT_record;
+
+// each task only writes its own exceedances (PROT_control) and allocates only its own
+// records (LAT_StopSet in its STOP cycle), the others only read them
+typedef struct
+{
+	DU16				Used[TMR_NBR_OF_TASKS];		// records in use
+	DU16				Lost[TMR_NBR_OF_TASKS];		// trips without a free record
+	DBOOL				BreakerCommand;				// of the last cycle
+	t_LAT_exceedance	Exceedance[TMR_NBR_OF_TASKS][LAT_NBR_OF_EXCEEDANCES];
+	DU8					ExceedanceNext[TMR_NBR_OF_TASKS];	// replaced next if all are in use
+	t_LAT_record		Record[TMR_NBR_OF_TASKS][LAT_RECORDS_PER_TASK];
+} t_LAT;
+
+extern t_LAT LAT;
+
+extern void  LAT_init(void);
+extern void  LAT_Reset(void);
+extern void  LAT_Exceeded(DU16 SCIndex, DU8 Task);
+extern void  LAT_Cancel(DU16 SCIndex, DU8 Task);
+extern void  LAT_StopSet(DU16 SCIndex);
+extern void  LAT_MainReaction(void);
+extern void  LAT_control_20ms(DBOOL BreakerCommand);
+extern DU16  LAT_ReadRegister(DU16 Address);
+extern void  LAT_Dump(void);
+
+#define LAT_EXCEEDED_HOOK(SCIndex, Task)	LAT_Exceeded(SCIndex, Task)
+#define LAT_CANCEL_HOOK(SCIndex, Task)	LAT_Cancel(SCIndex, Task)
+#define LAT_STOP_SET_HOOK(SCIndex)		LAT_StopSet(SCIndex)
+#define LAT_MAIN_HOOK()					LAT_MainReaction()
+#define LAT_CONTROL_20MS_HOOK(Command)	LAT_control_20ms(Command)
+
+#else
+
+#define LAT_EXCEEDED_HOOK(SCIndex, Task)
+#define LAT_CANCEL_HOOK(SCIndex, Task)
+#define LAT_STOP_SET_HOOK(SCIndex)
+#define LAT_MAIN_HOOK()
+#define LAT_CONTROL_20MS_HOOK(Command)
+
+#endif // OPTION_TRIP_LATENCY
+
+
+#endif /*LAT_H_*/
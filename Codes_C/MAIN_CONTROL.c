@@ -179,6 +179,23 @@
  * 098	  21.07.2017  MVO  NOx and O2 exhaust sensor values
  * 						   new module SCR for catalyst operation
  * 436729 18.09.2017  MVO  MVO_COMMITT_SCR entfernt
+ * 		  16.10.2026       parameter snapshot MAIN_Params, read instead of PARA[ParRefInd[...]] in the states
+ * 		  16.10.2026       PAR_DispatchChanges() in 100ms and 1000ms loop, snapshot and deload/acceleration
+ * 		                   timeouts recalculated on parameter change instead of every second
+ * 		  16.10.2026       PAR_ApplyTransaction() at the beginning of the 100ms loop
+ * 		  17.10.2026       PAR_Delta_control_100ms(), substate file transfer also while a delta is applied
+ * 		  17.10.2026       TMR_Tick() of the timer wheels at the beginning of the 20ms, 100ms and 1000ms loop
+ * 		  17.10.2026       trip latency: state changes and breaker commands stamped (LAT.h)
+ * 		  17.10.2026       parameter id / stop condition code lookup tables built in MAIN_control_init()
+ * 		  17.10.2026       PAR_Nov_Verify() in MAIN_control_init()
+ * 		  17.10.2026       batch range validation of all parameters in MAIN_control_init()
+ * 		  17.10.2026       layout version of STC checked in MAIN_control_init()
+ * 		  17.10.2026       stop condition changes of the task cycle flushed before the states
+ * 		  17.10.2026       protection enable bitset built in MAIN_control_init()
+ * 		  17.10.2026       snapshot MAIN_Params double buffered
+ * 		  17.10.2026       snapshot only switched if no transaction was applied while reading it
+ * 		  17.10.2026       STOP_Aggr_Check() in the 1000ms loop
+ * 		  17.10.2026       parameter access profiler: task set around the 20ms, 100ms and 1000ms loop
  */
 
 #include "options.h"
@@ -233,6 +250,8 @@
 #include "TXT.h"
 #include "PAR.h"
 #include "PID.h"
+#include "TMR.h"
+#include "LAT.h"
 #include "PMS.h"
 #include "RGB.h"
 #include "SCR.h"
@@ -249,8 +268,8 @@
 t_nov_mainlog mainlog;
 
 // Position control in low idle
-#define PAR_CUMMINS_OPTION				(PARA[ParRefInd[CUMMINS_OPTION__PARREFIND]].Value)
-#define PAR_CUMMINS_THROTTLE_LOW_IDLE	(PARA[ParRefInd[CUMMINS_THROTTLE_LOW_IDLE__PARREFIND]].Value)
+#define PAR_CUMMINS_OPTION				(MAIN_Params.CumminsOption)
+#define PAR_CUMMINS_THROTTLE_LOW_IDLE	(MAIN_Params.CumminsThrottleLowIdle)
 
 // declaration of the state transit and the state functions
 
@@ -296,10 +315,15 @@ static void SynchronConnectL1E(const DU8 sig);
 //static void GridParallelOperationPOil(const DU8 sig);
 static void DisconnectL1EtoIsland(const DU8 sig);		// rmiEPF
 static void DisconnectT1EIsland(const DU8 sig);			// rmiEPF
+static void MAIN_CalculateTimeouts(void);
 
 // Maincontrol structure including all public Variables of MAIN, see .h
 t_MAIN_IO MAIN_IO;
 t_MAIN MAIN;
+// snapshot of the parameters used by MAIN, MAIN_ReadParameters() fills the standby buffer
+// and then switches MAIN_pParams to it
+static t_MAIN_params ParamsBuffer[2];
+const t_MAIN_params * volatile MAIN_pParams = &ParamsBuffer[0];
 
 // Local variables, not known outside this module
 static STATE 	myState = 0;
@@ -308,6 +332,7 @@ static DU32 	myStateCnt = 0;
 //static DU16 	MAIN_stateLogCnt;
 static DBOOL 	PowerReductionActive;
 static DU32 	DeloadCounter;
+static DU32 	TimeoutNominalSpeed;				// TUR.NominalSpeed used for MAIN.AccelerationTimeout
 //static DU32 	DieselToPoilWaitTimer;
 static DBOOL 	CloseThrottle = FALSE;				// close DK in case of MCB trip
 
@@ -407,16 +432,16 @@ static void MAIN_Set_FAB_mode(void)
 
 extern void MAIN_Set_LowIdleSpeed(void)
 {
-	if (PARA[ParRefInd[LOW_IDLE_OPTION__PARREFIND]].Value == 0L) // Option = off
+	if (MAIN_Params.LowIdleOption == 0L) // Option = off
 		MAIN.LowIdleSpeed_Demand = FALSE;
 	else if (MAIN.state < MAIN_SYSTEM_STOP)
 		MAIN.LowIdleSpeed_Demand = FALSE;
 	else if (!MAIN.ManualOperation)
 	{
-		if (PARA[ParRefInd[LOW_IDLE_OPTION__PARREFIND]].Value == 1L) // Option = oil temperature
-			MAIN.LowIdleSpeed_Demand = ENG.LubeOilTemp_Available && (ENG.LubeOilTemp.Value < (DS16)PARA[ParRefInd[LOW_IDLE_RELEASE_OIL_TEMP__PARREFIND]].Value);
+		if (MAIN_Params.LowIdleOption == 1L) // Option = oil temperature
+			MAIN.LowIdleSpeed_Demand = ENG.LubeOilTemp_Available && (ENG.LubeOilTemp.Value < (DS16)MAIN_Params.LowIdleReleaseOilTemp);
 		else // Option = time OR Option = oil temp. + time
-			MAIN.LowIdleSpeed_Demand = (PARA[ParRefInd[LOW_IDLE_RELEASE_TIME__PARREFIND]].Value > 0L);
+			MAIN.LowIdleSpeed_Demand = (MAIN_Params.LowIdleReleaseTime > 0L);
 	}
 	// else MAIN.LowIdleSpeed_Demand is set via soft-button in ManualMode
 }
@@ -487,7 +512,7 @@ static void transit( STATE newState )
 	
 	if ( newState != myState )
 	{
-		if ((newState == GridParallelOperationLimitedLoad) AND (PARA[ParRefInd[SPEED_REG_DROOP_MODE__PARREFIND]].Value & BIT2))
+		if ((newState == GridParallelOperationLimitedLoad) AND (MAIN_Params.SpeedRegDroopMode & BIT2))
 			newState = GridParallelOperationFullLoad;
 
 		#ifdef DEBUG_MAIN
@@ -512,6 +537,9 @@ static void transit( STATE newState )
 		}
 		myStateCnt = 0;
 
+		// reaction of MAIN to a stop condition
+		LAT_MAIN_HOOK();
+
 		#ifdef DEBUG_MAIN
 		PRINT2("\n MAIN transit new state : %s",MAIN_state_text(MAIN.state));
 		#endif
@@ -522,8 +550,17 @@ static void transit( STATE newState )
 void MAIN_control_20ms(void)
 {
 	static DBOOL StartDemand_Old = ON;
+#if (OPTION_PAR_PROFILER == TRUE)
+	DU8 ProfilePrevTask = PAR_Profile_EnterTask(PAR_PROFILE_TASK_20MS);	// parameter reads counted for this task
+#endif
 
 	//DTIMESTAMP now;
+
+	// timeouts of the 20ms task (protections)
+	TMR_Tick(TMR_TASK_20MS);
+
+	// stop conditions set or cleared in this cycle before the states are evaluated
+	STOP_FlushCycle(STOP_CYCLE_TASK_20MS);
 	
 	// increment the timecounter for this state
 	// by adding 20ms for the time since last call
@@ -563,11 +600,11 @@ void MAIN_control_20ms(void)
 	   )
     {
 	    STOP_Set(STOPCONDITION_20001);
-	    STOP_Tripped[STOPCONDITION_20001] = TRUE;
+	    STOP_SetTripped(STOPCONDITION_20001, TRUE);
 	    // blocked as long as input is set
     }
     else // fast stop is neither set via digital input nor via modbus -> can be acknowledged
-        STOP_Tripped[STOPCONDITION_20001] = FALSE;
+        STOP_SetTripped(STOPCONDITION_20001, FALSE);
     
     // automatic operation is set via modbus
     if (MBA.WriteConfigurationDigital & MBA_CONFIG_AUTOMATIC_OPERATION)
@@ -577,7 +614,7 @@ void MAIN_control_20ms(void)
            if (STOP_is_Set(STOPCONDITION_30001)) // = manual mode
            {
              // auto mode demanded
-             STOP_Tripped[STOPCONDITION_30001] = FALSE;  // enable acknowledging
+             STOP_SetTripped(STOPCONDITION_30001, FALSE);  // enable acknowledging
              STOP_Clear(STOPCONDITION_30001);
              // set GOV and AVR to auto mode
              TUR.GOVManual = FALSE;
@@ -591,7 +628,7 @@ void MAIN_control_20ms(void)
              {
                // manual mode demanded
                STOP_Set(STOPCONDITION_30001);
-               STOP_Tripped[STOPCONDITION_30001] = TRUE; // block acknowledge function
+               STOP_SetTripped(STOPCONDITION_30001, TRUE); // block acknowledge function
              }
        }
     }
@@ -603,7 +640,7 @@ void MAIN_control_20ms(void)
            if (STOP_is_Set(STOPCONDITION_30001)) // = manual mode
            {
              // auto mode demanded
-             STOP_Tripped[STOPCONDITION_30001] = FALSE;  // enable acknowledging
+             STOP_SetTripped(STOPCONDITION_30001, FALSE);  // enable acknowledging
              STOP_Clear(STOPCONDITION_30001);
              // set GOV and AVR to auto mode
              TUR.GOVManual = FALSE;
@@ -617,7 +654,7 @@ void MAIN_control_20ms(void)
              {
                // manual mode demanded
                STOP_Set(STOPCONDITION_30001);
-               STOP_Tripped[STOPCONDITION_30001] = TRUE; // block acknowledge function
+               STOP_SetTripped(STOPCONDITION_30001, TRUE); // block acknowledge function
              }
        }
     }
@@ -636,7 +673,7 @@ void MAIN_control_20ms(void)
 		// check if modbus startdemand remote is set
 		if (MBA.WriteConfigurationDigital & MBA_CONFIG_START_DEMAND)
 		{
-			if (PARA[ParRefInd[MAIN_STARTDEMAND_ON_RISING_EDGE__PARREFIND]].Value) // start demand on rising edge
+			if (MAIN_Params.StartdemandOnRisingEdge) // start demand on rising edge
 			{
 				// reset start demand
 				if ( (STOP.actualLevel < 3) || MAIN.RegularStop )
@@ -667,7 +704,7 @@ void MAIN_control_20ms(void)
 		// check if digital input startdemand remote is set
 		else if (DI_FUNCT[START_ENGINE].Assigned == ASSIGNED)
 		{
-			if (PARA[ParRefInd[MAIN_STARTDEMAND_ON_RISING_EDGE__PARREFIND]].Value) // start demand on rising edge
+			if (MAIN_Params.StartdemandOnRisingEdge) // start demand on rising edge
 			{
 				// reset start demand
 				if ( (STOP.actualLevel < 3) || MAIN.RegularStop )
@@ -710,7 +747,7 @@ void MAIN_control_20ms(void)
     // check if modbus startdemand remote is set
     else if (MBA.WriteConfigurationDigital & MBA_CONFIG_START_DEMAND)
     {
-    	if (PARA[ParRefInd[MAIN_STARTDEMAND_ON_RISING_EDGE__PARREFIND]].Value) // start demand on rising edge
+    	if (MAIN_Params.StartdemandOnRisingEdge) // start demand on rising edge
     	{
     	    // reset start demand
     	    if ( (STOP.actualLevel < 3) || MAIN.RegularStop )
@@ -746,7 +783,7 @@ void MAIN_control_20ms(void)
     // check if digital input startdemand remote is set
     else if (DI_FUNCT[START_ENGINE].Assigned == ASSIGNED)
     {
-    	if (PARA[ParRefInd[MAIN_STARTDEMAND_ON_RISING_EDGE__PARREFIND]].Value) // start demand on rising edge
+    	if (MAIN_Params.StartdemandOnRisingEdge) // start demand on rising edge
     	{
     	    // reset start demand
     	    if ( (STOP.actualLevel < 3) || MAIN.RegularStop )
@@ -797,26 +834,26 @@ void MAIN_control_20ms(void)
     if ((!MAIN.DI_DigitalAutoDemand) && (DI_FUNCT[AUTO_DEMAND].Assigned == ASSIGNED))
     {
       STOP_Set( STOPCONDITION_50002 ); // Running blocked by switch AUTO-OFF on switchboard panel
-      STOP_Tripped[STOPCONDITION_50002] = TRUE; // cannot be acknowledged         
+      STOP_SetTripped(STOPCONDITION_50002, TRUE); // cannot be acknowledged         
     }  
     else
     {
-      STOP_Tripped[STOPCONDITION_50002] = FALSE;
+      STOP_SetTripped(STOPCONDITION_50002, FALSE);
       STOP_Clear( STOPCONDITION_50002 );
     } 
           
     if (!MAIN.startdemand)  
     {
       STOP_Set( STOPCONDITION_50100 ); // Demand removed by user -> Show text
-      STOP_Tripped[STOPCONDITION_50100] = TRUE;  // cannot be acknowledged
+      STOP_SetTripped(STOPCONDITION_50100, TRUE);  // cannot be acknowledged
     }
     else
     {
-      STOP_Tripped[STOPCONDITION_50100] = FALSE; // can be acknowledged again 
+      STOP_SetTripped(STOPCONDITION_50100, FALSE); // can be acknowledged again 
       STOP_Clear( STOPCONDITION_50100 );
     }
 
-    if (ft_LoadBusy OR ft_SaveBusy)
+    if (ft_LoadBusy OR ft_SaveBusy OR PAR_Delta.Busy)
         MAIN.subState = MAIN_SUB_FT_ACTIVE;
     else if (MAIN.Simulation)
     	MAIN.subState = MAIN_SUB_SIMULATION;
@@ -918,13 +955,21 @@ void MAIN_control_20ms(void)
 	  MAIN.subState = MAIN_SUB_ADJUSTING_POWER; 
 	/*
 	else if ( (MAIN.regState == MAIN_GRID_PARALLEL_ADJUST_BLINDPOWER)
-	 	 	 && (PARA[ParRefInd[NBR_OF_SC_MODULES__PARREFIND]].Value > NO_SCM) ) // NO_SCM
+	 	 	 && (PAR_VALUE(NBR_OF_SC_MODULES__PARREFIND) > NO_SCM) ) // NO_SCM
 	  MAIN.subState = MAIN_SUB_ADJUSTING_VAR;
 	*/
 	else MAIN.subState = SUBSTATE_NO_TEXT;
   
 	// call the actual state-function
 	if (myState != 0) myState(SIG_DO);  		
+
+	// trip latency: open / trip command of generator or mains breaker
+	LAT_CONTROL_20MS_HOOK( HVS.DO_OpenGeneratorBreaker || !HVS.DO_TripGeneratorBreaker
+						   || HVS.DO_OpenMainsBreaker || HVS.DO_TripMainsBreaker );
+
+#if (OPTION_PAR_PROFILER == TRUE)
+	PAR_Profile_LeaveTask(ProfilePrevTask);
+#endif
 }
 
 	 
@@ -958,8 +1003,26 @@ void MAIN_control_100ms(void)
 
 	// 100ms handler
 	DTIMESTAMP now;
+#if (OPTION_PAR_PROFILER == TRUE)
+	DU8 ProfilePrevTask = PAR_Profile_EnterTask(PAR_PROFILE_TASK_100MS);	// parameter reads counted for this task
+#endif
 	now = GetSystemTime();
 
+	// timeouts of the 100ms task (protections)
+	TMR_Tick(TMR_TASK_100MS);
+
+	// stop conditions set or cleared in this cycle before the states are evaluated
+	STOP_FlushCycle(STOP_CYCLE_TASK_100MS);
+
+	// write committed parameter transactions (curves, PID sets) at the task boundary
+	PAR_ApplyTransaction();
+
+	// next step of a received parameter delta (file transfer)
+	PAR_Delta_control_100ms();
+
+	// notify parameter changes (HMI, modbus or file transfer) to the 100ms listeners
+	PAR_DispatchChanges(PAR_NOTIFY_TASK_100MS);
+
 /*  relocate to 1000msTask
 	// Evaluate if power setpoint has changed
 	MAIN.PowerSetpointHasChanged = SetpointHasChanged(); 
@@ -1022,14 +1085,33 @@ void MAIN_control_100ms(void)
 	// Update DO for ext. GOV to run at low idle speed
 	MAIN.DO_LowIdleSpeed = MAIN.LowIdleSpeed_Demand;
 
+#if (OPTION_PAR_PROFILER == TRUE)
+	PAR_Profile_LeaveTask(ProfilePrevTask);
+#endif
 } // end MAIN_control_100ms
 
 // main control loop called all 1000ms
 void MAIN_control_1000ms(void)
 {
+#if (OPTION_PAR_PROFILER == TRUE)
+	DU8 ProfilePrevTask = PAR_Profile_EnterTask(PAR_PROFILE_TASK_1000MS);	// parameter reads counted for this task
+#endif
+
+	// timeouts of the 1000ms task (protections)
+	TMR_Tick(TMR_TASK_1000MS);
+
+	// stop conditions set or cleared in this cycle before the states are evaluated
+	STOP_FlushCycle(STOP_CYCLE_TASK_1000MS);
+
+	// counters of the stop condition aggregate against the bitsets (rebuild by the 20ms task)
+	STOP_Aggr_Check();
+
+	// notify parameter changes (HMI, modbus or file transfer) to the 1000ms listeners
+	PAR_DispatchChanges(PAR_NOTIFY_TASK_1000MS);
+
 	// operation blocked
-	if (PARA[ParRefInd[QUICKSTOP_ACTIVE__PARREFIND]].Value < 2L)
-		STOP_Tripped[STOPCONDITION_50001] = FALSE;
+	if (PAR_VALUE(QUICKSTOP_ACTIVE__PARREFIND) < 2L)
+		STOP_SetTripped(STOPCONDITION_50001, FALSE);
 
 	// Evaluate if power setpoint has changed
 	MAIN.PowerSetpointHasChanged = SetpointHasChanged();
@@ -1041,32 +1123,13 @@ void MAIN_control_1000ms(void)
 		NOV_UpdateRequest[NOV_UPDATE_MAINLOG] = TRUE;
 	}
 
-	// set Deload timeout limit
-	// nominal power/power ramp + 20%
-	if (PARA[ParRefInd[POWER_RAMP_DOWN__PARREFIND]].Value >= 100L)
-		MAIN.DeloadTimeout = (PARA[ParRefInd[GEN_NOMINAL_LOAD__PARREFIND]].Value * 12 / (PARA[ParRefInd[POWER_RAMP_DOWN__PARREFIND]].Value/100L));
-	else
-		MAIN.DeloadTimeout = MAIN_DELOAD_TIMEOUT;
-
-	// calculate acceleration timeout
-	{
-		DU32 Timeout;
-
-		if (PARA[ParRefInd[SPEED_RAMP_UP__PARREFIND]].Value/1000L > 0L)
-			Timeout = (TUR.NominalSpeed - PARA[ParRefInd[STRT_VALUE_SPEED_RAMP__PARREFIND]].Value*1000L) / (PARA[ParRefInd[SPEED_RAMP_UP__PARREFIND]].Value/1000L);
-		else
-			Timeout = MAIN_ACCELERATION_STATE_TIMEOUT;
-
-		// add 20% reserve
-		Timeout += (Timeout/5);
-
-		// limitation to minimum value
-		if (Timeout < MAIN_ACCELERATION_STATE_TIMEOUT)
-			Timeout = MAIN_ACCELERATION_STATE_TIMEOUT;
-
-		MAIN.AccelerationTimeout = Timeout;
-	}
+	// acceleration timeout depends on the nominal speed, too
+	if (TUR.NominalSpeed != TimeoutNominalSpeed)
+		MAIN_CalculateTimeouts();
 
+#if (OPTION_PAR_PROFILER == TRUE)
+	PAR_Profile_LeaveTask(ProfilePrevTask);
+#endif
 } // end MAIN_control_1000ms
 
 
@@ -1115,6 +1178,82 @@ void ResetMainlog(void)
 
 }
 
+// calculate deload and acceleration timeout
+// called by parameter change notification and if the nominal speed changed
+static void MAIN_CalculateTimeouts(void)
+{
+	DU32 Timeout;
+
+	// set Deload timeout limit
+	// nominal power/power ramp + 20%
+	if (PAR_VALUE(POWER_RAMP_DOWN__PARREFIND) >= 100L)
+		MAIN.DeloadTimeout = (PAR_VALUE(GEN_NOMINAL_LOAD__PARREFIND) * 12 / (PAR_VALUE(POWER_RAMP_DOWN__PARREFIND)/100L));
+	else
+		MAIN.DeloadTimeout = MAIN_DELOAD_TIMEOUT;
+
+	// calculate acceleration timeout
+	TimeoutNominalSpeed = TUR.NominalSpeed;
+
+	if (PAR_VALUE(SPEED_RAMP_UP__PARREFIND)/1000L > 0L)
+		Timeout = (TUR.NominalSpeed - PAR_VALUE(STRT_VALUE_SPEED_RAMP__PARREFIND)*1000L) / (PAR_VALUE(SPEED_RAMP_UP__PARREFIND)/1000L);
+	else
+		Timeout = MAIN_ACCELERATION_STATE_TIMEOUT;
+
+	// add 20% reserve
+	Timeout += (Timeout/5);
+
+	// limitation to minimum value
+	if (Timeout < MAIN_ACCELERATION_STATE_TIMEOUT)
+		Timeout = MAIN_ACCELERATION_STATE_TIMEOUT;
+
+	MAIN.AccelerationTimeout = Timeout;
+}
+
+// copy the parameters used by the states into the standby snapshot and switch to it,
+// the preempting 20ms / 100ms task see either the old or the new snapshot as a whole
+void MAIN_ReadParameters(void)
+{
+	t_MAIN_params *pStandby = (MAIN_pParams == &ParamsBuffer[0]) ? &ParamsBuffer[1] : &ParamsBuffer[0];
+	DU32 Seq = PAR_BUILD_BEGIN();
+
+	pStandby->IdleRunTimeout              = PAR_VALUE(MAIN_IDLE_RUN_TIMEOUT__PARREFIND);
+	pStandby->StartdemandOnRisingEdge     = PAR_VALUE(MAIN_STARTDEMAND_ON_RISING_EDGE__PARREFIND);
+	pStandby->AudBattVoltTimer            = PAR_VALUE(AUD_BATT_VOLT_TIMER__PARREFIND);
+	pStandby->ChangeAfterEmergStop        = PAR_VALUE(CHANGE_AFTER_EMERG_STOP__PARREFIND);
+	pStandby->CoolDownTime                = PAR_VALUE(COOL_DOWN_TIME__PARREFIND);
+	pStandby->CumminsOption               = PAR_VALUE(CUMMINS_OPTION__PARREFIND);
+	pStandby->CumminsThrottleLowIdle      = PAR_VALUE(CUMMINS_THROTTLE_LOW_IDLE__PARREFIND);
+	pStandby->EngineId                    = PAR_VALUE(ENGINE_ID__PARREFIND);
+	pStandby->EngineRunning               = PAR_VALUE(ENGINE_RUNNING__PARREFIND);
+	pStandby->EngStopWithIgn              = PAR_VALUE(ENG_STOP_WITH_IGN__PARREFIND);
+	pStandby->EpfMainsFailureDelay        = PAR_VALUE(EPF_MAINS_FAILURE_DELAY__PARREFIND);
+	pStandby->EpfResynchronising          = PAR_VALUE(EPF_RESYNCHRONISING__PARREFIND);
+	pStandby->EpfSwitchOnTime             = PAR_VALUE(EPF_SWITCH_ON_TIME__PARREFIND);
+	pStandby->GenAvrActivationSpeed       = PAR_VALUE(GEN_AVR_ACTIVATION_SPEED__PARREFIND);
+	pStandby->GenNominalLoad              = PAR_VALUE(GEN_NOMINAL_LOAD__PARREFIND);
+	pStandby->IgnOption                   = PAR_VALUE(IGN_OPTION__PARREFIND);
+	pStandby->LowIdleOption               = PAR_VALUE(LOW_IDLE_OPTION__PARREFIND);
+	pStandby->LowIdleReleaseOilTemp       = PAR_VALUE(LOW_IDLE_RELEASE_OIL_TEMP__PARREFIND);
+	pStandby->LowIdleReleaseTime          = PAR_VALUE(LOW_IDLE_RELEASE_TIME__PARREFIND);
+	pStandby->LowIdleTimeout              = PAR_VALUE(LOW_IDLE_TIMEOUT__PARREFIND);
+	pStandby->MixIdlePosInAcceleration    = PAR_VALUE(MIX_IDLE_POS_IN_ACCELERATION__PARREFIND);
+	pStandby->MixRunningTime0To100Percent = PAR_VALUE(MIX_RUNNING_TIME_0_TO_100_PERCENT__PARREFIND);
+	pStandby->NbrOfScModules              = PAR_VALUE(NBR_OF_SC_MODULES__PARREFIND);
+	pStandby->PmsRegCh4                   = PAR_VALUE(PMS_REG_CH4__PARREFIND);
+	pStandby->PmsRegGasLevel              = PAR_VALUE(PMS_REG_GAS_LEVEL__PARREFIND);
+	pStandby->PmsRegMainsPower            = PAR_VALUE(PMS_REG_MAINS_POWER__PARREFIND);
+	pStandby->PowerWarmingLoad            = PAR_VALUE(POWER_WARMING_LOAD__PARREFIND);
+	pStandby->PowerWarmingTimeout         = PAR_VALUE(POWER_WARMING_TIMEOUT__PARREFIND);
+	pStandby->SpeedRampUp                 = PAR_VALUE(SPEED_RAMP_UP__PARREFIND);
+	pStandby->SpeedRegDroopMode           = PAR_VALUE(SPEED_REG_DROOP_MODE__PARREFIND);
+	pStandby->StrtValueSpeedRamp          = PAR_VALUE(STRT_VALUE_SPEED_RAMP__PARREFIND);
+	pStandby->SyncTimeout                 = PAR_VALUE(SYNC_TIMEOUT__PARREFIND);
+
+	// transaction applied meanwhile: keep the old snapshot, read again in the next cycle
+	if (PAR_BUILD_VALID(Seq))
+		MAIN_pParams = pStandby;
+}
+
 // initialisation function of this module
 void MAIN_control_init(void)
 {
@@ -1122,6 +1261,17 @@ void MAIN_control_init(void)
 	PRINT1("\n MAIN_control_init");
 	#endif
 
+	// (PAR.init happens before MAIN_control_init, so the snapshot is valid from here on)
+	MAIN_ReadParameters();
+	MAIN_CalculateTimeouts();
+
+	// recalculate on parameter change (1000ms task)
+	PAR_RegisterListener(PAR_NOTIFY_TASK_1000MS, PAR_LISTEN_ALL, PAR_LISTEN_ALL, MAIN_ReadParameters);
+	PAR_RegisterListener(PAR_NOTIFY_TASK_1000MS, POWER_RAMP_DOWN__PARREFIND, POWER_RAMP_DOWN__PARREFIND, MAIN_CalculateTimeouts);
+	PAR_RegisterListener(PAR_NOTIFY_TASK_1000MS, GEN_NOMINAL_LOAD__PARREFIND, GEN_NOMINAL_LOAD__PARREFIND, MAIN_CalculateTimeouts);
+	PAR_RegisterListener(PAR_NOTIFY_TASK_1000MS, SPEED_RAMP_UP__PARREFIND, SPEED_RAMP_UP__PARREFIND, MAIN_CalculateTimeouts);
+	PAR_RegisterListener(PAR_NOTIFY_TASK_1000MS, STRT_VALUE_SPEED_RAMP__PARREFIND, STRT_VALUE_SPEED_RAMP__PARREFIND, MAIN_CalculateTimeouts);
+
     MAIN.DI_DigitalAutoDemand                           = FALSE; 
     MAIN.startdemand                                    = FALSE;    
     MAIN.StartdemandLocal                               = FALSE;    
@@ -1149,6 +1299,11 @@ void MAIN_control_init(void)
        MAIN.T1EisSynchron.TextIfTRUE_Native             = "SYNKRON";   	
        MAIN.T1EisSynchron.colorIfFALSE                  = cl_LED_RED;   	
        MAIN.T1EisSynchron.colorIfTRUE                   = cl_LED_GREEN;   	
+#if (OPTION_TRIP_LATENCY == TRUE)
+     // trip latency records, bingbang service LAT_BING_SERVICE
+     LAT_init();
+#endif
+
      // register date and time setting as bingbang service
      if ( BbRegisterServiceHandler( (ServiceHandler_t)SetTime, 0x0C ) != 0 )
       PRINT1("\nSet Time not added to Bing Bang handler!");
@@ -1159,10 +1314,19 @@ void MAIN_control_init(void)
     
     // acknowledge all faults
 	// after booting to avoid ghost stop conditions (left over from last software) being set
+	STOP_Nov_CheckVersion();		// STC of another layout version: cleared first
 	STOP_ClearAllLevels();			// rmiSPT
     // always start with emergency stop after download or power up
     STOP_Set(STOPCONDITION_10201);
 
+    // parameters loaded by PAR_init(): CRC of the NOVRAM pages, factory settings for bad ones
+    PAR_Nov_Verify();
+    // limits set by PAR_init(), then all values into their limits in one pass
+    PAR_Validate_Init();
+    PAR_ValidateAll(TRUE, 0);
+    // enabled protections from the validated CONFIG_GRID_PROT / CONFIG_GEN_PROT
+    STOP_ProtEnable_init();
+
     // No Activation necessary for test software
     if (SW_NUMBER >= 900)
     {
@@ -1173,10 +1337,16 @@ void MAIN_control_init(void)
     if (!NOV.SoftwareActivated)
     {
     	STOP_Set(STOPCONDITION_0);
-    	STOP_Tripped[STOPCONDITION_0] = TRUE;
+    	STOP_SetTripped(STOPCONDITION_0, TRUE);
     }
 
-    MAIN.SC_IndexToStopTrending = STOP_Get_Index((DU32)PARA[ParRefInd[TRE_SC_INDEX_TO_STOP_TRENDING__PARREFIND]].Value);
+    // lookup tables sorted by id / code, built here and not on the first modbus request
+    PAR_IdLookup_Build();
+    STOP_CodeLookup_Build();
+
+    // code not found: index STOP_Get_Index() returns for it
+    if (!STOP_CodeLookup_Find((DU32)PAR_VALUE(TRE_SC_INDEX_TO_STOP_TRENDING__PARREFIND), &MAIN.SC_IndexToStopTrending))
+    	MAIN.SC_IndexToStopTrending = STOP_Get_Index((DU32)PAR_VALUE(TRE_SC_INDEX_TO_STOP_TRENDING__PARREFIND));
 
     MAIN.Simulation = OFF;
     MAIN.MaintenanceMode = OFF;
@@ -1682,7 +1852,7 @@ static void EmergencyStop(const DU8 sig)
 			//HVS.modeL1E   = HVS_L1E_KEEP;       // keep state of 22L1E
 			
 			// switch off test mode
-			STOP_Tripped[STOPCONDITION_20099] = FALSE; // can be acknowledged
+			STOP_SetTripped(STOPCONDITION_20099, FALSE); // can be acknowledged
 			STOP_Clear(STOPCONDITION_20099); // test mode off
 		
 			// define actual MAIN.state
@@ -1698,7 +1868,7 @@ static void EmergencyStop(const DU8 sig)
 			MAIN.WishToCloseGCB       = FALSE;
 			MAIN.EngineRunningNominalDelayed					= FALSE;
 
-			if (PARA[ParRefInd[CHANGE_AFTER_EMERG_STOP__PARREFIND]].Value)
+			if (MAIN_Params.ChangeAfterEmergStop)
 			{
 				// not from Modbus
 			    if (!(MBA.WriteConfigurationDigital & MBA_CONFIG_AUTOMATIC_OPERATION))
@@ -1707,7 +1877,7 @@ static void EmergencyStop(const DU8 sig)
 			    {
 					// change to manual mode
 					STOP_Set(STOPCONDITION_30001);
-					STOP_Tripped[STOPCONDITION_30001] = TRUE;
+					STOP_SetTripped(STOPCONDITION_30001, TRUE);
 			    }
 			}
 				
@@ -1911,7 +2081,7 @@ static void RearmSafetyChain(const DU8 sig)
 			TLB.mode      = TLB_OPEN;            // open turbo bypass
 			TUR.mode      = TUR_SHUTDOWN;        // governor stopped
 			COM.mode      = COM_STOP;            // compressor off
-			if (PARA[ParRefInd[IGN_OPTION__PARREFIND]].Value == 6L)
+			if (MAIN_Params.IgnOption == 6L)
 			{
 				IGN.mode      = IGN_MODE_ON;        // ignition off
          		ZS3.OperatingStopRequested = TRUE;
@@ -2028,7 +2198,7 @@ static void SystemStop(const DU8 sig)
 			TLB.mode      = TLB_OPEN;            // open turbo bypass
 			TUR.mode      = TUR_SHUTDOWN;        // governor stopped
 			COM.mode      = COM_STOP;            // compressor off
-			if (PARA[ParRefInd[IGN_OPTION__PARREFIND]].Value == 6L)
+			if (MAIN_Params.IgnOption == 6L)
 			{
 				IGN.mode      = IGN_MODE_ON;        // ignition on
          		ZS3.OperatingStopRequested = TRUE;
@@ -2188,7 +2358,7 @@ static void SystemReadyForStart(const DU8 sig)
 			TLB.mode      = TLB_OPEN;            // open turbo bypass
 			TUR.mode      = TUR_SHUTDOWN;          // governor stopped
 			COM.mode      = COM_STOP;              // compressor off
-			if (PARA[ParRefInd[IGN_OPTION__PARREFIND]].Value == 6L)
+			if (MAIN_Params.IgnOption == 6L)
 			{
 				IGN.mode      = IGN_MODE_ON;        // ignition on
          		ZS3.OperatingStopRequested = TRUE;
@@ -2318,7 +2488,7 @@ static void SystemReadyForStart(const DU8 sig)
 
 static void FastBraking(const DU8 sig)
 {
-#define MAIN_STOPPING_IGN_ON  PARA[ParRefInd[ENG_STOP_WITH_IGN__PARREFIND]].Value
+#define MAIN_STOPPING_IGN_ON  MAIN_Params.EngStopWithIgn
 #define MAIN_STOPPING_IGN_OFF (!MAIN_STOPPING_IGN_ON)
 
 	switch(sig)
@@ -2368,7 +2538,7 @@ static void FastBraking(const DU8 sig)
             */
             if (MAIN_STOPPING_IGN_OFF)
             {
-				if (PARA[ParRefInd[IGN_OPTION__PARREFIND]].Value == 6L)
+				if (MAIN_Params.IgnOption == 6L)
 				{
 					IGN.mode      = IGN_MODE_ON;        // ignition on
 					ZS3.OperatingStopRequested = TRUE;
@@ -2527,7 +2697,7 @@ static void StartPrepare(const DU8 sig)
             {
             	COM.mode  = COM_STOP;            // compressor off
             }
-			if (PARA[ParRefInd[IGN_OPTION__PARREFIND]].Value == 6L)
+			if (MAIN_Params.IgnOption == 6L)
 			{
 				IGN.mode      = IGN_MODE_ON;        // ignition on
          		ZS3.OperatingStopRequested = TRUE;
@@ -2595,8 +2765,8 @@ static void StartPrepare(const DU8 sig)
 
 			// Increase delay if mixer is very slow
 			if ((AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED)
-				&& (TimeoutDelay < ((DU32)PARA[ParRefInd[MIX_RUNNING_TIME_0_TO_100_PERCENT__PARREFIND]].Value * 3)))
-				TimeoutDelay = (DU32)PARA[ParRefInd[MIX_RUNNING_TIME_0_TO_100_PERCENT__PARREFIND]].Value * 3;
+				&& (TimeoutDelay < ((DU32)MAIN_Params.MixRunningTime0To100Percent * 3)))
+				TimeoutDelay = (DU32)MAIN_Params.MixRunningTime0To100Percent * 3;
 			   
 			   if ( myStateCnt > TimeoutDelay )
 			   { STOP_Set( STOPCONDITION_20022 );}
@@ -2726,7 +2896,7 @@ static void Starting(const DU8 sig)
             	COM.mode  = COM_DEMANDED;        // compressor demanded
             else // gas type B
             	COM.mode  = COM_STOP;            // compressor off
-			if (PARA[ParRefInd[IGN_OPTION__PARREFIND]].Value == 6L)
+			if (MAIN_Params.IgnOption == 6L)
 			{
 				IGN.mode      = IGN_MODE_ON;        // ignition on
          		ZS3.OperatingStopRequested = TRUE;
@@ -3076,7 +3246,7 @@ static void OpenGasValves(const DU8 sig)
 			}
 
 			// set mixer mode depending on config and release load
-			if (PARA[ParRefInd[MIX_IDLE_POS_IN_ACCELERATION__PARREFIND]].Value == 2L)
+			if (MAIN_Params.MixIdlePosInAcceleration == 2L)
 			{
 				MAIN_Set_MIX_mode(MIX_MOVE_TO_IDLE_POSITION);
 			}
@@ -3133,7 +3303,7 @@ static void OpenGasValves(const DU8 sig)
 		   // engine running?    
 		   if (ENG.state == ENG_RUNNING)  
 		   { 
-			 TUR.MAINRpmSet = PARA[ParRefInd[STRT_VALUE_SPEED_RAMP__PARREFIND]].Value * 1000L;
+			 TUR.MAINRpmSet = MAIN_Params.StrtValueSpeedRamp * 1000L;
 		   	 transit(Acceleration);
 		   	 break;
 		   }
@@ -3181,7 +3351,7 @@ static void Acceleration(const DU8 sig)
 			//STH.mode      = STH_ELECTRIC_DEMANDED; //heating of poil electrically
 			THR.mode	  = THR_HEAT_UP;		 // thermoreactor heating enabled
 			TLB.mode      = TLB_OPEN;            // open turbo bypass
-			//TUR.MAINRpmSet= PARA[ParRefInd[STRT_VALUE_SPEED_RAMP__PARREFIND]].Value * 1000L;
+			//TUR.MAINRpmSet= PAR_VALUE(STRT_VALUE_SPEED_RAMP__PARREFIND) * 1000L;
 			//TUR.MAINRpmSet= 300000L + (ENG_RUNNING_SPEED * 100);
 			//TUR.MAINRpmSet= 100000L + (ENG_RUNNING_SPEED * 100);
 			if (PAR_CUMMINS_OPTION)
@@ -3256,7 +3426,7 @@ static void Acceleration(const DU8 sig)
 			}
 
 			// set mixer mode depending on config and release load
-			if (PARA[ParRefInd[MIX_IDLE_POS_IN_ACCELERATION__PARREFIND]].Value >= 1L)
+			if (MAIN_Params.MixIdlePosInAcceleration >= 1L)
 			{
 				//MIX.AdjustmentDuringStart = FALSE;
 				MAIN_Set_MIX_mode(MIX_MOVE_TO_IDLE_POSITION);
@@ -3269,24 +3439,24 @@ static void Acceleration(const DU8 sig)
 			// set RGB.mode depending on alarms
 			MAIN_Set_RGB_mode();
 
-			if (PARA[ParRefInd[LOW_IDLE_OPTION__PARREFIND]].Value == 0L) // Option = off
+			if (MAIN_Params.LowIdleOption == 0L) // Option = off
 				MAIN.LowIdleSpeed_Demand = FALSE;
 			else if (!MAIN.ManualOperation)
 			{
-				if (PARA[ParRefInd[LOW_IDLE_OPTION__PARREFIND]].Value == 1L) // Option = oil temperature
+				if (MAIN_Params.LowIdleOption == 1L) // Option = oil temperature
 				{
-					if (!ENG.LubeOilTemp_Available || (ENG.LubeOilTemp.Value >= (DS16)PARA[ParRefInd[LOW_IDLE_RELEASE_OIL_TEMP__PARREFIND]].Value))
+					if (!ENG.LubeOilTemp_Available || (ENG.LubeOilTemp.Value >= (DS16)MAIN_Params.LowIdleReleaseOilTemp))
 						MAIN.LowIdleSpeed_Demand = FALSE;
 				}
-				else if (PARA[ParRefInd[LOW_IDLE_OPTION__PARREFIND]].Value == 2L) // Option = time
+				else if (MAIN_Params.LowIdleOption == 2L) // Option = time
 				{
-					if (LowIdleSpeedTimer > (DU32)PARA[ParRefInd[LOW_IDLE_RELEASE_TIME__PARREFIND]].Value)
+					if (LowIdleSpeedTimer > (DU32)MAIN_Params.LowIdleReleaseTime)
 						MAIN.LowIdleSpeed_Demand = FALSE;
 				}
-				else if (PARA[ParRefInd[LOW_IDLE_OPTION__PARREFIND]].Value == 3L) // Option = oil temp. + time
+				else if (MAIN_Params.LowIdleOption == 3L) // Option = oil temp. + time
 				{
-					if (LowIdleSpeedTimer > (DU32)PARA[ParRefInd[LOW_IDLE_RELEASE_TIME__PARREFIND]].Value)
-					if (!ENG.LubeOilTemp_Available || (ENG.LubeOilTemp.Value >= (DS16)PARA[ParRefInd[LOW_IDLE_RELEASE_OIL_TEMP__PARREFIND]].Value))
+					if (LowIdleSpeedTimer > (DU32)MAIN_Params.LowIdleReleaseTime)
+					if (!ENG.LubeOilTemp_Available || (ENG.LubeOilTemp.Value >= (DS16)MAIN_Params.LowIdleReleaseOilTemp))
 						MAIN.LowIdleSpeed_Demand = FALSE;
 				}
 				else // Option = NA...?!?
@@ -3316,7 +3486,7 @@ static void Acceleration(const DU8 sig)
 					// ramp up to low idle speed
 					if (TUR.MAINRpmSet < TUR.LowIdleSpeed)
 					{
-						TUR.MAINRpmSet += (DS32)PARA[ParRefInd[SPEED_RAMP_UP__PARREFIND]].Value/50;
+						TUR.MAINRpmSet += (DS32)MAIN_Params.SpeedRampUp/50;
 
 						if (TUR.MAINRpmSet > TUR.LowIdleSpeed)
 							TUR.MAINRpmSet = TUR.LowIdleSpeed;
@@ -3324,7 +3494,7 @@ static void Acceleration(const DU8 sig)
 					// ramp down to low idle speed
 					else if (TUR.MAINRpmSet > TUR.LowIdleSpeed)
 					{
-						TUR.MAINRpmSet -= (DS32)PARA[ParRefInd[SPEED_RAMP_UP__PARREFIND]].Value/50;
+						TUR.MAINRpmSet -= (DS32)MAIN_Params.SpeedRampUp/50;
 
 						if (TUR.MAINRpmSet < TUR.LowIdleSpeed)
 							TUR.MAINRpmSet = TUR.LowIdleSpeed;
@@ -3345,7 +3515,7 @@ static void Acceleration(const DU8 sig)
 					LowIdleSpeedTimer += 20L;
 				}
 
-				if (LowIdleSpeedTimer > (DU32)PARA[ParRefInd[LOW_IDLE_TIMEOUT__PARREFIND]].Value)
+				if (LowIdleSpeedTimer > (DU32)MAIN_Params.LowIdleTimeout)
 					STOP_Set(STOPCONDITION_20019);
 			}
 			else
@@ -3363,7 +3533,7 @@ static void Acceleration(const DU8 sig)
 
 				// ramp up to nominal speed
 				if (TUR.MAINRpmSet < TUR.NominalSpeed)
-					TUR.MAINRpmSet += (DS32)PARA[ParRefInd[SPEED_RAMP_UP__PARREFIND]].Value/50;
+					TUR.MAINRpmSet += (DS32)MAIN_Params.SpeedRampUp/50;
 
 				if (TUR.MAINRpmSet > TUR.NominalSpeed)
 					TUR.MAINRpmSet = TUR.NominalSpeed;
@@ -3407,7 +3577,7 @@ static void Acceleration(const DU8 sig)
 
 		    // running speed lost (80% of parameter value)
 		    if (myStateCnt >= 2000L)
-		    if (ENG.S200EngineSpeed < (PARA[ParRefInd[ENGINE_RUNNING__PARREFIND]].Value/125))
+		    if (ENG.S200EngineSpeed < (MAIN_Params.EngineRunning/125))
 		    {
 	            transit(FastBraking);
 	            break;
@@ -3422,7 +3592,7 @@ static void Acceleration(const DU8 sig)
 	        else
 	        {
 			    // excitatio-on-speed reached
-		        if (ENG.S200EngineSpeed >= (DS16)PARA[ParRefInd[GEN_AVR_ACTIVATION_SPEED__PARREFIND]].Value )
+		        if (ENG.S200EngineSpeed >= (DS16)MAIN_Params.GenAvrActivationSpeed )
 		        {
 		        	GEN.mode = GEN_MODE_ON;
 		        }
@@ -3484,7 +3654,7 @@ static void IdleRun(const DU8 sig)
             TUR.AdditionalRpmSet = 0;
 			// ramp to nominal speed
 			if (TUR.MAINRpmSet < TUR.NominalSpeed)
-				TUR.MAINRpmSet += (DS32)PARA[ParRefInd[SPEED_RAMP_UP__PARREFIND]].Value/50;
+				TUR.MAINRpmSet += (DS32)MAIN_Params.SpeedRampUp/50;
 			if (TUR.MAINRpmSet > TUR.NominalSpeed)
 				TUR.MAINRpmSet = TUR.NominalSpeed;
             MAIN_RpmSet = TUR.MAINRpmSet;
@@ -3599,7 +3769,7 @@ static void IdleRun(const DU8 sig)
 	        
 	        // engine dying for whatever reason: go back
 	        //if ( (ENG.state != ENG_RUNNING) && (!GEN.VoltageInWindow) )
-	        if ( (ENG.S200EngineSpeed < PARA[ParRefInd[ENGINE_RUNNING__PARREFIND]].Value/100) && (!GEN.VoltageInWindow) )
+	        if ( (ENG.S200EngineSpeed < MAIN_Params.EngineRunning/100) && (!GEN.VoltageInWindow) )
 	        {
 	        	// engine has stopped
 	        	STOP_Set(STOPCONDITION_20096);
@@ -3616,7 +3786,7 @@ static void IdleRun(const DU8 sig)
 
 			// ramp to nominal speed
 			if (MAIN_RpmSet < TUR.NominalSpeed)
-				MAIN_RpmSet += (DS32)PARA[ParRefInd[SPEED_RAMP_UP__PARREFIND]].Value/50;
+				MAIN_RpmSet += (DS32)MAIN_Params.SpeedRampUp/50;
 			if (MAIN_RpmSet > TUR.NominalSpeed)
 				MAIN_RpmSet = TUR.NominalSpeed;
 
@@ -3652,7 +3822,7 @@ static void IdleRun(const DU8 sig)
 /*	        
 	        // ONE SCM-card
 	        // actualLevel >=4 and U gen in window?
-	        if ( (PARA[ParRefInd[NBR_OF_SC_MODULES__PARREFIND]].Value <= 1)	// one SCM-card, rmiEPF
+	        if ( (PAR_VALUE(NBR_OF_SC_MODULES__PARREFIND) <= 1)	// one SCM-card, rmiEPF
 	        	&& (STOP.actualLevel > 3)
 		        && (GEN.VoltageInWindow) 
 		        && (HVS.stateT1E != HVS_T1E_IS_ON)
@@ -3663,7 +3833,7 @@ static void IdleRun(const DU8 sig)
 		        }
 
 	        // TWO SCM-cards
-	        if ( (PARA[ParRefInd[NBR_OF_SC_MODULES__PARREFIND]].Value > 1)	// second SCM-card
+	        if ( (PAR_VALUE(NBR_OF_SC_MODULES__PARREFIND) > 1)	// second SCM-card
 				&& (GEN.VoltageInWindow)
 				&& (HVS.stateT1E != HVS_T1E_IS_ON) )
 				{
@@ -3674,7 +3844,7 @@ static void IdleRun(const DU8 sig)
 							&& (GEN.reg.state == GEN_REGSTATE_UISLAND_DONE)
 			        		&& (HVS.modeL1E == HVS_L1E_OFF)
 			        		&& (HVS.stateL1E == HVS_L1E_OFF_AND_READY)
-			        		&& (HVS.L1EIsOffTimer >= PARA[ParRefInd[EPF_SWITCH_ON_TIME__PARREFIND]].Value) )
+			        		&& (HVS.L1EIsOffTimer >= PAR_VALUE(EPF_SWITCH_ON_TIME__PARREFIND)) )
 			        	{
 			        		transit(ConnectT1E);									// connect T1E to island operation
 			        		break;			        		
@@ -3729,7 +3899,7 @@ static void IdleRun(const DU8 sig)
 			          	else if (  (ELM.BBVoltageIsZero_Flag)
 			          	        && (STOP.actualLevel > 4)
 				          		&& (GEN.reg.state == GEN_REGSTATE_UISLAND_DONE)
-				          		&& (HVS.L1EIsOffTimer >= (DU32)PARA[ParRefInd[EPF_SWITCH_ON_TIME__PARREFIND]].Value)
+				          		&& (HVS.L1EIsOffTimer >= (DU32)MAIN_Params.EpfSwitchOnTime)
 			          		)
 			        	{
 			        		// we have the release from all connected IDs and from DI if assigned
@@ -3773,7 +3943,7 @@ static void IdleRun(const DU8 sig)
 		       }
 		    
 		    // excitatio-on-speed reached
-	        if (ENG.S200EngineSpeed >= (DS16)PARA[ParRefInd[GEN_AVR_ACTIVATION_SPEED__PARREFIND]].Value )
+	        if (ENG.S200EngineSpeed >= (DS16)MAIN_Params.GenAvrActivationSpeed )
 	        {
 	        	GEN.mode = GEN_MODE_ON;
 	        }
@@ -3917,7 +4087,7 @@ static void WaitForReleaseCloseGCB(const DU8 sig)
 	        
 	        // engine dying for whatever reason: go back
 	        //if ( (ENG.state != ENG_RUNNING) && (!GEN.VoltageInWindow) )
-		    if ( (ENG.S200EngineSpeed < PARA[ParRefInd[ENGINE_RUNNING__PARREFIND]].Value/100) && (!GEN.VoltageInWindow) )
+		    if ( (ENG.S200EngineSpeed < MAIN_Params.EngineRunning/100) && (!GEN.VoltageInWindow) )
 	        {
 	        	// engine has stopped
 	        	STOP_Set(STOPCONDITION_20096);
@@ -3957,7 +4127,7 @@ static void WaitForReleaseCloseGCB(const DU8 sig)
 	        // actualLevel >=4 AND U gen in window AND generator breaker open?
 	        
 	        
-	        if (myStateCnt >= (DU32)(PARA[ParRefInd[ENGINE_ID__PARREFIND]].Value * PMS_WAIT_FOR_RELEASE_DELAY)) // try again
+	        if (myStateCnt >= (DU32)(MAIN_Params.EngineId * PMS_WAIT_FOR_RELEASE_DELAY)) // try again
 			{
 	    		transit(IdleRun);
 	    		break;
@@ -3969,7 +4139,7 @@ static void WaitForReleaseCloseGCB(const DU8 sig)
 		       }
 
 		    // excitatio-on-speed reached
-	        if (ENG.S200EngineSpeed >= (DS16)PARA[ParRefInd[GEN_AVR_ACTIVATION_SPEED__PARREFIND]].Value )
+	        if (ENG.S200EngineSpeed >= (DS16)MAIN_Params.GenAvrActivationSpeed )
 	        {
 	        	GEN.mode = GEN_MODE_ON;
 	        }
@@ -4260,7 +4430,7 @@ static void Synchronize(const DU8 sig)
 			} // endif: external synchronization
 
 			// set a STC in case of a timeout under synchronisation
-			if ( myStateCnt > (DU32)PARA[ParRefInd[SYNC_TIMEOUT__PARREFIND]].Value )
+			if ( myStateCnt > (DU32)MAIN_Params.SyncTimeout )
 			STOP_Set(STOPCONDITION_30020);
 			
 			if (STOP.actualLevel < 4)
@@ -4289,7 +4459,7 @@ static void Synchronize(const DU8 sig)
 
 	        // engine dying for whatever reason: go back
 	        //if ( (ENG.state != ENG_RUNNING) && (!GEN.VoltageInWindow) )
-		    if ( (ENG.S200EngineSpeed < PARA[ParRefInd[ENGINE_RUNNING__PARREFIND]].Value/100) && (!GEN.VoltageInWindow) )
+		    if ( (ENG.S200EngineSpeed < MAIN_Params.EngineRunning/100) && (!GEN.VoltageInWindow) )
 	        {
 	        	// engine has stopped
 	        	STOP_Set(STOPCONDITION_20096);
@@ -4465,12 +4635,12 @@ static void IslandOperation(const DU8 sig)
             // Add droop offset
             if (MAIN_ISLAND_PARALLEL_NOT_ACTIVE)
             {
-            	if (PARA[ParRefInd[SPEED_REG_DROOP_MODE__PARREFIND]].Value & BIT0)
+            	if (MAIN_Params.SpeedRegDroopMode & BIT0)
             		TUR.MAINRpmSet += TUR_CalculateDroopOffset(TUR.MAINRpmSet);
             }
             else if (MAIN_ISLAND_PARALLEL_ACTIVE)
             {
-            	if (PARA[ParRefInd[SPEED_REG_DROOP_MODE__PARREFIND]].Value & BIT1)
+            	if (MAIN_Params.SpeedRegDroopMode & BIT1)
             		TUR.MAINRpmSet += TUR_CalculateDroopOffset(TUR.MAINRpmSet);
             }
             // else no droop
@@ -4548,7 +4718,7 @@ static void IslandOperation(const DU8 sig)
 							break; // stay here
 						}
 			
-						if (myStateCnt < (DU32)(PARA[ParRefInd[EPF_MAINS_FAILURE_DELAY__PARREFIND]].Value + 1000L))
+						if (myStateCnt < (DU32)(MAIN_Params.EpfMainsFailureDelay + 1000L))
 						{
 						   break;  // stay here to wait for (delayed) mains power stop condition	
 						}
@@ -4557,7 +4727,7 @@ static void IslandOperation(const DU8 sig)
 						// island-operation at least 1 second + value of mains-failure delay
 						
 						// back synchronisation?
-						if( PARA[ParRefInd[EPF_RESYNCHRONISING__PARREFIND]].Value )
+						if( MAIN_Params.EpfResynchronising )
 						{
 							if (!(STOP.actualBitMask & STOP_BITMASK_ISLAND))	// isl-bit active, rmi100319
 							   break;							// stay here and wait for auto acknowlwdge of mains protection SC's
@@ -4632,7 +4802,7 @@ static void IslandOperation(const DU8 sig)
 		      break; 
 		    }
 
-            if ( ( PARA[ParRefInd[NBR_OF_SC_MODULES__PARREFIND]].Value <= 1)
+            if ( ( MAIN_Params.NbrOfScModules <= 1)
                  && (HVS.stateL1E == HVS_L1E_IS_ON) )
             {
             	transit(GridParallelOperationFullLoad);
@@ -4676,7 +4846,7 @@ static void IslandOperation(const DU8 sig)
 					}
 
 					// Check if P(actual) < P(cutout)
-					if (ELM.T1E.sec.Psum < (PARA[ParRefInd[GEN_NOMINAL_LOAD__PARREFIND]].Value/MAIN_CUT_OUT_FRACTION_ISLPAR))
+					if (ELM.T1E.sec.Psum < (MAIN_Params.GenNominalLoad/MAIN_CUT_OUT_FRACTION_ISLPAR))
 					{
 						transit(DisconnectT1EIsland);
 						return;
@@ -4747,12 +4917,12 @@ static void IslandOperation(const DU8 sig)
                 // Add droop offset
                 if (MAIN_ISLAND_PARALLEL_NOT_ACTIVE)
                 {
-                	if (PARA[ParRefInd[SPEED_REG_DROOP_MODE__PARREFIND]].Value & BIT0)
+                	if (MAIN_Params.SpeedRegDroopMode & BIT0)
                 		TUR.MAINRpmSet += TUR_CalculateDroopOffset(TUR.MAINRpmSet);
                 }
                 else if (MAIN_ISLAND_PARALLEL_ACTIVE)
                 {
-                	if (PARA[ParRefInd[SPEED_REG_DROOP_MODE__PARREFIND]].Value & BIT1)
+                	if (MAIN_Params.SpeedRegDroopMode & BIT1)
                 		TUR.MAINRpmSet += TUR_CalculateDroopOffset(TUR.MAINRpmSet);
                 }
                 // else no droop
@@ -4793,7 +4963,7 @@ static void IslandOperation(const DU8 sig)
 			//   in case of no back synchronisation is parameterized) 
 			// ================================================================================
 			// bugfix, 091211: MinValue substituted by Value
-			if (myStateCnt < (DU32)(PARA[ParRefInd[EPF_MAINS_FAILURE_DELAY__PARREFIND]].Value + 1000L))
+			if (myStateCnt < (DU32)(MAIN_Params.EpfMainsFailureDelay + 1000L))
 			{
 			   break;  // stay here to wait for (delayed) mains power stop condition	
 			}
@@ -4802,7 +4972,7 @@ static void IslandOperation(const DU8 sig)
 			// island-operation at least 1 second + value of mains-failure delay
 			
 			// back synchronisation?
-			if( PARA[ParRefInd[EPF_RESYNCHRONISING__PARREFIND]].Value )
+			if( MAIN_Params.EpfResynchronising )
 			{
 				MAIN.StopInIsland = FALSE;
 
@@ -5200,7 +5370,7 @@ static void LoadSharing(const DU8 sig)
 		      break; 
 		    }
 
-            if ( ( PARA[ParRefInd[NBR_OF_SC_MODULES__PARREFIND]].Value <= 1)
+            if ( ( MAIN_Params.NbrOfScModules <= 1)
                  && (HVS.stateL1E == HVS_L1E_IS_ON) )
             {
             	transit(GridParallelOperationFullLoad);
@@ -5467,7 +5637,7 @@ static void LoadSharingRampDown(const DU8 sig)
 		    }
 
 		    // if desired cut out load is reached -> transit to DisconnectT1EIsland
-		    if ( ELM.T1E.sec.Psum < (DS32)( PARA[ParRefInd[GEN_NOMINAL_LOAD__PARREFIND]].Value / MAIN_CUT_OUT_FRACTION_LOADSHARING) )
+		    if ( ELM.T1E.sec.Psum < (DS32)( MAIN_Params.GenNominalLoad / MAIN_CUT_OUT_FRACTION_LOADSHARING) )
 			{
 		      transit(DisconnectT1EIsland);
 		      break; 
@@ -5582,7 +5752,7 @@ static void SynchronConnectL1E(const DU8 sig)
 				STOP_Set(STOPCONDITION_30022);			// synchron connect timeout, rmiEPF
 			}
 
-		    if (PARA[ParRefInd[NBR_OF_SC_MODULES__PARREFIND]].Value > 1)
+		    if (MAIN_Params.NbrOfScModules > 1)
 		    	BusbarFrequency = ELM.L1E.per.FavgBB;
 		    else
 		    	BusbarFrequency = ELM.T1E.per.FavgBB;
@@ -5650,7 +5820,7 @@ static void SynchronConnectL1E(const DU8 sig)
 			    }
 			    
 			    // no back synchronizing?
-			    if (PARA[ParRefInd[EPF_RESYNCHRONISING__PARREFIND]].Value == 0)
+			    if (MAIN_Params.EpfResynchronising == 0)
 			    {
 			      transit(DisconnectL1EtoIsland);
 			      break;
@@ -5717,7 +5887,7 @@ static void SynchronConnectL1E(const DU8 sig)
 		    }
 
 		    // no back synchronizing?
-		    if (PARA[ParRefInd[EPF_RESYNCHRONISING__PARREFIND]].Value == 0)
+		    if (MAIN_Params.EpfResynchronising == 0)
 		    {
 		      transit(DisconnectL1EtoIsland);
 		      break;
@@ -5744,7 +5914,7 @@ static void SynchronConnectL1E(const DU8 sig)
 			
 			
 		    if ( (HVS.stateL1E == HVS_L1E_IS_ON)
-		        && (PARA[ParRefInd[EPF_RESYNCHRONISING__PARREFIND]].Value == EPF_RESYNCHRONISING_OVERLAP)) //ÜSy
+		        && (MAIN_Params.EpfResynchronising == EPF_RESYNCHRONISING_OVERLAP)) //ÜSy
 		    {
 		    	transit(DisconnectT1E);
 		    	break;
@@ -5879,7 +6049,7 @@ static void DisconnectL1EtoIsland(const DU8 sig)
 			// else actualLevel >= 4  and no timeout open mains breaker
             
             // If there is no second SCM board the mains breaker will not open anyway.
-            if ( ( PARA[ParRefInd[NBR_OF_SC_MODULES__PARREFIND]].Value <= 1)
+            if ( ( MAIN_Params.NbrOfScModules <= 1)
                  && (HVS.stateL1E == HVS_L1E_IS_ON) )
             {
             	transit(GridParallelOperationLimitedLoad);
@@ -5942,8 +6112,8 @@ DS32 MAIN_realpower_max_allowed(void)
 	// too high cylinder temperature
 	// oil temperature T208
 	// Check the reason why engine was stopped, rmiSTE
-	PowerMax = PARA[ParRefInd[GEN_NOMINAL_LOAD__PARREFIND]].Value;
-	PowerMaxEngine = PARA[ParRefInd[GEN_NOMINAL_LOAD__PARREFIND]].Value;
+	PowerMax = MAIN_Params.GenNominalLoad;
+	PowerMaxEngine = MAIN_Params.GenNominalLoad;
 	MAIN.reduction = MAIN_NO_REDUCTION;
 	MAIN.StopEngine = MAIN_NO_REDUCTION;		// rmiSTE
 	if (!MIX.Config) // no load reduction if mixer is in configuration
@@ -6068,7 +6238,7 @@ DS32 MAIN_realpower_max_allowed(void)
 
 
 	    if (!PMS.EngineIDConfigured[ARC.nEngineId-1] // no PMS function
-	    	|| (PARA[ParRefInd[PMS_REG_CH4__PARREFIND]].Value == 0L)) // no regulation from PMS
+	    	|| (MAIN_Params.PmsRegCh4 == 0L)) // no regulation from PMS
 	    {
 		    // power reduction due to low CH4 value
 		    if (PowerMax > CH4.MaxPower_CH4)
@@ -6083,7 +6253,7 @@ DS32 MAIN_realpower_max_allowed(void)
 		    MAIN.StopEngine = MAIN_CH4;
 	    
 	    if (!PMS.EngineIDConfigured[ARC.nEngineId-1] // no PMS function
-	    	|| (PARA[ParRefInd[PMS_REG_MAINS_POWER__PARREFIND]].Value == 0L)) // no regulation from PMS
+	    	|| (MAIN_Params.PmsRegMainsPower == 0L)) // no regulation from PMS
 	    {
 		    // power reduction due to mains power
 		    if (PowerMax > MPI.MaxPower)
@@ -6112,7 +6282,7 @@ DS32 MAIN_realpower_max_allowed(void)
 		    }
 
 	    if (!PMS.EngineIDConfigured[ARC.nEngineId-1] // no PMS function
-	    	|| (PARA[ParRefInd[PMS_REG_GAS_LEVEL__PARREFIND]].Value == 0L)) // no regulation from PMS
+	    	|| (MAIN_Params.PmsRegGasLevel == 0L)) // no regulation from PMS
 	    {
 		    // power reduction due to gas level
 		    if (PowerMax > GPC.MaxPower)
@@ -6142,9 +6312,9 @@ DS32 MAIN_realpower_max_allowed(void)
 	    
 	    // power reduction limited load
 	    if ( (MAIN.state == MAIN_GRID_PARALLEL_LIMITED_LOAD)
-	    	&& (PowerMax > (PARA[ParRefInd[GEN_NOMINAL_LOAD__PARREFIND]].Value/1000L*PARA[ParRefInd[POWER_WARMING_LOAD__PARREFIND]].Value)) )
+	    	&& (PowerMax > (MAIN_Params.GenNominalLoad/1000L*MAIN_Params.PowerWarmingLoad)) )
 	    {
-	    	PowerMax = (PARA[ParRefInd[GEN_NOMINAL_LOAD__PARREFIND]].Value/1000L*PARA[ParRefInd[POWER_WARMING_LOAD__PARREFIND]].Value);
+	    	PowerMax = (MAIN_Params.GenNominalLoad/1000L*MAIN_Params.PowerWarmingLoad);
 	    	MAIN.reduction = MAIN_WARMING;
 	    }
 	    
@@ -6184,7 +6354,7 @@ DS32 MAIN_realpower_max_allowed(void)
 	   }
 
 	   // Battery undervoltage
-	   if (!ENG.Running && (PARA[ParRefInd[AUD_BATT_VOLT_TIMER__PARREFIND]].Value > 0L))
+	   if (!ENG.Running && (MAIN_Params.AudBattVoltTimer > 0L))
 		   MAIN.StopEngine = MAIN_BATTERY;
 
 	   // Power reduction because of power limitation by analog input
@@ -6216,7 +6386,7 @@ DS32 MAIN_limit_ManualPowerSetpoint(DS32 adjustment)
 	else
 	{
 		// no PMS -> no limitation due to PMS
-		Limitation_Due_To_PMS = PARA[ParRefInd[GEN_NOMINAL_LOAD__PARREFIND]].Value;
+		Limitation_Due_To_PMS = MAIN_Params.GenNominalLoad;
 	}
 
 	if (adjustment > Limitation_Due_To_PMS)
@@ -6389,7 +6559,7 @@ static void GridParallelOperationLimitedLoad(const DU8 sig)
 		    // mains circuit breaker not closed
 		    if ( (HVS.stateL1E != HVS_L1E_IS_ON)
 		    	&& (!ISL.IslandOperationAllowed)				// island operation not allowed
-		    	//&& (PARA[ParRefInd[NBR_OF_SC_MODULES__PARREFIND]].Value > 1)
+		    	//&& (PAR_VALUE(NBR_OF_SC_MODULES__PARREFIND) > 1)
 		       )
 		    {
 			  // open generator breaker immediately, 
@@ -6401,7 +6571,7 @@ static void GridParallelOperationLimitedLoad(const DU8 sig)
 		    // mains circuit breaker not closed, but island operation allowed (implicit 2 SCM-cards)
 		    if ( (HVS.stateL1E != HVS_L1E_IS_ON)
 		    	&& (ISL.IslandOperationAllowed)				// island operation allowed
-		    	//&& (PARA[ParRefInd[NBR_OF_SC_MODULES__PARREFIND]].Value > 1)
+		    	//&& (PAR_VALUE(NBR_OF_SC_MODULES__PARREFIND) > 1)
 		       )
 		    {
 			  // open mains breaker immediately
@@ -6429,7 +6599,7 @@ static void GridParallelOperationLimitedLoad(const DU8 sig)
 		    	break;
 		    }
 		    
-		    if (PARA[ParRefInd[SPEED_REG_DROOP_MODE__PARREFIND]].Value & BIT2)
+		    if (MAIN_Params.SpeedRegDroopMode & BIT2)
 		    {
 		    	transit(GridParallelOperationFullLoad);
 		    	break;
@@ -6439,7 +6609,7 @@ static void GridParallelOperationLimitedLoad(const DU8 sig)
 		    // and (mains failure or island operation or mains breaker open)
 	        if ( (STOP.actualLevel > 3)
 	        	 && ( STOP.actualBitMask & 0x0001 )																	// no regular stop
-	        	 && (ISL.IslandOperationAllowed)//&& ( PARA[ParRefInd[NBR_OF_SC_MODULES__PARREFIND]].Value > 1 )										// second SCM-card
+	        	 && (ISL.IslandOperationAllowed)//&& ( MAIN_Params.NbrOfScModules > 1 )										// second SCM-card
 	        	 && ( !STOP_is_Set(STOPCONDITION_50623) )															// no timeout open mains breaker
 			     && ( (ELM.MainsFailure )																			// AND (mains failure
 				    || (ISL.IslandOperationActive )																	//      OR island demanded
@@ -6613,7 +6783,7 @@ static void GridParallelOperationLimitedLoad(const DU8 sig)
 		                 
 	        
 		            // as soon as actual realpower becomes less than 2% of nominal, transit to disconnect T1E
-		            if ( ELM.T1E.sec.Psum < (DS32)( PARA[ParRefInd[GEN_NOMINAL_LOAD__PARREFIND]].Value / MAIN_CUT_OUT_FRACTION_DELOAD) )
+		            if ( ELM.T1E.sec.Psum < (DS32)( MAIN_Params.GenNominalLoad / MAIN_CUT_OUT_FRACTION_DELOAD) )
 		            {
 		            	 DeloadCounter = 0;
 		            	 transit(DisconnectT1E);
@@ -6718,7 +6888,7 @@ static void GridParallelOperationFullLoad(const DU8 sig)
 			//TLB.Pset      = TUR.Reg.PowerSetPoint; // Setpoint for P is a function to return the actual minimum setpoint
 
             // Speed-Control active with Droop
-			if (PARA[ParRefInd[SPEED_REG_DROOP_MODE__PARREFIND]].Value & BIT2)
+			if (MAIN_Params.SpeedRegDroopMode & BIT2)
             {
                 TUR.mode                = TUR_TAKE_SETPOINT_RPM;
                 //TUR.MAINPosSet        = Keep
@@ -6761,7 +6931,7 @@ static void GridParallelOperationFullLoad(const DU8 sig)
 
 			// define actual MAIN.state
 			MAIN.state                = MAIN_GRID_PARALLEL_FULL_LOAD;
-        	if (PARA[ParRefInd[SPEED_REG_DROOP_MODE__PARREFIND]].Value & BIT2)
+        	if (MAIN_Params.SpeedRegDroopMode & BIT2)
         		MAIN.regState = MAIN_GRID_PARALLEL_SPEED_CONTROL;
         	else
         		MAIN.regState = MAIN_GRID_PARALLEL_ADJUST_POWER;
@@ -6851,7 +7021,7 @@ static void GridParallelOperationFullLoad(const DU8 sig)
 			else
 				THR.mode = THR_HEAT_UP;
 
-			if (PARA[ParRefInd[SPEED_REG_DROOP_MODE__PARREFIND]].Value & BIT2)
+			if (MAIN_Params.SpeedRegDroopMode & BIT2)
 			{
 				TLB.mode = TLB_SPEED;
 			}
@@ -6898,7 +7068,7 @@ static void GridParallelOperationFullLoad(const DU8 sig)
 		    // mains circuit breaker not closed, but 2 SCM and no island operation allowed
 		    if ( (HVS.stateL1E != HVS_L1E_IS_ON)
 		         && (!ISL.IslandOperationAllowed)								// island operation not allowed
-		    	//&& (PARA[ParRefInd[NBR_OF_SC_MODULES__PARREFIND]].Value > 1)
+		    	//&& (PAR_VALUE(NBR_OF_SC_MODULES__PARREFIND) > 1)
 		       )
 		    {
 			  // open generator breaker immediately
@@ -6910,7 +7080,7 @@ static void GridParallelOperationFullLoad(const DU8 sig)
 		    // mains circuit breaker not closed, but island operation allowed (implicit 2 SCM-cards)
 		    if ( (HVS.stateL1E != HVS_L1E_IS_ON)
 		    	&& (ISL.IslandOperationAllowed)				// island operation allowed
-		    	//&& (PARA[ParRefInd[NBR_OF_SC_MODULES__PARREFIND]].Value > 1)
+		    	//&& (PAR_VALUE(NBR_OF_SC_MODULES__PARREFIND) > 1)
 		       )
 		    {
 			  // open mains breaker immediately
@@ -6935,7 +7105,7 @@ static void GridParallelOperationFullLoad(const DU8 sig)
 		    // and (mains failure or island operation or mains breaker open)
 	        if ( (STOP.actualLevel > 3)
 	        	 && ( STOP.actualBitMask & 0x0001 )																	// no regular stop
-	        	 && (ISL.IslandOperationAllowed)//&& ( PARA[ParRefInd[NBR_OF_SC_MODULES__PARREFIND]].Value > 1 )										// second SCM-card
+	        	 && (ISL.IslandOperationAllowed)//&& ( MAIN_Params.NbrOfScModules > 1 )										// second SCM-card
 	        	 && ( !STOP_is_Set(STOPCONDITION_50623) )															// no timeout open mains breaker
 			     && ( (ELM.MainsFailure )																			// AND (mains failure
 				    || (ISL.IslandOperationActive )																	//      OR island demanded
@@ -6947,7 +7117,7 @@ static void GridParallelOperationFullLoad(const DU8 sig)
 		    	break;
 		    }
 
-        	if ((PARA[ParRefInd[SPEED_REG_DROOP_MODE__PARREFIND]].Value & BIT2) AND (MAIN.regState != MAIN_GRID_PARALLEL_SPEED_CONTROL))
+        	if ((MAIN_Params.SpeedRegDroopMode & BIT2) AND (MAIN.regState != MAIN_GRID_PARALLEL_SPEED_CONTROL))
         	{
         		MAIN.regState = MAIN_GRID_PARALLEL_SPEED_CONTROL;
                 TUR.mode = TUR_TAKE_SETPOINT_RPM;
@@ -7123,7 +7293,7 @@ static void GridParallelOperationFullLoad(const DU8 sig)
 	        
 		            // rmi100325 if ( ELM.T1E.sec.Psum < 10000L )
 		            // as soon as actual realpower becomes less than 2%, transit to disconnect T1E
-		            if ( ELM.T1E.sec.Psum < (DS32)( PARA[ParRefInd[GEN_NOMINAL_LOAD__PARREFIND]].Value / MAIN_CUT_OUT_FRACTION_DELOAD) )
+		            if ( ELM.T1E.sec.Psum < (DS32)( MAIN_Params.GenNominalLoad / MAIN_CUT_OUT_FRACTION_DELOAD) )
 		            {
 		            	 DeloadCounter = 0;
 		            	 transit(DisconnectT1E);
@@ -7177,7 +7347,7 @@ static void GridParallelOperationFullLoad(const DU8 sig)
 		        
 		        case MAIN_GRID_PARALLEL_SPEED_CONTROL:
 
-		        	if (!(PARA[ParRefInd[SPEED_REG_DROOP_MODE__PARREFIND]].Value & BIT2))
+		        	if (!(MAIN_Params.SpeedRegDroopMode & BIT2))
 		        	{
 		        		MAIN.regState = MAIN_GRID_PARALLEL_NORMAL_OPERATION;
 		    			TUR.mode = TUR_TAKE_SETPOINT_POWER;
@@ -7221,7 +7391,7 @@ static void GridParallelOperationFullLoad(const DU8 sig)
 							}
 
 							// Check if P(actual) < P(cutout)
-							if (ELM.T1E.sec.Psum < (PARA[ParRefInd[GEN_NOMINAL_LOAD__PARREFIND]].Value/MAIN_CUT_OUT_FRACTION_DELOAD))
+							if (ELM.T1E.sec.Psum < (MAIN_Params.GenNominalLoad/MAIN_CUT_OUT_FRACTION_DELOAD))
 							{
 								transit(DisconnectT1E);
 								return;
@@ -7599,7 +7769,7 @@ static void Cooldown(const DU8 sig)
 			//STH.mode      = STH_WATER_DEMANDED;  // heating of poil by water
 			THR.mode	  = THR_HEAT_UP;		 // thermoreactor blocked
 			TLB.mode      = TLB_OPEN;            // open turbo bypass
-			if (PAR_CUMMINS_OPTION AND PARA[ParRefInd[LOW_IDLE_OPTION__PARREFIND]].Value)
+			if (PAR_CUMMINS_OPTION AND MAIN_Params.LowIdleOption)
 			{
 				TUR.MAINPosSet = TUR_MIN_POSITION_SETPOINT_AOUT
 						+ (TUR_MAX_POSITION_SETPOINT_AOUT - TUR_MIN_POSITION_SETPOINT_AOUT)
@@ -7619,7 +7789,7 @@ static void Cooldown(const DU8 sig)
          	ZS3.OperatingStartRequested = TRUE;
 			ISL.mode      = ISL_MODE_PARALLEL;   // parallel operation (all stages on), rmiISL
 
-			if (PAR_CUMMINS_OPTION AND PARA[ParRefInd[LOW_IDLE_OPTION__PARREFIND]].Value)
+			if (PAR_CUMMINS_OPTION AND MAIN_Params.LowIdleOption)
 			{
 				MIX.mode[MixerInd1] = MIX_MOVE_TO_START_POSITION;
 				MIX.mode[MixerInd2] = MIX_MOVE_TO_START_POSITION;
@@ -7692,7 +7862,7 @@ static void Cooldown(const DU8 sig)
 			{
 				CooldownTimerForMainsFailure = 0L;
 			    // check if normal cooldown timer is elapsed
-			    if ( myStateCnt > (DU32)PARA[ParRefInd[COOL_DOWN_TIME__PARREFIND]].Value )
+			    if ( myStateCnt > (DU32)MAIN_Params.CoolDownTime )
 				{ 
 				  transit(FastBraking); 
 				  break;
@@ -7711,7 +7881,7 @@ static void Cooldown(const DU8 sig)
 			// else actualLevel >= 3 and Cooldown timer still running
 
 			// Update position setpoint
-			if (PAR_CUMMINS_OPTION AND PARA[ParRefInd[LOW_IDLE_OPTION__PARREFIND]].Value)
+			if (PAR_CUMMINS_OPTION AND MAIN_Params.LowIdleOption)
 			{
 				TUR.MAINPosSet = TUR_MIN_POSITION_SETPOINT_AOUT
 						+ (TUR_MAX_POSITION_SETPOINT_AOUT - TUR_MIN_POSITION_SETPOINT_AOUT)
@@ -7724,7 +7894,7 @@ static void Cooldown(const DU8 sig)
 			      TUR.mode          = TUR_RPM;            // reach and keep certain speed	
 		       }
 
-	        if (PAR_CUMMINS_OPTION AND PARA[ParRefInd[LOW_IDLE_OPTION__PARREFIND]].Value)
+	        if (PAR_CUMMINS_OPTION AND MAIN_Params.LowIdleOption)
 	        {
 	        	GEN.mode = GEN_MODE_OFF;
 	        }
@@ -7752,7 +7922,7 @@ static void Cooldown(const DU8 sig)
 
 			// engine dying for whatever reason: switch it off
 	        //if ( (ENG.state != ENG_RUNNING) && (!GEN.VoltageInWindow) )
-	        if ( (ENG.S200EngineSpeed < PARA[ParRefInd[ENGINE_RUNNING__PARREFIND]].Value/100) && (!GEN.VoltageInWindow) )
+	        if ( (ENG.S200EngineSpeed < MAIN_Params.EngineRunning/100) && (!GEN.VoltageInWindow) )
 	        {
 	        	// engine has stopped
 	        	STOP_Set(STOPCONDITION_20096);
@@ -8178,14 +8348,14 @@ DU8* MAIN_subState_text(DU8 state)
    	       break;
    	       
 	  case MAIN_SUB_SWITCH_TO_WATER:
-	  	   if ((DBOOL)PARA[ParRefInd[POIL_TEMP_EL_HEATER_OPTION_VALVE__PARREFIND]].Value)
+	  	   if ((DBOOL)PAR_VALUE(POIL_TEMP_EL_HEATER_OPTION_VALVE__PARREFIND))
 	       		text = globaltext[TEXT_MAIN_SUB_SWITCH_TO_WATER];  // storage tank heating moving to water operation
 	       else
    	       text = " ";
    	       break;
    	       
 	  case MAIN_SUB_SWITCH_TO_ELECTRIC:
-	  	   if ((DBOOL)PARA[ParRefInd[POIL_TEMP_EL_HEATER_OPTION_VALVE__PARREFIND]].Value)
+	  	   if ((DBOOL)PAR_VALUE(POIL_TEMP_EL_HEATER_OPTION_VALVE__PARREFIND))
 	       		text = globaltext[TEXT_MAIN_SUB_SWITCH_TO_ELECTRIC];// storage tank heating moving to electric operation
 	       else
    	       text = " ";
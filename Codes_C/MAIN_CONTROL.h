@@ -56,6 +56,8 @@
  * 1422 25.07.2013 GFH  ignition box HZM-Phlox
  * 1423 19.09.2013 MVO  phlox version generated after test with AKR 8 cylinders
  * 		05.12.2016 MVO  some unused constants removed
+ * 		16.10.2026      parameter snapshot MAIN_Params
+ * 		17.10.2026      MAIN_Params double buffered, switched by one pointer store
  *
  */
 
@@ -369,6 +371,49 @@ typedef struct MAINstruct
 
 extern t_MAIN MAIN;
 
+// parameter snapshot of MAIN
+// filled by MAIN_ReadParameters(), used by the states instead of PARA[ParRefInd[...]]
+typedef struct MAINparamsstruct
+{
+   DS32      IdleRunTimeout;
+   DS32      StartdemandOnRisingEdge;
+   // parameters of other modules
+   DS32      AudBattVoltTimer;
+   DS32      ChangeAfterEmergStop;
+   DS32      CoolDownTime;
+   DS32      CumminsOption;
+   DS32      CumminsThrottleLowIdle;
+   DS32      EngineId;
+   DS32      EngineRunning;
+   DS32      EngStopWithIgn;
+   DS32      EpfMainsFailureDelay;
+   DS32      EpfResynchronising;
+   DS32      EpfSwitchOnTime;
+   DS32      GenAvrActivationSpeed;
+   DS32      GenNominalLoad;
+   DS32      IgnOption;
+   DS32      LowIdleOption;
+   DS32      LowIdleReleaseOilTemp;
+   DS32      LowIdleReleaseTime;
+   DS32      LowIdleTimeout;
+   DS32      MixIdlePosInAcceleration;
+   DS32      MixRunningTime0To100Percent;
+   DS32      NbrOfScModules;
+   DS32      PmsRegCh4;
+   DS32      PmsRegGasLevel;
+   DS32      PmsRegMainsPower;
+   DS32      PowerWarmingLoad;
+   DS32      PowerWarmingTimeout;
+   DS32      SpeedRampUp;
+   DS32      SpeedRegDroopMode;
+   DS32      StrtValueSpeedRamp;
+   DS32      SyncTimeout;
+} t_MAIN_params;
+
+// MAIN_ReadParameters() fills the standby snapshot and switches MAIN_pParams to it
+extern const t_MAIN_params * volatile MAIN_pParams;
+#define MAIN_Params		(*MAIN_pParams)
+
 extern void ResetMainlog(void);
 
 #define MAIN_STATE_LOG_NUMBER_OF_LINES  500  
@@ -554,7 +599,7 @@ extern t_MAIN_CycleLogLine MSC_GetLog (DU16 MSCIndex);
 // replaced by parameter
 // timeout for idle running
 //#define MAIN_IDLE_RUN_TIMEOUT             300000L // 5 min
-#define MAIN_IDLE_RUN_TIMEOUT             ((DU32)PARA[ParRefInd[MAIN_IDLE_RUN_TIMEOUT__PARREFIND]].Value)
+#define MAIN_IDLE_RUN_TIMEOUT             ((DU32)MAIN_Params.IdleRunTimeout)
 
 // timeout for synchronization
 #define MAIN_SYNCHRON_CONNECT_L1E_TIMEOUT 300000L // 5 min for synchronize and connect L1E
@@ -571,7 +616,7 @@ extern t_MAIN_CycleLogLine MSC_GetLog (DU16 MSCIndex);
 // replaced by parameter
 // max time for engine warming
 //#define MAIN_MAX_WARMING_TIME             600000L // 10 min
-#define MAIN_MAX_WARMING_TIME             ((DU32)PARA[ParRefInd[POWER_WARMING_TIMEOUT__PARREFIND]].Value)
+#define MAIN_MAX_WARMING_TIME             ((DU32)MAIN_Params.PowerWarmingTimeout)
 
 // cut out load in deload = Pnominal / fraction
 #define MAIN_CUT_OUT_FRACTION_DELOAD		50L
@@ -630,6 +675,7 @@ extern void MAIN_control_init(void);
 extern void MAIN_control_20ms(void);
 extern void MAIN_control_100ms(void);
 extern void MAIN_control_1000ms(void);
+extern void MAIN_ReadParameters(void);
 extern DU8* MAIN_state_text(DU8 state);
 extern DU8* MAIN_subState_text(DU8 state);
 extern DS32 MAIN_realpower_max_allowed(void);
@@ -53,10 +53,18 @@
  *		  				  tec jet from start flow to idle flow
  *		  30.12.2016 MVO  limit stop supervision off if TecJet
  *		  30.12.2016 MVO  TecJet Maxflow depending on selection of Tecjet 1,2 or both
+ *		  16.10.2026      control loops read parameters from snapshot MIX_Params
+ *		  16.10.2026      snapshot, setpoint curve, deviation constant and tecjet max flow
+ *		                  recalculated by parameter change notification instead of periodically
+ *		  17.10.2026      position deviation and release timeout evaluated by PROT_control()
+ *		  17.10.2026      snapshot and setpoint curve double buffered, switched by one pointer store
+ *		  17.10.2026      derived data only switched if no transaction was applied while building it
+ *		  17.10.2026      release timeout with PROT_COLD_FIRST, no trip if the release came with the timeout
  */
  
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "options.h"
 #include "deif_types.h"
@@ -72,6 +80,8 @@
 #include "ENG.h"
 #include "MIX.h"
 #include "PAR.h"
+#include "PROT.h"
+#include "TMR.h"
 #include "IOA.h"
 #include "GAS.h"
 #include "GBV.h"
@@ -108,6 +118,10 @@ static void MIX_UnderTest(const DU8 sig, DU8 mixer);
 
 // MIX data structure for global use
 t_MIX MIX;
+// snapshot of the parameters used by MIX, MIX_ReadParameters() fills the standby buffer
+// and then switches MIX_pParams to it
+static t_MIX_params ParamsBuffer[2];
+const t_MIX_params * volatile MIX_pParams = &ParamsBuffer[0];
 
 DS32 StepperPositionSetpoint;
 DS32 TheoreticalTemp[2];
@@ -127,6 +141,11 @@ static DBOOL MixFirstCalibration[2];
 static DU32 TimerCalculateNewMixerPosition[2];
 
 static DBOOL MIX_SetpointInitDone[2];
+// setpoint curves, Mix_Update_MixerSetpoints() builds the standby one and then switches
+// MIX.Setpoint_Mixer to it
+static struct t_MIX_Setpoint_Mixer CurveBuffer[2][2][NUMBER_OF_MIXER_SETPOINTS];
+// tecjet options used for the last calculation of MIX.Tecjet_Max_Flow_Rate
+static DBOOL TecjetOption[2];
 
 static void MIX_StepperMotorControl(DU8 MixerIndex);
 
@@ -250,21 +269,24 @@ static void MIX_Regulation_DO(DU8 reg_mode)
 
 static void SetMaxFlowRateTecJet(void)
 {
+	TecjetOption[TECJET_1] = tecjet[TECJET_1].Option;
+	TecjetOption[TECJET_2] = tecjet[TECJET_2].Option;
+
 	if (tecjet[TECJET_1].Option && !tecjet[TECJET_2].Option)
 	{
 		// only tecjet 1
-		MIX.Tecjet_Max_Flow_Rate = (DS32)PARA[ParRefInd[TEC_MAX_FLOW__PARREFIND]].Value;
+		MIX.Tecjet_Max_Flow_Rate = (DS32)MIX_Params.TecMaxFlow;
 	}
 	else if (!tecjet[TECJET_1].Option && tecjet[TECJET_2].Option)
 	{
 		// only tecjet 2
-		MIX.Tecjet_Max_Flow_Rate = (DS32)PARA[ParRefInd[TEC_2_MAX_FLOW__PARREFIND]].Value;
+		MIX.Tecjet_Max_Flow_Rate = (DS32)MIX_Params.Tec2MaxFlow;
 	}
 	else
 	{
 		// either no tectjet or two of them
 		MIX.Tecjet_Max_Flow_Rate =
-				(DS32)PARA[ParRefInd[TEC_MAX_FLOW__PARREFIND]].Value + (DS32)PARA[ParRefInd[TEC_2_MAX_FLOW__PARREFIND]].Value;
+				(DS32)MIX_Params.TecMaxFlow + (DS32)MIX_Params.Tec2MaxFlow;
 	}
 }
 
@@ -275,9 +297,9 @@ static void SetMaxFlowRateTecJet(void)
 #define dpmax3s	2000	// to be replaced by parameter
 #define k		((3000 - tmin) * (dpmax3s - dpmin))	// constant calculated by parameters
 */
-#define tmin	PARA[ParRefInd[MIX_DEV_MIN_TIME__PARREFIND]].Value
-#define dpmin	PARA[ParRefInd[MIX_MAX_DEVIATION__PARREFIND]].Value
-#define dpmax3s	PARA[ParRefInd[MIX_DEV_MAX_DP_3SEC__PARREFIND]].Value
+#define tmin	MIX_Params.DevMinTime
+#define dpmin	MIX_Params.MaxDeviation
+#define dpmax3s	MIX_Params.DevMaxDp3Sec
 #define k		MIX.Constant_pTDeviationControl
 // Check maximum control deviation
 
@@ -312,7 +334,7 @@ static void MIX_ControlDeviation (void)
 		a.p_dev = 0;
 		a.dp_lim = MAX_DS16;
 
-		STOP_Tripped[STOPCONDITION_30231] = FALSE;
+		STOP_SetTripped(STOPCONDITION_30231, FALSE);
 	}
 	else // under control
 	// stay here for delay time until monitoring is released
@@ -334,7 +356,7 @@ static void MIX_ControlDeviation (void)
 		}
 
 	   // lambda
-	   if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 1L)
+	   if (MIX_Params.OptionLambdaControl == 1L)
 	   {
 		   // no monitoring
 		   DelayTime = MIX_MAX_DEVIATION_TIME;
@@ -342,14 +364,14 @@ static void MIX_ControlDeviation (void)
 		   a.Limit = MAX_DS16;
 	   }
 	   // p/T
-	   else if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 2L)
+	   else if (MIX_Params.OptionLambdaControl == 2L)
 	   {
 		   DS32 LimitDS32;
 
 		   /* monitoring absolute deviation of receiver pressure in control mode
 		   DelayTime = MIX_MAX_DEVIATION_TIME;
 		   Deviation = abs(MIX.Setpoint_Receiver_Pressure - MIX.ReceiverPressureFilteredValue);
-		   a.Limit = (DS16)PARA[ParRefInd[MIX_MAX_DEVIATION__PARREFIND]].Value;
+		   a.Limit = (DS16)PAR_VALUE(MIX_MAX_DEVIATION__PARREFIND);
 		   */
 
 		   // monitoring of delta pressure * time (|dp|*t)
@@ -395,11 +417,11 @@ static void MIX_ControlDeviation (void)
 	   }
 #if (OPTION_CYLINDER_MONITORING == TRUE)
 		// combustion chamber temperature
-		else if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 3L)
+		else if (MIX_Params.OptionLambdaControl == 3L)
 		{
 			DelayTime = MIX_MAX_DEVIATION_TIME;
 			Deviation = abs(MIX.Setpoint_Cylinder_Temperatue - CYL.CylinderAverageTemp);
-			a.Limit = (DS16)PARA[ParRefInd[MIX_CYL_MAX_DEVIATION__PARREFIND]].Value;
+			a.Limit = (DS16)MIX_Params.CylMaxDeviation;
 		}
 #endif
 		else
@@ -413,7 +435,7 @@ static void MIX_ControlDeviation (void)
 		a.Exceeded = ( dp_int >= a.Limit );
 
 		// used for trending
-		if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 2L)
+		if (MIX_Params.OptionLambdaControl == 2L)
 		{
 			a.p_dev = dp_int;
 			a.dp_lim = a.Limit;
@@ -431,7 +453,7 @@ static void MIX_ControlDeviation (void)
 		switch(a.State)
 		{
 			case COLD:
-				STOP_Tripped[STOPCONDITION_30231] = FALSE;
+				STOP_SetTripped(STOPCONDITION_30231, FALSE);
 				if ( a.Exceeded )
 				{
 					if (DelayTime == 0L) a.State = TRIP;
@@ -446,7 +468,7 @@ static void MIX_ControlDeviation (void)
 
 			case TRIP:
 				STOP_Set(STOPCONDITION_30231);
-				STOP_Tripped[STOPCONDITION_30231] = TRUE;
+				STOP_SetTripped(STOPCONDITION_30231, TRUE);
 				if (!a.Exceeded) a.State = COLD;
 				break;
 
@@ -466,18 +488,6 @@ static void MIX_ControlDeviation (void)
 
 static void MIX_PositionDeviation (void)
 {
-
-   // if state has changed, clear state timer and remember new state
-   if (a.State != a.LastState )
-   {
-     a.StateTimer = 0;
-     a.LastState  = a.State;
-   }
-   else // count the state timecounter by adding 100ms
-   {
-     if (a.StateTimer < (MAX_DU32-1000)) a.StateTimer += 100L;
-   }
-
    a.Exceeded = ( ( (MIX.state[MixerInd1] == MIX_START_POSITION_REACHED)
 		         || (MIX.state[MixerInd1] == MIX_IDLE_POSITION_REACHED)
 		         || (MIX.state[MixerInd1] == MIX_MOVING_TO_PARALLEL_POS)
@@ -488,30 +498,19 @@ static void MIX_PositionDeviation (void)
 	       	   && (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED)
 		       && (AI_I_FUNCT[IOA_AI_I_MIX_GASMIXER_POS].Assigned == ASSIGNED)
 		       && (abs(MIX.SetpointMixerPositionPercent[MixerInd1] - MIX.ActualPositionOfGasMixerPercent[MixerInd1]) > MIX_POSITION_DEVIATION_LIMIT) );
+}
 
-   switch(a.State)
-   {
-      case COLD:
-      	STOP_Tripped[STOPCONDITION_70231] = FALSE;
-      	if ( a.Exceeded ) a.State = HOT;
-      	break;
-
-      case HOT:
-      	if (!a.Exceeded ) a.State = COLD;
-      	if ( a.StateTimer >= MIX_POSITION_DEVIATION_DELAY) a.State = TRIP;
-      	break;
-
-      case TRIP:
-      	STOP_Set(STOPCONDITION_70231);
-      	STOP_Tripped[STOPCONDITION_70231] = TRUE;
-      	if (!a.Exceeded) a.State = COLD;
-      	break;
+// protections of MIX_control_100ms
+#define MIX_NBR_OF_PROTECTIONS_100MS	1
 
-      default:
-      	a.State = COLD;
-      	break;
-    }
-}
+static const t_PROT_desc MIX_Protection_100ms[MIX_NBR_OF_PROTECTIONS_100MS] =
+{
+	// maximum position deviation, MIX.PositionDeviation.Exceeded set by MIX_PositionDeviation()
+	{ &MIX.PositionDeviation, 0, 0, 0L, 0, 0,
+	  0, 0, 0,
+	  MIX_POSITION_DEVIATION_DELAY, 0L, STOPCONDITION_70231, TMR_TASK_100MS,
+	  PROT_TRIPPED }
+};
 
 
 
@@ -558,7 +557,7 @@ static void Mixer_Control_Release(void)
 
    // no lambda control or no assignment of lambda voltage -> just give green light for control
    overrun = ( // no lambda control -> mixer control is o.k. -> green light
-		   	   !(PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 1L)
+		   	   !(MIX_Params.OptionLambdaControl == 1L)
 				   ||
 				// lambda voltage not assigned? -> mixer control is o.k. -> green light
 				!(AI_I_FUNCT[LAMBDA_VOLTAGE].Assigned == ASSIGNED) );
@@ -621,6 +620,7 @@ static void Mixer_Control_Release(void)
 // *    timeout supervision for active mixer control        *
 // *********************************************************
 // *** function name:     Mixer_Control_Release_Timeout() ***
+// ***                    (input of MIX_Protection_1000ms) ***
 // *** protection struct: MIX.MixerControlReleaseTimeout  ***
 // *** input value:       MIX.MixerControlRelase.State    ***
 // *** trip delay:        MIX_TIMEOUT_FOR_STARTING_LAMBDA_CONTROL*
@@ -637,18 +637,6 @@ static void Mixer_Control_Release(void)
 
 static void Mixer_Control_Release_Timeout(void)
 {
-
-   // if state has changed, clear state timer and remember new state
-   if (a.State != a.LastState )
-   {
-     a.StateTimer = 0;
-     a.LastState  = a.State;
-   }
-   else // count the state timecounter by adding 1000ms
-   {
-     if (a.StateTimer < (MAX_DU32-1000)) a.StateTimer += 1000L;
-   }
-
    a.Limit = MIX_ACCEPTED_MAX_TO_START_CONTROL;
 
    a.Exceeded = (
@@ -658,205 +646,188 @@ static void Mixer_Control_Release_Timeout(void)
 		   &&
 		   (MIX.MixerControlRelease.State != TRIP)	 // but no release so far
    );
+}
 
-   switch(a.State)
-   {
-      case COLD:
-    	if ( a.Exceeded )	a.State = HOT;
-      	break;
-
-      case HOT: 
-    	if (!a.Exceeded )
-    	{
-    		a.State = COLD;
-    	}
-    	else
-    	{
-    		// a.Exceeded
-    		if ( a.StateTimer >= MIX_TIMEOUT_FOR_STARTING_LAMBDA_CONTROL)
-    			a.State = TRIP;
-    	}
-      	break;
-
-      case TRIP:
-    	  STOP_Set(STOPCONDITION_50125);
-      	if (!a.Exceeded)
-      		a.State = COLD;
-      	break;
+// protections of MIX_control_1000ms
+#define MIX_NBR_OF_PROTECTIONS_1000MS	1
 
-      default:
-      	a.State = COLD;
-      	break;
-    }
-}
+static const t_PROT_desc MIX_Protection_1000ms[MIX_NBR_OF_PROTECTIONS_1000MS] =
+{
+	// timeout for the release of active mixer control, MIX.MixerControlReleaseTimeout.Exceeded
+	// set by Mixer_Control_Release_Timeout()
+	{ &MIX.MixerControlReleaseTimeout, 0, 0, 0L, 0, 0,
+	  0, 0, 0,
+	  MIX_TIMEOUT_FOR_STARTING_LAMBDA_CONTROL, 0L, STOPCONDITION_50125, TMR_TASK_1000MS,
+	  PROT_COLD_FIRST }
+};
 
 
 
 
 // read NUMBER_OF_MIXER_SETPOINTS setpoint triples (P,p,T) into array
 // to be called during initialization and after each change of these parameters
-void Mix_Read_MixerSetpointsFromParameters(void)
+static void Mix_Read_MixerSetpointsFromParameters(struct t_MIX_Setpoint_Mixer Curve[2][NUMBER_OF_MIXER_SETPOINTS])
 {
 	// p/T
-	if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 2L)
+	if (PAR_VALUE(MIX_OPTION_LAMBDA_CONTROL__PARREFIND) == 2L)
 	{
 		// gas type A
 		{
 			// copy first curvepoint from the parameters into Setpoint array
-			MIX.Setpoint_Mixer[0][0].Psum  = (DS32)PARA[ParRefInd[MIX_POWER1A__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[0][0].p     = (DS16)PARA[ParRefInd[MIX_PRESS1A__PARREFIND]].Value + PAR_OFFSET_REC_PRESS_VALUE;
-			MIX.Setpoint_Mixer[0][0].theta = (DS16)PARA[ParRefInd[MIX_TEMP1A__PARREFIND]].Value;
+			Curve[0][0].Psum  = (DS32)PAR_VALUE(MIX_POWER1A__PARREFIND);
+			Curve[0][0].p     = (DS16)PAR_VALUE(MIX_PRESS1A__PARREFIND) + PAR_OFFSET_REC_PRESS_VALUE;
+			Curve[0][0].theta = (DS16)PAR_VALUE(MIX_TEMP1A__PARREFIND);
 
 			// copy second curvepoint from the parameters into Setpoint array
-			MIX.Setpoint_Mixer[0][1].Psum  = (DS32)PARA[ParRefInd[MIX_POWER2A__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[0][1].p     = (DS16)PARA[ParRefInd[MIX_PRESS2A__PARREFIND]].Value + PAR_OFFSET_REC_PRESS_VALUE;
-			MIX.Setpoint_Mixer[0][1].theta = (DS16)PARA[ParRefInd[MIX_TEMP2A__PARREFIND]].Value;
+			Curve[0][1].Psum  = (DS32)PAR_VALUE(MIX_POWER2A__PARREFIND);
+			Curve[0][1].p     = (DS16)PAR_VALUE(MIX_PRESS2A__PARREFIND) + PAR_OFFSET_REC_PRESS_VALUE;
+			Curve[0][1].theta = (DS16)PAR_VALUE(MIX_TEMP2A__PARREFIND);
 
 			// copy third curvepoint from the parameters into Setpoint array
-			MIX.Setpoint_Mixer[0][2].Psum  = (DS32)PARA[ParRefInd[MIX_POWER3A__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[0][2].p     = (DS16)PARA[ParRefInd[MIX_PRESS3A__PARREFIND]].Value + PAR_OFFSET_REC_PRESS_VALUE;
-			MIX.Setpoint_Mixer[0][2].theta = (DS16)PARA[ParRefInd[MIX_TEMP3A__PARREFIND]].Value;
+			Curve[0][2].Psum  = (DS32)PAR_VALUE(MIX_POWER3A__PARREFIND);
+			Curve[0][2].p     = (DS16)PAR_VALUE(MIX_PRESS3A__PARREFIND) + PAR_OFFSET_REC_PRESS_VALUE;
+			Curve[0][2].theta = (DS16)PAR_VALUE(MIX_TEMP3A__PARREFIND);
 
 			// copy fourth curvepoint from the parameters into Setpoint array
-			MIX.Setpoint_Mixer[0][3].Psum  = (DS32)PARA[ParRefInd[MIX_POWER4A__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[0][3].p     = (DS16)PARA[ParRefInd[MIX_PRESS4A__PARREFIND]].Value + PAR_OFFSET_REC_PRESS_VALUE;
-			MIX.Setpoint_Mixer[0][3].theta = (DS16)PARA[ParRefInd[MIX_TEMP4A__PARREFIND]].Value;
+			Curve[0][3].Psum  = (DS32)PAR_VALUE(MIX_POWER4A__PARREFIND);
+			Curve[0][3].p     = (DS16)PAR_VALUE(MIX_PRESS4A__PARREFIND) + PAR_OFFSET_REC_PRESS_VALUE;
+			Curve[0][3].theta = (DS16)PAR_VALUE(MIX_TEMP4A__PARREFIND);
 
 			// new points 5...8
 
-			MIX.Setpoint_Mixer[0][4].Psum  = (DS32)PARA[ParRefInd[MIX_POWER5A__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[0][4].p     = (DS16)PARA[ParRefInd[MIX_PRESS5A__PARREFIND]].Value + PAR_OFFSET_REC_PRESS_VALUE;
-			MIX.Setpoint_Mixer[0][4].theta = (DS16)PARA[ParRefInd[MIX_TEMP5A__PARREFIND]].Value;
+			Curve[0][4].Psum  = (DS32)PAR_VALUE(MIX_POWER5A__PARREFIND);
+			Curve[0][4].p     = (DS16)PAR_VALUE(MIX_PRESS5A__PARREFIND) + PAR_OFFSET_REC_PRESS_VALUE;
+			Curve[0][4].theta = (DS16)PAR_VALUE(MIX_TEMP5A__PARREFIND);
 
-			MIX.Setpoint_Mixer[0][5].Psum  = (DS32)PARA[ParRefInd[MIX_POWER6A__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[0][5].p     = (DS16)PARA[ParRefInd[MIX_PRESS6A__PARREFIND]].Value + PAR_OFFSET_REC_PRESS_VALUE;
-			MIX.Setpoint_Mixer[0][5].theta = (DS16)PARA[ParRefInd[MIX_TEMP6A__PARREFIND]].Value;
+			Curve[0][5].Psum  = (DS32)PAR_VALUE(MIX_POWER6A__PARREFIND);
+			Curve[0][5].p     = (DS16)PAR_VALUE(MIX_PRESS6A__PARREFIND) + PAR_OFFSET_REC_PRESS_VALUE;
+			Curve[0][5].theta = (DS16)PAR_VALUE(MIX_TEMP6A__PARREFIND);
 
-			MIX.Setpoint_Mixer[0][6].Psum  = (DS32)PARA[ParRefInd[MIX_POWER7A__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[0][6].p     = (DS16)PARA[ParRefInd[MIX_PRESS7A__PARREFIND]].Value + PAR_OFFSET_REC_PRESS_VALUE;
-			MIX.Setpoint_Mixer[0][6].theta = (DS16)PARA[ParRefInd[MIX_TEMP7A__PARREFIND]].Value;
+			Curve[0][6].Psum  = (DS32)PAR_VALUE(MIX_POWER7A__PARREFIND);
+			Curve[0][6].p     = (DS16)PAR_VALUE(MIX_PRESS7A__PARREFIND) + PAR_OFFSET_REC_PRESS_VALUE;
+			Curve[0][6].theta = (DS16)PAR_VALUE(MIX_TEMP7A__PARREFIND);
 
-			MIX.Setpoint_Mixer[0][7].Psum  = (DS32)PARA[ParRefInd[MIX_POWER8A__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[0][7].p     = (DS16)PARA[ParRefInd[MIX_PRESS8A__PARREFIND]].Value + PAR_OFFSET_REC_PRESS_VALUE;
-			MIX.Setpoint_Mixer[0][7].theta = (DS16)PARA[ParRefInd[MIX_TEMP8A__PARREFIND]].Value;
+			Curve[0][7].Psum  = (DS32)PAR_VALUE(MIX_POWER8A__PARREFIND);
+			Curve[0][7].p     = (DS16)PAR_VALUE(MIX_PRESS8A__PARREFIND) + PAR_OFFSET_REC_PRESS_VALUE;
+			Curve[0][7].theta = (DS16)PAR_VALUE(MIX_TEMP8A__PARREFIND);
 		}
 		// gas type B
 		{
 			// copy first curvepoint from the parameters into Setpoint array
-			MIX.Setpoint_Mixer[1][0].Psum  = (DS32)PARA[ParRefInd[MIX_POWER1B__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[1][0].p     = (DS16)PARA[ParRefInd[MIX_PRESS1B__PARREFIND]].Value + PAR_OFFSET_REC_PRESS_VALUE;
-			MIX.Setpoint_Mixer[1][0].theta = (DS16)PARA[ParRefInd[MIX_TEMP1B__PARREFIND]].Value;
+			Curve[1][0].Psum  = (DS32)PAR_VALUE(MIX_POWER1B__PARREFIND);
+			Curve[1][0].p     = (DS16)PAR_VALUE(MIX_PRESS1B__PARREFIND) + PAR_OFFSET_REC_PRESS_VALUE;
+			Curve[1][0].theta = (DS16)PAR_VALUE(MIX_TEMP1B__PARREFIND);
 
 			// copy second curvepoint from the parameters into Setpoint array
-			MIX.Setpoint_Mixer[1][1].Psum  = (DS32)PARA[ParRefInd[MIX_POWER2B__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[1][1].p     = (DS16)PARA[ParRefInd[MIX_PRESS2B__PARREFIND]].Value + PAR_OFFSET_REC_PRESS_VALUE;
-			MIX.Setpoint_Mixer[1][1].theta = (DS16)PARA[ParRefInd[MIX_TEMP2B__PARREFIND]].Value;
+			Curve[1][1].Psum  = (DS32)PAR_VALUE(MIX_POWER2B__PARREFIND);
+			Curve[1][1].p     = (DS16)PAR_VALUE(MIX_PRESS2B__PARREFIND) + PAR_OFFSET_REC_PRESS_VALUE;
+			Curve[1][1].theta = (DS16)PAR_VALUE(MIX_TEMP2B__PARREFIND);
 
 			// copy third curvepoint from the parameters into Setpoint array
-			MIX.Setpoint_Mixer[1][2].Psum  = (DS32)PARA[ParRefInd[MIX_POWER3B__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[1][2].p     = (DS16)PARA[ParRefInd[MIX_PRESS3B__PARREFIND]].Value + PAR_OFFSET_REC_PRESS_VALUE;
-			MIX.Setpoint_Mixer[1][2].theta = (DS16)PARA[ParRefInd[MIX_TEMP3B__PARREFIND]].Value;
+			Curve[1][2].Psum  = (DS32)PAR_VALUE(MIX_POWER3B__PARREFIND);
+			Curve[1][2].p     = (DS16)PAR_VALUE(MIX_PRESS3B__PARREFIND) + PAR_OFFSET_REC_PRESS_VALUE;
+			Curve[1][2].theta = (DS16)PAR_VALUE(MIX_TEMP3B__PARREFIND);
 
 			// copy fourth curvepoint from the parameters into Setpoint array
-			MIX.Setpoint_Mixer[1][3].Psum  = (DS32)PARA[ParRefInd[MIX_POWER4B__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[1][3].p     = (DS16)PARA[ParRefInd[MIX_PRESS4B__PARREFIND]].Value + PAR_OFFSET_REC_PRESS_VALUE;
-			MIX.Setpoint_Mixer[1][3].theta = (DS16)PARA[ParRefInd[MIX_TEMP4B__PARREFIND]].Value;
+			Curve[1][3].Psum  = (DS32)PAR_VALUE(MIX_POWER4B__PARREFIND);
+			Curve[1][3].p     = (DS16)PAR_VALUE(MIX_PRESS4B__PARREFIND) + PAR_OFFSET_REC_PRESS_VALUE;
+			Curve[1][3].theta = (DS16)PAR_VALUE(MIX_TEMP4B__PARREFIND);
 
 			// new points 5...8
 
-			MIX.Setpoint_Mixer[1][4].Psum  = (DS32)PARA[ParRefInd[MIX_POWER5B__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[1][4].p     = (DS16)PARA[ParRefInd[MIX_PRESS5B__PARREFIND]].Value + PAR_OFFSET_REC_PRESS_VALUE;
-			MIX.Setpoint_Mixer[1][4].theta = (DS16)PARA[ParRefInd[MIX_TEMP5B__PARREFIND]].Value;
+			Curve[1][4].Psum  = (DS32)PAR_VALUE(MIX_POWER5B__PARREFIND);
+			Curve[1][4].p     = (DS16)PAR_VALUE(MIX_PRESS5B__PARREFIND) + PAR_OFFSET_REC_PRESS_VALUE;
+			Curve[1][4].theta = (DS16)PAR_VALUE(MIX_TEMP5B__PARREFIND);
 
-			MIX.Setpoint_Mixer[1][5].Psum  = (DS32)PARA[ParRefInd[MIX_POWER6B__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[1][5].p     = (DS16)PARA[ParRefInd[MIX_PRESS6B__PARREFIND]].Value + PAR_OFFSET_REC_PRESS_VALUE;
-			MIX.Setpoint_Mixer[1][5].theta = (DS16)PARA[ParRefInd[MIX_TEMP6B__PARREFIND]].Value;
+			Curve[1][5].Psum  = (DS32)PAR_VALUE(MIX_POWER6B__PARREFIND);
+			Curve[1][5].p     = (DS16)PAR_VALUE(MIX_PRESS6B__PARREFIND) + PAR_OFFSET_REC_PRESS_VALUE;
+			Curve[1][5].theta = (DS16)PAR_VALUE(MIX_TEMP6B__PARREFIND);
 
-			MIX.Setpoint_Mixer[1][6].Psum  = (DS32)PARA[ParRefInd[MIX_POWER7B__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[1][6].p     = (DS16)PARA[ParRefInd[MIX_PRESS7B__PARREFIND]].Value + PAR_OFFSET_REC_PRESS_VALUE;
-			MIX.Setpoint_Mixer[1][6].theta = (DS16)PARA[ParRefInd[MIX_TEMP7B__PARREFIND]].Value;
+			Curve[1][6].Psum  = (DS32)PAR_VALUE(MIX_POWER7B__PARREFIND);
+			Curve[1][6].p     = (DS16)PAR_VALUE(MIX_PRESS7B__PARREFIND) + PAR_OFFSET_REC_PRESS_VALUE;
+			Curve[1][6].theta = (DS16)PAR_VALUE(MIX_TEMP7B__PARREFIND);
 
-			MIX.Setpoint_Mixer[1][7].Psum  = (DS32)PARA[ParRefInd[MIX_POWER8B__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[1][7].p     = (DS16)PARA[ParRefInd[MIX_PRESS8B__PARREFIND]].Value + PAR_OFFSET_REC_PRESS_VALUE;
-			MIX.Setpoint_Mixer[1][7].theta = (DS16)PARA[ParRefInd[MIX_TEMP8B__PARREFIND]].Value;
+			Curve[1][7].Psum  = (DS32)PAR_VALUE(MIX_POWER8B__PARREFIND);
+			Curve[1][7].p     = (DS16)PAR_VALUE(MIX_PRESS8B__PARREFIND) + PAR_OFFSET_REC_PRESS_VALUE;
+			Curve[1][7].theta = (DS16)PAR_VALUE(MIX_TEMP8B__PARREFIND);
 		}
 	}
 	// combustion chamber temperature
-	else if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 3L)
+	else if (PAR_VALUE(MIX_OPTION_LAMBDA_CONTROL__PARREFIND) == 3L)
 	{
 		// gas type A
 		{
-			MIX.Setpoint_Mixer[0][0].Psum  = (DS32)PARA[ParRefInd[MIX_CYL_POWER1A__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[0][0].p     = 0;
-			MIX.Setpoint_Mixer[0][0].theta = (DS16)PARA[ParRefInd[MIX_CYL_TEMP1A__PARREFIND]].Value;
+			Curve[0][0].Psum  = (DS32)PAR_VALUE(MIX_CYL_POWER1A__PARREFIND);
+			Curve[0][0].p     = 0;
+			Curve[0][0].theta = (DS16)PAR_VALUE(MIX_CYL_TEMP1A__PARREFIND);
 
-			MIX.Setpoint_Mixer[0][1].Psum  = (DS32)PARA[ParRefInd[MIX_CYL_POWER2A__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[0][1].p     = 0;
-			MIX.Setpoint_Mixer[0][1].theta = (DS16)PARA[ParRefInd[MIX_CYL_TEMP2A__PARREFIND]].Value;
+			Curve[0][1].Psum  = (DS32)PAR_VALUE(MIX_CYL_POWER2A__PARREFIND);
+			Curve[0][1].p     = 0;
+			Curve[0][1].theta = (DS16)PAR_VALUE(MIX_CYL_TEMP2A__PARREFIND);
 
-			MIX.Setpoint_Mixer[0][2].Psum  = (DS32)PARA[ParRefInd[MIX_CYL_POWER3A__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[0][2].p     = 0;
-			MIX.Setpoint_Mixer[0][2].theta = (DS16)PARA[ParRefInd[MIX_CYL_TEMP3A__PARREFIND]].Value;
+			Curve[0][2].Psum  = (DS32)PAR_VALUE(MIX_CYL_POWER3A__PARREFIND);
+			Curve[0][2].p     = 0;
+			Curve[0][2].theta = (DS16)PAR_VALUE(MIX_CYL_TEMP3A__PARREFIND);
 
-			MIX.Setpoint_Mixer[0][3].Psum  = (DS32)PARA[ParRefInd[MIX_CYL_POWER4A__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[0][3].p     = 0;
-			MIX.Setpoint_Mixer[0][3].theta = (DS16)PARA[ParRefInd[MIX_CYL_TEMP4A__PARREFIND]].Value;
+			Curve[0][3].Psum  = (DS32)PAR_VALUE(MIX_CYL_POWER4A__PARREFIND);
+			Curve[0][3].p     = 0;
+			Curve[0][3].theta = (DS16)PAR_VALUE(MIX_CYL_TEMP4A__PARREFIND);
 
-			MIX.Setpoint_Mixer[0][4].Psum  = (DS32)PARA[ParRefInd[MIX_CYL_POWER5A__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[0][4].p     = 0;
-			MIX.Setpoint_Mixer[0][4].theta = (DS16)PARA[ParRefInd[MIX_CYL_TEMP5A__PARREFIND]].Value;
+			Curve[0][4].Psum  = (DS32)PAR_VALUE(MIX_CYL_POWER5A__PARREFIND);
+			Curve[0][4].p     = 0;
+			Curve[0][4].theta = (DS16)PAR_VALUE(MIX_CYL_TEMP5A__PARREFIND);
 
-			MIX.Setpoint_Mixer[0][5].Psum  = (DS32)PARA[ParRefInd[MIX_CYL_POWER6A__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[0][5].p     = 0;
-			MIX.Setpoint_Mixer[0][5].theta = (DS16)PARA[ParRefInd[MIX_CYL_TEMP6A__PARREFIND]].Value;
+			Curve[0][5].Psum  = (DS32)PAR_VALUE(MIX_CYL_POWER6A__PARREFIND);
+			Curve[0][5].p     = 0;
+			Curve[0][5].theta = (DS16)PAR_VALUE(MIX_CYL_TEMP6A__PARREFIND);
 
-			MIX.Setpoint_Mixer[0][6].Psum  = (DS32)PARA[ParRefInd[MIX_CYL_POWER7A__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[0][6].p     = 0;
-			MIX.Setpoint_Mixer[0][6].theta = (DS16)PARA[ParRefInd[MIX_CYL_TEMP7A__PARREFIND]].Value;
+			Curve[0][6].Psum  = (DS32)PAR_VALUE(MIX_CYL_POWER7A__PARREFIND);
+			Curve[0][6].p     = 0;
+			Curve[0][6].theta = (DS16)PAR_VALUE(MIX_CYL_TEMP7A__PARREFIND);
 
-			MIX.Setpoint_Mixer[0][7].Psum  = (DS32)PARA[ParRefInd[MIX_CYL_POWER8A__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[0][7].p     = 0;
-			MIX.Setpoint_Mixer[0][7].theta = (DS16)PARA[ParRefInd[MIX_CYL_TEMP8A__PARREFIND]].Value;
+			Curve[0][7].Psum  = (DS32)PAR_VALUE(MIX_CYL_POWER8A__PARREFIND);
+			Curve[0][7].p     = 0;
+			Curve[0][7].theta = (DS16)PAR_VALUE(MIX_CYL_TEMP8A__PARREFIND);
 		}
 		
 		{
-			MIX.Setpoint_Mixer[1][0].Psum  = (DS32)PARA[ParRefInd[MIX_CYL_POWER1B__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[1][0].p     = 0;
-			MIX.Setpoint_Mixer[1][0].theta = (DS16)PARA[ParRefInd[MIX_CYL_TEMP1B__PARREFIND]].Value;
+			Curve[1][0].Psum  = (DS32)PAR_VALUE(MIX_CYL_POWER1B__PARREFIND);
+			Curve[1][0].p     = 0;
+			Curve[1][0].theta = (DS16)PAR_VALUE(MIX_CYL_TEMP1B__PARREFIND);
 
-			MIX.Setpoint_Mixer[1][1].Psum  = (DS32)PARA[ParRefInd[MIX_CYL_POWER2B__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[1][1].p     = 0;
-			MIX.Setpoint_Mixer[1][1].theta = (DS16)PARA[ParRefInd[MIX_CYL_TEMP2B__PARREFIND]].Value;
+			Curve[1][1].Psum  = (DS32)PAR_VALUE(MIX_CYL_POWER2B__PARREFIND);
+			Curve[1][1].p     = 0;
+			Curve[1][1].theta = (DS16)PAR_VALUE(MIX_CYL_TEMP2B__PARREFIND);
 
-			MIX.Setpoint_Mixer[1][2].Psum  = (DS32)PARA[ParRefInd[MIX_CYL_POWER3B__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[1][2].p     = 0;
-			MIX.Setpoint_Mixer[1][2].theta = (DS16)PARA[ParRefInd[MIX_CYL_TEMP3B__PARREFIND]].Value;
+			Curve[1][2].Psum  = (DS32)PAR_VALUE(MIX_CYL_POWER3B__PARREFIND);
+			Curve[1][2].p     = 0;
+			Curve[1][2].theta = (DS16)PAR_VALUE(MIX_CYL_TEMP3B__PARREFIND);
 
-			MIX.Setpoint_Mixer[1][3].Psum  = (DS32)PARA[ParRefInd[MIX_CYL_POWER4B__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[1][3].p     = 0;
-			MIX.Setpoint_Mixer[1][3].theta = (DS16)PARA[ParRefInd[MIX_CYL_TEMP4B__PARREFIND]].Value;
+			Curve[1][3].Psum  = (DS32)PAR_VALUE(MIX_CYL_POWER4B__PARREFIND);
+			Curve[1][3].p     = 0;
+			Curve[1][3].theta = (DS16)PAR_VALUE(MIX_CYL_TEMP4B__PARREFIND);
 
-			MIX.Setpoint_Mixer[1][4].Psum  = (DS32)PARA[ParRefInd[MIX_CYL_POWER5B__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[1][4].p     = 0;
-			MIX.Setpoint_Mixer[1][4].theta = (DS16)PARA[ParRefInd[MIX_CYL_TEMP5B__PARREFIND]].Value;
+			Curve[1][4].Psum  = (DS32)PAR_VALUE(MIX_CYL_POWER5B__PARREFIND);
+			Curve[1][4].p     = 0;
+			Curve[1][4].theta = (DS16)PAR_VALUE(MIX_CYL_TEMP5B__PARREFIND);
 
-			MIX.Setpoint_Mixer[1][5].Psum  = (DS32)PARA[ParRefInd[MIX_CYL_POWER6B__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[1][5].p     = 0;
-			MIX.Setpoint_Mixer[1][5].theta = (DS16)PARA[ParRefInd[MIX_CYL_TEMP6B__PARREFIND]].Value;
+			Curve[1][5].Psum  = (DS32)PAR_VALUE(MIX_CYL_POWER6B__PARREFIND);
+			Curve[1][5].p     = 0;
+			Curve[1][5].theta = (DS16)PAR_VALUE(MIX_CYL_TEMP6B__PARREFIND);
 
-			MIX.Setpoint_Mixer[1][6].Psum  = (DS32)PARA[ParRefInd[MIX_CYL_POWER7B__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[1][6].p     = 0;
-			MIX.Setpoint_Mixer[1][6].theta = (DS16)PARA[ParRefInd[MIX_CYL_TEMP7B__PARREFIND]].Value;
+			Curve[1][6].Psum  = (DS32)PAR_VALUE(MIX_CYL_POWER7B__PARREFIND);
+			Curve[1][6].p     = 0;
+			Curve[1][6].theta = (DS16)PAR_VALUE(MIX_CYL_TEMP7B__PARREFIND);
 
-			MIX.Setpoint_Mixer[1][7].Psum  = (DS32)PARA[ParRefInd[MIX_CYL_POWER8B__PARREFIND]].Value;
-			MIX.Setpoint_Mixer[1][7].p     = 0;
-			MIX.Setpoint_Mixer[1][7].theta = (DS16)PARA[ParRefInd[MIX_CYL_TEMP8B__PARREFIND]].Value;
+			Curve[1][7].Psum  = (DS32)PAR_VALUE(MIX_CYL_POWER8B__PARREFIND);
+			Curve[1][7].p     = 0;
+			Curve[1][7].theta = (DS16)PAR_VALUE(MIX_CYL_TEMP8B__PARREFIND);
 		}
 	}
 }
 
 // sort setpoints within the array by Power
-void Mix_Sort_MixerSetpoints(void)
+static void Mix_Sort_MixerSetpoints(struct t_MIX_Setpoint_Mixer Curve[2][NUMBER_OF_MIXER_SETPOINTS])
 {
 	DU8 gas;
 	DBOOL Sorted = FALSE;
@@ -869,20 +840,20 @@ void Mix_Sort_MixerSetpoints(void)
 		Sorted = TRUE;
 	    for (j = 0; j < NUMBER_OF_MIXER_SETPOINTS - 1; j++)
 	    {
-	    	if (MIX.Setpoint_Mixer[gas][j].Psum > MIX.Setpoint_Mixer[gas][j+1].Psum)
+	    	if (Curve[gas][j].Psum > Curve[gas][j+1].Psum)
 	    	{
 	    	    // swap point j and j+1
-	    	    c.Psum  = MIX.Setpoint_Mixer[gas][j].Psum;
-	    	    c.p     = MIX.Setpoint_Mixer[gas][j].p;
-	    	    c.theta = MIX.Setpoint_Mixer[gas][j].theta;
+	    	    c.Psum  = Curve[gas][j].Psum;
+	    	    c.p     = Curve[gas][j].p;
+	    	    c.theta = Curve[gas][j].theta;
 
-	    	    MIX.Setpoint_Mixer[gas][j].Psum    = MIX.Setpoint_Mixer[gas][j+1].Psum;
-	    	    MIX.Setpoint_Mixer[gas][j].p       = MIX.Setpoint_Mixer[gas][j+1].p;
-	    	    MIX.Setpoint_Mixer[gas][j].theta   = MIX.Setpoint_Mixer[gas][j+1].theta;
+	    	    Curve[gas][j].Psum    = Curve[gas][j+1].Psum;
+	    	    Curve[gas][j].p       = Curve[gas][j+1].p;
+	    	    Curve[gas][j].theta   = Curve[gas][j+1].theta;
 
-	    	    MIX.Setpoint_Mixer[gas][j+1].Psum  = c.Psum;
-	    	    MIX.Setpoint_Mixer[gas][j+1].p     = c.p;
-	    	    MIX.Setpoint_Mixer[gas][j+1].theta = c.theta;
+	    	    Curve[gas][j+1].Psum  = c.Psum;
+	    	    Curve[gas][j+1].p     = c.p;
+	    	    Curve[gas][j+1].theta = c.theta;
 
 	    	    // remember that the set was not sorted, yet
 	    	    Sorted = FALSE;
@@ -923,7 +894,7 @@ static DS16 Mix_Calculate_Enrichment(void)
 	// input value: selected by Parameter 22113
 	// 0 = engine inlet, 1 = engine exit
 
-	switch ((DU8)PARA[ParRefInd[MIX_COLD_STRT_ENRI_MEAS_POINT__PARREFIND]].Value)
+	switch ((DU8)MIX_Params.ColdStrtEnriMeasPoint)
 	{
 		//selection of input value and MSR point depending on parameter setting
 		case 0:
@@ -963,7 +934,7 @@ static DS16 Mix_Calculate_Enrichment(void)
 	    // return enrichment in [0,01%] calc. by DeltaT [0,1K] and ENRICHMENT_RATE [0,1%/K]
 	    //ReturnValue = (DeltaT * (DS16)MIX_ENRICHMENT_RATE_DUE_TO_TEMPERATURE);
 	    // return enrichment in [0,01%] calc. by DeltaT [0,1K] and ENRICHMENT_RATE [0,01%/K]
-	    ReturnValue = ((DS32)DeltaT * PARA[ParRefInd[MIX_COLD_START_ENRICHMENT__PARREFIND]].Value / 10);
+	    ReturnValue = ((DS32)DeltaT * MIX_Params.ColdStartEnrichment / 10);
 
 	}
 	else
@@ -1016,7 +987,7 @@ DS16 Mix_Calculate_Setpoint_For_Mixer_Position(DU16 Index_A, DU16 Index_B)
 
 	if (!GAS.GasTypeBActive) // gas A
 		SetpointMixerPos = 	(MIX.MixerFullRange_Out
-			* ((DS32)PARA[ParRefInd[Index_A]].Value + (DS32)PARA[ParRefInd[Index_A]].Value
+			* ((DS32)PAR_VALUE(Index_A) + (DS32)PAR_VALUE(Index_A)
 					* (MIX.TemperatureOffset
 							//+ MIX.AdditionalTemperatureOffsetTecJet
 							+ MIX.AdditionalEnrichmentTecJet) / 10000L
@@ -1024,7 +995,7 @@ DS16 Mix_Calculate_Setpoint_For_Mixer_Position(DU16 Index_A, DU16 Index_B)
 			/*+ O2.MixerOffset*/) / 1000L); // to_do_zzh for O2 offset
 	else // gas B
 		SetpointMixerPos = 	(MIX.MixerFullRange_Out
-			* ((DS32)PARA[ParRefInd[Index_B]].Value + (DS32)PARA[ParRefInd[Index_B]].Value
+			* ((DS32)PAR_VALUE(Index_B) + (DS32)PAR_VALUE(Index_B)
 					* (MIX.TemperatureOffset
 							//+ MIX.AdditionalTemperatureOffsetTecJet
 							+ MIX.AdditionalEnrichmentTecJet) / 10000L
@@ -1073,7 +1044,7 @@ static DS32 MIX_RunningTimeRamp (DS32 Actual, DS16 Target, DS32 Range)
 	if (Actual != (DS32)Target)
 	{
 		// step each 100ms
-		step = (Range * 100 + (DS32)PARA[ParRefInd[MIX_RUNNING_TIME_0_TO_100_PERCENT__PARREFIND]].Value / 2) / (DS32)PARA[ParRefInd[MIX_RUNNING_TIME_0_TO_100_PERCENT__PARREFIND]].Value;
+		step = (Range * 100 + (DS32)MIX_Params.RunningTime0To100Percent / 2) / (DS32)MIX_Params.RunningTime0To100Percent;
 
 		if (abs(Actual - (DS32)Target) < step)
 		{
@@ -1178,7 +1149,7 @@ static void MIX_SystemOff(const DU8 sig, DU8 mixer)
 				break;
 			}
 
-            if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 0L)
+            if (MIX_Params.OptionLambdaControl == 0L)
 			{
 			  // no emission control
 			  Transit(MIX_StartPositionReached, mixer);
@@ -1186,7 +1157,7 @@ static void MIX_SystemOff(const DU8 sig, DU8 mixer)
 			}
 			
 			if (mixer == MixerInd2)
-			if (!PARA[ParRefInd[MIX_SECOND_MIXER__PARREFIND]].Value || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
+			if (!MIX_Params.SecondMixer || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
 			{
 			  Transit(MIX_StartPositionReached, mixer);
 			  break;
@@ -1324,7 +1295,7 @@ static void MIX_SearchLimitLean(const DU8 sig, DU8 mixer)
 				break;
 			}
 
-            if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 0L)
+            if (MIX_Params.OptionLambdaControl == 0L)
 			{
 			  // no emission control
 			  Transit(MIX_StartPositionReached, mixer);
@@ -1332,7 +1303,7 @@ static void MIX_SearchLimitLean(const DU8 sig, DU8 mixer)
 			}
 			
 			if (mixer == MixerInd2) // Se podría eleminar,ya que se cuenta con un solo mixer
-			if (!PARA[ParRefInd[MIX_SECOND_MIXER__PARREFIND]].Value || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
+			if (!MIX_Params.SecondMixer || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
 			{
 			  Transit(MIX_StartPositionReached, mixer);
 			  break;
@@ -1488,7 +1459,7 @@ static void MIX_PositionLeanReached(const DU8 sig, DU8 mixer)
 				break;
 			}
 
-            if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 0L)
+            if (MIX_Params.OptionLambdaControl == 0L)
 			{
 			  // no emission control
 			  Transit(MIX_StartPositionReached, mixer);
@@ -1496,7 +1467,7 @@ static void MIX_PositionLeanReached(const DU8 sig, DU8 mixer)
 			}
 
 			if (mixer == MixerInd2)
-			if (!PARA[ParRefInd[MIX_SECOND_MIXER__PARREFIND]].Value || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
+			if (!MIX_Params.SecondMixer || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
 			{
 			  Transit(MIX_StartPositionReached, mixer);
 			  break;
@@ -1641,7 +1612,7 @@ static void MIX_MoveRich(const DU8 sig, DU8 mixer)
 				break;
 			}
 
-            if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 0L)
+            if (MIX_Params.OptionLambdaControl == 0L)
 			{
 			  // no emission control
 			  Transit(MIX_StartPositionReached, mixer);
@@ -1649,7 +1620,7 @@ static void MIX_MoveRich(const DU8 sig, DU8 mixer)
 			}
 
 			if (mixer == MixerInd2)
-			if (!PARA[ParRefInd[MIX_SECOND_MIXER__PARREFIND]].Value || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
+			if (!MIX_Params.SecondMixer || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
 			{
 			  Transit(MIX_StartPositionReached, mixer);
 			  break;
@@ -1674,7 +1645,7 @@ static void MIX_MoveRich(const DU8 sig, DU8 mixer)
             {
 				MIX.SetpointMixerPosition[mixer] = MIX.TargetMixerPosition[mixer];
             	if ( ( (MIX.DI_LimitStopRich) && (DI_FUNCT[MIXER_LIMIT_RICH].Assigned == ASSIGNED) )
-					|| (MIX.ActualPositionOfGasMixer[mixer] >= (DS16)PARA[ParRefInd[MIX_MAX_NUMBER_OF_STEPS__PARREFIND]].Value) ) // !!! check position
+					|| (MIX.ActualPositionOfGasMixer[mixer] >= (DS16)MIX_Params.MaxNumberOfSteps) ) // !!! check position
 				{
 					// position 100% reached?
 					// then continue with positionRichReached
@@ -1781,7 +1752,7 @@ static void MIX_PositionRichReached(const DU8 sig, DU8 mixer)
 				break;
 			}
 
-            if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 0L)
+            if (MIX_Params.OptionLambdaControl == 0L)
 			{
 			  // no emission control
 			  Transit(MIX_StartPositionReached, mixer);
@@ -1789,7 +1760,7 @@ static void MIX_PositionRichReached(const DU8 sig, DU8 mixer)
 			}
 			
 			if (mixer == MixerInd2)
-			if (!PARA[ParRefInd[MIX_SECOND_MIXER__PARREFIND]].Value || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
+			if (!MIX_Params.SecondMixer || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
 			{
 			  Transit(MIX_StartPositionReached, mixer);
 			  break;
@@ -1912,7 +1883,7 @@ static void MIX_MoveStart(const DU8 sig, DU8 mixer)
             	break;
             }
 
-            if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 0L)
+            if (MIX_Params.OptionLambdaControl == 0L)
 			{
 			  // no emission control
 			  Transit(MIX_StartPositionReached, mixer);
@@ -1920,7 +1891,7 @@ static void MIX_MoveStart(const DU8 sig, DU8 mixer)
 			}
 			
 			if (mixer == MixerInd2)
-			if (!PARA[ParRefInd[MIX_SECOND_MIXER__PARREFIND]].Value || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
+			if (!MIX_Params.SecondMixer || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
 			{
 			  Transit(MIX_StartPositionReached, mixer);
 			  break;
@@ -2044,14 +2015,14 @@ static void MIX_StartPositionReached(const DU8 sig, DU8 mixer)
 				break;
 			}
 
-            if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 0L)
+            if (MIX_Params.OptionLambdaControl == 0L)
 			{
 			  // no emission control - stay here
 			  break;
 			}
 			
 			if (mixer == MixerInd2)
-			if (!PARA[ParRefInd[MIX_SECOND_MIXER__PARREFIND]].Value || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
+			if (!MIX_Params.SecondMixer || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
 			{
 			  // stay here...
 			  break;
@@ -2190,7 +2161,7 @@ static void MIX_MoveIdle(const DU8 sig, DU8 mixer)
             	break;
             }
 
-            if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 0L)
+            if (MIX_Params.OptionLambdaControl == 0L)
 			{
 			  // no emission control
 			  Transit(MIX_StartPositionReached, mixer);
@@ -2198,7 +2169,7 @@ static void MIX_MoveIdle(const DU8 sig, DU8 mixer)
 			}
 			
 			if (mixer == MixerInd2)
-			if (!PARA[ParRefInd[MIX_SECOND_MIXER__PARREFIND]].Value || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
+			if (!MIX_Params.SecondMixer || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
 			{
 			  Transit(MIX_StartPositionReached, mixer);
 			  break;
@@ -2356,7 +2327,7 @@ static void MIX_IdlePositionReached(const DU8 sig, DU8 mixer)
 			  break;
 			}
 
-            if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 0L)
+            if (MIX_Params.OptionLambdaControl == 0L)
 			{
 			  // no emission control
 			  Transit(MIX_StartPositionReached, mixer);
@@ -2364,7 +2335,7 @@ static void MIX_IdlePositionReached(const DU8 sig, DU8 mixer)
 			}
 			
 			if (mixer == MixerInd2)
-			if (!PARA[ParRefInd[MIX_SECOND_MIXER__PARREFIND]].Value || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
+			if (!MIX_Params.SecondMixer || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
 			{
 			  Transit(MIX_StartPositionReached, mixer);
 			  break;
@@ -2510,7 +2481,7 @@ static void MIX_MoveParallel(const DU8 sig, DU8 mixer)
             	break;
             }
 
-            if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 0L)
+            if (MIX_Params.OptionLambdaControl == 0L)
 			{
 			  // no emission control
 			  Transit(MIX_StartPositionReached, mixer);
@@ -2518,7 +2489,7 @@ static void MIX_MoveParallel(const DU8 sig, DU8 mixer)
 			}
 			
 			if (mixer == MixerInd2)
-			if (!PARA[ParRefInd[MIX_SECOND_MIXER__PARREFIND]].Value || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
+			if (!MIX_Params.SecondMixer || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
 			{
 			  Transit(MIX_StartPositionReached, mixer);
 			  break;
@@ -2683,7 +2654,7 @@ static void MIX_ParallelPositionReached(const DU8 sig, DU8 mixer)
 			  break;
 			}
 
-            if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 0L)
+            if (MIX_Params.OptionLambdaControl == 0L)
 			{
 			  // no emission control
 			  Transit(MIX_StartPositionReached, mixer);
@@ -2691,7 +2662,7 @@ static void MIX_ParallelPositionReached(const DU8 sig, DU8 mixer)
 			}
 			
 			if (mixer == MixerInd2)
-			if (!PARA[ParRefInd[MIX_SECOND_MIXER__PARREFIND]].Value || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
+			if (!MIX_Params.SecondMixer || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
 			{
 			  Transit(MIX_StartPositionReached, mixer);
 			  break;
@@ -2703,7 +2674,7 @@ static void MIX_ParallelPositionReached(const DU8 sig, DU8 mixer)
 				TimerCalculateNewMixerPosition[mixer] = 0L;
 				if (MIX_OPTION_TECJET)
 				{
-					PowerSetpointRelative = (TUR.Reg.PowerSetPoint * 10L / (DS32)(PARA[ParRefInd[GEN_NOMINAL_LOAD__PARREFIND]].Value/1000L));
+					PowerSetpointRelative = (TUR.Reg.PowerSetPoint * 10L / (DS32)(MIX_Params.GenNominalLoad/1000L));
 
 					// interpolate flow setpoints (=mixer positions) depending on power
 					// @ 0%: MIX_PARALLEL_POS_A__PARREFIND
@@ -2896,7 +2867,7 @@ static void MIX_MoveIsland(const DU8 sig, DU8 mixer)
             	break;
             }
 
-            if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 0L)
+            if (MIX_Params.OptionLambdaControl == 0L)
 			{
 			  // no emission control
 			  Transit(MIX_StartPositionReached, mixer);
@@ -2904,7 +2875,7 @@ static void MIX_MoveIsland(const DU8 sig, DU8 mixer)
 			}
 			
 			if (mixer == MixerInd2)
-			if (!PARA[ParRefInd[MIX_SECOND_MIXER__PARREFIND]].Value || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
+			if (!MIX_Params.SecondMixer || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
 			{
 			  Transit(MIX_StartPositionReached, mixer);
 			  break;
@@ -3068,7 +3039,7 @@ static void MIX_IslandPositionReached(const DU8 sig, DU8 mixer)
 			  break;
 			}
 
-            if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 0L)
+            if (MIX_Params.OptionLambdaControl == 0L)
 			{
 			  // no emission control
 			  Transit(MIX_StartPositionReached, mixer);
@@ -3076,7 +3047,7 @@ static void MIX_IslandPositionReached(const DU8 sig, DU8 mixer)
 			}
 			
 			if (mixer == MixerInd2)
-			if (!PARA[ParRefInd[MIX_SECOND_MIXER__PARREFIND]].Value || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
+			if (!MIX_Params.SecondMixer || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
 			{
 			  Transit(MIX_StartPositionReached, mixer);
 			  break;
@@ -3234,7 +3205,7 @@ static void MIX_Control(const DU8 sig, DU8 mixer)
 	                		                                PARA[ParRefInd[TEC_LAMBDA_SETPOINT_FULL_LOAD__PARREFIND]].MaxValue,
 	                		                                PARA[ParRefInd[TEC_LAMBDA_SETPOINT_FULL_LOAD__PARREFIND]].MinValue,
 	                		                                0,
-	                		                                PARA[ParRefInd[MIX_MAX_NUMBER_OF_STEPS__PARREFIND]].Value);
+	                		                                PAR_VALUE(MIX_MAX_NUMBER_OF_STEPS__PARREFIND));
 	                */
 
 	    		}
@@ -3278,7 +3249,7 @@ static void MIX_Control(const DU8 sig, DU8 mixer)
 				break;
 			}
 
-            if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 0L)
+            if (MIX_Params.OptionLambdaControl == 0L)
 			{
 			  // no emission control
 			  Transit(MIX_StartPositionReached, mixer);
@@ -3286,7 +3257,7 @@ static void MIX_Control(const DU8 sig, DU8 mixer)
 			}
 			
 			if (mixer == MixerInd2)
-			if (!PARA[ParRefInd[MIX_SECOND_MIXER__PARREFIND]].Value || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
+			if (!MIX_Params.SecondMixer || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
 			{
 			  Transit(MIX_StartPositionReached, mixer);
 			  break;
@@ -3319,7 +3290,7 @@ static void MIX_Control(const DU8 sig, DU8 mixer)
             	DU8  gas;
 
 				// lambda control
-	            if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 1L)
+	            if (MIX_Params.OptionLambdaControl == 1L)
 	            {
 	            	MIX_reg_divide = 10000L;
 	            	
@@ -3327,14 +3298,14 @@ static void MIX_Control(const DU8 sig, DU8 mixer)
 	                if (GBV.Active)
 	                {
 	                	if (ELM.T1E.sec.PsumRelative == 0)
-	                		MIX.LambdaSetp = PARA[ParRefInd[MIX_SETPOINT_LAMBDA__PARREFIND]].Value;
+	                		MIX.LambdaSetp = MIX_Params.SetpointLambda;
 	                	else
-	                		MIX.LambdaSetp = (PARA[ParRefInd[MIX_SETPOINT_LAMBDA__PARREFIND]].Value*GBV.Pa + PARA[ParRefInd[MIX_SETPOINT_LAMBDA_GASB__PARREFIND]].Value*GBV.Pb) / ELM.T1E.sec.PsumRelative;
+	                		MIX.LambdaSetp = (MIX_Params.SetpointLambda*GBV.Pa + MIX_Params.SetpointLambdaGasB*GBV.Pb) / ELM.T1E.sec.PsumRelative;
 	                }
 	                else if (!GAS.GasTypeBActive) // gas type A
-	                	MIX.LambdaSetp = PARA[ParRefInd[MIX_SETPOINT_LAMBDA__PARREFIND]].Value;
+	                	MIX.LambdaSetp = MIX_Params.SetpointLambda;
 	            	else // gas type B
-	            		MIX.LambdaSetp = PARA[ParRefInd[MIX_SETPOINT_LAMBDA_GASB__PARREFIND]].Value;
+	            		MIX.LambdaSetp = MIX_Params.SetpointLambdaGasB;
 
 	                // Deviation
 	                dev = MIX.LambdaSetp - MIX.LambdaVoltageFilteredValue;
@@ -3343,11 +3314,11 @@ static void MIX_Control(const DU8 sig, DU8 mixer)
 	            	// lower lambda voltage = more oxygen partial pressure = too lean)
 
 	            	// in case of inverted Lambda-Signal
-	            	if (PARA[ParRefInd[MIX_INVERT_LAMBDA_REGULATION__PARREFIND]].Value)
+	            	if (MIX_Params.InvertLambdaRegulation)
 	            		dev = -dev;
 	            }
 	            // p/T control
-	            else if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 2L)
+	            else if (MIX_Params.OptionLambdaControl == 2L)
 	            {
 	            	DU16 ParIndex;
 
@@ -3371,7 +3342,7 @@ static void MIX_Control(const DU8 sig, DU8 mixer)
 		                if (gas == 0) ParIndex = MIX_P_T_FACTOR_A__PARREFIND;
 		                else          ParIndex = MIX_P_T_FACTOR_B__PARREFIND;
 
-		                MIX.PressSetp[gas] = (TheoreticalPressure[gas] *1000L + DeltaTemp[gas] * (DS32)PARA[ParRefInd[ParIndex]].Value) /1000L;
+		                MIX.PressSetp[gas] = (TheoreticalPressure[gas] *1000L + DeltaTemp[gas] * (DS32)PAR_VALUE(ParIndex)) /1000L;
 	            	}
 
 	                if (GBV.Active)
@@ -3444,23 +3415,23 @@ static void MIX_Control(const DU8 sig, DU8 mixer)
 	                if (!GAS.GasTypeBActive) // gas type A
 	                {
 		                MIX.Setpoint_Receiver_Pressure = (TheoreticalPressure *1000L 
-		                                       + DeltaTemp * (DS32)PARA[ParRefInd[MIX_P_T_FACTOR_A__PARREFIND]].Value) /1000L;
+		                                       + DeltaTemp * (DS32)MIX_Params.PTFactorA) /1000L;
 	                }
 	                else // gas type B
 	                {
 		                MIX.Setpoint_Receiver_Pressure = (TheoreticalPressure *1000L 
-		                                       + DeltaTemp * (DS32)PARA[ParRefInd[MIX_P_T_FACTOR_B__PARREFIND]].Value) /1000L;
+		                                       + DeltaTemp * (DS32)MIX_Params.PTFactorB) /1000L;
 	                }
 #endif
 	                // offset (island)
 	                if (HVS.stateL1E != HVS_L1E_IS_ON)
-	                	MIX.Setpoint_Receiver_Pressure += (DS16)PARA[ParRefInd[MIX_OFFSET_ISLAND__PARREFIND]].Value;
+	                	MIX.Setpoint_Receiver_Pressure += (DS16)MIX_Params.OffsetIsland;
 	                
 	                // Now we have a setpoint. PID controller (common for both regulation algorithms)
 	                dev = MIX.ReceiverPressureAvgFilteredValue - MIX.Setpoint_Receiver_Pressure;
 	            }
 	            // combustion chamber temperature control
-	            else if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 3L)
+	            else if (MIX_Params.OptionLambdaControl == 3L)
 	            {
 	            	MIX_reg_divide = 100000L;
 
@@ -3511,7 +3482,7 @@ static void MIX_Control(const DU8 sig, DU8 mixer)
 #endif
 	                // offset (island)
 	                if (HVS.stateL1E != HVS_L1E_IS_ON)
-	                	MIX.Setpoint_Cylinder_Temperatue += (DS16)PARA[ParRefInd[MIX_CYL_OFFSET_ISLAND__PARREFIND]].Value;
+	                	MIX.Setpoint_Cylinder_Temperatue += (DS16)MIX_Params.CylOffsetIsland;
 
 	                dev = MIX.Setpoint_Cylinder_Temperatue - CYL.CylinderAverageTemp;
 #else
@@ -3537,9 +3508,9 @@ static void MIX_Control(const DU8 sig, DU8 mixer)
 
 		            // remember leftover from deviation
 		            temp =  leftover // from last cycle
-				    		   + (de * (DS32)PARA[ParRefInd[MIX_REG_CONST_KP__PARREFIND]].Value // Kp
-				               + dev * (DS32)PARA[ParRefInd[MIX_REG_CONST_KI__PARREFIND]].Value // Ki
-				               + (de - deold) * (DS32)PARA[ParRefInd[MIX_REG_CONST_KD__PARREFIND]].Value); // Kd
+				    		   + (de * (DS32)MIX_Params.RegConstKp // Kp
+				               + dev * (DS32)MIX_Params.RegConstKi // Ki
+				               + (de - deold) * (DS32)MIX_Params.RegConstKd); // Kd
 
 		            change = (temp + MIX_reg_divide/2L)/MIX_reg_divide;
 
@@ -3567,8 +3538,8 @@ static void MIX_Control(const DU8 sig, DU8 mixer)
 		        	if (StepperPositionSetpoint < 0)
 		        		StepperPositionSetpoint = 0;
 
-		        	if (StepperPositionSetpoint > (DS32)PARA[ParRefInd[TEC_MAX_FLOW__PARREFIND]].Value)
-		        		StepperPositionSetpoint = (DS32)PARA[ParRefInd[TEC_MAX_FLOW__PARREFIND]].Value;
+		        	if (StepperPositionSetpoint > (DS32)MIX_Params.TecMaxFlow)
+		        		StepperPositionSetpoint = (DS32)MIX_Params.TecMaxFlow;
 		        }
 		        else if(!tecjet[TECJET_1].Option && tecjet[TECJET_2].Option)
 		        {
@@ -3576,8 +3547,8 @@ static void MIX_Control(const DU8 sig, DU8 mixer)
 		        	if (StepperPositionSetpoint < 0)
 		        		StepperPositionSetpoint = 0;
 
-		        	if (StepperPositionSetpoint > (DS32)PARA[ParRefInd[TEC_2_MAX_FLOW__PARREFIND]].Value)
-		        		StepperPositionSetpoint = (DS32)PARA[ParRefInd[TEC_2_MAX_FLOW__PARREFIND]].Value;
+		        	if (StepperPositionSetpoint > (DS32)MIX_Params.Tec2MaxFlow)
+		        		StepperPositionSetpoint = (DS32)MIX_Params.Tec2MaxFlow;
 		        }
 		        else
 		        {
@@ -3669,7 +3640,7 @@ static void MIX_Control(const DU8 sig, DU8 mixer)
 	            	/* removed for test 24.07.2015 MVO
 					MIX.LambdaSetpointTecJet = Interpolate(MIX.SetpointMixerPosition[mixer],
 														   0,
-														   PARA[ParRefInd[MIX_MAX_NUMBER_OF_STEPS__PARREFIND]].Value,
+														   PAR_VALUE(MIX_MAX_NUMBER_OF_STEPS__PARREFIND),
 														   PARA[ParRefInd[TEC_LAMBDA_SETPOINT_FULL_LOAD__PARREFIND]].MaxValue,
 														   PARA[ParRefInd[TEC_LAMBDA_SETPOINT_FULL_LOAD__PARREFIND]].MinValue);
 					*/
@@ -3820,7 +3791,7 @@ static void MIX_UnderTest(const DU8 sig, DU8 mixer)
 
 		default:
 
-            if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 0L)
+            if (MIX_Params.OptionLambdaControl == 0L)
 			{
 			  // no emission control
 			  Transit(MIX_StartPositionReached, mixer);
@@ -3828,7 +3799,7 @@ static void MIX_UnderTest(const DU8 sig, DU8 mixer)
 			}
 			
 			if (mixer == MixerInd2)
-			if (!PARA[ParRefInd[MIX_SECOND_MIXER__PARREFIND]].Value || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
+			if (!MIX_Params.SecondMixer || (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT].Assigned == ASSIGNED))
 			{
 			  Transit(MIX_StartPositionReached, mixer);
 			  break;
@@ -3961,7 +3932,7 @@ static void MIX_UnderTest(const DU8 sig, DU8 mixer)
 			    else if ( (MIX.GasMixerDirectionRichTestDemand[mixer] )
 			         // rich is requested
 			    	&& (!MIX.DI_LimitStopRich || DI_FUNCT[MIXER_LIMIT_RICH].Assigned == NOT_ASSIGNED)
-			    	&& (MIX.ActualPositionOfGasMixer[mixer] < (DS32)PARA[ParRefInd[MIX_MAX_NUMBER_OF_STEPS__PARREFIND]].Value) )
+			    	&& (MIX.ActualPositionOfGasMixer[mixer] < (DS32)MIX_Params.MaxNumberOfSteps) )
 			    {
 			    	if ((MIX.ActualPositionOfGasMixer[mixer] ==  MIX.SetpointMixerPosition[mixer]) || MAIN.Simulation)
 			    	{
@@ -3970,8 +3941,8 @@ static void MIX_UnderTest(const DU8 sig, DU8 mixer)
 			    			MIX.SetpointMixerPosition[mixer] = MIX.SetpointMixerPosition[mixer] + BigSteps;
 			    		else
 			    		    MIX.SetpointMixerPosition[mixer] = MIX.SetpointMixerPosition[mixer] + NumberOfSteps;
-			    		if (MIX.SetpointMixerPosition[mixer] > (DS16)PARA[ParRefInd[MIX_MAX_NUMBER_OF_STEPS__PARREFIND]].Value)
-			    			MIX.SetpointMixerPosition[mixer] = (DS16)PARA[ParRefInd[MIX_MAX_NUMBER_OF_STEPS__PARREFIND]].Value;
+			    		if (MIX.SetpointMixerPosition[mixer] > (DS16)MIX_Params.MaxNumberOfSteps)
+			    			MIX.SetpointMixerPosition[mixer] = (DS16)MIX_Params.MaxNumberOfSteps;
 			    	}
 			    }
 			    else if (STOP_is_Set(STOPCONDITION_20099) && //test operation
@@ -4022,7 +3993,7 @@ void MIX_control_20ms(void)
 	DS32 DKFactor;						//
 	DS32 LoadDependentPart;				// 0...3600000 = 0...3600 Nm³/h additional flow
 
-	if (PARA[ParRefInd[MIX_OPTION_RECEIV_PRESS_SENSOR__PARREFIND]].Value)
+	if (MIX_Params.OptionReceivPressSensor)
 	{
 		DS32 value_4mA;
 		DS32 value_20mA;
@@ -4030,13 +4001,13 @@ void MIX_control_20ms(void)
 		// wire break for receiver pressure
 		if (AI_I_FUNCT[RECEIVER_PRESSURE].Assigned == ASSIGNED)
 		{
-			if( MIX.AI_I_ReceiverPressure > (DS16)PARA[ParRefInd[MIX_RECEIV_PRESS_WIREBREAK__PARREFIND]].Value )
+			if( MIX.AI_I_ReceiverPressure > (DS16)MIX_Params.ReceivPressWirebreak )
 			{
 			  // no wire break
-			  STOP_Tripped[STOPCONDITION_70237] = FALSE; // can be acknowledged
+			  STOP_SetTripped(STOPCONDITION_70237, FALSE); // can be acknowledged
 
-			  value_4mA  = PARA[ParRefInd[MIX_RECEIV_PRESS_VALUE_FOR_4mA__PARREFIND]].Value + PAR_OFFSET_REC_PRESS_SENSOR;
-			  value_20mA = PARA[ParRefInd[MIX_RECEIV_PRESS_VALUE_FOR_20mA__PARREFIND]].Value + PAR_OFFSET_REC_PRESS_SENSOR;
+			  value_4mA  = MIX_Params.ReceivPressValueFor4mA + PAR_OFFSET_REC_PRESS_SENSOR;
+			  value_20mA = MIX_Params.ReceivPressValueFor20mA + PAR_OFFSET_REC_PRESS_SENSOR;
 
 			  MIX.ReceiverPressure = value_4mA
 						+ ( (DS32) MIX.AI_I_ReceiverPressure - 5000L )
@@ -4048,21 +4019,21 @@ void MIX_control_20ms(void)
 			  // wire break
 			  MIX.ReceiverPressure = -32768; // is this a good idea?
 			  STOP_Set(STOPCONDITION_70237);
-			  STOP_Tripped[STOPCONDITION_70237] = TRUE; // tripped = cannot be acknowledged
+			  STOP_SetTripped(STOPCONDITION_70237, TRUE); // tripped = cannot be acknowledged
 			}
 		}
-		else STOP_Tripped[STOPCONDITION_70237] = FALSE; // can be acknowledged
+		else STOP_SetTripped(STOPCONDITION_70237, FALSE); // can be acknowledged
 
 		// Receiver pressure B
 		if (AI_I_FUNCT[IOA_AI_I_MIX_RECEIVER_PRESSURE_B].Assigned == ASSIGNED)
 		{
-			if( MIX.AI_I_ReceiverPressureB > (DS16)PARA[ParRefInd[MIX_RECEIV_PRESS_WIREBREAK__PARREFIND]].Value )
+			if( MIX.AI_I_ReceiverPressureB > (DS16)MIX_Params.ReceivPressWirebreak )
 			{
 			  // no wire break
-			  STOP_Tripped[STOPCONDITION_70246] = FALSE;
+			  STOP_SetTripped(STOPCONDITION_70246, FALSE);
 
-			  value_4mA  = PARA[ParRefInd[MIX_RECEIV_PRESS_VALUE_FOR_4mA__PARREFIND]].Value + PAR_OFFSET_REC_PRESS_SENSOR;
-			  value_20mA = PARA[ParRefInd[MIX_RECEIV_PRESS_VALUE_FOR_20mA__PARREFIND]].Value + PAR_OFFSET_REC_PRESS_SENSOR;
+			  value_4mA  = MIX_Params.ReceivPressValueFor4mA + PAR_OFFSET_REC_PRESS_SENSOR;
+			  value_20mA = MIX_Params.ReceivPressValueFor20mA + PAR_OFFSET_REC_PRESS_SENSOR;
 
 			  MIX.ReceiverPressureB = value_4mA
 						+ ( (DS32) MIX.AI_I_ReceiverPressureB - 5000L )
@@ -4074,15 +4045,15 @@ void MIX_control_20ms(void)
 			  // wire break
 			  MIX.ReceiverPressureB = -32768;
 			  STOP_Set(STOPCONDITION_70246);
-			  STOP_Tripped[STOPCONDITION_70246] = TRUE;
+			  STOP_SetTripped(STOPCONDITION_70246, TRUE);
 			}
 		}
-		else STOP_Tripped[STOPCONDITION_70246] = FALSE;
+		else STOP_SetTripped(STOPCONDITION_70246, FALSE);
 	}
 	else
 	{
-		STOP_Tripped[STOPCONDITION_70237] = FALSE;
-		STOP_Tripped[STOPCONDITION_70246] = FALSE;
+		STOP_SetTripped(STOPCONDITION_70237, FALSE);
+		STOP_SetTripped(STOPCONDITION_70246, FALSE);
 	}
 
 	// calculate filtered value MIX.ReceiverPressureFilteredValue from MIX.ReceiverPressure
@@ -4175,8 +4146,8 @@ void MIX_control_20ms(void)
 	}
 	if(tecjet[TECJET_1].Option && tecjet[TECJET_2].Option)
 	{
-		MIX.Tecjet_Fraction_1 = (DS32)PARA[ParRefInd[TEC_MAX_FLOW__PARREFIND]].Value * 100 / ((MIX.Tecjet_Max_Flow_Rate + 5)/ 10);
-		MIX.Tecjet_Fraction_2 = (DS32)PARA[ParRefInd[TEC_2_MAX_FLOW__PARREFIND]].Value * 100 / ((MIX.Tecjet_Max_Flow_Rate + 5)/ 10);
+		MIX.Tecjet_Fraction_1 = (DS32)MIX_Params.TecMaxFlow * 100 / ((MIX.Tecjet_Max_Flow_Rate + 5)/ 10);
+		MIX.Tecjet_Fraction_2 = (DS32)MIX_Params.Tec2MaxFlow * 100 / ((MIX.Tecjet_Max_Flow_Rate + 5)/ 10);
 	}
 
 	  if (MIX_OPTION_TECJET)
@@ -4212,14 +4183,14 @@ void MIX_control_20ms(void)
 
 		  SetpointMixerPositionRelative =										// 0...10000 = 0...100%
 				(DS32)MIX.SetpointMixerPosition[MixerInd1]	* 10000L		// Setpoint [steps]
-				/ PARA[ParRefInd[MIX_MAX_NUMBER_OF_STEPS__PARREFIND]].Value;// parameter in steps
+				/ MIX_Params.MaxNumberOfSteps;// parameter in steps
 
 		  SpeedRelative = 													// 0...15000 = 0...150%
 				(DS32)ENG.S200EngineSpeed * 10000							// S200 [0.1rpm]
 				/ (TUR.NominalSpeed / 100);	// parameter in mrpm
 #if (CLIENT_VERSION == IET)
 		  SpeedSetRelative = TUR.GovernorAnalogOutputInternal
-				/ (DS16)PARA[ParRefInd[NUMBER_OF_TEETH_AT_FLYWHEEL__PARREFIND]].Value * 150;
+				/ (DS16)MIX_Params.NumberOfTeethAtFlywheel * 150;
 
 //		  if(tecjet[TECJET_1].Option)
 //		  {
@@ -4252,11 +4223,11 @@ void MIX_control_20ms(void)
 		  /*
 			LoadDependentPart =													// 0...3600000 = 0...3600Nm³/h
 				ELM.T1E.sec.Psum * 10 										// Psum[W]
-				/(DS32)PARA[ParRefInd[TEC_HEAT_VALUE__PARREFIND]].Value; 	//Parameter [0.1kWh/Nm³]
+				/(DS32)PAR_VALUE(TEC_HEAT_VALUE__PARREFIND); 	//Parameter [0.1kWh/Nm³]
 		   */
 		  LoadDependentPart =
 				TUR.Reg.PowerSetPoint * 10
-				/ (DS32)PARA[ParRefInd[TEC_HEAT_VALUE__PARREFIND]].Value; 	//Parameter [0.1kWh/Nm³]
+				/ (DS32)MIX_Params.TecHeatValue; 	//Parameter [0.1kWh/Nm³]
 
 		  if (LoadDependentPart < 0) LoadDependentPart = 0;					// limitation with reverse power
 		  MIX.TecJetDiagnosticsLoadDependentPart = LoadDependentPart;			// save temp value for diagnostics
@@ -4279,7 +4250,7 @@ void MIX_control_20ms(void)
 			  }
 			  else
 			  {
-				  tecjet[TECJET_1].write.FuelFlowRate = MIX.Flow / ((DF32)PARA[ParRefInd[TEC_LAMBDA_SETPOINT_0kW__PARREFIND]].Value * CALCULATION_FACTOR + 1) * TEMP_COMPENSATION_1;
+				  tecjet[TECJET_1].write.FuelFlowRate = MIX.Flow / ((DF32)MIX_Params.TecLambdaSetpoint0kW * CALCULATION_FACTOR + 1) * TEMP_COMPENSATION_1;
 			  }
 			  */
 
@@ -4292,7 +4263,7 @@ void MIX_control_20ms(void)
 #else
 					 + (DS32)((TUR.IOM_GOV_Out-5000)/2 - 5000) // Always use throttle position setpoint
 #endif
-					 * (DS32)PARA[ParRefInd[MIX_DK_DEPENDENCY_TECJET__PARREFIND]].Value / 5000;
+					 * (DS32)MIX_Params.DkDependencyTecjet / 5000;
 
 			  if (DKFactor < 0)
 				  DKFactor = 0;
@@ -4323,7 +4294,7 @@ void MIX_control_20ms(void)
 		  {
 
 			  // removed:
-			  // tecjet[TECJET_1].write.FuelFlowRate = MIX.Flow / ((DF32)PARA[ParRefInd[TEC_LAMBDA_SETPOINT_0kW__PARREFIND]].Value * CALCULATION_FACTOR + 1) * TEMP_COMPENSATION_1;
+			  // tecjet[TECJET_1].write.FuelFlowRate = MIX.Flow / ((DF32)PAR_VALUE(TEC_LAMBDA_SETPOINT_0kW__PARREFIND) * CALCULATION_FACTOR + 1) * TEMP_COMPENSATION_1;
 
 			  // use actual throttle position for DKFactor
 			  DKFactor = 10000L
@@ -4332,7 +4303,7 @@ void MIX_control_20ms(void)
 #else
 					 + (DS32)((TUR.IOM_GOV_Out-5000)/2 - 5000) // Always use throttle position setpoint
 #endif
-					 * (DS32)PARA[ParRefInd[MIX_DK_DEPENDENCY_TECJET__PARREFIND]].Value / 5000;
+					 * (DS32)MIX_Params.DkDependencyTecjet / 5000;
 
 			  if (DKFactor < 0)
 				  DKFactor = 0;
@@ -4375,8 +4346,8 @@ void MIX_control_20ms(void)
 			  tecjet[TECJET_1].write.FuelFlowRate = (DF32)MIX.Flow / (Interpolate(ELM.T1E.sec.PsumRelative,
 																				  0,
 																				  10000,
-																				  PARA[ParRefInd[TEC_LAMBDA_SETPOINT_0kW__PARREFIND]].Value,
-																				  PARA[ParRefInd[TEC_LAMBDA_SETPOINT_FULL_LOAD__PARREFIND]].Value)
+																				  PAR_VALUE(TEC_LAMBDA_SETPOINT_0kW__PARREFIND),
+																				  PAR_VALUE(TEC_LAMBDA_SETPOINT_FULL_LOAD__PARREFIND))
 																				  * CALCULATION_FACTOR + 1) * TEMP_COMPENSATION_1;
 				*/
 			  // test MVO 22072015
@@ -4388,7 +4359,7 @@ void MIX_control_20ms(void)
 #else
 					 + (DS32)((TUR.IOM_GOV_Out-5000)/2 - 5000) // Always use throttle position setpoint
 #endif
-					 * (DS32)PARA[ParRefInd[MIX_DK_DEPENDENCY_TECJET__PARREFIND]].Value / 5000;
+					 * (DS32)MIX_Params.DkDependencyTecjet / 5000;
 
 			  if (DKFactor < 0)
 				  DKFactor = 0;
@@ -4438,7 +4409,7 @@ void MIX_control_20ms(void)
 #else
 					 + (DS32)((TUR.IOM_GOV_Out-5000)/2 - 5000) // Always use throttle position setpoint
 #endif
-					 * (DS32)PARA[ParRefInd[MIX_DK_DEPENDENCY_TECJET__PARREFIND]].Value / 5000;
+					 * (DS32)MIX_Params.DkDependencyTecjet / 5000;
 
 			  if (DKFactor < 0)
 				  DKFactor = 0;
@@ -4499,7 +4470,7 @@ void MIX_control_100ms(void)
 	DU16 StopCondInd2;
 
 	// CUMMINS
-	if (PARA[ParRefInd[CUMMINS_OPTION__PARREFIND]].Value AND (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT_2].Assigned == ASSIGNED))
+	if (MIX_Params.CumminsOption AND (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT_2].Assigned == ASSIGNED))
 	{
 		MIX.GasMixerPercent_Cummins = (DS32)(MIX.AO_GasMixer[MixerInd1] - MIX.AnalogOutZero) * 10000 / MIX.MixerFullRange_Out;
 	}
@@ -4513,11 +4484,11 @@ void MIX_control_100ms(void)
 		MIX.ReceiverTemperature_Available = TRUE;
 		MIX.ReceiverTemperature.Value = io_calculate_AI_R_U_value( RECEIVER_TEMP,
 																	MIX.ReceiverTemperature.Raw,
-																	PARA[ParRefInd[MIX_OPTION_RECEIV_TEMP_SENSOR__PARREFIND]].Value,
+																	MIX_Params.OptionReceivTempSensor,
 																	STOPCONDITION_70226,
 																	STOPCONDITION_70227 );
 	}
-	else if ((AI_I_FUNCT[IOA_AI_I_MIX_RECEIVER_TEMP].Assigned == ASSIGNED) && PARA[ParRefInd[MIX_OPTION_RECEIV_TEMP_SENSOR__PARREFIND]].Value)
+	else if ((AI_I_FUNCT[IOA_AI_I_MIX_RECEIVER_TEMP].Assigned == ASSIGNED) && MIX_Params.OptionReceivTempSensor)
 	{
 		MIX.ReceiverTemperature_Available = TRUE;
 		MIX.ReceiverTemperature.Value = io_calculate_AI_I_value( IOA_AI_I_MIX_RECEIVER_TEMP,
@@ -4530,8 +4501,8 @@ void MIX_control_100ms(void)
 	}
 	else
 	{
-		STOP_Tripped[STOPCONDITION_70226] = FALSE;
-		STOP_Tripped[STOPCONDITION_70227] = FALSE;
+		STOP_SetTripped(STOPCONDITION_70226, FALSE);
+		STOP_SetTripped(STOPCONDITION_70227, FALSE);
 		MIX.ReceiverTemperature_Available = FALSE;
 		MIX.ReceiverTemperature.Value = 0;
 	}
@@ -4542,7 +4513,7 @@ void MIX_control_100ms(void)
 	  if (HVS.stateT1E != HVS_T1E_IS_ON)
 	  		TDiff = 0;
 	  else if (MIX.ReceiverTemperature_Available)
-	  		TDiff = MIX.ReceiverTemperature.Value - (DS16)PARA[ParRefInd[MIX_LOAD_RED_RECEIVER_TEMP_START_VALUE__PARREFIND]].Value;
+	  		TDiff = MIX.ReceiverTemperature.Value - (DS16)MIX_Params.LoadRedReceiverTempStartValue;
 	  else
 	  		TDiff = 0;
 
@@ -4550,18 +4521,18 @@ void MIX_control_100ms(void)
 	  // if the temperature is above the maximum: calculate load reduction
 	  if (TDiff > 0)
 	  {
-	  	 reduction  = (DS32)(TDiff) * (PARA[ParRefInd[MIX_LOAD_RED_RECEIVER_TEMP_RAMP__PARREFIND]].Value);
+	  	 reduction  = (DS32)(TDiff) * (MIX_Params.LoadRedReceiverTempRamp);
 
 	  	 // limit MaxPower to zero
-	  	 if ( reduction > PARA[ParRefInd[GEN_NOMINAL_LOAD__PARREFIND]].Value )
+	  	 if ( reduction > MIX_Params.GenNominalLoad )
 	  	   MIX.MaxPower_Temp = 0;
 	  	 else
-	  	   MIX.MaxPower_Temp =   PARA[ParRefInd[GEN_NOMINAL_LOAD__PARREFIND]].Value - reduction;
+	  	   MIX.MaxPower_Temp =   MIX_Params.GenNominalLoad - reduction;
 	  }
 	  else
 	  {
 	  	 reduction = 0L;
-	    MIX.MaxPower_Temp = PARA[ParRefInd[GEN_NOMINAL_LOAD__PARREFIND]].Value; // set to nominal power, no load reduction
+	    MIX.MaxPower_Temp = MIX_Params.GenNominalLoad; // set to nominal power, no load reduction
 	  }
 
   // not if TecJet
@@ -4569,23 +4540,24 @@ void MIX_control_100ms(void)
   
   // only for mixer one if analog feedback is assigned
   MIX_PositionDeviation();
+  PROT_control(MIX_Protection_100ms, MIX_NBR_OF_PROTECTIONS_100MS);
 
   // maximum control deviation
   MIX_ControlDeviation();
 
   if (MIX_OPTION_TECJET)
   {
-	  MIX.MixerFullRange_In = (DS32)PARA[ParRefInd[MIX_MAX_NUMBER_OF_STEPS__PARREFIND]].Value;
+	  MIX.MixerFullRange_In = (DS32)MIX_Params.MaxNumberOfSteps;
 
 	  MIX.MixerFullRange_Out = MIX.MixerFullRange_In;
 
       if (tecjet[TECJET_1].Option)
       {
-          MIX.ActualPositionOfGasMixer[MixerInd1] = (DF32)tecjet[TECJET_1].read.ActualFuelValvePosition/250*PARA[ParRefInd[MIX_MAX_NUMBER_OF_STEPS__PARREFIND]].Value;
+          MIX.ActualPositionOfGasMixer[MixerInd1] = (DF32)tecjet[TECJET_1].read.ActualFuelValvePosition/250*MIX_Params.MaxNumberOfSteps;
       }
       else if (tecjet[TECJET_2].Option)
       {
-          MIX.ActualPositionOfGasMixer[MixerInd1] = (DF32)tecjet[TECJET_2].read.ActualFuelValvePosition/250*PARA[ParRefInd[MIX_MAX_NUMBER_OF_STEPS__PARREFIND]].Value;
+          MIX.ActualPositionOfGasMixer[MixerInd1] = (DF32)tecjet[TECJET_2].read.ActualFuelValvePosition/250*MIX_Params.MaxNumberOfSteps;
       }
   }
   else
@@ -4594,7 +4566,7 @@ void MIX_control_100ms(void)
   {
 	  DS32 Value;
 
-	  if (PARA[ParRefInd[CUMMINS_OPTION__PARREFIND]].Value) // For CUMMINS
+	  if (MIX_Params.CumminsOption) // For CUMMINS
 	  {
 		  if (!ENG.Running)
 		  {
@@ -4618,8 +4590,8 @@ void MIX_control_100ms(void)
 			  case MIX_IDLE_POSITION_REACHED:
 				  Offset = 0;
 				  OffsetBegin = MIX.AO_GasMixer[MixerInd1] - MIX.AnalogOutZero;
-				  x1 = PARA[ParRefInd[CUMMINS_THROTTLE_LOW_IDLE__PARREFIND]].Value;
-				  x2 = PARA[ParRefInd[CUMMINS_THROTTLE_NOMINAL__PARREFIND]].Value;
+				  x1 = MIX_Params.CumminsThrottleLowIdle;
+				  x2 = MIX_Params.CumminsThrottleNominal;
 				  y1 = Mix_Calculate_Setpoint_For_Mixer_Position(MIX_START_POS_A__PARREFIND, MIX_START_POS_B__PARREFIND);
 				  y2 = Mix_Calculate_Setpoint_For_Mixer_Position(MIX_IDLE_POS_A__PARREFIND,  MIX_IDLE_POS_B__PARREFIND);
 				  break;
@@ -4630,8 +4602,8 @@ void MIX_control_100ms(void)
 			  case MIX_ISLAND_POSITION_REACHED:
 				  Offset = 0;
 				  OffsetBegin = MIX.AO_GasMixer[MixerInd1] - MIX.AnalogOutZero;
-				  x1 = PARA[ParRefInd[CUMMINS_THROTTLE_NOMINAL__PARREFIND]].Value;
-				  x2 = PARA[ParRefInd[CUMMINS_THROTTLE_LOAD__PARREFIND]].Value;
+				  x1 = MIX_Params.CumminsThrottleNominal;
+				  x2 = MIX_Params.CumminsThrottleLoad;
 				  y1 = Mix_Calculate_Setpoint_For_Mixer_Position(MIX_IDLE_POS_A__PARREFIND,  MIX_IDLE_POS_B__PARREFIND);
 				  y2 = Mix_Calculate_Setpoint_For_Mixer_Position(MIX_PARALLEL_POS_A__PARREFIND, MIX_PARALLEL_POS_B__PARREFIND);
 				  break;
@@ -4640,8 +4612,8 @@ void MIX_control_100ms(void)
 			  // Under configuration
 			  case MIX_UNDER_TEST:
 				  Offset = MIX.SetpointMixerPosition[MixerInd1] - OffsetBegin;
-				  x1 = PARA[ParRefInd[CUMMINS_THROTTLE_NOMINAL__PARREFIND]].Value;
-				  x2 = PARA[ParRefInd[CUMMINS_THROTTLE_LOAD__PARREFIND]].Value;
+				  x1 = MIX_Params.CumminsThrottleNominal;
+				  x2 = MIX_Params.CumminsThrottleLoad;
 				  y1 = Mix_Calculate_Setpoint_For_Mixer_Position(MIX_IDLE_POS_A__PARREFIND,  MIX_IDLE_POS_B__PARREFIND);
 				  y2 = Mix_Calculate_Setpoint_For_Mixer_Position(MIX_PARALLEL_POS_A__PARREFIND, MIX_PARALLEL_POS_B__PARREFIND);
 				  break;
@@ -4673,7 +4645,7 @@ void MIX_control_100ms(void)
 	  if (AO_FUNCT[IOA_AO_MIX_GASMIXER_SETPOINT_2].Assigned == ASSIGNED)
 		  MIX.AO_GasMixer[MixerInd2] = MIX.AO_GasMixer[MixerInd1];
 
-	  MIX.MixerFullRange_In = (DS32)PARA[ParRefInd[MIX_FEEDBACK_AT_100_PERCENT__PARREFIND]].Value - (DS32)PARA[ParRefInd[MIX_FEEDBACK_AT_0_PERCENT__PARREFIND]].Value;
+	  MIX.MixerFullRange_In = (DS32)MIX_Params.FeedbackAt100Percent - (DS32)MIX_Params.FeedbackAt0Percent;
 
 	  MIX.MixerFullRange_Out = MIX_ANALOG_OUT_FULL - MIX.AnalogOutZero;
 
@@ -4684,7 +4656,7 @@ void MIX_control_100ms(void)
 		  static DS16 Pos[10];
 		  DS32 PosSum;
 
-		  UnfilteredValue = (DS32)MIX.AI_I_GasMixerPos - (DS32)PARA[ParRefInd[MIX_FEEDBACK_AT_0_PERCENT__PARREFIND]].Value;
+		  UnfilteredValue = (DS32)MIX.AI_I_GasMixerPos - (DS32)MIX_Params.FeedbackAt0Percent;
 
 		  // calculate filtered value
 		  PosSum = 0L;
@@ -4707,14 +4679,14 @@ void MIX_control_100ms(void)
   // gas mixer with stepper-motor-control
   // -> feedback from IOM
   {
-	  MIX.MixerFullRange_In = (DS32)PARA[ParRefInd[MIX_MAX_NUMBER_OF_STEPS__PARREFIND]].Value;
+	  MIX.MixerFullRange_In = (DS32)MIX_Params.MaxNumberOfSteps;
 
 	  MIX.MixerFullRange_Out = MIX.MixerFullRange_In;
 
 	  MIX.ActualPositionOfGasMixer[MixerInd1] = MIX.StepperMotor[MixerInd1].actualPosition;
   }
 
-  if (PARA[ParRefInd[MIX_SECOND_MIXER__PARREFIND]].Value)
+  if (MIX_Params.SecondMixer)
       MIX.ActualPositionOfGasMixer[MixerInd2] = MIX.StepperMotor[MixerInd2].actualPosition;
 
   // gas mixer with analogue setpoint control for air
@@ -4725,16 +4697,16 @@ void MIX_control_100ms(void)
 	  Value = (DS16)Interpolate(
 			  ELM.T1E.sec.PsumRelative,
 			  0L,
-			  PARA[ParRefInd[MIX_AIR_LOAD_AT_MAX_POS__PARREFIND]].Value,
-			  PARA[ParRefInd[MIX_AIR_MIN_POS__PARREFIND]].Value + MIX.AnalogOutZero,
-			  PARA[ParRefInd[MIX_AIR_MAX_POS__PARREFIND]].Value + MIX.AnalogOutZero);
+			  MIX_Params.AirLoadAtMaxPos,
+			  MIX_Params.AirMinPos + MIX.AnalogOutZero,
+			  MIX_Params.AirMaxPos + MIX.AnalogOutZero);
 
 	  // Limitation
-	  if (Value < (PARA[ParRefInd[MIX_AIR_MIN_POS__PARREFIND]].Value + MIX.AnalogOutZero))
-		  MIX.AO_AirMixer = (PARA[ParRefInd[MIX_AIR_MIN_POS__PARREFIND]].Value + MIX.AnalogOutZero);
+	  if (Value < (MIX_Params.AirMinPos + MIX.AnalogOutZero))
+		  MIX.AO_AirMixer = (MIX_Params.AirMinPos + MIX.AnalogOutZero);
 	  else
-	  if (Value > (PARA[ParRefInd[MIX_AIR_MAX_POS__PARREFIND]].Value + MIX.AnalogOutZero))
-		  MIX.AO_AirMixer = (PARA[ParRefInd[MIX_AIR_MAX_POS__PARREFIND]].Value + MIX.AnalogOutZero);
+	  if (Value > (MIX_Params.AirMaxPos + MIX.AnalogOutZero))
+		  MIX.AO_AirMixer = (MIX_Params.AirMaxPos + MIX.AnalogOutZero);
 	  else
 		  MIX.AO_AirMixer = Value;
 
@@ -4749,7 +4721,7 @@ void MIX_control_100ms(void)
 		&& (!STOP_is_Set(STOPCONDITION_70235)) //timeout island position reached
 		&& (!STOP_is_Set(STOPCONDITION_70236)) //timeout rich position reached
 		&& (!STOP_is_Set(STOPCONDITION_70224)) //steps missing
-		&& ( CalibrationDoneCounter[MixerInd1] < (DU32)PARA[ParRefInd[MIX_TIMER_NEXT_CALIBRATION_NECESSARY__PARREFIND]].Value ) )
+		&& ( CalibrationDoneCounter[MixerInd1] < (DU32)MIX_Params.TimerNextCalibrationNecessary ) )
 	{
 		CalibrationDoneCounter[MixerInd1] += 100L;
 	}
@@ -4769,7 +4741,7 @@ void MIX_control_100ms(void)
     	&& (!STOP_is_Set(STOPCONDITION_70712)) //timeout island position reached
     	&& (!STOP_is_Set(STOPCONDITION_70713)) //timeout rich position reached
     	&& (!STOP_is_Set(STOPCONDITION_70715)) //steps missing
-    	&& ( CalibrationDoneCounter[MixerInd2] < (DU32)PARA[ParRefInd[MIX_TIMER_NEXT_CALIBRATION_NECESSARY__PARREFIND]].Value ) )
+    	&& ( CalibrationDoneCounter[MixerInd2] < (DU32)MIX_Params.TimerNextCalibrationNecessary ) )
     {
     	CalibrationDoneCounter[MixerInd2] += 100L;
     }
@@ -4787,19 +4759,19 @@ void MIX_control_100ms(void)
     	    // calculate lambdavoltage
     	    MIX.LambdaVoltage = MIX.AI_I_LambdaVoltage;
     	    // make stop condition wire break acknowledgeable
-    	    STOP_Tripped[STOPCONDITION_70225] = FALSE;
+    	    STOP_SetTripped(STOPCONDITION_70225, FALSE);
         }
         else
         {
     	    // wire break    
     	    STOP_Set(STOPCONDITION_70225);              // set stop condition for wire break
-    	    STOP_Tripped[STOPCONDITION_70225] = TRUE;   // set stop condition to tripped
+    	    STOP_SetTripped(STOPCONDITION_70225, TRUE);   // set stop condition to tripped
         }
     }
     else
     {
         // not assigned or option not selected
-        STOP_Tripped[STOPCONDITION_70225] = FALSE;
+        STOP_SetTripped(STOPCONDITION_70225, FALSE);
         MIX.LambdaVoltage = 0;
     }
       
@@ -4823,44 +4795,44 @@ void MIX_control_100ms(void)
     // stop condition for mixture temperature
     if (HVS.stateT1E != HVS_T1E_IS_ON)
     {
-    	STOP_Tripped[STOPCONDITION_70229] = FALSE;
-    	STOP_Tripped[STOPCONDITION_70230] = FALSE;
+    	STOP_SetTripped(STOPCONDITION_70229, FALSE);
+    	STOP_SetTripped(STOPCONDITION_70230, FALSE);
     }
     else if ( (MIX.ReceiverTemperature_Available)
-          && (PARA[ParRefInd[MIX_OPTION_RECEIV_TEMP_SENSOR__PARREFIND]].Value) )
+          && (MIX_Params.OptionReceivTempSensor) )
     {
 	    //over temperature mixture
-	    if (MIX.ReceiverTemperature.Value >= (DS16)PARA[ParRefInd[MIX_MAX_TEMP_MIXTURE__PARREFIND]].Value)
+	    if (MIX.ReceiverTemperature.Value >= (DS16)MIX_Params.MaxTempMixture)
 	    {
 	    	STOP_Set(STOPCONDITION_70229);
-	    	STOP_Tripped[STOPCONDITION_70229] = TRUE;
+	    	STOP_SetTripped(STOPCONDITION_70229, TRUE);
 	    }
-	    else if (MIX.ReceiverTemperature.Value < ((DS16)PARA[ParRefInd[MIX_MAX_TEMP_MIXTURE__PARREFIND]].Value - MIX_RECOVER_TEMP_HYST))
+	    else if (MIX.ReceiverTemperature.Value < ((DS16)MIX_Params.MaxTempMixture - MIX_RECOVER_TEMP_HYST))
 	    {
-	    	STOP_Tripped[STOPCONDITION_70229] = FALSE;
+	    	STOP_SetTripped(STOPCONDITION_70229, FALSE);
 	    }
 	    //under temperature mixture
-		if (ELM.T1E.sec.PsumRelative >= (DS16)PARA[ParRefInd[MIX_RELEASE_POWER_CONTROL__PARREFIND]].Value)
+		if (ELM.T1E.sec.PsumRelative >= (DS16)MIX_Params.ReleasePowerControl)
 		{    
-		    if (MIX.ReceiverTemperature.Value <= (DS16)PARA[ParRefInd[MIX_MIN_TEMP_MIXTURE__PARREFIND]].Value)
+		    if (MIX.ReceiverTemperature.Value <= (DS16)MIX_Params.MinTempMixture)
 		    {
 		    	STOP_Set(STOPCONDITION_70230);
-		    	STOP_Tripped[STOPCONDITION_70230] = TRUE;
+		    	STOP_SetTripped(STOPCONDITION_70230, TRUE);
 		    }
-		    else if (MIX.ReceiverTemperature.Value > ((DS16)PARA[ParRefInd[MIX_MIN_TEMP_MIXTURE__PARREFIND]].Value + MIX_RECOVER_TEMP_HYST))
+		    else if (MIX.ReceiverTemperature.Value > ((DS16)MIX_Params.MinTempMixture + MIX_RECOVER_TEMP_HYST))
 		    {
-		    	STOP_Tripped[STOPCONDITION_70230] = FALSE;
+		    	STOP_SetTripped(STOPCONDITION_70230, FALSE);
 		    }
 		}
 	    else
 	    {
-	    	STOP_Tripped[STOPCONDITION_70230] = FALSE;
+	    	STOP_SetTripped(STOPCONDITION_70230, FALSE);
 	    }
     }
     else
     {
-    	STOP_Tripped[STOPCONDITION_70229] = FALSE;
-    	STOP_Tripped[STOPCONDITION_70230] = FALSE;
+    	STOP_SetTripped(STOPCONDITION_70229, FALSE);
+    	STOP_SetTripped(STOPCONDITION_70230, FALSE);
     }
 
 
@@ -4899,31 +4871,31 @@ void MIX_control_100ms(void)
 						if (LimitStopLeanTimer[MixerInd] > MIX_TIMEOUT_LEAVING_LEAN_POS)
 						{
 							STOP_Set(StopCondInd1);
-							STOP_Tripped[StopCondInd1] = TRUE;
+							STOP_SetTripped(StopCondInd1, TRUE);
 						}
 					}
 					else
 					{
-						STOP_Tripped[StopCondInd1] = FALSE;
+						STOP_SetTripped(StopCondInd1, FALSE);
 						LimitStopLeanTimer[MixerInd] = 0L;
 					}
 
 				}
 				else
 				{
-					STOP_Tripped[StopCondInd1] = FALSE;
+					STOP_SetTripped(StopCondInd1, FALSE);
 					LimitStopLeanTimer[MixerInd] = 0L;
 				}
 			}
 			else
 			{
-				STOP_Tripped[StopCondInd1] = FALSE;
+				STOP_SetTripped(StopCondInd1, FALSE);
 				LimitStopLeanTimer[MixerInd] = 0L;
 			}
 		}
 		else
 		{
-			STOP_Tripped[StopCondInd1] = FALSE;
+			STOP_SetTripped(StopCondInd1, FALSE);
 			LimitStopLeanTimer[MixerInd] = 0L;
 		}
 
@@ -4944,23 +4916,23 @@ void MIX_control_100ms(void)
 						// or max position reached (this is also interpreted as "limit stop rich reached")
 					{
 						STOP_Set(StopCondInd2);
-						STOP_Tripped[StopCondInd2] = TRUE; // cannot be acknowledged
+						STOP_SetTripped(StopCondInd2, TRUE); // cannot be acknowledged
 					}
 					else
 						// not in position rich
-						STOP_Tripped[StopCondInd2] = FALSE;
+						STOP_SetTripped(StopCondInd2, FALSE);
 				}
 				else
 				// "lean" not reached -> stopcondition can be acknowledged
-				STOP_Tripped[StopCondInd2] = FALSE;
+				STOP_SetTripped(StopCondInd2, FALSE);
 			}
 			else
 				// "lean" not assigned -> stopcondition can be acknowledged
-				STOP_Tripped[StopCondInd2] = FALSE;
+				STOP_SetTripped(StopCondInd2, FALSE);
 		}
 		else
 			// "lean" not assigned -> stopcondition can be acknowledged
-			STOP_Tripped[StopCondInd2] = FALSE;
+			STOP_SetTripped(StopCondInd2, FALSE);
 
 		// activate step counter on IOM
         if (MIX.ActualPositionOfGasMixer[MixerInd] == 0)
@@ -5081,12 +5053,12 @@ void MIX_control_1000ms(void)
     // ******************************************************************************************
     // feed temperature buffer with new values
     // p/T
-    if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 2L)
+    if (MIX_Params.OptionLambdaControl == 2L)
     {
     	TemperatureValue = MIX.ReceiverTemperature.Value;
     }
     // combustion chamber temperature
-    else if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 3L)
+    else if (MIX_Params.OptionLambdaControl == 3L)
     {
 #if (OPTION_CYLINDER_MONITORING == TRUE)
     	TemperatureValue = CYL.TxxxAverageAFilteredValue;
@@ -5143,12 +5115,12 @@ void MIX_control_1000ms(void)
 	// indicate stability globally
 
     // p/T
-    if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 2L)
+    if (MIX_Params.OptionLambdaControl == 2L)
     {
 		MIX.ValuesAreStable = (PowerIsStable && PressureIsStable && TemperatureIsStable);
     }
     // combustion chamber temperature
-    else if (PARA[ParRefInd[MIX_OPTION_LAMBDA_CONTROL__PARREFIND]].Value == 3L)
+    else if (MIX_Params.OptionLambdaControl == 3L)
     {
 		MIX.ValuesAreStable = (PowerIsStable && TemperatureIsStable);
     }
@@ -5160,32 +5132,137 @@ void MIX_control_1000ms(void)
     if (MIX.MixerControlRelease.State == TRIP)
     {
     	// control active -> no power limitation
-    	MIX.MaxPower = PARA[ParRefInd[GEN_NOMINAL_LOAD__PARREFIND]].Value; // full power
+    	MIX.MaxPower = MIX_Params.GenNominalLoad; // full power
     }
     else
     {
-    	MIX.MaxPower = (DS32)PARA[ParRefInd[GEN_NOMINAL_LOAD__PARREFIND]].Value / 100L *
-    			((DS32)PARA[ParRefInd[MIX_RELEASE_POWER_CONTROL__PARREFIND]].Value // [0.01%]
+    	MIX.MaxPower = (DS32)MIX_Params.GenNominalLoad / 100L *
+    			((DS32)MIX_Params.ReleasePowerControl // [0.01%]
 			+ MIX_POWER_OFFSET_PERCENT_IF_BAD_SIGNAL) / 100L;
     }
     // timeout supervision for release of active mixer control
     Mixer_Control_Release_Timeout();
+    PROT_control(MIX_Protection_1000ms, MIX_NBR_OF_PROTECTIONS_1000MS);
+
+    // check max flow rate for tecjet(s) if one of the tecjet options changed
+    // (changes of the max flow parameters are notified by PAR)
+    if (   (tecjet[TECJET_1].Option != TecjetOption[TECJET_1])
+    	|| (tecjet[TECJET_2].Option != TecjetOption[TECJET_2]))
+    	SetMaxFlowRateTecJet();
+}
+
+// copy the parameters used by the control loops into the standby snapshot and switch to it,
+// the preempting 20ms / 100ms task see either the old or the new snapshot as a whole
+void MIX_ReadParameters(void)
+{
+	t_MIX_params *pStandby = (MIX_pParams == &ParamsBuffer[0]) ? &ParamsBuffer[1] : &ParamsBuffer[0];
+	DU32 Seq = PAR_BUILD_BEGIN();
+
+	pStandby->AirLoadAtMaxPos               = PAR_VALUE(MIX_AIR_LOAD_AT_MAX_POS__PARREFIND);
+	pStandby->AirMaxPos                     = PAR_VALUE(MIX_AIR_MAX_POS__PARREFIND);
+	pStandby->AirMinPos                     = PAR_VALUE(MIX_AIR_MIN_POS__PARREFIND);
+	pStandby->ColdStartEnrichment           = PAR_VALUE(MIX_COLD_START_ENRICHMENT__PARREFIND);
+	pStandby->ColdStrtEnriMeasPoint         = PAR_VALUE(MIX_COLD_STRT_ENRI_MEAS_POINT__PARREFIND);
+	pStandby->CylMaxDeviation               = PAR_VALUE(MIX_CYL_MAX_DEVIATION__PARREFIND);
+	pStandby->CylOffsetIsland               = PAR_VALUE(MIX_CYL_OFFSET_ISLAND__PARREFIND);
+	pStandby->DevMaxDp3Sec                  = PAR_VALUE(MIX_DEV_MAX_DP_3SEC__PARREFIND);
+	pStandby->DevMinTime                    = PAR_VALUE(MIX_DEV_MIN_TIME__PARREFIND);
+	pStandby->DkDependencyTecjet            = PAR_VALUE(MIX_DK_DEPENDENCY_TECJET__PARREFIND);
+	pStandby->FeedbackAt0Percent            = PAR_VALUE(MIX_FEEDBACK_AT_0_PERCENT__PARREFIND);
+	pStandby->FeedbackAt100Percent          = PAR_VALUE(MIX_FEEDBACK_AT_100_PERCENT__PARREFIND);
+	pStandby->InvertLambdaRegulation        = PAR_VALUE(MIX_INVERT_LAMBDA_REGULATION__PARREFIND);
+	pStandby->LoadRedReceiverTempRamp       = PAR_VALUE(MIX_LOAD_RED_RECEIVER_TEMP_RAMP__PARREFIND);
+	pStandby->LoadRedReceiverTempStartValue = PAR_VALUE(MIX_LOAD_RED_RECEIVER_TEMP_START_VALUE__PARREFIND);
+	pStandby->MaxDeviation                  = PAR_VALUE(MIX_MAX_DEVIATION__PARREFIND);
+	pStandby->MaxNumberOfSteps              = PAR_VALUE(MIX_MAX_NUMBER_OF_STEPS__PARREFIND);
+	pStandby->MaxTempMixture                = PAR_VALUE(MIX_MAX_TEMP_MIXTURE__PARREFIND);
+	pStandby->MinTempMixture                = PAR_VALUE(MIX_MIN_TEMP_MIXTURE__PARREFIND);
+	pStandby->OffsetIsland                  = PAR_VALUE(MIX_OFFSET_ISLAND__PARREFIND);
+	pStandby->OptionLambdaControl           = PAR_VALUE(MIX_OPTION_LAMBDA_CONTROL__PARREFIND);
+	pStandby->OptionReceivPressSensor       = PAR_VALUE(MIX_OPTION_RECEIV_PRESS_SENSOR__PARREFIND);
+	pStandby->OptionReceivTempSensor        = PAR_VALUE(MIX_OPTION_RECEIV_TEMP_SENSOR__PARREFIND);
+	pStandby->PTFactorA                     = PAR_VALUE(MIX_P_T_FACTOR_A__PARREFIND);
+	pStandby->PTFactorB                     = PAR_VALUE(MIX_P_T_FACTOR_B__PARREFIND);
+	pStandby->ReceivPressValueFor20mA       = PAR_VALUE(MIX_RECEIV_PRESS_VALUE_FOR_20mA__PARREFIND);
+	pStandby->ReceivPressValueFor4mA        = PAR_VALUE(MIX_RECEIV_PRESS_VALUE_FOR_4mA__PARREFIND);
+	pStandby->ReceivPressWirebreak          = PAR_VALUE(MIX_RECEIV_PRESS_WIREBREAK__PARREFIND);
+	pStandby->RegConstKd                    = PAR_VALUE(MIX_REG_CONST_KD__PARREFIND);
+	pStandby->RegConstKi                    = PAR_VALUE(MIX_REG_CONST_KI__PARREFIND);
+	pStandby->RegConstKp                    = PAR_VALUE(MIX_REG_CONST_KP__PARREFIND);
+	pStandby->ReleasePowerControl           = PAR_VALUE(MIX_RELEASE_POWER_CONTROL__PARREFIND);
+	pStandby->RunningTime0To100Percent      = PAR_VALUE(MIX_RUNNING_TIME_0_TO_100_PERCENT__PARREFIND);
+	pStandby->SecondMixer                   = PAR_VALUE(MIX_SECOND_MIXER__PARREFIND);
+	pStandby->SetpointLambda                = PAR_VALUE(MIX_SETPOINT_LAMBDA__PARREFIND);
+	pStandby->SetpointLambdaGasB            = PAR_VALUE(MIX_SETPOINT_LAMBDA_GASB__PARREFIND);
+	pStandby->TimerNextCalibrationNecessary = PAR_VALUE(MIX_TIMER_NEXT_CALIBRATION_NECESSARY__PARREFIND);
+	pStandby->CumminsOption                 = PAR_VALUE(CUMMINS_OPTION__PARREFIND);
+	pStandby->CumminsThrottleLoad           = PAR_VALUE(CUMMINS_THROTTLE_LOAD__PARREFIND);
+	pStandby->CumminsThrottleLowIdle        = PAR_VALUE(CUMMINS_THROTTLE_LOW_IDLE__PARREFIND);
+	pStandby->CumminsThrottleNominal        = PAR_VALUE(CUMMINS_THROTTLE_NOMINAL__PARREFIND);
+	pStandby->GenNominalLoad                = PAR_VALUE(GEN_NOMINAL_LOAD__PARREFIND);
+	pStandby->NumberOfTeethAtFlywheel       = PAR_VALUE(NUMBER_OF_TEETH_AT_FLYWHEEL__PARREFIND);
+	pStandby->Tec2MaxFlow                   = PAR_VALUE(TEC_2_MAX_FLOW__PARREFIND);
+	pStandby->TecHeatValue                  = PAR_VALUE(TEC_HEAT_VALUE__PARREFIND);
+	pStandby->TecLambdaSetpoint0kW          = PAR_VALUE(TEC_LAMBDA_SETPOINT_0kW__PARREFIND);
+	pStandby->TecMaxFlow                    = PAR_VALUE(TEC_MAX_FLOW__PARREFIND);
+	pStandby->TecRampTimeStartToIdle        = PAR_VALUE(TEC_RAMP_TIME_START_TO_IDLE__PARREFIND);
+
+	// transaction applied meanwhile: keep the old snapshot, read again in the next cycle
+	if (PAR_BUILD_VALID(Seq))
+		MIX_pParams = pStandby;
+}
+
+// parameter change notification: setpoint curve or lambda control option changed
+// the curve is read and sorted in the standby buffer, the control loop of the preempting
+// 100ms task only sees the sorted curve after the switch of the pointer
+static void Mix_Update_MixerSetpoints(void)
+{
+	struct t_MIX_Setpoint_Mixer (*pStandby)[NUMBER_OF_MIXER_SETPOINTS];
+	DU32 Seq = PAR_BUILD_BEGIN();
+
+	pStandby = (MIX.Setpoint_Mixer == CurveBuffer[0]) ? CurveBuffer[1] : CurveBuffer[0];
+
+	// no curve for other lambda control options: keep the points
+	if (MIX.Setpoint_Mixer != 0)
+		memcpy(pStandby, MIX.Setpoint_Mixer, sizeof(CurveBuffer[0]));
+	Mix_Read_MixerSetpointsFromParameters(pStandby);
+	Mix_Sort_MixerSetpoints(pStandby);
+
+	if (PAR_BUILD_VALID(Seq) || (MIX.Setpoint_Mixer == 0))
+		MIX.Setpoint_Mixer = pStandby;
+}
 
-    // check max flow rate for tecjet(s)
-    SetMaxFlowRateTecJet(); // would only be necessary if one of the tecjet options are changed or if one of the max flow parameters have been touched
+// register the parameter change listeners of MIX (1000ms task)
+// listeners are called in order of registration: snapshot first
+// the readers in the preempting 20ms / 100ms task see each result as a whole: the snapshot
+// and the curve are switched by one pointer store, the others are single 32 bit values
+static void MIX_RegisterParameterListeners(void)
+{
+	PAR_RegisterListener(PAR_NOTIFY_TASK_1000MS, PAR_LISTEN_ALL, PAR_LISTEN_ALL, MIX_ReadParameters);
+	PAR_RegisterListener(PAR_NOTIFY_TASK_1000MS, MIX_OPTION_LAMBDA_CONTROL__PARREFIND, MIX_OPTION_LAMBDA_CONTROL__PARREFIND, Mix_Update_MixerSetpoints);
+	PAR_RegisterListener(PAR_NOTIFY_TASK_1000MS, MIX_POWER1A__PARREFIND, MIX_CYL_TEMP8B__PARREFIND, Mix_Update_MixerSetpoints);
+	PAR_RegisterListener(PAR_NOTIFY_TASK_1000MS, MIX_DEV_MIN_TIME__PARREFIND, MIX_MAX_DEVIATION__PARREFIND, Mix_Calculate_Constant_pTDeviationControl);
+	PAR_RegisterListener(PAR_NOTIFY_TASK_1000MS, TEC_MAX_FLOW__PARREFIND, TEC_2_MAX_FLOW__PARREFIND, SetMaxFlowRateTecJet);
+	PAR_RegisterListener(PAR_NOTIFY_TASK_1000MS, MIX_ANALOG_CONTROL_SIGNAL__PARREFIND, MIX_ANALOG_CONTROL_SIGNAL__PARREFIND, MIX_Set_AnalogOutZero);
 }
 
 void Mix_Calculate_Constant_pTDeviationControl(void)
 {
+	DU32 Seq = PAR_BUILD_BEGIN();
+	DS32 Constant;
+
 	// ((3000 - tmin) * (dpmax3s - dpmin))
-	MIX.Constant_pTDeviationControl =
-			( (3000 - PARA[ParRefInd[MIX_DEV_MIN_TIME__PARREFIND]].Value)
-			* (PARA[ParRefInd[MIX_DEV_MAX_DP_3SEC__PARREFIND]].Value - PARA[ParRefInd[MIX_MAX_DEVIATION__PARREFIND]].Value));
+	Constant =
+			( (3000 - PAR_VALUE(MIX_DEV_MIN_TIME__PARREFIND))
+			* (PAR_VALUE(MIX_DEV_MAX_DP_3SEC__PARREFIND) - PAR_VALUE(MIX_MAX_DEVIATION__PARREFIND)));
+
+	if (PAR_BUILD_VALID(Seq))
+		MIX.Constant_pTDeviationControl = Constant;
 }
 
 void MIX_Set_AnalogOutZero(void)
 {
-	if (PARA[ParRefInd[MIX_ANALOG_CONTROL_SIGNAL__PARREFIND]].Value) // 4...20mA
+	if (PAR_VALUE(MIX_ANALOG_CONTROL_SIGNAL__PARREFIND)) // 4...20mA
 		MIX.AnalogOutZero = MIX_ANALOG_OUT_ZERO;
 	else // 0...20mA
 		MIX.AnalogOutZero = 0;
@@ -5194,16 +5271,20 @@ void MIX_Set_AnalogOutZero(void)
 
 void MIX_init(void)
 {
+	// (PAR.init happens before MIX_init, so the snapshot is valid from here on)
+	MIX_ReadParameters();
+	MIX_RegisterParameterListeners();
+
 	// Initialization of the MIX struct
 	MIX_Set_AnalogOutZero();
 
 	//(PAR.init happens before MIX_init, so MIX_init can refer to parameters)7
-	MIX.MixerFullRange_In = (DS32)PARA[ParRefInd[MIX_MAX_NUMBER_OF_STEPS__PARREFIND]].Value;
+	MIX.MixerFullRange_In = (DS32)MIX_Params.MaxNumberOfSteps;
 	MIX.MixerFullRange_Out = MIX.MixerFullRange_In;
 
 	MIX.TemperatureOffset               = 0;
 	//MIX.AdditionalTemperatureOffsetTecJet = 0;
-	MIX.MaxPower						= PARA[ParRefInd[GEN_NOMINAL_LOAD__PARREFIND]].Value;
+	MIX.MaxPower						= MIX_Params.GenNominalLoad;
 
 	SetMaxFlowRateTecJet();
 
@@ -5211,14 +5292,14 @@ void MIX_init(void)
 	 * old
 	calculation of Ramp time for mixer (moving from start to idle)
 	identical to speed ramp time
-	if (PARA[ParRefInd[SPEED_RAMP_UP__PARREFIND]].Value/1000L > 0L)
-		MIX.TecJetRampTimeStartToIdle = (TUR.NominalSpeed - PARA[ParRefInd[STRT_VALUE_SPEED_RAMP__PARREFIND]].Value*1000L) / (PARA[ParRefInd[SPEED_RAMP_UP__PARREFIND]].Value/1000L);
+	if (PAR_VALUE(SPEED_RAMP_UP__PARREFIND)/1000L > 0L)
+		MIX.TecJetRampTimeStartToIdle = (TUR.NominalSpeed - PAR_VALUE(STRT_VALUE_SPEED_RAMP__PARREFIND)*1000L) / (PAR_VALUE(SPEED_RAMP_UP__PARREFIND)/1000L);
 	else
 		// speed ramp less than 1 rpm/s
 		MIX.TecJetRampTimeStartToIdle = MIX_TEC_MAX_RAMP_TIME_FROM_STRT_TO_IDLE;
 	*/
 
-	MIX.TecJetRampTimeStartToIdle = PARA[ParRefInd[TEC_RAMP_TIME_START_TO_IDLE__PARREFIND]].Value;
+	MIX.TecJetRampTimeStartToIdle = MIX_Params.TecRampTimeStartToIdle;
 
 	// minimum time for flow ramp to TecJet
 	if (MIX.TecJetRampTimeStartToIdle < MIX_TEC_MIN_RAMP_TIME_FROM_STRT_TO_IDLE)
@@ -5231,10 +5312,8 @@ void MIX_init(void)
 	MIX.ResetStepCounter[MixerInd2]                = FALSE;
 
 	// read NUMBER_OF_MIXER_SETPOINTS setpoint triples (P,p,T) into array
-	Mix_Read_MixerSetpointsFromParameters();
-	
-	// sort setpoints within the array by Power
-	Mix_Sort_MixerSetpoints();
+	// and sort them by Power
+	Mix_Update_MixerSetpoints();
 
 	// initialize DU8 Ring buffer for value triples of p,t, and P
 	MIX_RingBufferPointer = 0;
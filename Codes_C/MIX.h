@@ -29,6 +29,9 @@
  *                        affects both mixers in parallel. This engine uses two mixers but
  *                        then only one common throttle.
  * 1422  GFH  16.09.2013  support of gas mixer with analogue control
+ *       16.10.2026       parameter snapshot MIX_Params
+ *       17.10.2026       protections as t_PROT_vars (PROT.h)
+ *       17.10.2026       MIX_Params and MIX.Setpoint_Mixer switched by pointer (double buffered)
  */
 
 
@@ -38,15 +41,15 @@
 
 #include "deif_types.h"
 #include "appl_types.h"
+#include "PROT.h"				//definition of  t_PROT_vars
 
 extern void MIX_init(void);
 extern void MIX_control_10ms(void);
 extern void MIX_control_20ms(void);
 extern void MIX_control_100ms(void);
 extern void MIX_control_1000ms(void);
+extern void MIX_ReadParameters(void);
 
-extern void Mix_Read_MixerSetpointsFromParameters(void);
-extern void Mix_Sort_MixerSetpoints(void);
 extern DS16 Mix_Calculate_Setpoint_For_Mixer_Position(DU16 Index_A, DU16 Index_B);
 extern DS16 Mix_Calculate_Ramp_Position(DS16 TargetPosition, DS16 ActualPosition); // rmiMIXRAMP
 
@@ -116,15 +119,6 @@ struct t_MIX_Setpoint_Mixer
    	
 };		
 
-struct MIX_protection
-{
-	t_protection_state  State;
-	t_protection_state  LastState;
-	DU32                StateTimer;
-	DS16                Limit;
-	DBOOL               Exceeded;
-};
-
 struct MIX_protection_CTRLDEV
 {
 	t_protection_state  State;
@@ -202,12 +196,13 @@ typedef struct MIXstruct
 
    DBOOL ReceiverTemperature_Available;
 
-   struct t_MIX_Setpoint_Mixer Setpoint_Mixer[2][NUMBER_OF_MIXER_SETPOINTS];
+   // setpoint curve of gas type A and B, switched by Mix_Update_MixerSetpoints() (MIX.c)
+   struct t_MIX_Setpoint_Mixer (* volatile Setpoint_Mixer)[NUMBER_OF_MIXER_SETPOINTS];
    struct t_MIX_Setpoint_Mixer ActualAverage;
    
-   struct MIX_protection		PositionDeviation;
-   struct MIX_protection		MixerControlRelease;
-   struct MIX_protection		MixerControlReleaseTimeout;
+   t_PROT_vars					PositionDeviation;
+   t_PROT_vars					MixerControlRelease;
+   t_PROT_vars					MixerControlReleaseTimeout;
 
    struct MIX_protection_CTRLDEV	ControlDeviation;
 
@@ -274,6 +269,65 @@ typedef struct MIXstruct
 
 extern t_MIX MIX;
 
+// parameter snapshot of MIX
+// filled by MIX_ReadParameters(), used by the control loops instead of PARA[ParRefInd[...]]
+typedef struct MIXparamsstruct
+{
+   DS32      AirLoadAtMaxPos;
+   DS32      AirMaxPos;
+   DS32      AirMinPos;
+   DS32      ColdStartEnrichment;
+   DS32      ColdStrtEnriMeasPoint;
+   DS32      CylMaxDeviation;
+   DS32      CylOffsetIsland;
+   DS32      DevMaxDp3Sec;
+   DS32      DevMinTime;
+   DS32      DkDependencyTecjet;
+   DS32      FeedbackAt0Percent;
+   DS32      FeedbackAt100Percent;
+   DS32      InvertLambdaRegulation;
+   DS32      LoadRedReceiverTempRamp;
+   DS32      LoadRedReceiverTempStartValue;
+   DS32      MaxDeviation;
+   DS32      MaxNumberOfSteps;
+   DS32      MaxTempMixture;
+   DS32      MinTempMixture;
+   DS32      OffsetIsland;
+   DS32      OptionLambdaControl;
+   DS32      OptionReceivPressSensor;
+   DS32      OptionReceivTempSensor;
+   DS32      PTFactorA;
+   DS32      PTFactorB;
+   DS32      ReceivPressValueFor20mA;
+   DS32      ReceivPressValueFor4mA;
+   DS32      ReceivPressWirebreak;
+   DS32      RegConstKd;
+   DS32      RegConstKi;
+   DS32      RegConstKp;
+   DS32      ReleasePowerControl;
+   DS32      RunningTime0To100Percent;
+   DS32      SecondMixer;
+   DS32      SetpointLambda;
+   DS32      SetpointLambdaGasB;
+   DS32      TimerNextCalibrationNecessary;
+   // parameters of other modules
+   DS32      CumminsOption;
+   DS32      CumminsThrottleLoad;
+   DS32      CumminsThrottleLowIdle;
+   DS32      CumminsThrottleNominal;
+   DS32      GenNominalLoad;
+   DS32      NumberOfTeethAtFlywheel;
+   DS32      Tec2MaxFlow;
+   DS32      TecHeatValue;
+   DS32      TecLambdaSetpoint0kW;
+   DS32      TecMaxFlow;
+   DS32      TecRampTimeStartToIdle;
+} t_MIX_params;
+
+// MIX_ReadParameters() fills the standby snapshot and switches MIX_pParams to it
+extern const t_MIX_params * volatile MIX_pParams;
+#define MIX_Params		(*MIX_pParams)
+
 
 
 extern DS32 StepperPositionSetpoint;
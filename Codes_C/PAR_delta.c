@@ -0,0 +1,358 @@
+/**
+ * @file PAR_delta.c
+ * @ingroup Application
+ * Binary delta format for the parameter file transfer
+ *
+ * @remarks
+ * Only the parameters which differ from a base (factory settings or the last image read
+ * from the target) are transferred, keyed by parameter id:
+ *
+ *   header   DU16 magic 'PD', DU16 format version, DS32 software version,
+ *            DU8 base, DU8 reserved, DU16 number of records,
+ *            DU16 CRC of the base image (0 for the factory settings), DU16 reserved
+ *   records  DU16 parameter id, DS32 value                  (6 bytes each)
+ *   trailer  DU16 CRC-16-CCITT over header and records
+ *
+ * all values little endian. The CRC of the base image is PAR_Delta_ImageCrc() over the
+ * values of PARA[] (NBR_OF_PARA, in index order) read from the target.
+ * The applier works in steps from PAR_Delta_control_100ms():
+ *   - CRC check, then the software version like the file transfer (project, test
+ *     version, older than SW_NUMBER_COMPATIBILITY_CHANGED)
+ *   - base image: CRC of PARA[], a delta built for another image is refused
+ *   - validation of every record (id known, value within min/max)
+ * each limited to PAR_DELTA_BYTES_PER_CYCLE / _VALUES_PER_CYCLE / _RECORDS_PER_CYCLE.
+ * The values are then written in one step, so the 100ms task never sees a part of the
+ * set: a delta to the factory settings sets all parameters to their factory setting first.
+ * The listeners are held back while writing (PAR_Notify.ApplySeq odd) and run once after.
+ *
+ * @date 17-oct-2026
+ *
+ * changes:
+ *      17.10.2026      first version
+ *      17.10.2026      software version, base and CRC of the base image checked, values
+ *                      written in one step, factory settings for PAR_DELTA_BASE_FACTORY
+ *
+ */
+
+#include "options.h"
+#include "deif_types.h"
+#include "appl_types.h"
+#include "STOPCONDITIONS.h"
+
+#include "PAR.h"
+
+
+// last software version before incompatibility, from build.conf like SW_NUMBER
+#ifndef SW_NUMBER_COMPATIBILITY_CHANGED
+#define SW_NUMBER_COMPATIBILITY_CHANGED		1
+#endif
+
+// delta transfer data for global use
+t_PAR_delta PAR_Delta;
+
+
+static void PutU16(DU8 *p, DU16 Value)
+{
+	p[0] = (DU8)(Value);
+	p[1] = (DU8)(Value >> 8);
+}
+
+static void PutU32(DU8 *p, DU32 Value)
+{
+	p[0] = (DU8)(Value);
+	p[1] = (DU8)(Value >> 8);
+	p[2] = (DU8)(Value >> 16);
+	p[3] = (DU8)(Value >> 24);
+}
+
+static DU16 GetU16(const DU8 *p)
+{
+	return ((DU16)(p[0] | ((DU16)p[1] << 8)));
+}
+
+static DU32 GetU32(const DU8 *p)
+{
+	return ((DU32)p[0] | ((DU32)p[1] << 8) | ((DU32)p[2] << 16) | ((DU32)p[3] << 24));
+}
+
+// CRC of a parameter image: one value after the other (little endian), start with 0xFFFF
+DU16 PAR_Delta_ImageCrc(DU16 Crc, DS32 Value)
+{
+	DU8 Bytes[4];
+
+	PutU32(Bytes, (DU32)Value);
+	return (PAR_Crc16(Crc, Bytes, sizeof(Bytes)));
+}
+
+// write a delta of all parameters which differ from the base into Buffer
+// Base = PAR_DELTA_BASE_IMAGE: BaseValue[] holds the values of the target, indexed like PARA[]
+// returns the length in bytes, 0 if the buffer is too small
+DU32 PAR_Delta_Build(DU8 Base, const DS32 *BaseValue, DU8 *Buffer, DU32 Size)
+{
+	DU16 RefInd;
+	DU16 Index;
+	DU16 Count = 0;
+	DU16 BaseCrc = 0;
+	DU32 Pos = PAR_DELTA_HEADER_SIZE;
+	DS32 Reference;
+
+	if ((Size < (PAR_DELTA_HEADER_SIZE + PAR_DELTA_CRC_SIZE))
+		|| ((Base == PAR_DELTA_BASE_IMAGE) && (BaseValue == 0)))
+		return (0);
+
+	for (RefInd = 1; RefInd <= HIGHEST_PARREFIND; RefInd++)
+	{
+		Index = ParRefInd[RefInd];
+		if (Index >= NBR_OF_PARA)
+			continue;
+
+		if (Base == PAR_DELTA_BASE_IMAGE)
+			Reference = BaseValue[Index];
+		else
+			Reference = PAR_GetDefValue(RefInd);
+
+		if (PARA[Index].Value == Reference)
+			continue;
+
+		if ((Pos + PAR_DELTA_RECORD_SIZE + PAR_DELTA_CRC_SIZE) > Size)
+			return (0);
+
+		PutU16(&Buffer[Pos], PAR_GetId(RefInd));
+		PutU32(&Buffer[Pos + 2], (DU32)PARA[Index].Value);
+		Pos += PAR_DELTA_RECORD_SIZE;
+		Count++;
+	}
+
+	if (Base == PAR_DELTA_BASE_IMAGE)
+	{
+		BaseCrc = 0xFFFF;
+		for (Index = 0; Index < NBR_OF_PARA; Index++)
+			BaseCrc = PAR_Delta_ImageCrc(BaseCrc, BaseValue[Index]);
+	}
+
+	PutU16(&Buffer[0], PAR_DELTA_MAGIC);
+	PutU16(&Buffer[2], PAR_DELTA_VERSION);
+	PutU32(&Buffer[4], (DU32)PAR_VALUE(SOFTWARE_VERSION__PARREFIND));
+	Buffer[8] = Base;
+	Buffer[9] = 0;
+	PutU16(&Buffer[10], Count);
+	PutU16(&Buffer[12], BaseCrc);
+	PutU16(&Buffer[14], 0);
+
+	PutU16(&Buffer[Pos], PAR_Crc16(0xFFFF, Buffer, Pos));
+	Pos += PAR_DELTA_CRC_SIZE;
+
+	return (Pos);
+}
+
+static void Finish(DU8 Result)
+{
+	PAR_Delta.Result = Result;
+	PAR_Delta.State  = PAR_DELTA_IDLE;
+	PAR_Delta.Busy   = FALSE;
+
+	if (Result == PAR_DELTA_ERR_PROJECT)
+		STOP_Set(STOPCONDITION_20002);
+	else if (Result == PAR_DELTA_ERR_TEST)
+		STOP_Set(STOPCONDITION_20003);
+	else if ((Result == PAR_DELTA_ERR_VERSION) || (Result == PAR_DELTA_ERR_SW_VERSION))
+		STOP_Set(STOPCONDITION_20004);
+	else if ((Result != PAR_DELTA_OK) && (Result != PAR_DELTA_ERR_ABORTED))
+		STOP_Set(STOPCONDITION_70209);
+}
+
+// software version of the delta against the one of the target, PAR_DELTA_OK if it fits
+static DU8 CheckSoftwareVersion(DU32 Version)
+{
+	DU32 Own = (DU32)PAR_VALUE(SOFTWARE_VERSION__PARREFIND);
+
+	// version = project number * 1000 + SW_NUMBER
+	if ((Version / 1000UL) != (Own / 1000UL))
+		return (PAR_DELTA_ERR_PROJECT);
+	if (((Version % 1000UL) >= PAR_DELTA_SW_NUMBER_TEST) && ((Own % 1000UL) < PAR_DELTA_SW_NUMBER_TEST))
+		return (PAR_DELTA_ERR_TEST);
+	if ((Version % 1000UL) < SW_NUMBER_COMPATIBILITY_CHANGED)
+		return (PAR_DELTA_ERR_SW_VERSION);
+	return (PAR_DELTA_OK);
+}
+
+// all parameters to their factory setting, like the base of PAR_Delta_Build()
+static void FactorySettings(void)
+{
+	DU16 RefInd;
+	DU16 Index;
+
+	for (RefInd = 1; RefInd <= HIGHEST_PARREFIND; RefInd++)
+	{
+		Index = ParRefInd[RefInd];
+		if (Index < NBR_OF_PARA)
+			PARA[Index].Value = PAR_GetDefValue(RefInd);
+	}
+	PAR_MarkAllChanged();
+}
+
+// start applying a received delta, Data has to stay valid until PAR_Delta.Busy is FALSE
+// returns FALSE if a delta is being applied or the header is wrong
+DBOOL PAR_Delta_ApplyStart(const DU8 *Data, DU32 Length)
+{
+	DU16 Count;
+
+	if (PAR_Delta.Busy)
+		return (FALSE);
+
+	PAR_Delta.Result = PAR_DELTA_OK;
+	PAR_Delta.Done   = 0;
+
+	if ((Data == 0) || (Length < (PAR_DELTA_HEADER_SIZE + PAR_DELTA_CRC_SIZE))
+		|| (GetU16(&Data[0]) != PAR_DELTA_MAGIC))
+	{
+		Finish(PAR_DELTA_ERR_FORMAT);
+		return (FALSE);
+	}
+	if (GetU16(&Data[2]) != PAR_DELTA_VERSION)
+	{
+		Finish(PAR_DELTA_ERR_VERSION);
+		return (FALSE);
+	}
+
+	Count = GetU16(&Data[10]);
+	if ((Length != (PAR_DELTA_HEADER_SIZE + (DU32)Count * PAR_DELTA_RECORD_SIZE + PAR_DELTA_CRC_SIZE))
+		|| ((Data[8] != PAR_DELTA_BASE_FACTORY) && (Data[8] != PAR_DELTA_BASE_IMAGE)))
+	{
+		Finish(PAR_DELTA_ERR_FORMAT);
+		return (FALSE);
+	}
+
+	PAR_Delta.Base   = Data[8];
+	PAR_Delta.pData  = Data;
+	PAR_Delta.Length = Length;
+	PAR_Delta.Count  = Count;
+	PAR_Delta.Pos    = 0;
+	PAR_Delta.Crc    = 0xFFFF;
+	PAR_Delta.State  = PAR_DELTA_CHECK_CRC;
+	PAR_Delta.Busy   = TRUE;
+
+	return (TRUE);
+}
+
+// stop a running delta, nothing has been written before PAR_DELTA_WRITE
+void PAR_Delta_Abort(void)
+{
+	if (!PAR_Delta.Busy)
+		return;
+
+	PAR_Delta.Result = PAR_DELTA_ERR_ABORTED;
+	PAR_Delta.State  = PAR_DELTA_IDLE;
+	PAR_Delta.Busy   = FALSE;
+}
+
+// one step of the applier, called from MAIN_control_100ms
+void PAR_Delta_control_100ms(void)
+{
+	DU32 Bytes;
+	DU32 End;
+	DU16 n;
+	DU16 Index;
+	DU16 RefInd;
+	DU8 Result;
+	DS32 Value;
+	const DU8 *pRecord;
+
+	switch (PAR_Delta.State)
+	{
+		case PAR_DELTA_CHECK_CRC:
+			End   = PAR_Delta.Length - PAR_DELTA_CRC_SIZE;
+			Bytes = End - PAR_Delta.Pos;
+			if (Bytes > PAR_DELTA_BYTES_PER_CYCLE)
+				Bytes = PAR_DELTA_BYTES_PER_CYCLE;
+
+			PAR_Delta.Crc = PAR_Crc16(PAR_Delta.Crc, &PAR_Delta.pData[PAR_Delta.Pos], Bytes);
+			PAR_Delta.Pos += Bytes;
+
+			if (PAR_Delta.Pos >= End)
+			{
+				if (PAR_Delta.Crc != GetU16(&PAR_Delta.pData[End]))
+				{
+					Finish(PAR_DELTA_ERR_CRC);
+					break;
+				}
+				Result = CheckSoftwareVersion(GetU32(&PAR_Delta.pData[4]));
+				if (Result != PAR_DELTA_OK)
+				{
+					Finish(Result);
+					break;
+				}
+				PAR_Delta.Pos   = 0;
+				PAR_Delta.Crc   = 0xFFFF;
+				PAR_Delta.Done  = 0;
+				PAR_Delta.State = (PAR_Delta.Base == PAR_DELTA_BASE_IMAGE) ? PAR_DELTA_CHECK_BASE : PAR_DELTA_VALIDATE;
+			}
+			break;
+
+		case PAR_DELTA_CHECK_BASE:
+			// delta built for this image only
+			for (n = 0; (n < PAR_DELTA_VALUES_PER_CYCLE) && (PAR_Delta.Pos < NBR_OF_PARA); n++, PAR_Delta.Pos++)
+				PAR_Delta.Crc = PAR_Delta_ImageCrc(PAR_Delta.Crc, PARA[PAR_Delta.Pos].Value);
+
+			if (PAR_Delta.Pos >= NBR_OF_PARA)
+			{
+				if (PAR_Delta.Crc != GetU16(&PAR_Delta.pData[12]))
+				{
+					Finish(PAR_DELTA_ERR_BASE);
+					break;
+				}
+				PAR_Delta.State = PAR_DELTA_VALIDATE;
+			}
+			break;
+
+		case PAR_DELTA_VALIDATE:
+			// all records are checked before the first value is written
+			for (n = 0; (n < PAR_DELTA_RECORDS_PER_CYCLE) && (PAR_Delta.Done < PAR_Delta.Count); n++)
+			{
+				pRecord = &PAR_Delta.pData[PAR_DELTA_HEADER_SIZE + (DU32)PAR_Delta.Done * PAR_DELTA_RECORD_SIZE];
+				Value   = (DS32)GetU32(&pRecord[2]);
+
+				if (!PAR_IdLookup_Find(GetU16(&pRecord[0]), &Index))
+				{
+					Finish(PAR_DELTA_ERR_ID);
+					return;
+				}
+				RefInd = PAR_GetRefInd(Index);
+				if ((Value < PAR_GetMinValue(RefInd)) || (Value > PAR_GetMaxValue(RefInd)))
+				{
+					Finish(PAR_DELTA_ERR_RANGE);
+					return;
+				}
+				PAR_Delta.Done++;
+			}
+
+			if (PAR_Delta.Done >= PAR_Delta.Count)
+				PAR_Delta.State = PAR_DELTA_WRITE;
+			break;
+
+		case PAR_DELTA_WRITE:
+			// all values in this cycle, the listeners are held back until all are written
+			PAR_Notify.ApplySeq++;
+
+			if (PAR_Delta.Base == PAR_DELTA_BASE_FACTORY)
+				FactorySettings();
+
+			for (n = 0; n < PAR_Delta.Count; n++)
+			{
+				pRecord = &PAR_Delta.pData[PAR_DELTA_HEADER_SIZE + (DU32)n * PAR_DELTA_RECORD_SIZE];
+
+				// ids validated in the step before
+				PAR_IdLookup_Find(GetU16(&pRecord[0]), &Index);
+				RefInd = PAR_GetRefInd(Index);
+				PAR_SetValue(RefInd, (DS32)GetU32(&pRecord[2]));
+				PAR_MarkChanged(RefInd);
+			}
+
+			PAR_Notify.ApplySeq++;
+			Finish(PAR_DELTA_OK);
+			break;
+
+		default:
+			break;
+	}
+}
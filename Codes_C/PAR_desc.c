@@ -0,0 +1,4075 @@
+/**
+ * @file PAR_desc.c
+ * @ingroup Application
+ * const parameter descriptors (min, max, factory setting, access level,
+ * bit width and bit offset in the packed parameter image)
+ *
+ * GENERATED by tools/gen_par_desc.py from librerias/PAR.h - do not edit,
+ * run the generator again after changing parameters in PAR.h
+ */
+
+#include "deif_types.h"
+#include "appl_types.h"
+
+#include "PAR.h"
+
+// PAR.h changed without running the generator
+typedef char PAR_Desc_CheckSize[(HIGHEST_PARREFIND == 4045) ? 1 : -1];
+
+const t_PAR_desc PAR_Desc[HIGHEST_PARREFIND+1] =
+{
+	{ 0, 0, 32, 0L, 0L, 0L, 0UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 32UL },	// FACTORY
+	{ 1, CONFIG_GRID_PROT__ACCESS_LEVEL, 32, CONFIG_GRID_PROT__MIN_VALUE, CONFIG_GRID_PROT__MAX_VALUE, CONFIG_GRID_PROT__FACTORY_SETTING, 64UL },
+	{ 1, GRID_OVERVOLTAGE_1D__ACCESS_LEVEL, 18, GRID_OVERVOLTAGE_1D__MIN_VALUE, GRID_OVERVOLTAGE_1D__MAX_VALUE, GRID_OVERVOLTAGE_1D__FACTORY_SETTING, 96UL },
+	{ 1, GRID_OVERVOLTAGE_1D_DELAY__ACCESS_LEVEL, 18, GRID_OVERVOLTAGE_1D_DELAY__MIN_VALUE, GRID_OVERVOLTAGE_1D_DELAY__MAX_VALUE, GRID_OVERVOLTAGE_1D_DELAY__FACTORY_SETTING, 114UL },
+	{ 1, GRID_UNDERVOLTAGE_1D__ACCESS_LEVEL, 19, GRID_UNDERVOLTAGE_1D__MIN_VALUE, GRID_UNDERVOLTAGE_1D__MAX_VALUE, GRID_UNDERVOLTAGE_1D__FACTORY_SETTING, 132UL },
+	{ 1, GRID_UNDERVOLTAGE_1D_DELAY__ACCESS_LEVEL, 18, GRID_UNDERVOLTAGE_1D_DELAY__MIN_VALUE, GRID_UNDERVOLTAGE_1D_DELAY__MAX_VALUE, GRID_UNDERVOLTAGE_1D_DELAY__FACTORY_SETTING, 151UL },
+	{ 1, GRID_HIGH_FREQUENCY_1__ACCESS_LEVEL, 16, GRID_HIGH_FREQUENCY_1__MIN_VALUE, GRID_HIGH_FREQUENCY_1__MAX_VALUE, GRID_HIGH_FREQUENCY_1__FACTORY_SETTING, 169UL },
+	{ 1, GRID_HIGH_FREQUENCY_1_DELAY__ACCESS_LEVEL, 10, GRID_HIGH_FREQUENCY_1_DELAY__MIN_VALUE, GRID_HIGH_FREQUENCY_1_DELAY__MAX_VALUE, GRID_HIGH_FREQUENCY_1_DELAY__FACTORY_SETTING, 185UL },
+	{ 1, GRID_HIGH_FREQUENCY_1a__ACCESS_LEVEL, 16, GRID_HIGH_FREQUENCY_1a__MIN_VALUE, GRID_HIGH_FREQUENCY_1a__MAX_VALUE, GRID_HIGH_FREQUENCY_1a__FACTORY_SETTING, 195UL },
+	{ 1, GRID_HIGH_FREQUENCY_1a_DELAY__ACCESS_LEVEL, 17, GRID_HIGH_FREQUENCY_1a_DELAY__MIN_VALUE, GRID_HIGH_FREQUENCY_1a_DELAY__MAX_VALUE, GRID_HIGH_FREQUENCY_1a_DELAY__FACTORY_SETTING, 211UL },
+	{ 1, GRID_LOW_FREQUENCY_1__ACCESS_LEVEL, 16, GRID_LOW_FREQUENCY_1__MIN_VALUE, GRID_LOW_FREQUENCY_1__MAX_VALUE, GRID_LOW_FREQUENCY_1__FACTORY_SETTING, 228UL },
+	{ 1, GRID_LOW_FREQUENCY_1_DELAY__ACCESS_LEVEL, 10, GRID_LOW_FREQUENCY_1_DELAY__MIN_VALUE, GRID_LOW_FREQUENCY_1_DELAY__MAX_VALUE, GRID_LOW_FREQUENCY_1_DELAY__FACTORY_SETTING, 244UL },
+	{ 1, GRID_LOW_FREQUENCY_1a__ACCESS_LEVEL, 16, GRID_LOW_FREQUENCY_1a__MIN_VALUE, GRID_LOW_FREQUENCY_1a__MAX_VALUE, GRID_LOW_FREQUENCY_1a__FACTORY_SETTING, 254UL },
+	{ 1, GRID_LOW_FREQUENCY_1a_DELAY__ACCESS_LEVEL, 17, GRID_LOW_FREQUENCY_1a_DELAY__MIN_VALUE, GRID_LOW_FREQUENCY_1a_DELAY__MAX_VALUE, GRID_LOW_FREQUENCY_1a_DELAY__FACTORY_SETTING, 270UL },
+	{ 1, GRID_DFDT_LIMIT__ACCESS_LEVEL, 14, GRID_DFDT_LIMIT__MIN_VALUE, GRID_DFDT_LIMIT__MAX_VALUE, GRID_DFDT_LIMIT__FACTORY_SETTING, 287UL },
+	{ 1, GRID_DFDT_NUMBER_OF_PERIODS__ACCESS_LEVEL, 10, GRID_DFDT_NUMBER_OF_PERIODS__MIN_VALUE, GRID_DFDT_NUMBER_OF_PERIODS__MAX_VALUE, GRID_DFDT_NUMBER_OF_PERIODS__FACTORY_SETTING, 301UL },
+	{ 1, GRID_DFDT_ON_OFF__ACCESS_LEVEL, 1, GRID_DFDT_ON_OFF__MIN_VALUE, GRID_DFDT_ON_OFF__MAX_VALUE, GRID_DFDT_ON_OFF__FACTORY_SETTING, 311UL },
+	{ 1, GRID_VECTORJUMP_LIMIT__ACCESS_LEVEL, 12, GRID_VECTORJUMP_LIMIT__MIN_VALUE, GRID_VECTORJUMP_LIMIT__MAX_VALUE, GRID_VECTORJUMP_LIMIT__FACTORY_SETTING, 312UL },
+	{ 1, GRID_MAX_NUMBER_OF_INTERRUPTIONS__ACCESS_LEVEL, 7, GRID_MAX_NUMBER_OF_INTERRUPTIONS__MIN_VALUE, GRID_MAX_NUMBER_OF_INTERRUPTIONS__MAX_VALUE, GRID_MAX_NUMBER_OF_INTERRUPTIONS__FACTORY_SETTING, 324UL },
+	{ 1, GRID_PROT_1_RECOVER_TIME__ACCESS_LEVEL, 20, GRID_PROT_1_RECOVER_TIME__MIN_VALUE, GRID_PROT_1_RECOVER_TIME__MAX_VALUE, GRID_PROT_1_RECOVER_TIME__FACTORY_SETTING, 331UL },
+	{ 1, GRID_OVERVOLTAGE_2D__ACCESS_LEVEL, 18, GRID_OVERVOLTAGE_2D__MIN_VALUE, GRID_OVERVOLTAGE_2D__MAX_VALUE, GRID_OVERVOLTAGE_2D__FACTORY_SETTING, 351UL },
+	{ 1, GRID_UNDERVOLTAGE_2D__ACCESS_LEVEL, 18, GRID_UNDERVOLTAGE_2D__MIN_VALUE, GRID_UNDERVOLTAGE_2D__MAX_VALUE, GRID_UNDERVOLTAGE_2D__FACTORY_SETTING, 369UL },
+	{ 1, GRID_HIGH_FREQUENCY_2__ACCESS_LEVEL, 16, GRID_HIGH_FREQUENCY_2__MIN_VALUE, GRID_HIGH_FREQUENCY_2__MAX_VALUE, GRID_HIGH_FREQUENCY_2__FACTORY_SETTING, 387UL },
+	{ 1, GRID_LOW_FREQUENCY_2__ACCESS_LEVEL, 16, GRID_LOW_FREQUENCY_2__MIN_VALUE, GRID_LOW_FREQUENCY_2__MAX_VALUE, GRID_LOW_FREQUENCY_2__FACTORY_SETTING, 403UL },
+	{ 1, GRID_PROT_2_DELAY_TIME__ACCESS_LEVEL, 20, GRID_PROT_2_DELAY_TIME__MIN_VALUE, GRID_PROT_2_DELAY_TIME__MAX_VALUE, GRID_PROT_2_DELAY_TIME__FACTORY_SETTING, 419UL },
+	{ 1, GRID_PROT_2_RECOVER_TIME__ACCESS_LEVEL, 21, GRID_PROT_2_RECOVER_TIME__MIN_VALUE, GRID_PROT_2_RECOVER_TIME__MAX_VALUE, GRID_PROT_2_RECOVER_TIME__FACTORY_SETTING, 439UL },
+	{ 1, CONFIG_GEN_PROT__ACCESS_LEVEL, 32, CONFIG_GEN_PROT__MIN_VALUE, CONFIG_GEN_PROT__MAX_VALUE, CONFIG_GEN_PROT__FACTORY_SETTING, 460UL },
+	{ 1, GEN_OVERVOLTAGE__ACCESS_LEVEL, 18, GEN_OVERVOLTAGE__MIN_VALUE, GEN_OVERVOLTAGE__MAX_VALUE, GEN_OVERVOLTAGE__FACTORY_SETTING, 492UL },
+	{ 1, GEN_OVERVOLTAGE_DELAY_TIME__ACCESS_LEVEL, 12, GEN_OVERVOLTAGE_DELAY_TIME__MIN_VALUE, GEN_OVERVOLTAGE_DELAY_TIME__MAX_VALUE, GEN_OVERVOLTAGE_DELAY_TIME__FACTORY_SETTING, 510UL },
+	{ 1, GEN_UNDERVOLTAGE__ACCESS_LEVEL, 17, GEN_UNDERVOLTAGE__MIN_VALUE, GEN_UNDERVOLTAGE__MAX_VALUE, GEN_UNDERVOLTAGE__FACTORY_SETTING, 522UL },
+	{ 1, GEN_UNDERVOLTAGE_DELAY_TIME__ACCESS_LEVEL, 20, GEN_UNDERVOLTAGE_DELAY_TIME__MIN_VALUE, GEN_UNDERVOLTAGE_DELAY_TIME__MAX_VALUE, GEN_UNDERVOLTAGE_DELAY_TIME__FACTORY_SETTING, 539UL },
+	{ 1, GEN_REVERSE_POWER_1__ACCESS_LEVEL, 8, GEN_REVERSE_POWER_1__MIN_VALUE, GEN_REVERSE_POWER_1__MAX_VALUE, GEN_REVERSE_POWER_1__FACTORY_SETTING, 559UL },
+	{ 1, GEN_REVERSE_POWER_1_DELAY_TIME__ACCESS_LEVEL, 15, GEN_REVERSE_POWER_1_DELAY_TIME__MIN_VALUE, GEN_REVERSE_POWER_1_DELAY_TIME__MAX_VALUE, GEN_REVERSE_POWER_1_DELAY_TIME__FACTORY_SETTING, 567UL },
+	{ 1, GEN_REVERSE_POWER_2__ACCESS_LEVEL, 8, GEN_REVERSE_POWER_2__MIN_VALUE, GEN_REVERSE_POWER_2__MAX_VALUE, GEN_REVERSE_POWER_2__FACTORY_SETTING, 582UL },
+	{ 1, GEN_REVERSE_POWER_2_DELAY_TIME__ACCESS_LEVEL, 19, GEN_REVERSE_POWER_2_DELAY_TIME__MIN_VALUE, GEN_REVERSE_POWER_2_DELAY_TIME__MAX_VALUE, GEN_REVERSE_POWER_2_DELAY_TIME__FACTORY_SETTING, 590UL },
+	{ 1, GEN_REVERSE_POWER_2_RECOVER_TIME__ACCESS_LEVEL, 22, GEN_REVERSE_POWER_2_RECOVER_TIME__MIN_VALUE, GEN_REVERSE_POWER_2_RECOVER_TIME__MAX_VALUE, GEN_REVERSE_POWER_2_RECOVER_TIME__FACTORY_SETTING, 609UL },
+	{ 1, GEN_MIN_LOAD__ACCESS_LEVEL, 10, GEN_MIN_LOAD__MIN_VALUE, GEN_MIN_LOAD__MAX_VALUE, GEN_MIN_LOAD__FACTORY_SETTING, 631UL },
+	{ 1, GEN_MIN_LOAD_DELAY_TIME__ACCESS_LEVEL, 30, GEN_MIN_LOAD_DELAY_TIME__MIN_VALUE, GEN_MIN_LOAD_DELAY_TIME__MAX_VALUE, GEN_MIN_LOAD_DELAY_TIME__FACTORY_SETTING, 641UL },
+	{ 1, GEN_OVERCURRENT_1__ACCESS_LEVEL, 23, GEN_OVERCURRENT_1__MIN_VALUE, GEN_OVERCURRENT_1__MAX_VALUE, GEN_OVERCURRENT_1__FACTORY_SETTING, 671UL },
+	{ 1, GEN_OVERCURRENT_1_DELAY_TIME__ACCESS_LEVEL, 15, GEN_OVERCURRENT_1_DELAY_TIME__MIN_VALUE, GEN_OVERCURRENT_1_DELAY_TIME__MAX_VALUE, GEN_OVERCURRENT_1_DELAY_TIME__FACTORY_SETTING, 694UL },
+	{ 1, GEN_OVERCURRENT_2__ACCESS_LEVEL, 23, GEN_OVERCURRENT_2__MIN_VALUE, GEN_OVERCURRENT_2__MAX_VALUE, GEN_OVERCURRENT_2__FACTORY_SETTING, 709UL },
+	{ 1, GEN_OVERCURRENT_2_DELAY_TIME__ACCESS_LEVEL, 11, GEN_OVERCURRENT_2_DELAY_TIME__MIN_VALUE, GEN_OVERCURRENT_2_DELAY_TIME__MAX_VALUE, GEN_OVERCURRENT_2_DELAY_TIME__FACTORY_SETTING, 732UL },
+	{ 1, GEN_OVERCURRENT_3__ACCESS_LEVEL, 23, GEN_OVERCURRENT_3__MIN_VALUE, GEN_OVERCURRENT_3__MAX_VALUE, GEN_OVERCURRENT_3__FACTORY_SETTING, 743UL },
+	{ 1, GEN_OVERCURRENT_3_DELAY_TIME__ACCESS_LEVEL, 11, GEN_OVERCURRENT_3_DELAY_TIME__MIN_VALUE, GEN_OVERCURRENT_3_DELAY_TIME__MAX_VALUE, GEN_OVERCURRENT_3_DELAY_TIME__FACTORY_SETTING, 766UL },
+	{ 1, GEN_CURRENT_ASYMM__ACCESS_LEVEL, 21, GEN_CURRENT_ASYMM__MIN_VALUE, GEN_CURRENT_ASYMM__MAX_VALUE, GEN_CURRENT_ASYMM__FACTORY_SETTING, 777UL },
+	{ 1, GEN_CURRENT_ASYMM_DELAY_TIME__ACCESS_LEVEL, 10, GEN_CURRENT_ASYMM_DELAY_TIME__MIN_VALUE, GEN_CURRENT_ASYMM_DELAY_TIME__MAX_VALUE, GEN_CURRENT_ASYMM_DELAY_TIME__FACTORY_SETTING, 798UL },
+	{ 1, GEN_CURRENT_ASYMM_RECOVER_TIME__ACCESS_LEVEL, 17, GEN_CURRENT_ASYMM_RECOVER_TIME__MIN_VALUE, GEN_CURRENT_ASYMM_RECOVER_TIME__MAX_VALUE, GEN_CURRENT_ASYMM_RECOVER_TIME__FACTORY_SETTING, 808UL },
+	{ 1, GEN_MAX_NUMBER_OF_ASYMM__ACCESS_LEVEL, 4, GEN_MAX_NUMBER_OF_ASYMM__MIN_VALUE, GEN_MAX_NUMBER_OF_ASYMM__MAX_VALUE, GEN_MAX_NUMBER_OF_ASYMM__FACTORY_SETTING, 825UL },
+	{ 1, GEN_OVERLOAD_1__ACCESS_LEVEL, 10, GEN_OVERLOAD_1__MIN_VALUE, GEN_OVERLOAD_1__MAX_VALUE, GEN_OVERLOAD_1__FACTORY_SETTING, 829UL },
+	{ 1, GEN_OVERLOAD_1_DELAY_TIME__ACCESS_LEVEL, 18, GEN_OVERLOAD_1_DELAY_TIME__MIN_VALUE, GEN_OVERLOAD_1_DELAY_TIME__MAX_VALUE, GEN_OVERLOAD_1_DELAY_TIME__FACTORY_SETTING, 839UL },
+	{ 1, GEN_OVERLOAD_1_RECOVER_TIME__ACCESS_LEVEL, 23, GEN_OVERLOAD_1_RECOVER_TIME__MIN_VALUE, GEN_OVERLOAD_1_RECOVER_TIME__MAX_VALUE, GEN_OVERLOAD_1_RECOVER_TIME__FACTORY_SETTING, 857UL },
+	{ 1, GEN_OVERLOAD_2__ACCESS_LEVEL, 10, GEN_OVERLOAD_2__MIN_VALUE, GEN_OVERLOAD_2__MAX_VALUE, GEN_OVERLOAD_2__FACTORY_SETTING, 880UL },
+	{ 1, GEN_OVERLOAD_2_DELAY_TIME__ACCESS_LEVEL, 15, GEN_OVERLOAD_2_DELAY_TIME__MIN_VALUE, GEN_OVERLOAD_2_DELAY_TIME__MAX_VALUE, GEN_OVERLOAD_2_DELAY_TIME__FACTORY_SETTING, 890UL },
+	{ 1, GEN_REACTIVE_EXPORT__ACCESS_LEVEL, 22, GEN_REACTIVE_EXPORT__MIN_VALUE, GEN_REACTIVE_EXPORT__MAX_VALUE, GEN_REACTIVE_EXPORT__FACTORY_SETTING, 905UL },
+	{ 1, GEN_REACTIVE_EXPORT_C1__ACCESS_LEVEL, 7, GEN_REACTIVE_EXPORT_C1__MIN_VALUE, GEN_REACTIVE_EXPORT_C1__MAX_VALUE, GEN_REACTIVE_EXPORT_C1__FACTORY_SETTING, 927UL },
+	{ 1, GEN_REACTIVE_EXPORT_C2__ACCESS_LEVEL, 7, GEN_REACTIVE_EXPORT_C2__MIN_VALUE, GEN_REACTIVE_EXPORT_C2__MAX_VALUE, GEN_REACTIVE_EXPORT_C2__FACTORY_SETTING, 934UL },
+	{ 1, GEN_REACTIVE_EXPORT_DELAY_TIME__ACCESS_LEVEL, 16, GEN_REACTIVE_EXPORT_DELAY_TIME__MIN_VALUE, GEN_REACTIVE_EXPORT_DELAY_TIME__MAX_VALUE, GEN_REACTIVE_EXPORT_DELAY_TIME__FACTORY_SETTING, 941UL },
+	{ 1, GEN_REACTIVE_IMPORT__ACCESS_LEVEL, 22, GEN_REACTIVE_IMPORT__MIN_VALUE, GEN_REACTIVE_IMPORT__MAX_VALUE, GEN_REACTIVE_IMPORT__FACTORY_SETTING, 957UL },
+	{ 1, GEN_REACTIVE_IMPORT_C1__ACCESS_LEVEL, 7, GEN_REACTIVE_IMPORT_C1__MIN_VALUE, GEN_REACTIVE_IMPORT_C1__MAX_VALUE, GEN_REACTIVE_IMPORT_C1__FACTORY_SETTING, 979UL },
+	{ 1, GEN_REACTIVE_IMPORT_C2__ACCESS_LEVEL, 7, GEN_REACTIVE_IMPORT_C2__MIN_VALUE, GEN_REACTIVE_IMPORT_C2__MAX_VALUE, GEN_REACTIVE_IMPORT_C2__FACTORY_SETTING, 986UL },
+	{ 1, GEN_REACTIVE_IMPORT_DELAY_TIME__ACCESS_LEVEL, 15, GEN_REACTIVE_IMPORT_DELAY_TIME__MIN_VALUE, GEN_REACTIVE_IMPORT_DELAY_TIME__MAX_VALUE, GEN_REACTIVE_IMPORT_DELAY_TIME__FACTORY_SETTING, 993UL },
+	{ 1, GEN_HIGH_FREQUENCY__ACCESS_LEVEL, 16, GEN_HIGH_FREQUENCY__MIN_VALUE, GEN_HIGH_FREQUENCY__MAX_VALUE, GEN_HIGH_FREQUENCY__FACTORY_SETTING, 1008UL },
+	{ 1, GEN_HIGH_FREQUENCY_DELAY_TIME__ACCESS_LEVEL, 10, GEN_HIGH_FREQUENCY_DELAY_TIME__MIN_VALUE, GEN_HIGH_FREQUENCY_DELAY_TIME__MAX_VALUE, GEN_HIGH_FREQUENCY_DELAY_TIME__FACTORY_SETTING, 1024UL },
+	{ 1, GEN_LOW_FREQUENCY__ACCESS_LEVEL, 16, GEN_LOW_FREQUENCY__MIN_VALUE, GEN_LOW_FREQUENCY__MAX_VALUE, GEN_LOW_FREQUENCY__FACTORY_SETTING, 1034UL },
+	{ 1, GEN_LOW_FREQUENCY_DELAY_TIME__ACCESS_LEVEL, 19, GEN_LOW_FREQUENCY_DELAY_TIME__MIN_VALUE, GEN_LOW_FREQUENCY_DELAY_TIME__MAX_VALUE, GEN_LOW_FREQUENCY_DELAY_TIME__FACTORY_SETTING, 1050UL },
+	{ 1, GEN_MISFIRING_POWER_DROP__ACCESS_LEVEL, 11, GEN_MISFIRING_POWER_DROP__MIN_VALUE, GEN_MISFIRING_POWER_DROP__MAX_VALUE, GEN_MISFIRING_POWER_DROP__FACTORY_SETTING, 1069UL },
+	{ 1, GEN_OVERTEMP_WINDING_U__ACCESS_LEVEL, 11, GEN_OVERTEMP_WINDING_U__MIN_VALUE, GEN_OVERTEMP_WINDING_U__MAX_VALUE, GEN_OVERTEMP_WINDING_U__FACTORY_SETTING, 1080UL },
+	{ 1, GEN_OVERTEMP_WINDING_V__ACCESS_LEVEL, 11, GEN_OVERTEMP_WINDING_V__MIN_VALUE, GEN_OVERTEMP_WINDING_V__MAX_VALUE, GEN_OVERTEMP_WINDING_V__FACTORY_SETTING, 1091UL },
+	{ 1, GEN_OVERTEMP_WINDING_W__ACCESS_LEVEL, 11, GEN_OVERTEMP_WINDING_W__MIN_VALUE, GEN_OVERTEMP_WINDING_W__MAX_VALUE, GEN_OVERTEMP_WINDING_W__FACTORY_SETTING, 1102UL },
+	{ 1, GEN_OVERTEMP_BEARING_A__ACCESS_LEVEL, 11, GEN_OVERTEMP_BEARING_A__MIN_VALUE, GEN_OVERTEMP_BEARING_A__MAX_VALUE, GEN_OVERTEMP_BEARING_A__FACTORY_SETTING, 1113UL },
+	{ 1, GEN_OVERTEMP_BEARING_B__ACCESS_LEVEL, 11, GEN_OVERTEMP_BEARING_B__MIN_VALUE, GEN_OVERTEMP_BEARING_B__MAX_VALUE, GEN_OVERTEMP_BEARING_B__FACTORY_SETTING, 1124UL },
+	{ 1, COOL_DOWN_TIME__ACCESS_LEVEL, 20, COOL_DOWN_TIME__MIN_VALUE, COOL_DOWN_TIME__MAX_VALUE, COOL_DOWN_TIME__FACTORY_SETTING, 1135UL },
+	{ 1, MAIN_IDLE_RUN_TIMEOUT__ACCESS_LEVEL, 26, MAIN_IDLE_RUN_TIMEOUT__MIN_VALUE, MAIN_IDLE_RUN_TIMEOUT__MAX_VALUE, MAIN_IDLE_RUN_TIMEOUT__FACTORY_SETTING, 1155UL },
+	{ 1, NOMINAL_RPM__ACCESS_LEVEL, 1, NOMINAL_RPM__MIN_VALUE, NOMINAL_RPM__MAX_VALUE, NOMINAL_RPM__FACTORY_SETTING, 1181UL },
+	{ 1, OVERSPEED__ACCESS_LEVEL, 21, OVERSPEED__MIN_VALUE, OVERSPEED__MAX_VALUE, OVERSPEED__FACTORY_SETTING, 1182UL },
+	{ 1, ENGINE_RUNNING__ACCESS_LEVEL, 19, ENGINE_RUNNING__MIN_VALUE, ENGINE_RUNNING__MAX_VALUE, ENGINE_RUNNING__FACTORY_SETTING, 1203UL },
+	{ 1, ENG_IDLE_SPEED__ACCESS_LEVEL, 14, ENG_IDLE_SPEED__MIN_VALUE, ENG_IDLE_SPEED__MAX_VALUE, ENG_IDLE_SPEED__FACTORY_SETTING, 1222UL },
+	{ 1, ENG_TOOTH_ON_TOOTH__ACCESS_LEVEL, 1, ENG_TOOTH_ON_TOOTH__MIN_VALUE, ENG_TOOTH_ON_TOOTH__MAX_VALUE, ENG_TOOTH_ON_TOOTH__FACTORY_SETTING, 1236UL },
+	{ 1, ENG_CRANKING_TIME__ACCESS_LEVEL, 15, ENG_CRANKING_TIME__MIN_VALUE, ENG_CRANKING_TIME__MAX_VALUE, ENG_CRANKING_TIME__FACTORY_SETTING, 1237UL },
+	{ 1, ENG_CRANKING_TIME_IN_TEST__ACCESS_LEVEL, 16, ENG_CRANKING_TIME_IN_TEST__MIN_VALUE, ENG_CRANKING_TIME_IN_TEST__MAX_VALUE, ENG_CRANKING_TIME_IN_TEST__FACTORY_SETTING, 1252UL },
+	{ 1, ENG_NUMBER_OF_START_ATTEMPTS__ACCESS_LEVEL, 5, ENG_NUMBER_OF_START_ATTEMPTS__MIN_VALUE, ENG_NUMBER_OF_START_ATTEMPTS__MAX_VALUE, ENG_NUMBER_OF_START_ATTEMPTS__FACTORY_SETTING, 1268UL },
+	{ 1, ENG_STOPPING_TIME__ACCESS_LEVEL, 20, ENG_STOPPING_TIME__MIN_VALUE, ENG_STOPPING_TIME__MAX_VALUE, ENG_STOPPING_TIME__FACTORY_SETTING, 1273UL },
+	{ 1, ENG_STOP_WITH_IGN__ACCESS_LEVEL, 1, ENG_STOP_WITH_IGN__MIN_VALUE, ENG_STOP_WITH_IGN__MAX_VALUE, ENG_STOP_WITH_IGN__FACTORY_SETTING, 1293UL },
+	{ 1, ENG_START_ATTEMPTS_WAIT_TIME__ACCESS_LEVEL, 20, ENG_START_ATTEMPTS_WAIT_TIME__MIN_VALUE, ENG_START_ATTEMPTS_WAIT_TIME__MAX_VALUE, ENG_START_ATTEMPTS_WAIT_TIME__FACTORY_SETTING, 1294UL },
+	{ 1, ENG_LUBE_OIL_PRES_VALUE_FOR_4mA__ACCESS_LEVEL, 9, ENG_LUBE_OIL_PRES_VALUE_FOR_4mA__MIN_VALUE, ENG_LUBE_OIL_PRES_VALUE_FOR_4mA__MAX_VALUE, ENG_LUBE_OIL_PRES_VALUE_FOR_4mA__FACTORY_SETTING, 1314UL },
+	{ 1, ENG_LUBE_OIL_PRES_VALUE_FOR_20mA__ACCESS_LEVEL, 13, ENG_LUBE_OIL_PRES_VALUE_FOR_20mA__MIN_VALUE, ENG_LUBE_OIL_PRES_VALUE_FOR_20mA__MAX_VALUE, ENG_LUBE_OIL_PRES_VALUE_FOR_20mA__FACTORY_SETTING, 1323UL },
+	{ 1, ENG_LUBE_OIL_PRES_WIREBREAK__ACCESS_LEVEL, 16, ENG_LUBE_OIL_PRES_WIREBREAK__MIN_VALUE, ENG_LUBE_OIL_PRES_WIREBREAK__MAX_VALUE, ENG_LUBE_OIL_PRES_WIREBREAK__FACTORY_SETTING, 1336UL },
+	{ 1, ENG_LUBE_OIL_PRES_MIN_PARALLEL__ACCESS_LEVEL, 11, ENG_LUBE_OIL_PRES_MIN_PARALLEL__MIN_VALUE, ENG_LUBE_OIL_PRES_MIN_PARALLEL__MAX_VALUE, ENG_LUBE_OIL_PRES_MIN_PARALLEL__FACTORY_SETTING, 1352UL },
+	{ 1, ENG_LUBE_OIL_MIN_PRES_RUNNING__ACCESS_LEVEL, 11, ENG_LUBE_OIL_MIN_PRES_RUNNING__MIN_VALUE, ENG_LUBE_OIL_MIN_PRES_RUNNING__MAX_VALUE, ENG_LUBE_OIL_MIN_PRES_RUNNING__FACTORY_SETTING, 1363UL },
+	{ 1, ENG_LUBE_OIL_MIN_PRES_ACT_DELAY__ACCESS_LEVEL, 15, ENG_LUBE_OIL_MIN_PRES_ACT_DELAY__MIN_VALUE, ENG_LUBE_OIL_MIN_PRES_ACT_DELAY__MAX_VALUE, ENG_LUBE_OIL_MIN_PRES_ACT_DELAY__FACTORY_SETTING, 1374UL },
+	{ 1, ENG_LUBE_OIL_MAX_PRES__ACCESS_LEVEL, 11, ENG_LUBE_OIL_MAX_PRES__MIN_VALUE, ENG_LUBE_OIL_MAX_PRES__MAX_VALUE, ENG_LUBE_OIL_MAX_PRES__FACTORY_SETTING, 1389UL },
+	{ 1, ENG_LUBE_OIL_PRES_ACT_TEMP__ACCESS_LEVEL, 11, ENG_LUBE_OIL_PRES_ACT_TEMP__MIN_VALUE, ENG_LUBE_OIL_PRES_ACT_TEMP__MAX_VALUE, ENG_LUBE_OIL_PRES_ACT_TEMP__FACTORY_SETTING, 1400UL },
+	{ 1, ENG_LUBE_OIL_MAX_TEMP__ACCESS_LEVEL, 11, ENG_LUBE_OIL_MAX_TEMP__MIN_VALUE, ENG_LUBE_OIL_MAX_TEMP__MAX_VALUE, ENG_LUBE_OIL_MAX_TEMP__FACTORY_SETTING, 1411UL },
+	{ 1, ENG_LUBE_OIL_MAX_TEMP_DELAY_TIME__ACCESS_LEVEL, 15, ENG_LUBE_OIL_MAX_TEMP_DELAY_TIME__MIN_VALUE, ENG_LUBE_OIL_MAX_TEMP_DELAY_TIME__MAX_VALUE, ENG_LUBE_OIL_MAX_TEMP_DELAY_TIME__FACTORY_SETTING, 1422UL },
+	{ 1, ENG_LUBE_OIL_MAX_TEMP_RECOVER_TIME__ACCESS_LEVEL, 20, ENG_LUBE_OIL_MAX_TEMP_RECOVER_TIME__MIN_VALUE, ENG_LUBE_OIL_MAX_TEMP_RECOVER_TIME__MAX_VALUE, ENG_LUBE_OIL_MAX_TEMP_RECOVER_TIME__FACTORY_SETTING, 1437UL },
+	{ 1, GAS_TWO_LINES_OPTION__ACCESS_LEVEL, 2, GAS_TWO_LINES_OPTION__MIN_VALUE, GAS_TWO_LINES_OPTION__MAX_VALUE, GAS_TWO_LINES_OPTION__FACTORY_SETTING, 1457UL },
+	{ 1, GAS_TYPE_B_IN_ISLAND__ACCESS_LEVEL, 1, GAS_TYPE_B_IN_ISLAND__MIN_VALUE, GAS_TYPE_B_IN_ISLAND__MAX_VALUE, GAS_TYPE_B_IN_ISLAND__FACTORY_SETTING, 1459UL },
+	{ 1, MCD_IGNITION_COM_OPTION__ACCESS_LEVEL, 2, MCD_IGNITION_COM_OPTION__MIN_VALUE, MCD_IGNITION_COM_OPTION__MAX_VALUE, MCD_IGNITION_COM_OPTION__FACTORY_SETTING, 1460UL },
+	{ 1, MCD_IGNITION_COM_BAUD__ACCESS_LEVEL, 1, MCD_IGNITION_COM_BAUD__MIN_VALUE, MCD_IGNITION_COM_BAUD__MAX_VALUE, MCD_IGNITION_COM_BAUD__FACTORY_SETTING, 1462UL },
+	{ 1, MCD_IGNITION_CYLINDER__ACCESS_LEVEL, 2, MCD_IGNITION_CYLINDER__MIN_VALUE, MCD_IGNITION_CYLINDER__MAX_VALUE, MCD_IGNITION_CYLINDER__FACTORY_SETTING, 1463UL },
+	{ 1, GEN_NOMINAL_VOLTAGE__ACCESS_LEVEL, 25, GEN_NOMINAL_VOLTAGE__MIN_VALUE, GEN_NOMINAL_VOLTAGE__MAX_VALUE, GEN_NOMINAL_VOLTAGE__FACTORY_SETTING, 1465UL },
+	{ 1, GEN_NOMINAL_FREQUENCY__ACCESS_LEVEL, 1, GEN_NOMINAL_FREQUENCY__MIN_VALUE, GEN_NOMINAL_FREQUENCY__MAX_VALUE, GEN_NOMINAL_FREQUENCY__FACTORY_SETTING, 1490UL },
+	{ 1, POWER_DEMAND_LOCAL__ACCESS_LEVEL, 23, POWER_DEMAND_LOCAL__MIN_VALUE, POWER_DEMAND_LOCAL__MAX_VALUE, POWER_DEMAND_LOCAL__FACTORY_SETTING, 1491UL },
+	{ 1, POWER_DEMAND_ANALOG_OPTION__ACCESS_LEVEL, 2, POWER_DEMAND_ANALOG_OPTION__MIN_VALUE, POWER_DEMAND_ANALOG_OPTION__MAX_VALUE, POWER_DEMAND_ANALOG_OPTION__FACTORY_SETTING, 1514UL },
+	{ 1, ELM_EL_LOAD_FOR_DO__ACCESS_LEVEL, 14, ELM_EL_LOAD_FOR_DO__MIN_VALUE, ELM_EL_LOAD_FOR_DO__MAX_VALUE, ELM_EL_LOAD_FOR_DO__FACTORY_SETTING, 1516UL },
+	{ 1, GEN_NOMINAL_LOAD__ACCESS_LEVEL, 23, GEN_NOMINAL_LOAD__MIN_VALUE, GEN_NOMINAL_LOAD__MAX_VALUE, GEN_NOMINAL_LOAD__FACTORY_SETTING, 1530UL },
+	{ 1, GEN_MAX_POWER_GAS_TYPE_A__ACCESS_LEVEL, 10, GEN_MAX_POWER_GAS_TYPE_A__MIN_VALUE, GEN_MAX_POWER_GAS_TYPE_A__MAX_VALUE, GEN_MAX_POWER_GAS_TYPE_A__FACTORY_SETTING, 1553UL },
+	{ 1, GEN_MAX_POWER_GAS_TYPE_B__ACCESS_LEVEL, 10, GEN_MAX_POWER_GAS_TYPE_B__MIN_VALUE, GEN_MAX_POWER_GAS_TYPE_B__MAX_VALUE, GEN_MAX_POWER_GAS_TYPE_B__FACTORY_SETTING, 1563UL },
+	{ 1, GEN_CURR_TRANS_PRIM__ACCESS_LEVEL, 22, GEN_CURR_TRANS_PRIM__MIN_VALUE, GEN_CURR_TRANS_PRIM__MAX_VALUE, GEN_CURR_TRANS_PRIM__FACTORY_SETTING, 1573UL },
+	{ 1, GEN_CURR_TRANS_SEC__ACCESS_LEVEL, 1, GEN_CURR_TRANS_SEC__MIN_VALUE, GEN_CURR_TRANS_SEC__MAX_VALUE, GEN_CURR_TRANS_SEC__FACTORY_SETTING, 1595UL },
+	{ 1, GEN_VOLTAGE_TRANS_PRIM__ACCESS_LEVEL, 15, GEN_VOLTAGE_TRANS_PRIM__MIN_VALUE, GEN_VOLTAGE_TRANS_PRIM__MAX_VALUE, GEN_VOLTAGE_TRANS_PRIM__FACTORY_SETTING, 1596UL },
+	{ 1, GEN_VOLTAGE_TRANS_SEC__ACCESS_LEVEL, 10, GEN_VOLTAGE_TRANS_SEC__MIN_VALUE, GEN_VOLTAGE_TRANS_SEC__MAX_VALUE, GEN_VOLTAGE_TRANS_SEC__FACTORY_SETTING, 1611UL },
+	{ 1, COMPACT_GENERATOR_BREAKER_OPTION__ACCESS_LEVEL, 1, COMPACT_GENERATOR_BREAKER_OPTION__MIN_VALUE, COMPACT_GENERATOR_BREAKER_OPTION__MAX_VALUE, COMPACT_GENERATOR_BREAKER_OPTION__FACTORY_SETTING, 1621UL },
+	{ 1, GCB_OPEN_MAX_POWER__ACCESS_LEVEL, 14, GCB_OPEN_MAX_POWER__MIN_VALUE, GCB_OPEN_MAX_POWER__MAX_VALUE, GCB_OPEN_MAX_POWER__FACTORY_SETTING, 1622UL },
+	{ 1, GCB_OPEN_MAX_DELAY__ACCESS_LEVEL, 10, GCB_OPEN_MAX_DELAY__MIN_VALUE, GCB_OPEN_MAX_DELAY__MAX_VALUE, GCB_OPEN_MAX_DELAY__FACTORY_SETTING, 1636UL },
+	{ 1, COMPACT_MAINS_BREAKER_OPTION__ACCESS_LEVEL, 1, COMPACT_MAINS_BREAKER_OPTION__MIN_VALUE, COMPACT_MAINS_BREAKER_OPTION__MAX_VALUE, COMPACT_MAINS_BREAKER_OPTION__FACTORY_SETTING, 1646UL },
+	{ 1, GB_INHERENT_DELAY__ACCESS_LEVEL, 7, GB_INHERENT_DELAY__MIN_VALUE, GB_INHERENT_DELAY__MAX_VALUE, GB_INHERENT_DELAY__FACTORY_SETTING, 1647UL },
+	{ 1, MB_INHERENT_DELAY__ACCESS_LEVEL, 7, MB_INHERENT_DELAY__MIN_VALUE, MB_INHERENT_DELAY__MAX_VALUE, MB_INHERENT_DELAY__FACTORY_SETTING, 1654UL },
+	{ 1, HVS_BREAKER_OPEN_MAX_LOAD__ACCESS_LEVEL, 14, HVS_BREAKER_OPEN_MAX_LOAD__MIN_VALUE, HVS_BREAKER_OPEN_MAX_LOAD__MAX_VALUE, HVS_BREAKER_OPEN_MAX_LOAD__FACTORY_SETTING, 1661UL },
+	{ 1, GB_BREAKER_DOESNT_CLOSE_LIMIT__ACCESS_LEVEL, 7, GB_BREAKER_DOESNT_CLOSE_LIMIT__MIN_VALUE, GB_BREAKER_DOESNT_CLOSE_LIMIT__MAX_VALUE, GB_BREAKER_DOESNT_CLOSE_LIMIT__FACTORY_SETTING, 1675UL },
+	{ 1, HVS_MCB_DEFAULT_POSITION__ACCESS_LEVEL, 1, HVS_MCB_DEFAULT_POSITION__MIN_VALUE, HVS_MCB_DEFAULT_POSITION__MAX_VALUE, HVS_MCB_DEFAULT_POSITION__FACTORY_SETTING, 1682UL },
+	{ 1, EXTERNAL_GOV_OFFSET__ACCESS_LEVEL, 16, EXTERNAL_GOV_OFFSET__MIN_VALUE, EXTERNAL_GOV_OFFSET__MAX_VALUE, EXTERNAL_GOV_OFFSET__FACTORY_SETTING, 1683UL },
+	{ 1, EXTERNAL_GOV_MIN_LIMIT__ACCESS_LEVEL, 16, EXTERNAL_GOV_MIN_LIMIT__MIN_VALUE, EXTERNAL_GOV_MIN_LIMIT__MAX_VALUE, EXTERNAL_GOV_MIN_LIMIT__FACTORY_SETTING, 1699UL },
+	{ 1, EXTERNAL_GOV_MAX_LIMIT__ACCESS_LEVEL, 16, EXTERNAL_GOV_MAX_LIMIT__MIN_VALUE, EXTERNAL_GOV_MAX_LIMIT__MAX_VALUE, EXTERNAL_GOV_MAX_LIMIT__FACTORY_SETTING, 1715UL },
+	{ 1, EXTERNAL_GOV_ACTIVATION_SPEED__ACCESS_LEVEL, 10, EXTERNAL_GOV_ACTIVATION_SPEED__MIN_VALUE, EXTERNAL_GOV_ACTIVATION_SPEED__MAX_VALUE, EXTERNAL_GOV_ACTIVATION_SPEED__FACTORY_SETTING, 1731UL },
+	{ 1, EXT_GOV_REG_KP_SPEED__ACCESS_LEVEL, 14, EXT_GOV_REG_KP_SPEED__MIN_VALUE, EXT_GOV_REG_KP_SPEED__MAX_VALUE, EXT_GOV_REG_KP_SPEED__FACTORY_SETTING, 1741UL },
+	{ 1, EXT_GOV_REG_KI_SPEED__ACCESS_LEVEL, 14, EXT_GOV_REG_KI_SPEED__MIN_VALUE, EXT_GOV_REG_KI_SPEED__MAX_VALUE, EXT_GOV_REG_KI_SPEED__FACTORY_SETTING, 1755UL },
+	{ 1, EXT_GOV_REG_KD_SPEED__ACCESS_LEVEL, 14, EXT_GOV_REG_KD_SPEED__MIN_VALUE, EXT_GOV_REG_KD_SPEED__MAX_VALUE, EXT_GOV_REG_KD_SPEED__FACTORY_SETTING, 1769UL },
+	{ 1, EXT_GOV_REG_KP_SYNC__ACCESS_LEVEL, 14, EXT_GOV_REG_KP_SYNC__MIN_VALUE, EXT_GOV_REG_KP_SYNC__MAX_VALUE, EXT_GOV_REG_KP_SYNC__FACTORY_SETTING, 1783UL },
+	{ 1, EXT_GOV_REG_KI_SYNC__ACCESS_LEVEL, 14, EXT_GOV_REG_KI_SYNC__MIN_VALUE, EXT_GOV_REG_KI_SYNC__MAX_VALUE, EXT_GOV_REG_KI_SYNC__FACTORY_SETTING, 1797UL },
+	{ 1, EXT_GOV_REG_KD_SYNC__ACCESS_LEVEL, 14, EXT_GOV_REG_KD_SYNC__MIN_VALUE, EXT_GOV_REG_KD_SYNC__MAX_VALUE, EXT_GOV_REG_KD_SYNC__FACTORY_SETTING, 1811UL },
+	{ 1, EXT_GOV_REG_KP_POWER__ACCESS_LEVEL, 14, EXT_GOV_REG_KP_POWER__MIN_VALUE, EXT_GOV_REG_KP_POWER__MAX_VALUE, EXT_GOV_REG_KP_POWER__FACTORY_SETTING, 1825UL },
+	{ 1, EXT_GOV_REG_KI_POWER__ACCESS_LEVEL, 14, EXT_GOV_REG_KI_POWER__MIN_VALUE, EXT_GOV_REG_KI_POWER__MAX_VALUE, EXT_GOV_REG_KI_POWER__FACTORY_SETTING, 1839UL },
+	{ 1, EXT_GOV_REG_KD_POWER__ACCESS_LEVEL, 14, EXT_GOV_REG_KD_POWER__MIN_VALUE, EXT_GOV_REG_KD_POWER__MAX_VALUE, EXT_GOV_REG_KD_POWER__FACTORY_SETTING, 1853UL },
+	{ 1, EXT_GOV_REG_KP_SPEED_LS__ACCESS_LEVEL, 14, EXT_GOV_REG_KP_SPEED_LS__MIN_VALUE, EXT_GOV_REG_KP_SPEED_LS__MAX_VALUE, EXT_GOV_REG_KP_SPEED_LS__FACTORY_SETTING, 1867UL },
+	{ 1, EXT_GOV_REG_KI_SPEED_LS__ACCESS_LEVEL, 14, EXT_GOV_REG_KI_SPEED_LS__MIN_VALUE, EXT_GOV_REG_KI_SPEED_LS__MAX_VALUE, EXT_GOV_REG_KI_SPEED_LS__FACTORY_SETTING, 1881UL },
+	{ 1, EXT_GOV_REG_KD_SPEED_LS__ACCESS_LEVEL, 14, EXT_GOV_REG_KD_SPEED_LS__MIN_VALUE, EXT_GOV_REG_KD_SPEED_LS__MAX_VALUE, EXT_GOV_REG_KD_SPEED_LS__FACTORY_SETTING, 1895UL },
+	{ 1, EXT_GOV_REG_KP_POWER_LS__ACCESS_LEVEL, 14, EXT_GOV_REG_KP_POWER_LS__MIN_VALUE, EXT_GOV_REG_KP_POWER_LS__MAX_VALUE, EXT_GOV_REG_KP_POWER_LS__FACTORY_SETTING, 1909UL },
+	{ 1, EXT_GOV_REG_KI_POWER_LS__ACCESS_LEVEL, 14, EXT_GOV_REG_KI_POWER_LS__MIN_VALUE, EXT_GOV_REG_KI_POWER_LS__MAX_VALUE, EXT_GOV_REG_KI_POWER_LS__FACTORY_SETTING, 1923UL },
+	{ 1, EXT_GOV_REG_KD_POWER_LS__ACCESS_LEVEL, 14, EXT_GOV_REG_KD_POWER_LS__MIN_VALUE, EXT_GOV_REG_KD_POWER_LS__MAX_VALUE, EXT_GOV_REG_KD_POWER_LS__FACTORY_SETTING, 1937UL },
+	{ 1, SPEED_REG_CONST_P__ACCESS_LEVEL, 14, SPEED_REG_CONST_P__MIN_VALUE, SPEED_REG_CONST_P__MAX_VALUE, SPEED_REG_CONST_P__FACTORY_SETTING, 1951UL },
+	{ 1, SPEED_REG_CONST_I__ACCESS_LEVEL, 14, SPEED_REG_CONST_I__MIN_VALUE, SPEED_REG_CONST_I__MAX_VALUE, SPEED_REG_CONST_I__FACTORY_SETTING, 1965UL },
+	{ 1, SPEED_REG_CONST_D__ACCESS_LEVEL, 14, SPEED_REG_CONST_D__MIN_VALUE, SPEED_REG_CONST_D__MAX_VALUE, SPEED_REG_CONST_D__FACTORY_SETTING, 1979UL },
+	{ 1, DEADBAND_SPEED_REG_OFF__ACCESS_LEVEL, 14, DEADBAND_SPEED_REG_OFF__MIN_VALUE, DEADBAND_SPEED_REG_OFF__MAX_VALUE, DEADBAND_SPEED_REG_OFF__FACTORY_SETTING, 1993UL },
+	{ 1, POWER_UP_MAX_GRADIENT__ACCESS_LEVEL, 7, POWER_UP_MAX_GRADIENT__MIN_VALUE, POWER_UP_MAX_GRADIENT__MAX_VALUE, POWER_UP_MAX_GRADIENT__FACTORY_SETTING, 2007UL },
+	{ 1, POWER_REG_CONST_P__ACCESS_LEVEL, 17, POWER_REG_CONST_P__MIN_VALUE, POWER_REG_CONST_P__MAX_VALUE, POWER_REG_CONST_P__FACTORY_SETTING, 2014UL },
+	{ 1, POWER_REG_CONST_I__ACCESS_LEVEL, 17, POWER_REG_CONST_I__MIN_VALUE, POWER_REG_CONST_I__MAX_VALUE, POWER_REG_CONST_I__FACTORY_SETTING, 2031UL },
+	{ 1, POWER_REG_CONST_D__ACCESS_LEVEL, 17, POWER_REG_CONST_D__MIN_VALUE, POWER_REG_CONST_D__MAX_VALUE, POWER_REG_CONST_D__FACTORY_SETTING, 2048UL },
+	{ 1, POWER_RAMP__ACCESS_LEVEL, 18, POWER_RAMP__MIN_VALUE, POWER_RAMP__MAX_VALUE, POWER_RAMP__FACTORY_SETTING, 2065UL },
+	{ 1, HVS_EXT_SYNC__ACCESS_LEVEL, 1, HVS_EXT_SYNC__MIN_VALUE, HVS_EXT_SYNC__MAX_VALUE, HVS_EXT_SYNC__FACTORY_SETTING, 2083UL },
+	{ 1, SYNC_REG_CONST_P__ACCESS_LEVEL, 10, SYNC_REG_CONST_P__MIN_VALUE, SYNC_REG_CONST_P__MAX_VALUE, SYNC_REG_CONST_P__FACTORY_SETTING, 2084UL },
+	{ 1, SYNC_PHASE_DIFF_MIN__ACCESS_LEVEL, 14, SYNC_PHASE_DIFF_MIN__MIN_VALUE, SYNC_PHASE_DIFF_MIN__MAX_VALUE, SYNC_PHASE_DIFF_MIN__FACTORY_SETTING, 2094UL },
+	{ 1, SYNC_REG_CONST_TIME_PHASEMATCH__ACCESS_LEVEL, 10, SYNC_REG_CONST_TIME_PHASEMATCH__MIN_VALUE, SYNC_REG_CONST_TIME_PHASEMATCH__MAX_VALUE, SYNC_REG_CONST_TIME_PHASEMATCH__FACTORY_SETTING, 2108UL },
+	{ 1, DEADBAND_SYNC_REG_OFF__ACCESS_LEVEL, 14, DEADBAND_SYNC_REG_OFF__MIN_VALUE, DEADBAND_SYNC_REG_OFF__MAX_VALUE, DEADBAND_SYNC_REG_OFF__FACTORY_SETTING, 2118UL },
+	{ 1, SYNC_TIMEOUT__ACCESS_LEVEL, 20, SYNC_TIMEOUT__MIN_VALUE, SYNC_TIMEOUT__MAX_VALUE, SYNC_TIMEOUT__FACTORY_SETTING, 2132UL },
+	{ 1, GEN_EXT_REGULATION__ACCESS_LEVEL, 1, GEN_EXT_REGULATION__MIN_VALUE, GEN_EXT_REGULATION__MAX_VALUE, GEN_EXT_REGULATION__FACTORY_SETTING, 2152UL },
+	{ 1, ANALOGUE_AVR_OFFSET__ACCESS_LEVEL, 16, ANALOGUE_AVR_OFFSET__MIN_VALUE, ANALOGUE_AVR_OFFSET__MAX_VALUE, ANALOGUE_AVR_OFFSET__FACTORY_SETTING, 2153UL },
+	{ 1, ANALOGUE_AVR_MAX_LIMIT__ACCESS_LEVEL, 16, ANALOGUE_AVR_MAX_LIMIT__MIN_VALUE, ANALOGUE_AVR_MAX_LIMIT__MAX_VALUE, ANALOGUE_AVR_MAX_LIMIT__FACTORY_SETTING, 2169UL },
+	{ 1, ANALOGUE_AVR_MIN_LIMIT__ACCESS_LEVEL, 16, ANALOGUE_AVR_MIN_LIMIT__MIN_VALUE, ANALOGUE_AVR_MIN_LIMIT__MAX_VALUE, ANALOGUE_AVR_MIN_LIMIT__FACTORY_SETTING, 2185UL },
+	{ 1, GEN_VOLTAGE_REG_CONST__ACCESS_LEVEL, 7, GEN_VOLTAGE_REG_CONST__MIN_VALUE, GEN_VOLTAGE_REG_CONST__MAX_VALUE, GEN_VOLTAGE_REG_CONST__FACTORY_SETTING, 2201UL },
+	{ 1, GEN_VOLT_REG_MAX_DEV__ACCESS_LEVEL, 19, GEN_VOLT_REG_MAX_DEV__MIN_VALUE, GEN_VOLT_REG_MAX_DEV__MAX_VALUE, GEN_VOLT_REG_MAX_DEV__FACTORY_SETTING, 2208UL },
+	{ 1, GEN_VOLT_REG_MAX_DEV_TIMEOUT__ACCESS_LEVEL, 20, GEN_VOLT_REG_MAX_DEV_TIMEOUT__MIN_VALUE, GEN_VOLT_REG_MAX_DEV_TIMEOUT__MAX_VALUE, GEN_VOLT_REG_MAX_DEV_TIMEOUT__FACTORY_SETTING, 2227UL },
+	{ 1, GEN_VAR_REG_CONST__ACCESS_LEVEL, 7, GEN_VAR_REG_CONST__MIN_VALUE, GEN_VAR_REG_CONST__MAX_VALUE, GEN_VAR_REG_CONST__FACTORY_SETTING, 2247UL },
+	{ 1, GEN_VAR_REG_MAX_DEV__ACCESS_LEVEL, 22, GEN_VAR_REG_MAX_DEV__MIN_VALUE, GEN_VAR_REG_MAX_DEV__MAX_VALUE, GEN_VAR_REG_MAX_DEV__FACTORY_SETTING, 2254UL },
+	{ 1, GEN_VAR_REG_MAX_DEV_TIMEOUT__ACCESS_LEVEL, 20, GEN_VAR_REG_MAX_DEV_TIMEOUT__MIN_VALUE, GEN_VAR_REG_MAX_DEV_TIMEOUT__MAX_VALUE, GEN_VAR_REG_MAX_DEV_TIMEOUT__FACTORY_SETTING, 2276UL },
+	{ 1, NKK_EMERGENCY_COOLER_OPTION__ACCESS_LEVEL, 2, NKK_EMERGENCY_COOLER_OPTION__MIN_VALUE, NKK_EMERGENCY_COOLER_OPTION__MAX_VALUE, NKK_EMERGENCY_COOLER_OPTION__FACTORY_SETTING, 2296UL },
+	{ 1, EMER_COOL_STAGE_2_TIMER__ACCESS_LEVEL, 20, EMER_COOL_STAGE_2_TIMER__MIN_VALUE, EMER_COOL_STAGE_2_TIMER__MAX_VALUE, EMER_COOL_STAGE_2_TIMER__FACTORY_SETTING, 2298UL },
+	{ 1, NKK_CONTROL_SIGNAL_FOR_VALVE_POSITION_ZERO__ACCESS_LEVEL, 2, NKK_CONTROL_SIGNAL_FOR_VALVE_POSITION_ZERO__MIN_VALUE, NKK_CONTROL_SIGNAL_FOR_VALVE_POSITION_ZERO__MAX_VALUE, NKK_CONTROL_SIGNAL_FOR_VALVE_POSITION_ZERO__FACTORY_SETTING, 2318UL },
+	{ 1, NKK_TEMP_SETPOINT_EMERGENCY_COOLER__ACCESS_LEVEL, 10, NKK_TEMP_SETPOINT_EMERGENCY_COOLER__MIN_VALUE, NKK_TEMP_SETPOINT_EMERGENCY_COOLER__MAX_VALUE, NKK_TEMP_SETPOINT_EMERGENCY_COOLER__FACTORY_SETTING, 2320UL },
+	{ 1, NKK_MIN_TEMP_EMERGENCY_COOLER__ACCESS_LEVEL, 10, NKK_MIN_TEMP_EMERGENCY_COOLER__MIN_VALUE, NKK_MIN_TEMP_EMERGENCY_COOLER__MAX_VALUE, NKK_MIN_TEMP_EMERGENCY_COOLER__FACTORY_SETTING, 2330UL },
+	{ 1, EMER_COOL_VALVE_REG_CONST_P__ACCESS_LEVEL, 14, EMER_COOL_VALVE_REG_CONST_P__MIN_VALUE, EMER_COOL_VALVE_REG_CONST_P__MAX_VALUE, EMER_COOL_VALVE_REG_CONST_P__FACTORY_SETTING, 2340UL },
+	{ 1, EMER_COOL_VALVE_REG_CONST_I__ACCESS_LEVEL, 14, EMER_COOL_VALVE_REG_CONST_I__MIN_VALUE, EMER_COOL_VALVE_REG_CONST_I__MAX_VALUE, EMER_COOL_VALVE_REG_CONST_I__FACTORY_SETTING, 2354UL },
+	{ 1, EMER_COOL_VALVE_REG_CONST_D__ACCESS_LEVEL, 14, EMER_COOL_VALVE_REG_CONST_D__MIN_VALUE, EMER_COOL_VALVE_REG_CONST_D__MAX_VALUE, EMER_COOL_VALVE_REG_CONST_D__FACTORY_SETTING, 2368UL },
+	{ 1, EMERG_COOLER_NUMBER_OF_STAGES__ACCESS_LEVEL, 3, EMERG_COOLER_NUMBER_OF_STAGES__MIN_VALUE, EMERG_COOLER_NUMBER_OF_STAGES__MAX_VALUE, EMERG_COOLER_NUMBER_OF_STAGES__FACTORY_SETTING, 2382UL },
+	{ 1, EMERG_COOLER_STAGE_SWITCH_ON_COND_VALVE_POS__ACCESS_LEVEL, 10, EMERG_COOLER_STAGE_SWITCH_ON_COND_VALVE_POS__MIN_VALUE, EMERG_COOLER_STAGE_SWITCH_ON_COND_VALVE_POS__MAX_VALUE, EMERG_COOLER_STAGE_SWITCH_ON_COND_VALVE_POS__FACTORY_SETTING, 2385UL },
+	{ 1, EMERG_COOLER_STAGE_SWITCH_OFF_COND_VALVE_POS__ACCESS_LEVEL, 10, EMERG_COOLER_STAGE_SWITCH_OFF_COND_VALVE_POS__MIN_VALUE, EMERG_COOLER_STAGE_SWITCH_OFF_COND_VALVE_POS__MAX_VALUE, EMERG_COOLER_STAGE_SWITCH_OFF_COND_VALVE_POS__FACTORY_SETTING, 2395UL },
+	{ 1, EMERG_COOLER_STAGE_SWITCH_ON_COND_TEMP_RATE__ACCESS_LEVEL, 13, EMERG_COOLER_STAGE_SWITCH_ON_COND_TEMP_RATE__MIN_VALUE, EMERG_COOLER_STAGE_SWITCH_ON_COND_TEMP_RATE__MAX_VALUE, EMERG_COOLER_STAGE_SWITCH_ON_COND_TEMP_RATE__FACTORY_SETTING, 2405UL },
+	{ 1, REG_SETPOINT_ENG_IN_TEMP__ACCESS_LEVEL, 9, REG_SETPOINT_ENG_IN_TEMP__MIN_VALUE, REG_SETPOINT_ENG_IN_TEMP__MAX_VALUE, REG_SETPOINT_ENG_IN_TEMP__FACTORY_SETTING, 2418UL },
+	{ 1, REG_SETPOINT_ENG_IN_TEMP_AT50__ACCESS_LEVEL, 9, REG_SETPOINT_ENG_IN_TEMP_AT50__MIN_VALUE, REG_SETPOINT_ENG_IN_TEMP_AT50__MAX_VALUE, REG_SETPOINT_ENG_IN_TEMP_AT50__FACTORY_SETTING, 2427UL },
+	{ 1, ENG_WATER_INLET_MAX_TEMP__ACCESS_LEVEL, 9, ENG_WATER_INLET_MAX_TEMP__MIN_VALUE, ENG_WATER_INLET_MAX_TEMP__MAX_VALUE, ENG_WATER_INLET_MAX_TEMP__FACTORY_SETTING, 2436UL },
+	{ 1, ENG_WATER_INLET_MAX_TEMP_DELAY__ACCESS_LEVEL, 13, ENG_WATER_INLET_MAX_TEMP_DELAY__MIN_VALUE, ENG_WATER_INLET_MAX_TEMP_DELAY__MAX_VALUE, ENG_WATER_INLET_MAX_TEMP_DELAY__FACTORY_SETTING, 2445UL },
+	{ 1, ENG_WATER_EXIT_MAX_TEMP__ACCESS_LEVEL, 9, ENG_WATER_EXIT_MAX_TEMP__MIN_VALUE, ENG_WATER_EXIT_MAX_TEMP__MAX_VALUE, ENG_WATER_EXIT_MAX_TEMP__FACTORY_SETTING, 2458UL },
+	{ 1, ENG_WATER_EXIT_MAX_TEMP_DELAY__ACCESS_LEVEL, 13, ENG_WATER_EXIT_MAX_TEMP_DELAY__MIN_VALUE, ENG_WATER_EXIT_MAX_TEMP_DELAY__MAX_VALUE, ENG_WATER_EXIT_MAX_TEMP_DELAY__FACTORY_SETTING, 2467UL },
+	{ 1, COOL_PUMP_POST_RUN__ACCESS_LEVEL, 20, COOL_PUMP_POST_RUN__MIN_VALUE, COOL_PUMP_POST_RUN__MAX_VALUE, COOL_PUMP_POST_RUN__FACTORY_SETTING, 2480UL },
+	{ 1, COOL_PUMP_POST_RUN_OFF_TEMP__ACCESS_LEVEL, 11, COOL_PUMP_POST_RUN_OFF_TEMP__MIN_VALUE, COOL_PUMP_POST_RUN_OFF_TEMP__MAX_VALUE, COOL_PUMP_POST_RUN_OFF_TEMP__FACTORY_SETTING, 2500UL },
+	{ 1, GKK_INTERCOOLER_OPTION__ACCESS_LEVEL, 1, GKK_INTERCOOLER_OPTION__MIN_VALUE, GKK_INTERCOOLER_OPTION__MAX_VALUE, GKK_INTERCOOLER_OPTION__FACTORY_SETTING, 2511UL },
+	{ 1, GKK_CONTROL_SIGNAL_FOR_VALVE_POSITION_ZERO__ACCESS_LEVEL, 2, GKK_CONTROL_SIGNAL_FOR_VALVE_POSITION_ZERO__MIN_VALUE, GKK_CONTROL_SIGNAL_FOR_VALVE_POSITION_ZERO__MAX_VALUE, GKK_CONTROL_SIGNAL_FOR_VALVE_POSITION_ZERO__FACTORY_SETTING, 2512UL },
+	{ 1, GKK_INTERCOOLER_VALVE_REGULATES_ON_WATER__ACCESS_LEVEL, 1, GKK_INTERCOOLER_VALVE_REGULATES_ON_WATER__MIN_VALUE, GKK_INTERCOOLER_VALVE_REGULATES_ON_WATER__MAX_VALUE, GKK_INTERCOOLER_VALVE_REGULATES_ON_WATER__FACTORY_SETTING, 2514UL },
+	{ 1, GKK_INTERCOOLER_TEMP_SETPOINT__ACCESS_LEVEL, 9, GKK_INTERCOOLER_TEMP_SETPOINT__MIN_VALUE, GKK_INTERCOOLER_TEMP_SETPOINT__MAX_VALUE, GKK_INTERCOOLER_TEMP_SETPOINT__FACTORY_SETTING, 2515UL },
+	{ 1, GKK_INTERCOOLER_WATER_REG_KP__ACCESS_LEVEL, 14, GKK_INTERCOOLER_WATER_REG_KP__MIN_VALUE, GKK_INTERCOOLER_WATER_REG_KP__MAX_VALUE, GKK_INTERCOOLER_WATER_REG_KP__FACTORY_SETTING, 2524UL },
+	{ 1, GKK_INTERCOOLER_WATER_REG_KI__ACCESS_LEVEL, 14, GKK_INTERCOOLER_WATER_REG_KI__MIN_VALUE, GKK_INTERCOOLER_WATER_REG_KI__MAX_VALUE, GKK_INTERCOOLER_WATER_REG_KI__FACTORY_SETTING, 2538UL },
+	{ 1, GKK_INTERCOOLER_WATER_REG_KD__ACCESS_LEVEL, 14, GKK_INTERCOOLER_WATER_REG_KD__MIN_VALUE, GKK_INTERCOOLER_WATER_REG_KD__MAX_VALUE, GKK_INTERCOOLER_WATER_REG_KD__FACTORY_SETTING, 2552UL },
+	{ 1, GKK_INTERCOOLER_WATER_TEMP_MAX__ACCESS_LEVEL, 9, GKK_INTERCOOLER_WATER_TEMP_MAX__MIN_VALUE, GKK_INTERCOOLER_WATER_TEMP_MAX__MAX_VALUE, GKK_INTERCOOLER_WATER_TEMP_MAX__FACTORY_SETTING, 2566UL },
+	{ 1, GKK_INTERCOOLER_NUMBER_OF_STAGES__ACCESS_LEVEL, 3, GKK_INTERCOOLER_NUMBER_OF_STAGES__MIN_VALUE, GKK_INTERCOOLER_NUMBER_OF_STAGES__MAX_VALUE, GKK_INTERCOOLER_NUMBER_OF_STAGES__FACTORY_SETTING, 2575UL },
+	{ 1, GKK_INTERCOOLER_STAGE_SWITCH_ON_COND_VALVE_POS__ACCESS_LEVEL, 10, GKK_INTERCOOLER_STAGE_SWITCH_ON_COND_VALVE_POS__MIN_VALUE, GKK_INTERCOOLER_STAGE_SWITCH_ON_COND_VALVE_POS__MAX_VALUE, GKK_INTERCOOLER_STAGE_SWITCH_ON_COND_VALVE_POS__FACTORY_SETTING, 2578UL },
+	{ 1, GKK_INTERCOOLER_STAGE_SWITCH_OFF_COND_VALVE_POS__ACCESS_LEVEL, 10, GKK_INTERCOOLER_STAGE_SWITCH_OFF_COND_VALVE_POS__MIN_VALUE, GKK_INTERCOOLER_STAGE_SWITCH_OFF_COND_VALVE_POS__MAX_VALUE, GKK_INTERCOOLER_STAGE_SWITCH_OFF_COND_VALVE_POS__FACTORY_SETTING, 2588UL },
+	{ 1, GKK_INTERCOOLER_STAGE_SWITCH_ON_COND_TEMP_RATE__ACCESS_LEVEL, 13, GKK_INTERCOOLER_STAGE_SWITCH_ON_COND_TEMP_RATE__MIN_VALUE, GKK_INTERCOOLER_STAGE_SWITCH_ON_COND_TEMP_RATE__MAX_VALUE, GKK_INTERCOOLER_STAGE_SWITCH_ON_COND_TEMP_RATE__FACTORY_SETTING, 2598UL },
+	{ 1, GKK_INTERCOOLER_STAGE_SWITCH_OFF_DELAY__ACCESS_LEVEL, 21, GKK_INTERCOOLER_STAGE_SWITCH_OFF_DELAY__MIN_VALUE, GKK_INTERCOOLER_STAGE_SWITCH_OFF_DELAY__MAX_VALUE, GKK_INTERCOOLER_STAGE_SWITCH_OFF_DELAY__FACTORY_SETTING, 2611UL },
+	{ 1, ENG_COOLING_WATER_PRES_VALUE_FOR_20mA__ACCESS_LEVEL, 10, ENG_COOLING_WATER_PRES_VALUE_FOR_20mA__MIN_VALUE, ENG_COOLING_WATER_PRES_VALUE_FOR_20mA__MAX_VALUE, ENG_COOLING_WATER_PRES_VALUE_FOR_20mA__FACTORY_SETTING, 2632UL },
+	{ 1, ENG_COOLING_WATER_PRES_MIN_WARNING__ACCESS_LEVEL, 9, ENG_COOLING_WATER_PRES_MIN_WARNING__MIN_VALUE, ENG_COOLING_WATER_PRES_MIN_WARNING__MAX_VALUE, ENG_COOLING_WATER_PRES_MIN_WARNING__FACTORY_SETTING, 2642UL },
+	{ 1, ENG_COOLING_WATER_PRES_MAX_WARNING__ACCESS_LEVEL, 10, ENG_COOLING_WATER_PRES_MAX_WARNING__MIN_VALUE, ENG_COOLING_WATER_PRES_MAX_WARNING__MAX_VALUE, ENG_COOLING_WATER_PRES_MAX_WARNING__FACTORY_SETTING, 2651UL },
+	{ 1, ENG_COOLING_WATER_PRES_MIN_FAULT__ACCESS_LEVEL, 9, ENG_COOLING_WATER_PRES_MIN_FAULT__MIN_VALUE, ENG_COOLING_WATER_PRES_MIN_FAULT__MAX_VALUE, ENG_COOLING_WATER_PRES_MIN_FAULT__FACTORY_SETTING, 2661UL },
+	{ 1, ENG_COOLING_WATER_PRES_MAX_FAULT__ACCESS_LEVEL, 10, ENG_COOLING_WATER_PRES_MAX_FAULT__MIN_VALUE, ENG_COOLING_WATER_PRES_MAX_FAULT__MAX_VALUE, ENG_COOLING_WATER_PRES_MAX_FAULT__FACTORY_SETTING, 2670UL },
+	{ 1, HKS_OPTION_HW_AFTER_HEAT_EXCHANGER__ACCESS_LEVEL, 1, HKS_OPTION_HW_AFTER_HEAT_EXCHANGER__MIN_VALUE, HKS_OPTION_HW_AFTER_HEAT_EXCHANGER__MAX_VALUE, HKS_OPTION_HW_AFTER_HEAT_EXCHANGER__FACTORY_SETTING, 2680UL },
+	{ 1, HKS_HW_OVERTEMP_AFTER_HEAT_EXCHANGER__ACCESS_LEVEL, 10, HKS_HW_OVERTEMP_AFTER_HEAT_EXCHANGER__MIN_VALUE, HKS_HW_OVERTEMP_AFTER_HEAT_EXCHANGER__MAX_VALUE, HKS_HW_OVERTEMP_AFTER_HEAT_EXCHANGER__FACTORY_SETTING, 2681UL },
+	{ 1, HKS_OPTION_HW_FLOW__ACCESS_LEVEL, 1, HKS_OPTION_HW_FLOW__MIN_VALUE, HKS_OPTION_HW_FLOW__MAX_VALUE, HKS_OPTION_HW_FLOW__FACTORY_SETTING, 2691UL },
+	{ 1, HKS_HW_OVERTEMP_FLOW__ACCESS_LEVEL, 11, HKS_HW_OVERTEMP_FLOW__MIN_VALUE, HKS_HW_OVERTEMP_FLOW__MAX_VALUE, HKS_HW_OVERTEMP_FLOW__FACTORY_SETTING, 2692UL },
+	{ 1, HKS_OPTION_HW_RETURN__ACCESS_LEVEL, 1, HKS_OPTION_HW_RETURN__MIN_VALUE, HKS_OPTION_HW_RETURN__MAX_VALUE, HKS_OPTION_HW_RETURN__FACTORY_SETTING, 2703UL },
+	{ 1, CH4_OPTION_CONTROL__ACCESS_LEVEL, 1, CH4_OPTION_CONTROL__MIN_VALUE, CH4_OPTION_CONTROL__MAX_VALUE, CH4_OPTION_CONTROL__FACTORY_SETTING, 2704UL },
+	{ 1, CH4_PERCENT_VALUE_FOR_20mA__ACCESS_LEVEL, 11, CH4_PERCENT_VALUE_FOR_20mA__MIN_VALUE, CH4_PERCENT_VALUE_FOR_20mA__MAX_VALUE, CH4_PERCENT_VALUE_FOR_20mA__FACTORY_SETTING, 2705UL },
+	{ 1, CH4_STOP_LIMIT__ACCESS_LEVEL, 9, CH4_STOP_LIMIT__MIN_VALUE, CH4_STOP_LIMIT__MAX_VALUE, CH4_STOP_LIMIT__FACTORY_SETTING, 2716UL },
+	{ 1, CH4_LIMIT_FOR_MAXLOAD__ACCESS_LEVEL, 10, CH4_LIMIT_FOR_MAXLOAD__MIN_VALUE, CH4_LIMIT_FOR_MAXLOAD__MAX_VALUE, CH4_LIMIT_FOR_MAXLOAD__FACTORY_SETTING, 2725UL },
+	{ 1, CH4_MINLOAD__ACCESS_LEVEL, 10, CH4_MINLOAD__MIN_VALUE, CH4_MINLOAD__MAX_VALUE, CH4_MINLOAD__FACTORY_SETTING, 2735UL },
+	{ 1, CH4_LIMIT_FOR_MINLOAD__ACCESS_LEVEL, 10, CH4_LIMIT_FOR_MINLOAD__MIN_VALUE, CH4_LIMIT_FOR_MINLOAD__MAX_VALUE, CH4_LIMIT_FOR_MINLOAD__FACTORY_SETTING, 2745UL },
+	{ 1, CH4_STANDARD_MIX__ACCESS_LEVEL, 10, CH4_STANDARD_MIX__MIN_VALUE, CH4_STANDARD_MIX__MAX_VALUE, CH4_STANDARD_MIX__FACTORY_SETTING, 2755UL },
+	{ 1, CH4_MIX_ADJUSTMENT__ACCESS_LEVEL, 6, CH4_MIX_ADJUSTMENT__MIN_VALUE, CH4_MIX_ADJUSTMENT__MAX_VALUE, CH4_MIX_ADJUSTMENT__FACTORY_SETTING, 2765UL },
+	{ 1, MPI_OPTION_PEAK_SHAVING__ACCESS_LEVEL, 1, MPI_OPTION_PEAK_SHAVING__MIN_VALUE, MPI_OPTION_PEAK_SHAVING__MAX_VALUE, MPI_OPTION_PEAK_SHAVING__FACTORY_SETTING, 2771UL },
+	{ 1, MPI_IMPORT_SIGNAL_AT_4MA__ACCESS_LEVEL, 25, MPI_IMPORT_SIGNAL_AT_4MA__MIN_VALUE, MPI_IMPORT_SIGNAL_AT_4MA__MAX_VALUE, MPI_IMPORT_SIGNAL_AT_4MA__FACTORY_SETTING, 2772UL },
+	{ 1, MPI_IMPORT_SIGNAL_AT_20MA__ACCESS_LEVEL, 24, MPI_IMPORT_SIGNAL_AT_20MA__MIN_VALUE, MPI_IMPORT_SIGNAL_AT_20MA__MAX_VALUE, MPI_IMPORT_SIGNAL_AT_20MA__FACTORY_SETTING, 2797UL },
+	{ 1, MPI_SET_MAINS_POWER_IMPORT_DAY__ACCESS_LEVEL, 25, MPI_SET_MAINS_POWER_IMPORT_DAY__MIN_VALUE, MPI_SET_MAINS_POWER_IMPORT_DAY__MAX_VALUE, MPI_SET_MAINS_POWER_IMPORT_DAY__FACTORY_SETTING, 2821UL },
+	{ 1, MPI_SET_MAINS_POWER_IMPORT_NIGHT__ACCESS_LEVEL, 25, MPI_SET_MAINS_POWER_IMPORT_NIGHT__MIN_VALUE, MPI_SET_MAINS_POWER_IMPORT_NIGHT__MAX_VALUE, MPI_SET_MAINS_POWER_IMPORT_NIGHT__FACTORY_SETTING, 2846UL },
+	{ 1, MPI_STARTING_HOUR_DAYTIME__ACCESS_LEVEL, 5, MPI_STARTING_HOUR_DAYTIME__MIN_VALUE, MPI_STARTING_HOUR_DAYTIME__MAX_VALUE, MPI_STARTING_HOUR_DAYTIME__FACTORY_SETTING, 2871UL },
+	{ 1, MPI_STARTING_HOUR_NIGHTTIME__ACCESS_LEVEL, 5, MPI_STARTING_HOUR_NIGHTTIME__MIN_VALUE, MPI_STARTING_HOUR_NIGHTTIME__MAX_VALUE, MPI_STARTING_HOUR_NIGHTTIME__FACTORY_SETTING, 2876UL },
+	{ 1, MPI_START_GENSET_ABOVE__ACCESS_LEVEL, 25, MPI_START_GENSET_ABOVE__MIN_VALUE, MPI_START_GENSET_ABOVE__MAX_VALUE, MPI_START_GENSET_ABOVE__FACTORY_SETTING, 2881UL },
+	{ 1, MPI_START_GENSET_DELAY__ACCESS_LEVEL, 22, MPI_START_GENSET_DELAY__MIN_VALUE, MPI_START_GENSET_DELAY__MAX_VALUE, MPI_START_GENSET_DELAY__FACTORY_SETTING, 2906UL },
+	{ 1, MPI_STOP_GENSET_BELOW__ACCESS_LEVEL, 25, MPI_STOP_GENSET_BELOW__MIN_VALUE, MPI_STOP_GENSET_BELOW__MAX_VALUE, MPI_STOP_GENSET_BELOW__FACTORY_SETTING, 2928UL },
+	{ 1, MPI_STOP_GENSET_DELAY__ACCESS_LEVEL, 22, MPI_STOP_GENSET_DELAY__MIN_VALUE, MPI_STOP_GENSET_DELAY__MAX_VALUE, MPI_STOP_GENSET_DELAY__FACTORY_SETTING, 2953UL },
+	{ 1, HEAT_CONTROL_OPTION__ACCESS_LEVEL, 1, HEAT_CONTROL_OPTION__MIN_VALUE, HEAT_CONTROL_OPTION__MAX_VALUE, HEAT_CONTROL_OPTION__FACTORY_SETTING, 2975UL },
+	{ 1, HEAT_CONTROL_FLOW_MIN__ACCESS_LEVEL, 10, HEAT_CONTROL_FLOW_MIN__MIN_VALUE, HEAT_CONTROL_FLOW_MIN__MAX_VALUE, HEAT_CONTROL_FLOW_MIN__FACTORY_SETTING, 2976UL },
+	{ 1, HEAT_CONTROL_RETURN_MAX__ACCESS_LEVEL, 10, HEAT_CONTROL_RETURN_MAX__MIN_VALUE, HEAT_CONTROL_RETURN_MAX__MAX_VALUE, HEAT_CONTROL_RETURN_MAX__FACTORY_SETTING, 2986UL },
+	{ 1, HEAT_CONTROL_PAUSE__ACCESS_LEVEL, 26, HEAT_CONTROL_PAUSE__MIN_VALUE, HEAT_CONTROL_PAUSE__MAX_VALUE, HEAT_CONTROL_PAUSE__FACTORY_SETTING, 2996UL },
+	{ 1, EPF_OPTION__ACCESS_LEVEL, 1, EPF_OPTION__MIN_VALUE, EPF_OPTION__MAX_VALUE, EPF_OPTION__FACTORY_SETTING, 3022UL },
+	{ 1, EPF_UNDERVOLTAGE__ACCESS_LEVEL, 18, EPF_UNDERVOLTAGE__MIN_VALUE, EPF_UNDERVOLTAGE__MAX_VALUE, EPF_UNDERVOLTAGE__FACTORY_SETTING, 3023UL },
+	{ 1, EPF_MAINS_FAILURE_DELAY__ACCESS_LEVEL, 20, EPF_MAINS_FAILURE_DELAY__MIN_VALUE, EPF_MAINS_FAILURE_DELAY__MAX_VALUE, EPF_MAINS_FAILURE_DELAY__FACTORY_SETTING, 3041UL },
+	{ 1, EPF_RESYNCHRONISING__ACCESS_LEVEL, 2, EPF_RESYNCHRONISING__MIN_VALUE, EPF_RESYNCHRONISING__MAX_VALUE, EPF_RESYNCHRONISING__FACTORY_SETTING, 3061UL },
+	{ 1, EPF_MAINS_RECOVER_TIME__ACCESS_LEVEL, 21, EPF_MAINS_RECOVER_TIME__MIN_VALUE, EPF_MAINS_RECOVER_TIME__MAX_VALUE, EPF_MAINS_RECOVER_TIME__FACTORY_SETTING, 3063UL },
+	{ 1, EPF_MB_OPEN_AFTER_ENGINE_RUNS__ACCESS_LEVEL, 1, EPF_MB_OPEN_AFTER_ENGINE_RUNS__MIN_VALUE, EPF_MB_OPEN_AFTER_ENGINE_RUNS__MAX_VALUE, EPF_MB_OPEN_AFTER_ENGINE_RUNS__FACTORY_SETTING, 3084UL },
+	{ 1, EPF_SWITCH_ON_TIME__ACCESS_LEVEL, 15, EPF_SWITCH_ON_TIME__MIN_VALUE, EPF_SWITCH_ON_TIME__MAX_VALUE, EPF_SWITCH_ON_TIME__FACTORY_SETTING, 3085UL },
+	{ 1, EPF_PROTECTION_SCM09__ACCESS_LEVEL, 2, EPF_PROTECTION_SCM09__MIN_VALUE, EPF_PROTECTION_SCM09__MAX_VALUE, EPF_PROTECTION_SCM09__FACTORY_SETTING, 3100UL },
+	{ 1, UVS_OPTION__ACCESS_LEVEL, 1, UVS_OPTION__MIN_VALUE, UVS_OPTION__MAX_VALUE, UVS_OPTION__FACTORY_SETTING, 3102UL },
+	{ 1, UVS_ACTIVE_ULIMIT__ACCESS_LEVEL, 18, UVS_ACTIVE_ULIMIT__MIN_VALUE, UVS_ACTIVE_ULIMIT__MAX_VALUE, UVS_ACTIVE_ULIMIT__FACTORY_SETTING, 3103UL },
+	{ 1, UVS_RECOVER_TIME__ACCESS_LEVEL, 17, UVS_RECOVER_TIME__MIN_VALUE, UVS_RECOVER_TIME__MAX_VALUE, UVS_RECOVER_TIME__FACTORY_SETTING, 3121UL },
+	{ 1, UVS_ULIMIT1__ACCESS_LEVEL, 19, UVS_ULIMIT1__MIN_VALUE, UVS_ULIMIT1__MAX_VALUE, UVS_ULIMIT1__FACTORY_SETTING, 3138UL },
+	{ 1, UVS_DELAY_TIME1__ACCESS_LEVEL, 9, UVS_DELAY_TIME1__MIN_VALUE, UVS_DELAY_TIME1__MAX_VALUE, UVS_DELAY_TIME1__FACTORY_SETTING, 3157UL },
+	{ 1, UVS_ULIMIT2__ACCESS_LEVEL, 19, UVS_ULIMIT2__MIN_VALUE, UVS_ULIMIT2__MAX_VALUE, UVS_ULIMIT2__FACTORY_SETTING, 3166UL },
+	{ 1, UVS_DELAY_TIME2__ACCESS_LEVEL, 14, UVS_DELAY_TIME2__MIN_VALUE, UVS_DELAY_TIME2__MAX_VALUE, UVS_DELAY_TIME2__FACTORY_SETTING, 3185UL },
+	{ 1, UVS_ULIMIT3__ACCESS_LEVEL, 19, UVS_ULIMIT3__MIN_VALUE, UVS_ULIMIT3__MAX_VALUE, UVS_ULIMIT3__FACTORY_SETTING, 3199UL },
+	{ 1, UVS_DELAY_TIME3__ACCESS_LEVEL, 14, UVS_DELAY_TIME3__MIN_VALUE, UVS_DELAY_TIME3__MAX_VALUE, UVS_DELAY_TIME3__FACTORY_SETTING, 3218UL },
+	{ 1, REC_GRID_VOLTAGE_MIN__ACCESS_LEVEL, 15, REC_GRID_VOLTAGE_MIN__MIN_VALUE, REC_GRID_VOLTAGE_MIN__MAX_VALUE, REC_GRID_VOLTAGE_MIN__FACTORY_SETTING, 3232UL },
+	{ 1, REC_GRID_VOLTAGE_MAX__ACCESS_LEVEL, 15, REC_GRID_VOLTAGE_MAX__MIN_VALUE, REC_GRID_VOLTAGE_MAX__MAX_VALUE, REC_GRID_VOLTAGE_MAX__FACTORY_SETTING, 3247UL },
+	{ 1, REC_GRID_FREQUENCY_MIN__ACCESS_LEVEL, 12, REC_GRID_FREQUENCY_MIN__MIN_VALUE, REC_GRID_FREQUENCY_MIN__MAX_VALUE, REC_GRID_FREQUENCY_MIN__FACTORY_SETTING, 3262UL },
+	{ 1, REC_GRID_FREQUENCY_MAX__ACCESS_LEVEL, 12, REC_GRID_FREQUENCY_MAX__MIN_VALUE, REC_GRID_FREQUENCY_MAX__MAX_VALUE, REC_GRID_FREQUENCY_MAX__FACTORY_SETTING, 3274UL },
+	{ 1, AIR_TEMP_4MA__ACCESS_LEVEL, 12, AIR_TEMP_4MA__MIN_VALUE, AIR_TEMP_4MA__MAX_VALUE, AIR_TEMP_4MA__FACTORY_SETTING, 3286UL },
+	{ 1, AIR_TEMP_20MA__ACCESS_LEVEL, 12, AIR_TEMP_20MA__MIN_VALUE, AIR_TEMP_20MA__MAX_VALUE, AIR_TEMP_20MA__FACTORY_SETTING, 3298UL },
+	{ 1, AIR_ACOUSTIC_HOOD__ACCESS_LEVEL, 1, AIR_ACOUSTIC_HOOD__MIN_VALUE, AIR_ACOUSTIC_HOOD__MAX_VALUE, AIR_ACOUSTIC_HOOD__FACTORY_SETTING, 3310UL },
+	{ 1, AIR_FLAPS_OPTION__ACCESS_LEVEL, 1, AIR_FLAPS_OPTION__MIN_VALUE, AIR_FLAPS_OPTION__MAX_VALUE, AIR_FLAPS_OPTION__FACTORY_SETTING, 3311UL },
+	{ 1, AIR_FLAPS_CLOSE_TIMEOUT__ACCESS_LEVEL, 22, AIR_FLAPS_CLOSE_TIMEOUT__MIN_VALUE, AIR_FLAPS_CLOSE_TIMEOUT__MAX_VALUE, AIR_FLAPS_CLOSE_TIMEOUT__FACTORY_SETTING, 3312UL },
+	{ 1, AIR_FLAPS_OPEN_TIMEOUT__ACCESS_LEVEL, 22, AIR_FLAPS_OPEN_TIMEOUT__MIN_VALUE, AIR_FLAPS_OPEN_TIMEOUT__MAX_VALUE, AIR_FLAPS_OPEN_TIMEOUT__FACTORY_SETTING, 3334UL },
+	{ 1, ROOM_AIR_VENT_STAGE_2__ACCESS_LEVEL, 10, ROOM_AIR_VENT_STAGE_2__MIN_VALUE, ROOM_AIR_VENT_STAGE_2__MAX_VALUE, ROOM_AIR_VENT_STAGE_2__FACTORY_SETTING, 3356UL },
+	{ 1, ROOM_AIR_VENT_STAGE_2_OFF_DELAY__ACCESS_LEVEL, 22, ROOM_AIR_VENT_STAGE_2_OFF_DELAY__MIN_VALUE, ROOM_AIR_VENT_STAGE_2_OFF_DELAY__MAX_VALUE, ROOM_AIR_VENT_STAGE_2_OFF_DELAY__FACTORY_SETTING, 3366UL },
+	{ 1, AIR_OPTION_ROOM_AIR_CONTROL__ACCESS_LEVEL, 2, AIR_OPTION_ROOM_AIR_CONTROL__MIN_VALUE, AIR_OPTION_ROOM_AIR_CONTROL__MAX_VALUE, AIR_OPTION_ROOM_AIR_CONTROL__FACTORY_SETTING, 3388UL },
+	{ 1, AIR_FAN_ON_WITH_ENG_RUNNING__ACCESS_LEVEL, 1, AIR_FAN_ON_WITH_ENG_RUNNING__MIN_VALUE, AIR_FAN_ON_WITH_ENG_RUNNING__MAX_VALUE, AIR_FAN_ON_WITH_ENG_RUNNING__FACTORY_SETTING, 3390UL },
+	{ 1, AIR_ROOM_AIR_TEMP_SETPOINT__ACCESS_LEVEL, 9, AIR_ROOM_AIR_TEMP_SETPOINT__MIN_VALUE, AIR_ROOM_AIR_TEMP_SETPOINT__MAX_VALUE, AIR_ROOM_AIR_TEMP_SETPOINT__FACTORY_SETTING, 3391UL },
+	{ 1, AIR_ROOM_AIR_CONTROL_KP__ACCESS_LEVEL, 14, AIR_ROOM_AIR_CONTROL_KP__MIN_VALUE, AIR_ROOM_AIR_CONTROL_KP__MAX_VALUE, AIR_ROOM_AIR_CONTROL_KP__FACTORY_SETTING, 3400UL },
+	{ 1, AIR_ROOM_AIR_CONTROL_KI__ACCESS_LEVEL, 10, AIR_ROOM_AIR_CONTROL_KI__MIN_VALUE, AIR_ROOM_AIR_CONTROL_KI__MAX_VALUE, AIR_ROOM_AIR_CONTROL_KI__FACTORY_SETTING, 3414UL },
+	{ 1, AIR_ROOM_AIR_MAX_TEMP__ACCESS_LEVEL, 10, AIR_ROOM_AIR_MAX_TEMP__MIN_VALUE, AIR_ROOM_AIR_MAX_TEMP__MAX_VALUE, AIR_ROOM_AIR_MAX_TEMP__FACTORY_SETTING, 3424UL },
+	{ 1, ENG_LOAD_RED_WATER_RAMP__ACCESS_LEVEL, 17, ENG_LOAD_RED_WATER_RAMP__MIN_VALUE, ENG_LOAD_RED_WATER_RAMP__MAX_VALUE, ENG_LOAD_RED_WATER_RAMP__FACTORY_SETTING, 3434UL },
+	{ 1, ENG_LOAD_RED_WATER_START_VALUE__ACCESS_LEVEL, 9, ENG_LOAD_RED_WATER_START_VALUE__MIN_VALUE, ENG_LOAD_RED_WATER_START_VALUE__MAX_VALUE, ENG_LOAD_RED_WATER_START_VALUE__FACTORY_SETTING, 3451UL },
+	{ 1, ENG_LOAD_RED_OIL_RAMP__ACCESS_LEVEL, 17, ENG_LOAD_RED_OIL_RAMP__MIN_VALUE, ENG_LOAD_RED_OIL_RAMP__MAX_VALUE, ENG_LOAD_RED_OIL_RAMP__FACTORY_SETTING, 3460UL },
+	{ 1, ENG_LOAD_RED_OIL_START_VALUE__ACCESS_LEVEL, 10, ENG_LOAD_RED_OIL_START_VALUE__MIN_VALUE, ENG_LOAD_RED_OIL_START_VALUE__MAX_VALUE, ENG_LOAD_RED_OIL_START_VALUE__FACTORY_SETTING, 3477UL },
+	{ 1, ENG_LOAD_RED_EXHAUST_RAMP__ACCESS_LEVEL, 17, ENG_LOAD_RED_EXHAUST_RAMP__MIN_VALUE, ENG_LOAD_RED_EXHAUST_RAMP__MAX_VALUE, ENG_LOAD_RED_EXHAUST_RAMP__FACTORY_SETTING, 3487UL },
+	{ 1, ENG_LOAD_RED_EXHAUST_START_VALUE__ACCESS_LEVEL, 13, ENG_LOAD_RED_EXHAUST_START_VALUE__MIN_VALUE, ENG_LOAD_RED_EXHAUST_START_VALUE__MAX_VALUE, ENG_LOAD_RED_EXHAUST_START_VALUE__FACTORY_SETTING, 3504UL },
+	{ 1, SERVICE_TIMER_1__ACCESS_LEVEL, 26, SERVICE_TIMER_1__MIN_VALUE, SERVICE_TIMER_1__MAX_VALUE, SERVICE_TIMER_1__FACTORY_SETTING, 3517UL },
+	{ 1, SERVICE_TIMER_2__ACCESS_LEVEL, 26, SERVICE_TIMER_2__MIN_VALUE, SERVICE_TIMER_2__MAX_VALUE, SERVICE_TIMER_2__FACTORY_SETTING, 3543UL },
+	{ 1, SERVICE_TIMER_3__ACCESS_LEVEL, 26, SERVICE_TIMER_3__MIN_VALUE, SERVICE_TIMER_3__MAX_VALUE, SERVICE_TIMER_3__FACTORY_SETTING, 3569UL },
+	{ 1, OIL_SER_DRAIN_POSTRUN__ACCESS_LEVEL, 19, OIL_SER_DRAIN_POSTRUN__MIN_VALUE, OIL_SER_DRAIN_POSTRUN__MAX_VALUE, OIL_SER_DRAIN_POSTRUN__FACTORY_SETTING, 3595UL },
+	{ 1, START_ATTEMPT_COUNTER__ACCESS_LEVEL, 31, START_ATTEMPT_COUNTER__MIN_VALUE, START_ATTEMPT_COUNTER__MAX_VALUE, START_ATTEMPT_COUNTER__FACTORY_SETTING, 3614UL },
+	{ 1, KWH_PRODUCTION_COUNTER__ACCESS_LEVEL, 31, KWH_PRODUCTION_COUNTER__MIN_VALUE, KWH_PRODUCTION_COUNTER__MAX_VALUE, KWH_PRODUCTION_COUNTER__FACTORY_SETTING, 3645UL },
+	{ 1, OPERATING_HOUR_COUNTER__ACCESS_LEVEL, 31, OPERATING_HOUR_COUNTER__MIN_VALUE, OPERATING_HOUR_COUNTER__MAX_VALUE, OPERATING_HOUR_COUNTER__FACTORY_SETTING, 3676UL },
+	{ 1, GCB_SWITCH_OVER_COUNTER__ACCESS_LEVEL, 31, GCB_SWITCH_OVER_COUNTER__MIN_VALUE, GCB_SWITCH_OVER_COUNTER__MAX_VALUE, GCB_SWITCH_OVER_COUNTER__FACTORY_SETTING, 3707UL },
+	{ 1, MCB_SWITCH_OVER_COUNTER__ACCESS_LEVEL, 31, MCB_SWITCH_OVER_COUNTER__MIN_VALUE, MCB_SWITCH_OVER_COUNTER__MAX_VALUE, MCB_SWITCH_OVER_COUNTER__FACTORY_SETTING, 3738UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 3769UL },	// PASSWORD_AKR
+	{ 0, 0, 32, 0L, 0L, 0L, 3801UL },	// PASSWORD1
+	{ 0, 0, 32, 0L, 0L, 0L, 3833UL },	// PASSWORD2
+	{ 0, 0, 32, 0L, 0L, 0L, 3865UL },	// PASSWORD3
+	{ 0, 0, 32, 0L, 0L, 0L, 3897UL },	// PASSWORD4
+	{ 0, 0, 32, 0L, 0L, 0L, 3929UL },	// LOGOFF
+	{ 0, 0, 32, 0L, 0L, 0L, 3961UL },	// KW_OUTPUT_VALUE_FOR_20mA
+	{ 1, BYP_LIMITSTOP_OPTION__ACCESS_LEVEL, 1, BYP_LIMITSTOP_OPTION__MIN_VALUE, BYP_LIMITSTOP_OPTION__MAX_VALUE, BYP_LIMITSTOP_OPTION__FACTORY_SETTING, 3993UL },
+	{ 1, BYP_REG_PERIOD__ACCESS_LEVEL, 20, BYP_REG_PERIOD__MIN_VALUE, BYP_REG_PERIOD__MAX_VALUE, BYP_REG_PERIOD__FACTORY_SETTING, 3994UL },
+	{ 1, BYP_REG_CONST_P__ACCESS_LEVEL, 14, BYP_REG_CONST_P__MIN_VALUE, BYP_REG_CONST_P__MAX_VALUE, BYP_REG_CONST_P__FACTORY_SETTING, 4014UL },
+	{ 1, BYP_REG_CONST_I__ACCESS_LEVEL, 14, BYP_REG_CONST_I__MIN_VALUE, BYP_REG_CONST_I__MAX_VALUE, BYP_REG_CONST_I__FACTORY_SETTING, 4028UL },
+	{ 1, BYP_REG_CONST_D__ACCESS_LEVEL, 14, BYP_REG_CONST_D__MIN_VALUE, BYP_REG_CONST_D__MAX_VALUE, BYP_REG_CONST_D__FACTORY_SETTING, 4042UL },
+	{ 1, REG_SETPOINT_T302__ACCESS_LEVEL, 10, REG_SETPOINT_T302__MIN_VALUE, REG_SETPOINT_T302__MAX_VALUE, REG_SETPOINT_T302__FACTORY_SETTING, 4056UL },
+	{ 1, CHANGE_LANGUAGE__ACCESS_LEVEL, 1, CHANGE_LANGUAGE__MIN_VALUE, CHANGE_LANGUAGE__MAX_VALUE, CHANGE_LANGUAGE__FACTORY_SETTING, 4066UL },
+	{ 1, T302_MAX_LIMIT__ACCESS_LEVEL, 10, T302_MAX_LIMIT__MIN_VALUE, T302_MAX_LIMIT__MAX_VALUE, T302_MAX_LIMIT__FACTORY_SETTING, 4067UL },
+	{ 1, HKS_OPTION_HEATING_CIRCUIT__ACCESS_LEVEL, 1, HKS_OPTION_HEATING_CIRCUIT__MIN_VALUE, HKS_OPTION_HEATING_CIRCUIT__MAX_VALUE, HKS_OPTION_HEATING_CIRCUIT__FACTORY_SETTING, 4077UL },
+	{ 1, HKS_SIGNAL_FOR_VALVE_POSITION_ZERO__ACCESS_LEVEL, 2, HKS_SIGNAL_FOR_VALVE_POSITION_ZERO__MIN_VALUE, HKS_SIGNAL_FOR_VALVE_POSITION_ZERO__MAX_VALUE, HKS_SIGNAL_FOR_VALVE_POSITION_ZERO__FACTORY_SETTING, 4078UL },
+	{ 1, HKS_REG_KP__ACCESS_LEVEL, 14, HKS_REG_KP__MIN_VALUE, HKS_REG_KP__MAX_VALUE, HKS_REG_KP__FACTORY_SETTING, 4080UL },
+	{ 1, HKS_REG_KI__ACCESS_LEVEL, 14, HKS_REG_KI__MIN_VALUE, HKS_REG_KI__MAX_VALUE, HKS_REG_KI__FACTORY_SETTING, 4094UL },
+	{ 1, HKS_REG_KD__ACCESS_LEVEL, 14, HKS_REG_KD__MIN_VALUE, HKS_REG_KD__MAX_VALUE, HKS_REG_KD__FACTORY_SETTING, 4108UL },
+	{ 1, ENG_PREHEATING__ACCESS_LEVEL, 1, ENG_PREHEATING__MIN_VALUE, ENG_PREHEATING__MAX_VALUE, ENG_PREHEATING__FACTORY_SETTING, 4122UL },
+	{ 1, ENG_PREHEATING_TYPE__ACCESS_LEVEL, 2, ENG_PREHEATING_TYPE__MIN_VALUE, ENG_PREHEATING_TYPE__MAX_VALUE, ENG_PREHEATING_TYPE__FACTORY_SETTING, 4123UL },
+	{ 1, ENG_PREHEATING_TEMP__ACCESS_LEVEL, 1, ENG_PREHEATING_TEMP__MIN_VALUE, ENG_PREHEATING_TEMP__MAX_VALUE, ENG_PREHEATING_TEMP__FACTORY_SETTING, 4125UL },
+	{ 1, ENG_PREHEATING_TEMP_ON__ACCESS_LEVEL, 10, ENG_PREHEATING_TEMP_ON__MIN_VALUE, ENG_PREHEATING_TEMP_ON__MAX_VALUE, ENG_PREHEATING_TEMP_ON__FACTORY_SETTING, 4126UL },
+	{ 1, ENG_PREHEATING_TEMP_HYST__ACCESS_LEVEL, 7, ENG_PREHEATING_TEMP_HYST__MIN_VALUE, ENG_PREHEATING_TEMP_HYST__MAX_VALUE, ENG_PREHEATING_TEMP_HYST__FACTORY_SETTING, 4136UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 4143UL },	// IO_TERMINAL_323
+	{ 0, 0, 32, 0L, 0L, 0L, 4175UL },	// IO_TERMINAL_324
+	{ 0, 0, 32, 0L, 0L, 0L, 4207UL },	// IO_TERMINAL_325
+	{ 0, 0, 32, 0L, 0L, 0L, 4239UL },	// IO_TERMINAL_326
+	{ 0, 0, 32, 0L, 0L, 0L, 4271UL },	// IO_TERMINAL_327
+	{ 0, 0, 32, 0L, 0L, 0L, 4303UL },	// IO_TERMINAL_328
+	{ 0, 0, 32, 0L, 0L, 0L, 4335UL },	// IO_TERMINAL_330_331
+	{ 0, 0, 32, 0L, 0L, 0L, 4367UL },	// IO_TERMINAL_332_333
+	{ 0, 0, 32, 0L, 0L, 0L, 4399UL },	// IO_TERMINAL_363
+	{ 0, 0, 32, 0L, 0L, 0L, 4431UL },	// IO_TERMINAL_364
+	{ 0, 0, 32, 0L, 0L, 0L, 4463UL },	// IO_TERMINAL_365
+	{ 0, 0, 32, 0L, 0L, 0L, 4495UL },	// IO_TERMINAL_366
+	{ 0, 0, 32, 0L, 0L, 0L, 4527UL },	// IO_TERMINAL_367
+	{ 0, 0, 32, 0L, 0L, 0L, 4559UL },	// IO_TERMINAL_368
+	{ 0, 0, 32, 0L, 0L, 0L, 4591UL },	// IO_TERMINAL_370_371
+	{ 0, 0, 32, 0L, 0L, 0L, 4623UL },	// IO_TERMINAL_372_373
+	{ 0, 0, 32, 0L, 0L, 0L, 4655UL },	// IO_TERMINAL_335
+	{ 0, 0, 32, 0L, 0L, 0L, 4687UL },	// IO_TERMINAL_336
+	{ 0, 0, 32, 0L, 0L, 0L, 4719UL },	// IO_TERMINAL_337
+	{ 0, 0, 32, 0L, 0L, 0L, 4751UL },	// IO_TERMINAL_338
+	{ 0, 0, 32, 0L, 0L, 0L, 4783UL },	// IO_TERMINAL_339
+	{ 0, 0, 32, 0L, 0L, 0L, 4815UL },	// IO_TERMINAL_375
+	{ 0, 0, 32, 0L, 0L, 0L, 4847UL },	// IO_TERMINAL_376
+	{ 0, 0, 32, 0L, 0L, 0L, 4879UL },	// IO_TERMINAL_377
+	{ 0, 0, 32, 0L, 0L, 0L, 4911UL },	// IO_TERMINAL_378
+	{ 0, 0, 32, 0L, 0L, 0L, 4943UL },	// IO_TERMINAL_379
+	{ 0, 0, 32, 0L, 0L, 0L, 4975UL },	// IO_TERMINAL_301_304
+	{ 0, 0, 32, 0L, 0L, 0L, 5007UL },	// IO_TERMINAL_305_308
+	{ 0, 0, 32, 0L, 0L, 0L, 5039UL },	// IO_TERMINAL_309_312
+	{ 0, 0, 32, 0L, 0L, 0L, 5071UL },	// IO_TERMINAL_341_344
+	{ 0, 0, 32, 0L, 0L, 0L, 5103UL },	// IO_TERMINAL_345_348
+	{ 0, 0, 32, 0L, 0L, 0L, 5135UL },	// IO_TERMINAL_349_352
+	{ 0, 0, 32, 0L, 0L, 0L, 5167UL },	// IO_TERMINAL_313_314
+	{ 0, 0, 32, 0L, 0L, 0L, 5199UL },	// IO_TERMINAL_316_317
+	{ 0, 0, 32, 0L, 0L, 0L, 5231UL },	// IO_TERMINAL_353_354
+	{ 0, 0, 32, 0L, 0L, 0L, 5263UL },	// IO_TERMINAL_356_357
+	{ 0, 0, 32, 0L, 0L, 0L, 5295UL },	// IO_TERMINAL_319_320
+	{ 0, 0, 32, 0L, 0L, 0L, 5327UL },	// IO_TERMINAL_321_322
+	{ 0, 0, 32, 0L, 0L, 0L, 5359UL },	// IO_TERMINAL_359_360
+	{ 0, 0, 32, 0L, 0L, 0L, 5391UL },	// IO_TERMINAL_361_362
+	{ 0, 0, 32, 0L, 0L, 0L, 5423UL },	// IO_TERMINAL_423
+	{ 0, 0, 32, 0L, 0L, 0L, 5455UL },	// IO_TERMINAL_424
+	{ 0, 0, 32, 0L, 0L, 0L, 5487UL },	// IO_TERMINAL_425
+	{ 0, 0, 32, 0L, 0L, 0L, 5519UL },	// IO_TERMINAL_426
+	{ 0, 0, 32, 0L, 0L, 0L, 5551UL },	// IO_TERMINAL_427
+	{ 0, 0, 32, 0L, 0L, 0L, 5583UL },	// IO_TERMINAL_428
+	{ 0, 0, 32, 0L, 0L, 0L, 5615UL },	// IO_TERMINAL_430_431
+	{ 0, 0, 32, 0L, 0L, 0L, 5647UL },	// IO_TERMINAL_432_433
+	{ 0, 0, 32, 0L, 0L, 0L, 5679UL },	// IO_TERMINAL_463
+	{ 0, 0, 32, 0L, 0L, 0L, 5711UL },	// IO_TERMINAL_464
+	{ 0, 0, 32, 0L, 0L, 0L, 5743UL },	// IO_TERMINAL_465
+	{ 0, 0, 32, 0L, 0L, 0L, 5775UL },	// IO_TERMINAL_466
+	{ 0, 0, 32, 0L, 0L, 0L, 5807UL },	// IO_TERMINAL_467
+	{ 0, 0, 32, 0L, 0L, 0L, 5839UL },	// IO_TERMINAL_468
+	{ 0, 0, 32, 0L, 0L, 0L, 5871UL },	// IO_TERMINAL_470_471
+	{ 0, 0, 32, 0L, 0L, 0L, 5903UL },	// IO_TERMINAL_472_473
+	{ 0, 0, 32, 0L, 0L, 0L, 5935UL },	// IO_TERMINAL_435
+	{ 0, 0, 32, 0L, 0L, 0L, 5967UL },	// IO_TERMINAL_436
+	{ 0, 0, 32, 0L, 0L, 0L, 5999UL },	// IO_TERMINAL_437
+	{ 0, 0, 32, 0L, 0L, 0L, 6031UL },	// IO_TERMINAL_438
+	{ 0, 0, 32, 0L, 0L, 0L, 6063UL },	// IO_TERMINAL_439
+	{ 0, 0, 32, 0L, 0L, 0L, 6095UL },	// IO_TERMINAL_475
+	{ 0, 0, 32, 0L, 0L, 0L, 6127UL },	// IO_TERMINAL_476
+	{ 0, 0, 32, 0L, 0L, 0L, 6159UL },	// IO_TERMINAL_477
+	{ 0, 0, 32, 0L, 0L, 0L, 6191UL },	// IO_TERMINAL_478
+	{ 0, 0, 32, 0L, 0L, 0L, 6223UL },	// IO_TERMINAL_479
+	{ 0, 0, 32, 0L, 0L, 0L, 6255UL },	// IO_TERMINAL_401_404
+	{ 0, 0, 32, 0L, 0L, 0L, 6287UL },	// IO_TERMINAL_405_408
+	{ 0, 0, 32, 0L, 0L, 0L, 6319UL },	// IO_TERMINAL_409_412
+	{ 0, 0, 32, 0L, 0L, 0L, 6351UL },	// IO_TERMINAL_441_444
+	{ 0, 0, 32, 0L, 0L, 0L, 6383UL },	// IO_TERMINAL_445_448
+	{ 0, 0, 32, 0L, 0L, 0L, 6415UL },	// IO_TERMINAL_449_452
+	{ 0, 0, 32, 0L, 0L, 0L, 6447UL },	// IO_TERMINAL_413_414
+	{ 0, 0, 32, 0L, 0L, 0L, 6479UL },	// IO_TERMINAL_416_417
+	{ 0, 0, 32, 0L, 0L, 0L, 6511UL },	// IO_TERMINAL_453_454
+	{ 0, 0, 32, 0L, 0L, 0L, 6543UL },	// IO_TERMINAL_456_457
+	{ 0, 0, 32, 0L, 0L, 0L, 6575UL },	// IO_TERMINAL_419_420
+	{ 0, 0, 32, 0L, 0L, 0L, 6607UL },	// IO_TERMINAL_421_422
+	{ 0, 0, 32, 0L, 0L, 0L, 6639UL },	// IO_TERMINAL_459_460
+	{ 0, 0, 32, 0L, 0L, 0L, 6671UL },	// IO_TERMINAL_461_462
+	{ 0, 0, 32, 0L, 0L, 0L, 6703UL },	// IO_TERMINAL_523
+	{ 0, 0, 32, 0L, 0L, 0L, 6735UL },	// IO_TERMINAL_524
+	{ 0, 0, 32, 0L, 0L, 0L, 6767UL },	// IO_TERMINAL_525
+	{ 0, 0, 32, 0L, 0L, 0L, 6799UL },	// IO_TERMINAL_526
+	{ 0, 0, 32, 0L, 0L, 0L, 6831UL },	// IO_TERMINAL_527
+	{ 0, 0, 32, 0L, 0L, 0L, 6863UL },	// IO_TERMINAL_528
+	{ 0, 0, 32, 0L, 0L, 0L, 6895UL },	// IO_TERMINAL_530_531
+	{ 0, 0, 32, 0L, 0L, 0L, 6927UL },	// IO_TERMINAL_532_533
+	{ 0, 0, 32, 0L, 0L, 0L, 6959UL },	// IO_TERMINAL_563
+	{ 0, 0, 32, 0L, 0L, 0L, 6991UL },	// IO_TERMINAL_564
+	{ 0, 0, 32, 0L, 0L, 0L, 7023UL },	// IO_TERMINAL_565
+	{ 0, 0, 32, 0L, 0L, 0L, 7055UL },	// IO_TERMINAL_566
+	{ 0, 0, 32, 0L, 0L, 0L, 7087UL },	// IO_TERMINAL_567
+	{ 0, 0, 32, 0L, 0L, 0L, 7119UL },	// IO_TERMINAL_568
+	{ 0, 0, 32, 0L, 0L, 0L, 7151UL },	// IO_TERMINAL_570_571
+	{ 0, 0, 32, 0L, 0L, 0L, 7183UL },	// IO_TERMINAL_572_573
+	{ 0, 0, 32, 0L, 0L, 0L, 7215UL },	// IO_TERMINAL_535
+	{ 0, 0, 32, 0L, 0L, 0L, 7247UL },	// IO_TERMINAL_536
+	{ 0, 0, 32, 0L, 0L, 0L, 7279UL },	// IO_TERMINAL_537
+	{ 0, 0, 32, 0L, 0L, 0L, 7311UL },	// IO_TERMINAL_538
+	{ 0, 0, 32, 0L, 0L, 0L, 7343UL },	// IO_TERMINAL_539
+	{ 0, 0, 32, 0L, 0L, 0L, 7375UL },	// IO_TERMINAL_575
+	{ 0, 0, 32, 0L, 0L, 0L, 7407UL },	// IO_TERMINAL_576
+	{ 0, 0, 32, 0L, 0L, 0L, 7439UL },	// IO_TERMINAL_577
+	{ 0, 0, 32, 0L, 0L, 0L, 7471UL },	// IO_TERMINAL_578
+	{ 0, 0, 32, 0L, 0L, 0L, 7503UL },	// IO_TERMINAL_579
+	{ 0, 0, 32, 0L, 0L, 0L, 7535UL },	// IO_TERMINAL_501_504
+	{ 0, 0, 32, 0L, 0L, 0L, 7567UL },	// IO_TERMINAL_505_508
+	{ 0, 0, 32, 0L, 0L, 0L, 7599UL },	// IO_TERMINAL_509_512
+	{ 0, 0, 32, 0L, 0L, 0L, 7631UL },	// IO_TERMINAL_541_544
+	{ 0, 0, 32, 0L, 0L, 0L, 7663UL },	// IO_TERMINAL_545_548
+	{ 0, 0, 32, 0L, 0L, 0L, 7695UL },	// IO_TERMINAL_549_552
+	{ 0, 0, 32, 0L, 0L, 0L, 7727UL },	// IO_TERMINAL_513_514
+	{ 0, 0, 32, 0L, 0L, 0L, 7759UL },	// IO_TERMINAL_516_517
+	{ 0, 0, 32, 0L, 0L, 0L, 7791UL },	// IO_TERMINAL_553_554
+	{ 0, 0, 32, 0L, 0L, 0L, 7823UL },	// IO_TERMINAL_556_557
+	{ 0, 0, 32, 0L, 0L, 0L, 7855UL },	// IO_TERMINAL_519_520
+	{ 0, 0, 32, 0L, 0L, 0L, 7887UL },	// IO_TERMINAL_521_522
+	{ 0, 0, 32, 0L, 0L, 0L, 7919UL },	// IO_TERMINAL_559_560
+	{ 0, 0, 32, 0L, 0L, 0L, 7951UL },	// IO_TERMINAL_561_562
+	{ 0, 0, 32, 0L, 0L, 0L, 7983UL },	// IO_TERMINAL_623
+	{ 0, 0, 32, 0L, 0L, 0L, 8015UL },	// IO_TERMINAL_624
+	{ 0, 0, 32, 0L, 0L, 0L, 8047UL },	// IO_TERMINAL_625
+	{ 0, 0, 32, 0L, 0L, 0L, 8079UL },	// IO_TERMINAL_626
+	{ 0, 0, 32, 0L, 0L, 0L, 8111UL },	// IO_TERMINAL_627
+	{ 0, 0, 32, 0L, 0L, 0L, 8143UL },	// IO_TERMINAL_628
+	{ 0, 0, 32, 0L, 0L, 0L, 8175UL },	// IO_TERMINAL_630_631
+	{ 0, 0, 32, 0L, 0L, 0L, 8207UL },	// IO_TERMINAL_632_633
+	{ 0, 0, 32, 0L, 0L, 0L, 8239UL },	// IO_TERMINAL_663
+	{ 0, 0, 32, 0L, 0L, 0L, 8271UL },	// IO_TERMINAL_664
+	{ 0, 0, 32, 0L, 0L, 0L, 8303UL },	// IO_TERMINAL_665
+	{ 0, 0, 32, 0L, 0L, 0L, 8335UL },	// IO_TERMINAL_666
+	{ 0, 0, 32, 0L, 0L, 0L, 8367UL },	// IO_TERMINAL_667
+	{ 0, 0, 32, 0L, 0L, 0L, 8399UL },	// IO_TERMINAL_668
+	{ 0, 0, 32, 0L, 0L, 0L, 8431UL },	// IO_TERMINAL_670_671
+	{ 0, 0, 32, 0L, 0L, 0L, 8463UL },	// IO_TERMINAL_672_673
+	{ 0, 0, 32, 0L, 0L, 0L, 8495UL },	// IO_TERMINAL_635
+	{ 0, 0, 32, 0L, 0L, 0L, 8527UL },	// IO_TERMINAL_636
+	{ 0, 0, 32, 0L, 0L, 0L, 8559UL },	// IO_TERMINAL_637
+	{ 0, 0, 32, 0L, 0L, 0L, 8591UL },	// IO_TERMINAL_638
+	{ 0, 0, 32, 0L, 0L, 0L, 8623UL },	// IO_TERMINAL_639
+	{ 0, 0, 32, 0L, 0L, 0L, 8655UL },	// IO_TERMINAL_675
+	{ 0, 0, 32, 0L, 0L, 0L, 8687UL },	// IO_TERMINAL_676
+	{ 0, 0, 32, 0L, 0L, 0L, 8719UL },	// IO_TERMINAL_677
+	{ 0, 0, 32, 0L, 0L, 0L, 8751UL },	// IO_TERMINAL_678
+	{ 0, 0, 32, 0L, 0L, 0L, 8783UL },	// IO_TERMINAL_679
+	{ 0, 0, 32, 0L, 0L, 0L, 8815UL },	// IO_TERMINAL_601_604
+	{ 0, 0, 32, 0L, 0L, 0L, 8847UL },	// IO_TERMINAL_605_608
+	{ 0, 0, 32, 0L, 0L, 0L, 8879UL },	// IO_TERMINAL_609_612
+	{ 0, 0, 32, 0L, 0L, 0L, 8911UL },	// IO_TERMINAL_641_644
+	{ 0, 0, 32, 0L, 0L, 0L, 8943UL },	// IO_TERMINAL_645_648
+	{ 0, 0, 32, 0L, 0L, 0L, 8975UL },	// IO_TERMINAL_649_652
+	{ 0, 0, 32, 0L, 0L, 0L, 9007UL },	// IO_TERMINAL_613_614
+	{ 0, 0, 32, 0L, 0L, 0L, 9039UL },	// IO_TERMINAL_616_617
+	{ 0, 0, 32, 0L, 0L, 0L, 9071UL },	// IO_TERMINAL_653_654
+	{ 0, 0, 32, 0L, 0L, 0L, 9103UL },	// IO_TERMINAL_656_657
+	{ 0, 0, 32, 0L, 0L, 0L, 9135UL },	// IO_TERMINAL_619_620
+	{ 0, 0, 32, 0L, 0L, 0L, 9167UL },	// IO_TERMINAL_621_622
+	{ 0, 0, 32, 0L, 0L, 0L, 9199UL },	// IO_TERMINAL_659_660
+	{ 0, 0, 32, 0L, 0L, 0L, 9231UL },	// IO_TERMINAL_661_662
+	{ 0, 0, 32, 0L, 0L, 0L, 9263UL },	// IO_TERMINAL_723
+	{ 0, 0, 32, 0L, 0L, 0L, 9295UL },	// IO_TERMINAL_724
+	{ 0, 0, 32, 0L, 0L, 0L, 9327UL },	// IO_TERMINAL_725
+	{ 0, 0, 32, 0L, 0L, 0L, 9359UL },	// IO_TERMINAL_726
+	{ 0, 0, 32, 0L, 0L, 0L, 9391UL },	// IO_TERMINAL_727
+	{ 0, 0, 32, 0L, 0L, 0L, 9423UL },	// IO_TERMINAL_728
+	{ 0, 0, 32, 0L, 0L, 0L, 9455UL },	// IO_TERMINAL_730_731
+	{ 0, 0, 32, 0L, 0L, 0L, 9487UL },	// IO_TERMINAL_732_733
+	{ 0, 0, 32, 0L, 0L, 0L, 9519UL },	// IO_TERMINAL_763
+	{ 0, 0, 32, 0L, 0L, 0L, 9551UL },	// IO_TERMINAL_764
+	{ 0, 0, 32, 0L, 0L, 0L, 9583UL },	// IO_TERMINAL_765
+	{ 0, 0, 32, 0L, 0L, 0L, 9615UL },	// IO_TERMINAL_766
+	{ 0, 0, 32, 0L, 0L, 0L, 9647UL },	// IO_TERMINAL_767
+	{ 0, 0, 32, 0L, 0L, 0L, 9679UL },	// IO_TERMINAL_768
+	{ 0, 0, 32, 0L, 0L, 0L, 9711UL },	// IO_TERMINAL_770_771
+	{ 0, 0, 32, 0L, 0L, 0L, 9743UL },	// IO_TERMINAL_772_773
+	{ 0, 0, 32, 0L, 0L, 0L, 9775UL },	// IO_TERMINAL_735
+	{ 0, 0, 32, 0L, 0L, 0L, 9807UL },	// IO_TERMINAL_736
+	{ 0, 0, 32, 0L, 0L, 0L, 9839UL },	// IO_TERMINAL_737
+	{ 0, 0, 32, 0L, 0L, 0L, 9871UL },	// IO_TERMINAL_738
+	{ 0, 0, 32, 0L, 0L, 0L, 9903UL },	// IO_TERMINAL_739
+	{ 0, 0, 32, 0L, 0L, 0L, 9935UL },	// IO_TERMINAL_775
+	{ 0, 0, 32, 0L, 0L, 0L, 9967UL },	// IO_TERMINAL_776
+	{ 0, 0, 32, 0L, 0L, 0L, 9999UL },	// IO_TERMINAL_777
+	{ 0, 0, 32, 0L, 0L, 0L, 10031UL },	// IO_TERMINAL_778
+	{ 0, 0, 32, 0L, 0L, 0L, 10063UL },	// IO_TERMINAL_779
+	{ 0, 0, 32, 0L, 0L, 0L, 10095UL },	// IO_TERMINAL_701_704
+	{ 0, 0, 32, 0L, 0L, 0L, 10127UL },	// IO_TERMINAL_705_708
+	{ 0, 0, 32, 0L, 0L, 0L, 10159UL },	// IO_TERMINAL_709_712
+	{ 0, 0, 32, 0L, 0L, 0L, 10191UL },	// IO_TERMINAL_741_744
+	{ 0, 0, 32, 0L, 0L, 0L, 10223UL },	// IO_TERMINAL_745_748
+	{ 0, 0, 32, 0L, 0L, 0L, 10255UL },	// IO_TERMINAL_749_752
+	{ 0, 0, 32, 0L, 0L, 0L, 10287UL },	// IO_TERMINAL_713_714
+	{ 0, 0, 32, 0L, 0L, 0L, 10319UL },	// IO_TERMINAL_716_717
+	{ 0, 0, 32, 0L, 0L, 0L, 10351UL },	// IO_TERMINAL_753_754
+	{ 0, 0, 32, 0L, 0L, 0L, 10383UL },	// IO_TERMINAL_756_757
+	{ 0, 0, 32, 0L, 0L, 0L, 10415UL },	// IO_TERMINAL_719_720
+	{ 0, 0, 32, 0L, 0L, 0L, 10447UL },	// IO_TERMINAL_721_722
+	{ 0, 0, 32, 0L, 0L, 0L, 10479UL },	// IO_TERMINAL_759_760
+	{ 0, 0, 32, 0L, 0L, 0L, 10511UL },	// IO_TERMINAL_761_762
+	{ 0, 0, 32, 0L, 0L, 0L, 10543UL },	// IO_TERMINAL_823
+	{ 0, 0, 32, 0L, 0L, 0L, 10575UL },	// IO_TERMINAL_824
+	{ 0, 0, 32, 0L, 0L, 0L, 10607UL },	// IO_TERMINAL_825
+	{ 0, 0, 32, 0L, 0L, 0L, 10639UL },	// IO_TERMINAL_826
+	{ 0, 0, 32, 0L, 0L, 0L, 10671UL },	// IO_TERMINAL_827
+	{ 0, 0, 32, 0L, 0L, 0L, 10703UL },	// IO_TERMINAL_828
+	{ 0, 0, 32, 0L, 0L, 0L, 10735UL },	// IO_TERMINAL_830_831
+	{ 0, 0, 32, 0L, 0L, 0L, 10767UL },	// IO_TERMINAL_832_833
+	{ 0, 0, 32, 0L, 0L, 0L, 10799UL },	// IO_TERMINAL_863
+	{ 0, 0, 32, 0L, 0L, 0L, 10831UL },	// IO_TERMINAL_864
+	{ 0, 0, 32, 0L, 0L, 0L, 10863UL },	// IO_TERMINAL_865
+	{ 0, 0, 32, 0L, 0L, 0L, 10895UL },	// IO_TERMINAL_866
+	{ 0, 0, 32, 0L, 0L, 0L, 10927UL },	// IO_TERMINAL_867
+	{ 0, 0, 32, 0L, 0L, 0L, 10959UL },	// IO_TERMINAL_868
+	{ 0, 0, 32, 0L, 0L, 0L, 10991UL },	// IO_TERMINAL_870_871
+	{ 0, 0, 32, 0L, 0L, 0L, 11023UL },	// IO_TERMINAL_872_873
+	{ 0, 0, 32, 0L, 0L, 0L, 11055UL },	// IO_TERMINAL_835
+	{ 0, 0, 32, 0L, 0L, 0L, 11087UL },	// IO_TERMINAL_836
+	{ 0, 0, 32, 0L, 0L, 0L, 11119UL },	// IO_TERMINAL_837
+	{ 0, 0, 32, 0L, 0L, 0L, 11151UL },	// IO_TERMINAL_838
+	{ 0, 0, 32, 0L, 0L, 0L, 11183UL },	// IO_TERMINAL_839
+	{ 0, 0, 32, 0L, 0L, 0L, 11215UL },	// IO_TERMINAL_875
+	{ 0, 0, 32, 0L, 0L, 0L, 11247UL },	// IO_TERMINAL_876
+	{ 0, 0, 32, 0L, 0L, 0L, 11279UL },	// IO_TERMINAL_877
+	{ 0, 0, 32, 0L, 0L, 0L, 11311UL },	// IO_TERMINAL_878
+	{ 0, 0, 32, 0L, 0L, 0L, 11343UL },	// IO_TERMINAL_879
+	{ 0, 0, 32, 0L, 0L, 0L, 11375UL },	// IO_TERMINAL_801_804
+	{ 0, 0, 32, 0L, 0L, 0L, 11407UL },	// IO_TERMINAL_805_808
+	{ 0, 0, 32, 0L, 0L, 0L, 11439UL },	// IO_TERMINAL_809_812
+	{ 0, 0, 32, 0L, 0L, 0L, 11471UL },	// IO_TERMINAL_841_844
+	{ 0, 0, 32, 0L, 0L, 0L, 11503UL },	// IO_TERMINAL_845_848
+	{ 0, 0, 32, 0L, 0L, 0L, 11535UL },	// IO_TERMINAL_849_852
+	{ 0, 0, 32, 0L, 0L, 0L, 11567UL },	// IO_TERMINAL_813_814
+	{ 0, 0, 32, 0L, 0L, 0L, 11599UL },	// IO_TERMINAL_816_817
+	{ 0, 0, 32, 0L, 0L, 0L, 11631UL },	// IO_TERMINAL_853_854
+	{ 0, 0, 32, 0L, 0L, 0L, 11663UL },	// IO_TERMINAL_856_857
+	{ 0, 0, 32, 0L, 0L, 0L, 11695UL },	// IO_TERMINAL_819_820
+	{ 0, 0, 32, 0L, 0L, 0L, 11727UL },	// IO_TERMINAL_821_822
+	{ 0, 0, 32, 0L, 0L, 0L, 11759UL },	// IO_TERMINAL_859_860
+	{ 0, 0, 32, 0L, 0L, 0L, 11791UL },	// IO_TERMINAL_861_862
+	{ 0, 0, 32, 0L, 0L, 0L, 11823UL },	// IO_TERMINAL_923
+	{ 0, 0, 32, 0L, 0L, 0L, 11855UL },	// IO_TERMINAL_924
+	{ 0, 0, 32, 0L, 0L, 0L, 11887UL },	// IO_TERMINAL_925
+	{ 0, 0, 32, 0L, 0L, 0L, 11919UL },	// IO_TERMINAL_926
+	{ 0, 0, 32, 0L, 0L, 0L, 11951UL },	// IO_TERMINAL_927
+	{ 0, 0, 32, 0L, 0L, 0L, 11983UL },	// IO_TERMINAL_928
+	{ 0, 0, 32, 0L, 0L, 0L, 12015UL },	// IO_TERMINAL_930_931
+	{ 0, 0, 32, 0L, 0L, 0L, 12047UL },	// IO_TERMINAL_932_933
+	{ 0, 0, 32, 0L, 0L, 0L, 12079UL },	// IO_TERMINAL_963
+	{ 0, 0, 32, 0L, 0L, 0L, 12111UL },	// IO_TERMINAL_964
+	{ 0, 0, 32, 0L, 0L, 0L, 12143UL },	// IO_TERMINAL_965
+	{ 0, 0, 32, 0L, 0L, 0L, 12175UL },	// IO_TERMINAL_966
+	{ 0, 0, 32, 0L, 0L, 0L, 12207UL },	// IO_TERMINAL_967
+	{ 0, 0, 32, 0L, 0L, 0L, 12239UL },	// IO_TERMINAL_968
+	{ 0, 0, 32, 0L, 0L, 0L, 12271UL },	// IO_TERMINAL_970_971
+	{ 0, 0, 32, 0L, 0L, 0L, 12303UL },	// IO_TERMINAL_972_973
+	{ 0, 0, 32, 0L, 0L, 0L, 12335UL },	// IO_TERMINAL_935
+	{ 0, 0, 32, 0L, 0L, 0L, 12367UL },	// IO_TERMINAL_936
+	{ 0, 0, 32, 0L, 0L, 0L, 12399UL },	// IO_TERMINAL_937
+	{ 0, 0, 32, 0L, 0L, 0L, 12431UL },	// IO_TERMINAL_938
+	{ 0, 0, 32, 0L, 0L, 0L, 12463UL },	// IO_TERMINAL_939
+	{ 0, 0, 32, 0L, 0L, 0L, 12495UL },	// IO_TERMINAL_975
+	{ 0, 0, 32, 0L, 0L, 0L, 12527UL },	// IO_TERMINAL_976
+	{ 0, 0, 32, 0L, 0L, 0L, 12559UL },	// IO_TERMINAL_977
+	{ 0, 0, 32, 0L, 0L, 0L, 12591UL },	// IO_TERMINAL_978
+	{ 0, 0, 32, 0L, 0L, 0L, 12623UL },	// IO_TERMINAL_979
+	{ 0, 0, 32, 0L, 0L, 0L, 12655UL },	// IO_TERMINAL_901_904
+	{ 0, 0, 32, 0L, 0L, 0L, 12687UL },	// IO_TERMINAL_905_908
+	{ 0, 0, 32, 0L, 0L, 0L, 12719UL },	// IO_TERMINAL_909_912
+	{ 0, 0, 32, 0L, 0L, 0L, 12751UL },	// IO_TERMINAL_941_944
+	{ 0, 0, 32, 0L, 0L, 0L, 12783UL },	// IO_TERMINAL_945_948
+	{ 0, 0, 32, 0L, 0L, 0L, 12815UL },	// IO_TERMINAL_949_952
+	{ 0, 0, 32, 0L, 0L, 0L, 12847UL },	// IO_TERMINAL_913_914
+	{ 0, 0, 32, 0L, 0L, 0L, 12879UL },	// IO_TERMINAL_916_917
+	{ 0, 0, 32, 0L, 0L, 0L, 12911UL },	// IO_TERMINAL_953_954
+	{ 0, 0, 32, 0L, 0L, 0L, 12943UL },	// IO_TERMINAL_956_957
+	{ 0, 0, 32, 0L, 0L, 0L, 12975UL },	// IO_TERMINAL_919_920
+	{ 0, 0, 32, 0L, 0L, 0L, 13007UL },	// IO_TERMINAL_921_922
+	{ 0, 0, 32, 0L, 0L, 0L, 13039UL },	// IO_TERMINAL_959_960
+	{ 0, 0, 32, 0L, 0L, 0L, 13071UL },	// IO_TERMINAL_961_962
+	{ 0, 0, 32, 0L, 0L, 0L, 13103UL },	// IO_TERMINAL_1023
+	{ 0, 0, 32, 0L, 0L, 0L, 13135UL },	// IO_TERMINAL_1024
+	{ 0, 0, 32, 0L, 0L, 0L, 13167UL },	// IO_TERMINAL_1025
+	{ 0, 0, 32, 0L, 0L, 0L, 13199UL },	// IO_TERMINAL_1026
+	{ 0, 0, 32, 0L, 0L, 0L, 13231UL },	// IO_TERMINAL_1027
+	{ 0, 0, 32, 0L, 0L, 0L, 13263UL },	// IO_TERMINAL_1028
+	{ 0, 0, 32, 0L, 0L, 0L, 13295UL },	// IO_TERMINAL_1030_1031
+	{ 0, 0, 32, 0L, 0L, 0L, 13327UL },	// IO_TERMINAL_1032_1033
+	{ 0, 0, 32, 0L, 0L, 0L, 13359UL },	// IO_TERMINAL_1063
+	{ 0, 0, 32, 0L, 0L, 0L, 13391UL },	// IO_TERMINAL_1064
+	{ 0, 0, 32, 0L, 0L, 0L, 13423UL },	// IO_TERMINAL_1065
+	{ 0, 0, 32, 0L, 0L, 0L, 13455UL },	// IO_TERMINAL_1066
+	{ 0, 0, 32, 0L, 0L, 0L, 13487UL },	// IO_TERMINAL_1067
+	{ 0, 0, 32, 0L, 0L, 0L, 13519UL },	// IO_TERMINAL_1068
+	{ 0, 0, 32, 0L, 0L, 0L, 13551UL },	// IO_TERMINAL_1070_1071
+	{ 0, 0, 32, 0L, 0L, 0L, 13583UL },	// IO_TERMINAL_1072_1073
+	{ 0, 0, 32, 0L, 0L, 0L, 13615UL },	// IO_TERMINAL_1035
+	{ 0, 0, 32, 0L, 0L, 0L, 13647UL },	// IO_TERMINAL_1036
+	{ 0, 0, 32, 0L, 0L, 0L, 13679UL },	// IO_TERMINAL_1037
+	{ 0, 0, 32, 0L, 0L, 0L, 13711UL },	// IO_TERMINAL_1038
+	{ 0, 0, 32, 0L, 0L, 0L, 13743UL },	// IO_TERMINAL_1039
+	{ 0, 0, 32, 0L, 0L, 0L, 13775UL },	// IO_TERMINAL_1075
+	{ 0, 0, 32, 0L, 0L, 0L, 13807UL },	// IO_TERMINAL_1076
+	{ 0, 0, 32, 0L, 0L, 0L, 13839UL },	// IO_TERMINAL_1077
+	{ 0, 0, 32, 0L, 0L, 0L, 13871UL },	// IO_TERMINAL_1078
+	{ 0, 0, 32, 0L, 0L, 0L, 13903UL },	// IO_TERMINAL_1079
+	{ 0, 0, 32, 0L, 0L, 0L, 13935UL },	// IO_TERMINAL_1001_1004
+	{ 0, 0, 32, 0L, 0L, 0L, 13967UL },	// IO_TERMINAL_1005_1008
+	{ 0, 0, 32, 0L, 0L, 0L, 13999UL },	// IO_TERMINAL_1009_1012
+	{ 0, 0, 32, 0L, 0L, 0L, 14031UL },	// IO_TERMINAL_1041_1044
+	{ 0, 0, 32, 0L, 0L, 0L, 14063UL },	// IO_TERMINAL_1045_1048
+	{ 0, 0, 32, 0L, 0L, 0L, 14095UL },	// IO_TERMINAL_1049_1052
+	{ 0, 0, 32, 0L, 0L, 0L, 14127UL },	// IO_TERMINAL_1013_1014
+	{ 0, 0, 32, 0L, 0L, 0L, 14159UL },	// IO_TERMINAL_1016_1017
+	{ 0, 0, 32, 0L, 0L, 0L, 14191UL },	// IO_TERMINAL_1053_1054
+	{ 0, 0, 32, 0L, 0L, 0L, 14223UL },	// IO_TERMINAL_1056_1057
+	{ 0, 0, 32, 0L, 0L, 0L, 14255UL },	// IO_TERMINAL_1019_1020
+	{ 0, 0, 32, 0L, 0L, 0L, 14287UL },	// IO_TERMINAL_1021_1022
+	{ 0, 0, 32, 0L, 0L, 0L, 14319UL },	// IO_TERMINAL_1059_1060
+	{ 0, 0, 32, 0L, 0L, 0L, 14351UL },	// IO_TERMINAL_1061_1062
+	{ 0, 0, 32, 0L, 0L, 0L, 14383UL },	// IO_TERMINAL_1123
+	{ 0, 0, 32, 0L, 0L, 0L, 14415UL },	// IO_TERMINAL_1124
+	{ 0, 0, 32, 0L, 0L, 0L, 14447UL },	// IO_TERMINAL_1125
+	{ 0, 0, 32, 0L, 0L, 0L, 14479UL },	// IO_TERMINAL_1126
+	{ 0, 0, 32, 0L, 0L, 0L, 14511UL },	// IO_TERMINAL_1127
+	{ 0, 0, 32, 0L, 0L, 0L, 14543UL },	// IO_TERMINAL_1128
+	{ 0, 0, 32, 0L, 0L, 0L, 14575UL },	// IO_TERMINAL_1130_1131
+	{ 0, 0, 32, 0L, 0L, 0L, 14607UL },	// IO_TERMINAL_1132_1133
+	{ 0, 0, 32, 0L, 0L, 0L, 14639UL },	// IO_TERMINAL_1163
+	{ 0, 0, 32, 0L, 0L, 0L, 14671UL },	// IO_TERMINAL_1164
+	{ 0, 0, 32, 0L, 0L, 0L, 14703UL },	// IO_TERMINAL_1165
+	{ 0, 0, 32, 0L, 0L, 0L, 14735UL },	// IO_TERMINAL_1166
+	{ 0, 0, 32, 0L, 0L, 0L, 14767UL },	// IO_TERMINAL_1167
+	{ 0, 0, 32, 0L, 0L, 0L, 14799UL },	// IO_TERMINAL_1168
+	{ 0, 0, 32, 0L, 0L, 0L, 14831UL },	// IO_TERMINAL_1170_1171
+	{ 0, 0, 32, 0L, 0L, 0L, 14863UL },	// IO_TERMINAL_1172_1173
+	{ 0, 0, 32, 0L, 0L, 0L, 14895UL },	// IO_TERMINAL_1135
+	{ 0, 0, 32, 0L, 0L, 0L, 14927UL },	// IO_TERMINAL_1136
+	{ 0, 0, 32, 0L, 0L, 0L, 14959UL },	// IO_TERMINAL_1137
+	{ 0, 0, 32, 0L, 0L, 0L, 14991UL },	// IO_TERMINAL_1138
+	{ 0, 0, 32, 0L, 0L, 0L, 15023UL },	// IO_TERMINAL_1139
+	{ 0, 0, 32, 0L, 0L, 0L, 15055UL },	// IO_TERMINAL_1175
+	{ 0, 0, 32, 0L, 0L, 0L, 15087UL },	// IO_TERMINAL_1176
+	{ 0, 0, 32, 0L, 0L, 0L, 15119UL },	// IO_TERMINAL_1177
+	{ 0, 0, 32, 0L, 0L, 0L, 15151UL },	// IO_TERMINAL_1178
+	{ 0, 0, 32, 0L, 0L, 0L, 15183UL },	// IO_TERMINAL_1179
+	{ 0, 0, 32, 0L, 0L, 0L, 15215UL },	// IO_TERMINAL_1101_1104
+	{ 0, 0, 32, 0L, 0L, 0L, 15247UL },	// IO_TERMINAL_1105_1108
+	{ 0, 0, 32, 0L, 0L, 0L, 15279UL },	// IO_TERMINAL_1109_1112
+	{ 0, 0, 32, 0L, 0L, 0L, 15311UL },	// IO_TERMINAL_1141_1144
+	{ 0, 0, 32, 0L, 0L, 0L, 15343UL },	// IO_TERMINAL_1145_1148
+	{ 0, 0, 32, 0L, 0L, 0L, 15375UL },	// IO_TERMINAL_1149_1152
+	{ 0, 0, 32, 0L, 0L, 0L, 15407UL },	// IO_TERMINAL_1113_1114
+	{ 0, 0, 32, 0L, 0L, 0L, 15439UL },	// IO_TERMINAL_1116_1117
+	{ 0, 0, 32, 0L, 0L, 0L, 15471UL },	// IO_TERMINAL_1153_1154
+	{ 0, 0, 32, 0L, 0L, 0L, 15503UL },	// IO_TERMINAL_1156_1157
+	{ 0, 0, 32, 0L, 0L, 0L, 15535UL },	// IO_TERMINAL_1119_1120
+	{ 0, 0, 32, 0L, 0L, 0L, 15567UL },	// IO_TERMINAL_1121_1122
+	{ 0, 0, 32, 0L, 0L, 0L, 15599UL },	// IO_TERMINAL_1159_1160
+	{ 0, 0, 32, 0L, 0L, 0L, 15631UL },	// IO_TERMINAL_1161_1162
+	{ 0, 0, 32, 0L, 0L, 0L, 15663UL },	// IO_TERMINAL_1223
+	{ 0, 0, 32, 0L, 0L, 0L, 15695UL },	// IO_TERMINAL_1224
+	{ 0, 0, 32, 0L, 0L, 0L, 15727UL },	// IO_TERMINAL_1225
+	{ 0, 0, 32, 0L, 0L, 0L, 15759UL },	// IO_TERMINAL_1226
+	{ 0, 0, 32, 0L, 0L, 0L, 15791UL },	// IO_TERMINAL_1227
+	{ 0, 0, 32, 0L, 0L, 0L, 15823UL },	// IO_TERMINAL_1228
+	{ 0, 0, 32, 0L, 0L, 0L, 15855UL },	// IO_TERMINAL_1230_1231
+	{ 0, 0, 32, 0L, 0L, 0L, 15887UL },	// IO_TERMINAL_1232_1233
+	{ 0, 0, 32, 0L, 0L, 0L, 15919UL },	// IO_TERMINAL_1263
+	{ 0, 0, 32, 0L, 0L, 0L, 15951UL },	// IO_TERMINAL_1264
+	{ 0, 0, 32, 0L, 0L, 0L, 15983UL },	// IO_TERMINAL_1265
+	{ 0, 0, 32, 0L, 0L, 0L, 16015UL },	// IO_TERMINAL_1266
+	{ 0, 0, 32, 0L, 0L, 0L, 16047UL },	// IO_TERMINAL_1267
+	{ 0, 0, 32, 0L, 0L, 0L, 16079UL },	// IO_TERMINAL_1268
+	{ 0, 0, 32, 0L, 0L, 0L, 16111UL },	// IO_TERMINAL_1270_1271
+	{ 0, 0, 32, 0L, 0L, 0L, 16143UL },	// IO_TERMINAL_1272_1273
+	{ 0, 0, 32, 0L, 0L, 0L, 16175UL },	// IO_TERMINAL_1235
+	{ 0, 0, 32, 0L, 0L, 0L, 16207UL },	// IO_TERMINAL_1236
+	{ 0, 0, 32, 0L, 0L, 0L, 16239UL },	// IO_TERMINAL_1237
+	{ 0, 0, 32, 0L, 0L, 0L, 16271UL },	// IO_TERMINAL_1238
+	{ 0, 0, 32, 0L, 0L, 0L, 16303UL },	// IO_TERMINAL_1239
+	{ 0, 0, 32, 0L, 0L, 0L, 16335UL },	// IO_TERMINAL_1275
+	{ 0, 0, 32, 0L, 0L, 0L, 16367UL },	// IO_TERMINAL_1276
+	{ 0, 0, 32, 0L, 0L, 0L, 16399UL },	// IO_TERMINAL_1277
+	{ 0, 0, 32, 0L, 0L, 0L, 16431UL },	// IO_TERMINAL_1278
+	{ 0, 0, 32, 0L, 0L, 0L, 16463UL },	// IO_TERMINAL_1279
+	{ 0, 0, 32, 0L, 0L, 0L, 16495UL },	// IO_TERMINAL_1201_1204
+	{ 0, 0, 32, 0L, 0L, 0L, 16527UL },	// IO_TERMINAL_1205_1208
+	{ 0, 0, 32, 0L, 0L, 0L, 16559UL },	// IO_TERMINAL_1209_1212
+	{ 0, 0, 32, 0L, 0L, 0L, 16591UL },	// IO_TERMINAL_1241_1244
+	{ 0, 0, 32, 0L, 0L, 0L, 16623UL },	// IO_TERMINAL_1245_1248
+	{ 0, 0, 32, 0L, 0L, 0L, 16655UL },	// IO_TERMINAL_1249_1252
+	{ 0, 0, 32, 0L, 0L, 0L, 16687UL },	// IO_TERMINAL_1213_1214
+	{ 0, 0, 32, 0L, 0L, 0L, 16719UL },	// IO_TERMINAL_1216_1217
+	{ 0, 0, 32, 0L, 0L, 0L, 16751UL },	// IO_TERMINAL_1253_1254
+	{ 0, 0, 32, 0L, 0L, 0L, 16783UL },	// IO_TERMINAL_1256_1257
+	{ 0, 0, 32, 0L, 0L, 0L, 16815UL },	// IO_TERMINAL_1219_1220
+	{ 0, 0, 32, 0L, 0L, 0L, 16847UL },	// IO_TERMINAL_1221_1222
+	{ 0, 0, 32, 0L, 0L, 0L, 16879UL },	// IO_TERMINAL_1259_1260
+	{ 0, 0, 32, 0L, 0L, 0L, 16911UL },	// IO_TERMINAL_1261_1262
+	{ 0, 0, 32, 0L, 0L, 0L, 16943UL },	// IO_TERMINAL_1323
+	{ 0, 0, 32, 0L, 0L, 0L, 16975UL },	// IO_TERMINAL_1324
+	{ 0, 0, 32, 0L, 0L, 0L, 17007UL },	// IO_TERMINAL_1325
+	{ 0, 0, 32, 0L, 0L, 0L, 17039UL },	// IO_TERMINAL_1326
+	{ 0, 0, 32, 0L, 0L, 0L, 17071UL },	// IO_TERMINAL_1327
+	{ 0, 0, 32, 0L, 0L, 0L, 17103UL },	// IO_TERMINAL_1328
+	{ 0, 0, 32, 0L, 0L, 0L, 17135UL },	// IO_TERMINAL_1330_1331
+	{ 0, 0, 32, 0L, 0L, 0L, 17167UL },	// IO_TERMINAL_1332_1333
+	{ 0, 0, 32, 0L, 0L, 0L, 17199UL },	// IO_TERMINAL_1363
+	{ 0, 0, 32, 0L, 0L, 0L, 17231UL },	// IO_TERMINAL_1364
+	{ 0, 0, 32, 0L, 0L, 0L, 17263UL },	// IO_TERMINAL_1365
+	{ 0, 0, 32, 0L, 0L, 0L, 17295UL },	// IO_TERMINAL_1366
+	{ 0, 0, 32, 0L, 0L, 0L, 17327UL },	// IO_TERMINAL_1367
+	{ 0, 0, 32, 0L, 0L, 0L, 17359UL },	// IO_TERMINAL_1368
+	{ 0, 0, 32, 0L, 0L, 0L, 17391UL },	// IO_TERMINAL_1370_1371
+	{ 0, 0, 32, 0L, 0L, 0L, 17423UL },	// IO_TERMINAL_1372_1373
+	{ 0, 0, 32, 0L, 0L, 0L, 17455UL },	// IO_TERMINAL_1335
+	{ 0, 0, 32, 0L, 0L, 0L, 17487UL },	// IO_TERMINAL_1336
+	{ 0, 0, 32, 0L, 0L, 0L, 17519UL },	// IO_TERMINAL_1337
+	{ 0, 0, 32, 0L, 0L, 0L, 17551UL },	// IO_TERMINAL_1338
+	{ 0, 0, 32, 0L, 0L, 0L, 17583UL },	// IO_TERMINAL_1339
+	{ 0, 0, 32, 0L, 0L, 0L, 17615UL },	// IO_TERMINAL_1375
+	{ 0, 0, 32, 0L, 0L, 0L, 17647UL },	// IO_TERMINAL_1376
+	{ 0, 0, 32, 0L, 0L, 0L, 17679UL },	// IO_TERMINAL_1377
+	{ 0, 0, 32, 0L, 0L, 0L, 17711UL },	// IO_TERMINAL_1378
+	{ 0, 0, 32, 0L, 0L, 0L, 17743UL },	// IO_TERMINAL_1379
+	{ 0, 0, 32, 0L, 0L, 0L, 17775UL },	// IO_TERMINAL_1301_1304
+	{ 0, 0, 32, 0L, 0L, 0L, 17807UL },	// IO_TERMINAL_1305_1308
+	{ 0, 0, 32, 0L, 0L, 0L, 17839UL },	// IO_TERMINAL_1309_1312
+	{ 0, 0, 32, 0L, 0L, 0L, 17871UL },	// IO_TERMINAL_1341_1344
+	{ 0, 0, 32, 0L, 0L, 0L, 17903UL },	// IO_TERMINAL_1345_1348
+	{ 0, 0, 32, 0L, 0L, 0L, 17935UL },	// IO_TERMINAL_1349_1352
+	{ 0, 0, 32, 0L, 0L, 0L, 17967UL },	// IO_TERMINAL_1313_1314
+	{ 0, 0, 32, 0L, 0L, 0L, 17999UL },	// IO_TERMINAL_1316_1317
+	{ 0, 0, 32, 0L, 0L, 0L, 18031UL },	// IO_TERMINAL_1353_1354
+	{ 0, 0, 32, 0L, 0L, 0L, 18063UL },	// IO_TERMINAL_1356_1357
+	{ 0, 0, 32, 0L, 0L, 0L, 18095UL },	// IO_TERMINAL_1319_1320
+	{ 0, 0, 32, 0L, 0L, 0L, 18127UL },	// IO_TERMINAL_1321_1322
+	{ 0, 0, 32, 0L, 0L, 0L, 18159UL },	// IO_TERMINAL_1359_1360
+	{ 0, 0, 32, 0L, 0L, 0L, 18191UL },	// IO_TERMINAL_1361_1362
+	{ 0, 0, 32, 0L, 0L, 0L, 18223UL },	// IO_TERMINAL_1423
+	{ 0, 0, 32, 0L, 0L, 0L, 18255UL },	// IO_TERMINAL_1424
+	{ 0, 0, 32, 0L, 0L, 0L, 18287UL },	// IO_TERMINAL_1425
+	{ 0, 0, 32, 0L, 0L, 0L, 18319UL },	// IO_TERMINAL_1426
+	{ 0, 0, 32, 0L, 0L, 0L, 18351UL },	// IO_TERMINAL_1427
+	{ 0, 0, 32, 0L, 0L, 0L, 18383UL },	// IO_TERMINAL_1428
+	{ 0, 0, 32, 0L, 0L, 0L, 18415UL },	// IO_TERMINAL_1430_1431
+	{ 0, 0, 32, 0L, 0L, 0L, 18447UL },	// IO_TERMINAL_1432_1433
+	{ 0, 0, 32, 0L, 0L, 0L, 18479UL },	// IO_TERMINAL_1463
+	{ 0, 0, 32, 0L, 0L, 0L, 18511UL },	// IO_TERMINAL_1464
+	{ 0, 0, 32, 0L, 0L, 0L, 18543UL },	// IO_TERMINAL_1465
+	{ 0, 0, 32, 0L, 0L, 0L, 18575UL },	// IO_TERMINAL_1466
+	{ 0, 0, 32, 0L, 0L, 0L, 18607UL },	// IO_TERMINAL_1467
+	{ 0, 0, 32, 0L, 0L, 0L, 18639UL },	// IO_TERMINAL_1468
+	{ 0, 0, 32, 0L, 0L, 0L, 18671UL },	// IO_TERMINAL_1470_1471
+	{ 0, 0, 32, 0L, 0L, 0L, 18703UL },	// IO_TERMINAL_1472_1473
+	{ 0, 0, 32, 0L, 0L, 0L, 18735UL },	// IO_TERMINAL_1435
+	{ 0, 0, 32, 0L, 0L, 0L, 18767UL },	// IO_TERMINAL_1436
+	{ 0, 0, 32, 0L, 0L, 0L, 18799UL },	// IO_TERMINAL_1437
+	{ 0, 0, 32, 0L, 0L, 0L, 18831UL },	// IO_TERMINAL_1438
+	{ 0, 0, 32, 0L, 0L, 0L, 18863UL },	// IO_TERMINAL_1439
+	{ 0, 0, 32, 0L, 0L, 0L, 18895UL },	// IO_TERMINAL_1475
+	{ 0, 0, 32, 0L, 0L, 0L, 18927UL },	// IO_TERMINAL_1476
+	{ 0, 0, 32, 0L, 0L, 0L, 18959UL },	// IO_TERMINAL_1477
+	{ 0, 0, 32, 0L, 0L, 0L, 18991UL },	// IO_TERMINAL_1478
+	{ 0, 0, 32, 0L, 0L, 0L, 19023UL },	// IO_TERMINAL_1479
+	{ 0, 0, 32, 0L, 0L, 0L, 19055UL },	// IO_TERMINAL_1401_1404
+	{ 0, 0, 32, 0L, 0L, 0L, 19087UL },	// IO_TERMINAL_1405_1408
+	{ 0, 0, 32, 0L, 0L, 0L, 19119UL },	// IO_TERMINAL_1409_1412
+	{ 0, 0, 32, 0L, 0L, 0L, 19151UL },	// IO_TERMINAL_1441_1444
+	{ 0, 0, 32, 0L, 0L, 0L, 19183UL },	// IO_TERMINAL_1445_1448
+	{ 0, 0, 32, 0L, 0L, 0L, 19215UL },	// IO_TERMINAL_1449_1452
+	{ 0, 0, 32, 0L, 0L, 0L, 19247UL },	// IO_TERMINAL_1413_1414
+	{ 0, 0, 32, 0L, 0L, 0L, 19279UL },	// IO_TERMINAL_1416_1417
+	{ 0, 0, 32, 0L, 0L, 0L, 19311UL },	// IO_TERMINAL_1453_1454
+	{ 0, 0, 32, 0L, 0L, 0L, 19343UL },	// IO_TERMINAL_1456_1457
+	{ 0, 0, 32, 0L, 0L, 0L, 19375UL },	// IO_TERMINAL_1419_1420
+	{ 0, 0, 32, 0L, 0L, 0L, 19407UL },	// IO_TERMINAL_1421_1422
+	{ 0, 0, 32, 0L, 0L, 0L, 19439UL },	// IO_TERMINAL_1459_1460
+	{ 0, 0, 32, 0L, 0L, 0L, 19471UL },	// IO_TERMINAL_1461_1462
+	{ 0, 0, 32, 0L, 0L, 0L, 19503UL },	// DIM_TERMINAL_002
+	{ 0, 0, 32, 0L, 0L, 0L, 19535UL },	// DIM_TERMINAL_003
+	{ 0, 0, 32, 0L, 0L, 0L, 19567UL },	// DIM_TERMINAL_004
+	{ 0, 0, 32, 0L, 0L, 0L, 19599UL },	// DIM_TERMINAL_005
+	{ 0, 0, 32, 0L, 0L, 0L, 19631UL },	// DIM_TERMINAL_006
+	{ 0, 0, 32, 0L, 0L, 0L, 19663UL },	// DIM_TERMINAL_007
+	{ 0, 0, 32, 0L, 0L, 0L, 19695UL },	// DIM_TERMINAL_008
+	{ 0, 0, 32, 0L, 0L, 0L, 19727UL },	// DIM_TERMINAL_009
+	{ 0, 0, 32, 0L, 0L, 0L, 19759UL },	// DIM_TERMINAL_039
+	{ 0, 0, 32, 0L, 0L, 0L, 19791UL },	// DIM_TERMINAL_040
+	{ 0, 0, 32, 0L, 0L, 0L, 19823UL },	// DIM_TERMINAL_041
+	{ 0, 0, 32, 0L, 0L, 0L, 19855UL },	// DIM_TERMINAL_042
+	{ 0, 0, 32, 0L, 0L, 0L, 19887UL },	// DIM_TERMINAL_043
+	{ 0, 0, 32, 0L, 0L, 0L, 19919UL },	// DIM_TERMINAL_044
+	{ 0, 0, 32, 0L, 0L, 0L, 19951UL },	// DIM_TERMINAL_045
+	{ 0, 0, 32, 0L, 0L, 0L, 19983UL },	// DIM_TERMINAL_046
+	{ 0, 0, 32, 0L, 0L, 0L, 20015UL },	// DIM_TERMINAL_021
+	{ 0, 0, 32, 0L, 0L, 0L, 20047UL },	// DIM_TERMINAL_022
+	{ 0, 0, 32, 0L, 0L, 0L, 20079UL },	// DIM_TERMINAL_023
+	{ 0, 0, 32, 0L, 0L, 0L, 20111UL },	// DIM_TERMINAL_024
+	{ 0, 0, 32, 0L, 0L, 0L, 20143UL },	// DIM_TERMINAL_025
+	{ 0, 0, 32, 0L, 0L, 0L, 20175UL },	// DIM_TERMINAL_026
+	{ 0, 0, 32, 0L, 0L, 0L, 20207UL },	// DIM_TERMINAL_027
+	{ 0, 0, 32, 0L, 0L, 0L, 20239UL },	// DIM_TERMINAL_028
+	{ 0, 0, 32, 0L, 0L, 0L, 20271UL },	// DIM_TERMINAL_030
+	{ 0, 0, 32, 0L, 0L, 0L, 20303UL },	// DIM_TERMINAL_031
+	{ 0, 0, 32, 0L, 0L, 0L, 20335UL },	// DIM_TERMINAL_032
+	{ 0, 0, 32, 0L, 0L, 0L, 20367UL },	// DIM_TERMINAL_033
+	{ 0, 0, 32, 0L, 0L, 0L, 20399UL },	// DIM_TERMINAL_034
+	{ 0, 0, 32, 0L, 0L, 0L, 20431UL },	// DIM_TERMINAL_035
+	{ 0, 0, 32, 0L, 0L, 0L, 20463UL },	// DIM_TERMINAL_036
+	{ 0, 0, 32, 0L, 0L, 0L, 20495UL },	// DIM_TERMINAL_058
+	{ 0, 0, 32, 0L, 0L, 0L, 20527UL },	// DIM_TERMINAL_059
+	{ 0, 0, 32, 0L, 0L, 0L, 20559UL },	// DIM_TERMINAL_060
+	{ 0, 0, 32, 0L, 0L, 0L, 20591UL },	// DIM_TERMINAL_061
+	{ 0, 0, 32, 0L, 0L, 0L, 20623UL },	// DIM_TERMINAL_062
+	{ 0, 0, 32, 0L, 0L, 0L, 20655UL },	// DIM_TERMINAL_063
+	{ 0, 0, 32, 0L, 0L, 0L, 20687UL },	// DIM_TERMINAL_064
+	{ 0, 0, 32, 0L, 0L, 0L, 20719UL },	// DIM_TERMINAL_065
+	{ 0, 0, 32, 0L, 0L, 0L, 20751UL },	// DIM_TERMINAL_067
+	{ 0, 0, 32, 0L, 0L, 0L, 20783UL },	// DIM_TERMINAL_068
+	{ 0, 0, 32, 0L, 0L, 0L, 20815UL },	// DIM_TERMINAL_069
+	{ 0, 0, 32, 0L, 0L, 0L, 20847UL },	// DIM_TERMINAL_070
+	{ 0, 0, 32, 0L, 0L, 0L, 20879UL },	// DIM_TERMINAL_071
+	{ 0, 0, 32, 0L, 0L, 0L, 20911UL },	// DIM_TERMINAL_072
+	{ 0, 0, 32, 0L, 0L, 0L, 20943UL },	// DIM_TERMINAL_073
+	{ 1, NBR_OF_IO_MODULES__ACCESS_LEVEL, 32, NBR_OF_IO_MODULES__MIN_VALUE, NBR_OF_IO_MODULES__MAX_VALUE, NBR_OF_IO_MODULES__FACTORY_SETTING, 20975UL },
+	{ 1, NBR_OF_SC_MODULES__ACCESS_LEVEL, 2, NBR_OF_SC_MODULES__MIN_VALUE, NBR_OF_SC_MODULES__MAX_VALUE, NBR_OF_SC_MODULES__FACTORY_SETTING, 21007UL },
+	{ 1, NBR_OF_IFM_MODULES__ACCESS_LEVEL, 1, NBR_OF_IFM_MODULES__MIN_VALUE, NBR_OF_IFM_MODULES__MAX_VALUE, NBR_OF_IFM_MODULES__FACTORY_SETTING, 21009UL },
+	{ 1, NBR_OF_DIM_MODULES__ACCESS_LEVEL, 1, NBR_OF_DIM_MODULES__MIN_VALUE, NBR_OF_DIM_MODULES__MAX_VALUE, NBR_OF_DIM_MODULES__FACTORY_SETTING, 21010UL },
+	{ 1, ENGINE_ID__ACCESS_LEVEL, 4, ENGINE_ID__MIN_VALUE, ENGINE_ID__MAX_VALUE, ENGINE_ID__FACTORY_SETTING, 21011UL },
+	{ 1, CAN_OPTION__ACCESS_LEVEL, 1, CAN_OPTION__MIN_VALUE, CAN_OPTION__MAX_VALUE, CAN_OPTION__FACTORY_SETTING, 21015UL },
+	{ 1, SMS_OPTION__ACCESS_LEVEL, 32, SMS_OPTION__MIN_VALUE, SMS_OPTION__MAX_VALUE, SMS_OPTION__FACTORY_SETTING, 21016UL },
+	{ 1, NUMBER_OF_TEETH_AT_FLYWHEEL__ACCESS_LEVEL, 9, NUMBER_OF_TEETH_AT_FLYWHEEL__MIN_VALUE, NUMBER_OF_TEETH_AT_FLYWHEEL__MAX_VALUE, NUMBER_OF_TEETH_AT_FLYWHEEL__FACTORY_SETTING, 21048UL },
+	{ 1, FILLING_AT_ZERO_SPEED__ACCESS_LEVEL, 15, FILLING_AT_ZERO_SPEED__MIN_VALUE, FILLING_AT_ZERO_SPEED__MAX_VALUE, FILLING_AT_ZERO_SPEED__FACTORY_SETTING, 21057UL },
+	{ 1, PICKUP_FRQUENCY_THROTTLE_OPEN__ACCESS_LEVEL, 12, PICKUP_FRQUENCY_THROTTLE_OPEN__MIN_VALUE, PICKUP_FRQUENCY_THROTTLE_OPEN__MAX_VALUE, PICKUP_FRQUENCY_THROTTLE_OPEN__FACTORY_SETTING, 21072UL },
+	{ 1, THROTTLE_MIN_POS__ACCESS_LEVEL, 15, THROTTLE_MIN_POS__MIN_VALUE, THROTTLE_MIN_POS__MAX_VALUE, THROTTLE_MIN_POS__FACTORY_SETTING, 21084UL },
+	{ 1, THROTTLE_POS_0_VOLTAGE__ACCESS_LEVEL, 10, THROTTLE_POS_0_VOLTAGE__MIN_VALUE, THROTTLE_POS_0_VOLTAGE__MAX_VALUE, THROTTLE_POS_0_VOLTAGE__FACTORY_SETTING, 21099UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 21109UL },	// THROTTLE_POSB_0_VOLTAGE
+	{ 1, THROTTLE_POS_100_VOLTAGE__ACCESS_LEVEL, 10, THROTTLE_POS_100_VOLTAGE__MIN_VALUE, THROTTLE_POS_100_VOLTAGE__MAX_VALUE, THROTTLE_POS_100_VOLTAGE__FACTORY_SETTING, 21141UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 21151UL },	// THROTTLE_POSB_100_VOLTAGE
+	{ 1, TUR_AO_THROTTLE_B_VALUE_ZERO__ACCESS_LEVEL, 16, TUR_AO_THROTTLE_B_VALUE_ZERO__MIN_VALUE, TUR_AO_THROTTLE_B_VALUE_ZERO__MAX_VALUE, TUR_AO_THROTTLE_B_VALUE_ZERO__FACTORY_SETTING, 21183UL },
+	{ 1, TUR_AO_THROTTLE_B_VALUE_FULL__ACCESS_LEVEL, 16, TUR_AO_THROTTLE_B_VALUE_FULL__MIN_VALUE, TUR_AO_THROTTLE_B_VALUE_FULL__MAX_VALUE, TUR_AO_THROTTLE_B_VALUE_FULL__FACTORY_SETTING, 21199UL },
+	{ 1, STRT_VALUE_SPEED_RAMP__ACCESS_LEVEL, 10, STRT_VALUE_SPEED_RAMP__MIN_VALUE, STRT_VALUE_SPEED_RAMP__MAX_VALUE, STRT_VALUE_SPEED_RAMP__FACTORY_SETTING, 21215UL },
+	{ 1, THROTTLE_POS_P_REDUCTION__ACCESS_LEVEL, 9, THROTTLE_POS_P_REDUCTION__MIN_VALUE, THROTTLE_POS_P_REDUCTION__MAX_VALUE, THROTTLE_POS_P_REDUCTION__FACTORY_SETTING, 21225UL },
+	{ 1, CNT_FACTOR_1__ACCESS_LEVEL, 10, CNT_FACTOR_1__MIN_VALUE, CNT_FACTOR_1__MAX_VALUE, CNT_FACTOR_1__FACTORY_SETTING, 21234UL },
+	{ 1, CNT_FACTOR_2__ACCESS_LEVEL, 10, CNT_FACTOR_2__MIN_VALUE, CNT_FACTOR_2__MAX_VALUE, CNT_FACTOR_2__FACTORY_SETTING, 21244UL },
+	{ 1, CNT_FACTOR_3__ACCESS_LEVEL, 10, CNT_FACTOR_3__MIN_VALUE, CNT_FACTOR_3__MAX_VALUE, CNT_FACTOR_3__FACTORY_SETTING, 21254UL },
+	{ 1, CNT_FACTOR_4__ACCESS_LEVEL, 10, CNT_FACTOR_4__MIN_VALUE, CNT_FACTOR_4__MAX_VALUE, CNT_FACTOR_4__FACTORY_SETTING, 21264UL },
+	{ 1, MCD_IGNITION_CHECK__ACCESS_LEVEL, 1, MCD_IGNITION_CHECK__MIN_VALUE, MCD_IGNITION_CHECK__MAX_VALUE, MCD_IGNITION_CHECK__FACTORY_SETTING, 21274UL },
+	{ 1, MCD_SPARK_REF_MIN__ACCESS_LEVEL, 8, MCD_SPARK_REF_MIN__MIN_VALUE, MCD_SPARK_REF_MIN__MAX_VALUE, MCD_SPARK_REF_MIN__FACTORY_SETTING, 21275UL },
+	{ 1, MCD_SPARK_REF_MAX__ACCESS_LEVEL, 9, MCD_SPARK_REF_MAX__MIN_VALUE, MCD_SPARK_REF_MAX__MAX_VALUE, MCD_SPARK_REF_MAX__FACTORY_SETTING, 21283UL },
+	{ 1, GEN_SETPOINT_COS_PHI__ACCESS_LEVEL, 5, GEN_SETPOINT_COS_PHI__MIN_VALUE, GEN_SETPOINT_COS_PHI__MAX_VALUE, GEN_SETPOINT_COS_PHI__FACTORY_SETTING, 21292UL },
+	{ 1, GEN_COS_PHI_IND_CAP__ACCESS_LEVEL, 1, GEN_COS_PHI_IND_CAP__MIN_VALUE, GEN_COS_PHI_IND_CAP__MAX_VALUE, GEN_COS_PHI_IND_CAP__FACTORY_SETTING, 21297UL },
+	{ 1, POWER_WARMING_LOAD__ACCESS_LEVEL, 10, POWER_WARMING_LOAD__MIN_VALUE, POWER_WARMING_LOAD__MAX_VALUE, POWER_WARMING_LOAD__FACTORY_SETTING, 21298UL },
+	{ 1, POWER_WARMING_TEMP__ACCESS_LEVEL, 10, POWER_WARMING_TEMP__MIN_VALUE, POWER_WARMING_TEMP__MAX_VALUE, POWER_WARMING_TEMP__FACTORY_SETTING, 21308UL },
+	{ 1, POWER_WARMING_TIMEOUT__ACCESS_LEVEL, 26, POWER_WARMING_TIMEOUT__MIN_VALUE, POWER_WARMING_TIMEOUT__MAX_VALUE, POWER_WARMING_TIMEOUT__FACTORY_SETTING, 21318UL },
+	{ 1, GRID_PROT_2_AUTO_START__ACCESS_LEVEL, 1, GRID_PROT_2_AUTO_START__MIN_VALUE, GRID_PROT_2_AUTO_START__MAX_VALUE, GRID_PROT_2_AUTO_START__FACTORY_SETTING, 21344UL },
+	{ 1, DKA_OPTION__ACCESS_LEVEL, 1, DKA_OPTION__MIN_VALUE, DKA_OPTION__MAX_VALUE, DKA_OPTION__FACTORY_SETTING, 21345UL },
+	{ 1, DKB_OPTION__ACCESS_LEVEL, 1, DKB_OPTION__MIN_VALUE, DKB_OPTION__MAX_VALUE, DKB_OPTION__FACTORY_SETTING, 21346UL },
+	{ 1, COM_OPTION__ACCESS_LEVEL, 1, COM_OPTION__MIN_VALUE, COM_OPTION__MAX_VALUE, COM_OPTION__FACTORY_SETTING, 21347UL },
+	{ 1, BY_OPTION__ACCESS_LEVEL, 1, BY_OPTION__MIN_VALUE, BY_OPTION__MAX_VALUE, BY_OPTION__FACTORY_SETTING, 21348UL },
+	{ 1, MIX_OPTION_LAMBDA_CONTROL__ACCESS_LEVEL, 2, MIX_OPTION_LAMBDA_CONTROL__MIN_VALUE, MIX_OPTION_LAMBDA_CONTROL__MAX_VALUE, MIX_OPTION_LAMBDA_CONTROL__FACTORY_SETTING, 21349UL },
+	{ 1, MIX_OPTION_RECEIV_TEMP_SENSOR__ACCESS_LEVEL, 1, MIX_OPTION_RECEIV_TEMP_SENSOR__MIN_VALUE, MIX_OPTION_RECEIV_TEMP_SENSOR__MAX_VALUE, MIX_OPTION_RECEIV_TEMP_SENSOR__FACTORY_SETTING, 21351UL },
+	{ 1, MIX_OPTION_RECEIV_PRESS_SENSOR__ACCESS_LEVEL, 1, MIX_OPTION_RECEIV_PRESS_SENSOR__MIN_VALUE, MIX_OPTION_RECEIV_PRESS_SENSOR__MAX_VALUE, MIX_OPTION_RECEIV_PRESS_SENSOR__FACTORY_SETTING, 21352UL },
+	{ 1, MIX_RECEIV_PRESS_VALUE_FOR_4mA__ACCESS_LEVEL, 12, MIX_RECEIV_PRESS_VALUE_FOR_4mA__MIN_VALUE, MIX_RECEIV_PRESS_VALUE_FOR_4mA__MAX_VALUE, MIX_RECEIV_PRESS_VALUE_FOR_4mA__FACTORY_SETTING, 21353UL },
+	{ 1, MIX_RECEIV_PRESS_VALUE_FOR_20mA__ACCESS_LEVEL, 14, MIX_RECEIV_PRESS_VALUE_FOR_20mA__MIN_VALUE, MIX_RECEIV_PRESS_VALUE_FOR_20mA__MAX_VALUE, MIX_RECEIV_PRESS_VALUE_FOR_20mA__FACTORY_SETTING, 21365UL },
+	{ 1, MIX_RECEIV_PRESS_WIREBREAK__ACCESS_LEVEL, 16, MIX_RECEIV_PRESS_WIREBREAK__MIN_VALUE, MIX_RECEIV_PRESS_WIREBREAK__MAX_VALUE, MIX_RECEIV_PRESS_WIREBREAK__FACTORY_SETTING, 21379UL },
+	{ 1, MIX_SETPOINT_LAMBDA__ACCESS_LEVEL, 15, MIX_SETPOINT_LAMBDA__MIN_VALUE, MIX_SETPOINT_LAMBDA__MAX_VALUE, MIX_SETPOINT_LAMBDA__FACTORY_SETTING, 21395UL },
+	{ 1, MIX_SETPOINT_LAMBDA_GASB__ACCESS_LEVEL, 15, MIX_SETPOINT_LAMBDA_GASB__MIN_VALUE, MIX_SETPOINT_LAMBDA_GASB__MAX_VALUE, MIX_SETPOINT_LAMBDA_GASB__FACTORY_SETTING, 21410UL },
+	{ 1, MIX_INVERT_LAMBDA_REGULATION__ACCESS_LEVEL, 1, MIX_INVERT_LAMBDA_REGULATION__MIN_VALUE, MIX_INVERT_LAMBDA_REGULATION__MAX_VALUE, MIX_INVERT_LAMBDA_REGULATION__FACTORY_SETTING, 21425UL },
+	{ 1, MIX_MAX_NUMBER_OF_STEPS__ACCESS_LEVEL, 15, MIX_MAX_NUMBER_OF_STEPS__MIN_VALUE, MIX_MAX_NUMBER_OF_STEPS__MAX_VALUE, MIX_MAX_NUMBER_OF_STEPS__FACTORY_SETTING, 21426UL },
+	{ 1, MIX_RELEASE_POWER_CONTROL__ACCESS_LEVEL, 14, MIX_RELEASE_POWER_CONTROL__MIN_VALUE, MIX_RELEASE_POWER_CONTROL__MAX_VALUE, MIX_RELEASE_POWER_CONTROL__FACTORY_SETTING, 21441UL },
+	{ 1, MIX_REG_CONST_KP__ACCESS_LEVEL, 14, MIX_REG_CONST_KP__MIN_VALUE, MIX_REG_CONST_KP__MAX_VALUE, MIX_REG_CONST_KP__FACTORY_SETTING, 21455UL },
+	{ 1, MIX_REG_CONST_KI__ACCESS_LEVEL, 14, MIX_REG_CONST_KI__MIN_VALUE, MIX_REG_CONST_KI__MAX_VALUE, MIX_REG_CONST_KI__FACTORY_SETTING, 21469UL },
+	{ 1, MIX_REG_CONST_KD__ACCESS_LEVEL, 14, MIX_REG_CONST_KD__MIN_VALUE, MIX_REG_CONST_KD__MAX_VALUE, MIX_REG_CONST_KD__FACTORY_SETTING, 21483UL },
+	{ 1, MIX_DEV_MIN_TIME__ACCESS_LEVEL, 12, MIX_DEV_MIN_TIME__MIN_VALUE, MIX_DEV_MIN_TIME__MAX_VALUE, MIX_DEV_MIN_TIME__FACTORY_SETTING, 21497UL },
+	{ 1, MIX_DEV_MAX_DP_3SEC__ACCESS_LEVEL, 13, MIX_DEV_MAX_DP_3SEC__MIN_VALUE, MIX_DEV_MAX_DP_3SEC__MAX_VALUE, MIX_DEV_MAX_DP_3SEC__FACTORY_SETTING, 21509UL },
+	{ 1, MIX_MAX_DEVIATION__ACCESS_LEVEL, 10, MIX_MAX_DEVIATION__MIN_VALUE, MIX_MAX_DEVIATION__MAX_VALUE, MIX_MAX_DEVIATION__FACTORY_SETTING, 21522UL },
+	{ 1, MIX_OFFSET_ISLAND__ACCESS_LEVEL, 7, MIX_OFFSET_ISLAND__MIN_VALUE, MIX_OFFSET_ISLAND__MAX_VALUE, MIX_OFFSET_ISLAND__FACTORY_SETTING, 21532UL },
+	{ 1, MIX_MAX_TEMP_MIXTURE__ACCESS_LEVEL, 11, MIX_MAX_TEMP_MIXTURE__MIN_VALUE, MIX_MAX_TEMP_MIXTURE__MAX_VALUE, MIX_MAX_TEMP_MIXTURE__FACTORY_SETTING, 21539UL },
+	{ 1, MIX_MIN_TEMP_MIXTURE__ACCESS_LEVEL, 9, MIX_MIN_TEMP_MIXTURE__MIN_VALUE, MIX_MIN_TEMP_MIXTURE__MAX_VALUE, MIX_MIN_TEMP_MIXTURE__FACTORY_SETTING, 21550UL },
+	{ 1, MIX_SECOND_MIXER__ACCESS_LEVEL, 1, MIX_SECOND_MIXER__MIN_VALUE, MIX_SECOND_MIXER__MAX_VALUE, MIX_SECOND_MIXER__FACTORY_SETTING, 21559UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 21560UL },	// MIX_POWER1A
+	{ 0, 0, 32, 0L, 0L, 0L, 21592UL },	// MIX_TEMP1A
+	{ 0, 0, 32, 0L, 0L, 0L, 21624UL },	// MIX_PRESS1A
+	{ 0, 0, 32, 0L, 0L, 0L, 21656UL },	// MIX_POWER2A
+	{ 0, 0, 32, 0L, 0L, 0L, 21688UL },	// MIX_TEMP2A
+	{ 0, 0, 32, 0L, 0L, 0L, 21720UL },	// MIX_PRESS2A
+	{ 0, 0, 32, 0L, 0L, 0L, 21752UL },	// MIX_POWER3A
+	{ 0, 0, 32, 0L, 0L, 0L, 21784UL },	// MIX_TEMP3A
+	{ 0, 0, 32, 0L, 0L, 0L, 21816UL },	// MIX_PRESS3A
+	{ 0, 0, 32, 0L, 0L, 0L, 21848UL },	// MIX_POWER4A
+	{ 0, 0, 32, 0L, 0L, 0L, 21880UL },	// MIX_TEMP4A
+	{ 0, 0, 32, 0L, 0L, 0L, 21912UL },	// MIX_PRESS4A
+	{ 1, MIX_P_T_FACTOR_A__ACCESS_LEVEL, 10, MIX_P_T_FACTOR_A__MIN_VALUE, MIX_P_T_FACTOR_A__MAX_VALUE, MIX_P_T_FACTOR_A__FACTORY_SETTING, 21944UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 21954UL },	// MIX_OFFSET_PSET_A
+	{ 1, MIX_START_POS_A__ACCESS_LEVEL, 10, MIX_START_POS_A__MIN_VALUE, MIX_START_POS_A__MAX_VALUE, MIX_START_POS_A__FACTORY_SETTING, 21986UL },
+	{ 1, MIX_IDLE_POS_A__ACCESS_LEVEL, 10, MIX_IDLE_POS_A__MIN_VALUE, MIX_IDLE_POS_A__MAX_VALUE, MIX_IDLE_POS_A__FACTORY_SETTING, 21996UL },
+	{ 1, MIX_PARALLEL_POS_A__ACCESS_LEVEL, 10, MIX_PARALLEL_POS_A__MIN_VALUE, MIX_PARALLEL_POS_A__MAX_VALUE, MIX_PARALLEL_POS_A__FACTORY_SETTING, 22006UL },
+	{ 1, MIX_ISLAND_POS_A__ACCESS_LEVEL, 10, MIX_ISLAND_POS_A__MIN_VALUE, MIX_ISLAND_POS_A__MAX_VALUE, MIX_ISLAND_POS_A__FACTORY_SETTING, 22016UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 22026UL },	// MIX_POWER1B
+	{ 0, 0, 32, 0L, 0L, 0L, 22058UL },	// MIX_TEMP1B
+	{ 0, 0, 32, 0L, 0L, 0L, 22090UL },	// MIX_PRESS1B
+	{ 0, 0, 32, 0L, 0L, 0L, 22122UL },	// MIX_POWER2B
+	{ 0, 0, 32, 0L, 0L, 0L, 22154UL },	// MIX_TEMP2B
+	{ 0, 0, 32, 0L, 0L, 0L, 22186UL },	// MIX_PRESS2B
+	{ 0, 0, 32, 0L, 0L, 0L, 22218UL },	// MIX_POWER3B
+	{ 0, 0, 32, 0L, 0L, 0L, 22250UL },	// MIX_TEMP3B
+	{ 0, 0, 32, 0L, 0L, 0L, 22282UL },	// MIX_PRESS3B
+	{ 0, 0, 32, 0L, 0L, 0L, 22314UL },	// MIX_POWER4B
+	{ 0, 0, 32, 0L, 0L, 0L, 22346UL },	// MIX_TEMP4B
+	{ 0, 0, 32, 0L, 0L, 0L, 22378UL },	// MIX_PRESS4B
+	{ 1, MIX_P_T_FACTOR_B__ACCESS_LEVEL, 10, MIX_P_T_FACTOR_B__MIN_VALUE, MIX_P_T_FACTOR_B__MAX_VALUE, MIX_P_T_FACTOR_B__FACTORY_SETTING, 22410UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 22420UL },	// MIX_OFFSET_PSET_B
+	{ 1, MIX_START_POS_B__ACCESS_LEVEL, 10, MIX_START_POS_B__MIN_VALUE, MIX_START_POS_B__MAX_VALUE, MIX_START_POS_B__FACTORY_SETTING, 22452UL },
+	{ 1, MIX_IDLE_POS_B__ACCESS_LEVEL, 10, MIX_IDLE_POS_B__MIN_VALUE, MIX_IDLE_POS_B__MAX_VALUE, MIX_IDLE_POS_B__FACTORY_SETTING, 22462UL },
+	{ 1, MIX_PARALLEL_POS_B__ACCESS_LEVEL, 10, MIX_PARALLEL_POS_B__MIN_VALUE, MIX_PARALLEL_POS_B__MAX_VALUE, MIX_PARALLEL_POS_B__FACTORY_SETTING, 22472UL },
+	{ 1, MIX_ISLAND_POS_B__ACCESS_LEVEL, 10, MIX_ISLAND_POS_B__MIN_VALUE, MIX_ISLAND_POS_B__MAX_VALUE, MIX_ISLAND_POS_B__FACTORY_SETTING, 22482UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 22492UL },	// MIX_POWER5A
+	{ 0, 0, 32, 0L, 0L, 0L, 22524UL },	// MIX_TEMP5A
+	{ 0, 0, 32, 0L, 0L, 0L, 22556UL },	// MIX_PRESS5A
+	{ 0, 0, 32, 0L, 0L, 0L, 22588UL },	// MIX_POWER6A
+	{ 0, 0, 32, 0L, 0L, 0L, 22620UL },	// MIX_TEMP6A
+	{ 0, 0, 32, 0L, 0L, 0L, 22652UL },	// MIX_PRESS6A
+	{ 0, 0, 32, 0L, 0L, 0L, 22684UL },	// MIX_POWER7A
+	{ 0, 0, 32, 0L, 0L, 0L, 22716UL },	// MIX_TEMP7A
+	{ 0, 0, 32, 0L, 0L, 0L, 22748UL },	// MIX_PRESS7A
+	{ 0, 0, 32, 0L, 0L, 0L, 22780UL },	// MIX_POWER8A
+	{ 0, 0, 32, 0L, 0L, 0L, 22812UL },	// MIX_TEMP8A
+	{ 0, 0, 32, 0L, 0L, 0L, 22844UL },	// MIX_PRESS8A
+	{ 0, 0, 32, 0L, 0L, 0L, 22876UL },	// MIX_POWER5B
+	{ 0, 0, 32, 0L, 0L, 0L, 22908UL },	// MIX_TEMP5B
+	{ 0, 0, 32, 0L, 0L, 0L, 22940UL },	// MIX_PRESS5B
+	{ 0, 0, 32, 0L, 0L, 0L, 22972UL },	// MIX_POWER6B
+	{ 0, 0, 32, 0L, 0L, 0L, 23004UL },	// MIX_TEMP6B
+	{ 0, 0, 32, 0L, 0L, 0L, 23036UL },	// MIX_PRESS6B
+	{ 0, 0, 32, 0L, 0L, 0L, 23068UL },	// MIX_POWER7B
+	{ 0, 0, 32, 0L, 0L, 0L, 23100UL },	// MIX_TEMP7B
+	{ 0, 0, 32, 0L, 0L, 0L, 23132UL },	// MIX_PRESS7B
+	{ 0, 0, 32, 0L, 0L, 0L, 23164UL },	// MIX_POWER8B
+	{ 0, 0, 32, 0L, 0L, 0L, 23196UL },	// MIX_TEMP8B
+	{ 0, 0, 32, 0L, 0L, 0L, 23228UL },	// MIX_PRESS8B
+	{ 1, MIX_CYL_OFFSET_ISLAND__ACCESS_LEVEL, 11, MIX_CYL_OFFSET_ISLAND__MIN_VALUE, MIX_CYL_OFFSET_ISLAND__MAX_VALUE, MIX_CYL_OFFSET_ISLAND__FACTORY_SETTING, 23260UL },
+	{ 1, MIX_CYL_MAX_DEVIATION__ACCESS_LEVEL, 9, MIX_CYL_MAX_DEVIATION__MIN_VALUE, MIX_CYL_MAX_DEVIATION__MAX_VALUE, MIX_CYL_MAX_DEVIATION__FACTORY_SETTING, 23271UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 23280UL },	// MIX_CYL_POWER1A
+	{ 0, 0, 32, 0L, 0L, 0L, 23312UL },	// MIX_CYL_TEMP1A
+	{ 0, 0, 32, 0L, 0L, 0L, 23344UL },	// MIX_CYL_POWER2A
+	{ 0, 0, 32, 0L, 0L, 0L, 23376UL },	// MIX_CYL_TEMP2A
+	{ 0, 0, 32, 0L, 0L, 0L, 23408UL },	// MIX_CYL_POWER3A
+	{ 0, 0, 32, 0L, 0L, 0L, 23440UL },	// MIX_CYL_TEMP3A
+	{ 0, 0, 32, 0L, 0L, 0L, 23472UL },	// MIX_CYL_POWER4A
+	{ 0, 0, 32, 0L, 0L, 0L, 23504UL },	// MIX_CYL_TEMP4A
+	{ 0, 0, 32, 0L, 0L, 0L, 23536UL },	// MIX_CYL_POWER5A
+	{ 0, 0, 32, 0L, 0L, 0L, 23568UL },	// MIX_CYL_TEMP5A
+	{ 0, 0, 32, 0L, 0L, 0L, 23600UL },	// MIX_CYL_POWER6A
+	{ 0, 0, 32, 0L, 0L, 0L, 23632UL },	// MIX_CYL_TEMP6A
+	{ 0, 0, 32, 0L, 0L, 0L, 23664UL },	// MIX_CYL_POWER7A
+	{ 0, 0, 32, 0L, 0L, 0L, 23696UL },	// MIX_CYL_TEMP7A
+	{ 0, 0, 32, 0L, 0L, 0L, 23728UL },	// MIX_CYL_POWER8A
+	{ 0, 0, 32, 0L, 0L, 0L, 23760UL },	// MIX_CYL_TEMP8A
+	{ 0, 0, 32, 0L, 0L, 0L, 23792UL },	// MIX_CYL_POWER1B
+	{ 0, 0, 32, 0L, 0L, 0L, 23824UL },	// MIX_CYL_TEMP1B
+	{ 0, 0, 32, 0L, 0L, 0L, 23856UL },	// MIX_CYL_POWER2B
+	{ 0, 0, 32, 0L, 0L, 0L, 23888UL },	// MIX_CYL_TEMP2B
+	{ 0, 0, 32, 0L, 0L, 0L, 23920UL },	// MIX_CYL_POWER3B
+	{ 0, 0, 32, 0L, 0L, 0L, 23952UL },	// MIX_CYL_TEMP3B
+	{ 0, 0, 32, 0L, 0L, 0L, 23984UL },	// MIX_CYL_POWER4B
+	{ 0, 0, 32, 0L, 0L, 0L, 24016UL },	// MIX_CYL_TEMP4B
+	{ 0, 0, 32, 0L, 0L, 0L, 24048UL },	// MIX_CYL_POWER5B
+	{ 0, 0, 32, 0L, 0L, 0L, 24080UL },	// MIX_CYL_TEMP5B
+	{ 0, 0, 32, 0L, 0L, 0L, 24112UL },	// MIX_CYL_POWER6B
+	{ 0, 0, 32, 0L, 0L, 0L, 24144UL },	// MIX_CYL_TEMP6B
+	{ 0, 0, 32, 0L, 0L, 0L, 24176UL },	// MIX_CYL_POWER7B
+	{ 0, 0, 32, 0L, 0L, 0L, 24208UL },	// MIX_CYL_TEMP7B
+	{ 0, 0, 32, 0L, 0L, 0L, 24240UL },	// MIX_CYL_POWER8B
+	{ 0, 0, 32, 0L, 0L, 0L, 24272UL },	// MIX_CYL_TEMP8B
+	{ 1, EXH_OPTION_TEMP_AFTER_ENGINE_A__ACCESS_LEVEL, 1, EXH_OPTION_TEMP_AFTER_ENGINE_A__MIN_VALUE, EXH_OPTION_TEMP_AFTER_ENGINE_A__MAX_VALUE, EXH_OPTION_TEMP_AFTER_ENGINE_A__FACTORY_SETTING, 24304UL },
+	{ 1, EXH_OVERTEMP_AFTER_ENGINE_A_WARNING__ACCESS_LEVEL, 13, EXH_OVERTEMP_AFTER_ENGINE_A_WARNING__MIN_VALUE, EXH_OVERTEMP_AFTER_ENGINE_A_WARNING__MAX_VALUE, EXH_OVERTEMP_AFTER_ENGINE_A_WARNING__FACTORY_SETTING, 24305UL },
+	{ 1, EXH_OVERTEMP_AFTER_ENGINE_A_STOP__ACCESS_LEVEL, 13, EXH_OVERTEMP_AFTER_ENGINE_A_STOP__MIN_VALUE, EXH_OVERTEMP_AFTER_ENGINE_A_STOP__MAX_VALUE, EXH_OVERTEMP_AFTER_ENGINE_A_STOP__FACTORY_SETTING, 24318UL },
+	{ 1, EXH_OPTION_TEMP_AFTER_ENGINE_B__ACCESS_LEVEL, 1, EXH_OPTION_TEMP_AFTER_ENGINE_B__MIN_VALUE, EXH_OPTION_TEMP_AFTER_ENGINE_B__MAX_VALUE, EXH_OPTION_TEMP_AFTER_ENGINE_B__FACTORY_SETTING, 24331UL },
+	{ 1, EXH_OVERTEMP_AFTER_ENGINE_B_WARNING__ACCESS_LEVEL, 13, EXH_OVERTEMP_AFTER_ENGINE_B_WARNING__MIN_VALUE, EXH_OVERTEMP_AFTER_ENGINE_B_WARNING__MAX_VALUE, EXH_OVERTEMP_AFTER_ENGINE_B_WARNING__FACTORY_SETTING, 24332UL },
+	{ 1, EXH_OVERTEMP_AFTER_ENGINE_B_STOP__ACCESS_LEVEL, 13, EXH_OVERTEMP_AFTER_ENGINE_B_STOP__MIN_VALUE, EXH_OVERTEMP_AFTER_ENGINE_B_STOP__MAX_VALUE, EXH_OVERTEMP_AFTER_ENGINE_B_STOP__FACTORY_SETTING, 24345UL },
+	{ 1, EXH_OPTION_TEMP_BEFORE_KAT__ACCESS_LEVEL, 1, EXH_OPTION_TEMP_BEFORE_KAT__MIN_VALUE, EXH_OPTION_TEMP_BEFORE_KAT__MAX_VALUE, EXH_OPTION_TEMP_BEFORE_KAT__FACTORY_SETTING, 24358UL },
+	{ 1, EXH_OVERTEMP_BEFORE_KAT_WARNING__ACCESS_LEVEL, 13, EXH_OVERTEMP_BEFORE_KAT_WARNING__MIN_VALUE, EXH_OVERTEMP_BEFORE_KAT_WARNING__MAX_VALUE, EXH_OVERTEMP_BEFORE_KAT_WARNING__FACTORY_SETTING, 24359UL },
+	{ 1, EXH_OVERTEMP_BEFORE_KAT_STOP__ACCESS_LEVEL, 13, EXH_OVERTEMP_BEFORE_KAT_STOP__MIN_VALUE, EXH_OVERTEMP_BEFORE_KAT_STOP__MAX_VALUE, EXH_OVERTEMP_BEFORE_KAT_STOP__FACTORY_SETTING, 24372UL },
+	{ 1, EXH_OPTION_TEMP_AFTER_KAT__ACCESS_LEVEL, 1, EXH_OPTION_TEMP_AFTER_KAT__MIN_VALUE, EXH_OPTION_TEMP_AFTER_KAT__MAX_VALUE, EXH_OPTION_TEMP_AFTER_KAT__FACTORY_SETTING, 24385UL },
+	{ 1, EXH_OVERTEMP_AFTER_KAT_WARNING__ACCESS_LEVEL, 13, EXH_OVERTEMP_AFTER_KAT_WARNING__MIN_VALUE, EXH_OVERTEMP_AFTER_KAT_WARNING__MAX_VALUE, EXH_OVERTEMP_AFTER_KAT_WARNING__FACTORY_SETTING, 24386UL },
+	{ 1, EXH_OVERTEMP_AFTER_KAT_STOP__ACCESS_LEVEL, 13, EXH_OVERTEMP_AFTER_KAT_STOP__MIN_VALUE, EXH_OVERTEMP_AFTER_KAT_STOP__MAX_VALUE, EXH_OVERTEMP_AFTER_KAT_STOP__FACTORY_SETTING, 24399UL },
+	{ 1, EXH_OPTION_TEMP_AFTER_HEAT_EXCHANGER__ACCESS_LEVEL, 1, EXH_OPTION_TEMP_AFTER_HEAT_EXCHANGER__MIN_VALUE, EXH_OPTION_TEMP_AFTER_HEAT_EXCHANGER__MAX_VALUE, EXH_OPTION_TEMP_AFTER_HEAT_EXCHANGER__FACTORY_SETTING, 24412UL },
+	{ 1, EXH_OVERTEMP_AFTER_HEAT_EXCHANGER_WARNING__ACCESS_LEVEL, 13, EXH_OVERTEMP_AFTER_HEAT_EXCHANGER_WARNING__MIN_VALUE, EXH_OVERTEMP_AFTER_HEAT_EXCHANGER_WARNING__MAX_VALUE, EXH_OVERTEMP_AFTER_HEAT_EXCHANGER_WARNING__FACTORY_SETTING, 24413UL },
+	{ 1, EXH_OVERTEMP_AFTER_HEAT_EXCHANGER_STOP__ACCESS_LEVEL, 13, EXH_OVERTEMP_AFTER_HEAT_EXCHANGER_STOP__MIN_VALUE, EXH_OVERTEMP_AFTER_HEAT_EXCHANGER_STOP__MAX_VALUE, EXH_OVERTEMP_AFTER_HEAT_EXCHANGER_STOP__FACTORY_SETTING, 24426UL },
+	{ 1, EXH_DELTAT_ACTIVATION_LIMIT__ACCESS_LEVEL, 14, EXH_DELTAT_ACTIVATION_LIMIT__MIN_VALUE, EXH_DELTAT_ACTIVATION_LIMIT__MAX_VALUE, EXH_DELTAT_ACTIVATION_LIMIT__FACTORY_SETTING, 24439UL },
+	{ 1, EXH_DELTAT_ACTIVATION_DELAY__ACCESS_LEVEL, 20, EXH_DELTAT_ACTIVATION_DELAY__MIN_VALUE, EXH_DELTAT_ACTIVATION_DELAY__MAX_VALUE, EXH_DELTAT_ACTIVATION_DELAY__FACTORY_SETTING, 24453UL },
+	{ 1, EXH_DELTAT_WARN_LIMIT__ACCESS_LEVEL, 11, EXH_DELTAT_WARN_LIMIT__MIN_VALUE, EXH_DELTAT_WARN_LIMIT__MAX_VALUE, EXH_DELTAT_WARN_LIMIT__FACTORY_SETTING, 24473UL },
+	{ 1, EXH_DELTAT_STOP_LIMIT__ACCESS_LEVEL, 11, EXH_DELTAT_STOP_LIMIT__MIN_VALUE, EXH_DELTAT_STOP_LIMIT__MAX_VALUE, EXH_DELTAT_STOP_LIMIT__FACTORY_SETTING, 24484UL },
+	{ 1, EXH_OPTION_BACK_PRESS__ACCESS_LEVEL, 1, EXH_OPTION_BACK_PRESS__MIN_VALUE, EXH_OPTION_BACK_PRESS__MAX_VALUE, EXH_OPTION_BACK_PRESS__FACTORY_SETTING, 24495UL },
+	{ 1, EXH_BACK_PRESS_DELAY__ACCESS_LEVEL, 19, EXH_BACK_PRESS_DELAY__MIN_VALUE, EXH_BACK_PRESS_DELAY__MAX_VALUE, EXH_BACK_PRESS_DELAY__FACTORY_SETTING, 24496UL },
+	{ 1, SYNC_OPTION_DYNAMIC_STATIC__ACCESS_LEVEL, 1, SYNC_OPTION_DYNAMIC_STATIC__MIN_VALUE, SYNC_OPTION_DYNAMIC_STATIC__MAX_VALUE, SYNC_OPTION_DYNAMIC_STATIC__FACTORY_SETTING, 24515UL },
+	{ 1, SYNC_REG_GOV_CONST_P__ACCESS_LEVEL, 14, SYNC_REG_GOV_CONST_P__MIN_VALUE, SYNC_REG_GOV_CONST_P__MAX_VALUE, SYNC_REG_GOV_CONST_P__FACTORY_SETTING, 24516UL },
+	{ 1, SYNC_REG_GOV_CONST_I__ACCESS_LEVEL, 14, SYNC_REG_GOV_CONST_I__MIN_VALUE, SYNC_REG_GOV_CONST_I__MAX_VALUE, SYNC_REG_GOV_CONST_I__FACTORY_SETTING, 24530UL },
+	{ 1, SYNC_REG_GOV_CONST_D__ACCESS_LEVEL, 14, SYNC_REG_GOV_CONST_D__MIN_VALUE, SYNC_REG_GOV_CONST_D__MAX_VALUE, SYNC_REG_GOV_CONST_D__FACTORY_SETTING, 24544UL },
+	{ 1, ENG_LUBE_OIL_LEVEL_VALUE_FOR_4mA__ACCESS_LEVEL, 12, ENG_LUBE_OIL_LEVEL_VALUE_FOR_4mA__MIN_VALUE, ENG_LUBE_OIL_LEVEL_VALUE_FOR_4mA__MAX_VALUE, ENG_LUBE_OIL_LEVEL_VALUE_FOR_4mA__FACTORY_SETTING, 24558UL },
+	{ 1, ENG_LUBE_OIL_LEVEL_VALUE_FOR_20mA__ACCESS_LEVEL, 12, ENG_LUBE_OIL_LEVEL_VALUE_FOR_20mA__MIN_VALUE, ENG_LUBE_OIL_LEVEL_VALUE_FOR_20mA__MAX_VALUE, ENG_LUBE_OIL_LEVEL_VALUE_FOR_20mA__FACTORY_SETTING, 24570UL },
+	{ 1, ENG_LUBE_OIL_LEVEL_WIREBREAK__ACCESS_LEVEL, 16, ENG_LUBE_OIL_LEVEL_WIREBREAK__MIN_VALUE, ENG_LUBE_OIL_LEVEL_WIREBREAK__MAX_VALUE, ENG_LUBE_OIL_LEVEL_WIREBREAK__FACTORY_SETTING, 24582UL },
+	{ 1, ENG_LUBE_OIL_LEVEL_VOLT_COMP__ACCESS_LEVEL, 1, ENG_LUBE_OIL_LEVEL_VOLT_COMP__MIN_VALUE, ENG_LUBE_OIL_LEVEL_VOLT_COMP__MAX_VALUE, ENG_LUBE_OIL_LEVEL_VOLT_COMP__FACTORY_SETTING, 24598UL },
+	{ 1, ENG_OIL_REFILLING_START__ACCESS_LEVEL, 12, ENG_OIL_REFILLING_START__MIN_VALUE, ENG_OIL_REFILLING_START__MAX_VALUE, ENG_OIL_REFILLING_START__FACTORY_SETTING, 24599UL },
+	{ 1, ENG_OIL_REFILLING_STOP__ACCESS_LEVEL, 12, ENG_OIL_REFILLING_STOP__MIN_VALUE, ENG_OIL_REFILLING_STOP__MAX_VALUE, ENG_OIL_REFILLING_STOP__FACTORY_SETTING, 24611UL },
+	{ 1, ENG_ANALOG_LUBE_OIL_LEVEL_MIN__ACCESS_LEVEL, 11, ENG_ANALOG_LUBE_OIL_LEVEL_MIN__MIN_VALUE, ENG_ANALOG_LUBE_OIL_LEVEL_MIN__MAX_VALUE, ENG_ANALOG_LUBE_OIL_LEVEL_MIN__FACTORY_SETTING, 24623UL },
+	{ 1, ENG_ANALOG_LUBE_OIL_LEVEL_MAX__ACCESS_LEVEL, 11, ENG_ANALOG_LUBE_OIL_LEVEL_MAX__MIN_VALUE, ENG_ANALOG_LUBE_OIL_LEVEL_MAX__MAX_VALUE, ENG_ANALOG_LUBE_OIL_LEVEL_MAX__FACTORY_SETTING, 24634UL },
+	{ 1, ENG_OIL_REFILLING_OPTION__ACCESS_LEVEL, 2, ENG_OIL_REFILLING_OPTION__MIN_VALUE, ENG_OIL_REFILLING_OPTION__MAX_VALUE, ENG_OIL_REFILLING_OPTION__FACTORY_SETTING, 24645UL },
+	{ 1, ENG_OIL_REFILLING_POSTRUN__ACCESS_LEVEL, 15, ENG_OIL_REFILLING_POSTRUN__MIN_VALUE, ENG_OIL_REFILLING_POSTRUN__MAX_VALUE, ENG_OIL_REFILLING_POSTRUN__FACTORY_SETTING, 24647UL },
+	{ 1, OIL_MAX_REFILLING_TIME__ACCESS_LEVEL, 21, OIL_MAX_REFILLING_TIME__MIN_VALUE, OIL_MAX_REFILLING_TIME__MAX_VALUE, OIL_MAX_REFILLING_TIME__FACTORY_SETTING, 24662UL },
+	{ 1, OIL_CIRC_TIME_ON__ACCESS_LEVEL, 26, OIL_CIRC_TIME_ON__MIN_VALUE, OIL_CIRC_TIME_ON__MAX_VALUE, OIL_CIRC_TIME_ON__FACTORY_SETTING, 24683UL },
+	{ 1, OIL_CIRC_TIME_OFF__ACCESS_LEVEL, 26, OIL_CIRC_TIME_OFF__MIN_VALUE, OIL_CIRC_TIME_OFF__MAX_VALUE, OIL_CIRC_TIME_OFF__FACTORY_SETTING, 24709UL },
+	{ 1, ENG_LUBE_OIL_DIPSTICK_OPTION__ACCESS_LEVEL, 1, ENG_LUBE_OIL_DIPSTICK_OPTION__MIN_VALUE, ENG_LUBE_OIL_DIPSTICK_OPTION__MAX_VALUE, ENG_LUBE_OIL_DIPSTICK_OPTION__FACTORY_SETTING, 24735UL },
+	{ 1, ENG_LUBE_OIL_DIPSTICK_MIN__ACCESS_LEVEL, 16, ENG_LUBE_OIL_DIPSTICK_MIN__MIN_VALUE, ENG_LUBE_OIL_DIPSTICK_MIN__MAX_VALUE, ENG_LUBE_OIL_DIPSTICK_MIN__FACTORY_SETTING, 24736UL },
+	{ 1, ENG_LUBE_OIL_DIPSTICK_MAX__ACCESS_LEVEL, 16, ENG_LUBE_OIL_DIPSTICK_MAX__MIN_VALUE, ENG_LUBE_OIL_DIPSTICK_MAX__MAX_VALUE, ENG_LUBE_OIL_DIPSTICK_MAX__FACTORY_SETTING, 24752UL },
+	{ 1, MBA_CONFIGURATION_ANALOG__ACCESS_LEVEL, 32, MBA_CONFIGURATION_ANALOG__MIN_VALUE, MBA_CONFIGURATION_ANALOG__MAX_VALUE, MBA_CONFIGURATION_ANALOG__FACTORY_SETTING, 24768UL },
+	{ 1, MBA_CONFIGURATION_DIGITAL__ACCESS_LEVEL, 32, MBA_CONFIGURATION_DIGITAL__MIN_VALUE, MBA_CONFIGURATION_DIGITAL__MAX_VALUE, MBA_CONFIGURATION_DIGITAL__FACTORY_SETTING, 24800UL },
+	{ 1, MBA_MODBUS_ID__ACCESS_LEVEL, 8, MBA_MODBUS_ID__MIN_VALUE, MBA_MODBUS_ID__MAX_VALUE, MBA_MODBUS_ID__FACTORY_SETTING, 24832UL },
+	{ 1, MBA_MODBUS_BAUDRATE__ACCESS_LEVEL, 2, MBA_MODBUS_BAUDRATE__MIN_VALUE, MBA_MODBUS_BAUDRATE__MAX_VALUE, MBA_MODBUS_BAUDRATE__FACTORY_SETTING, 24840UL },
+	{ 1, MBM_MODBUS_MASTER_SLAVE__ACCESS_LEVEL, 1, MBM_MODBUS_MASTER_SLAVE__MIN_VALUE, MBM_MODBUS_MASTER_SLAVE__MAX_VALUE, MBM_MODBUS_MASTER_SLAVE__FACTORY_SETTING, 24842UL },
+	{ 1, MBM_MODBUS_TIMEOUT__ACCESS_LEVEL, 7, MBM_MODBUS_TIMEOUT__MIN_VALUE, MBM_MODBUS_TIMEOUT__MAX_VALUE, MBM_MODBUS_TIMEOUT__FACTORY_SETTING, 24843UL },
+	{ 1, ENG_FLUSHING_TIME__ACCESS_LEVEL, 14, ENG_FLUSHING_TIME__MIN_VALUE, ENG_FLUSHING_TIME__MAX_VALUE, ENG_FLUSHING_TIME__FACTORY_SETTING, 24850UL },
+	{ 1, LS_GEN_REG_VOLT_KI__ACCESS_LEVEL, 7, LS_GEN_REG_VOLT_KI__MIN_VALUE, LS_GEN_REG_VOLT_KI__MAX_VALUE, LS_GEN_REG_VOLT_KI__FACTORY_SETTING, 24864UL },
+	{ 1, LS_GEN_REG_VAR_KI__ACCESS_LEVEL, 7, LS_GEN_REG_VAR_KI__MIN_VALUE, LS_GEN_REG_VAR_KI__MAX_VALUE, LS_GEN_REG_VAR_KI__FACTORY_SETTING, 24871UL },
+	{ 1, LS_TUR_REG_SPEED_KP__ACCESS_LEVEL, 17, LS_TUR_REG_SPEED_KP__MIN_VALUE, LS_TUR_REG_SPEED_KP__MAX_VALUE, LS_TUR_REG_SPEED_KP__FACTORY_SETTING, 24878UL },
+	{ 1, LS_TUR_REG_SPEED_KI__ACCESS_LEVEL, 17, LS_TUR_REG_SPEED_KI__MIN_VALUE, LS_TUR_REG_SPEED_KI__MAX_VALUE, LS_TUR_REG_SPEED_KI__FACTORY_SETTING, 24895UL },
+	{ 1, LS_TUR_REG_SPEED_KD__ACCESS_LEVEL, 17, LS_TUR_REG_SPEED_KD__MIN_VALUE, LS_TUR_REG_SPEED_KD__MAX_VALUE, LS_TUR_REG_SPEED_KD__FACTORY_SETTING, 24912UL },
+	{ 1, LS_TUR_REG_LOAD_KP__ACCESS_LEVEL, 17, LS_TUR_REG_LOAD_KP__MIN_VALUE, LS_TUR_REG_LOAD_KP__MAX_VALUE, LS_TUR_REG_LOAD_KP__FACTORY_SETTING, 24929UL },
+	{ 1, LS_TUR_REG_LOAD_KI__ACCESS_LEVEL, 17, LS_TUR_REG_LOAD_KI__MIN_VALUE, LS_TUR_REG_LOAD_KI__MAX_VALUE, LS_TUR_REG_LOAD_KI__FACTORY_SETTING, 24946UL },
+	{ 1, LS_TUR_REG_LOAD_KD__ACCESS_LEVEL, 17, LS_TUR_REG_LOAD_KD__MIN_VALUE, LS_TUR_REG_LOAD_KD__MAX_VALUE, LS_TUR_REG_LOAD_KD__FACTORY_SETTING, 24963UL },
+	{ 1, PMS_ENGINE_CONFIG__ACCESS_LEVEL, 15, PMS_ENGINE_CONFIG__MIN_VALUE, PMS_ENGINE_CONFIG__MAX_VALUE, PMS_ENGINE_CONFIG__FACTORY_SETTING, 24980UL },
+	{ 1, BYP_OPEN_ABOVE_FLOW_TEMP__ACCESS_LEVEL, 10, BYP_OPEN_ABOVE_FLOW_TEMP__MIN_VALUE, BYP_OPEN_ABOVE_FLOW_TEMP__MAX_VALUE, BYP_OPEN_ABOVE_FLOW_TEMP__FACTORY_SETTING, 24995UL },
+	{ 1, BYP_OPEN_ABOVE_RETURN_TEMP__ACCESS_LEVEL, 10, BYP_OPEN_ABOVE_RETURN_TEMP__MIN_VALUE, BYP_OPEN_ABOVE_RETURN_TEMP__MAX_VALUE, BYP_OPEN_ABOVE_RETURN_TEMP__FACTORY_SETTING, 25005UL },
+	{ 1, BYP_CLOSE_BELOW_FLOW_TEMP__ACCESS_LEVEL, 10, BYP_CLOSE_BELOW_FLOW_TEMP__MIN_VALUE, BYP_CLOSE_BELOW_FLOW_TEMP__MAX_VALUE, BYP_CLOSE_BELOW_FLOW_TEMP__FACTORY_SETTING, 25015UL },
+	{ 1, BYP_CLOSE_BELOW_RETURN_TEMP__ACCESS_LEVEL, 10, BYP_CLOSE_BELOW_RETURN_TEMP__MIN_VALUE, BYP_CLOSE_BELOW_RETURN_TEMP__MAX_VALUE, BYP_CLOSE_BELOW_RETURN_TEMP__FACTORY_SETTING, 25025UL },
+	{ 1, PMS_MODE__ACCESS_LEVEL, 1, PMS_MODE__MIN_VALUE, PMS_MODE__MAX_VALUE, PMS_MODE__FACTORY_SETTING, 25035UL },
+	{ 1, PMS_RUNNING_HOURS__ACCESS_LEVEL, 31, PMS_RUNNING_HOURS__MIN_VALUE, PMS_RUNNING_HOURS__MAX_VALUE, PMS_RUNNING_HOURS__FACTORY_SETTING, 25036UL },
+	{ 1, PMS_RUNNING_HOURS_INTERVAL__ACCESS_LEVEL, 10, PMS_RUNNING_HOURS_INTERVAL__MIN_VALUE, PMS_RUNNING_HOURS_INTERVAL__MAX_VALUE, PMS_RUNNING_HOURS_INTERVAL__FACTORY_SETTING, 25067UL },
+	{ 1, PMS_ISLAND_POWER_LIMIT_START__ACCESS_LEVEL, 13, PMS_ISLAND_POWER_LIMIT_START__MIN_VALUE, PMS_ISLAND_POWER_LIMIT_START__MAX_VALUE, PMS_ISLAND_POWER_LIMIT_START__FACTORY_SETTING, 25077UL },
+	{ 1, PMS_ISLAND_START_DELAY__ACCESS_LEVEL, 20, PMS_ISLAND_START_DELAY__MIN_VALUE, PMS_ISLAND_START_DELAY__MAX_VALUE, PMS_ISLAND_START_DELAY__FACTORY_SETTING, 25090UL },
+	{ 1, PMS_ISLAND_POWER_LIMIT_STOP__ACCESS_LEVEL, 13, PMS_ISLAND_POWER_LIMIT_STOP__MIN_VALUE, PMS_ISLAND_POWER_LIMIT_STOP__MAX_VALUE, PMS_ISLAND_POWER_LIMIT_STOP__FACTORY_SETTING, 25110UL },
+	{ 1, PMS_ISLAND_STOP_DELAY__ACCESS_LEVEL, 22, PMS_ISLAND_STOP_DELAY__MIN_VALUE, PMS_ISLAND_STOP_DELAY__MAX_VALUE, PMS_ISLAND_STOP_DELAY__FACTORY_SETTING, 25123UL },
+	{ 1, PMS_PARALLEL_POWER_LIMIT_START__ACCESS_LEVEL, 13, PMS_PARALLEL_POWER_LIMIT_START__MIN_VALUE, PMS_PARALLEL_POWER_LIMIT_START__MAX_VALUE, PMS_PARALLEL_POWER_LIMIT_START__FACTORY_SETTING, 25145UL },
+	{ 1, PMS_PARALLEL_START_DELAY__ACCESS_LEVEL, 20, PMS_PARALLEL_START_DELAY__MIN_VALUE, PMS_PARALLEL_START_DELAY__MAX_VALUE, PMS_PARALLEL_START_DELAY__FACTORY_SETTING, 25158UL },
+	{ 1, PMS_PARALLEL_POWER_LIMIT_STOP__ACCESS_LEVEL, 14, PMS_PARALLEL_POWER_LIMIT_STOP__MIN_VALUE, PMS_PARALLEL_POWER_LIMIT_STOP__MAX_VALUE, PMS_PARALLEL_POWER_LIMIT_STOP__FACTORY_SETTING, 25178UL },
+	{ 1, PMS_PARALLEL_STOP_DELAY__ACCESS_LEVEL, 22, PMS_PARALLEL_STOP_DELAY__MIN_VALUE, PMS_PARALLEL_STOP_DELAY__MAX_VALUE, PMS_PARALLEL_STOP_DELAY__FACTORY_SETTING, 25192UL },
+	{ 1, PMS_POWER_SETPOINT__ACCESS_LEVEL, 15, PMS_POWER_SETPOINT__MIN_VALUE, PMS_POWER_SETPOINT__MAX_VALUE, PMS_POWER_SETPOINT__FACTORY_SETTING, 25214UL },
+	{ 1, PMS_REG_CH4__ACCESS_LEVEL, 4, PMS_REG_CH4__MIN_VALUE, PMS_REG_CH4__MAX_VALUE, PMS_REG_CH4__FACTORY_SETTING, 25229UL },
+	{ 1, PMS_REG_GAS_LEVEL__ACCESS_LEVEL, 4, PMS_REG_GAS_LEVEL__MIN_VALUE, PMS_REG_GAS_LEVEL__MAX_VALUE, PMS_REG_GAS_LEVEL__FACTORY_SETTING, 25233UL },
+	{ 1, PMS_REG_MAINS_POWER__ACCESS_LEVEL, 4, PMS_REG_MAINS_POWER__MIN_VALUE, PMS_REG_MAINS_POWER__MAX_VALUE, PMS_REG_MAINS_POWER__FACTORY_SETTING, 25237UL },
+	{ 1, ENG_CRANK_CASE_PRESS_MIN__ACCESS_LEVEL, 10, ENG_CRANK_CASE_PRESS_MIN__MIN_VALUE, ENG_CRANK_CASE_PRESS_MIN__MAX_VALUE, ENG_CRANK_CASE_PRESS_MIN__FACTORY_SETTING, 25241UL },
+	{ 1, ENG_CRANK_CASE_PRESS_MAX__ACCESS_LEVEL, 10, ENG_CRANK_CASE_PRESS_MAX__MIN_VALUE, ENG_CRANK_CASE_PRESS_MAX__MAX_VALUE, ENG_CRANK_CASE_PRESS_MAX__FACTORY_SETTING, 25251UL },
+	{ 1, PID_LIMIT_MIN_1__ACCESS_LEVEL, 16, PID_LIMIT_MIN_1__MIN_VALUE, PID_LIMIT_MIN_1__MAX_VALUE, PID_LIMIT_MIN_1__FACTORY_SETTING, 25261UL },
+	{ 1, PID_LIMIT_MAX_1__ACCESS_LEVEL, 16, PID_LIMIT_MAX_1__MIN_VALUE, PID_LIMIT_MAX_1__MAX_VALUE, PID_LIMIT_MAX_1__FACTORY_SETTING, 25277UL },
+	{ 1, PID_LIMIT_MIN_2__ACCESS_LEVEL, 16, PID_LIMIT_MIN_2__MIN_VALUE, PID_LIMIT_MIN_2__MAX_VALUE, PID_LIMIT_MIN_2__FACTORY_SETTING, 25293UL },
+	{ 1, PID_LIMIT_MAX_2__ACCESS_LEVEL, 16, PID_LIMIT_MAX_2__MIN_VALUE, PID_LIMIT_MAX_2__MAX_VALUE, PID_LIMIT_MAX_2__FACTORY_SETTING, 25309UL },
+	{ 1, PID_LIMIT_MIN_3__ACCESS_LEVEL, 16, PID_LIMIT_MIN_3__MIN_VALUE, PID_LIMIT_MIN_3__MAX_VALUE, PID_LIMIT_MIN_3__FACTORY_SETTING, 25325UL },
+	{ 1, PID_LIMIT_MAX_3__ACCESS_LEVEL, 16, PID_LIMIT_MAX_3__MIN_VALUE, PID_LIMIT_MAX_3__MAX_VALUE, PID_LIMIT_MAX_3__FACTORY_SETTING, 25341UL },
+	{ 1, PID_LIMIT_MIN_4__ACCESS_LEVEL, 16, PID_LIMIT_MIN_4__MIN_VALUE, PID_LIMIT_MIN_4__MAX_VALUE, PID_LIMIT_MIN_4__FACTORY_SETTING, 25357UL },
+	{ 1, PID_LIMIT_MAX_4__ACCESS_LEVEL, 16, PID_LIMIT_MAX_4__MIN_VALUE, PID_LIMIT_MAX_4__MAX_VALUE, PID_LIMIT_MAX_4__FACTORY_SETTING, 25373UL },
+	{ 1, PID_LIMIT_MIN_5__ACCESS_LEVEL, 16, PID_LIMIT_MIN_5__MIN_VALUE, PID_LIMIT_MIN_5__MAX_VALUE, PID_LIMIT_MIN_5__FACTORY_SETTING, 25389UL },
+	{ 1, PID_LIMIT_MAX_5__ACCESS_LEVEL, 16, PID_LIMIT_MAX_5__MIN_VALUE, PID_LIMIT_MAX_5__MAX_VALUE, PID_LIMIT_MAX_5__FACTORY_SETTING, 25405UL },
+	{ 1, PID_SETPOINT_1__ACCESS_LEVEL, 15, PID_SETPOINT_1__MIN_VALUE, PID_SETPOINT_1__MAX_VALUE, PID_SETPOINT_1__FACTORY_SETTING, 25421UL },
+	{ 1, PID_KP_1__ACCESS_LEVEL, 14, PID_KP_1__MIN_VALUE, PID_KP_1__MAX_VALUE, PID_KP_1__FACTORY_SETTING, 25436UL },
+	{ 1, PID_KI_1__ACCESS_LEVEL, 14, PID_KI_1__MIN_VALUE, PID_KI_1__MAX_VALUE, PID_KI_1__FACTORY_SETTING, 25450UL },
+	{ 1, PID_KD_1__ACCESS_LEVEL, 14, PID_KD_1__MIN_VALUE, PID_KD_1__MAX_VALUE, PID_KD_1__FACTORY_SETTING, 25464UL },
+	{ 1, PID_LOGIC_1__ACCESS_LEVEL, 1, PID_LOGIC_1__MIN_VALUE, PID_LOGIC_1__MAX_VALUE, PID_LOGIC_1__FACTORY_SETTING, 25478UL },
+	{ 1, PID_RESET_VALUE_1__ACCESS_LEVEL, 16, PID_RESET_VALUE_1__MIN_VALUE, PID_RESET_VALUE_1__MAX_VALUE, PID_RESET_VALUE_1__FACTORY_SETTING, 25479UL },
+	{ 1, PID_SETPOINT_2__ACCESS_LEVEL, 15, PID_SETPOINT_2__MIN_VALUE, PID_SETPOINT_2__MAX_VALUE, PID_SETPOINT_2__FACTORY_SETTING, 25495UL },
+	{ 1, PID_KP_2__ACCESS_LEVEL, 14, PID_KP_2__MIN_VALUE, PID_KP_2__MAX_VALUE, PID_KP_2__FACTORY_SETTING, 25510UL },
+	{ 1, PID_KI_2__ACCESS_LEVEL, 14, PID_KI_2__MIN_VALUE, PID_KI_2__MAX_VALUE, PID_KI_2__FACTORY_SETTING, 25524UL },
+	{ 1, PID_KD_2__ACCESS_LEVEL, 14, PID_KD_2__MIN_VALUE, PID_KD_2__MAX_VALUE, PID_KD_2__FACTORY_SETTING, 25538UL },
+	{ 1, PID_LOGIC_2__ACCESS_LEVEL, 1, PID_LOGIC_2__MIN_VALUE, PID_LOGIC_2__MAX_VALUE, PID_LOGIC_2__FACTORY_SETTING, 25552UL },
+	{ 1, PID_RESET_VALUE_2__ACCESS_LEVEL, 16, PID_RESET_VALUE_2__MIN_VALUE, PID_RESET_VALUE_2__MAX_VALUE, PID_RESET_VALUE_2__FACTORY_SETTING, 25553UL },
+	{ 1, PID_SETPOINT_3__ACCESS_LEVEL, 15, PID_SETPOINT_3__MIN_VALUE, PID_SETPOINT_3__MAX_VALUE, PID_SETPOINT_3__FACTORY_SETTING, 25569UL },
+	{ 1, PID_KP_3__ACCESS_LEVEL, 14, PID_KP_3__MIN_VALUE, PID_KP_3__MAX_VALUE, PID_KP_3__FACTORY_SETTING, 25584UL },
+	{ 1, PID_KI_3__ACCESS_LEVEL, 14, PID_KI_3__MIN_VALUE, PID_KI_3__MAX_VALUE, PID_KI_3__FACTORY_SETTING, 25598UL },
+	{ 1, PID_KD_3__ACCESS_LEVEL, 14, PID_KD_3__MIN_VALUE, PID_KD_3__MAX_VALUE, PID_KD_3__FACTORY_SETTING, 25612UL },
+	{ 1, PID_LOGIC_3__ACCESS_LEVEL, 1, PID_LOGIC_3__MIN_VALUE, PID_LOGIC_3__MAX_VALUE, PID_LOGIC_3__FACTORY_SETTING, 25626UL },
+	{ 1, PID_RESET_VALUE_3__ACCESS_LEVEL, 16, PID_RESET_VALUE_3__MIN_VALUE, PID_RESET_VALUE_3__MAX_VALUE, PID_RESET_VALUE_3__FACTORY_SETTING, 25627UL },
+	{ 1, PID_SETPOINT_4__ACCESS_LEVEL, 15, PID_SETPOINT_4__MIN_VALUE, PID_SETPOINT_4__MAX_VALUE, PID_SETPOINT_4__FACTORY_SETTING, 25643UL },
+	{ 1, PID_KP_4__ACCESS_LEVEL, 14, PID_KP_4__MIN_VALUE, PID_KP_4__MAX_VALUE, PID_KP_4__FACTORY_SETTING, 25658UL },
+	{ 1, PID_KI_4__ACCESS_LEVEL, 14, PID_KI_4__MIN_VALUE, PID_KI_4__MAX_VALUE, PID_KI_4__FACTORY_SETTING, 25672UL },
+	{ 1, PID_KD_4__ACCESS_LEVEL, 14, PID_KD_4__MIN_VALUE, PID_KD_4__MAX_VALUE, PID_KD_4__FACTORY_SETTING, 25686UL },
+	{ 1, PID_LOGIC_4__ACCESS_LEVEL, 1, PID_LOGIC_4__MIN_VALUE, PID_LOGIC_4__MAX_VALUE, PID_LOGIC_4__FACTORY_SETTING, 25700UL },
+	{ 1, PID_RESET_VALUE_4__ACCESS_LEVEL, 16, PID_RESET_VALUE_4__MIN_VALUE, PID_RESET_VALUE_4__MAX_VALUE, PID_RESET_VALUE_4__FACTORY_SETTING, 25701UL },
+	{ 1, PID_SETPOINT_5__ACCESS_LEVEL, 15, PID_SETPOINT_5__MIN_VALUE, PID_SETPOINT_5__MAX_VALUE, PID_SETPOINT_5__FACTORY_SETTING, 25717UL },
+	{ 1, PID_KP_5__ACCESS_LEVEL, 14, PID_KP_5__MIN_VALUE, PID_KP_5__MAX_VALUE, PID_KP_5__FACTORY_SETTING, 25732UL },
+	{ 1, PID_KI_5__ACCESS_LEVEL, 14, PID_KI_5__MIN_VALUE, PID_KI_5__MAX_VALUE, PID_KI_5__FACTORY_SETTING, 25746UL },
+	{ 1, PID_KD_5__ACCESS_LEVEL, 14, PID_KD_5__MIN_VALUE, PID_KD_5__MAX_VALUE, PID_KD_5__FACTORY_SETTING, 25760UL },
+	{ 1, PID_LOGIC_5__ACCESS_LEVEL, 1, PID_LOGIC_5__MIN_VALUE, PID_LOGIC_5__MAX_VALUE, PID_LOGIC_5__FACTORY_SETTING, 25774UL },
+	{ 1, PID_RESET_VALUE_5__ACCESS_LEVEL, 16, PID_RESET_VALUE_5__MIN_VALUE, PID_RESET_VALUE_5__MAX_VALUE, PID_RESET_VALUE_5__FACTORY_SETTING, 25775UL },
+	{ 1, PID_VALUE_4mA_1__ACCESS_LEVEL, 15, PID_VALUE_4mA_1__MIN_VALUE, PID_VALUE_4mA_1__MAX_VALUE, PID_VALUE_4mA_1__FACTORY_SETTING, 25791UL },
+	{ 1, PID_VALUE_4mA_2__ACCESS_LEVEL, 15, PID_VALUE_4mA_2__MIN_VALUE, PID_VALUE_4mA_2__MAX_VALUE, PID_VALUE_4mA_2__FACTORY_SETTING, 25806UL },
+	{ 1, PID_VALUE_4mA_3__ACCESS_LEVEL, 15, PID_VALUE_4mA_3__MIN_VALUE, PID_VALUE_4mA_3__MAX_VALUE, PID_VALUE_4mA_3__FACTORY_SETTING, 25821UL },
+	{ 1, PID_VALUE_4mA_4__ACCESS_LEVEL, 15, PID_VALUE_4mA_4__MIN_VALUE, PID_VALUE_4mA_4__MAX_VALUE, PID_VALUE_4mA_4__FACTORY_SETTING, 25836UL },
+	{ 1, PID_VALUE_4mA_5__ACCESS_LEVEL, 15, PID_VALUE_4mA_5__MIN_VALUE, PID_VALUE_4mA_5__MAX_VALUE, PID_VALUE_4mA_5__FACTORY_SETTING, 25851UL },
+	{ 1, PID_VALUE_20mA_1__ACCESS_LEVEL, 15, PID_VALUE_20mA_1__MIN_VALUE, PID_VALUE_20mA_1__MAX_VALUE, PID_VALUE_20mA_1__FACTORY_SETTING, 25866UL },
+	{ 1, PID_VALUE_20mA_2__ACCESS_LEVEL, 15, PID_VALUE_20mA_2__MIN_VALUE, PID_VALUE_20mA_2__MAX_VALUE, PID_VALUE_20mA_2__FACTORY_SETTING, 25881UL },
+	{ 1, PID_VALUE_20mA_3__ACCESS_LEVEL, 15, PID_VALUE_20mA_3__MIN_VALUE, PID_VALUE_20mA_3__MAX_VALUE, PID_VALUE_20mA_3__FACTORY_SETTING, 25896UL },
+	{ 1, PID_VALUE_20mA_4__ACCESS_LEVEL, 15, PID_VALUE_20mA_4__MIN_VALUE, PID_VALUE_20mA_4__MAX_VALUE, PID_VALUE_20mA_4__FACTORY_SETTING, 25911UL },
+	{ 1, PID_VALUE_20mA_5__ACCESS_LEVEL, 15, PID_VALUE_20mA_5__MIN_VALUE, PID_VALUE_20mA_5__MAX_VALUE, PID_VALUE_20mA_5__FACTORY_SETTING, 25926UL },
+	{ 1, PID_UNIT_1__ACCESS_LEVEL, 6, PID_UNIT_1__MIN_VALUE, PID_UNIT_1__MAX_VALUE, PID_UNIT_1__FACTORY_SETTING, 25941UL },
+	{ 1, PID_UNIT_2__ACCESS_LEVEL, 6, PID_UNIT_2__MIN_VALUE, PID_UNIT_2__MAX_VALUE, PID_UNIT_2__FACTORY_SETTING, 25947UL },
+	{ 1, PID_UNIT_3__ACCESS_LEVEL, 6, PID_UNIT_3__MIN_VALUE, PID_UNIT_3__MAX_VALUE, PID_UNIT_3__FACTORY_SETTING, 25953UL },
+	{ 1, PID_UNIT_4__ACCESS_LEVEL, 6, PID_UNIT_4__MIN_VALUE, PID_UNIT_4__MAX_VALUE, PID_UNIT_4__FACTORY_SETTING, 25959UL },
+	{ 1, PID_UNIT_5__ACCESS_LEVEL, 6, PID_UNIT_5__MIN_VALUE, PID_UNIT_5__MAX_VALUE, PID_UNIT_5__FACTORY_SETTING, 25965UL },
+	{ 1, PID_CONF_TMP_1__ACCESS_LEVEL, 32, PID_CONF_TMP_1__MIN_VALUE, PID_CONF_TMP_1__MAX_VALUE, PID_CONF_TMP_1__FACTORY_SETTING, 25971UL },
+	{ 1, PID_CONF_TMP_2__ACCESS_LEVEL, 32, PID_CONF_TMP_2__MIN_VALUE, PID_CONF_TMP_2__MAX_VALUE, PID_CONF_TMP_2__FACTORY_SETTING, 26003UL },
+	{ 1, PID_CONF_TMP_3__ACCESS_LEVEL, 32, PID_CONF_TMP_3__MIN_VALUE, PID_CONF_TMP_3__MAX_VALUE, PID_CONF_TMP_3__FACTORY_SETTING, 26035UL },
+	{ 1, PID_CONF_TMP_4__ACCESS_LEVEL, 32, PID_CONF_TMP_4__MIN_VALUE, PID_CONF_TMP_4__MAX_VALUE, PID_CONF_TMP_4__FACTORY_SETTING, 26067UL },
+	{ 1, PID_CONF_TMP_5__ACCESS_LEVEL, 32, PID_CONF_TMP_5__MIN_VALUE, PID_CONF_TMP_5__MAX_VALUE, PID_CONF_TMP_5__FACTORY_SETTING, 26099UL },
+	{ 1, GKK_SETPOINT_VENT__ACCESS_LEVEL, 10, GKK_SETPOINT_VENT__MIN_VALUE, GKK_SETPOINT_VENT__MAX_VALUE, GKK_SETPOINT_VENT__FACTORY_SETTING, 26131UL },
+	{ 1, GKK_KP_VENT__ACCESS_LEVEL, 14, GKK_KP_VENT__MIN_VALUE, GKK_KP_VENT__MAX_VALUE, GKK_KP_VENT__FACTORY_SETTING, 26141UL },
+	{ 1, GKK_KI_VENT__ACCESS_LEVEL, 10, GKK_KI_VENT__MIN_VALUE, GKK_KI_VENT__MAX_VALUE, GKK_KI_VENT__FACTORY_SETTING, 26155UL },
+	{ 1, NKK_SETPOINT_VENT__ACCESS_LEVEL, 10, NKK_SETPOINT_VENT__MIN_VALUE, NKK_SETPOINT_VENT__MAX_VALUE, NKK_SETPOINT_VENT__FACTORY_SETTING, 26165UL },
+	{ 1, NKK_KP_VENT__ACCESS_LEVEL, 14, NKK_KP_VENT__MIN_VALUE, NKK_KP_VENT__MAX_VALUE, NKK_KP_VENT__FACTORY_SETTING, 26175UL },
+	{ 1, NKK_KI_VENT__ACCESS_LEVEL, 10, NKK_KI_VENT__MIN_VALUE, NKK_KI_VENT__MAX_VALUE, NKK_KI_VENT__FACTORY_SETTING, 26189UL },
+	{ 1, VENTILATION_OPTION_DAHLANDER__ACCESS_LEVEL, 1, VENTILATION_OPTION_DAHLANDER__MIN_VALUE, VENTILATION_OPTION_DAHLANDER__MAX_VALUE, VENTILATION_OPTION_DAHLANDER__FACTORY_SETTING, 26199UL },
+	{ 1, HKS_REGULATION_ON_HW_RETURN__ACCESS_LEVEL, 1, HKS_REGULATION_ON_HW_RETURN__MIN_VALUE, HKS_REGULATION_ON_HW_RETURN__MAX_VALUE, HKS_REGULATION_ON_HW_RETURN__FACTORY_SETTING, 26200UL },
+	{ 1, HKS_SETPOINT_HW_TEMP__ACCESS_LEVEL, 10, HKS_SETPOINT_HW_TEMP__MIN_VALUE, HKS_SETPOINT_HW_TEMP__MAX_VALUE, HKS_SETPOINT_HW_TEMP__FACTORY_SETTING, 26201UL },
+	{ 1, CYL_MAX_TEMP__ACCESS_LEVEL, 14, CYL_MAX_TEMP__MIN_VALUE, CYL_MAX_TEMP__MAX_VALUE, CYL_MAX_TEMP__FACTORY_SETTING, 26211UL },
+	{ 1, CYL_TEMP_MODE__ACCESS_LEVEL, 32, CYL_TEMP_MODE__MIN_VALUE, CYL_TEMP_MODE__MAX_VALUE, CYL_TEMP_MODE__FACTORY_SETTING, 26225UL },
+	{ 1, CYL_MIN_TEMP__ACCESS_LEVEL, 13, CYL_MIN_TEMP__MIN_VALUE, CYL_MIN_TEMP__MAX_VALUE, CYL_MIN_TEMP__FACTORY_SETTING, 26257UL },
+	{ 1, CYL_MAX_TEMP_DEVIATION__ACCESS_LEVEL, 13, CYL_MAX_TEMP_DEVIATION__MIN_VALUE, CYL_MAX_TEMP_DEVIATION__MAX_VALUE, CYL_MAX_TEMP_DEVIATION__FACTORY_SETTING, 26270UL },
+	{ 1, ENGINE_TYPE__ACCESS_LEVEL, 1, ENGINE_TYPE__MIN_VALUE, ENGINE_TYPE__MAX_VALUE, ENGINE_TYPE__FACTORY_SETTING, 26283UL },
+	{ 1, COM_WAIT_AFTER_START__ACCESS_LEVEL, 17, COM_WAIT_AFTER_START__MIN_VALUE, COM_WAIT_AFTER_START__MAX_VALUE, COM_WAIT_AFTER_START__FACTORY_SETTING, 26284UL },
+	{ 1, GRID_VECTORJUMP_ON_OFF__ACCESS_LEVEL, 1, GRID_VECTORJUMP_ON_OFF__MIN_VALUE, GRID_VECTORJUMP_ON_OFF__MAX_VALUE, GRID_VECTORJUMP_ON_OFF__FACTORY_SETTING, 26301UL },
+	{ 1, GRID_OVERVOLTAGE_1aD__ACCESS_LEVEL, 18, GRID_OVERVOLTAGE_1aD__MIN_VALUE, GRID_OVERVOLTAGE_1aD__MAX_VALUE, GRID_OVERVOLTAGE_1aD__FACTORY_SETTING, 26302UL },
+	{ 1, GRID_OVERVOLTAGE_1aD_DELAY__ACCESS_LEVEL, 18, GRID_OVERVOLTAGE_1aD_DELAY__MIN_VALUE, GRID_OVERVOLTAGE_1aD_DELAY__MAX_VALUE, GRID_OVERVOLTAGE_1aD_DELAY__FACTORY_SETTING, 26320UL },
+	{ 1, BYP_OPTION_STOP__ACCESS_LEVEL, 1, BYP_OPTION_STOP__MIN_VALUE, BYP_OPTION_STOP__MAX_VALUE, BYP_OPTION_STOP__FACTORY_SETTING, 26338UL },
+	{ 1, EMERG_COOLER_STAGE_SWITCH_ON3_COND_VALVE_POS__ACCESS_LEVEL, 10, EMERG_COOLER_STAGE_SWITCH_ON3_COND_VALVE_POS__MIN_VALUE, EMERG_COOLER_STAGE_SWITCH_ON3_COND_VALVE_POS__MAX_VALUE, EMERG_COOLER_STAGE_SWITCH_ON3_COND_VALVE_POS__FACTORY_SETTING, 26339UL },
+	{ 1, PAR_GAS_FLOW__ACCESS_LEVEL, 17, PAR_GAS_FLOW__MIN_VALUE, PAR_GAS_FLOW__MAX_VALUE, PAR_GAS_FLOW__FACTORY_SETTING, 26349UL },
+	{ 1, GEN_REACTIVE_EXPORT_AT_0KW__ACCESS_LEVEL, 9, GEN_REACTIVE_EXPORT_AT_0KW__MIN_VALUE, GEN_REACTIVE_EXPORT_AT_0KW__MAX_VALUE, GEN_REACTIVE_EXPORT_AT_0KW__FACTORY_SETTING, 26366UL },
+	{ 1, GEN_REACTIVE_EXPORT_AT_PNOM__ACCESS_LEVEL, 8, GEN_REACTIVE_EXPORT_AT_PNOM__MIN_VALUE, GEN_REACTIVE_EXPORT_AT_PNOM__MAX_VALUE, GEN_REACTIVE_EXPORT_AT_PNOM__FACTORY_SETTING, 26375UL },
+	{ 1, GEN_REACTIVE_IMPORT_AT_0KW__ACCESS_LEVEL, 7, GEN_REACTIVE_IMPORT_AT_0KW__MIN_VALUE, GEN_REACTIVE_IMPORT_AT_0KW__MAX_VALUE, GEN_REACTIVE_IMPORT_AT_0KW__FACTORY_SETTING, 26383UL },
+	{ 1, GEN_REACTIVE_IMPORT_AT_PNOM__ACCESS_LEVEL, 7, GEN_REACTIVE_IMPORT_AT_PNOM__MIN_VALUE, GEN_REACTIVE_IMPORT_AT_PNOM__MAX_VALUE, GEN_REACTIVE_IMPORT_AT_PNOM__FACTORY_SETTING, 26390UL },
+	{ 1, AKR_COMMUNICATION__ACCESS_LEVEL, 1, AKR_COMMUNICATION__MIN_VALUE, AKR_COMMUNICATION__MAX_VALUE, AKR_COMMUNICATION__FACTORY_SETTING, 26397UL },
+	{ 1, AKR_USE_PAR_FILE__ACCESS_LEVEL, 1, AKR_USE_PAR_FILE__MIN_VALUE, AKR_USE_PAR_FILE__MAX_VALUE, AKR_USE_PAR_FILE__FACTORY_SETTING, 26398UL },
+	{ 1, MCD_CAMSHAFT_OFFSET__ACCESS_LEVEL, 13, MCD_CAMSHAFT_OFFSET__MIN_VALUE, MCD_CAMSHAFT_OFFSET__MAX_VALUE, MCD_CAMSHAFT_OFFSET__FACTORY_SETTING, 26399UL },
+	{ 1, AKR_KNOCK_THRESHOLD__ACCESS_LEVEL, 16, AKR_KNOCK_THRESHOLD__MIN_VALUE, AKR_KNOCK_THRESHOLD__MAX_VALUE, AKR_KNOCK_THRESHOLD__FACTORY_SETTING, 26412UL },
+	{ 1, AKR_KNOCK_INT_MAX__ACCESS_LEVEL, 15, AKR_KNOCK_INT_MAX__MIN_VALUE, AKR_KNOCK_INT_MAX__MAX_VALUE, AKR_KNOCK_INT_MAX__FACTORY_SETTING, 26428UL },
+	{ 1, AKR_KNOCK_THRESHOLD_ANALOG__ACCESS_LEVEL, 16, AKR_KNOCK_THRESHOLD_ANALOG__MIN_VALUE, AKR_KNOCK_THRESHOLD_ANALOG__MAX_VALUE, AKR_KNOCK_THRESHOLD_ANALOG__FACTORY_SETTING, 26443UL },
+	{ 1, AKR_KNOCK_INT_RETARD__ACCESS_LEVEL, 12, AKR_KNOCK_INT_RETARD__MIN_VALUE, AKR_KNOCK_INT_RETARD__MAX_VALUE, AKR_KNOCK_INT_RETARD__FACTORY_SETTING, 26459UL },
+	{ 1, AKR_KNOCK_INT_ADVANCE__ACCESS_LEVEL, 12, AKR_KNOCK_INT_ADVANCE__MIN_VALUE, AKR_KNOCK_INT_ADVANCE__MAX_VALUE, AKR_KNOCK_INT_ADVANCE__FACTORY_SETTING, 26471UL },
+	{ 1, AKR_IGNITION_ANGLE_WARNING__ACCESS_LEVEL, 7, AKR_IGNITION_ANGLE_WARNING__MIN_VALUE, AKR_IGNITION_ANGLE_WARNING__MAX_VALUE, AKR_IGNITION_ANGLE_WARNING__FACTORY_SETTING, 26483UL },
+	{ 1, AKR_IGNITION_ANGLE_FAULT__ACCESS_LEVEL, 7, AKR_IGNITION_ANGLE_FAULT__MIN_VALUE, AKR_IGNITION_ANGLE_FAULT__MAX_VALUE, AKR_IGNITION_ANGLE_FAULT__FACTORY_SETTING, 26490UL },
+	{ 1, IGN_ENGINE_TYPE__ACCESS_LEVEL, 4, IGN_ENGINE_TYPE__MIN_VALUE, IGN_ENGINE_TYPE__MAX_VALUE, IGN_ENGINE_TYPE__FACTORY_SETTING, 26497UL },
+	{ 1, AKR_KNOCK_MONITORING_ACTIVATION_POWER__ACCESS_LEVEL, 13, AKR_KNOCK_MONITORING_ACTIVATION_POWER__MIN_VALUE, AKR_KNOCK_MONITORING_ACTIVATION_POWER__MAX_VALUE, AKR_KNOCK_MONITORING_ACTIVATION_POWER__FACTORY_SETTING, 26501UL },
+	{ 1, MCD_IGNITION_OFFSET_SINGLE__ACCESS_LEVEL, 6, MCD_IGNITION_OFFSET_SINGLE__MIN_VALUE, MCD_IGNITION_OFFSET_SINGLE__MAX_VALUE, MCD_IGNITION_OFFSET_SINGLE__FACTORY_SETTING, 26514UL },
+	{ 1, ANGLE_ADJUST_BY_AKR__ACCESS_LEVEL, 1, ANGLE_ADJUST_BY_AKR__MIN_VALUE, ANGLE_ADJUST_BY_AKR__MAX_VALUE, ANGLE_ADJUST_BY_AKR__FACTORY_SETTING, 26520UL },
+	{ 1, MCD_WRITE_ACCESS__ACCESS_LEVEL, 1, MCD_WRITE_ACCESS__MIN_VALUE, MCD_WRITE_ACCESS__MAX_VALUE, MCD_WRITE_ACCESS__FACTORY_SETTING, 26521UL },
+	{ 1, ZS3_IGNITION_RELEASE__ACCESS_LEVEL, 1, ZS3_IGNITION_RELEASE__MIN_VALUE, ZS3_IGNITION_RELEASE__MAX_VALUE, ZS3_IGNITION_RELEASE__FACTORY_SETTING, 26522UL },
+	{ 1, ZS3_IGNITION_WRITE_ENABLE__ACCESS_LEVEL, 1, ZS3_IGNITION_WRITE_ENABLE__MIN_VALUE, ZS3_IGNITION_WRITE_ENABLE__MAX_VALUE, ZS3_IGNITION_WRITE_ENABLE__FACTORY_SETTING, 26523UL },
+	{ 1, ZS3_ENGINE_TYPE__ACCESS_LEVEL, 4, ZS3_ENGINE_TYPE__MIN_VALUE, ZS3_ENGINE_TYPE__MAX_VALUE, ZS3_ENGINE_TYPE__FACTORY_SETTING, 26524UL },
+	{ 1, ZS3_CAMSHAFT_OFFSET__ACCESS_LEVEL, 11, ZS3_CAMSHAFT_OFFSET__MIN_VALUE, ZS3_CAMSHAFT_OFFSET__MAX_VALUE, ZS3_CAMSHAFT_OFFSET__FACTORY_SETTING, 26528UL },
+	{ 1, ZS3_IGNITION_ANGLE_STANDARD__ACCESS_LEVEL, 5, ZS3_IGNITION_ANGLE_STANDARD__MIN_VALUE, ZS3_IGNITION_ANGLE_STANDARD__MAX_VALUE, ZS3_IGNITION_ANGLE_STANDARD__FACTORY_SETTING, 26539UL },
+	{ 1, ZS3_IGNITION_ANGLE_ALL__ACCESS_LEVEL, 5, ZS3_IGNITION_ANGLE_ALL__MIN_VALUE, ZS3_IGNITION_ANGLE_ALL__MAX_VALUE, ZS3_IGNITION_ANGLE_ALL__FACTORY_SETTING, 26544UL },
+	{ 1, ZS3_IGNITION_ENERGY_STANDARD__ACCESS_LEVEL, 7, ZS3_IGNITION_ENERGY_STANDARD__MIN_VALUE, ZS3_IGNITION_ENERGY_STANDARD__MAX_VALUE, ZS3_IGNITION_ENERGY_STANDARD__FACTORY_SETTING, 26549UL },
+	{ 1, ZS3_IGNITION_ENERGY_ALL__ACCESS_LEVEL, 7, ZS3_IGNITION_ENERGY_ALL__MIN_VALUE, ZS3_IGNITION_ENERGY_ALL__MAX_VALUE, ZS3_IGNITION_ENERGY_ALL__FACTORY_SETTING, 26556UL },
+	{ 1, IGN_WARNING_DELAY__ACCESS_LEVEL, 10, IGN_WARNING_DELAY__MIN_VALUE, IGN_WARNING_DELAY__MAX_VALUE, IGN_WARNING_DELAY__FACTORY_SETTING, 26563UL },
+	{ 1, IGN_FAULT_DELAY__ACCESS_LEVEL, 11, IGN_FAULT_DELAY__MIN_VALUE, IGN_FAULT_DELAY__MAX_VALUE, IGN_FAULT_DELAY__FACTORY_SETTING, 26573UL },
+	{ 1, GPC_SIGNAL_AT_LEVEL_ZERO__ACCESS_LEVEL, 15, GPC_SIGNAL_AT_LEVEL_ZERO__MIN_VALUE, GPC_SIGNAL_AT_LEVEL_ZERO__MAX_VALUE, GPC_SIGNAL_AT_LEVEL_ZERO__FACTORY_SETTING, 26584UL },
+	{ 1, GPC_SIGNAL_AT_LEVEL_FULL__ACCESS_LEVEL, 15, GPC_SIGNAL_AT_LEVEL_FULL__MIN_VALUE, GPC_SIGNAL_AT_LEVEL_FULL__MAX_VALUE, GPC_SIGNAL_AT_LEVEL_FULL__FACTORY_SETTING, 26599UL },
+	{ 1, GPC_FILTER_GAS_LEVEL__ACCESS_LEVEL, 10, GPC_FILTER_GAS_LEVEL__MIN_VALUE, GPC_FILTER_GAS_LEVEL__MAX_VALUE, GPC_FILTER_GAS_LEVEL__FACTORY_SETTING, 26614UL },
+	{ 1, GAS_LEVEL_START_LIMIT__ACCESS_LEVEL, 10, GAS_LEVEL_START_LIMIT__MIN_VALUE, GAS_LEVEL_START_LIMIT__MAX_VALUE, GAS_LEVEL_START_LIMIT__FACTORY_SETTING, 26624UL },
+	{ 1, GAS_LEVEL_START_DELAY__ACCESS_LEVEL, 26, GAS_LEVEL_START_DELAY__MIN_VALUE, GAS_LEVEL_START_DELAY__MAX_VALUE, GAS_LEVEL_START_DELAY__FACTORY_SETTING, 26634UL },
+	{ 1, GAS_LEVEL_STOP_LIMIT__ACCESS_LEVEL, 10, GAS_LEVEL_STOP_LIMIT__MIN_VALUE, GAS_LEVEL_STOP_LIMIT__MAX_VALUE, GAS_LEVEL_STOP_LIMIT__FACTORY_SETTING, 26660UL },
+	{ 1, GAS_LEVEL_LIMIT_FOR_MAXLOAD__ACCESS_LEVEL, 10, GAS_LEVEL_LIMIT_FOR_MAXLOAD__MIN_VALUE, GAS_LEVEL_LIMIT_FOR_MAXLOAD__MAX_VALUE, GAS_LEVEL_LIMIT_FOR_MAXLOAD__FACTORY_SETTING, 26670UL },
+	{ 1, GAS_LEVEL_MINLOAD__ACCESS_LEVEL, 10, GAS_LEVEL_MINLOAD__MIN_VALUE, GAS_LEVEL_MINLOAD__MAX_VALUE, GAS_LEVEL_MINLOAD__FACTORY_SETTING, 26680UL },
+	{ 1, GAS_LEVEL_LIMIT_FOR_MINLOAD__ACCESS_LEVEL, 10, GAS_LEVEL_LIMIT_FOR_MINLOAD__MIN_VALUE, GAS_LEVEL_LIMIT_FOR_MINLOAD__MAX_VALUE, GAS_LEVEL_LIMIT_FOR_MINLOAD__FACTORY_SETTING, 26690UL },
+	{ 1, GAS_LEVEL_LOW_WARNING__ACCESS_LEVEL, 10, GAS_LEVEL_LOW_WARNING__MIN_VALUE, GAS_LEVEL_LOW_WARNING__MAX_VALUE, GAS_LEVEL_LOW_WARNING__FACTORY_SETTING, 26700UL },
+	{ 1, GAS_LEVEL_LOW_CLOSE_VALVE__ACCESS_LEVEL, 10, GAS_LEVEL_LOW_CLOSE_VALVE__MIN_VALUE, GAS_LEVEL_LOW_CLOSE_VALVE__MAX_VALUE, GAS_LEVEL_LOW_CLOSE_VALVE__FACTORY_SETTING, 26710UL },
+	{ 1, LS_SPEED_REG_CONST_P__ACCESS_LEVEL, 14, LS_SPEED_REG_CONST_P__MIN_VALUE, LS_SPEED_REG_CONST_P__MAX_VALUE, LS_SPEED_REG_CONST_P__FACTORY_SETTING, 26720UL },
+	{ 1, LS_SPEED_REG_CONST_I__ACCESS_LEVEL, 14, LS_SPEED_REG_CONST_I__MIN_VALUE, LS_SPEED_REG_CONST_I__MAX_VALUE, LS_SPEED_REG_CONST_I__FACTORY_SETTING, 26734UL },
+	{ 1, LS_SPEED_REG_CONST_D__ACCESS_LEVEL, 14, LS_SPEED_REG_CONST_D__MIN_VALUE, LS_SPEED_REG_CONST_D__MAX_VALUE, LS_SPEED_REG_CONST_D__FACTORY_SETTING, 26748UL },
+	{ 1, GRID_OVERVOLTAGE_AVERAGE__ACCESS_LEVEL, 17, GRID_OVERVOLTAGE_AVERAGE__MIN_VALUE, GRID_OVERVOLTAGE_AVERAGE__MAX_VALUE, GRID_OVERVOLTAGE_AVERAGE__FACTORY_SETTING, 26762UL },
+	{ 1, GRID_OVERVOLTAGE_AVERAGE_TIME__ACCESS_LEVEL, 32, GRID_OVERVOLTAGE_AVERAGE_TIME__MIN_VALUE, GRID_OVERVOLTAGE_AVERAGE_TIME__MAX_VALUE, GRID_OVERVOLTAGE_AVERAGE_TIME__FACTORY_SETTING, 26779UL },
+	{ 1, GRID_UNDERVOLTAGE_1aD__ACCESS_LEVEL, 19, GRID_UNDERVOLTAGE_1aD__MIN_VALUE, GRID_UNDERVOLTAGE_1aD__MAX_VALUE, GRID_UNDERVOLTAGE_1aD__FACTORY_SETTING, 26811UL },
+	{ 1, GRID_UNDERVOLTAGE_1aD_DELAY__ACCESS_LEVEL, 18, GRID_UNDERVOLTAGE_1aD_DELAY__MIN_VALUE, GRID_UNDERVOLTAGE_1aD_DELAY__MAX_VALUE, GRID_UNDERVOLTAGE_1aD_DELAY__FACTORY_SETTING, 26830UL },
+	{ 1, GRID_Q_AND_U_OPTION__ACCESS_LEVEL, 1, GRID_Q_AND_U_OPTION__MIN_VALUE, GRID_Q_AND_U_OPTION__MAX_VALUE, GRID_Q_AND_U_OPTION__FACTORY_SETTING, 26848UL },
+	{ 1, GRID_Q_AND_U_LIMIT__ACCESS_LEVEL, 5, GRID_Q_AND_U_LIMIT__MIN_VALUE, GRID_Q_AND_U_LIMIT__MAX_VALUE, GRID_Q_AND_U_LIMIT__FACTORY_SETTING, 26849UL },
+	{ 1, SYNC_RELEASE_TIME__ACCESS_LEVEL, 20, SYNC_RELEASE_TIME__MIN_VALUE, SYNC_RELEASE_TIME__MAX_VALUE, SYNC_RELEASE_TIME__FACTORY_SETTING, 26854UL },
+	{ 1, SYNC_RELEASE_SHORT_INT__ACCESS_LEVEL, 15, SYNC_RELEASE_SHORT_INT__MIN_VALUE, SYNC_RELEASE_SHORT_INT__MAX_VALUE, SYNC_RELEASE_SHORT_INT__FACTORY_SETTING, 26874UL },
+	{ 1, SYNC_RELEASE_WAIT_AFTER_SHORT_INT__ACCESS_LEVEL, 15, SYNC_RELEASE_WAIT_AFTER_SHORT_INT__MIN_VALUE, SYNC_RELEASE_WAIT_AFTER_SHORT_INT__MAX_VALUE, SYNC_RELEASE_WAIT_AFTER_SHORT_INT__FACTORY_SETTING, 26889UL },
+	{ 1, SYNC_RELEASE_LV_MV__ACCESS_LEVEL, 2, SYNC_RELEASE_LV_MV__MIN_VALUE, SYNC_RELEASE_LV_MV__MAX_VALUE, SYNC_RELEASE_LV_MV__FACTORY_SETTING, 26904UL },
+	{ 1, COS_PHI_CONTROL__ACCESS_LEVEL, 3, COS_PHI_CONTROL__MIN_VALUE, COS_PHI_CONTROL__MAX_VALUE, COS_PHI_CONTROL__FACTORY_SETTING, 26906UL },
+	{ 1, COS_PHI_CONTROL_MIN_C__ACCESS_LEVEL, 11, COS_PHI_CONTROL_MIN_C__MIN_VALUE, COS_PHI_CONTROL_MIN_C__MAX_VALUE, COS_PHI_CONTROL_MIN_C__FACTORY_SETTING, 26909UL },
+	{ 1, COS_PHI_CONTROL_MAX_I__ACCESS_LEVEL, 11, COS_PHI_CONTROL_MAX_I__MIN_VALUE, COS_PHI_CONTROL_MAX_I__MAX_VALUE, COS_PHI_CONTROL_MAX_I__FACTORY_SETTING, 26920UL },
+	{ 1, COS_PHI_CONTROL_MAX_DEVIATION__ACCESS_LEVEL, 19, COS_PHI_CONTROL_MAX_DEVIATION__MIN_VALUE, COS_PHI_CONTROL_MAX_DEVIATION__MAX_VALUE, COS_PHI_CONTROL_MAX_DEVIATION__FACTORY_SETTING, 26931UL },
+	{ 1, COS_PHI_CONTROL_U_REF__ACCESS_LEVEL, 17, COS_PHI_CONTROL_U_REF__MIN_VALUE, COS_PHI_CONTROL_U_REF__MAX_VALUE, COS_PHI_CONTROL_U_REF__FACTORY_SETTING, 26950UL },
+	{ 1, COS_PHI_CONTROL_POWER_MIN_C__ACCESS_LEVEL, 14, COS_PHI_CONTROL_POWER_MIN_C__MIN_VALUE, COS_PHI_CONTROL_POWER_MIN_C__MAX_VALUE, COS_PHI_CONTROL_POWER_MIN_C__FACTORY_SETTING, 26967UL },
+	{ 1, COS_PHI_CONTROL_POWER_MAX_I__ACCESS_LEVEL, 14, COS_PHI_CONTROL_POWER_MAX_I__MIN_VALUE, COS_PHI_CONTROL_POWER_MAX_I__MAX_VALUE, COS_PHI_CONTROL_POWER_MAX_I__FACTORY_SETTING, 26981UL },
+	{ 1, COS_PHI_CONTROL_RAMP_DURATION__ACCESS_LEVEL, 16, COS_PHI_CONTROL_RAMP_DURATION__MIN_VALUE, COS_PHI_CONTROL_RAMP_DURATION__MAX_VALUE, COS_PHI_CONTROL_RAMP_DURATION__FACTORY_SETTING, 26995UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 27011UL },	// COS_PHI_CONTROL_A_U_UN
+	{ 0, 0, 32, 0L, 0L, 0L, 27043UL },	// COS_PHI_CONTROL_A_Q_PN
+	{ 0, 0, 32, 0L, 0L, 0L, 27075UL },	// COS_PHI_CONTROL_B_U_UN
+	{ 0, 0, 32, 0L, 0L, 0L, 27107UL },	// COS_PHI_CONTROL_B_Q_PN
+	{ 0, 0, 32, 0L, 0L, 0L, 27139UL },	// COS_PHI_CONTROL_C_U_UN
+	{ 0, 0, 32, 0L, 0L, 0L, 27171UL },	// COS_PHI_CONTROL_C_Q_PN
+	{ 0, 0, 32, 0L, 0L, 0L, 27203UL },	// COS_PHI_CONTROL_D_U_UN
+	{ 0, 0, 32, 0L, 0L, 0L, 27235UL },	// COS_PHI_CONTROL_D_Q_PN
+	{ 1, LOAD_RED_DUE_TO_MAINS_F__ACCESS_LEVEL, 1, LOAD_RED_DUE_TO_MAINS_F__MIN_VALUE, LOAD_RED_DUE_TO_MAINS_F__MAX_VALUE, LOAD_RED_DUE_TO_MAINS_F__FACTORY_SETTING, 27267UL },
+	{ 1, LOAD_RED_DUE_TO_MAINS_F_WITH_HYSTERESIS__ACCESS_LEVEL, 1, LOAD_RED_DUE_TO_MAINS_F_WITH_HYSTERESIS__MIN_VALUE, LOAD_RED_DUE_TO_MAINS_F_WITH_HYSTERESIS__MAX_VALUE, LOAD_RED_DUE_TO_MAINS_F_WITH_HYSTERESIS__FACTORY_SETTING, 27268UL },
+	{ 1, LOAD_RED_DUE_TO_MAINS_F_RAMP__ACCESS_LEVEL, 12, LOAD_RED_DUE_TO_MAINS_F_RAMP__MIN_VALUE, LOAD_RED_DUE_TO_MAINS_F_RAMP__MAX_VALUE, LOAD_RED_DUE_TO_MAINS_F_RAMP__FACTORY_SETTING, 27269UL },
+	{ 1, LOAD_RED_DUE_TO_MAINS_F_START_VALUE__ACCESS_LEVEL, 16, LOAD_RED_DUE_TO_MAINS_F_START_VALUE__MIN_VALUE, LOAD_RED_DUE_TO_MAINS_F_START_VALUE__MAX_VALUE, LOAD_RED_DUE_TO_MAINS_F_START_VALUE__FACTORY_SETTING, 27281UL },
+	{ 1, LOAD_RED_DUE_TO_MAINS_F_ACTIVATION_FREQ__ACCESS_LEVEL, 16, LOAD_RED_DUE_TO_MAINS_F_ACTIVATION_FREQ__MIN_VALUE, LOAD_RED_DUE_TO_MAINS_F_ACTIVATION_FREQ__MAX_VALUE, LOAD_RED_DUE_TO_MAINS_F_ACTIVATION_FREQ__FACTORY_SETTING, 27297UL },
+	{ 1, LR_MAINS_U_OPTION__ACCESS_LEVEL, 1, LR_MAINS_U_OPTION__MIN_VALUE, LR_MAINS_U_OPTION__MAX_VALUE, LR_MAINS_U_OPTION__FACTORY_SETTING, 27313UL },
+	{ 1, LR_MAINS_U_FULL_LOAD__ACCESS_LEVEL, 12, LR_MAINS_U_FULL_LOAD__MIN_VALUE, LR_MAINS_U_FULL_LOAD__MAX_VALUE, LR_MAINS_U_FULL_LOAD__FACTORY_SETTING, 27314UL },
+	{ 1, LR_MAINS_U_NO_LOAD__ACCESS_LEVEL, 12, LR_MAINS_U_NO_LOAD__MIN_VALUE, LR_MAINS_U_NO_LOAD__MAX_VALUE, LR_MAINS_U_NO_LOAD__FACTORY_SETTING, 27326UL },
+	{ 1, ANALOG_OUTPUT_KW_AT_0MA__ACCESS_LEVEL, 21, ANALOG_OUTPUT_KW_AT_0MA__MIN_VALUE, ANALOG_OUTPUT_KW_AT_0MA__MAX_VALUE, ANALOG_OUTPUT_KW_AT_0MA__FACTORY_SETTING, 27338UL },
+	{ 1, ANALOG_OUTPUT_KW_FILTER__ACCESS_LEVEL, 1, ANALOG_OUTPUT_KW_FILTER__MIN_VALUE, ANALOG_OUTPUT_KW_FILTER__MAX_VALUE, ANALOG_OUTPUT_KW_FILTER__FACTORY_SETTING, 27359UL },
+	{ 1, ANALOG_OUTPUT_KVAR_AT_20MA__ACCESS_LEVEL, 23, ANALOG_OUTPUT_KVAR_AT_20MA__MIN_VALUE, ANALOG_OUTPUT_KVAR_AT_20MA__MAX_VALUE, ANALOG_OUTPUT_KVAR_AT_20MA__FACTORY_SETTING, 27360UL },
+	{ 1, ANALOG_OUTPUT_KVAR_AT_0MA__ACCESS_LEVEL, 22, ANALOG_OUTPUT_KVAR_AT_0MA__MIN_VALUE, ANALOG_OUTPUT_KVAR_AT_0MA__MAX_VALUE, ANALOG_OUTPUT_KVAR_AT_0MA__FACTORY_SETTING, 27383UL },
+	{ 1, ANALOG_OUTPUT_VOLTAGE_AT_20MA__ACCESS_LEVEL, 20, ANALOG_OUTPUT_VOLTAGE_AT_20MA__MIN_VALUE, ANALOG_OUTPUT_VOLTAGE_AT_20MA__MAX_VALUE, ANALOG_OUTPUT_VOLTAGE_AT_20MA__FACTORY_SETTING, 27405UL },
+	{ 1, ANALOG_OUTPUT_VOLTAGE_AT_4MA__ACCESS_LEVEL, 20, ANALOG_OUTPUT_VOLTAGE_AT_4MA__MIN_VALUE, ANALOG_OUTPUT_VOLTAGE_AT_4MA__MAX_VALUE, ANALOG_OUTPUT_VOLTAGE_AT_4MA__FACTORY_SETTING, 27425UL },
+	{ 1, NKK_VALVE_CONTROL_MODE__ACCESS_LEVEL, 32, NKK_VALVE_CONTROL_MODE__MIN_VALUE, NKK_VALVE_CONTROL_MODE__MAX_VALUE, NKK_VALVE_CONTROL_MODE__FACTORY_SETTING, 27445UL },
+	{ 1, HZM_OPTION__ACCESS_LEVEL, 1, HZM_OPTION__MIN_VALUE, HZM_OPTION__MAX_VALUE, HZM_OPTION__FACTORY_SETTING, 27477UL },
+	{ 1, HZM_CAMSHAFT_OFFSET__ACCESS_LEVEL, 13, HZM_CAMSHAFT_OFFSET__MIN_VALUE, HZM_CAMSHAFT_OFFSET__MAX_VALUE, HZM_CAMSHAFT_OFFSET__FACTORY_SETTING, 27478UL },
+	{ 1, HZM_IGNITION_ANGLE__ACCESS_LEVEL, 10, HZM_IGNITION_ANGLE__MIN_VALUE, HZM_IGNITION_ANGLE__MAX_VALUE, HZM_IGNITION_ANGLE__FACTORY_SETTING, 27491UL },
+	{ 1, HZM_IGNITION_ENERGY__ACCESS_LEVEL, 5, HZM_IGNITION_ENERGY__MIN_VALUE, HZM_IGNITION_ENERGY__MAX_VALUE, HZM_IGNITION_ENERGY__FACTORY_SETTING, 27501UL },
+	{ 1, MIX_FEEDBACK_AT_0_PERCENT__ACCESS_LEVEL, 13, MIX_FEEDBACK_AT_0_PERCENT__MIN_VALUE, MIX_FEEDBACK_AT_0_PERCENT__MAX_VALUE, MIX_FEEDBACK_AT_0_PERCENT__FACTORY_SETTING, 27506UL },
+	{ 1, MIX_FEEDBACK_AT_100_PERCENT__ACCESS_LEVEL, 14, MIX_FEEDBACK_AT_100_PERCENT__MIN_VALUE, MIX_FEEDBACK_AT_100_PERCENT__MAX_VALUE, MIX_FEEDBACK_AT_100_PERCENT__FACTORY_SETTING, 27519UL },
+	{ 1, MIX_RUNNING_TIME_0_TO_100_PERCENT__ACCESS_LEVEL, 17, MIX_RUNNING_TIME_0_TO_100_PERCENT__MIN_VALUE, MIX_RUNNING_TIME_0_TO_100_PERCENT__MAX_VALUE, MIX_RUNNING_TIME_0_TO_100_PERCENT__FACTORY_SETTING, 27533UL },
+	{ 1, MIX_ANALOG_CONTROL_SIGNAL__ACCESS_LEVEL, 1, MIX_ANALOG_CONTROL_SIGNAL__MIN_VALUE, MIX_ANALOG_CONTROL_SIGNAL__MAX_VALUE, MIX_ANALOG_CONTROL_SIGNAL__FACTORY_SETTING, 27550UL },
+	{ 1, MIX_AIR_MIN_POS__ACCESS_LEVEL, 15, MIX_AIR_MIN_POS__MIN_VALUE, MIX_AIR_MIN_POS__MAX_VALUE, MIX_AIR_MIN_POS__FACTORY_SETTING, 27551UL },
+	{ 1, MIX_AIR_MAX_POS__ACCESS_LEVEL, 15, MIX_AIR_MAX_POS__MIN_VALUE, MIX_AIR_MAX_POS__MAX_VALUE, MIX_AIR_MAX_POS__FACTORY_SETTING, 27566UL },
+	{ 1, MIX_AIR_LOAD_AT_MAX_POS__ACCESS_LEVEL, 14, MIX_AIR_LOAD_AT_MAX_POS__MIN_VALUE, MIX_AIR_LOAD_AT_MAX_POS__MAX_VALUE, MIX_AIR_LOAD_AT_MAX_POS__FACTORY_SETTING, 27581UL },
+	{ 1, HKS_WATER_FLOW_AT_20MA__ACCESS_LEVEL, 14, HKS_WATER_FLOW_AT_20MA__MIN_VALUE, HKS_WATER_FLOW_AT_20MA__MAX_VALUE, HKS_WATER_FLOW_AT_20MA__FACTORY_SETTING, 27595UL },
+	{ 1, HKS_CORRECTION_FACTOR_HEAT__ACCESS_LEVEL, 5, HKS_CORRECTION_FACTOR_HEAT__MIN_VALUE, HKS_CORRECTION_FACTOR_HEAT__MAX_VALUE, HKS_CORRECTION_FACTOR_HEAT__FACTORY_SETTING, 27609UL },
+	{ 1, HEAT_PRODUCTION_COUNTER__ACCESS_LEVEL, 31, HEAT_PRODUCTION_COUNTER__MIN_VALUE, HEAT_PRODUCTION_COUNTER__MAX_VALUE, HEAT_PRODUCTION_COUNTER__FACTORY_SETTING, 27614UL },
+	{ 1, HKS_HEAT_COUNTER_HOT_TEMP__ACCESS_LEVEL, 32, HKS_HEAT_COUNTER_HOT_TEMP__MIN_VALUE, HKS_HEAT_COUNTER_HOT_TEMP__MAX_VALUE, HKS_HEAT_COUNTER_HOT_TEMP__FACTORY_SETTING, 27645UL },
+	{ 1, HKS_HEAT_COUNTER_COLD_TEMP__ACCESS_LEVEL, 32, HKS_HEAT_COUNTER_COLD_TEMP__MIN_VALUE, HKS_HEAT_COUNTER_COLD_TEMP__MAX_VALUE, HKS_HEAT_COUNTER_COLD_TEMP__FACTORY_SETTING, 27677UL },
+	{ 1, WATER_P_AND_ID_VERSION__ACCESS_LEVEL, 2, WATER_P_AND_ID_VERSION__MIN_VALUE, WATER_P_AND_ID_VERSION__MAX_VALUE, WATER_P_AND_ID_VERSION__FACTORY_SETTING, 27709UL },
+	{ 1, PAR_GAS_FLOW_B__ACCESS_LEVEL, 17, PAR_GAS_FLOW_B__MIN_VALUE, PAR_GAS_FLOW_B__MAX_VALUE, PAR_GAS_FLOW_B__FACTORY_SETTING, 27711UL },
+	{ 1, EXH_BACK_PRESSURE_ALARM__ACCESS_LEVEL, 10, EXH_BACK_PRESSURE_ALARM__MIN_VALUE, EXH_BACK_PRESSURE_ALARM__MAX_VALUE, EXH_BACK_PRESSURE_ALARM__FACTORY_SETTING, 27728UL },
+	{ 1, EXH_BACK_PRESSURE_STOP__ACCESS_LEVEL, 10, EXH_BACK_PRESSURE_STOP__MIN_VALUE, EXH_BACK_PRESSURE_STOP__MAX_VALUE, EXH_BACK_PRESSURE_STOP__FACTORY_SETTING, 27738UL },
+	{ 1, NKK_WATER_PRES_VALUE_FOR_20mA__ACCESS_LEVEL, 10, NKK_WATER_PRES_VALUE_FOR_20mA__MIN_VALUE, NKK_WATER_PRES_VALUE_FOR_20mA__MAX_VALUE, NKK_WATER_PRES_VALUE_FOR_20mA__FACTORY_SETTING, 27748UL },
+	{ 1, NKK_WATER_PRES_MIN_WARNING__ACCESS_LEVEL, 9, NKK_WATER_PRES_MIN_WARNING__MIN_VALUE, NKK_WATER_PRES_MIN_WARNING__MAX_VALUE, NKK_WATER_PRES_MIN_WARNING__FACTORY_SETTING, 27758UL },
+	{ 1, NKK_WATER_PRES_MAX_WARNING__ACCESS_LEVEL, 10, NKK_WATER_PRES_MAX_WARNING__MIN_VALUE, NKK_WATER_PRES_MAX_WARNING__MAX_VALUE, NKK_WATER_PRES_MAX_WARNING__FACTORY_SETTING, 27767UL },
+	{ 1, NKK_WATER_PRES_MIN_FAULT__ACCESS_LEVEL, 9, NKK_WATER_PRES_MIN_FAULT__MIN_VALUE, NKK_WATER_PRES_MIN_FAULT__MAX_VALUE, NKK_WATER_PRES_MIN_FAULT__FACTORY_SETTING, 27777UL },
+	{ 1, NKK_WATER_PRES_MAX_FAULT__ACCESS_LEVEL, 10, NKK_WATER_PRES_MAX_FAULT__MIN_VALUE, NKK_WATER_PRES_MAX_FAULT__MAX_VALUE, NKK_WATER_PRES_MAX_FAULT__FACTORY_SETTING, 27786UL },
+	{ 1, HZM_SETP_SPARK_DURATION__ACCESS_LEVEL, 9, HZM_SETP_SPARK_DURATION__MIN_VALUE, HZM_SETP_SPARK_DURATION__MAX_VALUE, HZM_SETP_SPARK_DURATION__FACTORY_SETTING, 27796UL },
+	{ 1, HZM_MAX_IGN_ENERGY__ACCESS_LEVEL, 5, HZM_MAX_IGN_ENERGY__MIN_VALUE, HZM_MAX_IGN_ENERGY__MAX_VALUE, HZM_MAX_IGN_ENERGY__FACTORY_SETTING, 27805UL },
+	{ 1, HZM_REG_MIN_IGN_ENERGY__ACCESS_LEVEL, 5, HZM_REG_MIN_IGN_ENERGY__MIN_VALUE, HZM_REG_MIN_IGN_ENERGY__MAX_VALUE, HZM_REG_MIN_IGN_ENERGY__FACTORY_SETTING, 27810UL },
+	{ 1, HZM_REG_MAX_IGN_ENERGY__ACCESS_LEVEL, 5, HZM_REG_MAX_IGN_ENERGY__MIN_VALUE, HZM_REG_MAX_IGN_ENERGY__MAX_VALUE, HZM_REG_MAX_IGN_ENERGY__FACTORY_SETTING, 27815UL },
+	{ 1, PLS_PRE_LUBE_RUN_TIME__ACCESS_LEVEL, 19, PLS_PRE_LUBE_RUN_TIME__MIN_VALUE, PLS_PRE_LUBE_RUN_TIME__MAX_VALUE, PLS_PRE_LUBE_RUN_TIME__FACTORY_SETTING, 27820UL },
+	{ 1, PLS_INTERVALL_RUN_TIME__ACCESS_LEVEL, 22, PLS_INTERVALL_RUN_TIME__MIN_VALUE, PLS_INTERVALL_RUN_TIME__MAX_VALUE, PLS_INTERVALL_RUN_TIME__FACTORY_SETTING, 27839UL },
+	{ 1, PLS_POST_RUN_TIME__ACCESS_LEVEL, 22, PLS_POST_RUN_TIME__MIN_VALUE, PLS_POST_RUN_TIME__MAX_VALUE, PLS_POST_RUN_TIME__FACTORY_SETTING, 27861UL },
+	{ 1, PLS_INTERVALL_PERIOD_TIME__ACCESS_LEVEL, 26, PLS_INTERVALL_PERIOD_TIME__MIN_VALUE, PLS_INTERVALL_PERIOD_TIME__MAX_VALUE, PLS_INTERVALL_PERIOD_TIME__FACTORY_SETTING, 27883UL },
+	{ 1, PLS_PRE_LUBE_PRESURE__ACCESS_LEVEL, 8, PLS_PRE_LUBE_PRESURE__MIN_VALUE, PLS_PRE_LUBE_PRESURE__MAX_VALUE, PLS_PRE_LUBE_PRESURE__FACTORY_SETTING, 27909UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 27917UL },	// IO_TEMP_CONFIG_MODUL3
+	{ 0, 0, 32, 0L, 0L, 0L, 27949UL },	// IO_TEMP_CONFIG_MODUL4
+	{ 0, 0, 32, 0L, 0L, 0L, 27981UL },	// IO_TEMP_CONFIG_MODUL5
+	{ 0, 0, 32, 0L, 0L, 0L, 28013UL },	// IO_TEMP_CONFIG_MODUL6
+	{ 0, 0, 32, 0L, 0L, 0L, 28045UL },	// IO_TEMP_CONFIG_MODUL7
+	{ 0, 0, 32, 0L, 0L, 0L, 28077UL },	// IO_TEMP_CONFIG_MODUL8
+	{ 0, 0, 32, 0L, 0L, 0L, 28109UL },	// IO_TEMP_CONFIG_MODUL9
+	{ 0, 0, 32, 0L, 0L, 0L, 28141UL },	// IO_TEMP_CONFIG_MODUL10
+	{ 0, 0, 32, 0L, 0L, 0L, 28173UL },	// IO_TEMP_CONFIG_MODUL11
+	{ 0, 0, 32, 0L, 0L, 0L, 28205UL },	// IO_TEMP_CONFIG_MODUL12
+	{ 0, 0, 32, 0L, 0L, 0L, 28237UL },	// IO_TEMP_CONFIG_MODUL13
+	{ 0, 0, 32, 0L, 0L, 0L, 28269UL },	// IO_TEMP_CONFIG_MODUL14
+	{ 0, 0, 32, 0L, 0L, 0L, 28301UL },	// IO_AI_CONFIG_MODUL3
+	{ 0, 0, 32, 0L, 0L, 0L, 28333UL },	// IO_AI_CONFIG_MODUL4
+	{ 0, 0, 32, 0L, 0L, 0L, 28365UL },	// IO_AI_CONFIG_MODUL5
+	{ 0, 0, 32, 0L, 0L, 0L, 28397UL },	// IO_AI_CONFIG_MODUL6
+	{ 0, 0, 32, 0L, 0L, 0L, 28429UL },	// IO_AI_CONFIG_MODUL7
+	{ 0, 0, 32, 0L, 0L, 0L, 28461UL },	// IO_AI_CONFIG_MODUL8
+	{ 0, 0, 32, 0L, 0L, 0L, 28493UL },	// IO_AI_CONFIG_MODUL9
+	{ 0, 0, 32, 0L, 0L, 0L, 28525UL },	// IO_AI_CONFIG_MODUL10
+	{ 0, 0, 32, 0L, 0L, 0L, 28557UL },	// IO_AI_CONFIG_MODUL11
+	{ 0, 0, 32, 0L, 0L, 0L, 28589UL },	// IO_AI_CONFIG_MODUL12
+	{ 0, 0, 32, 0L, 0L, 0L, 28621UL },	// IO_AI_CONFIG_MODUL13
+	{ 0, 0, 32, 0L, 0L, 0L, 28653UL },	// IO_AI_CONFIG_MODUL14
+	{ 0, 0, 32, 0L, 0L, 0L, 28685UL },	// IO_DIGITAL_CONFIG_MODUL3
+	{ 0, 0, 32, 0L, 0L, 0L, 28717UL },	// IO_DIGITAL_CONFIG_MODUL4
+	{ 0, 0, 32, 0L, 0L, 0L, 28749UL },	// IO_DIGITAL_CONFIG_MODUL5
+	{ 0, 0, 32, 0L, 0L, 0L, 28781UL },	// IO_DIGITAL_CONFIG_MODUL6
+	{ 0, 0, 32, 0L, 0L, 0L, 28813UL },	// IO_DIGITAL_CONFIG_MODUL7
+	{ 0, 0, 32, 0L, 0L, 0L, 28845UL },	// IO_DIGITAL_CONFIG_MODUL8
+	{ 0, 0, 32, 0L, 0L, 0L, 28877UL },	// IO_DIGITAL_CONFIG_MODUL9
+	{ 0, 0, 32, 0L, 0L, 0L, 28909UL },	// IO_DIGITAL_CONFIG_MODUL10
+	{ 0, 0, 32, 0L, 0L, 0L, 28941UL },	// IO_DIGITAL_CONFIG_MODUL11
+	{ 0, 0, 32, 0L, 0L, 0L, 28973UL },	// IO_DIGITAL_CONFIG_MODUL12
+	{ 0, 0, 32, 0L, 0L, 0L, 29005UL },	// IO_DIGITAL_CONFIG_MODUL13
+	{ 0, 0, 32, 0L, 0L, 0L, 29037UL },	// IO_DIGITAL_CONFIG_MODUL14
+	{ 1, GEN_SYNC_DELTA_U_OK__ACCESS_LEVEL, 15, GEN_SYNC_DELTA_U_OK__MIN_VALUE, GEN_SYNC_DELTA_U_OK__MAX_VALUE, GEN_SYNC_DELTA_U_OK__FACTORY_SETTING, 29069UL },
+	{ 1, GEN_SYNC_DELTA_U_NOT_OK__ACCESS_LEVEL, 15, GEN_SYNC_DELTA_U_NOT_OK__MIN_VALUE, GEN_SYNC_DELTA_U_NOT_OK__MAX_VALUE, GEN_SYNC_DELTA_U_NOT_OK__FACTORY_SETTING, 29084UL },
+	{ 1, ENG_AUTO_START_STOP_OPTION__ACCESS_LEVEL, 1, ENG_AUTO_START_STOP_OPTION__MIN_VALUE, ENG_AUTO_START_STOP_OPTION__MAX_VALUE, ENG_AUTO_START_STOP_OPTION__FACTORY_SETTING, 29099UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 29100UL },	// ENG_AUTO_START_STOP_OPTION_MO
+	{ 0, 0, 32, 0L, 0L, 0L, 29132UL },	// ENG_AUTO_START_STOP_OPTION_TU
+	{ 0, 0, 32, 0L, 0L, 0L, 29164UL },	// ENG_AUTO_START_STOP_OPTION_WE
+	{ 0, 0, 32, 0L, 0L, 0L, 29196UL },	// ENG_AUTO_START_STOP_OPTION_TH
+	{ 0, 0, 32, 0L, 0L, 0L, 29228UL },	// ENG_AUTO_START_STOP_OPTION_FR
+	{ 0, 0, 32, 0L, 0L, 0L, 29260UL },	// ENG_AUTO_START_STOP_OPTION_SA
+	{ 0, 0, 32, 0L, 0L, 0L, 29292UL },	// ENG_AUTO_START_STOP_OPTION_SU
+	{ 1, ENG_AUTO_START_HOUR__ACCESS_LEVEL, 5, ENG_AUTO_START_HOUR__MIN_VALUE, ENG_AUTO_START_HOUR__MAX_VALUE, ENG_AUTO_START_HOUR__FACTORY_SETTING, 29324UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 29329UL },	// ENG_AUTO_START_HOUR_MO
+	{ 0, 0, 32, 0L, 0L, 0L, 29361UL },	// ENG_AUTO_START_HOUR_TU
+	{ 0, 0, 32, 0L, 0L, 0L, 29393UL },	// ENG_AUTO_START_HOUR_WE
+	{ 0, 0, 32, 0L, 0L, 0L, 29425UL },	// ENG_AUTO_START_HOUR_TH
+	{ 0, 0, 32, 0L, 0L, 0L, 29457UL },	// ENG_AUTO_START_HOUR_FR
+	{ 0, 0, 32, 0L, 0L, 0L, 29489UL },	// ENG_AUTO_START_HOUR_SA
+	{ 0, 0, 32, 0L, 0L, 0L, 29521UL },	// ENG_AUTO_START_HOUR_SU
+	{ 1, ENG_AUTO_START_MIN__ACCESS_LEVEL, 6, ENG_AUTO_START_MIN__MIN_VALUE, ENG_AUTO_START_MIN__MAX_VALUE, ENG_AUTO_START_MIN__FACTORY_SETTING, 29553UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 29559UL },	// ENG_AUTO_START_MIN_MO
+	{ 0, 0, 32, 0L, 0L, 0L, 29591UL },	// ENG_AUTO_START_MIN_TU
+	{ 0, 0, 32, 0L, 0L, 0L, 29623UL },	// ENG_AUTO_START_MIN_WE
+	{ 0, 0, 32, 0L, 0L, 0L, 29655UL },	// ENG_AUTO_START_MIN_TH
+	{ 0, 0, 32, 0L, 0L, 0L, 29687UL },	// ENG_AUTO_START_MIN_FR
+	{ 0, 0, 32, 0L, 0L, 0L, 29719UL },	// ENG_AUTO_START_MIN_SA
+	{ 0, 0, 32, 0L, 0L, 0L, 29751UL },	// ENG_AUTO_START_MIN_SU
+	{ 1, ENG_AUTO_STOP_HOUR__ACCESS_LEVEL, 5, ENG_AUTO_STOP_HOUR__MIN_VALUE, ENG_AUTO_STOP_HOUR__MAX_VALUE, ENG_AUTO_STOP_HOUR__FACTORY_SETTING, 29783UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 29788UL },	// ENG_AUTO_STOP_HOUR_MO
+	{ 0, 0, 32, 0L, 0L, 0L, 29820UL },	// ENG_AUTO_STOP_HOUR_TU
+	{ 0, 0, 32, 0L, 0L, 0L, 29852UL },	// ENG_AUTO_STOP_HOUR_WE
+	{ 0, 0, 32, 0L, 0L, 0L, 29884UL },	// ENG_AUTO_STOP_HOUR_TH
+	{ 0, 0, 32, 0L, 0L, 0L, 29916UL },	// ENG_AUTO_STOP_HOUR_FR
+	{ 0, 0, 32, 0L, 0L, 0L, 29948UL },	// ENG_AUTO_STOP_HOUR_SA
+	{ 0, 0, 32, 0L, 0L, 0L, 29980UL },	// ENG_AUTO_STOP_HOUR_SU
+	{ 1, ENG_AUTO_STOP_MIN__ACCESS_LEVEL, 6, ENG_AUTO_STOP_MIN__MIN_VALUE, ENG_AUTO_STOP_MIN__MAX_VALUE, ENG_AUTO_STOP_MIN__FACTORY_SETTING, 30012UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 30018UL },	// ENG_AUTO_STOP_MIN_MO
+	{ 0, 0, 32, 0L, 0L, 0L, 30050UL },	// ENG_AUTO_STOP_MIN_TU
+	{ 0, 0, 32, 0L, 0L, 0L, 30082UL },	// ENG_AUTO_STOP_MIN_WE
+	{ 0, 0, 32, 0L, 0L, 0L, 30114UL },	// ENG_AUTO_STOP_MIN_TH
+	{ 0, 0, 32, 0L, 0L, 0L, 30146UL },	// ENG_AUTO_STOP_MIN_FR
+	{ 0, 0, 32, 0L, 0L, 0L, 30178UL },	// ENG_AUTO_STOP_MIN_SA
+	{ 0, 0, 32, 0L, 0L, 0L, 30210UL },	// ENG_AUTO_STOP_MIN_SU
+	{ 1, UVS_FREEZE_REGULATOR__ACCESS_LEVEL, 1, UVS_FREEZE_REGULATOR__MIN_VALUE, UVS_FREEZE_REGULATOR__MAX_VALUE, UVS_FREEZE_REGULATOR__FACTORY_SETTING, 30242UL },
+	{ 1, EXT_FLUSHING_TIME__ACCESS_LEVEL, 14, EXT_FLUSHING_TIME__MIN_VALUE, EXT_FLUSHING_TIME__MAX_VALUE, EXT_FLUSHING_TIME__FACTORY_SETTING, 30243UL },
+	{ 1, ELM_CORRECTION_P__ACCESS_LEVEL, 11, ELM_CORRECTION_P__MIN_VALUE, ELM_CORRECTION_P__MAX_VALUE, ELM_CORRECTION_P__FACTORY_SETTING, 30257UL },
+	{ 1, ELM_CORRECTION_U__ACCESS_LEVEL, 11, ELM_CORRECTION_U__MIN_VALUE, ELM_CORRECTION_U__MAX_VALUE, ELM_CORRECTION_U__FACTORY_SETTING, 30268UL },
+	{ 1, ELM_CORRECTION_I__ACCESS_LEVEL, 11, ELM_CORRECTION_I__MIN_VALUE, ELM_CORRECTION_I__MAX_VALUE, ELM_CORRECTION_I__FACTORY_SETTING, 30279UL },
+	{ 1, ELM_CORRECTION_Q_IND__ACCESS_LEVEL, 11, ELM_CORRECTION_Q_IND__MIN_VALUE, ELM_CORRECTION_Q_IND__MAX_VALUE, ELM_CORRECTION_Q_IND__FACTORY_SETTING, 30290UL },
+	{ 1, ELM_CORRECTION_Q_CAP__ACCESS_LEVEL, 11, ELM_CORRECTION_Q_CAP__MIN_VALUE, ELM_CORRECTION_Q_CAP__MAX_VALUE, ELM_CORRECTION_Q_CAP__FACTORY_SETTING, 30301UL },
+	{ 1, ELM_CORRECTION_Q_OFFSET__ACCESS_LEVEL, 11, ELM_CORRECTION_Q_OFFSET__MIN_VALUE, ELM_CORRECTION_Q_OFFSET__MAX_VALUE, ELM_CORRECTION_Q_OFFSET__FACTORY_SETTING, 30312UL },
+	{ 1, MIX_IDLE_POS_IN_ACCELERATION__ACCESS_LEVEL, 2, MIX_IDLE_POS_IN_ACCELERATION__MIN_VALUE, MIX_IDLE_POS_IN_ACCELERATION__MAX_VALUE, MIX_IDLE_POS_IN_ACCELERATION__FACTORY_SETTING, 30323UL },
+	{ 1, GAS_TYPE_A_TEXT__ACCESS_LEVEL, 3, GAS_TYPE_A_TEXT__MIN_VALUE, GAS_TYPE_A_TEXT__MAX_VALUE, GAS_TYPE_A_TEXT__FACTORY_SETTING, 30325UL },
+	{ 1, GAS_TYPE_B_TEXT__ACCESS_LEVEL, 3, GAS_TYPE_B_TEXT__MIN_VALUE, GAS_TYPE_B_TEXT__MAX_VALUE, GAS_TYPE_B_TEXT__FACTORY_SETTING, 30328UL },
+	{ 1, GBV_PAR_FLOW_GASB_100__ACCESS_LEVEL, 13, GBV_PAR_FLOW_GASB_100__MIN_VALUE, GBV_PAR_FLOW_GASB_100__MAX_VALUE, GBV_PAR_FLOW_GASB_100__FACTORY_SETTING, 30331UL },
+	{ 1, GBV_PAR_FLOW_GASB_50__ACCESS_LEVEL, 13, GBV_PAR_FLOW_GASB_50__MIN_VALUE, GBV_PAR_FLOW_GASB_50__MAX_VALUE, GBV_PAR_FLOW_GASB_50__FACTORY_SETTING, 30344UL },
+	{ 1, TLB_CONTROL_RELEASE_LOAD__ACCESS_LEVEL, 14, TLB_CONTROL_RELEASE_LOAD__MIN_VALUE, TLB_CONTROL_RELEASE_LOAD__MAX_VALUE, TLB_CONTROL_RELEASE_LOAD__FACTORY_SETTING, 30357UL },
+	{ 1, TLB_CONTROL_KP__ACCESS_LEVEL, 14, TLB_CONTROL_KP__MIN_VALUE, TLB_CONTROL_KP__MAX_VALUE, TLB_CONTROL_KP__FACTORY_SETTING, 30371UL },
+	{ 1, TLB_CONTROL_KP1__ACCESS_LEVEL, 15, TLB_CONTROL_KP1__MIN_VALUE, TLB_CONTROL_KP1__MAX_VALUE, TLB_CONTROL_KP1__FACTORY_SETTING, 30385UL },
+	{ 1, TLB_CONTROL_KP2__ACCESS_LEVEL, 15, TLB_CONTROL_KP2__MIN_VALUE, TLB_CONTROL_KP2__MAX_VALUE, TLB_CONTROL_KP2__FACTORY_SETTING, 30400UL },
+	{ 1, TLB_CONTROL_KP3__ACCESS_LEVEL, 15, TLB_CONTROL_KP3__MIN_VALUE, TLB_CONTROL_KP3__MAX_VALUE, TLB_CONTROL_KP3__FACTORY_SETTING, 30415UL },
+	{ 1, TLB_CONTROL_KI__ACCESS_LEVEL, 14, TLB_CONTROL_KI__MIN_VALUE, TLB_CONTROL_KI__MAX_VALUE, TLB_CONTROL_KI__FACTORY_SETTING, 30430UL },
+	{ 1, TLB_CONTROL_KI1__ACCESS_LEVEL, 15, TLB_CONTROL_KI1__MIN_VALUE, TLB_CONTROL_KI1__MAX_VALUE, TLB_CONTROL_KI1__FACTORY_SETTING, 30444UL },
+	{ 1, TLB_CONTROL_KI2__ACCESS_LEVEL, 15, TLB_CONTROL_KI2__MIN_VALUE, TLB_CONTROL_KI2__MAX_VALUE, TLB_CONTROL_KI2__FACTORY_SETTING, 30459UL },
+	{ 1, TLB_CONTROL_KI3__ACCESS_LEVEL, 15, TLB_CONTROL_KI3__MIN_VALUE, TLB_CONTROL_KI3__MAX_VALUE, TLB_CONTROL_KI3__FACTORY_SETTING, 30474UL },
+	{ 1, TLB_CONTROL_KD__ACCESS_LEVEL, 14, TLB_CONTROL_KD__MIN_VALUE, TLB_CONTROL_KD__MAX_VALUE, TLB_CONTROL_KD__FACTORY_SETTING, 30489UL },
+	{ 1, TLB_CONTROL_KD1__ACCESS_LEVEL, 15, TLB_CONTROL_KD1__MIN_VALUE, TLB_CONTROL_KD1__MAX_VALUE, TLB_CONTROL_KD1__FACTORY_SETTING, 30503UL },
+	{ 1, TLB_CONTROL_KD2__ACCESS_LEVEL, 15, TLB_CONTROL_KD2__MIN_VALUE, TLB_CONTROL_KD2__MAX_VALUE, TLB_CONTROL_KD2__FACTORY_SETTING, 30518UL },
+	{ 1, TLB_CONTROL_KD3__ACCESS_LEVEL, 15, TLB_CONTROL_KD3__MIN_VALUE, TLB_CONTROL_KD3__MAX_VALUE, TLB_CONTROL_KD3__FACTORY_SETTING, 30533UL },
+	{ 1, TLB_CONTROL_GAIN_LOW__ACCESS_LEVEL, 7, TLB_CONTROL_GAIN_LOW__MIN_VALUE, TLB_CONTROL_GAIN_LOW__MAX_VALUE, TLB_CONTROL_GAIN_LOW__FACTORY_SETTING, 30548UL },
+	{ 1, TLB_CONTROL_GAIN_HIGH__ACCESS_LEVEL, 9, TLB_CONTROL_GAIN_HIGH__MIN_VALUE, TLB_CONTROL_GAIN_HIGH__MAX_VALUE, TLB_CONTROL_GAIN_HIGH__FACTORY_SETTING, 30555UL },
+	{ 1, TLB_BYPASS_POS_0_VOLTAGE__ACCESS_LEVEL, 8, TLB_BYPASS_POS_0_VOLTAGE__MIN_VALUE, TLB_BYPASS_POS_0_VOLTAGE__MAX_VALUE, TLB_BYPASS_POS_0_VOLTAGE__FACTORY_SETTING, 30564UL },
+	{ 1, TLB_BYPASS_POS_100_VOLTAGE__ACCESS_LEVEL, 10, TLB_BYPASS_POS_100_VOLTAGE__MIN_VALUE, TLB_BYPASS_POS_100_VOLTAGE__MAX_VALUE, TLB_BYPASS_POS_100_VOLTAGE__FACTORY_SETTING, 30572UL },
+	{ 1, TLB_BYPASS_2_POS_0_VOLTAGE__ACCESS_LEVEL, 8, TLB_BYPASS_2_POS_0_VOLTAGE__MIN_VALUE, TLB_BYPASS_2_POS_0_VOLTAGE__MAX_VALUE, TLB_BYPASS_2_POS_0_VOLTAGE__FACTORY_SETTING, 30582UL },
+	{ 1, TLB_BYPASS_2_POS_100_VOLTAGE__ACCESS_LEVEL, 10, TLB_BYPASS_2_POS_100_VOLTAGE__MIN_VALUE, TLB_BYPASS_2_POS_100_VOLTAGE__MAX_VALUE, TLB_BYPASS_2_POS_100_VOLTAGE__FACTORY_SETTING, 30590UL },
+	{ 1, TLB_ACTIVATE_REGULATION_AT_DK_POS__ACCESS_LEVEL, 10, TLB_ACTIVATE_REGULATION_AT_DK_POS__MIN_VALUE, TLB_ACTIVATE_REGULATION_AT_DK_POS__MAX_VALUE, TLB_ACTIVATE_REGULATION_AT_DK_POS__FACTORY_SETTING, 30600UL },
+	{ 1, TLB_DEACTIVATE_REGULATION_AT_TLB_POS__ACCESS_LEVEL, 10, TLB_DEACTIVATE_REGULATION_AT_TLB_POS__MIN_VALUE, TLB_DEACTIVATE_REGULATION_AT_TLB_POS__MAX_VALUE, TLB_DEACTIVATE_REGULATION_AT_TLB_POS__FACTORY_SETTING, 30610UL },
+	{ 1, TLB_OFFSET_POSITION__ACCESS_LEVEL, 10, TLB_OFFSET_POSITION__MIN_VALUE, TLB_OFFSET_POSITION__MAX_VALUE, TLB_OFFSET_POSITION__FACTORY_SETTING, 30620UL },
+	{ 1, TLB_SPEED_CTRL_KP__ACCESS_LEVEL, 14, TLB_SPEED_CTRL_KP__MIN_VALUE, TLB_SPEED_CTRL_KP__MAX_VALUE, TLB_SPEED_CTRL_KP__FACTORY_SETTING, 30630UL },
+	{ 1, TLB_SPEED_CTRL_KP1__ACCESS_LEVEL, 15, TLB_SPEED_CTRL_KP1__MIN_VALUE, TLB_SPEED_CTRL_KP1__MAX_VALUE, TLB_SPEED_CTRL_KP1__FACTORY_SETTING, 30644UL },
+	{ 1, TLB_SPEED_CTRL_KP2__ACCESS_LEVEL, 15, TLB_SPEED_CTRL_KP2__MIN_VALUE, TLB_SPEED_CTRL_KP2__MAX_VALUE, TLB_SPEED_CTRL_KP2__FACTORY_SETTING, 30659UL },
+	{ 1, TLB_SPEED_CTRL_KP3__ACCESS_LEVEL, 15, TLB_SPEED_CTRL_KP3__MIN_VALUE, TLB_SPEED_CTRL_KP3__MAX_VALUE, TLB_SPEED_CTRL_KP3__FACTORY_SETTING, 30674UL },
+	{ 1, TLB_SPEED_CTRL_KI__ACCESS_LEVEL, 14, TLB_SPEED_CTRL_KI__MIN_VALUE, TLB_SPEED_CTRL_KI__MAX_VALUE, TLB_SPEED_CTRL_KI__FACTORY_SETTING, 30689UL },
+	{ 1, TLB_SPEED_CTRL_KI1__ACCESS_LEVEL, 15, TLB_SPEED_CTRL_KI1__MIN_VALUE, TLB_SPEED_CTRL_KI1__MAX_VALUE, TLB_SPEED_CTRL_KI1__FACTORY_SETTING, 30703UL },
+	{ 1, TLB_SPEED_CTRL_KI2__ACCESS_LEVEL, 15, TLB_SPEED_CTRL_KI2__MIN_VALUE, TLB_SPEED_CTRL_KI2__MAX_VALUE, TLB_SPEED_CTRL_KI2__FACTORY_SETTING, 30718UL },
+	{ 1, TLB_SPEED_CTRL_KI3__ACCESS_LEVEL, 15, TLB_SPEED_CTRL_KI3__MIN_VALUE, TLB_SPEED_CTRL_KI3__MAX_VALUE, TLB_SPEED_CTRL_KI3__FACTORY_SETTING, 30733UL },
+	{ 1, TLB_SPEED_CTRL_KD__ACCESS_LEVEL, 14, TLB_SPEED_CTRL_KD__MIN_VALUE, TLB_SPEED_CTRL_KD__MAX_VALUE, TLB_SPEED_CTRL_KD__FACTORY_SETTING, 30748UL },
+	{ 1, TLB_SPEED_CTRL_KD1__ACCESS_LEVEL, 15, TLB_SPEED_CTRL_KD1__MIN_VALUE, TLB_SPEED_CTRL_KD1__MAX_VALUE, TLB_SPEED_CTRL_KD1__FACTORY_SETTING, 30762UL },
+	{ 1, TLB_SPEED_CTRL_KD2__ACCESS_LEVEL, 15, TLB_SPEED_CTRL_KD2__MIN_VALUE, TLB_SPEED_CTRL_KD2__MAX_VALUE, TLB_SPEED_CTRL_KD2__FACTORY_SETTING, 30777UL },
+	{ 1, TLB_SPEED_CTRL_KD3__ACCESS_LEVEL, 15, TLB_SPEED_CTRL_KD3__MIN_VALUE, TLB_SPEED_CTRL_KD3__MAX_VALUE, TLB_SPEED_CTRL_KD3__FACTORY_SETTING, 30792UL },
+	{ 1, TLB_THROTTLE_SETPOINT_AT_0kW__ACCESS_LEVEL, 9, TLB_THROTTLE_SETPOINT_AT_0kW__MIN_VALUE, TLB_THROTTLE_SETPOINT_AT_0kW__MAX_VALUE, TLB_THROTTLE_SETPOINT_AT_0kW__FACTORY_SETTING, 30807UL },
+	{ 1, TLB_THROTTLE_SETPOINT_AT_HALF_LOAD__ACCESS_LEVEL, 10, TLB_THROTTLE_SETPOINT_AT_HALF_LOAD__MIN_VALUE, TLB_THROTTLE_SETPOINT_AT_HALF_LOAD__MAX_VALUE, TLB_THROTTLE_SETPOINT_AT_HALF_LOAD__FACTORY_SETTING, 30816UL },
+	{ 1, TLB_THROTTLE_SETPOINT_AT_FULL_LOAD__ACCESS_LEVEL, 10, TLB_THROTTLE_SETPOINT_AT_FULL_LOAD__MIN_VALUE, TLB_THROTTLE_SETPOINT_AT_FULL_LOAD__MAX_VALUE, TLB_THROTTLE_SETPOINT_AT_FULL_LOAD__FACTORY_SETTING, 30826UL },
+	{ 1, IGN_RETARD_OFFSET__ACCESS_LEVEL, 14, IGN_RETARD_OFFSET__MIN_VALUE, IGN_RETARD_OFFSET__MAX_VALUE, IGN_RETARD_OFFSET__FACTORY_SETTING, 30836UL },
+	{ 1, TEC_OPTION__ACCESS_LEVEL, 2, TEC_OPTION__MIN_VALUE, TEC_OPTION__MAX_VALUE, TEC_OPTION__FACTORY_SETTING, 30850UL },
+	{ 1, TEC_SPEC_GRAVITY__ACCESS_LEVEL, 15, TEC_SPEC_GRAVITY__MIN_VALUE, TEC_SPEC_GRAVITY__MAX_VALUE, TEC_SPEC_GRAVITY__FACTORY_SETTING, 30852UL },
+	{ 1, TEC_RATIO_SPEC_HEATS__ACCESS_LEVEL, 14, TEC_RATIO_SPEC_HEATS__MIN_VALUE, TEC_RATIO_SPEC_HEATS__MAX_VALUE, TEC_RATIO_SPEC_HEATS__FACTORY_SETTING, 30867UL },
+	{ 1, TEC_LAMBDA_SETPOINT_0kW__ACCESS_LEVEL, 8, TEC_LAMBDA_SETPOINT_0kW__MIN_VALUE, TEC_LAMBDA_SETPOINT_0kW__MAX_VALUE, TEC_LAMBDA_SETPOINT_0kW__FACTORY_SETTING, 30881UL },
+	{ 1, TEC_LAMBDA_SETPOINT_FULL_LOAD__ACCESS_LEVEL, 8, TEC_LAMBDA_SETPOINT_FULL_LOAD__MIN_VALUE, TEC_LAMBDA_SETPOINT_FULL_LOAD__MAX_VALUE, TEC_LAMBDA_SETPOINT_FULL_LOAD__FACTORY_SETTING, 30889UL },
+	{ 1, CANLINE_PMS__ACCESS_LEVEL, 32, CANLINE_PMS__MIN_VALUE, CANLINE_PMS__MAX_VALUE, CANLINE_PMS__FACTORY_SETTING, 30897UL },
+	{ 1, CANLINE_AKR__ACCESS_LEVEL, 2, CANLINE_AKR__MIN_VALUE, CANLINE_AKR__MAX_VALUE, CANLINE_AKR__FACTORY_SETTING, 30929UL },
+	{ 1, CANLINE_HZM__ACCESS_LEVEL, 32, CANLINE_HZM__MIN_VALUE, CANLINE_HZM__MAX_VALUE, CANLINE_HZM__FACTORY_SETTING, 30931UL },
+	{ 1, CANLINE_CANOPEN__ACCESS_LEVEL, 32, CANLINE_CANOPEN__MIN_VALUE, CANLINE_CANOPEN__MAX_VALUE, CANLINE_CANOPEN__FACTORY_SETTING, 30963UL },
+	{ 1, CANLINE_AXIO__ACCESS_LEVEL, 32, CANLINE_AXIO__MIN_VALUE, CANLINE_AXIO__MAX_VALUE, CANLINE_AXIO__FACTORY_SETTING, 30995UL },
+	{ 1, CANLINE_J1939__ACCESS_LEVEL, 2, CANLINE_J1939__MIN_VALUE, CANLINE_J1939__MAX_VALUE, CANLINE_J1939__FACTORY_SETTING, 31027UL },
+	{ 1, CNT_SET_VALUE__ACCESS_LEVEL, 31, CNT_SET_VALUE__MIN_VALUE, CNT_SET_VALUE__MAX_VALUE, CNT_SET_VALUE__FACTORY_SETTING, 31029UL },
+	{ 1, IGN_OPTION__ACCESS_LEVEL, 3, IGN_OPTION__MIN_VALUE, IGN_OPTION__MAX_VALUE, IGN_OPTION__FACTORY_SETTING, 31060UL },
+	{ 1, MCD_COM_ON_WITH_IGN__ACCESS_LEVEL, 1, MCD_COM_ON_WITH_IGN__MIN_VALUE, MCD_COM_ON_WITH_IGN__MAX_VALUE, MCD_COM_ON_WITH_IGN__FACTORY_SETTING, 31063UL },
+	{ 1, HZM_IGNITION_CYLINDER__ACCESS_LEVEL, 2, HZM_IGNITION_CYLINDER__MIN_VALUE, HZM_IGNITION_CYLINDER__MAX_VALUE, HZM_IGNITION_CYLINDER__FACTORY_SETTING, 31064UL },
+	{ 1, IC9_WRITE_ACCESS__ACCESS_LEVEL, 1, IC9_WRITE_ACCESS__MIN_VALUE, IC9_WRITE_ACCESS__MAX_VALUE, IC9_WRITE_ACCESS__FACTORY_SETTING, 31066UL },
+	{ 1, IC9_IGNITION_CYLINDER__ACCESS_LEVEL, 1, IC9_IGNITION_CYLINDER__MIN_VALUE, IC9_IGNITION_CYLINDER__MAX_VALUE, IC9_IGNITION_CYLINDER__FACTORY_SETTING, 31067UL },
+	{ 1, IC9_FIRING_ORDER__ACCESS_LEVEL, 1, IC9_FIRING_ORDER__MIN_VALUE, IC9_FIRING_ORDER__MAX_VALUE, IC9_FIRING_ORDER__FACTORY_SETTING, 31068UL },
+	{ 1, IC9_GLOBAL_TIMING__ACCESS_LEVEL, 11, IC9_GLOBAL_TIMING__MIN_VALUE, IC9_GLOBAL_TIMING__MAX_VALUE, IC9_GLOBAL_TIMING__FACTORY_SETTING, 31069UL },
+	{ 1, IC9_ENERGY_ODD__ACCESS_LEVEL, 7, IC9_ENERGY_ODD__MIN_VALUE, IC9_ENERGY_ODD__MAX_VALUE, IC9_ENERGY_ODD__FACTORY_SETTING, 31080UL },
+	{ 1, IC9_ENERGY_EVEN__ACCESS_LEVEL, 7, IC9_ENERGY_EVEN__MIN_VALUE, IC9_ENERGY_EVEN__MAX_VALUE, IC9_ENERGY_EVEN__FACTORY_SETTING, 31087UL },
+	{ 1, MIC4_IGNITION_CYLINDER__ACCESS_LEVEL, 3, MIC4_IGNITION_CYLINDER__MIN_VALUE, MIC4_IGNITION_CYLINDER__MAX_VALUE, MIC4_IGNITION_CYLINDER__FACTORY_SETTING, 31094UL },
+	{ 1, MIC4_GLOBAL_TIMING__ACCESS_LEVEL, 11, MIC4_GLOBAL_TIMING__MIN_VALUE, MIC4_GLOBAL_TIMING__MAX_VALUE, MIC4_GLOBAL_TIMING__FACTORY_SETTING, 31097UL },
+	{ 1, MCPU_IGNITION_COM_BAUD__ACCESS_LEVEL, 1, MCPU_IGNITION_COM_BAUD__MIN_VALUE, MCPU_IGNITION_COM_BAUD__MAX_VALUE, MCPU_IGNITION_COM_BAUD__FACTORY_SETTING, 31108UL },
+	{ 1, MCPU_IGNITION_CYLINDER__ACCESS_LEVEL, 2, MCPU_IGNITION_CYLINDER__MIN_VALUE, MCPU_IGNITION_CYLINDER__MAX_VALUE, MCPU_IGNITION_CYLINDER__FACTORY_SETTING, 31109UL },
+	{ 1, MCPU_COM_ON_WITH_IGN__ACCESS_LEVEL, 1, MCPU_COM_ON_WITH_IGN__MIN_VALUE, MCPU_COM_ON_WITH_IGN__MAX_VALUE, MCPU_COM_ON_WITH_IGN__FACTORY_SETTING, 31111UL },
+	{ 1, MCPU_IGNITION_CHECK__ACCESS_LEVEL, 1, MCPU_IGNITION_CHECK__MIN_VALUE, MCPU_IGNITION_CHECK__MAX_VALUE, MCPU_IGNITION_CHECK__FACTORY_SETTING, 31112UL },
+	{ 1, MCPU_WRITE_ACCESS__ACCESS_LEVEL, 1, MCPU_WRITE_ACCESS__MIN_VALUE, MCPU_WRITE_ACCESS__MAX_VALUE, MCPU_WRITE_ACCESS__FACTORY_SETTING, 31113UL },
+	{ 1, NKK_STAGE_CONTROL_LOOKS_AT__ACCESS_LEVEL, 32, NKK_STAGE_CONTROL_LOOKS_AT__MIN_VALUE, NKK_STAGE_CONTROL_LOOKS_AT__MAX_VALUE, NKK_STAGE_CONTROL_LOOKS_AT__FACTORY_SETTING, 31114UL },
+	{ 1, NKK_STAGE_CONTROL_MODE__ACCESS_LEVEL, 1, NKK_STAGE_CONTROL_MODE__MIN_VALUE, NKK_STAGE_CONTROL_MODE__MAX_VALUE, NKK_STAGE_CONTROL_MODE__FACTORY_SETTING, 31146UL },
+	{ 1, NKK_STAGE_CONTROL_BY_HOURS__ACCESS_LEVEL, 1, NKK_STAGE_CONTROL_BY_HOURS__MIN_VALUE, NKK_STAGE_CONTROL_BY_HOURS__MAX_VALUE, NKK_STAGE_CONTROL_BY_HOURS__FACTORY_SETTING, 31147UL },
+	{ 1, NKK_STAGE1_ON_ABOVE__ACCESS_LEVEL, 10, NKK_STAGE1_ON_ABOVE__MIN_VALUE, NKK_STAGE1_ON_ABOVE__MAX_VALUE, NKK_STAGE1_ON_ABOVE__FACTORY_SETTING, 31148UL },
+	{ 1, NKK_STAGE1_OFF_BELOW__ACCESS_LEVEL, 10, NKK_STAGE1_OFF_BELOW__MIN_VALUE, NKK_STAGE1_OFF_BELOW__MAX_VALUE, NKK_STAGE1_OFF_BELOW__FACTORY_SETTING, 31158UL },
+	{ 1, NKK_STAGE2_ON_ABOVE__ACCESS_LEVEL, 10, NKK_STAGE2_ON_ABOVE__MIN_VALUE, NKK_STAGE2_ON_ABOVE__MAX_VALUE, NKK_STAGE2_ON_ABOVE__FACTORY_SETTING, 31168UL },
+	{ 1, NKK_STAGE2_OFF_BELOW__ACCESS_LEVEL, 10, NKK_STAGE2_OFF_BELOW__MIN_VALUE, NKK_STAGE2_OFF_BELOW__MAX_VALUE, NKK_STAGE2_OFF_BELOW__FACTORY_SETTING, 31178UL },
+	{ 1, NKK_STAGE3_ON_ABOVE__ACCESS_LEVEL, 10, NKK_STAGE3_ON_ABOVE__MIN_VALUE, NKK_STAGE3_ON_ABOVE__MAX_VALUE, NKK_STAGE3_ON_ABOVE__FACTORY_SETTING, 31188UL },
+	{ 1, NKK_STAGE3_OFF_BELOW__ACCESS_LEVEL, 10, NKK_STAGE3_OFF_BELOW__MIN_VALUE, NKK_STAGE3_OFF_BELOW__MAX_VALUE, NKK_STAGE3_OFF_BELOW__FACTORY_SETTING, 31198UL },
+	{ 1, NKK_STAGE4_ON_ABOVE__ACCESS_LEVEL, 10, NKK_STAGE4_ON_ABOVE__MIN_VALUE, NKK_STAGE4_ON_ABOVE__MAX_VALUE, NKK_STAGE4_ON_ABOVE__FACTORY_SETTING, 31208UL },
+	{ 1, NKK_STAGE4_OFF_BELOW__ACCESS_LEVEL, 10, NKK_STAGE4_OFF_BELOW__MIN_VALUE, NKK_STAGE4_OFF_BELOW__MAX_VALUE, NKK_STAGE4_OFF_BELOW__FACTORY_SETTING, 31218UL },
+	{ 1, NKK_STAGE5_ON_ABOVE__ACCESS_LEVEL, 10, NKK_STAGE5_ON_ABOVE__MIN_VALUE, NKK_STAGE5_ON_ABOVE__MAX_VALUE, NKK_STAGE5_ON_ABOVE__FACTORY_SETTING, 31228UL },
+	{ 1, NKK_STAGE5_OFF_BELOW__ACCESS_LEVEL, 10, NKK_STAGE5_OFF_BELOW__MIN_VALUE, NKK_STAGE5_OFF_BELOW__MAX_VALUE, NKK_STAGE5_OFF_BELOW__FACTORY_SETTING, 31238UL },
+	{ 1, NKK_STAGE6_ON_ABOVE__ACCESS_LEVEL, 10, NKK_STAGE6_ON_ABOVE__MIN_VALUE, NKK_STAGE6_ON_ABOVE__MAX_VALUE, NKK_STAGE6_ON_ABOVE__FACTORY_SETTING, 31248UL },
+	{ 1, NKK_STAGE6_OFF_BELOW__ACCESS_LEVEL, 10, NKK_STAGE6_OFF_BELOW__MIN_VALUE, NKK_STAGE6_OFF_BELOW__MAX_VALUE, NKK_STAGE6_OFF_BELOW__FACTORY_SETTING, 31258UL },
+	{ 1, NKK_STAGE7_ON_ABOVE__ACCESS_LEVEL, 10, NKK_STAGE7_ON_ABOVE__MIN_VALUE, NKK_STAGE7_ON_ABOVE__MAX_VALUE, NKK_STAGE7_ON_ABOVE__FACTORY_SETTING, 31268UL },
+	{ 1, NKK_STAGE7_OFF_BELOW__ACCESS_LEVEL, 10, NKK_STAGE7_OFF_BELOW__MIN_VALUE, NKK_STAGE7_OFF_BELOW__MAX_VALUE, NKK_STAGE7_OFF_BELOW__FACTORY_SETTING, 31278UL },
+	{ 1, NKK_PUMP_AND_STAGE1_OPERATING_HOURS__ACCESS_LEVEL, 26, NKK_PUMP_AND_STAGE1_OPERATING_HOURS__MIN_VALUE, NKK_PUMP_AND_STAGE1_OPERATING_HOURS__MAX_VALUE, NKK_PUMP_AND_STAGE1_OPERATING_HOURS__FACTORY_SETTING, 31288UL },
+	{ 1, NKK_STAGE2_OPERATING_HOURS__ACCESS_LEVEL, 26, NKK_STAGE2_OPERATING_HOURS__MIN_VALUE, NKK_STAGE2_OPERATING_HOURS__MAX_VALUE, NKK_STAGE2_OPERATING_HOURS__FACTORY_SETTING, 31314UL },
+	{ 1, NKK_STAGE3_OPERATING_HOURS__ACCESS_LEVEL, 26, NKK_STAGE3_OPERATING_HOURS__MIN_VALUE, NKK_STAGE3_OPERATING_HOURS__MAX_VALUE, NKK_STAGE3_OPERATING_HOURS__FACTORY_SETTING, 31340UL },
+	{ 1, NKK_STAGE4_OPERATING_HOURS__ACCESS_LEVEL, 26, NKK_STAGE4_OPERATING_HOURS__MIN_VALUE, NKK_STAGE4_OPERATING_HOURS__MAX_VALUE, NKK_STAGE4_OPERATING_HOURS__FACTORY_SETTING, 31366UL },
+	{ 1, NKK_STAGE5_OPERATING_HOURS__ACCESS_LEVEL, 26, NKK_STAGE5_OPERATING_HOURS__MIN_VALUE, NKK_STAGE5_OPERATING_HOURS__MAX_VALUE, NKK_STAGE5_OPERATING_HOURS__FACTORY_SETTING, 31392UL },
+	{ 1, NKK_STAGE6_OPERATING_HOURS__ACCESS_LEVEL, 26, NKK_STAGE6_OPERATING_HOURS__MIN_VALUE, NKK_STAGE6_OPERATING_HOURS__MAX_VALUE, NKK_STAGE6_OPERATING_HOURS__FACTORY_SETTING, 31418UL },
+	{ 1, NKK_STAGE7_OPERATING_HOURS__ACCESS_LEVEL, 26, NKK_STAGE7_OPERATING_HOURS__MIN_VALUE, NKK_STAGE7_OPERATING_HOURS__MAX_VALUE, NKK_STAGE7_OPERATING_HOURS__FACTORY_SETTING, 31444UL },
+	{ 1, CLS_LIMIT__ACCESS_LEVEL, 16, CLS_LIMIT__MIN_VALUE, CLS_LIMIT__MAX_VALUE, CLS_LIMIT__FACTORY_SETTING, 31470UL },
+	{ 1, CLS_LOGIC__ACCESS_LEVEL, 1, CLS_LOGIC__MIN_VALUE, CLS_LOGIC__MAX_VALUE, CLS_LOGIC__FACTORY_SETTING, 31486UL },
+	{ 1, CLS_HYST__ACCESS_LEVEL, 15, CLS_HYST__MIN_VALUE, CLS_HYST__MAX_VALUE, CLS_HYST__FACTORY_SETTING, 31487UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 31502UL },	// CLS_LIMIT2
+	{ 0, 0, 32, 0L, 0L, 0L, 31534UL },	// CLS_LOGIC2
+	{ 0, 0, 32, 0L, 0L, 0L, 31566UL },	// CLS_HYST2
+	{ 1, CH4_MEASURED_VALUE__ACCESS_LEVEL, 10, CH4_MEASURED_VALUE__MIN_VALUE, CH4_MEASURED_VALUE__MAX_VALUE, CH4_MEASURED_VALUE__FACTORY_SETTING, 31598UL },
+	{ 1, SPEED_RAMP_UP__ACCESS_LEVEL, 19, SPEED_RAMP_UP__MIN_VALUE, SPEED_RAMP_UP__MAX_VALUE, SPEED_RAMP_UP__FACTORY_SETTING, 31608UL },
+	{ 1, MIX_LOAD_RED_RECEIVER_TEMP_RAMP__ACCESS_LEVEL, 17, MIX_LOAD_RED_RECEIVER_TEMP_RAMP__MIN_VALUE, MIX_LOAD_RED_RECEIVER_TEMP_RAMP__MAX_VALUE, MIX_LOAD_RED_RECEIVER_TEMP_RAMP__FACTORY_SETTING, 31627UL },
+	{ 1, MIX_LOAD_RED_RECEIVER_TEMP_START_VALUE__ACCESS_LEVEL, 11, MIX_LOAD_RED_RECEIVER_TEMP_START_VALUE__MIN_VALUE, MIX_LOAD_RED_RECEIVER_TEMP_START_VALUE__MAX_VALUE, MIX_LOAD_RED_RECEIVER_TEMP_START_VALUE__FACTORY_SETTING, 31644UL },
+	{ 1, TUR_MAX_POWER_DEV_SHUTDOWN__ACCESS_LEVEL, 10, TUR_MAX_POWER_DEV_SHUTDOWN__MIN_VALUE, TUR_MAX_POWER_DEV_SHUTDOWN__MAX_VALUE, TUR_MAX_POWER_DEV_SHUTDOWN__FACTORY_SETTING, 31655UL },
+	{ 1, TUR_MAX_POWER_DEV_SHUTDOWN_DELAY__ACCESS_LEVEL, 14, TUR_MAX_POWER_DEV_SHUTDOWN_DELAY__MIN_VALUE, TUR_MAX_POWER_DEV_SHUTDOWN_DELAY__MAX_VALUE, TUR_MAX_POWER_DEV_SHUTDOWN_DELAY__FACTORY_SETTING, 31665UL },
+	{ 1, LOW_IDLE_OPTION__ACCESS_LEVEL, 2, LOW_IDLE_OPTION__MIN_VALUE, LOW_IDLE_OPTION__MAX_VALUE, LOW_IDLE_OPTION__FACTORY_SETTING, 31679UL },
+	{ 1, LOW_IDLE_SPEED__ACCESS_LEVEL, 9, LOW_IDLE_SPEED__MIN_VALUE, LOW_IDLE_SPEED__MAX_VALUE, LOW_IDLE_SPEED__FACTORY_SETTING, 31681UL },
+	{ 1, LOW_IDLE_RELEASE_OIL_TEMP__ACCESS_LEVEL, 10, LOW_IDLE_RELEASE_OIL_TEMP__MIN_VALUE, LOW_IDLE_RELEASE_OIL_TEMP__MAX_VALUE, LOW_IDLE_RELEASE_OIL_TEMP__FACTORY_SETTING, 31690UL },
+	{ 1, LOW_IDLE_RELEASE_TIME__ACCESS_LEVEL, 22, LOW_IDLE_RELEASE_TIME__MIN_VALUE, LOW_IDLE_RELEASE_TIME__MAX_VALUE, LOW_IDLE_RELEASE_TIME__FACTORY_SETTING, 31700UL },
+	{ 1, LOW_IDLE_TIMEOUT__ACCESS_LEVEL, 23, LOW_IDLE_TIMEOUT__MIN_VALUE, LOW_IDLE_TIMEOUT__MAX_VALUE, LOW_IDLE_TIMEOUT__FACTORY_SETTING, 31722UL },
+	{ 1, LOW_IDLE_OIL_PRESS_MIN_LIMIT__ACCESS_LEVEL, 11, LOW_IDLE_OIL_PRESS_MIN_LIMIT__MIN_VALUE, LOW_IDLE_OIL_PRESS_MIN_LIMIT__MAX_VALUE, LOW_IDLE_OIL_PRESS_MIN_LIMIT__FACTORY_SETTING, 31745UL },
+	{ 1, LOW_IDLE_OIL_PRESS_MIN_ACT_DELAY__ACCESS_LEVEL, 15, LOW_IDLE_OIL_PRESS_MIN_ACT_DELAY__MIN_VALUE, LOW_IDLE_OIL_PRESS_MIN_ACT_DELAY__MAX_VALUE, LOW_IDLE_OIL_PRESS_MIN_ACT_DELAY__FACTORY_SETTING, 31756UL },
+	{ 1, LOW_IDLE_OIL_PRESS_MIN_ACT_SPEED__ACCESS_LEVEL, 14, LOW_IDLE_OIL_PRESS_MIN_ACT_SPEED__MIN_VALUE, LOW_IDLE_OIL_PRESS_MIN_ACT_SPEED__MAX_VALUE, LOW_IDLE_OIL_PRESS_MIN_ACT_SPEED__FACTORY_SETTING, 31771UL },
+	{ 1, CUMMINS_OPTION__ACCESS_LEVEL, 1, CUMMINS_OPTION__MIN_VALUE, CUMMINS_OPTION__MAX_VALUE, CUMMINS_OPTION__FACTORY_SETTING, 31785UL },
+	{ 1, CUMMINS_THROTTLE_LOW_IDLE__ACCESS_LEVEL, 10, CUMMINS_THROTTLE_LOW_IDLE__MIN_VALUE, CUMMINS_THROTTLE_LOW_IDLE__MAX_VALUE, CUMMINS_THROTTLE_LOW_IDLE__FACTORY_SETTING, 31786UL },
+	{ 1, CUMMINS_THROTTLE_NOMINAL__ACCESS_LEVEL, 10, CUMMINS_THROTTLE_NOMINAL__MIN_VALUE, CUMMINS_THROTTLE_NOMINAL__MAX_VALUE, CUMMINS_THROTTLE_NOMINAL__FACTORY_SETTING, 31796UL },
+	{ 1, CUMMINS_THROTTLE_LOAD__ACCESS_LEVEL, 10, CUMMINS_THROTTLE_LOAD__MIN_VALUE, CUMMINS_THROTTLE_LOAD__MAX_VALUE, CUMMINS_THROTTLE_LOAD__FACTORY_SETTING, 31806UL },
+	{ 1, UVS_FREEZE_REGULATOR_DELAY__ACCESS_LEVEL, 13, UVS_FREEZE_REGULATOR_DELAY__MIN_VALUE, UVS_FREEZE_REGULATOR_DELAY__MAX_VALUE, UVS_FREEZE_REGULATOR_DELAY__FACTORY_SETTING, 31816UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 31829UL },	// CAI_SENSOR_ZERO_1
+	{ 0, 0, 32, 0L, 0L, 0L, 31861UL },	// CAI_SENSOR_FULL_1
+	{ 0, 0, 32, 0L, 0L, 0L, 31893UL },	// CAI_SENSOR_DIGITS_1
+	{ 0, 0, 32, 0L, 0L, 0L, 31925UL },	// CAI_SENSOR_WIREBREAK_1
+	{ 0, 0, 32, 0L, 0L, 0L, 31957UL },	// CAI_SENSOR_OVERLOAD_1
+	{ 0, 0, 32, 0L, 0L, 0L, 31989UL },	// CAI_SENSOR_FAULT_DELAY_1
+	{ 0, 0, 32, 0L, 0L, 0L, 32021UL },	// CAI_SENSOR_ZERO_2
+	{ 0, 0, 32, 0L, 0L, 0L, 32053UL },	// CAI_SENSOR_FULL_2
+	{ 0, 0, 32, 0L, 0L, 0L, 32085UL },	// CAI_SENSOR_DIGITS_2
+	{ 0, 0, 32, 0L, 0L, 0L, 32117UL },	// CAI_SENSOR_WIREBREAK_2
+	{ 0, 0, 32, 0L, 0L, 0L, 32149UL },	// CAI_SENSOR_OVERLOAD_2
+	{ 0, 0, 32, 0L, 0L, 0L, 32181UL },	// CAI_SENSOR_FAULT_DELAY_2
+	{ 0, 0, 32, 0L, 0L, 0L, 32213UL },	// CAI_SENSOR_ZERO_3
+	{ 0, 0, 32, 0L, 0L, 0L, 32245UL },	// CAI_SENSOR_FULL_3
+	{ 0, 0, 32, 0L, 0L, 0L, 32277UL },	// CAI_SENSOR_DIGITS_3
+	{ 0, 0, 32, 0L, 0L, 0L, 32309UL },	// CAI_SENSOR_WIREBREAK_3
+	{ 0, 0, 32, 0L, 0L, 0L, 32341UL },	// CAI_SENSOR_OVERLOAD_3
+	{ 0, 0, 32, 0L, 0L, 0L, 32373UL },	// CAI_SENSOR_FAULT_DELAY_3
+	{ 0, 0, 32, 0L, 0L, 0L, 32405UL },	// CAI_SENSOR_ZERO_4
+	{ 0, 0, 32, 0L, 0L, 0L, 32437UL },	// CAI_SENSOR_FULL_4
+	{ 0, 0, 32, 0L, 0L, 0L, 32469UL },	// CAI_SENSOR_DIGITS_4
+	{ 0, 0, 32, 0L, 0L, 0L, 32501UL },	// CAI_SENSOR_WIREBREAK_4
+	{ 0, 0, 32, 0L, 0L, 0L, 32533UL },	// CAI_SENSOR_OVERLOAD_4
+	{ 0, 0, 32, 0L, 0L, 0L, 32565UL },	// CAI_SENSOR_FAULT_DELAY_4
+	{ 0, 0, 32, 0L, 0L, 0L, 32597UL },	// CAI_SENSOR_ZERO_5
+	{ 0, 0, 32, 0L, 0L, 0L, 32629UL },	// CAI_SENSOR_FULL_5
+	{ 0, 0, 32, 0L, 0L, 0L, 32661UL },	// CAI_SENSOR_DIGITS_5
+	{ 0, 0, 32, 0L, 0L, 0L, 32693UL },	// CAI_SENSOR_WIREBREAK_5
+	{ 0, 0, 32, 0L, 0L, 0L, 32725UL },	// CAI_SENSOR_OVERLOAD_5
+	{ 0, 0, 32, 0L, 0L, 0L, 32757UL },	// CAI_SENSOR_FAULT_DELAY_5
+	{ 0, 0, 32, 0L, 0L, 0L, 32789UL },	// CAI_SENSOR_ZERO_6
+	{ 0, 0, 32, 0L, 0L, 0L, 32821UL },	// CAI_SENSOR_FULL_6
+	{ 0, 0, 32, 0L, 0L, 0L, 32853UL },	// CAI_SENSOR_DIGITS_6
+	{ 0, 0, 32, 0L, 0L, 0L, 32885UL },	// CAI_SENSOR_WIREBREAK_6
+	{ 0, 0, 32, 0L, 0L, 0L, 32917UL },	// CAI_SENSOR_OVERLOAD_6
+	{ 0, 0, 32, 0L, 0L, 0L, 32949UL },	// CAI_SENSOR_FAULT_DELAY_6
+	{ 0, 0, 32, 0L, 0L, 0L, 32981UL },	// CAI_SENSOR_ZERO_7
+	{ 0, 0, 32, 0L, 0L, 0L, 33013UL },	// CAI_SENSOR_FULL_7
+	{ 0, 0, 32, 0L, 0L, 0L, 33045UL },	// CAI_SENSOR_DIGITS_7
+	{ 0, 0, 32, 0L, 0L, 0L, 33077UL },	// CAI_SENSOR_WIREBREAK_7
+	{ 0, 0, 32, 0L, 0L, 0L, 33109UL },	// CAI_SENSOR_OVERLOAD_7
+	{ 0, 0, 32, 0L, 0L, 0L, 33141UL },	// CAI_SENSOR_FAULT_DELAY_7
+	{ 0, 0, 32, 0L, 0L, 0L, 33173UL },	// CAI_SENSOR_ZERO_8
+	{ 0, 0, 32, 0L, 0L, 0L, 33205UL },	// CAI_SENSOR_FULL_8
+	{ 0, 0, 32, 0L, 0L, 0L, 33237UL },	// CAI_SENSOR_DIGITS_8
+	{ 0, 0, 32, 0L, 0L, 0L, 33269UL },	// CAI_SENSOR_WIREBREAK_8
+	{ 0, 0, 32, 0L, 0L, 0L, 33301UL },	// CAI_SENSOR_OVERLOAD_8
+	{ 0, 0, 32, 0L, 0L, 0L, 33333UL },	// CAI_SENSOR_FAULT_DELAY_8
+	{ 0, 0, 32, 0L, 0L, 0L, 33365UL },	// CAI_SENSOR_ZERO_9
+	{ 0, 0, 32, 0L, 0L, 0L, 33397UL },	// CAI_SENSOR_FULL_9
+	{ 0, 0, 32, 0L, 0L, 0L, 33429UL },	// CAI_SENSOR_DIGITS_9
+	{ 0, 0, 32, 0L, 0L, 0L, 33461UL },	// CAI_SENSOR_WIREBREAK_9
+	{ 0, 0, 32, 0L, 0L, 0L, 33493UL },	// CAI_SENSOR_OVERLOAD_9
+	{ 0, 0, 32, 0L, 0L, 0L, 33525UL },	// CAI_SENSOR_FAULT_DELAY_9
+	{ 0, 0, 32, 0L, 0L, 0L, 33557UL },	// CAI_SENSOR_ZERO_10
+	{ 0, 0, 32, 0L, 0L, 0L, 33589UL },	// CAI_SENSOR_FULL_10
+	{ 0, 0, 32, 0L, 0L, 0L, 33621UL },	// CAI_SENSOR_DIGITS_10
+	{ 0, 0, 32, 0L, 0L, 0L, 33653UL },	// CAI_SENSOR_WIREBREAK_10
+	{ 0, 0, 32, 0L, 0L, 0L, 33685UL },	// CAI_SENSOR_OVERLOAD_10
+	{ 0, 0, 32, 0L, 0L, 0L, 33717UL },	// CAI_SENSOR_FAULT_DELAY_10
+	{ 0, 0, 32, 0L, 0L, 0L, 33749UL },	// CAI_SENSOR_ZERO_11
+	{ 0, 0, 32, 0L, 0L, 0L, 33781UL },	// CAI_SENSOR_FULL_11
+	{ 0, 0, 32, 0L, 0L, 0L, 33813UL },	// CAI_SENSOR_DIGITS_11
+	{ 0, 0, 32, 0L, 0L, 0L, 33845UL },	// CAI_SENSOR_WIREBREAK_11
+	{ 0, 0, 32, 0L, 0L, 0L, 33877UL },	// CAI_SENSOR_OVERLOAD_11
+	{ 0, 0, 32, 0L, 0L, 0L, 33909UL },	// CAI_SENSOR_FAULT_DELAY_11
+	{ 0, 0, 32, 0L, 0L, 0L, 33941UL },	// CAI_SENSOR_ZERO_12
+	{ 0, 0, 32, 0L, 0L, 0L, 33973UL },	// CAI_SENSOR_FULL_12
+	{ 0, 0, 32, 0L, 0L, 0L, 34005UL },	// CAI_SENSOR_DIGITS_12
+	{ 0, 0, 32, 0L, 0L, 0L, 34037UL },	// CAI_SENSOR_WIREBREAK_12
+	{ 0, 0, 32, 0L, 0L, 0L, 34069UL },	// CAI_SENSOR_OVERLOAD_12
+	{ 0, 0, 32, 0L, 0L, 0L, 34101UL },	// CAI_SENSOR_FAULT_DELAY_12
+	{ 0, 0, 32, 0L, 0L, 0L, 34133UL },	// CAI_SENSOR_ZERO_13
+	{ 0, 0, 32, 0L, 0L, 0L, 34165UL },	// CAI_SENSOR_FULL_13
+	{ 0, 0, 32, 0L, 0L, 0L, 34197UL },	// CAI_SENSOR_DIGITS_13
+	{ 0, 0, 32, 0L, 0L, 0L, 34229UL },	// CAI_SENSOR_WIREBREAK_13
+	{ 0, 0, 32, 0L, 0L, 0L, 34261UL },	// CAI_SENSOR_OVERLOAD_13
+	{ 0, 0, 32, 0L, 0L, 0L, 34293UL },	// CAI_SENSOR_FAULT_DELAY_13
+	{ 0, 0, 32, 0L, 0L, 0L, 34325UL },	// CAI_SENSOR_ZERO_14
+	{ 0, 0, 32, 0L, 0L, 0L, 34357UL },	// CAI_SENSOR_FULL_14
+	{ 0, 0, 32, 0L, 0L, 0L, 34389UL },	// CAI_SENSOR_DIGITS_14
+	{ 0, 0, 32, 0L, 0L, 0L, 34421UL },	// CAI_SENSOR_WIREBREAK_14
+	{ 0, 0, 32, 0L, 0L, 0L, 34453UL },	// CAI_SENSOR_OVERLOAD_14
+	{ 0, 0, 32, 0L, 0L, 0L, 34485UL },	// CAI_SENSOR_FAULT_DELAY_14
+	{ 0, 0, 32, 0L, 0L, 0L, 34517UL },	// CAI_SENSOR_ZERO_15
+	{ 0, 0, 32, 0L, 0L, 0L, 34549UL },	// CAI_SENSOR_FULL_15
+	{ 0, 0, 32, 0L, 0L, 0L, 34581UL },	// CAI_SENSOR_DIGITS_15
+	{ 0, 0, 32, 0L, 0L, 0L, 34613UL },	// CAI_SENSOR_WIREBREAK_15
+	{ 0, 0, 32, 0L, 0L, 0L, 34645UL },	// CAI_SENSOR_OVERLOAD_15
+	{ 0, 0, 32, 0L, 0L, 0L, 34677UL },	// CAI_SENSOR_FAULT_DELAY_15
+	{ 0, 0, 32, 0L, 0L, 0L, 34709UL },	// CAI_SENSOR_ZERO_16
+	{ 0, 0, 32, 0L, 0L, 0L, 34741UL },	// CAI_SENSOR_FULL_16
+	{ 0, 0, 32, 0L, 0L, 0L, 34773UL },	// CAI_SENSOR_DIGITS_16
+	{ 0, 0, 32, 0L, 0L, 0L, 34805UL },	// CAI_SENSOR_WIREBREAK_16
+	{ 0, 0, 32, 0L, 0L, 0L, 34837UL },	// CAI_SENSOR_OVERLOAD_16
+	{ 0, 0, 32, 0L, 0L, 0L, 34869UL },	// CAI_SENSOR_FAULT_DELAY_16
+	{ 0, 0, 32, 0L, 0L, 0L, 34901UL },	// CAI_SENSOR_ZERO_17
+	{ 0, 0, 32, 0L, 0L, 0L, 34933UL },	// CAI_SENSOR_FULL_17
+	{ 0, 0, 32, 0L, 0L, 0L, 34965UL },	// CAI_SENSOR_DIGITS_17
+	{ 0, 0, 32, 0L, 0L, 0L, 34997UL },	// CAI_SENSOR_WIREBREAK_17
+	{ 0, 0, 32, 0L, 0L, 0L, 35029UL },	// CAI_SENSOR_OVERLOAD_17
+	{ 0, 0, 32, 0L, 0L, 0L, 35061UL },	// CAI_SENSOR_FAULT_DELAY_17
+	{ 0, 0, 32, 0L, 0L, 0L, 35093UL },	// CAI_SENSOR_ZERO_18
+	{ 0, 0, 32, 0L, 0L, 0L, 35125UL },	// CAI_SENSOR_FULL_18
+	{ 0, 0, 32, 0L, 0L, 0L, 35157UL },	// CAI_SENSOR_DIGITS_18
+	{ 0, 0, 32, 0L, 0L, 0L, 35189UL },	// CAI_SENSOR_WIREBREAK_18
+	{ 0, 0, 32, 0L, 0L, 0L, 35221UL },	// CAI_SENSOR_OVERLOAD_18
+	{ 0, 0, 32, 0L, 0L, 0L, 35253UL },	// CAI_SENSOR_FAULT_DELAY_18
+	{ 0, 0, 32, 0L, 0L, 0L, 35285UL },	// CAI_SENSOR_ZERO_19
+	{ 0, 0, 32, 0L, 0L, 0L, 35317UL },	// CAI_SENSOR_FULL_19
+	{ 0, 0, 32, 0L, 0L, 0L, 35349UL },	// CAI_SENSOR_DIGITS_19
+	{ 0, 0, 32, 0L, 0L, 0L, 35381UL },	// CAI_SENSOR_WIREBREAK_19
+	{ 0, 0, 32, 0L, 0L, 0L, 35413UL },	// CAI_SENSOR_OVERLOAD_19
+	{ 0, 0, 32, 0L, 0L, 0L, 35445UL },	// CAI_SENSOR_FAULT_DELAY_19
+	{ 0, 0, 32, 0L, 0L, 0L, 35477UL },	// CAI_SENSOR_ZERO_20
+	{ 0, 0, 32, 0L, 0L, 0L, 35509UL },	// CAI_SENSOR_FULL_20
+	{ 0, 0, 32, 0L, 0L, 0L, 35541UL },	// CAI_SENSOR_DIGITS_20
+	{ 0, 0, 32, 0L, 0L, 0L, 35573UL },	// CAI_SENSOR_WIREBREAK_20
+	{ 0, 0, 32, 0L, 0L, 0L, 35605UL },	// CAI_SENSOR_OVERLOAD_20
+	{ 0, 0, 32, 0L, 0L, 0L, 35637UL },	// CAI_SENSOR_FAULT_DELAY_20
+	{ 0, 0, 32, 0L, 0L, 0L, 35669UL },	// CAI_SENSOR_ZERO_21
+	{ 0, 0, 32, 0L, 0L, 0L, 35701UL },	// CAI_SENSOR_FULL_21
+	{ 0, 0, 32, 0L, 0L, 0L, 35733UL },	// CAI_SENSOR_DIGITS_21
+	{ 0, 0, 32, 0L, 0L, 0L, 35765UL },	// CAI_SENSOR_WIREBREAK_21
+	{ 0, 0, 32, 0L, 0L, 0L, 35797UL },	// CAI_SENSOR_OVERLOAD_21
+	{ 0, 0, 32, 0L, 0L, 0L, 35829UL },	// CAI_SENSOR_FAULT_DELAY_21
+	{ 0, 0, 32, 0L, 0L, 0L, 35861UL },	// CAI_SENSOR_ZERO_22
+	{ 0, 0, 32, 0L, 0L, 0L, 35893UL },	// CAI_SENSOR_FULL_22
+	{ 0, 0, 32, 0L, 0L, 0L, 35925UL },	// CAI_SENSOR_DIGITS_22
+	{ 0, 0, 32, 0L, 0L, 0L, 35957UL },	// CAI_SENSOR_WIREBREAK_22
+	{ 0, 0, 32, 0L, 0L, 0L, 35989UL },	// CAI_SENSOR_OVERLOAD_22
+	{ 0, 0, 32, 0L, 0L, 0L, 36021UL },	// CAI_SENSOR_FAULT_DELAY_22
+	{ 0, 0, 32, 0L, 0L, 0L, 36053UL },	// CAI_SENSOR_ZERO_23
+	{ 0, 0, 32, 0L, 0L, 0L, 36085UL },	// CAI_SENSOR_FULL_23
+	{ 0, 0, 32, 0L, 0L, 0L, 36117UL },	// CAI_SENSOR_DIGITS_23
+	{ 0, 0, 32, 0L, 0L, 0L, 36149UL },	// CAI_SENSOR_WIREBREAK_23
+	{ 0, 0, 32, 0L, 0L, 0L, 36181UL },	// CAI_SENSOR_OVERLOAD_23
+	{ 0, 0, 32, 0L, 0L, 0L, 36213UL },	// CAI_SENSOR_FAULT_DELAY_23
+	{ 0, 0, 32, 0L, 0L, 0L, 36245UL },	// CAI_SENSOR_ZERO_24
+	{ 0, 0, 32, 0L, 0L, 0L, 36277UL },	// CAI_SENSOR_FULL_24
+	{ 0, 0, 32, 0L, 0L, 0L, 36309UL },	// CAI_SENSOR_DIGITS_24
+	{ 0, 0, 32, 0L, 0L, 0L, 36341UL },	// CAI_SENSOR_WIREBREAK_24
+	{ 0, 0, 32, 0L, 0L, 0L, 36373UL },	// CAI_SENSOR_OVERLOAD_24
+	{ 0, 0, 32, 0L, 0L, 0L, 36405UL },	// CAI_SENSOR_FAULT_DELAY_24
+	{ 0, 0, 32, 0L, 0L, 0L, 36437UL },	// CAI_SC_LEVEL_1
+	{ 0, 0, 32, 0L, 0L, 0L, 36469UL },	// CAI_ALA_ENAB_1
+	{ 0, 0, 32, 0L, 0L, 0L, 36501UL },	// CAI_LIMITVAL_1
+	{ 0, 0, 32, 0L, 0L, 0L, 36533UL },	// CAI_DEL_TIME_1
+	{ 0, 0, 32, 0L, 0L, 0L, 36565UL },	// CAI_REC_TIME_1
+	{ 0, 0, 32, 0L, 0L, 0L, 36597UL },	// CAI_ACTDELAY_1
+	{ 0, 0, 32, 0L, 0L, 0L, 36629UL },	// CAI_CONFIG___1
+	{ 0, 0, 32, 0L, 0L, 0L, 36661UL },	// CAI_CONF_DO__1
+	{ 0, 0, 32, 0L, 0L, 0L, 36693UL },	// CAI_SC_LEVEL_2
+	{ 0, 0, 32, 0L, 0L, 0L, 36725UL },	// CAI_ALA_ENAB_2
+	{ 0, 0, 32, 0L, 0L, 0L, 36757UL },	// CAI_LIMITVAL_2
+	{ 0, 0, 32, 0L, 0L, 0L, 36789UL },	// CAI_DEL_TIME_2
+	{ 0, 0, 32, 0L, 0L, 0L, 36821UL },	// CAI_REC_TIME_2
+	{ 0, 0, 32, 0L, 0L, 0L, 36853UL },	// CAI_ACTDELAY_2
+	{ 0, 0, 32, 0L, 0L, 0L, 36885UL },	// CAI_CONFIG___2
+	{ 0, 0, 32, 0L, 0L, 0L, 36917UL },	// CAI_CONF_DO__2
+	{ 0, 0, 32, 0L, 0L, 0L, 36949UL },	// CAI_SC_LEVEL_3
+	{ 0, 0, 32, 0L, 0L, 0L, 36981UL },	// CAI_ALA_ENAB_3
+	{ 0, 0, 32, 0L, 0L, 0L, 37013UL },	// CAI_LIMITVAL_3
+	{ 0, 0, 32, 0L, 0L, 0L, 37045UL },	// CAI_DEL_TIME_3
+	{ 0, 0, 32, 0L, 0L, 0L, 37077UL },	// CAI_REC_TIME_3
+	{ 0, 0, 32, 0L, 0L, 0L, 37109UL },	// CAI_ACTDELAY_3
+	{ 0, 0, 32, 0L, 0L, 0L, 37141UL },	// CAI_CONFIG___3
+	{ 0, 0, 32, 0L, 0L, 0L, 37173UL },	// CAI_CONF_DO__3
+	{ 0, 0, 32, 0L, 0L, 0L, 37205UL },	// CAI_SC_LEVEL_4
+	{ 0, 0, 32, 0L, 0L, 0L, 37237UL },	// CAI_ALA_ENAB_4
+	{ 0, 0, 32, 0L, 0L, 0L, 37269UL },	// CAI_LIMITVAL_4
+	{ 0, 0, 32, 0L, 0L, 0L, 37301UL },	// CAI_DEL_TIME_4
+	{ 0, 0, 32, 0L, 0L, 0L, 37333UL },	// CAI_REC_TIME_4
+	{ 0, 0, 32, 0L, 0L, 0L, 37365UL },	// CAI_ACTDELAY_4
+	{ 0, 0, 32, 0L, 0L, 0L, 37397UL },	// CAI_CONFIG___4
+	{ 0, 0, 32, 0L, 0L, 0L, 37429UL },	// CAI_CONF_DO__4
+	{ 0, 0, 32, 0L, 0L, 0L, 37461UL },	// CAI_SC_LEVEL_5
+	{ 0, 0, 32, 0L, 0L, 0L, 37493UL },	// CAI_ALA_ENAB_5
+	{ 0, 0, 32, 0L, 0L, 0L, 37525UL },	// CAI_LIMITVAL_5
+	{ 0, 0, 32, 0L, 0L, 0L, 37557UL },	// CAI_DEL_TIME_5
+	{ 0, 0, 32, 0L, 0L, 0L, 37589UL },	// CAI_REC_TIME_5
+	{ 0, 0, 32, 0L, 0L, 0L, 37621UL },	// CAI_ACTDELAY_5
+	{ 0, 0, 32, 0L, 0L, 0L, 37653UL },	// CAI_CONFIG___5
+	{ 0, 0, 32, 0L, 0L, 0L, 37685UL },	// CAI_CONF_DO__5
+	{ 0, 0, 32, 0L, 0L, 0L, 37717UL },	// CAI_SC_LEVEL_6
+	{ 0, 0, 32, 0L, 0L, 0L, 37749UL },	// CAI_ALA_ENAB_6
+	{ 0, 0, 32, 0L, 0L, 0L, 37781UL },	// CAI_LIMITVAL_6
+	{ 0, 0, 32, 0L, 0L, 0L, 37813UL },	// CAI_DEL_TIME_6
+	{ 0, 0, 32, 0L, 0L, 0L, 37845UL },	// CAI_REC_TIME_6
+	{ 0, 0, 32, 0L, 0L, 0L, 37877UL },	// CAI_ACTDELAY_6
+	{ 0, 0, 32, 0L, 0L, 0L, 37909UL },	// CAI_CONFIG___6
+	{ 0, 0, 32, 0L, 0L, 0L, 37941UL },	// CAI_CONF_DO__6
+	{ 0, 0, 32, 0L, 0L, 0L, 37973UL },	// CAI_SC_LEVEL_7
+	{ 0, 0, 32, 0L, 0L, 0L, 38005UL },	// CAI_ALA_ENAB_7
+	{ 0, 0, 32, 0L, 0L, 0L, 38037UL },	// CAI_LIMITVAL_7
+	{ 0, 0, 32, 0L, 0L, 0L, 38069UL },	// CAI_DEL_TIME_7
+	{ 0, 0, 32, 0L, 0L, 0L, 38101UL },	// CAI_REC_TIME_7
+	{ 0, 0, 32, 0L, 0L, 0L, 38133UL },	// CAI_ACTDELAY_7
+	{ 0, 0, 32, 0L, 0L, 0L, 38165UL },	// CAI_CONFIG___7
+	{ 0, 0, 32, 0L, 0L, 0L, 38197UL },	// CAI_CONF_DO__7
+	{ 0, 0, 32, 0L, 0L, 0L, 38229UL },	// CAI_SC_LEVEL_8
+	{ 0, 0, 32, 0L, 0L, 0L, 38261UL },	// CAI_ALA_ENAB_8
+	{ 0, 0, 32, 0L, 0L, 0L, 38293UL },	// CAI_LIMITVAL_8
+	{ 0, 0, 32, 0L, 0L, 0L, 38325UL },	// CAI_DEL_TIME_8
+	{ 0, 0, 32, 0L, 0L, 0L, 38357UL },	// CAI_REC_TIME_8
+	{ 0, 0, 32, 0L, 0L, 0L, 38389UL },	// CAI_ACTDELAY_8
+	{ 0, 0, 32, 0L, 0L, 0L, 38421UL },	// CAI_CONFIG___8
+	{ 0, 0, 32, 0L, 0L, 0L, 38453UL },	// CAI_CONF_DO__8
+	{ 0, 0, 32, 0L, 0L, 0L, 38485UL },	// CAI_SC_LEVEL_9
+	{ 0, 0, 32, 0L, 0L, 0L, 38517UL },	// CAI_ALA_ENAB_9
+	{ 0, 0, 32, 0L, 0L, 0L, 38549UL },	// CAI_LIMITVAL_9
+	{ 0, 0, 32, 0L, 0L, 0L, 38581UL },	// CAI_DEL_TIME_9
+	{ 0, 0, 32, 0L, 0L, 0L, 38613UL },	// CAI_REC_TIME_9
+	{ 0, 0, 32, 0L, 0L, 0L, 38645UL },	// CAI_ACTDELAY_9
+	{ 0, 0, 32, 0L, 0L, 0L, 38677UL },	// CAI_CONFIG___9
+	{ 0, 0, 32, 0L, 0L, 0L, 38709UL },	// CAI_CONF_DO__9
+	{ 0, 0, 32, 0L, 0L, 0L, 38741UL },	// CAI_SC_LEVEL_10
+	{ 0, 0, 32, 0L, 0L, 0L, 38773UL },	// CAI_ALA_ENAB_10
+	{ 0, 0, 32, 0L, 0L, 0L, 38805UL },	// CAI_LIMITVAL_10
+	{ 0, 0, 32, 0L, 0L, 0L, 38837UL },	// CAI_DEL_TIME_10
+	{ 0, 0, 32, 0L, 0L, 0L, 38869UL },	// CAI_REC_TIME_10
+	{ 0, 0, 32, 0L, 0L, 0L, 38901UL },	// CAI_ACTDELAY_10
+	{ 0, 0, 32, 0L, 0L, 0L, 38933UL },	// CAI_CONFIG___10
+	{ 0, 0, 32, 0L, 0L, 0L, 38965UL },	// CAI_CONF_DO__10
+	{ 0, 0, 32, 0L, 0L, 0L, 38997UL },	// CAI_SC_LEVEL_11
+	{ 0, 0, 32, 0L, 0L, 0L, 39029UL },	// CAI_ALA_ENAB_11
+	{ 0, 0, 32, 0L, 0L, 0L, 39061UL },	// CAI_LIMITVAL_11
+	{ 0, 0, 32, 0L, 0L, 0L, 39093UL },	// CAI_DEL_TIME_11
+	{ 0, 0, 32, 0L, 0L, 0L, 39125UL },	// CAI_REC_TIME_11
+	{ 0, 0, 32, 0L, 0L, 0L, 39157UL },	// CAI_ACTDELAY_11
+	{ 0, 0, 32, 0L, 0L, 0L, 39189UL },	// CAI_CONFIG___11
+	{ 0, 0, 32, 0L, 0L, 0L, 39221UL },	// CAI_CONF_DO__11
+	{ 0, 0, 32, 0L, 0L, 0L, 39253UL },	// CAI_SC_LEVEL_12
+	{ 0, 0, 32, 0L, 0L, 0L, 39285UL },	// CAI_ALA_ENAB_12
+	{ 0, 0, 32, 0L, 0L, 0L, 39317UL },	// CAI_LIMITVAL_12
+	{ 0, 0, 32, 0L, 0L, 0L, 39349UL },	// CAI_DEL_TIME_12
+	{ 0, 0, 32, 0L, 0L, 0L, 39381UL },	// CAI_REC_TIME_12
+	{ 0, 0, 32, 0L, 0L, 0L, 39413UL },	// CAI_ACTDELAY_12
+	{ 0, 0, 32, 0L, 0L, 0L, 39445UL },	// CAI_CONFIG___12
+	{ 0, 0, 32, 0L, 0L, 0L, 39477UL },	// CAI_CONF_DO__12
+	{ 0, 0, 32, 0L, 0L, 0L, 39509UL },	// CAI_SC_LEVEL_13
+	{ 0, 0, 32, 0L, 0L, 0L, 39541UL },	// CAI_ALA_ENAB_13
+	{ 0, 0, 32, 0L, 0L, 0L, 39573UL },	// CAI_LIMITVAL_13
+	{ 0, 0, 32, 0L, 0L, 0L, 39605UL },	// CAI_DEL_TIME_13
+	{ 0, 0, 32, 0L, 0L, 0L, 39637UL },	// CAI_REC_TIME_13
+	{ 0, 0, 32, 0L, 0L, 0L, 39669UL },	// CAI_ACTDELAY_13
+	{ 0, 0, 32, 0L, 0L, 0L, 39701UL },	// CAI_CONFIG___13
+	{ 0, 0, 32, 0L, 0L, 0L, 39733UL },	// CAI_CONF_DO__13
+	{ 0, 0, 32, 0L, 0L, 0L, 39765UL },	// CAI_SC_LEVEL_14
+	{ 0, 0, 32, 0L, 0L, 0L, 39797UL },	// CAI_ALA_ENAB_14
+	{ 0, 0, 32, 0L, 0L, 0L, 39829UL },	// CAI_LIMITVAL_14
+	{ 0, 0, 32, 0L, 0L, 0L, 39861UL },	// CAI_DEL_TIME_14
+	{ 0, 0, 32, 0L, 0L, 0L, 39893UL },	// CAI_REC_TIME_14
+	{ 0, 0, 32, 0L, 0L, 0L, 39925UL },	// CAI_ACTDELAY_14
+	{ 0, 0, 32, 0L, 0L, 0L, 39957UL },	// CAI_CONFIG___14
+	{ 0, 0, 32, 0L, 0L, 0L, 39989UL },	// CAI_CONF_DO__14
+	{ 0, 0, 32, 0L, 0L, 0L, 40021UL },	// CAI_SC_LEVEL_15
+	{ 0, 0, 32, 0L, 0L, 0L, 40053UL },	// CAI_ALA_ENAB_15
+	{ 0, 0, 32, 0L, 0L, 0L, 40085UL },	// CAI_LIMITVAL_15
+	{ 0, 0, 32, 0L, 0L, 0L, 40117UL },	// CAI_DEL_TIME_15
+	{ 0, 0, 32, 0L, 0L, 0L, 40149UL },	// CAI_REC_TIME_15
+	{ 0, 0, 32, 0L, 0L, 0L, 40181UL },	// CAI_ACTDELAY_15
+	{ 0, 0, 32, 0L, 0L, 0L, 40213UL },	// CAI_CONFIG___15
+	{ 0, 0, 32, 0L, 0L, 0L, 40245UL },	// CAI_CONF_DO__15
+	{ 0, 0, 32, 0L, 0L, 0L, 40277UL },	// CAI_SC_LEVEL_16
+	{ 0, 0, 32, 0L, 0L, 0L, 40309UL },	// CAI_ALA_ENAB_16
+	{ 0, 0, 32, 0L, 0L, 0L, 40341UL },	// CAI_LIMITVAL_16
+	{ 0, 0, 32, 0L, 0L, 0L, 40373UL },	// CAI_DEL_TIME_16
+	{ 0, 0, 32, 0L, 0L, 0L, 40405UL },	// CAI_REC_TIME_16
+	{ 0, 0, 32, 0L, 0L, 0L, 40437UL },	// CAI_ACTDELAY_16
+	{ 0, 0, 32, 0L, 0L, 0L, 40469UL },	// CAI_CONFIG___16
+	{ 0, 0, 32, 0L, 0L, 0L, 40501UL },	// CAI_CONF_DO__16
+	{ 0, 0, 32, 0L, 0L, 0L, 40533UL },	// CAI_SC_LEVEL_17
+	{ 0, 0, 32, 0L, 0L, 0L, 40565UL },	// CAI_ALA_ENAB_17
+	{ 0, 0, 32, 0L, 0L, 0L, 40597UL },	// CAI_LIMITVAL_17
+	{ 0, 0, 32, 0L, 0L, 0L, 40629UL },	// CAI_DEL_TIME_17
+	{ 0, 0, 32, 0L, 0L, 0L, 40661UL },	// CAI_REC_TIME_17
+	{ 0, 0, 32, 0L, 0L, 0L, 40693UL },	// CAI_ACTDELAY_17
+	{ 0, 0, 32, 0L, 0L, 0L, 40725UL },	// CAI_CONFIG___17
+	{ 0, 0, 32, 0L, 0L, 0L, 40757UL },	// CAI_CONF_DO__17
+	{ 0, 0, 32, 0L, 0L, 0L, 40789UL },	// CAI_SC_LEVEL_18
+	{ 0, 0, 32, 0L, 0L, 0L, 40821UL },	// CAI_ALA_ENAB_18
+	{ 0, 0, 32, 0L, 0L, 0L, 40853UL },	// CAI_LIMITVAL_18
+	{ 0, 0, 32, 0L, 0L, 0L, 40885UL },	// CAI_DEL_TIME_18
+	{ 0, 0, 32, 0L, 0L, 0L, 40917UL },	// CAI_REC_TIME_18
+	{ 0, 0, 32, 0L, 0L, 0L, 40949UL },	// CAI_ACTDELAY_18
+	{ 0, 0, 32, 0L, 0L, 0L, 40981UL },	// CAI_CONFIG___18
+	{ 0, 0, 32, 0L, 0L, 0L, 41013UL },	// CAI_CONF_DO__18
+	{ 0, 0, 32, 0L, 0L, 0L, 41045UL },	// CAI_SC_LEVEL_19
+	{ 0, 0, 32, 0L, 0L, 0L, 41077UL },	// CAI_ALA_ENAB_19
+	{ 0, 0, 32, 0L, 0L, 0L, 41109UL },	// CAI_LIMITVAL_19
+	{ 0, 0, 32, 0L, 0L, 0L, 41141UL },	// CAI_DEL_TIME_19
+	{ 0, 0, 32, 0L, 0L, 0L, 41173UL },	// CAI_REC_TIME_19
+	{ 0, 0, 32, 0L, 0L, 0L, 41205UL },	// CAI_ACTDELAY_19
+	{ 0, 0, 32, 0L, 0L, 0L, 41237UL },	// CAI_CONFIG___19
+	{ 0, 0, 32, 0L, 0L, 0L, 41269UL },	// CAI_CONF_DO__19
+	{ 0, 0, 32, 0L, 0L, 0L, 41301UL },	// CAI_SC_LEVEL_20
+	{ 0, 0, 32, 0L, 0L, 0L, 41333UL },	// CAI_ALA_ENAB_20
+	{ 0, 0, 32, 0L, 0L, 0L, 41365UL },	// CAI_LIMITVAL_20
+	{ 0, 0, 32, 0L, 0L, 0L, 41397UL },	// CAI_DEL_TIME_20
+	{ 0, 0, 32, 0L, 0L, 0L, 41429UL },	// CAI_REC_TIME_20
+	{ 0, 0, 32, 0L, 0L, 0L, 41461UL },	// CAI_ACTDELAY_20
+	{ 0, 0, 32, 0L, 0L, 0L, 41493UL },	// CAI_CONFIG___20
+	{ 0, 0, 32, 0L, 0L, 0L, 41525UL },	// CAI_CONF_DO__20
+	{ 0, 0, 32, 0L, 0L, 0L, 41557UL },	// CAI_SC_LEVEL_21
+	{ 0, 0, 32, 0L, 0L, 0L, 41589UL },	// CAI_ALA_ENAB_21
+	{ 0, 0, 32, 0L, 0L, 0L, 41621UL },	// CAI_LIMITVAL_21
+	{ 0, 0, 32, 0L, 0L, 0L, 41653UL },	// CAI_DEL_TIME_21
+	{ 0, 0, 32, 0L, 0L, 0L, 41685UL },	// CAI_REC_TIME_21
+	{ 0, 0, 32, 0L, 0L, 0L, 41717UL },	// CAI_ACTDELAY_21
+	{ 0, 0, 32, 0L, 0L, 0L, 41749UL },	// CAI_CONFIG___21
+	{ 0, 0, 32, 0L, 0L, 0L, 41781UL },	// CAI_CONF_DO__21
+	{ 0, 0, 32, 0L, 0L, 0L, 41813UL },	// CAI_SC_LEVEL_22
+	{ 0, 0, 32, 0L, 0L, 0L, 41845UL },	// CAI_ALA_ENAB_22
+	{ 0, 0, 32, 0L, 0L, 0L, 41877UL },	// CAI_LIMITVAL_22
+	{ 0, 0, 32, 0L, 0L, 0L, 41909UL },	// CAI_DEL_TIME_22
+	{ 0, 0, 32, 0L, 0L, 0L, 41941UL },	// CAI_REC_TIME_22
+	{ 0, 0, 32, 0L, 0L, 0L, 41973UL },	// CAI_ACTDELAY_22
+	{ 0, 0, 32, 0L, 0L, 0L, 42005UL },	// CAI_CONFIG___22
+	{ 0, 0, 32, 0L, 0L, 0L, 42037UL },	// CAI_CONF_DO__22
+	{ 0, 0, 32, 0L, 0L, 0L, 42069UL },	// CAI_SC_LEVEL_23
+	{ 0, 0, 32, 0L, 0L, 0L, 42101UL },	// CAI_ALA_ENAB_23
+	{ 0, 0, 32, 0L, 0L, 0L, 42133UL },	// CAI_LIMITVAL_23
+	{ 0, 0, 32, 0L, 0L, 0L, 42165UL },	// CAI_DEL_TIME_23
+	{ 0, 0, 32, 0L, 0L, 0L, 42197UL },	// CAI_REC_TIME_23
+	{ 0, 0, 32, 0L, 0L, 0L, 42229UL },	// CAI_ACTDELAY_23
+	{ 0, 0, 32, 0L, 0L, 0L, 42261UL },	// CAI_CONFIG___23
+	{ 0, 0, 32, 0L, 0L, 0L, 42293UL },	// CAI_CONF_DO__23
+	{ 0, 0, 32, 0L, 0L, 0L, 42325UL },	// CAI_SC_LEVEL_24
+	{ 0, 0, 32, 0L, 0L, 0L, 42357UL },	// CAI_ALA_ENAB_24
+	{ 0, 0, 32, 0L, 0L, 0L, 42389UL },	// CAI_LIMITVAL_24
+	{ 0, 0, 32, 0L, 0L, 0L, 42421UL },	// CAI_DEL_TIME_24
+	{ 0, 0, 32, 0L, 0L, 0L, 42453UL },	// CAI_REC_TIME_24
+	{ 0, 0, 32, 0L, 0L, 0L, 42485UL },	// CAI_ACTDELAY_24
+	{ 0, 0, 32, 0L, 0L, 0L, 42517UL },	// CAI_CONFIG___24
+	{ 0, 0, 32, 0L, 0L, 0L, 42549UL },	// CAI_CONF_DO__24
+	{ 0, 0, 32, 0L, 0L, 0L, 42581UL },	// CAI_SC_LEVEL_1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 42613UL },	// CAI_ALA_ENAB_1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 42645UL },	// CAI_LIMITVAL_1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 42677UL },	// CAI_DEL_TIME_1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 42709UL },	// CAI_REC_TIME_1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 42741UL },	// CAI_ACTDELAY_1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 42773UL },	// CAI_CONFIG___1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 42805UL },	// CAI_CONF_DO__1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 42837UL },	// CAI_SC_LEVEL_2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 42869UL },	// CAI_ALA_ENAB_2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 42901UL },	// CAI_LIMITVAL_2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 42933UL },	// CAI_DEL_TIME_2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 42965UL },	// CAI_REC_TIME_2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 42997UL },	// CAI_ACTDELAY_2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43029UL },	// CAI_CONFIG___2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43061UL },	// CAI_CONF_DO__2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43093UL },	// CAI_SC_LEVEL_3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43125UL },	// CAI_ALA_ENAB_3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43157UL },	// CAI_LIMITVAL_3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43189UL },	// CAI_DEL_TIME_3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43221UL },	// CAI_REC_TIME_3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43253UL },	// CAI_ACTDELAY_3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43285UL },	// CAI_CONFIG___3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43317UL },	// CAI_CONF_DO__3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43349UL },	// CAI_SC_LEVEL_4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43381UL },	// CAI_ALA_ENAB_4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43413UL },	// CAI_LIMITVAL_4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43445UL },	// CAI_DEL_TIME_4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43477UL },	// CAI_REC_TIME_4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43509UL },	// CAI_ACTDELAY_4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43541UL },	// CAI_CONFIG___4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43573UL },	// CAI_CONF_DO__4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43605UL },	// CAI_SC_LEVEL_5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43637UL },	// CAI_ALA_ENAB_5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43669UL },	// CAI_LIMITVAL_5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43701UL },	// CAI_DEL_TIME_5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43733UL },	// CAI_REC_TIME_5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43765UL },	// CAI_ACTDELAY_5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43797UL },	// CAI_CONFIG___5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43829UL },	// CAI_CONF_DO__5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43861UL },	// CAI_SC_LEVEL_6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43893UL },	// CAI_ALA_ENAB_6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43925UL },	// CAI_LIMITVAL_6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43957UL },	// CAI_DEL_TIME_6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 43989UL },	// CAI_REC_TIME_6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44021UL },	// CAI_ACTDELAY_6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44053UL },	// CAI_CONFIG___6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44085UL },	// CAI_CONF_DO__6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44117UL },	// CAI_SC_LEVEL_7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44149UL },	// CAI_ALA_ENAB_7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44181UL },	// CAI_LIMITVAL_7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44213UL },	// CAI_DEL_TIME_7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44245UL },	// CAI_REC_TIME_7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44277UL },	// CAI_ACTDELAY_7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44309UL },	// CAI_CONFIG___7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44341UL },	// CAI_CONF_DO__7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44373UL },	// CAI_SC_LEVEL_8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44405UL },	// CAI_ALA_ENAB_8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44437UL },	// CAI_LIMITVAL_8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44469UL },	// CAI_DEL_TIME_8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44501UL },	// CAI_REC_TIME_8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44533UL },	// CAI_ACTDELAY_8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44565UL },	// CAI_CONFIG___8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44597UL },	// CAI_CONF_DO__8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44629UL },	// CAI_SC_LEVEL_9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44661UL },	// CAI_ALA_ENAB_9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44693UL },	// CAI_LIMITVAL_9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44725UL },	// CAI_DEL_TIME_9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44757UL },	// CAI_REC_TIME_9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44789UL },	// CAI_ACTDELAY_9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44821UL },	// CAI_CONFIG___9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44853UL },	// CAI_CONF_DO__9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44885UL },	// CAI_SC_LEVEL_10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44917UL },	// CAI_ALA_ENAB_10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44949UL },	// CAI_LIMITVAL_10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 44981UL },	// CAI_DEL_TIME_10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45013UL },	// CAI_REC_TIME_10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45045UL },	// CAI_ACTDELAY_10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45077UL },	// CAI_CONFIG___10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45109UL },	// CAI_CONF_DO__10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45141UL },	// CAI_SC_LEVEL_11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45173UL },	// CAI_ALA_ENAB_11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45205UL },	// CAI_LIMITVAL_11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45237UL },	// CAI_DEL_TIME_11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45269UL },	// CAI_REC_TIME_11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45301UL },	// CAI_ACTDELAY_11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45333UL },	// CAI_CONFIG___11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45365UL },	// CAI_CONF_DO__11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45397UL },	// CAI_SC_LEVEL_12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45429UL },	// CAI_ALA_ENAB_12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45461UL },	// CAI_LIMITVAL_12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45493UL },	// CAI_DEL_TIME_12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45525UL },	// CAI_REC_TIME_12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45557UL },	// CAI_ACTDELAY_12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45589UL },	// CAI_CONFIG___12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45621UL },	// CAI_CONF_DO__12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45653UL },	// CAI_SC_LEVEL_13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45685UL },	// CAI_ALA_ENAB_13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45717UL },	// CAI_LIMITVAL_13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45749UL },	// CAI_DEL_TIME_13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45781UL },	// CAI_REC_TIME_13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45813UL },	// CAI_ACTDELAY_13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45845UL },	// CAI_CONFIG___13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45877UL },	// CAI_CONF_DO__13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45909UL },	// CAI_SC_LEVEL_14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45941UL },	// CAI_ALA_ENAB_14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 45973UL },	// CAI_LIMITVAL_14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46005UL },	// CAI_DEL_TIME_14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46037UL },	// CAI_REC_TIME_14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46069UL },	// CAI_ACTDELAY_14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46101UL },	// CAI_CONFIG___14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46133UL },	// CAI_CONF_DO__14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46165UL },	// CAI_SC_LEVEL_15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46197UL },	// CAI_ALA_ENAB_15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46229UL },	// CAI_LIMITVAL_15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46261UL },	// CAI_DEL_TIME_15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46293UL },	// CAI_REC_TIME_15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46325UL },	// CAI_ACTDELAY_15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46357UL },	// CAI_CONFIG___15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46389UL },	// CAI_CONF_DO__15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46421UL },	// CAI_SC_LEVEL_16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46453UL },	// CAI_ALA_ENAB_16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46485UL },	// CAI_LIMITVAL_16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46517UL },	// CAI_DEL_TIME_16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46549UL },	// CAI_REC_TIME_16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46581UL },	// CAI_ACTDELAY_16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46613UL },	// CAI_CONFIG___16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46645UL },	// CAI_CONF_DO__16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46677UL },	// CAI_SC_LEVEL_17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46709UL },	// CAI_ALA_ENAB_17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46741UL },	// CAI_LIMITVAL_17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46773UL },	// CAI_DEL_TIME_17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46805UL },	// CAI_REC_TIME_17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46837UL },	// CAI_ACTDELAY_17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46869UL },	// CAI_CONFIG___17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46901UL },	// CAI_CONF_DO__17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46933UL },	// CAI_SC_LEVEL_18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46965UL },	// CAI_ALA_ENAB_18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 46997UL },	// CAI_LIMITVAL_18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47029UL },	// CAI_DEL_TIME_18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47061UL },	// CAI_REC_TIME_18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47093UL },	// CAI_ACTDELAY_18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47125UL },	// CAI_CONFIG___18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47157UL },	// CAI_CONF_DO__18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47189UL },	// CAI_SC_LEVEL_19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47221UL },	// CAI_ALA_ENAB_19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47253UL },	// CAI_LIMITVAL_19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47285UL },	// CAI_DEL_TIME_19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47317UL },	// CAI_REC_TIME_19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47349UL },	// CAI_ACTDELAY_19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47381UL },	// CAI_CONFIG___19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47413UL },	// CAI_CONF_DO__19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47445UL },	// CAI_SC_LEVEL_20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47477UL },	// CAI_ALA_ENAB_20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47509UL },	// CAI_LIMITVAL_20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47541UL },	// CAI_DEL_TIME_20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47573UL },	// CAI_REC_TIME_20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47605UL },	// CAI_ACTDELAY_20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47637UL },	// CAI_CONFIG___20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47669UL },	// CAI_CONF_DO__20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47701UL },	// CAI_SC_LEVEL_21_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47733UL },	// CAI_ALA_ENAB_21_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47765UL },	// CAI_LIMITVAL_21_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47797UL },	// CAI_DEL_TIME_21_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47829UL },	// CAI_REC_TIME_21_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47861UL },	// CAI_ACTDELAY_21_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47893UL },	// CAI_CONFIG___21_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47925UL },	// CAI_CONF_DO__21_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47957UL },	// CAI_SC_LEVEL_22_2
+	{ 0, 0, 32, 0L, 0L, 0L, 47989UL },	// CAI_ALA_ENAB_22_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48021UL },	// CAI_LIMITVAL_22_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48053UL },	// CAI_DEL_TIME_22_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48085UL },	// CAI_REC_TIME_22_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48117UL },	// CAI_ACTDELAY_22_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48149UL },	// CAI_CONFIG___22_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48181UL },	// CAI_CONF_DO__22_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48213UL },	// CAI_SC_LEVEL_23_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48245UL },	// CAI_ALA_ENAB_23_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48277UL },	// CAI_LIMITVAL_23_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48309UL },	// CAI_DEL_TIME_23_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48341UL },	// CAI_REC_TIME_23_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48373UL },	// CAI_ACTDELAY_23_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48405UL },	// CAI_CONFIG___23_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48437UL },	// CAI_CONF_DO__23_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48469UL },	// CAI_SC_LEVEL_24_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48501UL },	// CAI_ALA_ENAB_24_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48533UL },	// CAI_LIMITVAL_24_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48565UL },	// CAI_DEL_TIME_24_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48597UL },	// CAI_REC_TIME_24_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48629UL },	// CAI_ACTDELAY_24_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48661UL },	// CAI_CONFIG___24_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48693UL },	// CAI_CONF_DO__24_2
+	{ 0, 0, 32, 0L, 0L, 0L, 48725UL },	// CAI_SC_LEVEL_1_3
+	{ 0, 0, 32, 0L, 0L, 0L, 48757UL },	// CAI_ALA_ENAB_1_3
+	{ 0, 0, 32, 0L, 0L, 0L, 48789UL },	// CAI_LIMITVAL_1_3
+	{ 0, 0, 32, 0L, 0L, 0L, 48821UL },	// CAI_DEL_TIME_1_3
+	{ 0, 0, 32, 0L, 0L, 0L, 48853UL },	// CAI_REC_TIME_1_3
+	{ 0, 0, 32, 0L, 0L, 0L, 48885UL },	// CAI_ACTDELAY_1_3
+	{ 0, 0, 32, 0L, 0L, 0L, 48917UL },	// CAI_CONFIG___1_3
+	{ 0, 0, 32, 0L, 0L, 0L, 48949UL },	// CAI_CONF_DO__1_3
+	{ 0, 0, 32, 0L, 0L, 0L, 48981UL },	// CAI_SC_LEVEL_2_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49013UL },	// CAI_ALA_ENAB_2_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49045UL },	// CAI_LIMITVAL_2_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49077UL },	// CAI_DEL_TIME_2_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49109UL },	// CAI_REC_TIME_2_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49141UL },	// CAI_ACTDELAY_2_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49173UL },	// CAI_CONFIG___2_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49205UL },	// CAI_CONF_DO__2_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49237UL },	// CAI_SC_LEVEL_3_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49269UL },	// CAI_ALA_ENAB_3_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49301UL },	// CAI_LIMITVAL_3_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49333UL },	// CAI_DEL_TIME_3_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49365UL },	// CAI_REC_TIME_3_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49397UL },	// CAI_ACTDELAY_3_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49429UL },	// CAI_CONFIG___3_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49461UL },	// CAI_CONF_DO__3_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49493UL },	// CAI_SC_LEVEL_4_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49525UL },	// CAI_ALA_ENAB_4_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49557UL },	// CAI_LIMITVAL_4_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49589UL },	// CAI_DEL_TIME_4_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49621UL },	// CAI_REC_TIME_4_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49653UL },	// CAI_ACTDELAY_4_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49685UL },	// CAI_CONFIG___4_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49717UL },	// CAI_CONF_DO__4_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49749UL },	// CAI_SC_LEVEL_5_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49781UL },	// CAI_ALA_ENAB_5_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49813UL },	// CAI_LIMITVAL_5_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49845UL },	// CAI_DEL_TIME_5_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49877UL },	// CAI_REC_TIME_5_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49909UL },	// CAI_ACTDELAY_5_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49941UL },	// CAI_CONFIG___5_3
+	{ 0, 0, 32, 0L, 0L, 0L, 49973UL },	// CAI_CONF_DO__5_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50005UL },	// CAI_SC_LEVEL_6_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50037UL },	// CAI_ALA_ENAB_6_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50069UL },	// CAI_LIMITVAL_6_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50101UL },	// CAI_DEL_TIME_6_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50133UL },	// CAI_REC_TIME_6_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50165UL },	// CAI_ACTDELAY_6_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50197UL },	// CAI_CONFIG___6_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50229UL },	// CAI_CONF_DO__6_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50261UL },	// CAI_SC_LEVEL_7_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50293UL },	// CAI_ALA_ENAB_7_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50325UL },	// CAI_LIMITVAL_7_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50357UL },	// CAI_DEL_TIME_7_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50389UL },	// CAI_REC_TIME_7_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50421UL },	// CAI_ACTDELAY_7_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50453UL },	// CAI_CONFIG___7_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50485UL },	// CAI_CONF_DO__7_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50517UL },	// CAI_SC_LEVEL_8_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50549UL },	// CAI_ALA_ENAB_8_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50581UL },	// CAI_LIMITVAL_8_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50613UL },	// CAI_DEL_TIME_8_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50645UL },	// CAI_REC_TIME_8_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50677UL },	// CAI_ACTDELAY_8_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50709UL },	// CAI_CONFIG___8_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50741UL },	// CAI_CONF_DO__8_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50773UL },	// CAI_SC_LEVEL_9_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50805UL },	// CAI_ALA_ENAB_9_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50837UL },	// CAI_LIMITVAL_9_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50869UL },	// CAI_DEL_TIME_9_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50901UL },	// CAI_REC_TIME_9_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50933UL },	// CAI_ACTDELAY_9_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50965UL },	// CAI_CONFIG___9_3
+	{ 0, 0, 32, 0L, 0L, 0L, 50997UL },	// CAI_CONF_DO__9_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51029UL },	// CAI_SC_LEVEL_10_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51061UL },	// CAI_ALA_ENAB_10_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51093UL },	// CAI_LIMITVAL_10_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51125UL },	// CAI_DEL_TIME_10_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51157UL },	// CAI_REC_TIME_10_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51189UL },	// CAI_ACTDELAY_10_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51221UL },	// CAI_CONFIG___10_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51253UL },	// CAI_CONF_DO__10_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51285UL },	// CAI_SC_LEVEL_11_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51317UL },	// CAI_ALA_ENAB_11_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51349UL },	// CAI_LIMITVAL_11_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51381UL },	// CAI_DEL_TIME_11_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51413UL },	// CAI_REC_TIME_11_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51445UL },	// CAI_ACTDELAY_11_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51477UL },	// CAI_CONFIG___11_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51509UL },	// CAI_CONF_DO__11_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51541UL },	// CAI_SC_LEVEL_12_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51573UL },	// CAI_ALA_ENAB_12_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51605UL },	// CAI_LIMITVAL_12_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51637UL },	// CAI_DEL_TIME_12_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51669UL },	// CAI_REC_TIME_12_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51701UL },	// CAI_ACTDELAY_12_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51733UL },	// CAI_CONFIG___12_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51765UL },	// CAI_CONF_DO__12_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51797UL },	// CAI_SC_LEVEL_13_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51829UL },	// CAI_ALA_ENAB_13_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51861UL },	// CAI_LIMITVAL_13_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51893UL },	// CAI_DEL_TIME_13_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51925UL },	// CAI_REC_TIME_13_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51957UL },	// CAI_ACTDELAY_13_3
+	{ 0, 0, 32, 0L, 0L, 0L, 51989UL },	// CAI_CONFIG___13_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52021UL },	// CAI_CONF_DO__13_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52053UL },	// CAI_SC_LEVEL_14_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52085UL },	// CAI_ALA_ENAB_14_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52117UL },	// CAI_LIMITVAL_14_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52149UL },	// CAI_DEL_TIME_14_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52181UL },	// CAI_REC_TIME_14_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52213UL },	// CAI_ACTDELAY_14_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52245UL },	// CAI_CONFIG___14_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52277UL },	// CAI_CONF_DO__14_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52309UL },	// CAI_SC_LEVEL_15_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52341UL },	// CAI_ALA_ENAB_15_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52373UL },	// CAI_LIMITVAL_15_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52405UL },	// CAI_DEL_TIME_15_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52437UL },	// CAI_REC_TIME_15_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52469UL },	// CAI_ACTDELAY_15_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52501UL },	// CAI_CONFIG___15_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52533UL },	// CAI_CONF_DO__15_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52565UL },	// CAI_SC_LEVEL_16_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52597UL },	// CAI_ALA_ENAB_16_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52629UL },	// CAI_LIMITVAL_16_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52661UL },	// CAI_DEL_TIME_16_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52693UL },	// CAI_REC_TIME_16_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52725UL },	// CAI_ACTDELAY_16_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52757UL },	// CAI_CONFIG___16_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52789UL },	// CAI_CONF_DO__16_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52821UL },	// CAI_SC_LEVEL_17_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52853UL },	// CAI_ALA_ENAB_17_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52885UL },	// CAI_LIMITVAL_17_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52917UL },	// CAI_DEL_TIME_17_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52949UL },	// CAI_REC_TIME_17_3
+	{ 0, 0, 32, 0L, 0L, 0L, 52981UL },	// CAI_ACTDELAY_17_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53013UL },	// CAI_CONFIG___17_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53045UL },	// CAI_CONF_DO__17_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53077UL },	// CAI_SC_LEVEL_18_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53109UL },	// CAI_ALA_ENAB_18_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53141UL },	// CAI_LIMITVAL_18_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53173UL },	// CAI_DEL_TIME_18_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53205UL },	// CAI_REC_TIME_18_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53237UL },	// CAI_ACTDELAY_18_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53269UL },	// CAI_CONFIG___18_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53301UL },	// CAI_CONF_DO__18_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53333UL },	// CAI_SC_LEVEL_19_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53365UL },	// CAI_ALA_ENAB_19_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53397UL },	// CAI_LIMITVAL_19_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53429UL },	// CAI_DEL_TIME_19_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53461UL },	// CAI_REC_TIME_19_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53493UL },	// CAI_ACTDELAY_19_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53525UL },	// CAI_CONFIG___19_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53557UL },	// CAI_CONF_DO__19_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53589UL },	// CAI_SC_LEVEL_20_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53621UL },	// CAI_ALA_ENAB_20_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53653UL },	// CAI_LIMITVAL_20_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53685UL },	// CAI_DEL_TIME_20_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53717UL },	// CAI_REC_TIME_20_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53749UL },	// CAI_ACTDELAY_20_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53781UL },	// CAI_CONFIG___20_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53813UL },	// CAI_CONF_DO__20_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53845UL },	// CAI_SC_LEVEL_21_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53877UL },	// CAI_ALA_ENAB_21_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53909UL },	// CAI_LIMITVAL_21_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53941UL },	// CAI_DEL_TIME_21_3
+	{ 0, 0, 32, 0L, 0L, 0L, 53973UL },	// CAI_REC_TIME_21_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54005UL },	// CAI_ACTDELAY_21_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54037UL },	// CAI_CONFIG___21_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54069UL },	// CAI_CONF_DO__21_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54101UL },	// CAI_SC_LEVEL_22_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54133UL },	// CAI_ALA_ENAB_22_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54165UL },	// CAI_LIMITVAL_22_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54197UL },	// CAI_DEL_TIME_22_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54229UL },	// CAI_REC_TIME_22_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54261UL },	// CAI_ACTDELAY_22_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54293UL },	// CAI_CONFIG___22_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54325UL },	// CAI_CONF_DO__22_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54357UL },	// CAI_SC_LEVEL_23_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54389UL },	// CAI_ALA_ENAB_23_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54421UL },	// CAI_LIMITVAL_23_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54453UL },	// CAI_DEL_TIME_23_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54485UL },	// CAI_REC_TIME_23_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54517UL },	// CAI_ACTDELAY_23_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54549UL },	// CAI_CONFIG___23_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54581UL },	// CAI_CONF_DO__23_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54613UL },	// CAI_SC_LEVEL_24_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54645UL },	// CAI_ALA_ENAB_24_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54677UL },	// CAI_LIMITVAL_24_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54709UL },	// CAI_DEL_TIME_24_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54741UL },	// CAI_REC_TIME_24_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54773UL },	// CAI_ACTDELAY_24_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54805UL },	// CAI_CONFIG___24_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54837UL },	// CAI_CONF_DO__24_3
+	{ 0, 0, 32, 0L, 0L, 0L, 54869UL },	// CAI_SC_LEVEL_1_4
+	{ 0, 0, 32, 0L, 0L, 0L, 54901UL },	// CAI_ALA_ENAB_1_4
+	{ 0, 0, 32, 0L, 0L, 0L, 54933UL },	// CAI_LIMITVAL_1_4
+	{ 0, 0, 32, 0L, 0L, 0L, 54965UL },	// CAI_DEL_TIME_1_4
+	{ 0, 0, 32, 0L, 0L, 0L, 54997UL },	// CAI_REC_TIME_1_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55029UL },	// CAI_ACTDELAY_1_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55061UL },	// CAI_CONFIG___1_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55093UL },	// CAI_CONF_DO__1_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55125UL },	// CAI_SC_LEVEL_2_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55157UL },	// CAI_ALA_ENAB_2_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55189UL },	// CAI_LIMITVAL_2_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55221UL },	// CAI_DEL_TIME_2_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55253UL },	// CAI_REC_TIME_2_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55285UL },	// CAI_ACTDELAY_2_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55317UL },	// CAI_CONFIG___2_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55349UL },	// CAI_CONF_DO__2_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55381UL },	// CAI_SC_LEVEL_3_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55413UL },	// CAI_ALA_ENAB_3_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55445UL },	// CAI_LIMITVAL_3_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55477UL },	// CAI_DEL_TIME_3_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55509UL },	// CAI_REC_TIME_3_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55541UL },	// CAI_ACTDELAY_3_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55573UL },	// CAI_CONFIG___3_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55605UL },	// CAI_CONF_DO__3_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55637UL },	// CAI_SC_LEVEL_4_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55669UL },	// CAI_ALA_ENAB_4_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55701UL },	// CAI_LIMITVAL_4_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55733UL },	// CAI_DEL_TIME_4_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55765UL },	// CAI_REC_TIME_4_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55797UL },	// CAI_ACTDELAY_4_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55829UL },	// CAI_CONFIG___4_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55861UL },	// CAI_CONF_DO__4_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55893UL },	// CAI_SC_LEVEL_5_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55925UL },	// CAI_ALA_ENAB_5_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55957UL },	// CAI_LIMITVAL_5_4
+	{ 0, 0, 32, 0L, 0L, 0L, 55989UL },	// CAI_DEL_TIME_5_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56021UL },	// CAI_REC_TIME_5_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56053UL },	// CAI_ACTDELAY_5_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56085UL },	// CAI_CONFIG___5_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56117UL },	// CAI_CONF_DO__5_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56149UL },	// CAI_SC_LEVEL_6_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56181UL },	// CAI_ALA_ENAB_6_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56213UL },	// CAI_LIMITVAL_6_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56245UL },	// CAI_DEL_TIME_6_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56277UL },	// CAI_REC_TIME_6_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56309UL },	// CAI_ACTDELAY_6_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56341UL },	// CAI_CONFIG___6_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56373UL },	// CAI_CONF_DO__6_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56405UL },	// CAI_SC_LEVEL_7_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56437UL },	// CAI_ALA_ENAB_7_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56469UL },	// CAI_LIMITVAL_7_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56501UL },	// CAI_DEL_TIME_7_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56533UL },	// CAI_REC_TIME_7_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56565UL },	// CAI_ACTDELAY_7_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56597UL },	// CAI_CONFIG___7_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56629UL },	// CAI_CONF_DO__7_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56661UL },	// CAI_SC_LEVEL_8_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56693UL },	// CAI_ALA_ENAB_8_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56725UL },	// CAI_LIMITVAL_8_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56757UL },	// CAI_DEL_TIME_8_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56789UL },	// CAI_REC_TIME_8_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56821UL },	// CAI_ACTDELAY_8_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56853UL },	// CAI_CONFIG___8_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56885UL },	// CAI_CONF_DO__8_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56917UL },	// CAI_SC_LEVEL_9_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56949UL },	// CAI_ALA_ENAB_9_4
+	{ 0, 0, 32, 0L, 0L, 0L, 56981UL },	// CAI_LIMITVAL_9_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57013UL },	// CAI_DEL_TIME_9_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57045UL },	// CAI_REC_TIME_9_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57077UL },	// CAI_ACTDELAY_9_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57109UL },	// CAI_CONFIG___9_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57141UL },	// CAI_CONF_DO__9_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57173UL },	// CAI_SC_LEVEL_10_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57205UL },	// CAI_ALA_ENAB_10_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57237UL },	// CAI_LIMITVAL_10_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57269UL },	// CAI_DEL_TIME_10_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57301UL },	// CAI_REC_TIME_10_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57333UL },	// CAI_ACTDELAY_10_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57365UL },	// CAI_CONFIG___10_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57397UL },	// CAI_CONF_DO__10_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57429UL },	// CAI_SC_LEVEL_11_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57461UL },	// CAI_ALA_ENAB_11_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57493UL },	// CAI_LIMITVAL_11_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57525UL },	// CAI_DEL_TIME_11_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57557UL },	// CAI_REC_TIME_11_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57589UL },	// CAI_ACTDELAY_11_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57621UL },	// CAI_CONFIG___11_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57653UL },	// CAI_CONF_DO__11_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57685UL },	// CAI_SC_LEVEL_12_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57717UL },	// CAI_ALA_ENAB_12_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57749UL },	// CAI_LIMITVAL_12_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57781UL },	// CAI_DEL_TIME_12_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57813UL },	// CAI_REC_TIME_12_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57845UL },	// CAI_ACTDELAY_12_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57877UL },	// CAI_CONFIG___12_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57909UL },	// CAI_CONF_DO__12_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57941UL },	// CAI_SC_LEVEL_13_4
+	{ 0, 0, 32, 0L, 0L, 0L, 57973UL },	// CAI_ALA_ENAB_13_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58005UL },	// CAI_LIMITVAL_13_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58037UL },	// CAI_DEL_TIME_13_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58069UL },	// CAI_REC_TIME_13_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58101UL },	// CAI_ACTDELAY_13_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58133UL },	// CAI_CONFIG___13_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58165UL },	// CAI_CONF_DO__13_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58197UL },	// CAI_SC_LEVEL_14_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58229UL },	// CAI_ALA_ENAB_14_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58261UL },	// CAI_LIMITVAL_14_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58293UL },	// CAI_DEL_TIME_14_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58325UL },	// CAI_REC_TIME_14_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58357UL },	// CAI_ACTDELAY_14_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58389UL },	// CAI_CONFIG___14_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58421UL },	// CAI_CONF_DO__14_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58453UL },	// CAI_SC_LEVEL_15_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58485UL },	// CAI_ALA_ENAB_15_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58517UL },	// CAI_LIMITVAL_15_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58549UL },	// CAI_DEL_TIME_15_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58581UL },	// CAI_REC_TIME_15_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58613UL },	// CAI_ACTDELAY_15_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58645UL },	// CAI_CONFIG___15_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58677UL },	// CAI_CONF_DO__15_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58709UL },	// CAI_SC_LEVEL_16_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58741UL },	// CAI_ALA_ENAB_16_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58773UL },	// CAI_LIMITVAL_16_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58805UL },	// CAI_DEL_TIME_16_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58837UL },	// CAI_REC_TIME_16_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58869UL },	// CAI_ACTDELAY_16_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58901UL },	// CAI_CONFIG___16_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58933UL },	// CAI_CONF_DO__16_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58965UL },	// CAI_SC_LEVEL_17_4
+	{ 0, 0, 32, 0L, 0L, 0L, 58997UL },	// CAI_ALA_ENAB_17_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59029UL },	// CAI_LIMITVAL_17_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59061UL },	// CAI_DEL_TIME_17_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59093UL },	// CAI_REC_TIME_17_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59125UL },	// CAI_ACTDELAY_17_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59157UL },	// CAI_CONFIG___17_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59189UL },	// CAI_CONF_DO__17_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59221UL },	// CAI_SC_LEVEL_18_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59253UL },	// CAI_ALA_ENAB_18_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59285UL },	// CAI_LIMITVAL_18_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59317UL },	// CAI_DEL_TIME_18_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59349UL },	// CAI_REC_TIME_18_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59381UL },	// CAI_ACTDELAY_18_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59413UL },	// CAI_CONFIG___18_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59445UL },	// CAI_CONF_DO__18_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59477UL },	// CAI_SC_LEVEL_19_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59509UL },	// CAI_ALA_ENAB_19_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59541UL },	// CAI_LIMITVAL_19_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59573UL },	// CAI_DEL_TIME_19_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59605UL },	// CAI_REC_TIME_19_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59637UL },	// CAI_ACTDELAY_19_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59669UL },	// CAI_CONFIG___19_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59701UL },	// CAI_CONF_DO__19_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59733UL },	// CAI_SC_LEVEL_20_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59765UL },	// CAI_ALA_ENAB_20_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59797UL },	// CAI_LIMITVAL_20_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59829UL },	// CAI_DEL_TIME_20_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59861UL },	// CAI_REC_TIME_20_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59893UL },	// CAI_ACTDELAY_20_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59925UL },	// CAI_CONFIG___20_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59957UL },	// CAI_CONF_DO__20_4
+	{ 0, 0, 32, 0L, 0L, 0L, 59989UL },	// CAI_SC_LEVEL_21_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60021UL },	// CAI_ALA_ENAB_21_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60053UL },	// CAI_LIMITVAL_21_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60085UL },	// CAI_DEL_TIME_21_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60117UL },	// CAI_REC_TIME_21_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60149UL },	// CAI_ACTDELAY_21_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60181UL },	// CAI_CONFIG___21_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60213UL },	// CAI_CONF_DO__21_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60245UL },	// CAI_SC_LEVEL_22_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60277UL },	// CAI_ALA_ENAB_22_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60309UL },	// CAI_LIMITVAL_22_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60341UL },	// CAI_DEL_TIME_22_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60373UL },	// CAI_REC_TIME_22_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60405UL },	// CAI_ACTDELAY_22_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60437UL },	// CAI_CONFIG___22_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60469UL },	// CAI_CONF_DO__22_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60501UL },	// CAI_SC_LEVEL_23_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60533UL },	// CAI_ALA_ENAB_23_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60565UL },	// CAI_LIMITVAL_23_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60597UL },	// CAI_DEL_TIME_23_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60629UL },	// CAI_REC_TIME_23_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60661UL },	// CAI_ACTDELAY_23_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60693UL },	// CAI_CONFIG___23_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60725UL },	// CAI_CONF_DO__23_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60757UL },	// CAI_SC_LEVEL_24_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60789UL },	// CAI_ALA_ENAB_24_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60821UL },	// CAI_LIMITVAL_24_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60853UL },	// CAI_DEL_TIME_24_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60885UL },	// CAI_REC_TIME_24_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60917UL },	// CAI_ACTDELAY_24_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60949UL },	// CAI_CONFIG___24_4
+	{ 0, 0, 32, 0L, 0L, 0L, 60981UL },	// CAI_CONF_DO__24_4
+	{ 0, 0, 32, 0L, 0L, 0L, 61013UL },	// TMP_SENSOR_FAULT_DELAY_1
+	{ 0, 0, 32, 0L, 0L, 0L, 61045UL },	// TMP_SENSOR_FAULT_DELAY_2
+	{ 0, 0, 32, 0L, 0L, 0L, 61077UL },	// TMP_SENSOR_FAULT_DELAY_3
+	{ 0, 0, 32, 0L, 0L, 0L, 61109UL },	// TMP_SENSOR_FAULT_DELAY_4
+	{ 0, 0, 32, 0L, 0L, 0L, 61141UL },	// TMP_SENSOR_FAULT_DELAY_5
+	{ 0, 0, 32, 0L, 0L, 0L, 61173UL },	// TMP_SENSOR_FAULT_DELAY_6
+	{ 0, 0, 32, 0L, 0L, 0L, 61205UL },	// TMP_SENSOR_FAULT_DELAY_7
+	{ 0, 0, 32, 0L, 0L, 0L, 61237UL },	// TMP_SENSOR_FAULT_DELAY_8
+	{ 0, 0, 32, 0L, 0L, 0L, 61269UL },	// TMP_SENSOR_FAULT_DELAY_9
+	{ 0, 0, 32, 0L, 0L, 0L, 61301UL },	// TMP_SENSOR_FAULT_DELAY_10
+	{ 0, 0, 32, 0L, 0L, 0L, 61333UL },	// TMP_SENSOR_FAULT_DELAY_11
+	{ 0, 0, 32, 0L, 0L, 0L, 61365UL },	// TMP_SENSOR_FAULT_DELAY_12
+	{ 0, 0, 32, 0L, 0L, 0L, 61397UL },	// TMP_SENSOR_FAULT_DELAY_13
+	{ 0, 0, 32, 0L, 0L, 0L, 61429UL },	// TMP_SENSOR_FAULT_DELAY_14
+	{ 0, 0, 32, 0L, 0L, 0L, 61461UL },	// TMP_SENSOR_FAULT_DELAY_15
+	{ 0, 0, 32, 0L, 0L, 0L, 61493UL },	// TMP_SENSOR_FAULT_DELAY_16
+	{ 0, 0, 32, 0L, 0L, 0L, 61525UL },	// TMP_SENSOR_FAULT_DELAY_17
+	{ 0, 0, 32, 0L, 0L, 0L, 61557UL },	// TMP_SENSOR_FAULT_DELAY_18
+	{ 0, 0, 32, 0L, 0L, 0L, 61589UL },	// TMP_SENSOR_FAULT_DELAY_19
+	{ 0, 0, 32, 0L, 0L, 0L, 61621UL },	// TMP_SENSOR_FAULT_DELAY_20
+	{ 0, 0, 32, 0L, 0L, 0L, 61653UL },	// TMP_SC_LEVEL_1
+	{ 0, 0, 32, 0L, 0L, 0L, 61685UL },	// TMP_ALA_ENAB_1
+	{ 0, 0, 32, 0L, 0L, 0L, 61717UL },	// TMP_LIMITVAL_1
+	{ 0, 0, 32, 0L, 0L, 0L, 61749UL },	// TMP_DEL_TIME_1
+	{ 0, 0, 32, 0L, 0L, 0L, 61781UL },	// TMP_REC_TIME_1
+	{ 0, 0, 32, 0L, 0L, 0L, 61813UL },	// TMP_ACTDELAY_1
+	{ 0, 0, 32, 0L, 0L, 0L, 61845UL },	// TMP_CONFIG___1
+	{ 0, 0, 32, 0L, 0L, 0L, 61877UL },	// TMP_CONF_DO__1
+	{ 0, 0, 32, 0L, 0L, 0L, 61909UL },	// TMP_SC_LEVEL_2
+	{ 0, 0, 32, 0L, 0L, 0L, 61941UL },	// TMP_ALA_ENAB_2
+	{ 0, 0, 32, 0L, 0L, 0L, 61973UL },	// TMP_LIMITVAL_2
+	{ 0, 0, 32, 0L, 0L, 0L, 62005UL },	// TMP_DEL_TIME_2
+	{ 0, 0, 32, 0L, 0L, 0L, 62037UL },	// TMP_REC_TIME_2
+	{ 0, 0, 32, 0L, 0L, 0L, 62069UL },	// TMP_ACTDELAY_2
+	{ 0, 0, 32, 0L, 0L, 0L, 62101UL },	// TMP_CONFIG___2
+	{ 0, 0, 32, 0L, 0L, 0L, 62133UL },	// TMP_CONF_DO__2
+	{ 0, 0, 32, 0L, 0L, 0L, 62165UL },	// TMP_SC_LEVEL_3
+	{ 0, 0, 32, 0L, 0L, 0L, 62197UL },	// TMP_ALA_ENAB_3
+	{ 0, 0, 32, 0L, 0L, 0L, 62229UL },	// TMP_LIMITVAL_3
+	{ 0, 0, 32, 0L, 0L, 0L, 62261UL },	// TMP_DEL_TIME_3
+	{ 0, 0, 32, 0L, 0L, 0L, 62293UL },	// TMP_REC_TIME_3
+	{ 0, 0, 32, 0L, 0L, 0L, 62325UL },	// TMP_ACTDELAY_3
+	{ 0, 0, 32, 0L, 0L, 0L, 62357UL },	// TMP_CONFIG___3
+	{ 0, 0, 32, 0L, 0L, 0L, 62389UL },	// TMP_CONF_DO__3
+	{ 0, 0, 32, 0L, 0L, 0L, 62421UL },	// TMP_SC_LEVEL_4
+	{ 0, 0, 32, 0L, 0L, 0L, 62453UL },	// TMP_ALA_ENAB_4
+	{ 0, 0, 32, 0L, 0L, 0L, 62485UL },	// TMP_LIMITVAL_4
+	{ 0, 0, 32, 0L, 0L, 0L, 62517UL },	// TMP_DEL_TIME_4
+	{ 0, 0, 32, 0L, 0L, 0L, 62549UL },	// TMP_REC_TIME_4
+	{ 0, 0, 32, 0L, 0L, 0L, 62581UL },	// TMP_ACTDELAY_4
+	{ 0, 0, 32, 0L, 0L, 0L, 62613UL },	// TMP_CONFIG___4
+	{ 0, 0, 32, 0L, 0L, 0L, 62645UL },	// TMP_CONF_DO__4
+	{ 0, 0, 32, 0L, 0L, 0L, 62677UL },	// TMP_SC_LEVEL_5
+	{ 0, 0, 32, 0L, 0L, 0L, 62709UL },	// TMP_ALA_ENAB_5
+	{ 0, 0, 32, 0L, 0L, 0L, 62741UL },	// TMP_LIMITVAL_5
+	{ 0, 0, 32, 0L, 0L, 0L, 62773UL },	// TMP_DEL_TIME_5
+	{ 0, 0, 32, 0L, 0L, 0L, 62805UL },	// TMP_REC_TIME_5
+	{ 0, 0, 32, 0L, 0L, 0L, 62837UL },	// TMP_ACTDELAY_5
+	{ 0, 0, 32, 0L, 0L, 0L, 62869UL },	// TMP_CONFIG___5
+	{ 0, 0, 32, 0L, 0L, 0L, 62901UL },	// TMP_CONF_DO__5
+	{ 0, 0, 32, 0L, 0L, 0L, 62933UL },	// TMP_SC_LEVEL_6
+	{ 0, 0, 32, 0L, 0L, 0L, 62965UL },	// TMP_ALA_ENAB_6
+	{ 0, 0, 32, 0L, 0L, 0L, 62997UL },	// TMP_LIMITVAL_6
+	{ 0, 0, 32, 0L, 0L, 0L, 63029UL },	// TMP_DEL_TIME_6
+	{ 0, 0, 32, 0L, 0L, 0L, 63061UL },	// TMP_REC_TIME_6
+	{ 0, 0, 32, 0L, 0L, 0L, 63093UL },	// TMP_ACTDELAY_6
+	{ 0, 0, 32, 0L, 0L, 0L, 63125UL },	// TMP_CONFIG___6
+	{ 0, 0, 32, 0L, 0L, 0L, 63157UL },	// TMP_CONF_DO__6
+	{ 0, 0, 32, 0L, 0L, 0L, 63189UL },	// TMP_SC_LEVEL_7
+	{ 0, 0, 32, 0L, 0L, 0L, 63221UL },	// TMP_ALA_ENAB_7
+	{ 0, 0, 32, 0L, 0L, 0L, 63253UL },	// TMP_LIMITVAL_7
+	{ 0, 0, 32, 0L, 0L, 0L, 63285UL },	// TMP_DEL_TIME_7
+	{ 0, 0, 32, 0L, 0L, 0L, 63317UL },	// TMP_REC_TIME_7
+	{ 0, 0, 32, 0L, 0L, 0L, 63349UL },	// TMP_ACTDELAY_7
+	{ 0, 0, 32, 0L, 0L, 0L, 63381UL },	// TMP_CONFIG___7
+	{ 0, 0, 32, 0L, 0L, 0L, 63413UL },	// TMP_CONF_DO__7
+	{ 0, 0, 32, 0L, 0L, 0L, 63445UL },	// TMP_SC_LEVEL_8
+	{ 0, 0, 32, 0L, 0L, 0L, 63477UL },	// TMP_ALA_ENAB_8
+	{ 0, 0, 32, 0L, 0L, 0L, 63509UL },	// TMP_LIMITVAL_8
+	{ 0, 0, 32, 0L, 0L, 0L, 63541UL },	// TMP_DEL_TIME_8
+	{ 0, 0, 32, 0L, 0L, 0L, 63573UL },	// TMP_REC_TIME_8
+	{ 0, 0, 32, 0L, 0L, 0L, 63605UL },	// TMP_ACTDELAY_8
+	{ 0, 0, 32, 0L, 0L, 0L, 63637UL },	// TMP_CONFIG___8
+	{ 0, 0, 32, 0L, 0L, 0L, 63669UL },	// TMP_CONF_DO__8
+	{ 0, 0, 32, 0L, 0L, 0L, 63701UL },	// TMP_SC_LEVEL_9
+	{ 0, 0, 32, 0L, 0L, 0L, 63733UL },	// TMP_ALA_ENAB_9
+	{ 0, 0, 32, 0L, 0L, 0L, 63765UL },	// TMP_LIMITVAL_9
+	{ 0, 0, 32, 0L, 0L, 0L, 63797UL },	// TMP_DEL_TIME_9
+	{ 0, 0, 32, 0L, 0L, 0L, 63829UL },	// TMP_REC_TIME_9
+	{ 0, 0, 32, 0L, 0L, 0L, 63861UL },	// TMP_ACTDELAY_9
+	{ 0, 0, 32, 0L, 0L, 0L, 63893UL },	// TMP_CONFIG___9
+	{ 0, 0, 32, 0L, 0L, 0L, 63925UL },	// TMP_CONF_DO__9
+	{ 0, 0, 32, 0L, 0L, 0L, 63957UL },	// TMP_SC_LEVEL_10
+	{ 0, 0, 32, 0L, 0L, 0L, 63989UL },	// TMP_ALA_ENAB_10
+	{ 0, 0, 32, 0L, 0L, 0L, 64021UL },	// TMP_LIMITVAL_10
+	{ 0, 0, 32, 0L, 0L, 0L, 64053UL },	// TMP_DEL_TIME_10
+	{ 0, 0, 32, 0L, 0L, 0L, 64085UL },	// TMP_REC_TIME_10
+	{ 0, 0, 32, 0L, 0L, 0L, 64117UL },	// TMP_ACTDELAY_10
+	{ 0, 0, 32, 0L, 0L, 0L, 64149UL },	// TMP_CONFIG___10
+	{ 0, 0, 32, 0L, 0L, 0L, 64181UL },	// TMP_CONF_DO__10
+	{ 0, 0, 32, 0L, 0L, 0L, 64213UL },	// TMP_SC_LEVEL_11
+	{ 0, 0, 32, 0L, 0L, 0L, 64245UL },	// TMP_ALA_ENAB_11
+	{ 0, 0, 32, 0L, 0L, 0L, 64277UL },	// TMP_LIMITVAL_11
+	{ 0, 0, 32, 0L, 0L, 0L, 64309UL },	// TMP_DEL_TIME_11
+	{ 0, 0, 32, 0L, 0L, 0L, 64341UL },	// TMP_REC_TIME_11
+	{ 0, 0, 32, 0L, 0L, 0L, 64373UL },	// TMP_ACTDELAY_11
+	{ 0, 0, 32, 0L, 0L, 0L, 64405UL },	// TMP_CONFIG___11
+	{ 0, 0, 32, 0L, 0L, 0L, 64437UL },	// TMP_CONF_DO__11
+	{ 0, 0, 32, 0L, 0L, 0L, 64469UL },	// TMP_SC_LEVEL_12
+	{ 0, 0, 32, 0L, 0L, 0L, 64501UL },	// TMP_ALA_ENAB_12
+	{ 0, 0, 32, 0L, 0L, 0L, 64533UL },	// TMP_LIMITVAL_12
+	{ 0, 0, 32, 0L, 0L, 0L, 64565UL },	// TMP_DEL_TIME_12
+	{ 0, 0, 32, 0L, 0L, 0L, 64597UL },	// TMP_REC_TIME_12
+	{ 0, 0, 32, 0L, 0L, 0L, 64629UL },	// TMP_ACTDELAY_12
+	{ 0, 0, 32, 0L, 0L, 0L, 64661UL },	// TMP_CONFIG___12
+	{ 0, 0, 32, 0L, 0L, 0L, 64693UL },	// TMP_CONF_DO__12
+	{ 0, 0, 32, 0L, 0L, 0L, 64725UL },	// TMP_SC_LEVEL_13
+	{ 0, 0, 32, 0L, 0L, 0L, 64757UL },	// TMP_ALA_ENAB_13
+	{ 0, 0, 32, 0L, 0L, 0L, 64789UL },	// TMP_LIMITVAL_13
+	{ 0, 0, 32, 0L, 0L, 0L, 64821UL },	// TMP_DEL_TIME_13
+	{ 0, 0, 32, 0L, 0L, 0L, 64853UL },	// TMP_REC_TIME_13
+	{ 0, 0, 32, 0L, 0L, 0L, 64885UL },	// TMP_ACTDELAY_13
+	{ 0, 0, 32, 0L, 0L, 0L, 64917UL },	// TMP_CONFIG___13
+	{ 0, 0, 32, 0L, 0L, 0L, 64949UL },	// TMP_CONF_DO__13
+	{ 0, 0, 32, 0L, 0L, 0L, 64981UL },	// TMP_SC_LEVEL_14
+	{ 0, 0, 32, 0L, 0L, 0L, 65013UL },	// TMP_ALA_ENAB_14
+	{ 0, 0, 32, 0L, 0L, 0L, 65045UL },	// TMP_LIMITVAL_14
+	{ 0, 0, 32, 0L, 0L, 0L, 65077UL },	// TMP_DEL_TIME_14
+	{ 0, 0, 32, 0L, 0L, 0L, 65109UL },	// TMP_REC_TIME_14
+	{ 0, 0, 32, 0L, 0L, 0L, 65141UL },	// TMP_ACTDELAY_14
+	{ 0, 0, 32, 0L, 0L, 0L, 65173UL },	// TMP_CONFIG___14
+	{ 0, 0, 32, 0L, 0L, 0L, 65205UL },	// TMP_CONF_DO__14
+	{ 0, 0, 32, 0L, 0L, 0L, 65237UL },	// TMP_SC_LEVEL_15
+	{ 0, 0, 32, 0L, 0L, 0L, 65269UL },	// TMP_ALA_ENAB_15
+	{ 0, 0, 32, 0L, 0L, 0L, 65301UL },	// TMP_LIMITVAL_15
+	{ 0, 0, 32, 0L, 0L, 0L, 65333UL },	// TMP_DEL_TIME_15
+	{ 0, 0, 32, 0L, 0L, 0L, 65365UL },	// TMP_REC_TIME_15
+	{ 0, 0, 32, 0L, 0L, 0L, 65397UL },	// TMP_ACTDELAY_15
+	{ 0, 0, 32, 0L, 0L, 0L, 65429UL },	// TMP_CONFIG___15
+	{ 0, 0, 32, 0L, 0L, 0L, 65461UL },	// TMP_CONF_DO__15
+	{ 0, 0, 32, 0L, 0L, 0L, 65493UL },	// TMP_SC_LEVEL_16
+	{ 0, 0, 32, 0L, 0L, 0L, 65525UL },	// TMP_ALA_ENAB_16
+	{ 0, 0, 32, 0L, 0L, 0L, 65557UL },	// TMP_LIMITVAL_16
+	{ 0, 0, 32, 0L, 0L, 0L, 65589UL },	// TMP_DEL_TIME_16
+	{ 0, 0, 32, 0L, 0L, 0L, 65621UL },	// TMP_REC_TIME_16
+	{ 0, 0, 32, 0L, 0L, 0L, 65653UL },	// TMP_ACTDELAY_16
+	{ 0, 0, 32, 0L, 0L, 0L, 65685UL },	// TMP_CONFIG___16
+	{ 0, 0, 32, 0L, 0L, 0L, 65717UL },	// TMP_CONF_DO__16
+	{ 0, 0, 32, 0L, 0L, 0L, 65749UL },	// TMP_SC_LEVEL_17
+	{ 0, 0, 32, 0L, 0L, 0L, 65781UL },	// TMP_ALA_ENAB_17
+	{ 0, 0, 32, 0L, 0L, 0L, 65813UL },	// TMP_LIMITVAL_17
+	{ 0, 0, 32, 0L, 0L, 0L, 65845UL },	// TMP_DEL_TIME_17
+	{ 0, 0, 32, 0L, 0L, 0L, 65877UL },	// TMP_REC_TIME_17
+	{ 0, 0, 32, 0L, 0L, 0L, 65909UL },	// TMP_ACTDELAY_17
+	{ 0, 0, 32, 0L, 0L, 0L, 65941UL },	// TMP_CONFIG___17
+	{ 0, 0, 32, 0L, 0L, 0L, 65973UL },	// TMP_CONF_DO__17
+	{ 0, 0, 32, 0L, 0L, 0L, 66005UL },	// TMP_SC_LEVEL_18
+	{ 0, 0, 32, 0L, 0L, 0L, 66037UL },	// TMP_ALA_ENAB_18
+	{ 0, 0, 32, 0L, 0L, 0L, 66069UL },	// TMP_LIMITVAL_18
+	{ 0, 0, 32, 0L, 0L, 0L, 66101UL },	// TMP_DEL_TIME_18
+	{ 0, 0, 32, 0L, 0L, 0L, 66133UL },	// TMP_REC_TIME_18
+	{ 0, 0, 32, 0L, 0L, 0L, 66165UL },	// TMP_ACTDELAY_18
+	{ 0, 0, 32, 0L, 0L, 0L, 66197UL },	// TMP_CONFIG___18
+	{ 0, 0, 32, 0L, 0L, 0L, 66229UL },	// TMP_CONF_DO__18
+	{ 0, 0, 32, 0L, 0L, 0L, 66261UL },	// TMP_SC_LEVEL_19
+	{ 0, 0, 32, 0L, 0L, 0L, 66293UL },	// TMP_ALA_ENAB_19
+	{ 0, 0, 32, 0L, 0L, 0L, 66325UL },	// TMP_LIMITVAL_19
+	{ 0, 0, 32, 0L, 0L, 0L, 66357UL },	// TMP_DEL_TIME_19
+	{ 0, 0, 32, 0L, 0L, 0L, 66389UL },	// TMP_REC_TIME_19
+	{ 0, 0, 32, 0L, 0L, 0L, 66421UL },	// TMP_ACTDELAY_19
+	{ 0, 0, 32, 0L, 0L, 0L, 66453UL },	// TMP_CONFIG___19
+	{ 0, 0, 32, 0L, 0L, 0L, 66485UL },	// TMP_CONF_DO__19
+	{ 0, 0, 32, 0L, 0L, 0L, 66517UL },	// TMP_SC_LEVEL_20
+	{ 0, 0, 32, 0L, 0L, 0L, 66549UL },	// TMP_ALA_ENAB_20
+	{ 0, 0, 32, 0L, 0L, 0L, 66581UL },	// TMP_LIMITVAL_20
+	{ 0, 0, 32, 0L, 0L, 0L, 66613UL },	// TMP_DEL_TIME_20
+	{ 0, 0, 32, 0L, 0L, 0L, 66645UL },	// TMP_REC_TIME_20
+	{ 0, 0, 32, 0L, 0L, 0L, 66677UL },	// TMP_ACTDELAY_20
+	{ 0, 0, 32, 0L, 0L, 0L, 66709UL },	// TMP_CONFIG___20
+	{ 0, 0, 32, 0L, 0L, 0L, 66741UL },	// TMP_CONF_DO__20
+	{ 0, 0, 32, 0L, 0L, 0L, 66773UL },	// TMP_SC_LEVEL_1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 66805UL },	// TMP_ALA_ENAB_1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 66837UL },	// TMP_LIMITVAL_1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 66869UL },	// TMP_DEL_TIME_1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 66901UL },	// TMP_REC_TIME_1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 66933UL },	// TMP_ACTDELAY_1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 66965UL },	// TMP_CONFIG___1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 66997UL },	// TMP_CONF_DO__1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67029UL },	// TMP_SC_LEVEL_2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67061UL },	// TMP_ALA_ENAB_2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67093UL },	// TMP_LIMITVAL_2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67125UL },	// TMP_DEL_TIME_2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67157UL },	// TMP_REC_TIME_2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67189UL },	// TMP_ACTDELAY_2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67221UL },	// TMP_CONFIG___2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67253UL },	// TMP_CONF_DO__2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67285UL },	// TMP_SC_LEVEL_3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67317UL },	// TMP_ALA_ENAB_3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67349UL },	// TMP_LIMITVAL_3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67381UL },	// TMP_DEL_TIME_3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67413UL },	// TMP_REC_TIME_3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67445UL },	// TMP_ACTDELAY_3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67477UL },	// TMP_CONFIG___3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67509UL },	// TMP_CONF_DO__3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67541UL },	// TMP_SC_LEVEL_4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67573UL },	// TMP_ALA_ENAB_4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67605UL },	// TMP_LIMITVAL_4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67637UL },	// TMP_DEL_TIME_4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67669UL },	// TMP_REC_TIME_4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67701UL },	// TMP_ACTDELAY_4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67733UL },	// TMP_CONFIG___4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67765UL },	// TMP_CONF_DO__4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67797UL },	// TMP_SC_LEVEL_5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67829UL },	// TMP_ALA_ENAB_5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67861UL },	// TMP_LIMITVAL_5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67893UL },	// TMP_DEL_TIME_5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67925UL },	// TMP_REC_TIME_5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67957UL },	// TMP_ACTDELAY_5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 67989UL },	// TMP_CONFIG___5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68021UL },	// TMP_CONF_DO__5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68053UL },	// TMP_SC_LEVEL_6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68085UL },	// TMP_ALA_ENAB_6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68117UL },	// TMP_LIMITVAL_6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68149UL },	// TMP_DEL_TIME_6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68181UL },	// TMP_REC_TIME_6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68213UL },	// TMP_ACTDELAY_6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68245UL },	// TMP_CONFIG___6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68277UL },	// TMP_CONF_DO__6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68309UL },	// TMP_SC_LEVEL_7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68341UL },	// TMP_ALA_ENAB_7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68373UL },	// TMP_LIMITVAL_7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68405UL },	// TMP_DEL_TIME_7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68437UL },	// TMP_REC_TIME_7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68469UL },	// TMP_ACTDELAY_7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68501UL },	// TMP_CONFIG___7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68533UL },	// TMP_CONF_DO__7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68565UL },	// TMP_SC_LEVEL_8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68597UL },	// TMP_ALA_ENAB_8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68629UL },	// TMP_LIMITVAL_8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68661UL },	// TMP_DEL_TIME_8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68693UL },	// TMP_REC_TIME_8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68725UL },	// TMP_ACTDELAY_8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68757UL },	// TMP_CONFIG___8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68789UL },	// TMP_CONF_DO__8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68821UL },	// TMP_SC_LEVEL_9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68853UL },	// TMP_ALA_ENAB_9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68885UL },	// TMP_LIMITVAL_9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68917UL },	// TMP_DEL_TIME_9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68949UL },	// TMP_REC_TIME_9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 68981UL },	// TMP_ACTDELAY_9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69013UL },	// TMP_CONFIG___9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69045UL },	// TMP_CONF_DO__9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69077UL },	// TMP_SC_LEVEL_10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69109UL },	// TMP_ALA_ENAB_10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69141UL },	// TMP_LIMITVAL_10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69173UL },	// TMP_DEL_TIME_10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69205UL },	// TMP_REC_TIME_10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69237UL },	// TMP_ACTDELAY_10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69269UL },	// TMP_CONFIG___10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69301UL },	// TMP_CONF_DO__10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69333UL },	// TMP_SC_LEVEL_11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69365UL },	// TMP_ALA_ENAB_11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69397UL },	// TMP_LIMITVAL_11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69429UL },	// TMP_DEL_TIME_11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69461UL },	// TMP_REC_TIME_11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69493UL },	// TMP_ACTDELAY_11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69525UL },	// TMP_CONFIG___11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69557UL },	// TMP_CONF_DO__11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69589UL },	// TMP_SC_LEVEL_12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69621UL },	// TMP_ALA_ENAB_12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69653UL },	// TMP_LIMITVAL_12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69685UL },	// TMP_DEL_TIME_12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69717UL },	// TMP_REC_TIME_12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69749UL },	// TMP_ACTDELAY_12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69781UL },	// TMP_CONFIG___12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69813UL },	// TMP_CONF_DO__12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69845UL },	// TMP_SC_LEVEL_13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69877UL },	// TMP_ALA_ENAB_13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69909UL },	// TMP_LIMITVAL_13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69941UL },	// TMP_DEL_TIME_13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 69973UL },	// TMP_REC_TIME_13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70005UL },	// TMP_ACTDELAY_13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70037UL },	// TMP_CONFIG___13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70069UL },	// TMP_CONF_DO__13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70101UL },	// TMP_SC_LEVEL_14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70133UL },	// TMP_ALA_ENAB_14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70165UL },	// TMP_LIMITVAL_14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70197UL },	// TMP_DEL_TIME_14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70229UL },	// TMP_REC_TIME_14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70261UL },	// TMP_ACTDELAY_14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70293UL },	// TMP_CONFIG___14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70325UL },	// TMP_CONF_DO__14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70357UL },	// TMP_SC_LEVEL_15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70389UL },	// TMP_ALA_ENAB_15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70421UL },	// TMP_LIMITVAL_15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70453UL },	// TMP_DEL_TIME_15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70485UL },	// TMP_REC_TIME_15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70517UL },	// TMP_ACTDELAY_15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70549UL },	// TMP_CONFIG___15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70581UL },	// TMP_CONF_DO__15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70613UL },	// TMP_SC_LEVEL_16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70645UL },	// TMP_ALA_ENAB_16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70677UL },	// TMP_LIMITVAL_16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70709UL },	// TMP_DEL_TIME_16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70741UL },	// TMP_REC_TIME_16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70773UL },	// TMP_ACTDELAY_16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70805UL },	// TMP_CONFIG___16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70837UL },	// TMP_CONF_DO__16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70869UL },	// TMP_SC_LEVEL_17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70901UL },	// TMP_ALA_ENAB_17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70933UL },	// TMP_LIMITVAL_17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70965UL },	// TMP_DEL_TIME_17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 70997UL },	// TMP_REC_TIME_17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71029UL },	// TMP_ACTDELAY_17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71061UL },	// TMP_CONFIG___17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71093UL },	// TMP_CONF_DO__17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71125UL },	// TMP_SC_LEVEL_18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71157UL },	// TMP_ALA_ENAB_18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71189UL },	// TMP_LIMITVAL_18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71221UL },	// TMP_DEL_TIME_18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71253UL },	// TMP_REC_TIME_18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71285UL },	// TMP_ACTDELAY_18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71317UL },	// TMP_CONFIG___18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71349UL },	// TMP_CONF_DO__18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71381UL },	// TMP_SC_LEVEL_19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71413UL },	// TMP_ALA_ENAB_19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71445UL },	// TMP_LIMITVAL_19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71477UL },	// TMP_DEL_TIME_19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71509UL },	// TMP_REC_TIME_19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71541UL },	// TMP_ACTDELAY_19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71573UL },	// TMP_CONFIG___19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71605UL },	// TMP_CONF_DO__19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71637UL },	// TMP_SC_LEVEL_20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71669UL },	// TMP_ALA_ENAB_20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71701UL },	// TMP_LIMITVAL_20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71733UL },	// TMP_DEL_TIME_20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71765UL },	// TMP_REC_TIME_20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71797UL },	// TMP_ACTDELAY_20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71829UL },	// TMP_CONFIG___20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71861UL },	// TMP_CONF_DO__20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 71893UL },	// TMP_SC_LEVEL_1_3
+	{ 0, 0, 32, 0L, 0L, 0L, 71925UL },	// TMP_ALA_ENAB_1_3
+	{ 0, 0, 32, 0L, 0L, 0L, 71957UL },	// TMP_LIMITVAL_1_3
+	{ 0, 0, 32, 0L, 0L, 0L, 71989UL },	// TMP_DEL_TIME_1_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72021UL },	// TMP_REC_TIME_1_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72053UL },	// TMP_ACTDELAY_1_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72085UL },	// TMP_CONFIG___1_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72117UL },	// TMP_CONF_DO__1_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72149UL },	// TMP_SC_LEVEL_2_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72181UL },	// TMP_ALA_ENAB_2_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72213UL },	// TMP_LIMITVAL_2_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72245UL },	// TMP_DEL_TIME_2_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72277UL },	// TMP_REC_TIME_2_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72309UL },	// TMP_ACTDELAY_2_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72341UL },	// TMP_CONFIG___2_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72373UL },	// TMP_CONF_DO__2_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72405UL },	// TMP_SC_LEVEL_3_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72437UL },	// TMP_ALA_ENAB_3_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72469UL },	// TMP_LIMITVAL_3_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72501UL },	// TMP_DEL_TIME_3_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72533UL },	// TMP_REC_TIME_3_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72565UL },	// TMP_ACTDELAY_3_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72597UL },	// TMP_CONFIG___3_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72629UL },	// TMP_CONF_DO__3_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72661UL },	// TMP_SC_LEVEL_4_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72693UL },	// TMP_ALA_ENAB_4_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72725UL },	// TMP_LIMITVAL_4_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72757UL },	// TMP_DEL_TIME_4_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72789UL },	// TMP_REC_TIME_4_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72821UL },	// TMP_ACTDELAY_4_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72853UL },	// TMP_CONFIG___4_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72885UL },	// TMP_CONF_DO__4_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72917UL },	// TMP_SC_LEVEL_5_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72949UL },	// TMP_ALA_ENAB_5_3
+	{ 0, 0, 32, 0L, 0L, 0L, 72981UL },	// TMP_LIMITVAL_5_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73013UL },	// TMP_DEL_TIME_5_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73045UL },	// TMP_REC_TIME_5_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73077UL },	// TMP_ACTDELAY_5_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73109UL },	// TMP_CONFIG___5_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73141UL },	// TMP_CONF_DO__5_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73173UL },	// TMP_SC_LEVEL_6_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73205UL },	// TMP_ALA_ENAB_6_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73237UL },	// TMP_LIMITVAL_6_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73269UL },	// TMP_DEL_TIME_6_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73301UL },	// TMP_REC_TIME_6_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73333UL },	// TMP_ACTDELAY_6_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73365UL },	// TMP_CONFIG___6_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73397UL },	// TMP_CONF_DO__6_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73429UL },	// TMP_SC_LEVEL_7_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73461UL },	// TMP_ALA_ENAB_7_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73493UL },	// TMP_LIMITVAL_7_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73525UL },	// TMP_DEL_TIME_7_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73557UL },	// TMP_REC_TIME_7_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73589UL },	// TMP_ACTDELAY_7_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73621UL },	// TMP_CONFIG___7_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73653UL },	// TMP_CONF_DO__7_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73685UL },	// TMP_SC_LEVEL_8_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73717UL },	// TMP_ALA_ENAB_8_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73749UL },	// TMP_LIMITVAL_8_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73781UL },	// TMP_DEL_TIME_8_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73813UL },	// TMP_REC_TIME_8_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73845UL },	// TMP_ACTDELAY_8_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73877UL },	// TMP_CONFIG___8_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73909UL },	// TMP_CONF_DO__8_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73941UL },	// TMP_SC_LEVEL_9_3
+	{ 0, 0, 32, 0L, 0L, 0L, 73973UL },	// TMP_ALA_ENAB_9_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74005UL },	// TMP_LIMITVAL_9_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74037UL },	// TMP_DEL_TIME_9_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74069UL },	// TMP_REC_TIME_9_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74101UL },	// TMP_ACTDELAY_9_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74133UL },	// TMP_CONFIG___9_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74165UL },	// TMP_CONF_DO__9_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74197UL },	// TMP_SC_LEVEL_10_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74229UL },	// TMP_ALA_ENAB_10_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74261UL },	// TMP_LIMITVAL_10_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74293UL },	// TMP_DEL_TIME_10_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74325UL },	// TMP_REC_TIME_10_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74357UL },	// TMP_ACTDELAY_10_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74389UL },	// TMP_CONFIG___10_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74421UL },	// TMP_CONF_DO__10_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74453UL },	// TMP_SC_LEVEL_11_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74485UL },	// TMP_ALA_ENAB_11_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74517UL },	// TMP_LIMITVAL_11_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74549UL },	// TMP_DEL_TIME_11_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74581UL },	// TMP_REC_TIME_11_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74613UL },	// TMP_ACTDELAY_11_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74645UL },	// TMP_CONFIG___11_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74677UL },	// TMP_CONF_DO__11_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74709UL },	// TMP_SC_LEVEL_12_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74741UL },	// TMP_ALA_ENAB_12_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74773UL },	// TMP_LIMITVAL_12_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74805UL },	// TMP_DEL_TIME_12_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74837UL },	// TMP_REC_TIME_12_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74869UL },	// TMP_ACTDELAY_12_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74901UL },	// TMP_CONFIG___12_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74933UL },	// TMP_CONF_DO__12_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74965UL },	// TMP_SC_LEVEL_13_3
+	{ 0, 0, 32, 0L, 0L, 0L, 74997UL },	// TMP_ALA_ENAB_13_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75029UL },	// TMP_LIMITVAL_13_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75061UL },	// TMP_DEL_TIME_13_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75093UL },	// TMP_REC_TIME_13_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75125UL },	// TMP_ACTDELAY_13_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75157UL },	// TMP_CONFIG___13_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75189UL },	// TMP_CONF_DO__13_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75221UL },	// TMP_SC_LEVEL_14_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75253UL },	// TMP_ALA_ENAB_14_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75285UL },	// TMP_LIMITVAL_14_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75317UL },	// TMP_DEL_TIME_14_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75349UL },	// TMP_REC_TIME_14_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75381UL },	// TMP_ACTDELAY_14_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75413UL },	// TMP_CONFIG___14_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75445UL },	// TMP_CONF_DO__14_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75477UL },	// TMP_SC_LEVEL_15_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75509UL },	// TMP_ALA_ENAB_15_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75541UL },	// TMP_LIMITVAL_15_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75573UL },	// TMP_DEL_TIME_15_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75605UL },	// TMP_REC_TIME_15_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75637UL },	// TMP_ACTDELAY_15_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75669UL },	// TMP_CONFIG___15_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75701UL },	// TMP_CONF_DO__15_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75733UL },	// TMP_SC_LEVEL_16_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75765UL },	// TMP_ALA_ENAB_16_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75797UL },	// TMP_LIMITVAL_16_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75829UL },	// TMP_DEL_TIME_16_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75861UL },	// TMP_REC_TIME_16_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75893UL },	// TMP_ACTDELAY_16_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75925UL },	// TMP_CONFIG___16_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75957UL },	// TMP_CONF_DO__16_3
+	{ 0, 0, 32, 0L, 0L, 0L, 75989UL },	// TMP_SC_LEVEL_17_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76021UL },	// TMP_ALA_ENAB_17_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76053UL },	// TMP_LIMITVAL_17_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76085UL },	// TMP_DEL_TIME_17_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76117UL },	// TMP_REC_TIME_17_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76149UL },	// TMP_ACTDELAY_17_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76181UL },	// TMP_CONFIG___17_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76213UL },	// TMP_CONF_DO__17_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76245UL },	// TMP_SC_LEVEL_18_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76277UL },	// TMP_ALA_ENAB_18_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76309UL },	// TMP_LIMITVAL_18_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76341UL },	// TMP_DEL_TIME_18_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76373UL },	// TMP_REC_TIME_18_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76405UL },	// TMP_ACTDELAY_18_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76437UL },	// TMP_CONFIG___18_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76469UL },	// TMP_CONF_DO__18_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76501UL },	// TMP_SC_LEVEL_19_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76533UL },	// TMP_ALA_ENAB_19_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76565UL },	// TMP_LIMITVAL_19_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76597UL },	// TMP_DEL_TIME_19_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76629UL },	// TMP_REC_TIME_19_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76661UL },	// TMP_ACTDELAY_19_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76693UL },	// TMP_CONFIG___19_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76725UL },	// TMP_CONF_DO__19_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76757UL },	// TMP_SC_LEVEL_20_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76789UL },	// TMP_ALA_ENAB_20_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76821UL },	// TMP_LIMITVAL_20_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76853UL },	// TMP_DEL_TIME_20_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76885UL },	// TMP_REC_TIME_20_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76917UL },	// TMP_ACTDELAY_20_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76949UL },	// TMP_CONFIG___20_3
+	{ 0, 0, 32, 0L, 0L, 0L, 76981UL },	// TMP_CONF_DO__20_3
+	{ 0, 0, 32, 0L, 0L, 0L, 77013UL },	// TMP_SC_LEVEL_1_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77045UL },	// TMP_ALA_ENAB_1_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77077UL },	// TMP_LIMITVAL_1_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77109UL },	// TMP_DEL_TIME_1_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77141UL },	// TMP_REC_TIME_1_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77173UL },	// TMP_ACTDELAY_1_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77205UL },	// TMP_CONFIG___1_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77237UL },	// TMP_CONF_DO__1_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77269UL },	// TMP_SC_LEVEL_2_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77301UL },	// TMP_ALA_ENAB_2_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77333UL },	// TMP_LIMITVAL_2_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77365UL },	// TMP_DEL_TIME_2_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77397UL },	// TMP_REC_TIME_2_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77429UL },	// TMP_ACTDELAY_2_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77461UL },	// TMP_CONFIG___2_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77493UL },	// TMP_CONF_DO__2_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77525UL },	// TMP_SC_LEVEL_3_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77557UL },	// TMP_ALA_ENAB_3_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77589UL },	// TMP_LIMITVAL_3_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77621UL },	// TMP_DEL_TIME_3_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77653UL },	// TMP_REC_TIME_3_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77685UL },	// TMP_ACTDELAY_3_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77717UL },	// TMP_CONFIG___3_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77749UL },	// TMP_CONF_DO__3_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77781UL },	// TMP_SC_LEVEL_4_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77813UL },	// TMP_ALA_ENAB_4_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77845UL },	// TMP_LIMITVAL_4_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77877UL },	// TMP_DEL_TIME_4_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77909UL },	// TMP_REC_TIME_4_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77941UL },	// TMP_ACTDELAY_4_4
+	{ 0, 0, 32, 0L, 0L, 0L, 77973UL },	// TMP_CONFIG___4_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78005UL },	// TMP_CONF_DO__4_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78037UL },	// TMP_SC_LEVEL_5_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78069UL },	// TMP_ALA_ENAB_5_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78101UL },	// TMP_LIMITVAL_5_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78133UL },	// TMP_DEL_TIME_5_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78165UL },	// TMP_REC_TIME_5_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78197UL },	// TMP_ACTDELAY_5_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78229UL },	// TMP_CONFIG___5_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78261UL },	// TMP_CONF_DO__5_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78293UL },	// TMP_SC_LEVEL_6_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78325UL },	// TMP_ALA_ENAB_6_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78357UL },	// TMP_LIMITVAL_6_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78389UL },	// TMP_DEL_TIME_6_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78421UL },	// TMP_REC_TIME_6_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78453UL },	// TMP_ACTDELAY_6_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78485UL },	// TMP_CONFIG___6_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78517UL },	// TMP_CONF_DO__6_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78549UL },	// TMP_SC_LEVEL_7_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78581UL },	// TMP_ALA_ENAB_7_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78613UL },	// TMP_LIMITVAL_7_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78645UL },	// TMP_DEL_TIME_7_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78677UL },	// TMP_REC_TIME_7_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78709UL },	// TMP_ACTDELAY_7_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78741UL },	// TMP_CONFIG___7_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78773UL },	// TMP_CONF_DO__7_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78805UL },	// TMP_SC_LEVEL_8_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78837UL },	// TMP_ALA_ENAB_8_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78869UL },	// TMP_LIMITVAL_8_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78901UL },	// TMP_DEL_TIME_8_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78933UL },	// TMP_REC_TIME_8_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78965UL },	// TMP_ACTDELAY_8_4
+	{ 0, 0, 32, 0L, 0L, 0L, 78997UL },	// TMP_CONFIG___8_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79029UL },	// TMP_CONF_DO__8_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79061UL },	// TMP_SC_LEVEL_9_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79093UL },	// TMP_ALA_ENAB_9_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79125UL },	// TMP_LIMITVAL_9_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79157UL },	// TMP_DEL_TIME_9_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79189UL },	// TMP_REC_TIME_9_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79221UL },	// TMP_ACTDELAY_9_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79253UL },	// TMP_CONFIG___9_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79285UL },	// TMP_CONF_DO__9_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79317UL },	// TMP_SC_LEVEL_10_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79349UL },	// TMP_ALA_ENAB_10_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79381UL },	// TMP_LIMITVAL_10_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79413UL },	// TMP_DEL_TIME_10_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79445UL },	// TMP_REC_TIME_10_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79477UL },	// TMP_ACTDELAY_10_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79509UL },	// TMP_CONFIG___10_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79541UL },	// TMP_CONF_DO__10_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79573UL },	// TMP_SC_LEVEL_11_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79605UL },	// TMP_ALA_ENAB_11_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79637UL },	// TMP_LIMITVAL_11_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79669UL },	// TMP_DEL_TIME_11_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79701UL },	// TMP_REC_TIME_11_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79733UL },	// TMP_ACTDELAY_11_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79765UL },	// TMP_CONFIG___11_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79797UL },	// TMP_CONF_DO__11_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79829UL },	// TMP_SC_LEVEL_12_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79861UL },	// TMP_ALA_ENAB_12_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79893UL },	// TMP_LIMITVAL_12_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79925UL },	// TMP_DEL_TIME_12_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79957UL },	// TMP_REC_TIME_12_4
+	{ 0, 0, 32, 0L, 0L, 0L, 79989UL },	// TMP_ACTDELAY_12_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80021UL },	// TMP_CONFIG___12_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80053UL },	// TMP_CONF_DO__12_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80085UL },	// TMP_SC_LEVEL_13_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80117UL },	// TMP_ALA_ENAB_13_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80149UL },	// TMP_LIMITVAL_13_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80181UL },	// TMP_DEL_TIME_13_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80213UL },	// TMP_REC_TIME_13_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80245UL },	// TMP_ACTDELAY_13_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80277UL },	// TMP_CONFIG___13_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80309UL },	// TMP_CONF_DO__13_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80341UL },	// TMP_SC_LEVEL_14_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80373UL },	// TMP_ALA_ENAB_14_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80405UL },	// TMP_LIMITVAL_14_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80437UL },	// TMP_DEL_TIME_14_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80469UL },	// TMP_REC_TIME_14_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80501UL },	// TMP_ACTDELAY_14_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80533UL },	// TMP_CONFIG___14_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80565UL },	// TMP_CONF_DO__14_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80597UL },	// TMP_SC_LEVEL_15_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80629UL },	// TMP_ALA_ENAB_15_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80661UL },	// TMP_LIMITVAL_15_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80693UL },	// TMP_DEL_TIME_15_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80725UL },	// TMP_REC_TIME_15_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80757UL },	// TMP_ACTDELAY_15_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80789UL },	// TMP_CONFIG___15_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80821UL },	// TMP_CONF_DO__15_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80853UL },	// TMP_SC_LEVEL_16_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80885UL },	// TMP_ALA_ENAB_16_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80917UL },	// TMP_LIMITVAL_16_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80949UL },	// TMP_DEL_TIME_16_4
+	{ 0, 0, 32, 0L, 0L, 0L, 80981UL },	// TMP_REC_TIME_16_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81013UL },	// TMP_ACTDELAY_16_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81045UL },	// TMP_CONFIG___16_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81077UL },	// TMP_CONF_DO__16_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81109UL },	// TMP_SC_LEVEL_17_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81141UL },	// TMP_ALA_ENAB_17_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81173UL },	// TMP_LIMITVAL_17_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81205UL },	// TMP_DEL_TIME_17_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81237UL },	// TMP_REC_TIME_17_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81269UL },	// TMP_ACTDELAY_17_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81301UL },	// TMP_CONFIG___17_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81333UL },	// TMP_CONF_DO__17_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81365UL },	// TMP_SC_LEVEL_18_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81397UL },	// TMP_ALA_ENAB_18_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81429UL },	// TMP_LIMITVAL_18_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81461UL },	// TMP_DEL_TIME_18_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81493UL },	// TMP_REC_TIME_18_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81525UL },	// TMP_ACTDELAY_18_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81557UL },	// TMP_CONFIG___18_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81589UL },	// TMP_CONF_DO__18_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81621UL },	// TMP_SC_LEVEL_19_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81653UL },	// TMP_ALA_ENAB_19_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81685UL },	// TMP_LIMITVAL_19_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81717UL },	// TMP_DEL_TIME_19_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81749UL },	// TMP_REC_TIME_19_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81781UL },	// TMP_ACTDELAY_19_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81813UL },	// TMP_CONFIG___19_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81845UL },	// TMP_CONF_DO__19_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81877UL },	// TMP_SC_LEVEL_20_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81909UL },	// TMP_ALA_ENAB_20_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81941UL },	// TMP_LIMITVAL_20_4
+	{ 0, 0, 32, 0L, 0L, 0L, 81973UL },	// TMP_DEL_TIME_20_4
+	{ 0, 0, 32, 0L, 0L, 0L, 82005UL },	// TMP_REC_TIME_20_4
+	{ 0, 0, 32, 0L, 0L, 0L, 82037UL },	// TMP_ACTDELAY_20_4
+	{ 0, 0, 32, 0L, 0L, 0L, 82069UL },	// TMP_CONFIG___20_4
+	{ 0, 0, 32, 0L, 0L, 0L, 82101UL },	// TMP_CONF_DO__20_4
+	{ 1, TRE_SC_INDEX_TO_STOP_TRENDING__ACCESS_LEVEL, 20, TRE_SC_INDEX_TO_STOP_TRENDING__MIN_VALUE, TRE_SC_INDEX_TO_STOP_TRENDING__MAX_VALUE, TRE_SC_INDEX_TO_STOP_TRENDING__FACTORY_SETTING, 82133UL },
+	{ 1, TRE_LONGTIME_INTERVAL__ACCESS_LEVEL, 10, TRE_LONGTIME_INTERVAL__MIN_VALUE, TRE_LONGTIME_INTERVAL__MAX_VALUE, TRE_LONGTIME_INTERVAL__FACTORY_SETTING, 82153UL },
+	{ 1, GKK_STAGE_CONTROL_MODE__ACCESS_LEVEL, 1, GKK_STAGE_CONTROL_MODE__MIN_VALUE, GKK_STAGE_CONTROL_MODE__MAX_VALUE, GKK_STAGE_CONTROL_MODE__FACTORY_SETTING, 82163UL },
+	{ 1, GKK_STAGE_CONTROL_BY_HOURS__ACCESS_LEVEL, 1, GKK_STAGE_CONTROL_BY_HOURS__MIN_VALUE, GKK_STAGE_CONTROL_BY_HOURS__MAX_VALUE, GKK_STAGE_CONTROL_BY_HOURS__FACTORY_SETTING, 82164UL },
+	{ 1, GKK_STAGE2_ON_ABOVE__ACCESS_LEVEL, 10, GKK_STAGE2_ON_ABOVE__MIN_VALUE, GKK_STAGE2_ON_ABOVE__MAX_VALUE, GKK_STAGE2_ON_ABOVE__FACTORY_SETTING, 82165UL },
+	{ 1, GKK_STAGE2_OFF_BELOW__ACCESS_LEVEL, 10, GKK_STAGE2_OFF_BELOW__MIN_VALUE, GKK_STAGE2_OFF_BELOW__MAX_VALUE, GKK_STAGE2_OFF_BELOW__FACTORY_SETTING, 82175UL },
+	{ 1, GKK_STAGE3_ON_ABOVE__ACCESS_LEVEL, 10, GKK_STAGE3_ON_ABOVE__MIN_VALUE, GKK_STAGE3_ON_ABOVE__MAX_VALUE, GKK_STAGE3_ON_ABOVE__FACTORY_SETTING, 82185UL },
+	{ 1, GKK_STAGE3_OFF_BELOW__ACCESS_LEVEL, 10, GKK_STAGE3_OFF_BELOW__MIN_VALUE, GKK_STAGE3_OFF_BELOW__MAX_VALUE, GKK_STAGE3_OFF_BELOW__FACTORY_SETTING, 82195UL },
+	{ 1, GKK_STAGE4_ON_ABOVE__ACCESS_LEVEL, 10, GKK_STAGE4_ON_ABOVE__MIN_VALUE, GKK_STAGE4_ON_ABOVE__MAX_VALUE, GKK_STAGE4_ON_ABOVE__FACTORY_SETTING, 82205UL },
+	{ 1, GKK_STAGE4_OFF_BELOW__ACCESS_LEVEL, 10, GKK_STAGE4_OFF_BELOW__MIN_VALUE, GKK_STAGE4_OFF_BELOW__MAX_VALUE, GKK_STAGE4_OFF_BELOW__FACTORY_SETTING, 82215UL },
+	{ 1, GKK_STAGE5_ON_ABOVE__ACCESS_LEVEL, 10, GKK_STAGE5_ON_ABOVE__MIN_VALUE, GKK_STAGE5_ON_ABOVE__MAX_VALUE, GKK_STAGE5_ON_ABOVE__FACTORY_SETTING, 82225UL },
+	{ 1, GKK_STAGE5_OFF_BELOW__ACCESS_LEVEL, 10, GKK_STAGE5_OFF_BELOW__MIN_VALUE, GKK_STAGE5_OFF_BELOW__MAX_VALUE, GKK_STAGE5_OFF_BELOW__FACTORY_SETTING, 82235UL },
+	{ 1, GKK_STAGE6_ON_ABOVE__ACCESS_LEVEL, 10, GKK_STAGE6_ON_ABOVE__MIN_VALUE, GKK_STAGE6_ON_ABOVE__MAX_VALUE, GKK_STAGE6_ON_ABOVE__FACTORY_SETTING, 82245UL },
+	{ 1, GKK_STAGE6_OFF_BELOW__ACCESS_LEVEL, 10, GKK_STAGE6_OFF_BELOW__MIN_VALUE, GKK_STAGE6_OFF_BELOW__MAX_VALUE, GKK_STAGE6_OFF_BELOW__FACTORY_SETTING, 82255UL },
+	{ 1, GKK_STAGE7_ON_ABOVE__ACCESS_LEVEL, 10, GKK_STAGE7_ON_ABOVE__MIN_VALUE, GKK_STAGE7_ON_ABOVE__MAX_VALUE, GKK_STAGE7_ON_ABOVE__FACTORY_SETTING, 82265UL },
+	{ 1, GKK_STAGE7_OFF_BELOW__ACCESS_LEVEL, 10, GKK_STAGE7_OFF_BELOW__MIN_VALUE, GKK_STAGE7_OFF_BELOW__MAX_VALUE, GKK_STAGE7_OFF_BELOW__FACTORY_SETTING, 82275UL },
+	{ 1, GKK_STAGE2_OPERATING_HOURS__ACCESS_LEVEL, 26, GKK_STAGE2_OPERATING_HOURS__MIN_VALUE, GKK_STAGE2_OPERATING_HOURS__MAX_VALUE, GKK_STAGE2_OPERATING_HOURS__FACTORY_SETTING, 82285UL },
+	{ 1, GKK_STAGE3_OPERATING_HOURS__ACCESS_LEVEL, 26, GKK_STAGE3_OPERATING_HOURS__MIN_VALUE, GKK_STAGE3_OPERATING_HOURS__MAX_VALUE, GKK_STAGE3_OPERATING_HOURS__FACTORY_SETTING, 82311UL },
+	{ 1, GKK_STAGE4_OPERATING_HOURS__ACCESS_LEVEL, 26, GKK_STAGE4_OPERATING_HOURS__MIN_VALUE, GKK_STAGE4_OPERATING_HOURS__MAX_VALUE, GKK_STAGE4_OPERATING_HOURS__FACTORY_SETTING, 82337UL },
+	{ 1, GKK_STAGE5_OPERATING_HOURS__ACCESS_LEVEL, 26, GKK_STAGE5_OPERATING_HOURS__MIN_VALUE, GKK_STAGE5_OPERATING_HOURS__MAX_VALUE, GKK_STAGE5_OPERATING_HOURS__FACTORY_SETTING, 82363UL },
+	{ 1, GKK_STAGE6_OPERATING_HOURS__ACCESS_LEVEL, 26, GKK_STAGE6_OPERATING_HOURS__MIN_VALUE, GKK_STAGE6_OPERATING_HOURS__MAX_VALUE, GKK_STAGE6_OPERATING_HOURS__FACTORY_SETTING, 82389UL },
+	{ 1, GKK_STAGE7_OPERATING_HOURS__ACCESS_LEVEL, 26, GKK_STAGE7_OPERATING_HOURS__MIN_VALUE, GKK_STAGE7_OPERATING_HOURS__MAX_VALUE, GKK_STAGE7_OPERATING_HOURS__FACTORY_SETTING, 82415UL },
+	{ 1, SPEED_REG_CONST_P1__ACCESS_LEVEL, 15, SPEED_REG_CONST_P1__MIN_VALUE, SPEED_REG_CONST_P1__MAX_VALUE, SPEED_REG_CONST_P1__FACTORY_SETTING, 82441UL },
+	{ 1, SPEED_REG_CONST_P2__ACCESS_LEVEL, 15, SPEED_REG_CONST_P2__MIN_VALUE, SPEED_REG_CONST_P2__MAX_VALUE, SPEED_REG_CONST_P2__FACTORY_SETTING, 82456UL },
+	{ 1, SPEED_REG_CONST_P3__ACCESS_LEVEL, 15, SPEED_REG_CONST_P3__MIN_VALUE, SPEED_REG_CONST_P3__MAX_VALUE, SPEED_REG_CONST_P3__FACTORY_SETTING, 82471UL },
+	{ 1, SPEED_REG_CONST_I1__ACCESS_LEVEL, 15, SPEED_REG_CONST_I1__MIN_VALUE, SPEED_REG_CONST_I1__MAX_VALUE, SPEED_REG_CONST_I1__FACTORY_SETTING, 82486UL },
+	{ 1, SPEED_REG_CONST_I2__ACCESS_LEVEL, 15, SPEED_REG_CONST_I2__MIN_VALUE, SPEED_REG_CONST_I2__MAX_VALUE, SPEED_REG_CONST_I2__FACTORY_SETTING, 82501UL },
+	{ 1, SPEED_REG_CONST_I3__ACCESS_LEVEL, 15, SPEED_REG_CONST_I3__MIN_VALUE, SPEED_REG_CONST_I3__MAX_VALUE, SPEED_REG_CONST_I3__FACTORY_SETTING, 82516UL },
+	{ 1, SPEED_REG_CONST_D1__ACCESS_LEVEL, 15, SPEED_REG_CONST_D1__MIN_VALUE, SPEED_REG_CONST_D1__MAX_VALUE, SPEED_REG_CONST_D1__FACTORY_SETTING, 82531UL },
+	{ 1, SPEED_REG_CONST_D2__ACCESS_LEVEL, 15, SPEED_REG_CONST_D2__MIN_VALUE, SPEED_REG_CONST_D2__MAX_VALUE, SPEED_REG_CONST_D2__FACTORY_SETTING, 82546UL },
+	{ 1, SPEED_REG_CONST_D3__ACCESS_LEVEL, 15, SPEED_REG_CONST_D3__MIN_VALUE, SPEED_REG_CONST_D3__MAX_VALUE, SPEED_REG_CONST_D3__FACTORY_SETTING, 82561UL },
+	{ 1, LS_SPEED_REG_CONST_P1__ACCESS_LEVEL, 15, LS_SPEED_REG_CONST_P1__MIN_VALUE, LS_SPEED_REG_CONST_P1__MAX_VALUE, LS_SPEED_REG_CONST_P1__FACTORY_SETTING, 82576UL },
+	{ 1, LS_SPEED_REG_CONST_P2__ACCESS_LEVEL, 15, LS_SPEED_REG_CONST_P2__MIN_VALUE, LS_SPEED_REG_CONST_P2__MAX_VALUE, LS_SPEED_REG_CONST_P2__FACTORY_SETTING, 82591UL },
+	{ 1, LS_SPEED_REG_CONST_P3__ACCESS_LEVEL, 15, LS_SPEED_REG_CONST_P3__MIN_VALUE, LS_SPEED_REG_CONST_P3__MAX_VALUE, LS_SPEED_REG_CONST_P3__FACTORY_SETTING, 82606UL },
+	{ 1, LS_SPEED_REG_CONST_I1__ACCESS_LEVEL, 15, LS_SPEED_REG_CONST_I1__MIN_VALUE, LS_SPEED_REG_CONST_I1__MAX_VALUE, LS_SPEED_REG_CONST_I1__FACTORY_SETTING, 82621UL },
+	{ 1, LS_SPEED_REG_CONST_I2__ACCESS_LEVEL, 15, LS_SPEED_REG_CONST_I2__MIN_VALUE, LS_SPEED_REG_CONST_I2__MAX_VALUE, LS_SPEED_REG_CONST_I2__FACTORY_SETTING, 82636UL },
+	{ 1, LS_SPEED_REG_CONST_I3__ACCESS_LEVEL, 15, LS_SPEED_REG_CONST_I3__MIN_VALUE, LS_SPEED_REG_CONST_I3__MAX_VALUE, LS_SPEED_REG_CONST_I3__FACTORY_SETTING, 82651UL },
+	{ 1, LS_SPEED_REG_CONST_D1__ACCESS_LEVEL, 15, LS_SPEED_REG_CONST_D1__MIN_VALUE, LS_SPEED_REG_CONST_D1__MAX_VALUE, LS_SPEED_REG_CONST_D1__FACTORY_SETTING, 82666UL },
+	{ 1, LS_SPEED_REG_CONST_D2__ACCESS_LEVEL, 15, LS_SPEED_REG_CONST_D2__MIN_VALUE, LS_SPEED_REG_CONST_D2__MAX_VALUE, LS_SPEED_REG_CONST_D2__FACTORY_SETTING, 82681UL },
+	{ 1, LS_SPEED_REG_CONST_D3__ACCESS_LEVEL, 15, LS_SPEED_REG_CONST_D3__MIN_VALUE, LS_SPEED_REG_CONST_D3__MAX_VALUE, LS_SPEED_REG_CONST_D3__FACTORY_SETTING, 82696UL },
+	{ 1, POWER_RAMP_DOWN__ACCESS_LEVEL, 18, POWER_RAMP_DOWN__MIN_VALUE, POWER_RAMP_DOWN__MAX_VALUE, POWER_RAMP_DOWN__FACTORY_SETTING, 82711UL },
+	{ 1, POWER_RAMP_UP_2__ACCESS_LEVEL, 18, POWER_RAMP_UP_2__MIN_VALUE, POWER_RAMP_UP_2__MAX_VALUE, POWER_RAMP_UP_2__FACTORY_SETTING, 82729UL },
+	{ 1, POWER_RAMP_UP_2_START__ACCESS_LEVEL, 10, POWER_RAMP_UP_2_START__MIN_VALUE, POWER_RAMP_UP_2_START__MAX_VALUE, POWER_RAMP_UP_2_START__FACTORY_SETTING, 82747UL },
+	{ 1, TEC_HEAT_VALUE__ACCESS_LEVEL, 9, TEC_HEAT_VALUE__MIN_VALUE, TEC_HEAT_VALUE__MAX_VALUE, TEC_HEAT_VALUE__FACTORY_SETTING, 82757UL },
+	{ 1, TEC_MAX_FLOW__ACCESS_LEVEL, 22, TEC_MAX_FLOW__MIN_VALUE, TEC_MAX_FLOW__MAX_VALUE, TEC_MAX_FLOW__FACTORY_SETTING, 82766UL },
+	{ 1, TEC_2_MAX_FLOW__ACCESS_LEVEL, 22, TEC_2_MAX_FLOW__MIN_VALUE, TEC_2_MAX_FLOW__MAX_VALUE, TEC_2_MAX_FLOW__FACTORY_SETTING, 82788UL },
+	{ 1, MCPU_MANUAL_RETARD__ACCESS_LEVEL, 10, MCPU_MANUAL_RETARD__MIN_VALUE, MCPU_MANUAL_RETARD__MAX_VALUE, MCPU_MANUAL_RETARD__FACTORY_SETTING, 82810UL },
+	{ 1, DEFAULT_IGNITION_CYLINDER__ACCESS_LEVEL, 3, DEFAULT_IGNITION_CYLINDER__MIN_VALUE, DEFAULT_IGNITION_CYLINDER__MAX_VALUE, DEFAULT_IGNITION_CYLINDER__FACTORY_SETTING, 82820UL },
+	{ 1, IGN_TIMING_OFFSET__ACCESS_LEVEL, 10, IGN_TIMING_OFFSET__MIN_VALUE, IGN_TIMING_OFFSET__MAX_VALUE, IGN_TIMING_OFFSET__FACTORY_SETTING, 82823UL },
+	{ 1, FAB_FLUSHING_TIME__ACCESS_LEVEL, 20, FAB_FLUSHING_TIME__MIN_VALUE, FAB_FLUSHING_TIME__MAX_VALUE, FAB_FLUSHING_TIME__FACTORY_SETTING, 82833UL },
+	{ 1, MAIN_STARTDEMAND_ON_RISING_EDGE__ACCESS_LEVEL, 1, MAIN_STARTDEMAND_ON_RISING_EDGE__MIN_VALUE, MAIN_STARTDEMAND_ON_RISING_EDGE__MAX_VALUE, MAIN_STARTDEMAND_ON_RISING_EDGE__FACTORY_SETTING, 82853UL },
+	{ 1, CHANGE_AFTER_EMERG_STOP__ACCESS_LEVEL, 1, CHANGE_AFTER_EMERG_STOP__MIN_VALUE, CHANGE_AFTER_EMERG_STOP__MAX_VALUE, CHANGE_AFTER_EMERG_STOP__FACTORY_SETTING, 82854UL },
+	{ 1, BSPLUS_CUSTOMER_ID__ACCESS_LEVEL, 20, BSPLUS_CUSTOMER_ID__MIN_VALUE, BSPLUS_CUSTOMER_ID__MAX_VALUE, BSPLUS_CUSTOMER_ID__FACTORY_SETTING, 82855UL },
+	{ 1, BSPLUS_BYTE_SWAP__ACCESS_LEVEL, 1, BSPLUS_BYTE_SWAP__MIN_VALUE, BSPLUS_BYTE_SWAP__MAX_VALUE, BSPLUS_BYTE_SWAP__FACTORY_SETTING, 82875UL },
+	{ 1, BSPLUS_EZA_CONTROL__ACCESS_LEVEL, 1, BSPLUS_EZA_CONTROL__MIN_VALUE, BSPLUS_EZA_CONTROL__MAX_VALUE, BSPLUS_EZA_CONTROL__FACTORY_SETTING, 82876UL },
+	{ 1, BSPLUS_PROFIBUS_TOGGLE__ACCESS_LEVEL, 2, BSPLUS_PROFIBUS_TOGGLE__MIN_VALUE, BSPLUS_PROFIBUS_TOGGLE__MAX_VALUE, BSPLUS_PROFIBUS_TOGGLE__FACTORY_SETTING, 82877UL },
+	{ 1, BSPLUS_ENERGY_UNIT__ACCESS_LEVEL, 1, BSPLUS_ENERGY_UNIT__MIN_VALUE, BSPLUS_ENERGY_UNIT__MAX_VALUE, BSPLUS_ENERGY_UNIT__FACTORY_SETTING, 82879UL },
+	{ 1, GEN_AVR_ACTIVATION_SPEED__ACCESS_LEVEL, 15, GEN_AVR_ACTIVATION_SPEED__MIN_VALUE, GEN_AVR_ACTIVATION_SPEED__MAX_VALUE, GEN_AVR_ACTIVATION_SPEED__FACTORY_SETTING, 82880UL },
+	{ 1, AKR_DEBUG_MODE__ACCESS_LEVEL, 3, AKR_DEBUG_MODE__MIN_VALUE, AKR_DEBUG_MODE__MAX_VALUE, AKR_DEBUG_MODE__FACTORY_SETTING, 82895UL },
+	{ 1, AKR_DEBUG_TRIGGER__ACCESS_LEVEL, 5, AKR_DEBUG_TRIGGER__MIN_VALUE, AKR_DEBUG_TRIGGER__MAX_VALUE, AKR_DEBUG_TRIGGER__FACTORY_SETTING, 82898UL },
+	{ 1, AKR_LR_NOT_OPERATIONAL__ACCESS_LEVEL, 10, AKR_LR_NOT_OPERATIONAL__MIN_VALUE, AKR_LR_NOT_OPERATIONAL__MAX_VALUE, AKR_LR_NOT_OPERATIONAL__FACTORY_SETTING, 82903UL },
+	{ 1, AKR_RESET_IN_STARTPREPARE__ACCESS_LEVEL, 1, AKR_RESET_IN_STARTPREPARE__MIN_VALUE, AKR_RESET_IN_STARTPREPARE__MAX_VALUE, AKR_RESET_IN_STARTPREPARE__FACTORY_SETTING, 82913UL },
+	{ 1, MIX_DK_DEPENDENCY_TECJET__ACCESS_LEVEL, 15, MIX_DK_DEPENDENCY_TECJET__MIN_VALUE, MIX_DK_DEPENDENCY_TECJET__MAX_VALUE, MIX_DK_DEPENDENCY_TECJET__FACTORY_SETTING, 82914UL },
+	{ 1, TEC_FLOW_SETP_AT_10PERCENT_LOAD__ACCESS_LEVEL, 10, TEC_FLOW_SETP_AT_10PERCENT_LOAD__MIN_VALUE, TEC_FLOW_SETP_AT_10PERCENT_LOAD__MAX_VALUE, TEC_FLOW_SETP_AT_10PERCENT_LOAD__FACTORY_SETTING, 82929UL },
+	{ 1, TEC_FLOW_SETP_AT_20PERCENT_LOAD__ACCESS_LEVEL, 10, TEC_FLOW_SETP_AT_20PERCENT_LOAD__MIN_VALUE, TEC_FLOW_SETP_AT_20PERCENT_LOAD__MAX_VALUE, TEC_FLOW_SETP_AT_20PERCENT_LOAD__FACTORY_SETTING, 82939UL },
+	{ 1, TEC_FLOW_SETP_AT_30PERCENT_LOAD__ACCESS_LEVEL, 10, TEC_FLOW_SETP_AT_30PERCENT_LOAD__MIN_VALUE, TEC_FLOW_SETP_AT_30PERCENT_LOAD__MAX_VALUE, TEC_FLOW_SETP_AT_30PERCENT_LOAD__FACTORY_SETTING, 82949UL },
+	{ 1, TEC_FLOW_SETP_AT_40PERCENT_LOAD__ACCESS_LEVEL, 10, TEC_FLOW_SETP_AT_40PERCENT_LOAD__MIN_VALUE, TEC_FLOW_SETP_AT_40PERCENT_LOAD__MAX_VALUE, TEC_FLOW_SETP_AT_40PERCENT_LOAD__FACTORY_SETTING, 82959UL },
+	{ 1, PMS_EXT_LS_MEMBER__ACCESS_LEVEL, 4, PMS_EXT_LS_MEMBER__MIN_VALUE, PMS_EXT_LS_MEMBER__MAX_VALUE, PMS_EXT_LS_MEMBER__FACTORY_SETTING, 82969UL },
+	{ 1, PMS_P_ANALOG_IN_LS_RANGE__ACCESS_LEVEL, 14, PMS_P_ANALOG_IN_LS_RANGE__MIN_VALUE, PMS_P_ANALOG_IN_LS_RANGE__MAX_VALUE, PMS_P_ANALOG_IN_LS_RANGE__FACTORY_SETTING, 82973UL },
+	{ 1, PMS_P_ANALOG_IN_LS_ZERO__ACCESS_LEVEL, 11, PMS_P_ANALOG_IN_LS_ZERO__MIN_VALUE, PMS_P_ANALOG_IN_LS_ZERO__MAX_VALUE, PMS_P_ANALOG_IN_LS_ZERO__FACTORY_SETTING, 82987UL },
+	{ 1, PMS_P_ANALOG_OUT_LS_RANGE__ACCESS_LEVEL, 14, PMS_P_ANALOG_OUT_LS_RANGE__MIN_VALUE, PMS_P_ANALOG_OUT_LS_RANGE__MAX_VALUE, PMS_P_ANALOG_OUT_LS_RANGE__FACTORY_SETTING, 82998UL },
+	{ 1, PMS_P_LS_TYPE__ACCESS_LEVEL, 1, PMS_P_LS_TYPE__MIN_VALUE, PMS_P_LS_TYPE__MAX_VALUE, PMS_P_LS_TYPE__FACTORY_SETTING, 83012UL },
+	{ 1, PMS_Q_LS_TYPE__ACCESS_LEVEL, 1, PMS_Q_LS_TYPE__MIN_VALUE, PMS_Q_LS_TYPE__MAX_VALUE, PMS_Q_LS_TYPE__FACTORY_SETTING, 83013UL },
+	{ 1, MIX_TIMER_NEXT_CALIBRATION_NECESSARY__ACCESS_LEVEL, 26, MIX_TIMER_NEXT_CALIBRATION_NECESSARY__MIN_VALUE, MIX_TIMER_NEXT_CALIBRATION_NECESSARY__MAX_VALUE, MIX_TIMER_NEXT_CALIBRATION_NECESSARY__FACTORY_SETTING, 83014UL },
+	{ 1, MIX_COLD_START_ENRICHMENT__ACCESS_LEVEL, 7, MIX_COLD_START_ENRICHMENT__MIN_VALUE, MIX_COLD_START_ENRICHMENT__MAX_VALUE, MIX_COLD_START_ENRICHMENT__FACTORY_SETTING, 83040UL },
+	{ 1, MIX_COLD_STRT_ENRI_MEAS_POINT__ACCESS_LEVEL, 1, MIX_COLD_STRT_ENRI_MEAS_POINT__MIN_VALUE, MIX_COLD_STRT_ENRI_MEAS_POINT__MAX_VALUE, MIX_COLD_STRT_ENRI_MEAS_POINT__FACTORY_SETTING, 83047UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 83048UL },	// MES_PDI_SC_LEVEL_1
+	{ 0, 0, 32, 0L, 0L, 0L, 83080UL },	// MES_PDI_ALA_ENAB_1
+	{ 0, 0, 32, 0L, 0L, 0L, 83112UL },	// MES_PDI_DEL_TIME_1
+	{ 0, 0, 32, 0L, 0L, 0L, 83144UL },	// MES_PDI_REC_TIME_1
+	{ 0, 0, 32, 0L, 0L, 0L, 83176UL },	// MES_PDI_ACTDELAY_1
+	{ 0, 0, 32, 0L, 0L, 0L, 83208UL },	// MES_PDI_CONFIG___1
+	{ 0, 0, 32, 0L, 0L, 0L, 83240UL },	// MES_PDI_CONF_DO__1
+	{ 0, 0, 32, 0L, 0L, 0L, 83272UL },	// MES_PDI_SC_LEVEL_2
+	{ 0, 0, 32, 0L, 0L, 0L, 83304UL },	// MES_PDI_ALA_ENAB_2
+	{ 0, 0, 32, 0L, 0L, 0L, 83336UL },	// MES_PDI_DEL_TIME_2
+	{ 0, 0, 32, 0L, 0L, 0L, 83368UL },	// MES_PDI_REC_TIME_2
+	{ 0, 0, 32, 0L, 0L, 0L, 83400UL },	// MES_PDI_ACTDELAY_2
+	{ 0, 0, 32, 0L, 0L, 0L, 83432UL },	// MES_PDI_CONFIG___2
+	{ 0, 0, 32, 0L, 0L, 0L, 83464UL },	// MES_PDI_CONF_DO__2
+	{ 0, 0, 32, 0L, 0L, 0L, 83496UL },	// MES_PDI_SC_LEVEL_3
+	{ 0, 0, 32, 0L, 0L, 0L, 83528UL },	// MES_PDI_ALA_ENAB_3
+	{ 0, 0, 32, 0L, 0L, 0L, 83560UL },	// MES_PDI_DEL_TIME_3
+	{ 0, 0, 32, 0L, 0L, 0L, 83592UL },	// MES_PDI_REC_TIME_3
+	{ 0, 0, 32, 0L, 0L, 0L, 83624UL },	// MES_PDI_ACTDELAY_3
+	{ 0, 0, 32, 0L, 0L, 0L, 83656UL },	// MES_PDI_CONFIG___3
+	{ 0, 0, 32, 0L, 0L, 0L, 83688UL },	// MES_PDI_CONF_DO__3
+	{ 0, 0, 32, 0L, 0L, 0L, 83720UL },	// MES_PDI_SC_LEVEL_4
+	{ 0, 0, 32, 0L, 0L, 0L, 83752UL },	// MES_PDI_ALA_ENAB_4
+	{ 0, 0, 32, 0L, 0L, 0L, 83784UL },	// MES_PDI_DEL_TIME_4
+	{ 0, 0, 32, 0L, 0L, 0L, 83816UL },	// MES_PDI_REC_TIME_4
+	{ 0, 0, 32, 0L, 0L, 0L, 83848UL },	// MES_PDI_ACTDELAY_4
+	{ 0, 0, 32, 0L, 0L, 0L, 83880UL },	// MES_PDI_CONFIG___4
+	{ 0, 0, 32, 0L, 0L, 0L, 83912UL },	// MES_PDI_CONF_DO__4
+	{ 0, 0, 32, 0L, 0L, 0L, 83944UL },	// MES_PDI_SC_LEVEL_5
+	{ 0, 0, 32, 0L, 0L, 0L, 83976UL },	// MES_PDI_ALA_ENAB_5
+	{ 0, 0, 32, 0L, 0L, 0L, 84008UL },	// MES_PDI_DEL_TIME_5
+	{ 0, 0, 32, 0L, 0L, 0L, 84040UL },	// MES_PDI_REC_TIME_5
+	{ 0, 0, 32, 0L, 0L, 0L, 84072UL },	// MES_PDI_ACTDELAY_5
+	{ 0, 0, 32, 0L, 0L, 0L, 84104UL },	// MES_PDI_CONFIG___5
+	{ 0, 0, 32, 0L, 0L, 0L, 84136UL },	// MES_PDI_CONF_DO__5
+	{ 0, 0, 32, 0L, 0L, 0L, 84168UL },	// MES_PDI_SC_LEVEL_6
+	{ 0, 0, 32, 0L, 0L, 0L, 84200UL },	// MES_PDI_ALA_ENAB_6
+	{ 0, 0, 32, 0L, 0L, 0L, 84232UL },	// MES_PDI_DEL_TIME_6
+	{ 0, 0, 32, 0L, 0L, 0L, 84264UL },	// MES_PDI_REC_TIME_6
+	{ 0, 0, 32, 0L, 0L, 0L, 84296UL },	// MES_PDI_ACTDELAY_6
+	{ 0, 0, 32, 0L, 0L, 0L, 84328UL },	// MES_PDI_CONFIG___6
+	{ 0, 0, 32, 0L, 0L, 0L, 84360UL },	// MES_PDI_CONF_DO__6
+	{ 0, 0, 32, 0L, 0L, 0L, 84392UL },	// MES_PDI_SC_LEVEL_7
+	{ 0, 0, 32, 0L, 0L, 0L, 84424UL },	// MES_PDI_ALA_ENAB_7
+	{ 0, 0, 32, 0L, 0L, 0L, 84456UL },	// MES_PDI_DEL_TIME_7
+	{ 0, 0, 32, 0L, 0L, 0L, 84488UL },	// MES_PDI_REC_TIME_7
+	{ 0, 0, 32, 0L, 0L, 0L, 84520UL },	// MES_PDI_ACTDELAY_7
+	{ 0, 0, 32, 0L, 0L, 0L, 84552UL },	// MES_PDI_CONFIG___7
+	{ 0, 0, 32, 0L, 0L, 0L, 84584UL },	// MES_PDI_CONF_DO__7
+	{ 0, 0, 32, 0L, 0L, 0L, 84616UL },	// MES_PDI_SC_LEVEL_8
+	{ 0, 0, 32, 0L, 0L, 0L, 84648UL },	// MES_PDI_ALA_ENAB_8
+	{ 0, 0, 32, 0L, 0L, 0L, 84680UL },	// MES_PDI_DEL_TIME_8
+	{ 0, 0, 32, 0L, 0L, 0L, 84712UL },	// MES_PDI_REC_TIME_8
+	{ 0, 0, 32, 0L, 0L, 0L, 84744UL },	// MES_PDI_ACTDELAY_8
+	{ 0, 0, 32, 0L, 0L, 0L, 84776UL },	// MES_PDI_CONFIG___8
+	{ 0, 0, 32, 0L, 0L, 0L, 84808UL },	// MES_PDI_CONF_DO__8
+	{ 0, 0, 32, 0L, 0L, 0L, 84840UL },	// MES_PDI_SC_LEVEL_9
+	{ 0, 0, 32, 0L, 0L, 0L, 84872UL },	// MES_PDI_ALA_ENAB_9
+	{ 0, 0, 32, 0L, 0L, 0L, 84904UL },	// MES_PDI_DEL_TIME_9
+	{ 0, 0, 32, 0L, 0L, 0L, 84936UL },	// MES_PDI_REC_TIME_9
+	{ 0, 0, 32, 0L, 0L, 0L, 84968UL },	// MES_PDI_ACTDELAY_9
+	{ 0, 0, 32, 0L, 0L, 0L, 85000UL },	// MES_PDI_CONFIG___9
+	{ 0, 0, 32, 0L, 0L, 0L, 85032UL },	// MES_PDI_CONF_DO__9
+	{ 0, 0, 32, 0L, 0L, 0L, 85064UL },	// MES_PDI_SC_LEVEL_10
+	{ 0, 0, 32, 0L, 0L, 0L, 85096UL },	// MES_PDI_ALA_ENAB_10
+	{ 0, 0, 32, 0L, 0L, 0L, 85128UL },	// MES_PDI_DEL_TIME_10
+	{ 0, 0, 32, 0L, 0L, 0L, 85160UL },	// MES_PDI_REC_TIME_10
+	{ 0, 0, 32, 0L, 0L, 0L, 85192UL },	// MES_PDI_ACTDELAY_10
+	{ 0, 0, 32, 0L, 0L, 0L, 85224UL },	// MES_PDI_CONFIG___10
+	{ 0, 0, 32, 0L, 0L, 0L, 85256UL },	// MES_PDI_CONF_DO__10
+	{ 0, 0, 32, 0L, 0L, 0L, 85288UL },	// MES_PDI_SC_LEVEL_11
+	{ 0, 0, 32, 0L, 0L, 0L, 85320UL },	// MES_PDI_ALA_ENAB_11
+	{ 0, 0, 32, 0L, 0L, 0L, 85352UL },	// MES_PDI_DEL_TIME_11
+	{ 0, 0, 32, 0L, 0L, 0L, 85384UL },	// MES_PDI_REC_TIME_11
+	{ 0, 0, 32, 0L, 0L, 0L, 85416UL },	// MES_PDI_ACTDELAY_11
+	{ 0, 0, 32, 0L, 0L, 0L, 85448UL },	// MES_PDI_CONFIG___11
+	{ 0, 0, 32, 0L, 0L, 0L, 85480UL },	// MES_PDI_CONF_DO__11
+	{ 0, 0, 32, 0L, 0L, 0L, 85512UL },	// MES_PDI_SC_LEVEL_12
+	{ 0, 0, 32, 0L, 0L, 0L, 85544UL },	// MES_PDI_ALA_ENAB_12
+	{ 0, 0, 32, 0L, 0L, 0L, 85576UL },	// MES_PDI_DEL_TIME_12
+	{ 0, 0, 32, 0L, 0L, 0L, 85608UL },	// MES_PDI_REC_TIME_12
+	{ 0, 0, 32, 0L, 0L, 0L, 85640UL },	// MES_PDI_ACTDELAY_12
+	{ 0, 0, 32, 0L, 0L, 0L, 85672UL },	// MES_PDI_CONFIG___12
+	{ 0, 0, 32, 0L, 0L, 0L, 85704UL },	// MES_PDI_CONF_DO__12
+	{ 0, 0, 32, 0L, 0L, 0L, 85736UL },	// MES_PDI_SC_LEVEL_13
+	{ 0, 0, 32, 0L, 0L, 0L, 85768UL },	// MES_PDI_ALA_ENAB_13
+	{ 0, 0, 32, 0L, 0L, 0L, 85800UL },	// MES_PDI_DEL_TIME_13
+	{ 0, 0, 32, 0L, 0L, 0L, 85832UL },	// MES_PDI_REC_TIME_13
+	{ 0, 0, 32, 0L, 0L, 0L, 85864UL },	// MES_PDI_ACTDELAY_13
+	{ 0, 0, 32, 0L, 0L, 0L, 85896UL },	// MES_PDI_CONFIG___13
+	{ 0, 0, 32, 0L, 0L, 0L, 85928UL },	// MES_PDI_CONF_DO__13
+	{ 0, 0, 32, 0L, 0L, 0L, 85960UL },	// MES_PDI_SC_LEVEL_14
+	{ 0, 0, 32, 0L, 0L, 0L, 85992UL },	// MES_PDI_ALA_ENAB_14
+	{ 0, 0, 32, 0L, 0L, 0L, 86024UL },	// MES_PDI_DEL_TIME_14
+	{ 0, 0, 32, 0L, 0L, 0L, 86056UL },	// MES_PDI_REC_TIME_14
+	{ 0, 0, 32, 0L, 0L, 0L, 86088UL },	// MES_PDI_ACTDELAY_14
+	{ 0, 0, 32, 0L, 0L, 0L, 86120UL },	// MES_PDI_CONFIG___14
+	{ 0, 0, 32, 0L, 0L, 0L, 86152UL },	// MES_PDI_CONF_DO__14
+	{ 0, 0, 32, 0L, 0L, 0L, 86184UL },	// MES_PDI_SC_LEVEL_15
+	{ 0, 0, 32, 0L, 0L, 0L, 86216UL },	// MES_PDI_ALA_ENAB_15
+	{ 0, 0, 32, 0L, 0L, 0L, 86248UL },	// MES_PDI_DEL_TIME_15
+	{ 0, 0, 32, 0L, 0L, 0L, 86280UL },	// MES_PDI_REC_TIME_15
+	{ 0, 0, 32, 0L, 0L, 0L, 86312UL },	// MES_PDI_ACTDELAY_15
+	{ 0, 0, 32, 0L, 0L, 0L, 86344UL },	// MES_PDI_CONFIG___15
+	{ 0, 0, 32, 0L, 0L, 0L, 86376UL },	// MES_PDI_CONF_DO__15
+	{ 0, 0, 32, 0L, 0L, 0L, 86408UL },	// MES_PDI_SC_LEVEL_16
+	{ 0, 0, 32, 0L, 0L, 0L, 86440UL },	// MES_PDI_ALA_ENAB_16
+	{ 0, 0, 32, 0L, 0L, 0L, 86472UL },	// MES_PDI_DEL_TIME_16
+	{ 0, 0, 32, 0L, 0L, 0L, 86504UL },	// MES_PDI_REC_TIME_16
+	{ 0, 0, 32, 0L, 0L, 0L, 86536UL },	// MES_PDI_ACTDELAY_16
+	{ 0, 0, 32, 0L, 0L, 0L, 86568UL },	// MES_PDI_CONFIG___16
+	{ 0, 0, 32, 0L, 0L, 0L, 86600UL },	// MES_PDI_CONF_DO__16
+	{ 0, 0, 32, 0L, 0L, 0L, 86632UL },	// MES_PDI_SC_LEVEL_17
+	{ 0, 0, 32, 0L, 0L, 0L, 86664UL },	// MES_PDI_ALA_ENAB_17
+	{ 0, 0, 32, 0L, 0L, 0L, 86696UL },	// MES_PDI_DEL_TIME_17
+	{ 0, 0, 32, 0L, 0L, 0L, 86728UL },	// MES_PDI_REC_TIME_17
+	{ 0, 0, 32, 0L, 0L, 0L, 86760UL },	// MES_PDI_ACTDELAY_17
+	{ 0, 0, 32, 0L, 0L, 0L, 86792UL },	// MES_PDI_CONFIG___17
+	{ 0, 0, 32, 0L, 0L, 0L, 86824UL },	// MES_PDI_CONF_DO__17
+	{ 0, 0, 32, 0L, 0L, 0L, 86856UL },	// MES_PDI_SC_LEVEL_18
+	{ 0, 0, 32, 0L, 0L, 0L, 86888UL },	// MES_PDI_ALA_ENAB_18
+	{ 0, 0, 32, 0L, 0L, 0L, 86920UL },	// MES_PDI_DEL_TIME_18
+	{ 0, 0, 32, 0L, 0L, 0L, 86952UL },	// MES_PDI_REC_TIME_18
+	{ 0, 0, 32, 0L, 0L, 0L, 86984UL },	// MES_PDI_ACTDELAY_18
+	{ 0, 0, 32, 0L, 0L, 0L, 87016UL },	// MES_PDI_CONFIG___18
+	{ 0, 0, 32, 0L, 0L, 0L, 87048UL },	// MES_PDI_CONF_DO__18
+	{ 0, 0, 32, 0L, 0L, 0L, 87080UL },	// MES_PDI_SC_LEVEL_19
+	{ 0, 0, 32, 0L, 0L, 0L, 87112UL },	// MES_PDI_ALA_ENAB_19
+	{ 0, 0, 32, 0L, 0L, 0L, 87144UL },	// MES_PDI_DEL_TIME_19
+	{ 0, 0, 32, 0L, 0L, 0L, 87176UL },	// MES_PDI_REC_TIME_19
+	{ 0, 0, 32, 0L, 0L, 0L, 87208UL },	// MES_PDI_ACTDELAY_19
+	{ 0, 0, 32, 0L, 0L, 0L, 87240UL },	// MES_PDI_CONFIG___19
+	{ 0, 0, 32, 0L, 0L, 0L, 87272UL },	// MES_PDI_CONF_DO__19
+	{ 0, 0, 32, 0L, 0L, 0L, 87304UL },	// MES_PDI_SC_LEVEL_20
+	{ 0, 0, 32, 0L, 0L, 0L, 87336UL },	// MES_PDI_ALA_ENAB_20
+	{ 0, 0, 32, 0L, 0L, 0L, 87368UL },	// MES_PDI_DEL_TIME_20
+	{ 0, 0, 32, 0L, 0L, 0L, 87400UL },	// MES_PDI_REC_TIME_20
+	{ 0, 0, 32, 0L, 0L, 0L, 87432UL },	// MES_PDI_ACTDELAY_20
+	{ 0, 0, 32, 0L, 0L, 0L, 87464UL },	// MES_PDI_CONFIG___20
+	{ 0, 0, 32, 0L, 0L, 0L, 87496UL },	// MES_PDI_CONF_DO__20
+	{ 0, 0, 32, 0L, 0L, 0L, 87528UL },	// MES_PDI_SC_LEVEL_21
+	{ 0, 0, 32, 0L, 0L, 0L, 87560UL },	// MES_PDI_ALA_ENAB_21
+	{ 0, 0, 32, 0L, 0L, 0L, 87592UL },	// MES_PDI_DEL_TIME_21
+	{ 0, 0, 32, 0L, 0L, 0L, 87624UL },	// MES_PDI_REC_TIME_21
+	{ 0, 0, 32, 0L, 0L, 0L, 87656UL },	// MES_PDI_ACTDELAY_21
+	{ 0, 0, 32, 0L, 0L, 0L, 87688UL },	// MES_PDI_CONFIG___21
+	{ 0, 0, 32, 0L, 0L, 0L, 87720UL },	// MES_PDI_CONF_DO__21
+	{ 0, 0, 32, 0L, 0L, 0L, 87752UL },	// MES_PDI_SC_LEVEL_22
+	{ 0, 0, 32, 0L, 0L, 0L, 87784UL },	// MES_PDI_ALA_ENAB_22
+	{ 0, 0, 32, 0L, 0L, 0L, 87816UL },	// MES_PDI_DEL_TIME_22
+	{ 0, 0, 32, 0L, 0L, 0L, 87848UL },	// MES_PDI_REC_TIME_22
+	{ 0, 0, 32, 0L, 0L, 0L, 87880UL },	// MES_PDI_ACTDELAY_22
+	{ 0, 0, 32, 0L, 0L, 0L, 87912UL },	// MES_PDI_CONFIG___22
+	{ 0, 0, 32, 0L, 0L, 0L, 87944UL },	// MES_PDI_CONF_DO__22
+	{ 0, 0, 32, 0L, 0L, 0L, 87976UL },	// MES_PDI_SC_LEVEL_23
+	{ 0, 0, 32, 0L, 0L, 0L, 88008UL },	// MES_PDI_ALA_ENAB_23
+	{ 0, 0, 32, 0L, 0L, 0L, 88040UL },	// MES_PDI_DEL_TIME_23
+	{ 0, 0, 32, 0L, 0L, 0L, 88072UL },	// MES_PDI_REC_TIME_23
+	{ 0, 0, 32, 0L, 0L, 0L, 88104UL },	// MES_PDI_ACTDELAY_23
+	{ 0, 0, 32, 0L, 0L, 0L, 88136UL },	// MES_PDI_CONFIG___23
+	{ 0, 0, 32, 0L, 0L, 0L, 88168UL },	// MES_PDI_CONF_DO__23
+	{ 0, 0, 32, 0L, 0L, 0L, 88200UL },	// MES_PDI_SC_LEVEL_24
+	{ 0, 0, 32, 0L, 0L, 0L, 88232UL },	// MES_PDI_ALA_ENAB_24
+	{ 0, 0, 32, 0L, 0L, 0L, 88264UL },	// MES_PDI_DEL_TIME_24
+	{ 0, 0, 32, 0L, 0L, 0L, 88296UL },	// MES_PDI_REC_TIME_24
+	{ 0, 0, 32, 0L, 0L, 0L, 88328UL },	// MES_PDI_ACTDELAY_24
+	{ 0, 0, 32, 0L, 0L, 0L, 88360UL },	// MES_PDI_CONFIG___24
+	{ 0, 0, 32, 0L, 0L, 0L, 88392UL },	// MES_PDI_CONF_DO__24
+	{ 0, 0, 32, 0L, 0L, 0L, 88424UL },	// MES_PDI_SC_LEVEL_25
+	{ 0, 0, 32, 0L, 0L, 0L, 88456UL },	// MES_PDI_ALA_ENAB_25
+	{ 0, 0, 32, 0L, 0L, 0L, 88488UL },	// MES_PDI_DEL_TIME_25
+	{ 0, 0, 32, 0L, 0L, 0L, 88520UL },	// MES_PDI_REC_TIME_25
+	{ 0, 0, 32, 0L, 0L, 0L, 88552UL },	// MES_PDI_ACTDELAY_25
+	{ 0, 0, 32, 0L, 0L, 0L, 88584UL },	// MES_PDI_CONFIG___25
+	{ 0, 0, 32, 0L, 0L, 0L, 88616UL },	// MES_PDI_CONF_DO__25
+	{ 0, 0, 32, 0L, 0L, 0L, 88648UL },	// MES_PDI_SC_LEVEL_26
+	{ 0, 0, 32, 0L, 0L, 0L, 88680UL },	// MES_PDI_ALA_ENAB_26
+	{ 0, 0, 32, 0L, 0L, 0L, 88712UL },	// MES_PDI_DEL_TIME_26
+	{ 0, 0, 32, 0L, 0L, 0L, 88744UL },	// MES_PDI_REC_TIME_26
+	{ 0, 0, 32, 0L, 0L, 0L, 88776UL },	// MES_PDI_ACTDELAY_26
+	{ 0, 0, 32, 0L, 0L, 0L, 88808UL },	// MES_PDI_CONFIG___26
+	{ 0, 0, 32, 0L, 0L, 0L, 88840UL },	// MES_PDI_CONF_DO__26
+	{ 0, 0, 32, 0L, 0L, 0L, 88872UL },	// MES_PDI_SC_LEVEL_27
+	{ 0, 0, 32, 0L, 0L, 0L, 88904UL },	// MES_PDI_ALA_ENAB_27
+	{ 0, 0, 32, 0L, 0L, 0L, 88936UL },	// MES_PDI_DEL_TIME_27
+	{ 0, 0, 32, 0L, 0L, 0L, 88968UL },	// MES_PDI_REC_TIME_27
+	{ 0, 0, 32, 0L, 0L, 0L, 89000UL },	// MES_PDI_ACTDELAY_27
+	{ 0, 0, 32, 0L, 0L, 0L, 89032UL },	// MES_PDI_CONFIG___27
+	{ 0, 0, 32, 0L, 0L, 0L, 89064UL },	// MES_PDI_CONF_DO__27
+	{ 0, 0, 32, 0L, 0L, 0L, 89096UL },	// MES_PDI_SC_LEVEL_28
+	{ 0, 0, 32, 0L, 0L, 0L, 89128UL },	// MES_PDI_ALA_ENAB_28
+	{ 0, 0, 32, 0L, 0L, 0L, 89160UL },	// MES_PDI_DEL_TIME_28
+	{ 0, 0, 32, 0L, 0L, 0L, 89192UL },	// MES_PDI_REC_TIME_28
+	{ 0, 0, 32, 0L, 0L, 0L, 89224UL },	// MES_PDI_ACTDELAY_28
+	{ 0, 0, 32, 0L, 0L, 0L, 89256UL },	// MES_PDI_CONFIG___28
+	{ 0, 0, 32, 0L, 0L, 0L, 89288UL },	// MES_PDI_CONF_DO__28
+	{ 0, 0, 32, 0L, 0L, 0L, 89320UL },	// MES_PDI_SC_LEVEL_29
+	{ 0, 0, 32, 0L, 0L, 0L, 89352UL },	// MES_PDI_ALA_ENAB_29
+	{ 0, 0, 32, 0L, 0L, 0L, 89384UL },	// MES_PDI_DEL_TIME_29
+	{ 0, 0, 32, 0L, 0L, 0L, 89416UL },	// MES_PDI_REC_TIME_29
+	{ 0, 0, 32, 0L, 0L, 0L, 89448UL },	// MES_PDI_ACTDELAY_29
+	{ 0, 0, 32, 0L, 0L, 0L, 89480UL },	// MES_PDI_CONFIG___29
+	{ 0, 0, 32, 0L, 0L, 0L, 89512UL },	// MES_PDI_CONF_DO__29
+	{ 0, 0, 32, 0L, 0L, 0L, 89544UL },	// MES_PDI_SC_LEVEL_30
+	{ 0, 0, 32, 0L, 0L, 0L, 89576UL },	// MES_PDI_ALA_ENAB_30
+	{ 0, 0, 32, 0L, 0L, 0L, 89608UL },	// MES_PDI_DEL_TIME_30
+	{ 0, 0, 32, 0L, 0L, 0L, 89640UL },	// MES_PDI_REC_TIME_30
+	{ 0, 0, 32, 0L, 0L, 0L, 89672UL },	// MES_PDI_ACTDELAY_30
+	{ 0, 0, 32, 0L, 0L, 0L, 89704UL },	// MES_PDI_CONFIG___30
+	{ 0, 0, 32, 0L, 0L, 0L, 89736UL },	// MES_PDI_CONF_DO__30
+	{ 0, 0, 32, 0L, 0L, 0L, 89768UL },	// MES_PDI_SC_LEVEL_31
+	{ 0, 0, 32, 0L, 0L, 0L, 89800UL },	// MES_PDI_ALA_ENAB_31
+	{ 0, 0, 32, 0L, 0L, 0L, 89832UL },	// MES_PDI_DEL_TIME_31
+	{ 0, 0, 32, 0L, 0L, 0L, 89864UL },	// MES_PDI_REC_TIME_31
+	{ 0, 0, 32, 0L, 0L, 0L, 89896UL },	// MES_PDI_ACTDELAY_31
+	{ 0, 0, 32, 0L, 0L, 0L, 89928UL },	// MES_PDI_CONFIG___31
+	{ 0, 0, 32, 0L, 0L, 0L, 89960UL },	// MES_PDI_CONF_DO__31
+	{ 0, 0, 32, 0L, 0L, 0L, 89992UL },	// MES_PDI_SC_LEVEL_32
+	{ 0, 0, 32, 0L, 0L, 0L, 90024UL },	// MES_PDI_ALA_ENAB_32
+	{ 0, 0, 32, 0L, 0L, 0L, 90056UL },	// MES_PDI_DEL_TIME_32
+	{ 0, 0, 32, 0L, 0L, 0L, 90088UL },	// MES_PDI_REC_TIME_32
+	{ 0, 0, 32, 0L, 0L, 0L, 90120UL },	// MES_PDI_ACTDELAY_32
+	{ 0, 0, 32, 0L, 0L, 0L, 90152UL },	// MES_PDI_CONFIG___32
+	{ 0, 0, 32, 0L, 0L, 0L, 90184UL },	// MES_PDI_CONF_DO__32
+	{ 0, 0, 32, 0L, 0L, 0L, 90216UL },	// MES_PDI_SC_LEVEL_33
+	{ 0, 0, 32, 0L, 0L, 0L, 90248UL },	// MES_PDI_ALA_ENAB_33
+	{ 0, 0, 32, 0L, 0L, 0L, 90280UL },	// MES_PDI_DEL_TIME_33
+	{ 0, 0, 32, 0L, 0L, 0L, 90312UL },	// MES_PDI_REC_TIME_33
+	{ 0, 0, 32, 0L, 0L, 0L, 90344UL },	// MES_PDI_ACTDELAY_33
+	{ 0, 0, 32, 0L, 0L, 0L, 90376UL },	// MES_PDI_CONFIG___33
+	{ 0, 0, 32, 0L, 0L, 0L, 90408UL },	// MES_PDI_CONF_DO__33
+	{ 0, 0, 32, 0L, 0L, 0L, 90440UL },	// MES_PDI_SC_LEVEL_34
+	{ 0, 0, 32, 0L, 0L, 0L, 90472UL },	// MES_PDI_ALA_ENAB_34
+	{ 0, 0, 32, 0L, 0L, 0L, 90504UL },	// MES_PDI_DEL_TIME_34
+	{ 0, 0, 32, 0L, 0L, 0L, 90536UL },	// MES_PDI_REC_TIME_34
+	{ 0, 0, 32, 0L, 0L, 0L, 90568UL },	// MES_PDI_ACTDELAY_34
+	{ 0, 0, 32, 0L, 0L, 0L, 90600UL },	// MES_PDI_CONFIG___34
+	{ 0, 0, 32, 0L, 0L, 0L, 90632UL },	// MES_PDI_CONF_DO__34
+	{ 0, 0, 32, 0L, 0L, 0L, 90664UL },	// MES_PDI_SC_LEVEL_35
+	{ 0, 0, 32, 0L, 0L, 0L, 90696UL },	// MES_PDI_ALA_ENAB_35
+	{ 0, 0, 32, 0L, 0L, 0L, 90728UL },	// MES_PDI_DEL_TIME_35
+	{ 0, 0, 32, 0L, 0L, 0L, 90760UL },	// MES_PDI_REC_TIME_35
+	{ 0, 0, 32, 0L, 0L, 0L, 90792UL },	// MES_PDI_ACTDELAY_35
+	{ 0, 0, 32, 0L, 0L, 0L, 90824UL },	// MES_PDI_CONFIG___35
+	{ 0, 0, 32, 0L, 0L, 0L, 90856UL },	// MES_PDI_CONF_DO__35
+	{ 0, 0, 32, 0L, 0L, 0L, 90888UL },	// MES_PDI_SC_LEVEL_36
+	{ 0, 0, 32, 0L, 0L, 0L, 90920UL },	// MES_PDI_ALA_ENAB_36
+	{ 0, 0, 32, 0L, 0L, 0L, 90952UL },	// MES_PDI_DEL_TIME_36
+	{ 0, 0, 32, 0L, 0L, 0L, 90984UL },	// MES_PDI_REC_TIME_36
+	{ 0, 0, 32, 0L, 0L, 0L, 91016UL },	// MES_PDI_ACTDELAY_36
+	{ 0, 0, 32, 0L, 0L, 0L, 91048UL },	// MES_PDI_CONFIG___36
+	{ 0, 0, 32, 0L, 0L, 0L, 91080UL },	// MES_PDI_CONF_DO__36
+	{ 0, 0, 32, 0L, 0L, 0L, 91112UL },	// MES_PDI_SC_LEVEL_37
+	{ 0, 0, 32, 0L, 0L, 0L, 91144UL },	// MES_PDI_ALA_ENAB_37
+	{ 0, 0, 32, 0L, 0L, 0L, 91176UL },	// MES_PDI_DEL_TIME_37
+	{ 0, 0, 32, 0L, 0L, 0L, 91208UL },	// MES_PDI_REC_TIME_37
+	{ 0, 0, 32, 0L, 0L, 0L, 91240UL },	// MES_PDI_ACTDELAY_37
+	{ 0, 0, 32, 0L, 0L, 0L, 91272UL },	// MES_PDI_CONFIG___37
+	{ 0, 0, 32, 0L, 0L, 0L, 91304UL },	// MES_PDI_CONF_DO__37
+	{ 0, 0, 32, 0L, 0L, 0L, 91336UL },	// MES_PDI_SC_LEVEL_38
+	{ 0, 0, 32, 0L, 0L, 0L, 91368UL },	// MES_PDI_ALA_ENAB_38
+	{ 0, 0, 32, 0L, 0L, 0L, 91400UL },	// MES_PDI_DEL_TIME_38
+	{ 0, 0, 32, 0L, 0L, 0L, 91432UL },	// MES_PDI_REC_TIME_38
+	{ 0, 0, 32, 0L, 0L, 0L, 91464UL },	// MES_PDI_ACTDELAY_38
+	{ 0, 0, 32, 0L, 0L, 0L, 91496UL },	// MES_PDI_CONFIG___38
+	{ 0, 0, 32, 0L, 0L, 0L, 91528UL },	// MES_PDI_CONF_DO__38
+	{ 0, 0, 32, 0L, 0L, 0L, 91560UL },	// MES_PDI_SC_LEVEL_39
+	{ 0, 0, 32, 0L, 0L, 0L, 91592UL },	// MES_PDI_ALA_ENAB_39
+	{ 0, 0, 32, 0L, 0L, 0L, 91624UL },	// MES_PDI_DEL_TIME_39
+	{ 0, 0, 32, 0L, 0L, 0L, 91656UL },	// MES_PDI_REC_TIME_39
+	{ 0, 0, 32, 0L, 0L, 0L, 91688UL },	// MES_PDI_ACTDELAY_39
+	{ 0, 0, 32, 0L, 0L, 0L, 91720UL },	// MES_PDI_CONFIG___39
+	{ 0, 0, 32, 0L, 0L, 0L, 91752UL },	// MES_PDI_CONF_DO__39
+	{ 0, 0, 32, 0L, 0L, 0L, 91784UL },	// MES_PDI_SC_LEVEL_40
+	{ 0, 0, 32, 0L, 0L, 0L, 91816UL },	// MES_PDI_ALA_ENAB_40
+	{ 0, 0, 32, 0L, 0L, 0L, 91848UL },	// MES_PDI_DEL_TIME_40
+	{ 0, 0, 32, 0L, 0L, 0L, 91880UL },	// MES_PDI_REC_TIME_40
+	{ 0, 0, 32, 0L, 0L, 0L, 91912UL },	// MES_PDI_ACTDELAY_40
+	{ 0, 0, 32, 0L, 0L, 0L, 91944UL },	// MES_PDI_CONFIG___40
+	{ 0, 0, 32, 0L, 0L, 0L, 91976UL },	// MES_PDI_CONF_DO__40
+	{ 0, 0, 32, 0L, 0L, 0L, 92008UL },	// MES_PDI_SC_LEVEL_41
+	{ 0, 0, 32, 0L, 0L, 0L, 92040UL },	// MES_PDI_ALA_ENAB_41
+	{ 0, 0, 32, 0L, 0L, 0L, 92072UL },	// MES_PDI_DEL_TIME_41
+	{ 0, 0, 32, 0L, 0L, 0L, 92104UL },	// MES_PDI_REC_TIME_41
+	{ 0, 0, 32, 0L, 0L, 0L, 92136UL },	// MES_PDI_ACTDELAY_41
+	{ 0, 0, 32, 0L, 0L, 0L, 92168UL },	// MES_PDI_CONFIG___41
+	{ 0, 0, 32, 0L, 0L, 0L, 92200UL },	// MES_PDI_CONF_DO__41
+	{ 0, 0, 32, 0L, 0L, 0L, 92232UL },	// MES_PDI_SC_LEVEL_42
+	{ 0, 0, 32, 0L, 0L, 0L, 92264UL },	// MES_PDI_ALA_ENAB_42
+	{ 0, 0, 32, 0L, 0L, 0L, 92296UL },	// MES_PDI_DEL_TIME_42
+	{ 0, 0, 32, 0L, 0L, 0L, 92328UL },	// MES_PDI_REC_TIME_42
+	{ 0, 0, 32, 0L, 0L, 0L, 92360UL },	// MES_PDI_ACTDELAY_42
+	{ 0, 0, 32, 0L, 0L, 0L, 92392UL },	// MES_PDI_CONFIG___42
+	{ 0, 0, 32, 0L, 0L, 0L, 92424UL },	// MES_PDI_CONF_DO__42
+	{ 0, 0, 32, 0L, 0L, 0L, 92456UL },	// MES_PDI_SC_LEVEL_43
+	{ 0, 0, 32, 0L, 0L, 0L, 92488UL },	// MES_PDI_ALA_ENAB_43
+	{ 0, 0, 32, 0L, 0L, 0L, 92520UL },	// MES_PDI_DEL_TIME_43
+	{ 0, 0, 32, 0L, 0L, 0L, 92552UL },	// MES_PDI_REC_TIME_43
+	{ 0, 0, 32, 0L, 0L, 0L, 92584UL },	// MES_PDI_ACTDELAY_43
+	{ 0, 0, 32, 0L, 0L, 0L, 92616UL },	// MES_PDI_CONFIG___43
+	{ 0, 0, 32, 0L, 0L, 0L, 92648UL },	// MES_PDI_CONF_DO__43
+	{ 0, 0, 32, 0L, 0L, 0L, 92680UL },	// MES_PDI_SC_LEVEL_44
+	{ 0, 0, 32, 0L, 0L, 0L, 92712UL },	// MES_PDI_ALA_ENAB_44
+	{ 0, 0, 32, 0L, 0L, 0L, 92744UL },	// MES_PDI_DEL_TIME_44
+	{ 0, 0, 32, 0L, 0L, 0L, 92776UL },	// MES_PDI_REC_TIME_44
+	{ 0, 0, 32, 0L, 0L, 0L, 92808UL },	// MES_PDI_ACTDELAY_44
+	{ 0, 0, 32, 0L, 0L, 0L, 92840UL },	// MES_PDI_CONFIG___44
+	{ 0, 0, 32, 0L, 0L, 0L, 92872UL },	// MES_PDI_CONF_DO__44
+	{ 0, 0, 32, 0L, 0L, 0L, 92904UL },	// MES_PDI_SC_LEVEL_45
+	{ 0, 0, 32, 0L, 0L, 0L, 92936UL },	// MES_PDI_ALA_ENAB_45
+	{ 0, 0, 32, 0L, 0L, 0L, 92968UL },	// MES_PDI_DEL_TIME_45
+	{ 0, 0, 32, 0L, 0L, 0L, 93000UL },	// MES_PDI_REC_TIME_45
+	{ 0, 0, 32, 0L, 0L, 0L, 93032UL },	// MES_PDI_ACTDELAY_45
+	{ 0, 0, 32, 0L, 0L, 0L, 93064UL },	// MES_PDI_CONFIG___45
+	{ 0, 0, 32, 0L, 0L, 0L, 93096UL },	// MES_PDI_CONF_DO__45
+	{ 0, 0, 32, 0L, 0L, 0L, 93128UL },	// MES_PDI_SC_LEVEL_46
+	{ 0, 0, 32, 0L, 0L, 0L, 93160UL },	// MES_PDI_ALA_ENAB_46
+	{ 0, 0, 32, 0L, 0L, 0L, 93192UL },	// MES_PDI_DEL_TIME_46
+	{ 0, 0, 32, 0L, 0L, 0L, 93224UL },	// MES_PDI_REC_TIME_46
+	{ 0, 0, 32, 0L, 0L, 0L, 93256UL },	// MES_PDI_ACTDELAY_46
+	{ 0, 0, 32, 0L, 0L, 0L, 93288UL },	// MES_PDI_CONFIG___46
+	{ 0, 0, 32, 0L, 0L, 0L, 93320UL },	// MES_PDI_CONF_DO__46
+	{ 0, 0, 32, 0L, 0L, 0L, 93352UL },	// MES_PDI_SC_LEVEL_47
+	{ 0, 0, 32, 0L, 0L, 0L, 93384UL },	// MES_PDI_ALA_ENAB_47
+	{ 0, 0, 32, 0L, 0L, 0L, 93416UL },	// MES_PDI_DEL_TIME_47
+	{ 0, 0, 32, 0L, 0L, 0L, 93448UL },	// MES_PDI_REC_TIME_47
+	{ 0, 0, 32, 0L, 0L, 0L, 93480UL },	// MES_PDI_ACTDELAY_47
+	{ 0, 0, 32, 0L, 0L, 0L, 93512UL },	// MES_PDI_CONFIG___47
+	{ 0, 0, 32, 0L, 0L, 0L, 93544UL },	// MES_PDI_CONF_DO__47
+	{ 0, 0, 32, 0L, 0L, 0L, 93576UL },	// MES_PDI_SC_LEVEL_48
+	{ 0, 0, 32, 0L, 0L, 0L, 93608UL },	// MES_PDI_ALA_ENAB_48
+	{ 0, 0, 32, 0L, 0L, 0L, 93640UL },	// MES_PDI_DEL_TIME_48
+	{ 0, 0, 32, 0L, 0L, 0L, 93672UL },	// MES_PDI_REC_TIME_48
+	{ 0, 0, 32, 0L, 0L, 0L, 93704UL },	// MES_PDI_ACTDELAY_48
+	{ 0, 0, 32, 0L, 0L, 0L, 93736UL },	// MES_PDI_CONFIG___48
+	{ 0, 0, 32, 0L, 0L, 0L, 93768UL },	// MES_PDI_CONF_DO__48
+	{ 0, 0, 32, 0L, 0L, 0L, 93800UL },	// MES_PDI_SC_LEVEL_49
+	{ 0, 0, 32, 0L, 0L, 0L, 93832UL },	// MES_PDI_ALA_ENAB_49
+	{ 0, 0, 32, 0L, 0L, 0L, 93864UL },	// MES_PDI_DEL_TIME_49
+	{ 0, 0, 32, 0L, 0L, 0L, 93896UL },	// MES_PDI_REC_TIME_49
+	{ 0, 0, 32, 0L, 0L, 0L, 93928UL },	// MES_PDI_ACTDELAY_49
+	{ 0, 0, 32, 0L, 0L, 0L, 93960UL },	// MES_PDI_CONFIG___49
+	{ 0, 0, 32, 0L, 0L, 0L, 93992UL },	// MES_PDI_CONF_DO__49
+	{ 0, 0, 32, 0L, 0L, 0L, 94024UL },	// MES_PDI_SC_LEVEL_50
+	{ 0, 0, 32, 0L, 0L, 0L, 94056UL },	// MES_PDI_ALA_ENAB_50
+	{ 0, 0, 32, 0L, 0L, 0L, 94088UL },	// MES_PDI_DEL_TIME_50
+	{ 0, 0, 32, 0L, 0L, 0L, 94120UL },	// MES_PDI_REC_TIME_50
+	{ 0, 0, 32, 0L, 0L, 0L, 94152UL },	// MES_PDI_ACTDELAY_50
+	{ 0, 0, 32, 0L, 0L, 0L, 94184UL },	// MES_PDI_CONFIG___50
+	{ 0, 0, 32, 0L, 0L, 0L, 94216UL },	// MES_PDI_CONF_DO__50
+	{ 0, 0, 32, 0L, 0L, 0L, 94248UL },	// MES_PDI_SC_LEVEL_51
+	{ 0, 0, 32, 0L, 0L, 0L, 94280UL },	// MES_PDI_ALA_ENAB_51
+	{ 0, 0, 32, 0L, 0L, 0L, 94312UL },	// MES_PDI_DEL_TIME_51
+	{ 0, 0, 32, 0L, 0L, 0L, 94344UL },	// MES_PDI_REC_TIME_51
+	{ 0, 0, 32, 0L, 0L, 0L, 94376UL },	// MES_PDI_ACTDELAY_51
+	{ 0, 0, 32, 0L, 0L, 0L, 94408UL },	// MES_PDI_CONFIG___51
+	{ 0, 0, 32, 0L, 0L, 0L, 94440UL },	// MES_PDI_CONF_DO__51
+	{ 0, 0, 32, 0L, 0L, 0L, 94472UL },	// MES_PDI_SC_LEVEL_52
+	{ 0, 0, 32, 0L, 0L, 0L, 94504UL },	// MES_PDI_ALA_ENAB_52
+	{ 0, 0, 32, 0L, 0L, 0L, 94536UL },	// MES_PDI_DEL_TIME_52
+	{ 0, 0, 32, 0L, 0L, 0L, 94568UL },	// MES_PDI_REC_TIME_52
+	{ 0, 0, 32, 0L, 0L, 0L, 94600UL },	// MES_PDI_ACTDELAY_52
+	{ 0, 0, 32, 0L, 0L, 0L, 94632UL },	// MES_PDI_CONFIG___52
+	{ 0, 0, 32, 0L, 0L, 0L, 94664UL },	// MES_PDI_CONF_DO__52
+	{ 0, 0, 32, 0L, 0L, 0L, 94696UL },	// MES_PDI_SC_LEVEL_53
+	{ 0, 0, 32, 0L, 0L, 0L, 94728UL },	// MES_PDI_ALA_ENAB_53
+	{ 0, 0, 32, 0L, 0L, 0L, 94760UL },	// MES_PDI_DEL_TIME_53
+	{ 0, 0, 32, 0L, 0L, 0L, 94792UL },	// MES_PDI_REC_TIME_53
+	{ 0, 0, 32, 0L, 0L, 0L, 94824UL },	// MES_PDI_ACTDELAY_53
+	{ 0, 0, 32, 0L, 0L, 0L, 94856UL },	// MES_PDI_CONFIG___53
+	{ 0, 0, 32, 0L, 0L, 0L, 94888UL },	// MES_PDI_CONF_DO__53
+	{ 0, 0, 32, 0L, 0L, 0L, 94920UL },	// MES_PDI_SC_LEVEL_54
+	{ 0, 0, 32, 0L, 0L, 0L, 94952UL },	// MES_PDI_ALA_ENAB_54
+	{ 0, 0, 32, 0L, 0L, 0L, 94984UL },	// MES_PDI_DEL_TIME_54
+	{ 0, 0, 32, 0L, 0L, 0L, 95016UL },	// MES_PDI_REC_TIME_54
+	{ 0, 0, 32, 0L, 0L, 0L, 95048UL },	// MES_PDI_ACTDELAY_54
+	{ 0, 0, 32, 0L, 0L, 0L, 95080UL },	// MES_PDI_CONFIG___54
+	{ 0, 0, 32, 0L, 0L, 0L, 95112UL },	// MES_PDI_CONF_DO__54
+	{ 0, 0, 32, 0L, 0L, 0L, 95144UL },	// MES_PDI_SC_LEVEL_55
+	{ 0, 0, 32, 0L, 0L, 0L, 95176UL },	// MES_PDI_ALA_ENAB_55
+	{ 0, 0, 32, 0L, 0L, 0L, 95208UL },	// MES_PDI_DEL_TIME_55
+	{ 0, 0, 32, 0L, 0L, 0L, 95240UL },	// MES_PDI_REC_TIME_55
+	{ 0, 0, 32, 0L, 0L, 0L, 95272UL },	// MES_PDI_ACTDELAY_55
+	{ 0, 0, 32, 0L, 0L, 0L, 95304UL },	// MES_PDI_CONFIG___55
+	{ 0, 0, 32, 0L, 0L, 0L, 95336UL },	// MES_PDI_CONF_DO__55
+	{ 0, 0, 32, 0L, 0L, 0L, 95368UL },	// MES_PDI_SC_LEVEL_56
+	{ 0, 0, 32, 0L, 0L, 0L, 95400UL },	// MES_PDI_ALA_ENAB_56
+	{ 0, 0, 32, 0L, 0L, 0L, 95432UL },	// MES_PDI_DEL_TIME_56
+	{ 0, 0, 32, 0L, 0L, 0L, 95464UL },	// MES_PDI_REC_TIME_56
+	{ 0, 0, 32, 0L, 0L, 0L, 95496UL },	// MES_PDI_ACTDELAY_56
+	{ 0, 0, 32, 0L, 0L, 0L, 95528UL },	// MES_PDI_CONFIG___56
+	{ 0, 0, 32, 0L, 0L, 0L, 95560UL },	// MES_PDI_CONF_DO__56
+	{ 0, 0, 32, 0L, 0L, 0L, 95592UL },	// MES_PDI_SC_LEVEL_57
+	{ 0, 0, 32, 0L, 0L, 0L, 95624UL },	// MES_PDI_ALA_ENAB_57
+	{ 0, 0, 32, 0L, 0L, 0L, 95656UL },	// MES_PDI_DEL_TIME_57
+	{ 0, 0, 32, 0L, 0L, 0L, 95688UL },	// MES_PDI_REC_TIME_57
+	{ 0, 0, 32, 0L, 0L, 0L, 95720UL },	// MES_PDI_ACTDELAY_57
+	{ 0, 0, 32, 0L, 0L, 0L, 95752UL },	// MES_PDI_CONFIG___57
+	{ 0, 0, 32, 0L, 0L, 0L, 95784UL },	// MES_PDI_CONF_DO__57
+	{ 0, 0, 32, 0L, 0L, 0L, 95816UL },	// MES_PDI_SC_LEVEL_58
+	{ 0, 0, 32, 0L, 0L, 0L, 95848UL },	// MES_PDI_ALA_ENAB_58
+	{ 0, 0, 32, 0L, 0L, 0L, 95880UL },	// MES_PDI_DEL_TIME_58
+	{ 0, 0, 32, 0L, 0L, 0L, 95912UL },	// MES_PDI_REC_TIME_58
+	{ 0, 0, 32, 0L, 0L, 0L, 95944UL },	// MES_PDI_ACTDELAY_58
+	{ 0, 0, 32, 0L, 0L, 0L, 95976UL },	// MES_PDI_CONFIG___58
+	{ 0, 0, 32, 0L, 0L, 0L, 96008UL },	// MES_PDI_CONF_DO__58
+	{ 0, 0, 32, 0L, 0L, 0L, 96040UL },	// MES_PDI_SC_LEVEL_59
+	{ 0, 0, 32, 0L, 0L, 0L, 96072UL },	// MES_PDI_ALA_ENAB_59
+	{ 0, 0, 32, 0L, 0L, 0L, 96104UL },	// MES_PDI_DEL_TIME_59
+	{ 0, 0, 32, 0L, 0L, 0L, 96136UL },	// MES_PDI_REC_TIME_59
+	{ 0, 0, 32, 0L, 0L, 0L, 96168UL },	// MES_PDI_ACTDELAY_59
+	{ 0, 0, 32, 0L, 0L, 0L, 96200UL },	// MES_PDI_CONFIG___59
+	{ 0, 0, 32, 0L, 0L, 0L, 96232UL },	// MES_PDI_CONF_DO__59
+	{ 0, 0, 32, 0L, 0L, 0L, 96264UL },	// MES_PDI_SC_LEVEL_60
+	{ 0, 0, 32, 0L, 0L, 0L, 96296UL },	// MES_PDI_ALA_ENAB_60
+	{ 0, 0, 32, 0L, 0L, 0L, 96328UL },	// MES_PDI_DEL_TIME_60
+	{ 0, 0, 32, 0L, 0L, 0L, 96360UL },	// MES_PDI_REC_TIME_60
+	{ 0, 0, 32, 0L, 0L, 0L, 96392UL },	// MES_PDI_ACTDELAY_60
+	{ 0, 0, 32, 0L, 0L, 0L, 96424UL },	// MES_PDI_CONFIG___60
+	{ 0, 0, 32, 0L, 0L, 0L, 96456UL },	// MES_PDI_CONF_DO__60
+	{ 0, 0, 32, 0L, 0L, 0L, 96488UL },	// MES_PDI_SC_LEVEL_1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 96520UL },	// MES_PDI_ALA_ENAB_1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 96552UL },	// MES_PDI_DEL_TIME_1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 96584UL },	// MES_PDI_REC_TIME_1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 96616UL },	// MES_PDI_ACTDELAY_1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 96648UL },	// MES_PDI_CONFIG___1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 96680UL },	// MES_PDI_CONF_DO__1_2
+	{ 0, 0, 32, 0L, 0L, 0L, 96712UL },	// MES_PDI_SC_LEVEL_2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 96744UL },	// MES_PDI_ALA_ENAB_2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 96776UL },	// MES_PDI_DEL_TIME_2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 96808UL },	// MES_PDI_REC_TIME_2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 96840UL },	// MES_PDI_ACTDELAY_2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 96872UL },	// MES_PDI_CONFIG___2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 96904UL },	// MES_PDI_CONF_DO__2_2
+	{ 0, 0, 32, 0L, 0L, 0L, 96936UL },	// MES_PDI_SC_LEVEL_3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 96968UL },	// MES_PDI_ALA_ENAB_3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97000UL },	// MES_PDI_DEL_TIME_3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97032UL },	// MES_PDI_REC_TIME_3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97064UL },	// MES_PDI_ACTDELAY_3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97096UL },	// MES_PDI_CONFIG___3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97128UL },	// MES_PDI_CONF_DO__3_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97160UL },	// MES_PDI_SC_LEVEL_4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97192UL },	// MES_PDI_ALA_ENAB_4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97224UL },	// MES_PDI_DEL_TIME_4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97256UL },	// MES_PDI_REC_TIME_4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97288UL },	// MES_PDI_ACTDELAY_4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97320UL },	// MES_PDI_CONFIG___4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97352UL },	// MES_PDI_CONF_DO__4_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97384UL },	// MES_PDI_SC_LEVEL_5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97416UL },	// MES_PDI_ALA_ENAB_5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97448UL },	// MES_PDI_DEL_TIME_5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97480UL },	// MES_PDI_REC_TIME_5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97512UL },	// MES_PDI_ACTDELAY_5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97544UL },	// MES_PDI_CONFIG___5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97576UL },	// MES_PDI_CONF_DO__5_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97608UL },	// MES_PDI_SC_LEVEL_6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97640UL },	// MES_PDI_ALA_ENAB_6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97672UL },	// MES_PDI_DEL_TIME_6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97704UL },	// MES_PDI_REC_TIME_6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97736UL },	// MES_PDI_ACTDELAY_6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97768UL },	// MES_PDI_CONFIG___6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97800UL },	// MES_PDI_CONF_DO__6_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97832UL },	// MES_PDI_SC_LEVEL_7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97864UL },	// MES_PDI_ALA_ENAB_7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97896UL },	// MES_PDI_DEL_TIME_7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97928UL },	// MES_PDI_REC_TIME_7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97960UL },	// MES_PDI_ACTDELAY_7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 97992UL },	// MES_PDI_CONFIG___7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98024UL },	// MES_PDI_CONF_DO__7_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98056UL },	// MES_PDI_SC_LEVEL_8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98088UL },	// MES_PDI_ALA_ENAB_8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98120UL },	// MES_PDI_DEL_TIME_8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98152UL },	// MES_PDI_REC_TIME_8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98184UL },	// MES_PDI_ACTDELAY_8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98216UL },	// MES_PDI_CONFIG___8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98248UL },	// MES_PDI_CONF_DO__8_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98280UL },	// MES_PDI_SC_LEVEL_9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98312UL },	// MES_PDI_ALA_ENAB_9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98344UL },	// MES_PDI_DEL_TIME_9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98376UL },	// MES_PDI_REC_TIME_9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98408UL },	// MES_PDI_ACTDELAY_9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98440UL },	// MES_PDI_CONFIG___9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98472UL },	// MES_PDI_CONF_DO__9_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98504UL },	// MES_PDI_SC_LEVEL_10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98536UL },	// MES_PDI_ALA_ENAB_10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98568UL },	// MES_PDI_DEL_TIME_10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98600UL },	// MES_PDI_REC_TIME_10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98632UL },	// MES_PDI_ACTDELAY_10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98664UL },	// MES_PDI_CONFIG___10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98696UL },	// MES_PDI_CONF_DO__10_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98728UL },	// MES_PDI_SC_LEVEL_11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98760UL },	// MES_PDI_ALA_ENAB_11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98792UL },	// MES_PDI_DEL_TIME_11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98824UL },	// MES_PDI_REC_TIME_11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98856UL },	// MES_PDI_ACTDELAY_11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98888UL },	// MES_PDI_CONFIG___11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98920UL },	// MES_PDI_CONF_DO__11_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98952UL },	// MES_PDI_SC_LEVEL_12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 98984UL },	// MES_PDI_ALA_ENAB_12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99016UL },	// MES_PDI_DEL_TIME_12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99048UL },	// MES_PDI_REC_TIME_12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99080UL },	// MES_PDI_ACTDELAY_12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99112UL },	// MES_PDI_CONFIG___12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99144UL },	// MES_PDI_CONF_DO__12_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99176UL },	// MES_PDI_SC_LEVEL_13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99208UL },	// MES_PDI_ALA_ENAB_13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99240UL },	// MES_PDI_DEL_TIME_13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99272UL },	// MES_PDI_REC_TIME_13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99304UL },	// MES_PDI_ACTDELAY_13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99336UL },	// MES_PDI_CONFIG___13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99368UL },	// MES_PDI_CONF_DO__13_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99400UL },	// MES_PDI_SC_LEVEL_14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99432UL },	// MES_PDI_ALA_ENAB_14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99464UL },	// MES_PDI_DEL_TIME_14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99496UL },	// MES_PDI_REC_TIME_14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99528UL },	// MES_PDI_ACTDELAY_14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99560UL },	// MES_PDI_CONFIG___14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99592UL },	// MES_PDI_CONF_DO__14_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99624UL },	// MES_PDI_SC_LEVEL_15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99656UL },	// MES_PDI_ALA_ENAB_15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99688UL },	// MES_PDI_DEL_TIME_15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99720UL },	// MES_PDI_REC_TIME_15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99752UL },	// MES_PDI_ACTDELAY_15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99784UL },	// MES_PDI_CONFIG___15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99816UL },	// MES_PDI_CONF_DO__15_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99848UL },	// MES_PDI_SC_LEVEL_16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99880UL },	// MES_PDI_ALA_ENAB_16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99912UL },	// MES_PDI_DEL_TIME_16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99944UL },	// MES_PDI_REC_TIME_16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 99976UL },	// MES_PDI_ACTDELAY_16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100008UL },	// MES_PDI_CONFIG___16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100040UL },	// MES_PDI_CONF_DO__16_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100072UL },	// MES_PDI_SC_LEVEL_17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100104UL },	// MES_PDI_ALA_ENAB_17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100136UL },	// MES_PDI_DEL_TIME_17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100168UL },	// MES_PDI_REC_TIME_17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100200UL },	// MES_PDI_ACTDELAY_17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100232UL },	// MES_PDI_CONFIG___17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100264UL },	// MES_PDI_CONF_DO__17_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100296UL },	// MES_PDI_SC_LEVEL_18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100328UL },	// MES_PDI_ALA_ENAB_18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100360UL },	// MES_PDI_DEL_TIME_18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100392UL },	// MES_PDI_REC_TIME_18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100424UL },	// MES_PDI_ACTDELAY_18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100456UL },	// MES_PDI_CONFIG___18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100488UL },	// MES_PDI_CONF_DO__18_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100520UL },	// MES_PDI_SC_LEVEL_19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100552UL },	// MES_PDI_ALA_ENAB_19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100584UL },	// MES_PDI_DEL_TIME_19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100616UL },	// MES_PDI_REC_TIME_19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100648UL },	// MES_PDI_ACTDELAY_19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100680UL },	// MES_PDI_CONFIG___19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100712UL },	// MES_PDI_CONF_DO__19_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100744UL },	// MES_PDI_SC_LEVEL_20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100776UL },	// MES_PDI_ALA_ENAB_20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100808UL },	// MES_PDI_DEL_TIME_20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100840UL },	// MES_PDI_REC_TIME_20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100872UL },	// MES_PDI_ACTDELAY_20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100904UL },	// MES_PDI_CONFIG___20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100936UL },	// MES_PDI_CONF_DO__20_2
+	{ 0, 0, 32, 0L, 0L, 0L, 100968UL },	// MES_PDI_SC_LEVEL_21_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101000UL },	// MES_PDI_ALA_ENAB_21_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101032UL },	// MES_PDI_DEL_TIME_21_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101064UL },	// MES_PDI_REC_TIME_21_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101096UL },	// MES_PDI_ACTDELAY_21_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101128UL },	// MES_PDI_CONFIG___21_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101160UL },	// MES_PDI_CONF_DO__21_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101192UL },	// MES_PDI_SC_LEVEL_22_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101224UL },	// MES_PDI_ALA_ENAB_22_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101256UL },	// MES_PDI_DEL_TIME_22_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101288UL },	// MES_PDI_REC_TIME_22_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101320UL },	// MES_PDI_ACTDELAY_22_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101352UL },	// MES_PDI_CONFIG___22_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101384UL },	// MES_PDI_CONF_DO__22_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101416UL },	// MES_PDI_SC_LEVEL_23_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101448UL },	// MES_PDI_ALA_ENAB_23_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101480UL },	// MES_PDI_DEL_TIME_23_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101512UL },	// MES_PDI_REC_TIME_23_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101544UL },	// MES_PDI_ACTDELAY_23_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101576UL },	// MES_PDI_CONFIG___23_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101608UL },	// MES_PDI_CONF_DO__23_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101640UL },	// MES_PDI_SC_LEVEL_24_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101672UL },	// MES_PDI_ALA_ENAB_24_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101704UL },	// MES_PDI_DEL_TIME_24_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101736UL },	// MES_PDI_REC_TIME_24_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101768UL },	// MES_PDI_ACTDELAY_24_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101800UL },	// MES_PDI_CONFIG___24_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101832UL },	// MES_PDI_CONF_DO__24_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101864UL },	// MES_PDI_SC_LEVEL_25_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101896UL },	// MES_PDI_ALA_ENAB_25_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101928UL },	// MES_PDI_DEL_TIME_25_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101960UL },	// MES_PDI_REC_TIME_25_2
+	{ 0, 0, 32, 0L, 0L, 0L, 101992UL },	// MES_PDI_ACTDELAY_25_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102024UL },	// MES_PDI_CONFIG___25_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102056UL },	// MES_PDI_CONF_DO__25_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102088UL },	// MES_PDI_SC_LEVEL_26_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102120UL },	// MES_PDI_ALA_ENAB_26_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102152UL },	// MES_PDI_DEL_TIME_26_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102184UL },	// MES_PDI_REC_TIME_26_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102216UL },	// MES_PDI_ACTDELAY_26_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102248UL },	// MES_PDI_CONFIG___26_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102280UL },	// MES_PDI_CONF_DO__26_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102312UL },	// MES_PDI_SC_LEVEL_27_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102344UL },	// MES_PDI_ALA_ENAB_27_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102376UL },	// MES_PDI_DEL_TIME_27_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102408UL },	// MES_PDI_REC_TIME_27_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102440UL },	// MES_PDI_ACTDELAY_27_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102472UL },	// MES_PDI_CONFIG___27_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102504UL },	// MES_PDI_CONF_DO__27_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102536UL },	// MES_PDI_SC_LEVEL_28_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102568UL },	// MES_PDI_ALA_ENAB_28_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102600UL },	// MES_PDI_DEL_TIME_28_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102632UL },	// MES_PDI_REC_TIME_28_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102664UL },	// MES_PDI_ACTDELAY_28_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102696UL },	// MES_PDI_CONFIG___28_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102728UL },	// MES_PDI_CONF_DO__28_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102760UL },	// MES_PDI_SC_LEVEL_29_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102792UL },	// MES_PDI_ALA_ENAB_29_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102824UL },	// MES_PDI_DEL_TIME_29_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102856UL },	// MES_PDI_REC_TIME_29_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102888UL },	// MES_PDI_ACTDELAY_29_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102920UL },	// MES_PDI_CONFIG___29_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102952UL },	// MES_PDI_CONF_DO__29_2
+	{ 0, 0, 32, 0L, 0L, 0L, 102984UL },	// MES_PDI_SC_LEVEL_30_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103016UL },	// MES_PDI_ALA_ENAB_30_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103048UL },	// MES_PDI_DEL_TIME_30_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103080UL },	// MES_PDI_REC_TIME_30_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103112UL },	// MES_PDI_ACTDELAY_30_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103144UL },	// MES_PDI_CONFIG___30_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103176UL },	// MES_PDI_CONF_DO__30_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103208UL },	// MES_PDI_SC_LEVEL_31_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103240UL },	// MES_PDI_ALA_ENAB_31_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103272UL },	// MES_PDI_DEL_TIME_31_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103304UL },	// MES_PDI_REC_TIME_31_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103336UL },	// MES_PDI_ACTDELAY_31_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103368UL },	// MES_PDI_CONFIG___31_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103400UL },	// MES_PDI_CONF_DO__31_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103432UL },	// MES_PDI_SC_LEVEL_32_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103464UL },	// MES_PDI_ALA_ENAB_32_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103496UL },	// MES_PDI_DEL_TIME_32_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103528UL },	// MES_PDI_REC_TIME_32_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103560UL },	// MES_PDI_ACTDELAY_32_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103592UL },	// MES_PDI_CONFIG___32_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103624UL },	// MES_PDI_CONF_DO__32_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103656UL },	// MES_PDI_SC_LEVEL_33_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103688UL },	// MES_PDI_ALA_ENAB_33_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103720UL },	// MES_PDI_DEL_TIME_33_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103752UL },	// MES_PDI_REC_TIME_33_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103784UL },	// MES_PDI_ACTDELAY_33_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103816UL },	// MES_PDI_CONFIG___33_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103848UL },	// MES_PDI_CONF_DO__33_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103880UL },	// MES_PDI_SC_LEVEL_34_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103912UL },	// MES_PDI_ALA_ENAB_34_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103944UL },	// MES_PDI_DEL_TIME_34_2
+	{ 0, 0, 32, 0L, 0L, 0L, 103976UL },	// MES_PDI_REC_TIME_34_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104008UL },	// MES_PDI_ACTDELAY_34_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104040UL },	// MES_PDI_CONFIG___34_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104072UL },	// MES_PDI_CONF_DO__34_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104104UL },	// MES_PDI_SC_LEVEL_35_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104136UL },	// MES_PDI_ALA_ENAB_35_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104168UL },	// MES_PDI_DEL_TIME_35_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104200UL },	// MES_PDI_REC_TIME_35_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104232UL },	// MES_PDI_ACTDELAY_35_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104264UL },	// MES_PDI_CONFIG___35_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104296UL },	// MES_PDI_CONF_DO__35_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104328UL },	// MES_PDI_SC_LEVEL_36_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104360UL },	// MES_PDI_ALA_ENAB_36_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104392UL },	// MES_PDI_DEL_TIME_36_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104424UL },	// MES_PDI_REC_TIME_36_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104456UL },	// MES_PDI_ACTDELAY_36_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104488UL },	// MES_PDI_CONFIG___36_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104520UL },	// MES_PDI_CONF_DO__36_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104552UL },	// MES_PDI_SC_LEVEL_37_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104584UL },	// MES_PDI_ALA_ENAB_37_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104616UL },	// MES_PDI_DEL_TIME_37_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104648UL },	// MES_PDI_REC_TIME_37_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104680UL },	// MES_PDI_ACTDELAY_37_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104712UL },	// MES_PDI_CONFIG___37_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104744UL },	// MES_PDI_CONF_DO__37_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104776UL },	// MES_PDI_SC_LEVEL_38_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104808UL },	// MES_PDI_ALA_ENAB_38_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104840UL },	// MES_PDI_DEL_TIME_38_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104872UL },	// MES_PDI_REC_TIME_38_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104904UL },	// MES_PDI_ACTDELAY_38_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104936UL },	// MES_PDI_CONFIG___38_2
+	{ 0, 0, 32, 0L, 0L, 0L, 104968UL },	// MES_PDI_CONF_DO__38_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105000UL },	// MES_PDI_SC_LEVEL_39_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105032UL },	// MES_PDI_ALA_ENAB_39_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105064UL },	// MES_PDI_DEL_TIME_39_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105096UL },	// MES_PDI_REC_TIME_39_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105128UL },	// MES_PDI_ACTDELAY_39_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105160UL },	// MES_PDI_CONFIG___39_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105192UL },	// MES_PDI_CONF_DO__39_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105224UL },	// MES_PDI_SC_LEVEL_40_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105256UL },	// MES_PDI_ALA_ENAB_40_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105288UL },	// MES_PDI_DEL_TIME_40_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105320UL },	// MES_PDI_REC_TIME_40_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105352UL },	// MES_PDI_ACTDELAY_40_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105384UL },	// MES_PDI_CONFIG___40_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105416UL },	// MES_PDI_CONF_DO__40_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105448UL },	// MES_PDI_SC_LEVEL_41_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105480UL },	// MES_PDI_ALA_ENAB_41_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105512UL },	// MES_PDI_DEL_TIME_41_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105544UL },	// MES_PDI_REC_TIME_41_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105576UL },	// MES_PDI_ACTDELAY_41_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105608UL },	// MES_PDI_CONFIG___41_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105640UL },	// MES_PDI_CONF_DO__41_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105672UL },	// MES_PDI_SC_LEVEL_42_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105704UL },	// MES_PDI_ALA_ENAB_42_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105736UL },	// MES_PDI_DEL_TIME_42_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105768UL },	// MES_PDI_REC_TIME_42_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105800UL },	// MES_PDI_ACTDELAY_42_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105832UL },	// MES_PDI_CONFIG___42_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105864UL },	// MES_PDI_CONF_DO__42_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105896UL },	// MES_PDI_SC_LEVEL_43_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105928UL },	// MES_PDI_ALA_ENAB_43_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105960UL },	// MES_PDI_DEL_TIME_43_2
+	{ 0, 0, 32, 0L, 0L, 0L, 105992UL },	// MES_PDI_REC_TIME_43_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106024UL },	// MES_PDI_ACTDELAY_43_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106056UL },	// MES_PDI_CONFIG___43_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106088UL },	// MES_PDI_CONF_DO__43_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106120UL },	// MES_PDI_SC_LEVEL_44_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106152UL },	// MES_PDI_ALA_ENAB_44_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106184UL },	// MES_PDI_DEL_TIME_44_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106216UL },	// MES_PDI_REC_TIME_44_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106248UL },	// MES_PDI_ACTDELAY_44_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106280UL },	// MES_PDI_CONFIG___44_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106312UL },	// MES_PDI_CONF_DO__44_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106344UL },	// MES_PDI_SC_LEVEL_45_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106376UL },	// MES_PDI_ALA_ENAB_45_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106408UL },	// MES_PDI_DEL_TIME_45_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106440UL },	// MES_PDI_REC_TIME_45_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106472UL },	// MES_PDI_ACTDELAY_45_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106504UL },	// MES_PDI_CONFIG___45_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106536UL },	// MES_PDI_CONF_DO__45_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106568UL },	// MES_PDI_SC_LEVEL_46_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106600UL },	// MES_PDI_ALA_ENAB_46_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106632UL },	// MES_PDI_DEL_TIME_46_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106664UL },	// MES_PDI_REC_TIME_46_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106696UL },	// MES_PDI_ACTDELAY_46_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106728UL },	// MES_PDI_CONFIG___46_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106760UL },	// MES_PDI_CONF_DO__46_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106792UL },	// MES_PDI_SC_LEVEL_47_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106824UL },	// MES_PDI_ALA_ENAB_47_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106856UL },	// MES_PDI_DEL_TIME_47_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106888UL },	// MES_PDI_REC_TIME_47_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106920UL },	// MES_PDI_ACTDELAY_47_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106952UL },	// MES_PDI_CONFIG___47_2
+	{ 0, 0, 32, 0L, 0L, 0L, 106984UL },	// MES_PDI_CONF_DO__47_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107016UL },	// MES_PDI_SC_LEVEL_48_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107048UL },	// MES_PDI_ALA_ENAB_48_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107080UL },	// MES_PDI_DEL_TIME_48_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107112UL },	// MES_PDI_REC_TIME_48_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107144UL },	// MES_PDI_ACTDELAY_48_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107176UL },	// MES_PDI_CONFIG___48_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107208UL },	// MES_PDI_CONF_DO__48_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107240UL },	// MES_PDI_SC_LEVEL_49_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107272UL },	// MES_PDI_ALA_ENAB_49_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107304UL },	// MES_PDI_DEL_TIME_49_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107336UL },	// MES_PDI_REC_TIME_49_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107368UL },	// MES_PDI_ACTDELAY_49_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107400UL },	// MES_PDI_CONFIG___49_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107432UL },	// MES_PDI_CONF_DO__49_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107464UL },	// MES_PDI_SC_LEVEL_50_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107496UL },	// MES_PDI_ALA_ENAB_50_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107528UL },	// MES_PDI_DEL_TIME_50_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107560UL },	// MES_PDI_REC_TIME_50_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107592UL },	// MES_PDI_ACTDELAY_50_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107624UL },	// MES_PDI_CONFIG___50_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107656UL },	// MES_PDI_CONF_DO__50_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107688UL },	// MES_PDI_SC_LEVEL_51_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107720UL },	// MES_PDI_ALA_ENAB_51_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107752UL },	// MES_PDI_DEL_TIME_51_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107784UL },	// MES_PDI_REC_TIME_51_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107816UL },	// MES_PDI_ACTDELAY_51_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107848UL },	// MES_PDI_CONFIG___51_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107880UL },	// MES_PDI_CONF_DO__51_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107912UL },	// MES_PDI_SC_LEVEL_52_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107944UL },	// MES_PDI_ALA_ENAB_52_2
+	{ 0, 0, 32, 0L, 0L, 0L, 107976UL },	// MES_PDI_DEL_TIME_52_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108008UL },	// MES_PDI_REC_TIME_52_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108040UL },	// MES_PDI_ACTDELAY_52_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108072UL },	// MES_PDI_CONFIG___52_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108104UL },	// MES_PDI_CONF_DO__52_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108136UL },	// MES_PDI_SC_LEVEL_53_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108168UL },	// MES_PDI_ALA_ENAB_53_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108200UL },	// MES_PDI_DEL_TIME_53_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108232UL },	// MES_PDI_REC_TIME_53_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108264UL },	// MES_PDI_ACTDELAY_53_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108296UL },	// MES_PDI_CONFIG___53_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108328UL },	// MES_PDI_CONF_DO__53_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108360UL },	// MES_PDI_SC_LEVEL_54_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108392UL },	// MES_PDI_ALA_ENAB_54_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108424UL },	// MES_PDI_DEL_TIME_54_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108456UL },	// MES_PDI_REC_TIME_54_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108488UL },	// MES_PDI_ACTDELAY_54_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108520UL },	// MES_PDI_CONFIG___54_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108552UL },	// MES_PDI_CONF_DO__54_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108584UL },	// MES_PDI_SC_LEVEL_55_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108616UL },	// MES_PDI_ALA_ENAB_55_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108648UL },	// MES_PDI_DEL_TIME_55_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108680UL },	// MES_PDI_REC_TIME_55_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108712UL },	// MES_PDI_ACTDELAY_55_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108744UL },	// MES_PDI_CONFIG___55_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108776UL },	// MES_PDI_CONF_DO__55_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108808UL },	// MES_PDI_SC_LEVEL_56_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108840UL },	// MES_PDI_ALA_ENAB_56_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108872UL },	// MES_PDI_DEL_TIME_56_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108904UL },	// MES_PDI_REC_TIME_56_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108936UL },	// MES_PDI_ACTDELAY_56_2
+	{ 0, 0, 32, 0L, 0L, 0L, 108968UL },	// MES_PDI_CONFIG___56_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109000UL },	// MES_PDI_CONF_DO__56_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109032UL },	// MES_PDI_SC_LEVEL_57_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109064UL },	// MES_PDI_ALA_ENAB_57_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109096UL },	// MES_PDI_DEL_TIME_57_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109128UL },	// MES_PDI_REC_TIME_57_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109160UL },	// MES_PDI_ACTDELAY_57_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109192UL },	// MES_PDI_CONFIG___57_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109224UL },	// MES_PDI_CONF_DO__57_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109256UL },	// MES_PDI_SC_LEVEL_58_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109288UL },	// MES_PDI_ALA_ENAB_58_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109320UL },	// MES_PDI_DEL_TIME_58_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109352UL },	// MES_PDI_REC_TIME_58_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109384UL },	// MES_PDI_ACTDELAY_58_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109416UL },	// MES_PDI_CONFIG___58_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109448UL },	// MES_PDI_CONF_DO__58_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109480UL },	// MES_PDI_SC_LEVEL_59_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109512UL },	// MES_PDI_ALA_ENAB_59_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109544UL },	// MES_PDI_DEL_TIME_59_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109576UL },	// MES_PDI_REC_TIME_59_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109608UL },	// MES_PDI_ACTDELAY_59_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109640UL },	// MES_PDI_CONFIG___59_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109672UL },	// MES_PDI_CONF_DO__59_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109704UL },	// MES_PDI_SC_LEVEL_60_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109736UL },	// MES_PDI_ALA_ENAB_60_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109768UL },	// MES_PDI_DEL_TIME_60_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109800UL },	// MES_PDI_REC_TIME_60_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109832UL },	// MES_PDI_ACTDELAY_60_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109864UL },	// MES_PDI_CONFIG___60_2
+	{ 0, 0, 32, 0L, 0L, 0L, 109896UL },	// MES_PDI_CONF_DO__60_2
+	{ 1, PMS_REG_O2__ACCESS_LEVEL, 4, PMS_REG_O2__MIN_VALUE, PMS_REG_O2__MAX_VALUE, PMS_REG_O2__FACTORY_SETTING, 109928UL },
+	{ 1, O2_OPTION_CONTROL__ACCESS_LEVEL, 1, O2_OPTION_CONTROL__MIN_VALUE, O2_OPTION_CONTROL__MAX_VALUE, O2_OPTION_CONTROL__FACTORY_SETTING, 109932UL },
+	{ 1, O2_PERCENT_VALUE_FOR_20mA__ACCESS_LEVEL, 11, O2_PERCENT_VALUE_FOR_20mA__MIN_VALUE, O2_PERCENT_VALUE_FOR_20mA__MAX_VALUE, O2_PERCENT_VALUE_FOR_20mA__FACTORY_SETTING, 109933UL },
+	{ 1, O2_MEASURED_VALUE__ACCESS_LEVEL, 10, O2_MEASURED_VALUE__MIN_VALUE, O2_MEASURED_VALUE__MAX_VALUE, O2_MEASURED_VALUE__FACTORY_SETTING, 109944UL },
+	{ 1, QUICKSTOP_ACTIVE__ACCESS_LEVEL, 2, QUICKSTOP_ACTIVE__MIN_VALUE, QUICKSTOP_ACTIVE__MAX_VALUE, QUICKSTOP_ACTIVE__FACTORY_SETTING, 109954UL },
+	{ 1, PORT_REMOTE_SERVICE__ACCESS_LEVEL, 7, PORT_REMOTE_SERVICE__MIN_VALUE, PORT_REMOTE_SERVICE__MAX_VALUE, PORT_REMOTE_SERVICE__FACTORY_SETTING, 109956UL },
+	{ 1, COMPORT_IGNITION__ACCESS_LEVEL, 2, COMPORT_IGNITION__MIN_VALUE, COMPORT_IGNITION__MAX_VALUE, COMPORT_IGNITION__FACTORY_SETTING, 109963UL },
+	{ 1, COMPORT_MBM__ACCESS_LEVEL, 2, COMPORT_MBM__MIN_VALUE, COMPORT_MBM__MAX_VALUE, COMPORT_MBM__FACTORY_SETTING, 109965UL },
+	{ 1, COMPORT_MBS__ACCESS_LEVEL, 2, COMPORT_MBS__MIN_VALUE, COMPORT_MBS__MAX_VALUE, COMPORT_MBS__FACTORY_SETTING, 109967UL },
+	{ 1, SAF_CHAIN_OPTION__ACCESS_LEVEL, 1, SAF_CHAIN_OPTION__MIN_VALUE, SAF_CHAIN_OPTION__MAX_VALUE, SAF_CHAIN_OPTION__FACTORY_SETTING, 109969UL },
+	{ 1, THR_VALVE_TOGGLE_TIME__ACCESS_LEVEL, 20, THR_VALVE_TOGGLE_TIME__MIN_VALUE, THR_VALVE_TOGGLE_TIME__MAX_VALUE, THR_VALVE_TOGGLE_TIME__FACTORY_SETTING, 109970UL },
+	{ 1, THR_RELEASE_POWER__ACCESS_LEVEL, 14, THR_RELEASE_POWER__MIN_VALUE, THR_RELEASE_POWER__MAX_VALUE, THR_RELEASE_POWER__FACTORY_SETTING, 109990UL },
+	{ 1, THR_START_PROP_RANGE__ACCESS_LEVEL, 12, THR_START_PROP_RANGE__MIN_VALUE, THR_START_PROP_RANGE__MAX_VALUE, THR_START_PROP_RANGE__FACTORY_SETTING, 110004UL },
+	{ 1, THR_END_PROP_RANGE__ACCESS_LEVEL, 12, THR_END_PROP_RANGE__MIN_VALUE, THR_END_PROP_RANGE__MAX_VALUE, THR_END_PROP_RANGE__FACTORY_SETTING, 110016UL },
+	{ 1, THR_START_TEMP_GAS_INJECTION__ACCESS_LEVEL, 11, THR_START_TEMP_GAS_INJECTION__MIN_VALUE, THR_START_TEMP_GAS_INJECTION__MAX_VALUE, THR_START_TEMP_GAS_INJECTION__FACTORY_SETTING, 110028UL },
+	{ 1, THR_PRERUN_TIME_COMPRESSSOR__ACCESS_LEVEL, 16, THR_PRERUN_TIME_COMPRESSSOR__MIN_VALUE, THR_PRERUN_TIME_COMPRESSSOR__MAX_VALUE, THR_PRERUN_TIME_COMPRESSSOR__FACTORY_SETTING, 110039UL },
+	{ 1, THR_MAX_DELTA_T_IN_CHAMBER__ACCESS_LEVEL, 11, THR_MAX_DELTA_T_IN_CHAMBER__MIN_VALUE, THR_MAX_DELTA_T_IN_CHAMBER__MAX_VALUE, THR_MAX_DELTA_T_IN_CHAMBER__FACTORY_SETTING, 110055UL },
+	{ 1, THR_MAX_DELTA_T_BETWEEN_CHAMBERS__ACCESS_LEVEL, 12, THR_MAX_DELTA_T_BETWEEN_CHAMBERS__MIN_VALUE, THR_MAX_DELTA_T_BETWEEN_CHAMBERS__MAX_VALUE, THR_MAX_DELTA_T_BETWEEN_CHAMBERS__FACTORY_SETTING, 110066UL },
+	{ 1, THR_TIMEOUT_STARTUP__ACCESS_LEVEL, 25, THR_TIMEOUT_STARTUP__MIN_VALUE, THR_TIMEOUT_STARTUP__MAX_VALUE, THR_TIMEOUT_STARTUP__FACTORY_SETTING, 110078UL },
+	{ 1, THR_MAX_TEMP_CHAMBER__ACCESS_LEVEL, 11, THR_MAX_TEMP_CHAMBER__MIN_VALUE, THR_MAX_TEMP_CHAMBER__MAX_VALUE, THR_MAX_TEMP_CHAMBER__FACTORY_SETTING, 110103UL },
+	{ 1, THR_MIN_TEMP_CHAMBER__ACCESS_LEVEL, 11, THR_MIN_TEMP_CHAMBER__MIN_VALUE, THR_MIN_TEMP_CHAMBER__MAX_VALUE, THR_MIN_TEMP_CHAMBER__FACTORY_SETTING, 110114UL },
+	{ 1, THR_SETPOINT_HEAT_UP_RAMP__ACCESS_LEVEL, 5, THR_SETPOINT_HEAT_UP_RAMP__MIN_VALUE, THR_SETPOINT_HEAT_UP_RAMP__MAX_VALUE, THR_SETPOINT_HEAT_UP_RAMP__FACTORY_SETTING, 110125UL },
+	{ 1, THR_TEMP_CTRL_KP__ACCESS_LEVEL, 14, THR_TEMP_CTRL_KP__MIN_VALUE, THR_TEMP_CTRL_KP__MAX_VALUE, THR_TEMP_CTRL_KP__FACTORY_SETTING, 110130UL },
+	{ 1, THR_TEMP_CTRL_KI__ACCESS_LEVEL, 14, THR_TEMP_CTRL_KI__MIN_VALUE, THR_TEMP_CTRL_KI__MAX_VALUE, THR_TEMP_CTRL_KI__FACTORY_SETTING, 110144UL },
+	{ 1, THR_TEMP_CTRL_KD__ACCESS_LEVEL, 14, THR_TEMP_CTRL_KD__MIN_VALUE, THR_TEMP_CTRL_KD__MAX_VALUE, THR_TEMP_CTRL_KD__FACTORY_SETTING, 110158UL },
+	{ 1, THR_FLOW_CTRL_KP__ACCESS_LEVEL, 14, THR_FLOW_CTRL_KP__MIN_VALUE, THR_FLOW_CTRL_KP__MAX_VALUE, THR_FLOW_CTRL_KP__FACTORY_SETTING, 110172UL },
+	{ 1, THR_FLOW_CTRL_KI__ACCESS_LEVEL, 14, THR_FLOW_CTRL_KI__MIN_VALUE, THR_FLOW_CTRL_KI__MAX_VALUE, THR_FLOW_CTRL_KI__FACTORY_SETTING, 110186UL },
+	{ 1, THR_FLOW_CTRL_KD__ACCESS_LEVEL, 14, THR_FLOW_CTRL_KD__MIN_VALUE, THR_FLOW_CTRL_KD__MAX_VALUE, THR_FLOW_CTRL_KD__FACTORY_SETTING, 110200UL },
+	{ 1, THERMOREACTOR_OPTION__ACCESS_LEVEL, 1, THERMOREACTOR_OPTION__MIN_VALUE, THERMOREACTOR_OPTION__MAX_VALUE, THERMOREACTOR_OPTION__FACTORY_SETTING, 110214UL },
+	{ 1, LANGUAGE_SELECTION__ACCESS_LEVEL, 15, LANGUAGE_SELECTION__MIN_VALUE, LANGUAGE_SELECTION__MAX_VALUE, LANGUAGE_SELECTION__FACTORY_SETTING, 110215UL },
+	{ 1, GBV_PAR_FLOW_DEMAND_20mA__ACCESS_LEVEL, 13, GBV_PAR_FLOW_DEMAND_20mA__MIN_VALUE, GBV_PAR_FLOW_DEMAND_20mA__MAX_VALUE, GBV_PAR_FLOW_DEMAND_20mA__FACTORY_SETTING, 110230UL },
+	{ 1, GBV_PAR_FLOW_VALUE_20mA__ACCESS_LEVEL, 13, GBV_PAR_FLOW_VALUE_20mA__MIN_VALUE, GBV_PAR_FLOW_VALUE_20mA__MAX_VALUE, GBV_PAR_FLOW_VALUE_20mA__FACTORY_SETTING, 110243UL },
+	{ 1, GBV_PAR_REG_OPTION__ACCESS_LEVEL, 2, GBV_PAR_REG_OPTION__MIN_VALUE, GBV_PAR_REG_OPTION__MAX_VALUE, GBV_PAR_REG_OPTION__FACTORY_SETTING, 110256UL },
+	{ 1, GBV_PAR_REG_SETPOINT__ACCESS_LEVEL, 13, GBV_PAR_REG_SETPOINT__MIN_VALUE, GBV_PAR_REG_SETPOINT__MAX_VALUE, GBV_PAR_REG_SETPOINT__FACTORY_SETTING, 110258UL },
+	{ 1, GBV_PAR_REG_KP__ACCESS_LEVEL, 14, GBV_PAR_REG_KP__MIN_VALUE, GBV_PAR_REG_KP__MAX_VALUE, GBV_PAR_REG_KP__FACTORY_SETTING, 110271UL },
+	{ 1, GBV_PAR_REG_KI__ACCESS_LEVEL, 14, GBV_PAR_REG_KI__MIN_VALUE, GBV_PAR_REG_KI__MAX_VALUE, GBV_PAR_REG_KI__FACTORY_SETTING, 110285UL },
+	{ 1, GBV_PAR_RELEASE_POWER__ACCESS_LEVEL, 14, GBV_PAR_RELEASE_POWER__MIN_VALUE, GBV_PAR_RELEASE_POWER__MAX_VALUE, GBV_PAR_RELEASE_POWER__FACTORY_SETTING, 110299UL },
+	{ 1, GBV_PAR_ON_BY_POWER_DELAY__ACCESS_LEVEL, 14, GBV_PAR_ON_BY_POWER_DELAY__MIN_VALUE, GBV_PAR_ON_BY_POWER_DELAY__MAX_VALUE, GBV_PAR_ON_BY_POWER_DELAY__FACTORY_SETTING, 110313UL },
+	{ 1, GBV_PAR_CH4_OPTION_ACTIVE__ACCESS_LEVEL, 1, GBV_PAR_CH4_OPTION_ACTIVE__MIN_VALUE, GBV_PAR_CH4_OPTION_ACTIVE__MAX_VALUE, GBV_PAR_CH4_OPTION_ACTIVE__FACTORY_SETTING, 110327UL },
+	{ 1, TEC_RAMP_TIME_START_TO_IDLE__ACCESS_LEVEL, 20, TEC_RAMP_TIME_START_TO_IDLE__MIN_VALUE, TEC_RAMP_TIME_START_TO_IDLE__MAX_VALUE, TEC_RAMP_TIME_START_TO_IDLE__FACTORY_SETTING, 110328UL },
+	{ 1, GAS_COUNTER__ACCESS_LEVEL, 31, GAS_COUNTER__MIN_VALUE, GAS_COUNTER__MAX_VALUE, GAS_COUNTER__FACTORY_SETTING, 110348UL },
+	{ 1, GAS_COUNTER_B__ACCESS_LEVEL, 31, GAS_COUNTER_B__MIN_VALUE, GAS_COUNTER_B__MAX_VALUE, GAS_COUNTER_B__FACTORY_SETTING, 110379UL },
+	{ 1, GOV_SENSITIVITY_OF_SPEED_INPUTS__ACCESS_LEVEL, 15, GOV_SENSITIVITY_OF_SPEED_INPUTS__MIN_VALUE, GOV_SENSITIVITY_OF_SPEED_INPUTS__MAX_VALUE, GOV_SENSITIVITY_OF_SPEED_INPUTS__FACTORY_SETTING, 110410UL },
+	{ 1, NOMINAL_RPM_SELECTION__ACCESS_LEVEL, 2, NOMINAL_RPM_SELECTION__MIN_VALUE, NOMINAL_RPM_SELECTION__MAX_VALUE, NOMINAL_RPM_SELECTION__FACTORY_SETTING, 110425UL },
+	{ 1, AUD_BATT_VOLT_MIN_LIMIT__ACCESS_LEVEL, 7, AUD_BATT_VOLT_MIN_LIMIT__MIN_VALUE, AUD_BATT_VOLT_MIN_LIMIT__MAX_VALUE, AUD_BATT_VOLT_MIN_LIMIT__FACTORY_SETTING, 110427UL },
+	{ 1, AUD_BATT_VOLT_BLOCKING_TIME__ACCESS_LEVEL, 24, AUD_BATT_VOLT_BLOCKING_TIME__MIN_VALUE, AUD_BATT_VOLT_BLOCKING_TIME__MAX_VALUE, AUD_BATT_VOLT_BLOCKING_TIME__FACTORY_SETTING, 110434UL },
+	{ 1, AUD_BATT_VOLT_TIMER__ACCESS_LEVEL, 24, AUD_BATT_VOLT_TIMER__MIN_VALUE, AUD_BATT_VOLT_TIMER__MAX_VALUE, AUD_BATT_VOLT_TIMER__FACTORY_SETTING, 110458UL },
+	{ 1, NOX_PAR_ATI1_OPTION__ACCESS_LEVEL, 1, NOX_PAR_ATI1_OPTION__MIN_VALUE, NOX_PAR_ATI1_OPTION__MAX_VALUE, NOX_PAR_ATI1_OPTION__FACTORY_SETTING, 110482UL },
+	{ 1, NOX_PAR_ATO1_OPTION__ACCESS_LEVEL, 1, NOX_PAR_ATO1_OPTION__MIN_VALUE, NOX_PAR_ATO1_OPTION__MAX_VALUE, NOX_PAR_ATO1_OPTION__FACTORY_SETTING, 110483UL },
+	{ 1, NOX_PAR_O2_REFERENCE__ACCESS_LEVEL, 8, NOX_PAR_O2_REFERENCE__MIN_VALUE, NOX_PAR_O2_REFERENCE__MAX_VALUE, NOX_PAR_O2_REFERENCE__FACTORY_SETTING, 110484UL },
+	{ 1, SCR_PAR_UREA_SET_AT_40__ACCESS_LEVEL, 11, SCR_PAR_UREA_SET_AT_40__MIN_VALUE, SCR_PAR_UREA_SET_AT_40__MAX_VALUE, SCR_PAR_UREA_SET_AT_40__FACTORY_SETTING, 110492UL },
+	{ 1, SCR_PAR_UREA_SET_AT_100__ACCESS_LEVEL, 13, SCR_PAR_UREA_SET_AT_100__MIN_VALUE, SCR_PAR_UREA_SET_AT_100__MAX_VALUE, SCR_PAR_UREA_SET_AT_100__FACTORY_SETTING, 110503UL },
+	{ 1, SCR_PAR_UREA_INJ_BAND_LOWER_LIMIT__ACCESS_LEVEL, 10, SCR_PAR_UREA_INJ_BAND_LOWER_LIMIT__MIN_VALUE, SCR_PAR_UREA_INJ_BAND_LOWER_LIMIT__MAX_VALUE, SCR_PAR_UREA_INJ_BAND_LOWER_LIMIT__FACTORY_SETTING, 110516UL },
+	{ 1, SCR_PAR_UREA_INJ_BAND_UPPER_LIMIT__ACCESS_LEVEL, 11, SCR_PAR_UREA_INJ_BAND_UPPER_LIMIT__MIN_VALUE, SCR_PAR_UREA_INJ_BAND_UPPER_LIMIT__MAX_VALUE, SCR_PAR_UREA_INJ_BAND_UPPER_LIMIT__FACTORY_SETTING, 110526UL },
+	{ 1, SCR_PAR_UREA_REFILLING_TIMEOUT__ACCESS_LEVEL, 19, SCR_PAR_UREA_REFILLING_TIMEOUT__MIN_VALUE, SCR_PAR_UREA_REFILLING_TIMEOUT__MAX_VALUE, SCR_PAR_UREA_REFILLING_TIMEOUT__FACTORY_SETTING, 110537UL },
+	{ 1, SCR_PAR_REG_SETPOINT__ACCESS_LEVEL, 10, SCR_PAR_REG_SETPOINT__MIN_VALUE, SCR_PAR_REG_SETPOINT__MAX_VALUE, SCR_PAR_REG_SETPOINT__FACTORY_SETTING, 110556UL },
+	{ 1, SCR_PAR_RELEASE_LOAD__ACCESS_LEVEL, 14, SCR_PAR_RELEASE_LOAD__MIN_VALUE, SCR_PAR_RELEASE_LOAD__MAX_VALUE, SCR_PAR_RELEASE_LOAD__FACTORY_SETTING, 110566UL },
+	{ 1, SCR_PAR_NOX_CTRL_ERROR_STOPPING_OR_NOT__ACCESS_LEVEL, 1, SCR_PAR_NOX_CTRL_ERROR_STOPPING_OR_NOT__MIN_VALUE, SCR_PAR_NOX_CTRL_ERROR_STOPPING_OR_NOT__MAX_VALUE, SCR_PAR_NOX_CTRL_ERROR_STOPPING_OR_NOT__FACTORY_SETTING, 110580UL },
+	{ 1, ENG_TOOTH_ON_TOOTH_DELAY__ACCESS_LEVEL, 13, ENG_TOOTH_ON_TOOTH_DELAY__MIN_VALUE, ENG_TOOTH_ON_TOOTH_DELAY__MAX_VALUE, ENG_TOOTH_ON_TOOTH_DELAY__FACTORY_SETTING, 110581UL },
+	{ 1, SPEED_REG_DROOP_MODE__ACCESS_LEVEL, 32, SPEED_REG_DROOP_MODE__MIN_VALUE, SPEED_REG_DROOP_MODE__MAX_VALUE, SPEED_REG_DROOP_MODE__FACTORY_SETTING, 110594UL },
+	{ 1, SPEED_REG_DROOP_VALUE__ACCESS_LEVEL, 7, SPEED_REG_DROOP_VALUE__MIN_VALUE, SPEED_REG_DROOP_VALUE__MAX_VALUE, SPEED_REG_DROOP_VALUE__FACTORY_SETTING, 110626UL },
+	{ 1, SPEED_REG_DROOP_RAMP__ACCESS_LEVEL, 10, SPEED_REG_DROOP_RAMP__MIN_VALUE, SPEED_REG_DROOP_RAMP__MAX_VALUE, SPEED_REG_DROOP_RAMP__FACTORY_SETTING, 110633UL },
+	{ 1, SPEED_REG_DROOP_SENS__ACCESS_LEVEL, 7, SPEED_REG_DROOP_SENS__MIN_VALUE, SPEED_REG_DROOP_SENS__MAX_VALUE, SPEED_REG_DROOP_SENS__FACTORY_SETTING, 110643UL },
+	{ 1, POWER_REG_SPEED_ADJUST__ACCESS_LEVEL, 1, POWER_REG_SPEED_ADJUST__MIN_VALUE, POWER_REG_SPEED_ADJUST__MAX_VALUE, POWER_REG_SPEED_ADJUST__FACTORY_SETTING, 110650UL },
+	{ 1, POWER_REG_SPEED_P__ACCESS_LEVEL, 17, POWER_REG_SPEED_P__MIN_VALUE, POWER_REG_SPEED_P__MAX_VALUE, POWER_REG_SPEED_P__FACTORY_SETTING, 110651UL },
+	{ 1, POWER_REG_SPEED_I__ACCESS_LEVEL, 14, POWER_REG_SPEED_I__MIN_VALUE, POWER_REG_SPEED_I__MAX_VALUE, POWER_REG_SPEED_I__FACTORY_SETTING, 110668UL },
+	{ 1, POWER_REG_SPEED_D__ACCESS_LEVEL, 17, POWER_REG_SPEED_D__MIN_VALUE, POWER_REG_SPEED_D__MAX_VALUE, POWER_REG_SPEED_D__FACTORY_SETTING, 110682UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 110699UL },	// FUNCTION_ASSIGNMENT_01
+	{ 0, 0, 32, 0L, 0L, 0L, 110731UL },	// FUNCTION_ASSIGNMENT_02
+	{ 0, 0, 32, 0L, 0L, 0L, 110763UL },	// FUNCTION_ASSIGNMENT_03
+	{ 0, 0, 32, 0L, 0L, 0L, 110795UL },	// FUNCTION_ASSIGNMENT_04
+	{ 0, 0, 32, 0L, 0L, 0L, 110827UL },	// FUNCTION_ASSIGNMENT_05
+	{ 0, 0, 32, 0L, 0L, 0L, 110859UL },	// FUNCTION_ASSIGNMENT_06
+	{ 0, 0, 32, 0L, 0L, 0L, 110891UL },	// FUNCTION_ASSIGNMENT_07
+	{ 0, 0, 32, 0L, 0L, 0L, 110923UL },	// FUNCTION_ASSIGNMENT_08
+	{ 0, 0, 32, 0L, 0L, 0L, 110955UL },	// FUNCTION_ASSIGNMENT_09
+	{ 0, 0, 32, 0L, 0L, 0L, 110987UL },	// FUNCTION_ASSIGNMENT_10
+	{ 0, 0, 32, 0L, 0L, 0L, 111019UL },	// FUNCTION_ASSIGNMENT_11
+	{ 0, 0, 32, 0L, 0L, 0L, 111051UL },	// FUNCTION_ASSIGNMENT_12
+	{ 0, 0, 32, 0L, 0L, 0L, 111083UL },	// FUNCTION_ASSIGNMENT_13
+	{ 0, 0, 32, 0L, 0L, 0L, 111115UL },	// FUNCTION_ASSIGNMENT_14
+	{ 0, 0, 32, 0L, 0L, 0L, 111147UL },	// FUNCTION_ASSIGNMENT_15
+	{ 0, 0, 32, 0L, 0L, 0L, 111179UL },	// FUNCTION_ASSIGNMENT_16
+	{ 1, HMI_PAGE_SELECT_CONFIG__ACCESS_LEVEL, 17, HMI_PAGE_SELECT_CONFIG__MIN_VALUE, HMI_PAGE_SELECT_CONFIG__MAX_VALUE, HMI_PAGE_SELECT_CONFIG__FACTORY_SETTING, 111211UL },
+	{ 0, 0, 32, 0L, 0L, 0L, 111228UL },	// HMI_PARA_SELECT_CONFIG_1
+	{ 0, 0, 32, 0L, 0L, 0L, 111260UL },	// HMI_PARA_SELECT_CONFIG_2
+	{ 0, 0, 32, 0L, 0L, 0L, 111292UL },	// HMI_PARA_SELECT_CONFIG_3
+	{ 0, 0, 32, 0L, 0L, 0L, 111324UL },	// SUP_ENTER_ID
+	{ 0, 0, 32, 0L, 0L, 0L, 111356UL },	// SIM_VAL
+	{ 1, SOFTWARE_VERSION__ACCESS_LEVEL, 30, SOFTWARE_VERSION__MIN_VALUE, SOFTWARE_VERSION__MAX_VALUE, SOFTWARE_VERSION__FACTORY_SETTING, 111388UL },
+	{ 1, CHECK_VALID_NOVRAM__ACCESS_LEVEL, 31, CHECK_VALID_NOVRAM__MIN_VALUE, CHECK_VALID_NOVRAM__MAX_VALUE, CHECK_VALID_NOVRAM__FACTORY_SETTING, 111418UL } 
+};
+
+const DU16 PAR_NbrOfDesc = 912;
+
+#if (OPTION_PAR_PACKED == TRUE)
+// packed parameter image: 111449 bits instead of 129472
+DU32 PAR_PackedValue[3483];
+const DU16 PAR_PackedWords = 3483;
+#endif
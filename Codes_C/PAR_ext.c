@@ -0,0 +1,1085 @@
+/**
+ * @file PAR_ext.c
+ * @ingroup Application
+ * Extensions of the parameter handler PAR.c
+ *
+ * @remarks
+ * parameter change notification:
+ * PAR_SetValue() calls PAR_MarkChanged(RefInd), file transfer and factory restore
+ * call PAR_MarkAllChanged(). The hook in PAR.c is one line at the end of PAR_SetValue():
+ *     PAR_MarkChanged(RefInd);
+ * All writers of PARA[] in this file and in PAR_delta.c mark the parameters themselves.
+ * The modules register listeners for the reference indices they derive values from,
+ * PAR_DispatchChanges() is called from the 100ms and 1000ms task
+ * (MAIN_control_100ms/MAIN_control_1000ms) and calls them once per change, the
+ * PAR_LISTEN_ALL listeners (snapshots) in addition every PAR_NOTIFY_REFRESH_TIME.
+ *
+ * parameter id lookup:
+ * PAR_Get_Index() uses the table sorted by id (PAR_IdLookup_Find) instead of
+ * scanning PARA[], O(log n) per id for modbus, Bing-Bang and file transfer.
+ *
+ * incremental NOVRAM save:
+ * SaveParameter() calls PAR_Nov_SaveDirty() instead of copying all of PARA[] into
+ * ParaValue[], MAIN_control_init() calls PAR_Nov_Verify() once after PAR_init(),
+ * PAR_control_1000ms() calls PAR_Nov_Scrub().
+ *
+ * parameter descriptors:
+ * min, max, factory setting and access level come from the const table PAR_Desc[]
+ * (PAR_desc.c, generated). PAR_GetMinValue() etc. return the descriptor values,
+ * PAR_init() and PAR_Restore_Factory_Settings() call PAR_Desc_LoadFactorySettings().
+ *
+ * batch range validation:
+ * MAIN_control_init() calls PAR_Validate_Init() and PAR_ValidateAll(TRUE, ...) after
+ * PAR_init(), file transfer PAR_ValidateAll() after loading a parameter set.
+ * tools/bench_validate.c compares it with the check per parameter.
+ *
+ * parameter transactions:
+ * PAR_ApplyTransaction() is called at the beginning of MAIN_control_100ms, before
+ * PAR_DispatchChanges(), and writes the committed values with PAR_SetValue().
+ *
+ * packed parameter image (OPTION_PAR_PACKED):
+ * PAR_PackedValue[] holds every parameter in the bit width of its range,
+ * PAR_Packed_FromPARA()/PAR_Packed_ToPARA() convert the whole image.
+ *
+ * parameter access profiler (OPTION_PAR_PROFILER):
+ * PAR_VALUE() and the accessors of PAR.c (PAR_Profile_Hit) count every read per
+ * reference index and task. The task loops bracket their body with
+ * PAR_Profile_EnterTask()/PAR_Profile_LeaveTask(), PAR_Profile_Dump() prints the
+ * most read parameters per task to choose the members of the snapshot structs.
+ *
+ * @date 16-oct-2026
+ *
+ * changes:
+ *      16.10.2026      parameter change notification
+ *      16.10.2026      parameter id lookup table
+ *      16.10.2026      incremental NOVRAM save
+ *      16.10.2026      const parameter descriptors
+ *      16.10.2026      packed parameter image
+ *      16.10.2026      parameter transactions
+ *      17.10.2026      batch range validation
+ *      17.10.2026      parameter access profiler
+ *      17.10.2026      dirty bitsets switched instead of cleared, fallback refresh of the snapshots
+ *      17.10.2026      page CRCs verified after PAR_init(), factory settings for a bad page
+ *      17.10.2026      NOVRAM dirty pages as active and standby bitset
+ *
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "options.h"
+#include "deif_types.h"
+#include "appl_types.h"
+
+#include "PAR.h"
+#include "STOPCONDITIONS.h"
+
+
+// change notification data for global use
+t_PAR_notify PAR_Notify;
+
+typedef struct
+{
+	DU8				Task;
+	DU16			FirstRefInd;
+	DU16			LastRefInd;
+	t_PAR_listener	Listener;
+} t_PAR_listener_entry;
+
+// Local variables
+static t_PAR_listener_entry Listeners[PAR_MAX_LISTENERS];
+static DU8 NbrOfListeners = 0;
+// changes to dispatch again (transaction applied while dispatching), only used by PAR_DispatchChanges()
+static DU32 Retry[PAR_NOTIFY_NBR_OF_TASKS][PAR_DIRTY_WORDS];
+static DBOOL RetryPending[PAR_NOTIFY_NBR_OF_TASKS];
+// cycle time of the tasks [ms]
+static const DU16 NotifyCycleTime[PAR_NOTIFY_NBR_OF_TASKS] = { 100, 1000 };
+
+
+// mark one parameter as changed
+void PAR_MarkChanged(DU16 RefInd)
+{
+	DU8 Task;
+
+	if ((RefInd == 0) || (RefInd > HIGHEST_PARREFIND))
+		return;
+
+	for (Task = 0; Task < PAR_NOTIFY_NBR_OF_TASKS; Task++)
+		PAR_Notify.Dirty[Task][PAR_Notify.Active[Task]][RefInd >> 5] |= (1UL << (RefInd & 31));
+
+	PAR_Notify.Generation++;
+
+	PAR_Nov_MarkIndex(ParRefInd[RefInd]);
+}
+
+// mark all parameters as changed (file transfer, factory settings)
+void PAR_MarkAllChanged(void)
+{
+	DU8 Task;
+	DU16 w;
+
+	for (Task = 0; Task < PAR_NOTIFY_NBR_OF_TASKS; Task++)
+		for (w = 0; w < PAR_DIRTY_WORDS; w++)
+			PAR_Notify.Dirty[Task][PAR_Notify.Active[Task]][w] = 0xFFFFFFFFUL;
+
+	PAR_Notify.Generation++;
+
+	PAR_Nov_MarkAll();
+}
+
+// register a function to be called if one of the parameters FirstRefInd...LastRefInd changed
+// FirstRefInd = PAR_LISTEN_ALL: called on any change
+// a listener may be registered for several ranges, it is called only once per dispatch
+DBOOL PAR_RegisterListener(DU8 Task, DU16 FirstRefInd, DU16 LastRefInd, t_PAR_listener Listener)
+{
+	DU8 i;
+
+	if ((Task >= PAR_NOTIFY_NBR_OF_TASKS) || (Listener == 0))
+		return (FALSE);
+
+	if (FirstRefInd == PAR_LISTEN_ALL)
+		LastRefInd = PAR_LISTEN_ALL;
+	else if ((LastRefInd < FirstRefInd) || (LastRefInd > HIGHEST_PARREFIND))
+		return (FALSE);
+
+	// already registered (module initialised again)
+	for (i = 0; i < NbrOfListeners; i++)
+	{
+		if (   (Listeners[i].Task        == Task)
+			&& (Listeners[i].FirstRefInd == FirstRefInd)
+			&& (Listeners[i].LastRefInd  == LastRefInd)
+			&& (Listeners[i].Listener    == Listener))
+			return (TRUE);
+	}
+
+	if (NbrOfListeners >= PAR_MAX_LISTENERS)
+		return (FALSE);
+
+	Listeners[NbrOfListeners].Task        = Task;
+	Listeners[NbrOfListeners].FirstRefInd = FirstRefInd;
+	Listeners[NbrOfListeners].LastRefInd  = LastRefInd;
+	Listeners[NbrOfListeners].Listener    = Listener;
+	NbrOfListeners++;
+
+	return (TRUE);
+}
+
+// check if one of the parameters FirstRefInd...LastRefInd is marked in Changed
+static DBOOL RangeChanged(const DU32 *Changed, DU16 FirstRefInd, DU16 LastRefInd)
+{
+	DU16 w;
+	DU16 FirstWord = FirstRefInd >> 5;
+	DU16 LastWord  = LastRefInd >> 5;
+	DU32 Mask;
+
+	for (w = FirstWord; w <= LastWord; w++)
+	{
+		Mask = 0xFFFFFFFFUL;
+		if (w == FirstWord)
+			Mask &= (0xFFFFFFFFUL << (FirstRefInd & 31));
+		if (w == LastWord)
+			Mask &= (0xFFFFFFFFUL >> (31 - (LastRefInd & 31)));
+
+		if (Changed[w] & Mask)
+			return (TRUE);
+	}
+	return (FALSE);
+}
+
+// call the listeners of the task for all parameters changed since the last call
+void PAR_DispatchChanges(DU8 Task)
+{
+	DU32 Generation;
+	DU32 ApplySeq;
+	DU32 Changed[PAR_DIRTY_WORDS];
+	DU32 *pDirty;
+	DBOOL Pending[PAR_MAX_LISTENERS];
+	DBOOL AnyChanged = FALSE;
+	DBOOL Refresh = FALSE;
+	DU16 w;
+	DU8 i, j;
+
+	if (Task >= PAR_NOTIFY_NBR_OF_TASKS)
+		return;
+
+	// fallback: snapshots are read again every PAR_NOTIFY_REFRESH_TIME
+	PAR_Notify.RefreshTime[Task] += NotifyCycleTime[Task];
+	if (PAR_Notify.RefreshTime[Task] >= PAR_NOTIFY_REFRESH_TIME)
+		Refresh = TRUE;
+
+	// transaction just being written into PARA[]: next cycle
+	ApplySeq = PAR_Notify.ApplySeq;
+	if (ApplySeq & 1UL)
+		return;
+
+	// nothing changed since the last dispatch
+	Generation = PAR_Notify.Generation;
+	if ((Generation == PAR_Notify.DispatchedGeneration[Task]) && !RetryPending[Task] && !Refresh)
+		return;
+	PAR_Notify.DispatchedGeneration[Task] = Generation;
+
+	// switch the bitsets, then take over the one written until now; a mark made meanwhile
+	// (or by a listener) goes into the other bitset, or into this one before it is read,
+	// and is dispatched in the next cycle at the latest
+	pDirty = PAR_Notify.Dirty[Task][PAR_Notify.Active[Task]];
+	PAR_Notify.Active[Task] ^= 1;
+	for (w = 0; w < PAR_DIRTY_WORDS; w++)
+	{
+		Changed[w] = pDirty[w] | Retry[Task][w];
+		pDirty[w] = 0;
+		Retry[Task][w] = 0;
+		if (Changed[w])
+			AnyChanged = TRUE;
+	}
+	RetryPending[Task] = FALSE;
+	if (!AnyChanged && !Refresh)
+		return;
+	if (Refresh)
+		PAR_Notify.RefreshTime[Task] = 0;
+
+	for (i = 0; i < NbrOfListeners; i++)
+	{
+		Pending[i] = FALSE;
+		if (Listeners[i].Task != Task)
+			continue;
+		if (Listeners[i].FirstRefInd == PAR_LISTEN_ALL)
+			Pending[i] = TRUE;
+		else if (AnyChanged)
+			Pending[i] = RangeChanged(Changed, Listeners[i].FirstRefInd, Listeners[i].LastRefInd);
+	}
+
+	for (i = 0; i < NbrOfListeners; i++)
+	{
+		if (!Pending[i])
+			continue;
+
+		// same function registered for several ranges: call once
+		for (j = i + 1; j < NbrOfListeners; j++)
+		{
+			if (Listeners[j].Listener == Listeners[i].Listener)
+				Pending[j] = FALSE;
+		}
+		Listeners[i].Listener();
+	}
+
+	// a transaction was applied meanwhile, the listeners may have read half of it: again
+	if (PAR_Notify.ApplySeq != ApplySeq)
+	{
+		for (w = 0; w < PAR_DIRTY_WORDS; w++)
+			Retry[Task][w] = Changed[w];
+		RetryPending[Task] = TRUE;
+		if (!AnyChanged)
+			PAR_Notify.RefreshTime[Task] = PAR_NOTIFY_REFRESH_TIME;
+	}
+}
+
+
+// ******************************************************************
+// parameter id lookup
+// ******************************************************************
+
+static t_PAR_id_lookup IdLookup[NBR_OF_PARA];
+static DU16  IdLookupSize  = 0;
+static DBOOL IdLookupValid = FALSE;
+
+static int IdLookup_Compare(const void *a, const void *b)
+{
+	const t_PAR_id_lookup *pa = (const t_PAR_id_lookup *)a;
+	const t_PAR_id_lookup *pb = (const t_PAR_id_lookup *)b;
+
+	if (pa->Id != pb->Id)
+		return ((pa->Id < pb->Id) ? -1 : 1);
+	// same id twice: the lower index first, like the linear search
+	if (pa->Index != pb->Index)
+		return ((pa->Index < pb->Index) ? -1 : 1);
+	return (0);
+}
+
+// build the table of all parameters sorted by id
+void PAR_IdLookup_Build(void)
+{
+	DU16 RefInd;
+	DU16 Index;
+
+	IdLookupSize = 0;
+	for (RefInd = 1; RefInd <= HIGHEST_PARREFIND; RefInd++)
+	{
+		Index = ParRefInd[RefInd];
+		if ((Index >= NBR_OF_PARA) || (IdLookupSize >= NBR_OF_PARA))
+			continue;
+
+		IdLookup[IdLookupSize].Id    = PAR_GetId(RefInd);
+		IdLookup[IdLookupSize].Index = Index;
+		IdLookupSize++;
+	}
+	qsort(IdLookup, IdLookupSize, sizeof(t_PAR_id_lookup), IdLookup_Compare);
+
+	IdLookupValid = TRUE;
+}
+
+// ids or parameter table changed: build again on next use
+void PAR_IdLookup_Invalidate(void)
+{
+	IdLookupValid = FALSE;
+}
+
+// find the index of a parameter id in PARA[], FALSE if the id does not exist
+DBOOL PAR_IdLookup_Find(DU16 parameter_id, DU16 *Index)
+{
+	DU16 Low, High, Mid;
+
+	if (!IdLookupValid)
+		PAR_IdLookup_Build();
+
+	// lower bound: first entry with Id >= parameter_id
+	Low  = 0;
+	High = IdLookupSize;
+	while (Low < High)
+	{
+		Mid = Low + (High - Low) / 2;
+		if (IdLookup[Mid].Id < parameter_id)
+			Low = Mid + 1;
+		else
+			High = Mid;
+	}
+
+	if ((Low < IdLookupSize) && (IdLookup[Low].Id == parameter_id))
+	{
+		*Index = IdLookup[Low].Index;
+		return (TRUE);
+	}
+	return (FALSE);
+}
+
+
+// ******************************************************************
+// incremental NOVRAM save
+// ******************************************************************
+
+t_PAR_nov_stat PAR_NovStat;
+// page CRCs, linked into the NOVRAM section of ParaValue[]
+DU16 ParaPageCrc[PAR_NOV_NBR_OF_PAGES];
+DU32 ParaPageCrcMagic;
+
+static DU32 NovDirty[2][PAR_NOV_DIRTY_WORDS];	// one bit per page, active and standby
+static volatile DU8 NovActive = 0;				// bitset marked by PAR_Nov_MarkIndex()
+static DU16 NovScrubPage = 0;
+static DBOOL NovVerified = FALSE;				// PAR_Nov_Verify() done, PARA[] is valid
+
+// CRC-16-CCITT (polynomial 0x1021), start value 0xFFFF
+DU16 PAR_Crc16(DU16 Crc, const DU8 *Data, DU32 Length)
+{
+	DU8 Bit;
+
+	while (Length--)
+	{
+		Crc ^= (DU16)(*Data++) << 8;
+		for (Bit = 0; Bit < 8; Bit++)
+		{
+			if (Crc & 0x8000)
+				Crc = (DU16)((Crc << 1) ^ 0x1021);
+			else
+				Crc = (DU16)(Crc << 1);
+		}
+	}
+	return (Crc);
+}
+
+static DU16 PageFirst(DU16 Page)
+{
+	return (Page * PAR_NOV_PAGE_SIZE);
+}
+
+static DU16 PageEnd(DU16 Page)
+{
+	DU32 End = (DU32)(Page + 1) * PAR_NOV_PAGE_SIZE;
+
+	return ((End > NBR_OF_PARA) ? NBR_OF_PARA : (DU16)End);
+}
+
+static DU16 PageCrc(DU16 Page)
+{
+	DU16 First = PageFirst(Page);
+
+	return (PAR_Crc16(0xFFFF, (const DU8 *)&ParaValue[First], (DU32)(PageEnd(Page) - First) * sizeof(DS32)));
+}
+
+// write one page of PARA[] into ParaValue[], returns the number of bytes written
+static DU32 WritePage(DU16 Page)
+{
+	DU16 i;
+	DU32 Bytes = 0;
+
+	for (i = PageFirst(Page); i < PageEnd(Page); i++)
+	{
+		if (ParaValue[i] != PARA[i].Value)
+		{
+			ParaValue[i] = PARA[i].Value;
+			Bytes += sizeof(DS32);
+		}
+	}
+	if (Bytes)
+	{
+		ParaPageCrc[Page] = PageCrc(Page);
+		Bytes += sizeof(DU16);
+	}
+	return (Bytes);
+}
+
+// mark the page of a parameter (index in PARA[]) for the next save
+void PAR_Nov_MarkIndex(DU16 Index)
+{
+	DU16 Page;
+
+	if (Index >= NBR_OF_PARA)
+		return;
+
+	Page = Index / PAR_NOV_PAGE_SIZE;
+	NovDirty[NovActive][Page >> 5] |= (1UL << (Page & 31));
+}
+
+// mark all pages (file transfer, factory settings)
+void PAR_Nov_MarkAll(void)
+{
+	DU16 w;
+
+	for (w = 0; w < PAR_NOV_DIRTY_WORDS; w++)
+		NovDirty[NovActive][w] = 0xFFFFFFFFUL;
+}
+
+// write all marked pages, returns the number of bytes written to NOVRAM
+DU32 PAR_Nov_SaveDirty(void)
+{
+	DU16 w, Page;
+	DU32 Dirty;
+	DU32 *pDirty;
+	DU32 Bytes = 0;
+	DU16 Pages = 0;
+
+	// switch the bitsets like PAR_DispatchChanges(), then write the pages of the standby one;
+	// a mark made meanwhile goes into the active bitset and is saved the next time
+	pDirty = NovDirty[NovActive];
+	NovActive ^= 1;
+
+	for (w = 0; w < PAR_NOV_DIRTY_WORDS; w++)
+	{
+		Dirty = pDirty[w];
+		if (Dirty == 0)
+			continue;
+		pDirty[w] = 0;
+
+		for (Page = w * 32; (Dirty != 0) && (Page < PAR_NOV_NBR_OF_PAGES); Page++, Dirty >>= 1)
+		{
+			if (Dirty & 1UL)
+			{
+				Bytes += WritePage(Page);
+				Pages++;
+			}
+		}
+	}
+
+	PAR_NovStat.BytesLastSave = Bytes;
+	PAR_NovStat.PagesLastSave = Pages;
+	PAR_NovStat.BytesTotal   += Bytes;
+	if (Pages)
+		PAR_NovStat.Saves++;
+
+	return (Bytes);
+}
+
+// check the CRC of one page in NOVRAM (e.g. after power up)
+DBOOL PAR_Nov_CheckPage(DU16 Page)
+{
+	if (Page >= PAR_NOV_NBR_OF_PAGES)
+		return (FALSE);
+
+	return (ParaPageCrc[Page] == PageCrc(Page));
+}
+
+// set the parameters of a page to their factory setting, parameters without
+// descriptor are clamped into their limits
+static void PageFactorySettings(DU16 Page)
+{
+	const t_PAR_desc *pDesc;
+	DU16 RefInd;
+	DU16 i;
+
+	for (i = PageFirst(Page); i < PageEnd(Page); i++)
+	{
+		RefInd = PAR_GetRefInd(i);
+		pDesc  = PAR_Desc_Get(RefInd);
+		if (pDesc != 0)
+			PARA[i].Value = pDesc->DefValue;
+		else if (PARA[i].Value < PAR_GetMinValue(RefInd))
+			PARA[i].Value = PAR_GetMinValue(RefInd);
+		else if (PARA[i].Value > PAR_GetMaxValue(RefInd))
+			PARA[i].Value = PAR_GetMaxValue(RefInd);
+		PAR_MarkChanged(RefInd);
+	}
+}
+
+// check all pages after PAR_init(), which loaded PARA[] from ParaValue[]:
+// a page with a wrong CRC gets the factory settings and is written again
+// returns the number of bad pages
+DU16 PAR_Nov_Verify(void)
+{
+	DU16 Page;
+	DU16 Bad = 0;
+
+	// first power up with page CRCs: nothing to check against, sign the pages
+	if (ParaPageCrcMagic != PAR_NOV_CRC_MAGIC)
+	{
+		for (Page = 0; Page < PAR_NOV_NBR_OF_PAGES; Page++)
+			ParaPageCrc[Page] = PageCrc(Page);
+		ParaPageCrcMagic = PAR_NOV_CRC_MAGIC;
+		NovVerified = TRUE;
+		return (0);
+	}
+
+	for (Page = 0; Page < PAR_NOV_NBR_OF_PAGES; Page++)
+	{
+		if (PAR_Nov_CheckPage(Page))
+			continue;
+
+		PageFactorySettings(Page);
+		PAR_NovStat.BytesTotal += WritePage(Page);
+		// the factory settings may be the values in NOVRAM
+		ParaPageCrc[Page] = PageCrc(Page);
+		Bad++;
+	}
+
+	if (Bad)
+	{
+		PAR_NovStat.LoadErrors += Bad;
+		STOP_Set(STOPCONDITION_70209);
+	}
+
+	NovVerified = TRUE;
+	return (Bad);
+}
+
+// background check: one page per call, rewrite the page from PARA[] if the CRC is wrong
+void PAR_Nov_Scrub(void)
+{
+	DU16 i;
+	DU32 Bytes = 0;
+
+	// PARA[] not verified yet, it would sign what it was loaded from
+	if (!NovVerified)
+		return;
+
+	if (NovScrubPage >= PAR_NOV_NBR_OF_PAGES)
+		NovScrubPage = 0;
+
+	if (!PAR_Nov_CheckPage(NovScrubPage))
+	{
+		for (i = PageFirst(NovScrubPage); i < PageEnd(NovScrubPage); i++)
+		{
+			ParaValue[i] = PARA[i].Value;
+			Bytes += sizeof(DS32);
+		}
+		ParaPageCrc[NovScrubPage] = PageCrc(NovScrubPage);
+		Bytes += sizeof(DU16);
+
+		PAR_NovStat.BytesTotal += Bytes;
+		PAR_NovStat.CrcErrors++;
+		STOP_Set(STOPCONDITION_70209);
+	}
+
+	NovScrubPage++;
+}
+
+
+// ******************************************************************
+// const parameter descriptors
+// ******************************************************************
+
+// descriptor of a reference index, 0 if the parameter has none
+const t_PAR_desc* PAR_Desc_Get(DU16 RefInd)
+{
+	if ((RefInd == 0) || (RefInd > HIGHEST_PARREFIND) || !PAR_Desc[RefInd].Valid)
+		return (0);
+
+	return (&PAR_Desc[RefInd]);
+}
+
+// set all parameters with a descriptor to their factory setting
+// returns the number of parameters set
+DU16 PAR_Desc_LoadFactorySettings(void)
+{
+	DU16 RefInd;
+	DU16 Index;
+	DU16 Count = 0;
+	const t_PAR_desc *pDesc = &PAR_Desc[1];
+
+	for (RefInd = 1; RefInd <= HIGHEST_PARREFIND; RefInd++, pDesc++)
+	{
+		if (!pDesc->Valid)
+			continue;
+
+		Index = ParRefInd[RefInd];
+		if (Index >= NBR_OF_PARA)
+			continue;
+
+		PARA[Index].Value = pDesc->DefValue;
+		Count++;
+	}
+
+	if (Count)
+		PAR_MarkAllChanged();
+
+	return (Count);
+}
+
+
+// ******************************************************************
+// parameter transactions
+// ******************************************************************
+
+static t_PAR_transaction Transaction[2];
+static DU8 StageBuffer = 0;			// buffer of the open transaction
+static DU8 ApplyBuffer = 0;			// next committed buffer to apply
+
+// open a transaction, FALSE if one is open or both buffers wait for apply
+DBOOL PAR_BeginTransaction(void)
+{
+	t_PAR_transaction *pTrans = &Transaction[StageBuffer];
+
+	if (pTrans->State == PAR_TRANS_OPEN)
+		return (FALSE);
+
+	if (pTrans->State == PAR_TRANS_COMMITTED)
+	{
+		pTrans = &Transaction[StageBuffer ^ 1];
+		if (pTrans->State != PAR_TRANS_FREE)
+			return (FALSE);
+		StageBuffer ^= 1;
+	}
+
+	pTrans->Count = 0;
+	pTrans->State = PAR_TRANS_OPEN;
+	return (TRUE);
+}
+
+// stage one value, a parameter staged twice keeps the last value
+DBOOL PAR_StageValue(DU16 RefInd, DS32 Value)
+{
+	t_PAR_transaction *pTrans = &Transaction[StageBuffer];
+	DU16 i;
+
+	if ((pTrans->State != PAR_TRANS_OPEN) || (RefInd == 0) || (RefInd > HIGHEST_PARREFIND))
+		return (FALSE);
+
+	for (i = 0; i < pTrans->Count; i++)
+	{
+		if (pTrans->RefInd[i] == RefInd)
+		{
+			pTrans->Value[i] = Value;
+			return (TRUE);
+		}
+	}
+
+	if (pTrans->Count >= PAR_TRANS_MAX_VALUES)
+		return (FALSE);
+
+	pTrans->RefInd[pTrans->Count] = RefInd;
+	pTrans->Value[pTrans->Count]  = Value;
+	pTrans->Count++;
+	return (TRUE);
+}
+
+// close the transaction, it is applied at the next task boundary
+DBOOL PAR_CommitTransaction(void)
+{
+	t_PAR_transaction *pTrans = &Transaction[StageBuffer];
+
+	if (pTrans->State != PAR_TRANS_OPEN)
+		return (FALSE);
+
+	if (pTrans->Count == 0)
+	{
+		pTrans->State = PAR_TRANS_FREE;
+		return (TRUE);
+	}
+
+	// first buffer committed while the other one waits: apply in order
+	if (Transaction[StageBuffer ^ 1].State != PAR_TRANS_COMMITTED)
+		ApplyBuffer = StageBuffer;
+
+	pTrans->State = PAR_TRANS_COMMITTED;
+	return (TRUE);
+}
+
+// discard the open transaction
+void PAR_AbortTransaction(void)
+{
+	if (Transaction[StageBuffer].State == PAR_TRANS_OPEN)
+		Transaction[StageBuffer].State = PAR_TRANS_FREE;
+}
+
+// write the committed transactions into PARA[] (beginning of MAIN_control_100ms)
+void PAR_ApplyTransaction(void)
+{
+	t_PAR_transaction *pTrans;
+	DU16 i;
+	DU8 n;
+
+	for (n = 0; n < 2; n++)
+	{
+		pTrans = &Transaction[ApplyBuffer];
+		if (pTrans->State != PAR_TRANS_COMMITTED)
+			return;
+
+		PAR_Notify.ApplySeq++;
+		for (i = 0; i < pTrans->Count; i++)
+		{
+			PAR_SetValue(pTrans->RefInd[i], pTrans->Value[i]);
+			PAR_MarkChanged(pTrans->RefInd[i]);
+		}
+		PAR_Notify.ApplySeq++;
+
+		pTrans->State = PAR_TRANS_FREE;
+		ApplyBuffer ^= 1;
+	}
+}
+
+
+// ******************************************************************
+// batch range validation
+// ******************************************************************
+
+// limits per reference index, separate arrays for a tight loop
+static DS32 ValidateMin[HIGHEST_PARREFIND+1];
+static DS32 ValidateMax[HIGHEST_PARREFIND+1];
+static DBOOL ValidateInitDone = FALSE;
+
+// copy the limits of all parameters (after PAR_init, limits can be set there)
+void PAR_Validate_Init(void)
+{
+	DU16 RefInd;
+
+	ValidateMin[0] = 0L;
+	ValidateMax[0] = 0L;
+	for (RefInd = 1; RefInd <= HIGHEST_PARREFIND; RefInd++)
+	{
+		if (ParRefInd[RefInd] < NBR_OF_PARA)
+		{
+			ValidateMin[RefInd] = PAR_GetMinValue(RefInd);
+			ValidateMax[RefInd] = PAR_GetMaxValue(RefInd);
+		}
+		else
+		{
+			// parameter not used (io module not supported): never a violation
+			ValidateMin[RefInd] = (-2147483647L - 1);
+			ValidateMax[RefInd] = MAX_DS32;
+		}
+	}
+	ValidateInitDone = TRUE;
+}
+
+// check FirstRefInd...LastRefInd against min/max, Clamp: set to the limit
+// Violations (optional): bit of each reference index out of range is set
+// returns the number of violations
+DU16 PAR_ValidateRange(DU16 FirstRefInd, DU16 LastRefInd, DBOOL Clamp, DU32 *Violations)
+{
+	DU16 RefInd;
+	DU16 Count = 0;
+	DS32 Value;
+	t_PARA *pPara;
+
+	if (!ValidateInitDone)
+		PAR_Validate_Init();
+
+	if (FirstRefInd == 0)
+		FirstRefInd = 1;
+	if (LastRefInd > HIGHEST_PARREFIND)
+		LastRefInd = HIGHEST_PARREFIND;
+
+	for (RefInd = FirstRefInd; RefInd <= LastRefInd; RefInd++)
+	{
+		if (ParRefInd[RefInd] >= NBR_OF_PARA)
+			continue;
+
+		pPara = &PARA[ParRefInd[RefInd]];
+		Value = pPara->Value;
+		if ((Value >= ValidateMin[RefInd]) && (Value <= ValidateMax[RefInd]))
+			continue;
+
+		Count++;
+		if (Violations)
+			Violations[RefInd >> 5] |= (1UL << (RefInd & 31));
+
+		if (Clamp)
+		{
+			pPara->Value = (Value < ValidateMin[RefInd]) ? ValidateMin[RefInd] : ValidateMax[RefInd];
+			PAR_MarkChanged(RefInd);
+		}
+	}
+	return (Count);
+}
+
+// check all parameters, see PAR_ValidateRange()
+DU16 PAR_ValidateAll(DBOOL Clamp, DU32 *Violations)
+{
+	return (PAR_ValidateRange(1, HIGHEST_PARREFIND, Clamp, Violations));
+}
+
+
+#if (OPTION_PAR_PACKED == TRUE)
+// ******************************************************************
+// packed parameter image
+// ******************************************************************
+
+static DU32 ReadBits(DU32 BitOffset, DU8 Bits)
+{
+	DU32 Word  = BitOffset >> 5;
+	DU8  Shift = (DU8)(BitOffset & 31);
+	DU32 Value = PAR_PackedValue[Word] >> Shift;
+
+	// field continues in the next word
+	if ((Shift + Bits) > 32)
+		Value |= PAR_PackedValue[Word + 1] << (32 - Shift);
+
+	if (Bits < 32)
+		Value &= ((1UL << Bits) - 1);
+
+	return (Value);
+}
+
+static void WriteBits(DU32 BitOffset, DU8 Bits, DU32 Value)
+{
+	DU32 Word  = BitOffset >> 5;
+	DU8  Shift = (DU8)(BitOffset & 31);
+	DU32 Mask  = (Bits < 32) ? ((1UL << Bits) - 1) : 0xFFFFFFFFUL;
+
+	Value &= Mask;
+	PAR_PackedValue[Word] = (PAR_PackedValue[Word] & ~(Mask << Shift)) | (Value << Shift);
+
+	// field continues in the next word
+	if ((Shift + Bits) > 32)
+	{
+		PAR_PackedValue[Word + 1] = (PAR_PackedValue[Word + 1] & ~(Mask >> (32 - Shift)))
+								  | (Value >> (32 - Shift));
+	}
+}
+
+// check the generated bit widths against the limits the compiler sees
+// FALSE: PAR_desc.c has to be generated again
+DBOOL PAR_Packed_Check(void)
+{
+	DU16 RefInd;
+	DU32 Range;
+	const t_PAR_desc *pDesc;
+
+	for (RefInd = 1; RefInd <= HIGHEST_PARREFIND; RefInd++)
+	{
+		pDesc = &PAR_Desc[RefInd];
+		if (!pDesc->Valid || (pDesc->Bits >= 32))
+			continue;
+
+		Range = (DU32)pDesc->MaxValue - (DU32)pDesc->MinValue;
+		if ((pDesc->MaxValue < pDesc->MinValue) || (Range >> pDesc->Bits))
+			return (FALSE);
+	}
+	return (TRUE);
+}
+
+// read one parameter from the packed image
+DS32 PAR_Packed_Get(DU16 RefInd)
+{
+	const t_PAR_desc *pDesc;
+
+	if ((RefInd == 0) || (RefInd > HIGHEST_PARREFIND))
+		return (0L);
+
+	pDesc = &PAR_Desc[RefInd];
+	return ((DS32)(ReadBits(pDesc->BitOffset, pDesc->Bits) + (DU32)pDesc->MinValue));
+}
+
+// write one parameter into the packed image, limited to min/max of the descriptor
+void PAR_Packed_Set(DU16 RefInd, DS32 Value)
+{
+	const t_PAR_desc *pDesc;
+
+	if ((RefInd == 0) || (RefInd > HIGHEST_PARREFIND))
+		return;
+
+	pDesc = &PAR_Desc[RefInd];
+	if (pDesc->Valid)
+	{
+		if (Value < pDesc->MinValue)
+			Value = pDesc->MinValue;
+		else if (Value > pDesc->MaxValue)
+			Value = pDesc->MaxValue;
+	}
+	WriteBits(pDesc->BitOffset, pDesc->Bits, (DU32)Value - (DU32)pDesc->MinValue);
+}
+
+// pack all values of PARA[]
+void PAR_Packed_FromPARA(void)
+{
+	DU16 RefInd;
+	DU16 Index;
+
+	for (RefInd = 1; RefInd <= HIGHEST_PARREFIND; RefInd++)
+	{
+		Index = ParRefInd[RefInd];
+		if (Index < NBR_OF_PARA)
+			PAR_Packed_Set(RefInd, PARA[Index].Value);
+	}
+}
+
+// unpack all values into PARA[]
+void PAR_Packed_ToPARA(void)
+{
+	DU16 RefInd;
+	DU16 Index;
+
+	for (RefInd = 1; RefInd <= HIGHEST_PARREFIND; RefInd++)
+	{
+		Index = ParRefInd[RefInd];
+		if (Index < NBR_OF_PARA)
+			PARA[Index].Value = PAR_Packed_Get(RefInd);
+	}
+	PAR_MarkAllChanged();
+}
+#endif
+
+
+#if (OPTION_PAR_PROFILER == TRUE)
+// ******************************************************************
+// parameter access profiler
+// ******************************************************************
+
+static DU32 ProfileCount[PAR_PROFILE_NBR_OF_TASKS][HIGHEST_PARREFIND+1];
+static volatile DU8 ProfileTask = PAR_PROFILE_TASK_OTHER;
+
+static const char * const ProfileTaskName[PAR_PROFILE_NBR_OF_TASKS] =
+{
+	"20ms", "100ms", "1000ms", "other"
+};
+
+// set the task the following accesses are counted for, returns the task before
+// a preempting task restores the preempted one with PAR_Profile_LeaveTask()
+DU8 PAR_Profile_EnterTask(DU8 Task)
+{
+	DU8 PrevTask = ProfileTask;
+
+	if (Task < PAR_PROFILE_NBR_OF_TASKS)
+		ProfileTask = Task;
+	return (PrevTask);
+}
+
+void PAR_Profile_LeaveTask(DU8 PrevTask)
+{
+	ProfileTask = PrevTask;
+}
+
+// count one access of the actual task
+void PAR_Profile_Hit(DU16 RefInd)
+{
+	DU32 *pCount;
+
+	if (RefInd > HIGHEST_PARREFIND)
+		return;
+
+	pCount = &ProfileCount[ProfileTask][RefInd];
+	if (*pCount < 0xFFFFFFFFUL)
+		(*pCount)++;
+}
+
+// PAR_VALUE() of the profiler build, stays an lvalue
+DS32 *PAR_Profile_Value(DU16 RefInd)
+{
+	PAR_Profile_Hit(RefInd);
+	return (&PARA[ParRefInd[RefInd]].Value);
+}
+
+// accesses of one task or PAR_PROFILE_ALL_TASKS
+DU32 PAR_Profile_Count(DU8 Task, DU16 RefInd)
+{
+	DU32 Sum = 0;
+	DU8 t;
+
+	if (RefInd > HIGHEST_PARREFIND)
+		return (0);
+
+	if (Task < PAR_PROFILE_NBR_OF_TASKS)
+		return (ProfileCount[Task][RefInd]);
+
+	for (t = 0; t < PAR_PROFILE_NBR_OF_TASKS; t++)
+	{
+		Sum += ProfileCount[t][RefInd];
+		if (Sum < ProfileCount[t][RefInd])
+			Sum = 0xFFFFFFFFUL;
+	}
+	return (Sum);
+}
+
+void PAR_Profile_Reset(void)
+{
+	DU8 t;
+	DU16 RefInd;
+
+	for (t = 0; t < PAR_PROFILE_NBR_OF_TASKS; t++)
+		for (RefInd = 0; RefInd <= HIGHEST_PARREFIND; RefInd++)
+			ProfileCount[t][RefInd] = 0;
+}
+
+// the MaxEntries most read parameters of a task, highest count first
+// returns the number of entries written into List
+DU16 PAR_Profile_Ranking(DU8 Task, t_PAR_profile_entry *List, DU16 MaxEntries)
+{
+	DU16 RefInd;
+	DU16 Entries = 0;
+	DU16 i;
+	DU32 Count;
+
+	if ((List == 0) || (MaxEntries == 0))
+		return (0);
+
+	for (RefInd = 1; RefInd <= HIGHEST_PARREFIND; RefInd++)
+	{
+		Count = PAR_Profile_Count(Task, RefInd);
+		if (Count == 0)
+			continue;
+		if ((Entries == MaxEntries) && (Count <= List[Entries - 1].Count))
+			continue;
+
+		// insert sorted, the last entry drops out if the list is full
+		i = (Entries < MaxEntries) ? Entries++ : (DU16)(Entries - 1);
+		while ((i > 0) && (List[i - 1].Count < Count))
+		{
+			List[i] = List[i - 1];
+			i--;
+		}
+		List[i].RefInd = RefInd;
+		List[i].Count  = Count;
+	}
+	return (Entries);
+}
+
+// print the MaxLines most read parameters of every task
+void PAR_Profile_Dump(DU16 MaxLines)
+{
+	static t_PAR_profile_entry List[64];
+	DU16 Entries;
+	DU16 i;
+	DU8 t;
+
+	if (MaxLines > (sizeof(List) / sizeof(List[0])))
+		MaxLines = sizeof(List) / sizeof(List[0]);
+
+	for (t = 0; t < PAR_PROFILE_NBR_OF_TASKS; t++)
+	{
+		printf("\n parameter accesses task %s", ProfileTaskName[t]);
+		Entries = PAR_Profile_Ranking(t, List, MaxLines);
+		for (i = 0; i < Entries; i++)
+		{
+			printf("\n %3u  RefInd %4u  Id %5u  %10lu", (unsigned)(i + 1), (unsigned)List[i].RefInd,
+				   (unsigned)PAR_GetId(List[i].RefInd), (unsigned long)List[i].Count);
+		}
+	}
+	printf("\n");
+}
+#endif
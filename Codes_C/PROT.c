@@ -0,0 +1,235 @@
+/**
+ * @file PROT.c
+ * @ingroup Application
+ * Table driven protection functions
+ *
+ * @remarks
+ * One state machine for the protections which used to be written out in every module:
+ *
+ *   COLD     no condition is pending
+ *   HOT      condition present, the hot delay is running
+ *   TRIP     the delay has tripped, stop condition set
+ *   RECOVER  condition gone, the recover delay is running (PROT_RECOVER)
+ *
+ * Input, limit, delays, stop condition and cycle time come from the const descriptors
+ * of the module (t_PROT_desc), PROT_control() evaluates all of them in one loop.
+ * The module only sets pVars->Exceeded itself if the condition is no comparison of a
+ * value with a limit (pInput == 0).
+ *
+ * The hot and recover delays run in the timer wheel of the task (TMR.c): entering HOT or
+ * RECOVER arms pVars->Timer, its expiry sets pVars->Elapsed. A protection in COLD or TRIP
+ * has no timer and nothing is counted per cycle.
+ *
+ * A protection which was COLD without exceedance in its last evaluation is skipped as
+ * long as its input (within Deadband), limit and release are the same as then, the
+ * evaluation would not change anything. With Deadband 0 this is exact; to bound the
+ * latency for changes within the deadband (and stop conditions changed from outside)
+ * an idle protection is evaluated at least every PROT_MAX_SKIP cycles.
+ * PROT_Stat counts the evaluated and skipped protections per task cycle.
+ *
+ * @date 17-oct-2026
+ *
+ * changes:
+ *      17.10.2026      first version
+ *      17.10.2026      delays by the timer wheel instead of StateTimer
+ *      17.10.2026      idle protections with unchanged inputs skipped, PROT_Stat
+ *      17.10.2026      exceedance stamped for the trip latency (LAT.h)
+ *      17.10.2026      exceedance of the trip latency cancelled when COLD again
+ *      17.10.2026      PROT_COLD_FIRST: order of the HOT checks of the release timeouts
+ *
+ */
+
+#include "options.h"
+#include "deif_types.h"
+#include "appl_types.h"
+#include "STOPCONDITIONS.h"
+
+#include "PROT.h"
+#include "TMR.h"
+#include "LAT.h"
+
+
+// evaluated and skipped protections for global use
+t_PROT_stat PROT_Stat[TMR_NBR_OF_TASKS];
+
+// expiry of the timer of a protection
+static void Elapsed(void *pOwner)
+{
+	((t_PROT_vars *)pOwner)->Elapsed = TRUE;
+}
+
+// evaluate Count protections of the calling task
+void PROT_control(const t_PROT_desc *pDesc, DU8 Count)
+{
+	t_PROT_vars *a;
+	t_PROT_stat *pStat;
+	DS32 Limit;
+	DU32 Ticks;
+	DBOOL Release;
+	DS32 Diff;
+
+	if (Count == 0)
+		return;
+
+	// all descriptors of one call belong to the same task
+	pStat = &PROT_Stat[pDesc->Task];
+	if (pStat->Cycle != TMR_Wheel[pDesc->Task].Now)
+	{
+		pStat->Cycle         = TMR_Wheel[pDesc->Task].Now;
+		pStat->LastEvaluated = pStat->Evaluated;
+		pStat->LastSkipped   = pStat->Skipped;
+		pStat->Evaluated     = 0;
+		pStat->Skipped       = 0;
+	}
+
+	for ( ; Count; Count--, pDesc++)
+	{
+		a = pDesc->pVars;
+
+		// not enabled: COLD, stop condition can be acknowledged
+		if (pDesc->pEnable && !*pDesc->pEnable)
+		{
+			if (a->State != COLD)
+			{
+				LAT_CANCEL_HOOK(pDesc->SCIndex, pDesc->Task);
+			}
+			a->State = COLD;
+			a->Idle  = FALSE;
+			if (pDesc->Flags & PROT_TRIPPED)
+				STOP_SetTripped(pDesc->SCIndex, FALSE);
+			continue;
+		}
+
+		Release = (pDesc->pRelease == 0) || *pDesc->pRelease;
+
+		// idle and the inputs unchanged: nothing to do
+		if (a->Idle && (a->State == COLD) && (a->Skipped < PROT_MAX_SKIP) && (Release == a->LastRelease))
+		{
+			if (pDesc->pInput)
+			{
+				Diff  = (DS32)*pDesc->pInput - a->LastInput;
+				Limit = pDesc->pLimit ? *pDesc->pLimit : pDesc->Limit;
+				if ((Diff <= pDesc->Deadband) && (-Diff <= pDesc->Deadband) && ((DS16)Limit == a->Limit))
+				{
+					a->Skipped++;
+					pStat->Skipped++;
+					pStat->TotalSkipped++;
+					continue;
+				}
+			}
+			else if (!a->Exceeded)
+			{
+				a->Skipped++;
+				pStat->Skipped++;
+				pStat->TotalSkipped++;
+				continue;
+			}
+		}
+		a->Skipped     = 0;
+		a->LastRelease = Release;
+		pStat->Evaluated++;
+		pStat->TotalEvaluated++;
+
+		// if state has changed, remember new state and start the delay of HOT / RECOVER
+		// (elapsed after the same number of cycles as the StateTimer counted before)
+		if (a->State != a->LastState)
+		{
+			a->LastState = a->State;
+			a->Elapsed   = FALSE;
+			TMR_Cancel(&a->Timer);
+
+			// COLD again, the STOP_Set of the last evaluation is committed: exceedance is over
+			if (a->State == COLD)
+			{
+				LAT_CANCEL_HOOK(pDesc->SCIndex, pDesc->Task);
+			}
+
+			if ((a->State == HOT) || (a->State == RECOVER))
+			{
+				Ticks = TMR_TICKS(pDesc->Task, (a->State == HOT) ? pDesc->HotDelay : pDesc->RecoverDelay);
+				if (Ticks == 0)
+					a->Elapsed = TRUE;
+				else
+					TMR_Arm(pDesc->Task, &a->Timer, Ticks, Elapsed, a);
+			}
+		}
+
+		// check input and set a->Exceeded accordingly
+		if (pDesc->pInput)
+		{
+			Limit = pDesc->pLimit ? *pDesc->pLimit : pDesc->Limit;
+			if (a->State >= TRIP)
+				Limit += (pDesc->Flags & PROT_BELOW) ? pDesc->Hysteresis : -pDesc->Hysteresis;
+			a->Limit = (DS16)Limit;
+
+			if (pDesc->Flags & PROT_BELOW)
+				a->Exceeded = (*pDesc->pInput < a->Limit);
+			else
+				a->Exceeded = (*pDesc->pInput > a->Limit);
+			a->LastInput = *pDesc->pInput;
+		}
+		if (!Release)
+			a->Exceeded = FALSE;
+
+		// COLD without exceedance: skipped until an input changes
+		a->Idle = ((a->State == COLD) && !a->Exceeded);
+
+		switch (a->State)
+		{
+			case COLD: // no condition is pending
+				if (pDesc->Flags & PROT_TRIPPED)
+					STOP_SetTripped(pDesc->SCIndex, FALSE);
+				if (a->Exceeded)
+				{
+					a->State = HOT;
+					LAT_EXCEEDED_HOOK(pDesc->SCIndex, pDesc->Task);
+				}
+				else if (pDesc->Flags & PROT_AUTO_CLEAR)
+					STOP_Clear(pDesc->SCIndex); // auto acknowledge
+				break;
+
+			case HOT: // condition present, the delay time is running
+				if (pDesc->Flags & PROT_COLD_FIRST)
+				{
+					if (a->Elapsed) a->State = TRIP; // after delay time, trip the protection function
+					if (!a->Exceeded) a->State = COLD; // unless the condition is gone
+				}
+				else
+				{
+					if (!a->Exceeded) a->State = COLD; // condition is gone, return to COLD
+					if (a->Elapsed) a->State = TRIP; // after delay time, trip the protection function
+				}
+				break;
+
+			case TRIP: // the delay time has tripped
+				STOP_Set(pDesc->SCIndex);
+				if (pDesc->Flags & PROT_TRIPPED)
+					STOP_SetTripped(pDesc->SCIndex, TRUE); // tripped = cannot be acknowledged
+				if (!a->Exceeded)
+					a->State = (pDesc->Flags & PROT_RECOVER) ? RECOVER : COLD;
+				break;
+
+			case RECOVER:
+				if (pDesc->Flags & PROT_TRIPPED)
+					STOP_SetTripped(pDesc->SCIndex, FALSE); // can be acknowledged
+				if (a->Exceeded)
+					a->State = TRIP;
+				if (a->Elapsed)
+					a->State = COLD;
+				if ((pDesc->Flags & PROT_ACK_RECOVER) && !STOP_is_Set(pDesc->SCIndex))
+					a->State = COLD; // has been acknowledged while in RECOVER
+				break;
+
+			default:
+				a->State = COLD;
+				break;
+		}
+
+		if (pDesc->pReset && *pDesc->pReset)
+		{
+			a->State = COLD;
+			if (pDesc->Flags & PROT_TRIPPED)
+				STOP_SetTripped(pDesc->SCIndex, FALSE); // can be acknowledged
+		}
+	}
+}
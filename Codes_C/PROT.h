@@ -0,0 +1,91 @@
+/**
+ * @file PROT.h
+ * @ingroup Application
+ * Table driven protection functions (COLD / HOT / TRIP / RECOVER)
+ *
+ * @remarks
+ * A module describes its protections in a const array of t_PROT_desc and calls
+ * PROT_control() with it from the task the protections belong to.
+ * @date 17-oct-2026
+ *
+ * changes:
+ *      17.10.2026      first version
+ *      17.10.2026      delays by the timer wheel of the task (TMR.h) instead of StateTimer
+ *      17.10.2026      idle protections with unchanged inputs skipped, PROT_Stat
+ *      17.10.2026      PROT_COLD_FIRST
+ */
+
+#ifndef PROT_H_
+#define PROT_H_
+
+
+#include "deif_types.h"
+#include "appl_types.h"
+#include "ELM.h"				//definition of  t_protection_state
+#include "TMR.h"
+
+// internal values of each protection
+typedef struct PROTvarsstruct
+{
+	t_protection_state State;
+	t_protection_state LastState;
+	DU32               StateTimer;		// only counted by protections written out in the module
+	DS16               Limit;
+	DBOOL              Exceeded;
+	DBOOL              Elapsed;			// delay of HOT / RECOVER elapsed (PROT_control)
+	t_TMR_timer        Timer;
+	// inputs of the last evaluation (PROT_control)
+	DS16               LastInput;
+	DBOOL              LastRelease;
+	DBOOL              Idle;			// COLD without exceedance in the last evaluation
+	DU8                Skipped;			// evaluations skipped since the last one
+} t_PROT_vars;
+
+// t_PROT_desc.Flags
+#define PROT_BELOW			0x01	// exceeded if the input is below the limit, else above
+#define PROT_RECOVER		0x02	// TRIP -> RECOVER -> COLD after the recover delay, else TRIP -> COLD
+#define PROT_AUTO_CLEAR		0x04	// stop condition cleared in COLD without exceedance
+#define PROT_ACK_RECOVER	0x08	// acknowledged stop condition ends RECOVER
+#define PROT_TRIPPED		0x10	// stop condition cannot be acknowledged in TRIP
+#define PROT_COLD_FIRST		0x20	// HOT: condition gone wins over the elapsed delay (no trip)
+
+// an idle protection is evaluated at least every PROT_MAX_SKIP cycles
+#define PROT_MAX_SKIP		10
+
+// description of one protection
+typedef struct
+{
+	t_PROT_vars		*pVars;			// state of the protection
+	const DS16		*pInput;		// input value, 0: pVars->Exceeded is set by the module
+	const DS32		*pLimit;		// limit, 0: Limit
+	DS32			Limit;
+	DS16			Hysteresis;		// limit moved by this in TRIP and RECOVER
+	DS16			Deadband;		// idle: input changes up to this are not evaluated
+	const DBOOL		*pRelease;		// FALSE: never exceeded, 0: always released
+	const DBOOL		*pEnable;		// FALSE: COLD and not evaluated, 0: always enabled
+	const DBOOL		*pReset;		// TRUE: COLD after the evaluation, 0: never
+	DU32			HotDelay;		// HOT -> TRIP in ms
+	DU32			RecoverDelay;	// RECOVER -> COLD in ms
+	DU16			SCIndex;		// stop condition
+	DU8				Task;			// TMR_TASK_xxx of the calling task
+	DU8				Flags;			// PROT_xxx
+} t_PROT_desc;
+
+// evaluated and skipped protections per task cycle
+typedef struct
+{
+	DU32			Cycle;			// TMR_Wheel[].Now of the counted cycle
+	DU16			Evaluated;		// in this cycle
+	DU16			Skipped;
+	DU16			LastEvaluated;	// in the cycle before
+	DU16			LastSkipped;
+	DU32			TotalEvaluated;
+	DU32			TotalSkipped;
+} t_PROT_stat;
+
+extern t_PROT_stat PROT_Stat[TMR_NBR_OF_TASKS];
+
+extern void PROT_control(const t_PROT_desc *pDesc, DU8 Count);
+
+
+#endif /*PROT_H_*/
@@ -0,0 +1,1206 @@
+/**
+ * @file STOP_ext.c
+ * @ingroup Application
+ * Extensions of the stop condition handler STOPCONDITIONS.c
+ *
+ * @remarks
+ * stop condition code lookup:
+ * STOP_Get_Index() uses the table sorted by code (STOP_CodeLookup_Find) instead of
+ * scanning all stop conditions, O(log n) per code for modbus, Bing-Bang and file transfer.
+ * STOP_SetCode() calls STOP_CodeLookup_Invalidate(), the table is built again on next use.
+ *
+ * stop condition bitsets:
+ * STC.STOPFlag and STOP_TrippedBits hold one bit per stop condition, STOP_is_Set(),
+ * STOP_GetTripped() and STOP_SetTripped() are bit operations (STOPCONDITIONS.h), in the
+ * 100ms and the 1000ms task through the cycle like STOP_Set() (see task cycles).
+ * MAIN_control_init() calls STOP_Nov_CheckVersion(), which clears STC if the NOVRAM
+ * still holds the layout of another version.
+ * STOP_Set_Any(), STOP_Set_Count() and STOP_Set_Next() work on whole words
+ * for scans over index ranges.
+ *
+ * incremental aggregation:
+ * STOP_Set()/STOP_Clear() call STOP_Aggr_On()/STOP_Aggr_Off() when a flag changes,
+ * which count the set stop conditions per level and per cleared bitmask bit.
+ * STOP_UpdateLevelAndBitmask() calls STOP_Aggr_Update(): actualLevel and actualBitMask
+ * come from the counters, actualIndex from the first set flag, and only if a flag
+ * changed. STOP_init(), STOP_initialize() and STOP_SetLevel()/STOP_SetBitMask()/STOP_SetSC()
+ * call STOP_Aggr_Rebuild().
+ *
+ * set stop conditions per level:
+ * STOP_LevelSet holds a bitset of the set stop conditions for each level. The clear
+ * functions of STOPCONDITIONS.c call STOP_ClearActive(), which only visits the set
+ * stop conditions of the requested levels instead of the whole table.
+ *
+ * priority order:
+ * The stop conditions are sorted by priority, so the most important set stop condition is
+ * the lowest set bit of STC.STOPFlag. STOP_ActiveSummary marks the words which are
+ * not 0, STOP_Active_First() needs two find-first-set steps for actualIndex, and
+ * STOP_Active_Page() returns the next set ones for the pages of the HMI list.
+ *
+ * bitmask bits:
+ * STOP_BitSet holds for each bitmask bit the set stop conditions with this bit and
+ * their number. STOP_Bit_Any() only reads the counters, STOP_Bit_First() (used by
+ * STOP_findIndex) takes the lowest first index of the requested bits.
+ *
+ * task cycles:
+ * STOP_Set()/STOP_Clear() start with "if (STOP_Cycle_Record(enum_identifier, TRUE/FALSE)) return;".
+ * Between STOP_BeginCycle() and STOP_CommitCycle() of a task the changes are collected in
+ * a set and a clear bitset; the commit writes only the net changes, calls
+ * STOP_UpdateLevelAndBitmask() and sets STOP.NovUpdateRequired once per cycle.
+ * Each task has its own cycle, the tasks preempt each other (20ms in 100ms in 1000ms), so
+ * the running cycle is the open one of the highest priority (STOP_Cycle_Running()).
+ * STOP_is_Set() reads through its pending bitsets, so a change is seen in the same cycle.
+ * STOP_FlushCycle() writes the changes noted so far without closing the cycle; the
+ * MAIN_control_xxms() call it before they read STOP.actualLevel and STOP.actualBitMask.
+ * Single writer: only the commit of the 20ms task writes STC.STOPFlag, the log and the
+ * aggregate. The commit of the 100ms and the 1000ms cycle copies the net changes into
+ * HandSet/HandClear of its cycle and sets Handed; the 20ms commit writes them (1000ms, 100ms,
+ * then its own, the newest change wins) and clears Handed. While Handed is set, a task keeps
+ * its further changes pending for its next commit. STOP_SetTripped() of these tasks goes the
+ * same way (STOP_Cycle_RecordTripped()), so STOP_TrippedBits has one writer too. STOP_Aggr_Rebuild() and
+ * STOP_Desc_Override() outside of the 20ms task only request the rebuild from the next
+ * commit (STOP_Aggr.Rebuild). STOP_Aggr_Check() in the 1000ms task counts the bitsets
+ * again and requests the rebuild if a counter does not match.
+ *
+ * chatter suppression:
+ * STOP_Set()/STOP_Clear() ask STOP_Log_Request() before writing a line into STCLog.
+ * Stop conditions which change often within a short time are watched in a small slot
+ * table; while chattering their lines are suppressed and counted, and one record with
+ * the count per hold-off time is queued for STOPCONDITIONS_control_1000ms().
+ * A limit of lines per minute protects the 500 lines of STCLog in any case.
+ * STOP_init() calls STOP_Chatter_init(), STOPCONDITIONS_control_1000ms() calls
+ * STOP_Chatter_control_1000ms() and writes the records of STOP_Chatter_GetRecord().
+ *
+ * const descriptors (OPTION_STOP_CONST_DESC):
+ * code, bitmask and level come from STOP_Desc[] in flash (STOP_desc.c, generated),
+ * STOP_Desc_Override() keeps the few changed at runtime by the parameterizable
+ * messages in a small table, STOP_DescOverridden marks them.
+ *
+ * protection enable bitset:
+ * STOP_ProtDisabled holds one bit per stop condition for the protections switched off in
+ * CONFIG_GRID_PROT / CONFIG_GEN_PROT, so SC_ENABLE_xxxxx is a bit test instead of a
+ * parameter read. STOP_ProtEnable_Update(), a parameter listener, takes the stop condition
+ * of each bit from STOP_GetSC_ConfigElProt(), the same mapping the parameter texts use.
+ * The bitset is 0 until the first update, i.e. all protections are enabled (fail-safe).
+ * MAIN_control_init() calls STOP_ProtEnable_init() after PAR_init().
+ *
+ * @date 16-oct-2026
+ *
+ * changes:
+ *      16.10.2026      stop condition code lookup table
+ *      17.10.2026      stop condition bitsets
+ *      17.10.2026      incremental level and bitmask aggregation
+ *      17.10.2026      set stop conditions per level
+ *      17.10.2026      set stop conditions in priority order
+ *      17.10.2026      set stop conditions per bitmask bit
+ *      17.10.2026      const stop condition descriptors
+ *      17.10.2026      changes per task cycle
+ *      17.10.2026      chatter suppression and rate limited logging
+ *      17.10.2026      protection enable bitset
+ *      17.10.2026      stop condition set stamped for the trip latency (LAT.h)
+ *      17.10.2026      STOP_TrippedBits, layout version of STC
+ *      17.10.2026      aggregate counters only changed with the level bitset
+ *      17.10.2026      cycle per task, STOP_is_Set() through the pending bitsets
+ *      17.10.2026      STOP_ProtDisabled from STOP_GetSC_ConfigElProt(), enabled until read
+ *      17.10.2026      trip latency stamped on a real clear to set only, not by the override recount
+ *      17.10.2026      single writer: the 20ms commit writes the changes of all tasks, STOP_Aggr_Check()
+ *      17.10.2026      tripped bits of the 100ms / 1000ms task written by the 20ms commit
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "options.h"
+#include "deif_types.h"
+#include "appl_types.h"
+#include "STOPCONDITIONS.h"
+
+#include "PAR.h"
+#include "LAT.h"
+
+
+// ******************************************************************
+// stop condition code lookup
+// ******************************************************************
+
+static t_STOP_code_lookup CodeLookup[STOPCONDITION_ARRAY_SIZE];
+static DU16  CodeLookupSize  = 0;
+static DBOOL CodeLookupValid = FALSE;
+
+static int CodeLookup_Compare(const void *a, const void *b)
+{
+	const t_STOP_code_lookup *pa = (const t_STOP_code_lookup *)a;
+	const t_STOP_code_lookup *pb = (const t_STOP_code_lookup *)b;
+
+	if (pa->Code != pb->Code)
+		return ((pa->Code < pb->Code) ? -1 : 1);
+	// same code twice: the lower index first, like the linear search
+	if (pa->Index != pb->Index)
+		return ((pa->Index < pb->Index) ? -1 : 1);
+	return (0);
+}
+
+// build the table of all stop conditions sorted by code
+void STOP_CodeLookup_Build(void)
+{
+	DU16 i;
+
+	for (i = 0; i < STOPCONDITION_ARRAY_SIZE; i++)
+	{
+		CodeLookup[i].Code  = STOP_DESC_CODE(i);
+		CodeLookup[i].Index = i;
+	}
+	CodeLookupSize = STOPCONDITION_ARRAY_SIZE;
+	qsort(CodeLookup, CodeLookupSize, sizeof(t_STOP_code_lookup), CodeLookup_Compare);
+
+	CodeLookupValid = TRUE;
+}
+
+// codes changed (STOP_SetCode, parameterizable messages): build again on next use
+void STOP_CodeLookup_Invalidate(void)
+{
+	CodeLookupValid = FALSE;
+}
+
+// find the index of a stop condition code, FALSE if the code does not exist
+DBOOL STOP_CodeLookup_Find(DU32 stopcondition_code, DU16 *Index)
+{
+	DU16 Low, High, Mid;
+
+	if (!CodeLookupValid)
+		STOP_CodeLookup_Build();
+
+	// lower bound: first entry with Code >= stopcondition_code
+	Low  = 0;
+	High = CodeLookupSize;
+	while (Low < High)
+	{
+		Mid = Low + (High - Low) / 2;
+		if (CodeLookup[Mid].Code < stopcondition_code)
+			Low = Mid + 1;
+		else
+			High = Mid;
+	}
+
+	if ((Low < CodeLookupSize) && (CodeLookup[Low].Code == stopcondition_code))
+	{
+		*Index = CodeLookup[Low].Index;
+		return (TRUE);
+	}
+	return (FALSE);
+}
+
+
+// ******************************************************************
+// stop condition bitsets
+// ******************************************************************
+
+// stop conditions which cannot be acknowledged, for global use
+DU32 STOP_TrippedBits[STOP_SET_WORDS];
+
+// clear STC if the NOVRAM holds the layout of another version, TRUE if cleared
+DBOOL STOP_Nov_CheckVersion(void)
+{
+	if (STC.Version == STOP_NOV_STC_VERSION)
+		return (FALSE);
+
+	memset(&STC, 0, sizeof(STC));
+	STC.Version = STOP_NOV_STC_VERSION;
+	STOP_Aggr_Rebuild();
+	STOP.NovUpdateRequired = TRUE;
+	return (TRUE);
+}
+
+// bits First..31 of a word
+#define MASK_FROM(Bit)		(0xFFFFFFFFUL << (Bit))
+// bits 0..Last of a word
+#define MASK_TO(Bit)		(0xFFFFFFFFUL >> (31 - (Bit)))
+
+// index of the lowest set bit, Word must not be 0
+static DU8 LowestBit(DU32 Word)
+{
+	static const DU8 DeBruijn[32] =
+	{
+		 0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+		31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9
+	};
+
+	return (DeBruijn[(((Word & (0UL - Word)) * 0x077CB531UL) & 0xFFFFFFFFUL) >> 27]);
+}
+
+static DU8 BitCount(DU32 Word)
+{
+	Word = Word - ((Word >> 1) & 0x55555555UL);
+	Word = (Word & 0x33333333UL) + ((Word >> 2) & 0x33333333UL);
+	Word = (Word + (Word >> 4)) & 0x0F0F0F0FUL;
+	return ((DU8)(((Word * 0x01010101UL) >> 24) & 0xFF));
+}
+
+// bits of word w inside First..Last
+static DU32 RangeMask(DU16 w, DU16 First, DU16 Last)
+{
+	DU32 Mask = 0xFFFFFFFFUL;
+
+	if (w == (First >> 5))
+		Mask &= MASK_FROM(First & 31);
+	if (w == (Last >> 5))
+		Mask &= MASK_TO(Last & 31);
+	return (Mask);
+}
+
+// TRUE if any stop condition First..Last is set in Set
+DBOOL STOP_Set_Any(const DU32 *Set, DU16 First, DU16 Last)
+{
+	DU16 w;
+
+	if (Last >= STOPCONDITION_ARRAY_SIZE)
+		Last = STOPCONDITION_ARRAY_SIZE - 1;
+
+	for (w = First >> 5; (First <= Last) && (w <= (Last >> 5)); w++)
+	{
+		if (Set[w] & RangeMask(w, First, Last))
+			return (TRUE);
+	}
+	return (FALSE);
+}
+
+// number of stop conditions First..Last set in Set
+DU16 STOP_Set_Count(const DU32 *Set, DU16 First, DU16 Last)
+{
+	DU16 w;
+	DU16 Count = 0;
+
+	if (Last >= STOPCONDITION_ARRAY_SIZE)
+		Last = STOPCONDITION_ARRAY_SIZE - 1;
+
+	for (w = First >> 5; (First <= Last) && (w <= (Last >> 5)); w++)
+		Count += BitCount(Set[w] & RangeMask(w, First, Last));
+
+	return (Count);
+}
+
+// first stop condition From..Last set in Set, STOP_NO_INDEX if none
+DU16 STOP_Set_Next(const DU32 *Set, DU16 From, DU16 Last)
+{
+	DU16 w;
+	DU32 Word;
+
+	if (Last >= STOPCONDITION_ARRAY_SIZE)
+		Last = STOPCONDITION_ARRAY_SIZE - 1;
+
+	for (w = From >> 5; (From <= Last) && (w <= (Last >> 5)); w++)
+	{
+		Word = Set[w] & RangeMask(w, From, Last);
+		if (Word)
+			return ((DU16)((w << 5) + LowestBit(Word)));
+	}
+	return (STOP_NO_INDEX);
+}
+
+
+// ******************************************************************
+// incremental level and bitmask aggregation
+// ******************************************************************
+
+t_STOP_aggregate STOP_Aggr;
+t_STOP_level_sets STOP_LevelSet;
+DU32 STOP_ActiveSummary[STOP_SUMMARY_WORDS];
+t_STOP_bit_sets STOP_BitSet;
+
+static DU8 AggrLevel(DU16 SCIndex)
+{
+	DU8 Level = STOP_DESC_LEVEL(SCIndex);
+
+	return ((Level < STOP_NBR_OF_LEVELS) ? Level : (STOP_NBR_OF_LEVELS - 1));
+}
+
+static void BitCount_Change(DU16 SCIndex, DBOOL On)
+{
+	DU16 Mask = STOP_DESC_BITMASK(SCIndex);
+	DU16 w = SCIndex >> 5;
+	DU8 b;
+
+	for (b = 0; Mask; b++, Mask >>= 1)
+	{
+		if (!(Mask & 1))
+			continue;
+
+		if (On && !STOP_SET_TEST(STOP_BitSet.Active[b], SCIndex))
+		{
+			STOP_SET_ON(STOP_BitSet.Active[b], SCIndex);
+			STOP_SET_ON(STOP_BitSet.Summary[b], w);
+			STOP_BitSet.Count[b]++;
+		}
+		else if (!On && STOP_SET_TEST(STOP_BitSet.Active[b], SCIndex))
+		{
+			STOP_SET_OFF(STOP_BitSet.Active[b], SCIndex);
+			if (STOP_BitSet.Active[b][w] == 0)
+				STOP_SET_OFF(STOP_BitSet.Summary[b], w);
+			STOP_BitSet.Count[b]--;
+		}
+	}
+}
+
+// count SCIndex as set (On) or clear, FALSE if it was counted so already
+static DBOOL AggrCount(DU16 SCIndex, DBOOL On)
+{
+	DU16 Cleared;
+	DU8 b;
+	DU8 Level = AggrLevel(SCIndex);
+
+	// the flag is already written
+	STOP_SET_WRITE(STOP_ActiveSummary, SCIndex >> 5, STC.STOPFlag[SCIndex >> 5] != 0);
+
+	// STOP_Aggr_On() of a counted one (set again, STOP_Desc_Override() recount) or
+	// STOP_Aggr_Off() of one not counted: all counters stay, like the bitsets
+	if (On == (DBOOL)STOP_SET_TEST(STOP_LevelSet.Active[Level], SCIndex))
+		return (FALSE);
+
+	STOP_Aggr.Changed = TRUE;
+
+	if (On)
+	{
+		STOP_SET_ON(STOP_LevelSet.Active[Level], SCIndex);
+		STOP_LevelSet.Count[Level]++;
+	}
+	else
+	{
+		STOP_SET_OFF(STOP_LevelSet.Active[Level], SCIndex);
+		STOP_LevelSet.Count[Level]--;
+	}
+
+	BitCount_Change(SCIndex, On);
+
+	// island stop conditions do not affect actualLevel and actualBitMask
+	if (STOP_DESC_BITMASK(SCIndex) & STOP_BITMASK_ISLAND)
+		return (TRUE);
+
+	if (On)
+		STOP_Aggr.LevelCount[Level]++;
+	else if (STOP_Aggr.LevelCount[Level])
+		STOP_Aggr.LevelCount[Level]--;
+
+	Cleared = (DU16)~STOP_DESC_BITMASK(SCIndex);
+	for (b = 0; Cleared; b++, Cleared >>= 1)
+	{
+		if (!(Cleared & 1))
+			continue;
+		if (On)
+			STOP_Aggr.MaskClearCount[b]++;
+		else if (STOP_Aggr.MaskClearCount[b])
+			STOP_Aggr.MaskClearCount[b]--;
+	}
+	return (TRUE);
+}
+
+// flag of SCIndex changed from clear to set
+void STOP_Aggr_On(DU16 SCIndex)
+{
+	// set again: no new trip for the latency
+	if ((SCIndex < STOPCONDITION_ARRAY_SIZE) && AggrCount(SCIndex, TRUE))
+	{
+		LAT_STOP_SET_HOOK(SCIndex);
+	}
+}
+
+// flag of SCIndex changed from set to clear
+void STOP_Aggr_Off(DU16 SCIndex)
+{
+	if (SCIndex < STOPCONDITION_ARRAY_SIZE)
+		AggrCount(SCIndex, FALSE);
+}
+
+// TRUE in the task which may write the flags and the aggregate (20ms task, or before the tasks run)
+static DBOOL Writer(void)
+{
+	DU8 Task = STOP_Cycle_Running();
+
+	return ((DBOOL)((Task == STOP_CYCLE_NONE) || (Task == STOP_CYCLE_TASK_20MS)));
+}
+
+// count all set flags again (after power up or a change of level / bitmask)
+void STOP_Aggr_Rebuild(void)
+{
+	DU16 i;
+	DU16 w;
+
+	// other task: by the next commit of the 20ms task
+	if (!Writer())
+	{
+		STOP_Aggr.Rebuild = TRUE;
+		return;
+	}
+	STOP_Aggr.Rebuild = FALSE;
+
+	for (i = 0; i < STOP_NBR_OF_LEVELS; i++)
+		STOP_Aggr.LevelCount[i] = 0;
+	for (i = 0; i < STOP_NBR_OF_MASK_BITS; i++)
+		STOP_Aggr.MaskClearCount[i] = 0;
+	for (i = 0; i < STOP_NBR_OF_LEVELS; i++)
+	{
+		for (w = 0; w < STOP_SET_WORDS; w++)
+			STOP_LevelSet.Active[i][w] = 0;
+		STOP_LevelSet.Count[i] = 0;
+	}
+	for (w = 0; w < STOP_SUMMARY_WORDS; w++)
+		STOP_ActiveSummary[w] = 0;
+	for (i = 0; i < STOP_NBR_OF_MASK_BITS; i++)
+	{
+		for (w = 0; w < STOP_SET_WORDS; w++)
+			STOP_BitSet.Active[i][w] = 0;
+		for (w = 0; w < STOP_SUMMARY_WORDS; w++)
+			STOP_BitSet.Summary[i][w] = 0;
+		STOP_BitSet.Count[i] = 0;
+	}
+
+	for (i = STOP_Set_Next(STC.STOPFlag, 0, STOPCONDITION_ARRAY_SIZE - 1); i != STOP_NO_INDEX;
+		 i = STOP_Set_Next(STC.STOPFlag, i + 1, STOPCONDITION_ARRAY_SIZE - 1))
+	{
+		AggrCount(i, TRUE);
+	}
+	STOP_Aggr.Changed = TRUE;
+}
+
+// 1000ms task: count the bitsets again (read only) and request STOP_Aggr_Rebuild() from the
+// next 20ms commit if a counter does not match; no request if a commit came in between
+void STOP_Aggr_Check(void)
+{
+	DU16 Commits = STOP_Aggr.Commits;
+	DU16 Island  = LowestBit(STOP_BITMASK_ISLAND);
+	DU16 Total   = 0;
+	DU16 Count;
+	DU16 Counted;
+	DU16 w;
+	DU8 i;
+	DU32 Union;
+	DBOOL Ok = TRUE;
+
+	for (i = 0; i < STOP_NBR_OF_LEVELS; i++)
+	{
+		Count   = 0;
+		Counted = 0;
+		for (w = 0; w < STOP_SET_WORDS; w++)
+		{
+			Count   += BitCount(STOP_LevelSet.Active[i][w]);
+			Counted += BitCount(STOP_LevelSet.Active[i][w] & ~STOP_BitSet.Active[Island][w]);
+		}
+		if ((Count != STOP_LevelSet.Count[i]) || (Counted != STOP_Aggr.LevelCount[i]))
+			Ok = FALSE;
+		Total += Counted;
+	}
+
+	for (w = 0; w < STOP_SET_WORDS; w++)
+	{
+		Union = 0;
+		for (i = 0; i < STOP_NBR_OF_LEVELS; i++)
+			Union |= STOP_LevelSet.Active[i][w];
+		if (Union != STC.STOPFlag[w])
+			Ok = FALSE;
+	}
+
+	// the island ones do not count for MaskClearCount
+	for (i = 0; i < STOP_NBR_OF_MASK_BITS; i++)
+	{
+		Count   = 0;
+		Counted = 0;
+		for (w = 0; w < STOP_SET_WORDS; w++)
+		{
+			Count   += BitCount(STOP_BitSet.Active[i][w]);
+			Counted += BitCount(STOP_BitSet.Active[i][w] & ~STOP_BitSet.Active[Island][w]);
+		}
+		if ((Count != STOP_BitSet.Count[i]) || ((DU16)(Total - Counted) != STOP_Aggr.MaskClearCount[i]))
+			Ok = FALSE;
+	}
+
+	if (!Ok && (Commits == STOP_Aggr.Commits))
+		STOP_Aggr.Rebuild = TRUE;
+}
+
+// set STOP.actualLevel, actualBitMask, actualIndex, actualCode, actualText and AtLeastOneScSet
+void STOP_Aggr_Update(void)
+{
+	DU8 Level;
+	DU8 b;
+	DU16 Mask;
+	DU16 SCIndex;
+
+	if (!STOP_Aggr.Changed)
+		return;
+	STOP_Aggr.Changed = FALSE;
+
+	for (Level = 0; (Level < STOP_NBR_OF_LEVELS) && (STOP_Aggr.LevelCount[Level] == 0); Level++)
+		;
+
+	Mask = 0;
+	for (b = 0; b < STOP_NBR_OF_MASK_BITS; b++)
+	{
+		if (STOP_Aggr.MaskClearCount[b] == 0)
+			Mask |= (DU16)(1U << b);
+	}
+
+	STOP.actualLevel   = Level;
+	STOP.actualBitMask = Mask;
+
+	// sorted by priority: the first set flag is the most important one
+	SCIndex = STOP_Active_First();
+	if (SCIndex != STOP_NO_INDEX)
+	{
+		STOP.actualIndex     = (DS16)SCIndex;
+		STOP.actualCode      = (DU16)STOP_DESC_CODE(SCIndex);
+		STOP.actualText      = STOP_DESC_TEXT(SCIndex);
+		STOP.AtLeastOneScSet = TRUE;
+	}
+	else
+	{
+		STOP.actualIndex     = -1;
+		STOP.actualCode      = 0;
+		STOP.actualText      = STOP_DESC_TEXT(STOPCONDITION_0);
+		STOP.AtLeastOneScSet = FALSE;
+	}
+}
+
+// clear the set stop conditions of the levels FirstLevel..LastLevel except SCIndexNotClear
+// (STOP_NO_INDEX: none), tripped ones only with ClearTripped. Returns the number cleared.
+DU16 STOP_ClearActive(DU8 FirstLevel, DU8 LastLevel, DU16 SCIndexNotClear, DBOOL ClearTripped)
+{
+	DU8 Level;
+	DU16 w;
+	DU16 SCIndex;
+	DU16 Cleared = 0;
+	DU32 Word;
+
+	if (LastLevel >= STOP_NBR_OF_LEVELS)
+		LastLevel = STOP_NBR_OF_LEVELS - 1;
+
+	for (Level = FirstLevel; Level <= LastLevel; Level++)
+	{
+		for (w = 0; (w < STOP_SET_WORDS) && STOP_LevelSet.Count[Level]; w++)
+		{
+			// copy of the word, STOP_Clear() changes the set
+			Word = STOP_LevelSet.Active[Level][w];
+			if (!ClearTripped)
+				Word &= ~STOP_TrippedBits[w];
+
+			while (Word)
+			{
+				SCIndex = (DU16)((w << 5) + LowestBit(Word));
+				Word &= Word - 1;
+
+				if (SCIndex == SCIndexNotClear)
+					continue;
+				STOP_Clear(SCIndex);
+				Cleared++;
+			}
+		}
+	}
+	return (Cleared);
+}
+
+
+// ******************************************************************
+// set stop conditions in priority order
+// ******************************************************************
+
+// first index of a bitset with summary, STOP_NO_INDEX if empty
+static DU16 FirstOf(const DU32 *Set, const DU32 *Summary)
+{
+	DU16 s;
+	DU16 w;
+
+	for (s = 0; s < STOP_SUMMARY_WORDS; s++)
+	{
+		if (Summary[s])
+		{
+			w = (DU16)((s << 5) + LowestBit(Summary[s]));
+			return ((DU16)((w << 5) + LowestBit(Set[w])));
+		}
+	}
+	return (STOP_NO_INDEX);
+}
+
+// most important set stop condition, STOP_NO_INDEX if none
+DU16 STOP_Active_First(void)
+{
+	return (FirstOf(STC.STOPFlag, STOP_ActiveSummary));
+}
+
+// number of set stop conditions
+DU16 STOP_Active_Total(void)
+{
+	DU8 Level;
+	DU16 Total = 0;
+
+	for (Level = 0; Level < STOP_NBR_OF_LEVELS; Level++)
+		Total += STOP_LevelSet.Count[Level];
+	return (Total);
+}
+
+// up to MaxEntries set stop conditions starting at index From, in priority order
+// returns the number written into List; the next page starts at List[n-1] + 1
+DU16 STOP_Active_Page(DU16 From, DU16 *List, DU16 MaxEntries)
+{
+	DU16 w;
+	DU16 n = 0;
+	DU32 Word;
+
+	for (w = From >> 5; (w < STOP_SET_WORDS) && (n < MaxEntries); w++)
+	{
+		// skip words without set flags
+		if (!STOP_SET_TEST(STOP_ActiveSummary, w))
+			continue;
+
+		Word = STC.STOPFlag[w];
+		if (w == (From >> 5))
+			Word &= MASK_FROM(From & 31);
+
+		while (Word && (n < MaxEntries))
+		{
+			List[n++] = (DU16)((w << 5) + LowestBit(Word));
+			Word &= Word - 1;
+		}
+	}
+	return (n);
+}
+
+
+// ******************************************************************
+// set stop conditions per bitmask bit
+// ******************************************************************
+
+// TRUE if a set stop condition has one of the bits of RefMask in its BitMask
+DBOOL STOP_Bit_Any(DU16 RefMask)
+{
+	DU8 b;
+
+	for (b = 0; RefMask; b++, RefMask >>= 1)
+	{
+		if ((RefMask & 1) && STOP_BitSet.Count[b])
+			return (TRUE);
+	}
+	return (FALSE);
+}
+
+// most important set stop condition with one of the bits of RefMask, STOP_NO_INDEX if none
+DU16 STOP_Bit_First(DU16 RefMask)
+{
+	DU8 b;
+	DU16 SCIndex;
+	DU16 First = STOP_NO_INDEX;
+
+	for (b = 0; RefMask; b++, RefMask >>= 1)
+	{
+		if (!(RefMask & 1) || (STOP_BitSet.Count[b] == 0))
+			continue;
+
+		SCIndex = FirstOf(STOP_BitSet.Active[b], STOP_BitSet.Summary[b]);
+		if (SCIndex < First)
+			First = SCIndex;
+	}
+	return (First);
+}
+
+
+
+// ******************************************************************
+// changes per task cycle
+// ******************************************************************
+
+// no cycle open: STOP_Set()/STOP_Clear() write directly
+t_STOP_cycle STOP_Cycle[STOP_CYCLE_NBR_OF_TASKS];
+DU8 STOP_CommitTask = STOP_CYCLE_NONE;
+
+void STOP_BeginCycle(DU8 Task)
+{
+	t_STOP_cycle *pCycle;
+
+	if ((Task >= STOP_CYCLE_NBR_OF_TASKS) || STOP_Cycle[Task].Open)
+		return;
+
+	pCycle = &STOP_Cycle[Task];
+	pCycle->Recorded = 0;
+	pCycle->Open     = TRUE;
+}
+
+// called at the beginning of STOP_Set() / STOP_Clear()
+// TRUE: the change is noted for the commit, FALSE: write it now
+DBOOL STOP_Cycle_Record(DU16 SCIndex, DBOOL Set)
+{
+	t_STOP_cycle *pCycle;
+	DU8 Task = STOP_Cycle_Running();
+
+	if ((Task == STOP_CYCLE_NONE) || (SCIndex >= STOPCONDITION_ARRAY_SIZE))
+		return (FALSE);
+
+	pCycle = &STOP_Cycle[Task];
+	if (pCycle->Committing)
+		return (FALSE);
+
+	// the last call of the cycle wins
+	if (Set)
+	{
+		STOP_SET_ON(pCycle->PendingSet, SCIndex);
+		STOP_SET_OFF(pCycle->PendingClear, SCIndex);
+	}
+	else
+	{
+		STOP_SET_ON(pCycle->PendingClear, SCIndex);
+		STOP_SET_OFF(pCycle->PendingSet, SCIndex);
+	}
+	pCycle->Recorded++;
+	return (TRUE);
+}
+
+// called by STOP_SetTripped(), TRUE: noted for the 20ms commit, FALSE: write it now
+DBOOL STOP_Cycle_RecordTripped(DU16 SCIndex, DBOOL Set)
+{
+	t_STOP_cycle *pCycle;
+	DU8 Task = STOP_Cycle_Running();
+
+	if ((Task == STOP_CYCLE_NONE) || (Task == STOP_CYCLE_TASK_20MS) || (SCIndex >= STOPCONDITION_ARRAY_SIZE))
+		return (FALSE);
+
+	pCycle = &STOP_Cycle[Task];
+	if (Set)
+	{
+		STOP_SET_ON(pCycle->PendingTrip, SCIndex);
+		STOP_SET_OFF(pCycle->PendingUntrip, SCIndex);
+	}
+	else
+	{
+		STOP_SET_ON(pCycle->PendingUntrip, SCIndex);
+		STOP_SET_OFF(pCycle->PendingTrip, SCIndex);
+	}
+	return (TRUE);
+}
+
+// write the tripped bits of Trip/Untrip (cleared)
+static void ApplyTripped(DU32 *Trip, DU32 *Untrip)
+{
+	DU16 w;
+
+	for (w = 0; w < STOP_SET_WORDS; w++)
+	{
+		STOP_TrippedBits[w] = (STOP_TrippedBits[w] | Trip[w]) & ~Untrip[w];
+		Trip[w]   = 0;
+		Untrip[w] = 0;
+	}
+}
+
+// write the net changes of Set/Clear (cleared), returns the number of changed flags
+static DU16 Apply(DU32 *Set, DU32 *Clear)
+{
+	DU16 w;
+	DU16 SCIndex;
+	DU16 Changes = 0;
+	DU32 On;
+	DU32 Off;
+
+	for (w = 0; w < STOP_SET_WORDS; w++)
+	{
+		if (!(Set[w] | Clear[w]))
+			continue;
+
+		On  = Set[w] & ~STC.STOPFlag[w];
+		Off = Clear[w] & STC.STOPFlag[w];
+		Set[w]   = 0;
+		Clear[w] = 0;
+
+		while (On)
+		{
+			SCIndex = (DU16)((w << 5) + LowestBit(On));
+			On &= On - 1;
+			STOP_Set(SCIndex);
+			Changes++;
+		}
+		while (Off)
+		{
+			SCIndex = (DU16)((w << 5) + LowestBit(Off));
+			Off &= Off - 1;
+			STOP_Clear(SCIndex);
+			Changes++;
+		}
+	}
+	return (Changes);
+}
+
+// 100ms / 1000ms: hand the net changes over to the 20ms task
+// the last ones not yet written: keep the changes pending for the next commit
+static void HandOver(t_STOP_cycle *pCycle)
+{
+	DU16 w;
+	DU32 Tripped = 0;
+
+	pCycle->Changes = 0;
+	if (pCycle->Handed)
+		return;
+
+	for (w = 0; w < STOP_SET_WORDS; w++)
+	{
+		pCycle->HandSet[w]       = pCycle->PendingSet[w];
+		pCycle->HandClear[w]     = pCycle->PendingClear[w];
+		pCycle->HandTrip[w]      = pCycle->PendingTrip[w];
+		pCycle->HandUntrip[w]    = pCycle->PendingUntrip[w];
+		pCycle->PendingSet[w]    = 0;
+		pCycle->PendingClear[w]  = 0;
+		pCycle->PendingTrip[w]   = 0;
+		pCycle->PendingUntrip[w] = 0;
+		pCycle->Changes += BitCount(pCycle->HandSet[w] | pCycle->HandClear[w]);
+		Tripped |= pCycle->HandTrip[w] | pCycle->HandUntrip[w];
+	}
+
+	if (pCycle->Changes || Tripped)
+		pCycle->Handed = TRUE;
+}
+
+// 20ms: write the changes handed over by the other tasks, then the own ones of pCycle
+static void Commit(t_STOP_cycle *pCycle)
+{
+	DU8 Task;
+	DBOOL Rebuilt = FALSE;
+
+	pCycle->Changes    = 0;
+	pCycle->Committing = TRUE;
+
+	for (Task = STOP_CYCLE_NBR_OF_TASKS - 1; Task > STOP_CYCLE_TASK_20MS; Task--)
+	{
+		if (!STOP_Cycle[Task].Handed)
+			continue;
+		STOP_CommitTask = Task;
+		ApplyTripped(STOP_Cycle[Task].HandTrip, STOP_Cycle[Task].HandUntrip);
+		pCycle->Changes += Apply(STOP_Cycle[Task].HandSet, STOP_Cycle[Task].HandClear);
+		STOP_Cycle[Task].Handed = FALSE;
+	}
+
+	STOP_CommitTask = STOP_CYCLE_TASK_20MS;
+	pCycle->Changes += Apply(pCycle->PendingSet, pCycle->PendingClear);
+	STOP_CommitTask = STOP_CYCLE_NONE;
+
+	if (STOP_Aggr.Rebuild)
+	{
+		STOP_Aggr_Rebuild();
+		Rebuilt = TRUE;
+	}
+
+	if (pCycle->Changes)
+	{
+		STOP.NovUpdateRequired = TRUE;
+		STOP_Aggr.Commits++;
+	}
+	if (pCycle->Changes || Rebuilt)
+		STOP_UpdateLevelAndBitmask();
+
+	pCycle->Committing = FALSE;
+}
+
+// write the net changes of the cycle (20ms) or hand them over to the 20ms task
+// returns the number of changed / handed over flags
+DU16 STOP_CommitCycle(DU8 Task)
+{
+	if ((Task >= STOP_CYCLE_NBR_OF_TASKS) || !STOP_Cycle[Task].Open)
+		return (0);
+
+	if (Task == STOP_CYCLE_TASK_20MS)
+		Commit(&STOP_Cycle[Task]);
+	else
+		HandOver(&STOP_Cycle[Task]);
+	STOP_Cycle[Task].Open = FALSE;
+
+	return (STOP_Cycle[Task].Changes);
+}
+
+// write the changes noted so far, the cycle stays open
+// for the readers of the aggregate (STOP.actualLevel, STOP.actualBitMask) within the cycle
+DU16 STOP_FlushCycle(DU8 Task)
+{
+	if ((Task >= STOP_CYCLE_NBR_OF_TASKS) || !STOP_Cycle[Task].Open)
+		return (0);
+
+	if (Task == STOP_CYCLE_TASK_20MS)
+		Commit(&STOP_Cycle[Task]);
+	else
+		HandOver(&STOP_Cycle[Task]);
+
+	return (STOP_Cycle[Task].Changes);
+}
+
+
+#if (OPTION_STOP_CONST_DESC == TRUE)
+// ******************************************************************
+// const stop condition descriptors
+// ******************************************************************
+
+DU8* STOP_Text[STOPCONDITION_ARRAY_SIZE];
+DU32 STOP_DescOverridden[STOP_SET_WORDS];
+
+static t_STOP_desc OverrideDesc[STOP_DESC_MAX_OVERRIDES];
+static DU16 OverrideIndex[STOP_DESC_MAX_OVERRIDES];
+static DU16 NbrOfOverrides = 0;
+
+// descriptor of a stop condition, the override if there is one
+const t_STOP_desc *STOP_Desc_Get(DU16 SCIndex)
+{
+	DU16 i;
+
+	if (STOP_SET_TEST(STOP_DescOverridden, SCIndex))
+	{
+		for (i = 0; i < NbrOfOverrides; i++)
+		{
+			if (OverrideIndex[i] == SCIndex)
+				return (&OverrideDesc[i]);
+		}
+	}
+	return (&STOP_Desc[SCIndex]);
+}
+
+// change code, level and bitmask of a stop condition at runtime
+// FALSE if SCIndex is wrong or the override table is full
+DBOOL STOP_Desc_Override(DU16 SCIndex, DU32 Code, DU8 Level, DU16 BitMask)
+{
+	DU16 i;
+	DBOOL Set;
+
+	if (SCIndex >= STOPCONDITION_ARRAY_SIZE)
+		return (FALSE);
+
+	for (i = 0; (i < NbrOfOverrides) && (OverrideIndex[i] != SCIndex); i++)
+		;
+	if (i >= STOP_DESC_MAX_OVERRIDES)
+		return (FALSE);
+
+	// a set stop condition leaves the counters with the old level / bitmask
+	// (AggrCount() directly, the recount is no trip of the stop condition),
+	// outside of the 20ms task the next commit counts all again
+	Set = Writer() && STOP_GetFlag(SCIndex);
+	if (Set)
+		AggrCount(SCIndex, FALSE);
+
+	OverrideIndex[i]        = SCIndex;
+	OverrideDesc[i].Code    = Code;
+	OverrideDesc[i].Level   = Level;
+	OverrideDesc[i].BitMask = BitMask;
+	if (i == NbrOfOverrides)
+		NbrOfOverrides++;
+	STOP_SET_ON(STOP_DescOverridden, SCIndex);
+
+	if (Set)
+		AggrCount(SCIndex, TRUE);
+	else if (!Writer())
+		STOP_Aggr.Rebuild = TRUE;
+	STOP_CodeLookup_Invalidate();
+
+	return (TRUE);
+}
+#endif
+
+
+// ******************************************************************
+// chatter suppression and rate limited logging
+// ******************************************************************
+
+t_STOP_chatter STOP_Chatter;
+
+void STOP_Chatter_init(void)
+{
+	DU8 i;
+
+	STOP_Chatter.Window          = STOP_CHATTER_WINDOW;
+	STOP_Chatter.Toggles         = STOP_CHATTER_TOGGLES;
+	STOP_Chatter.HoldOff         = STOP_CHATTER_HOLD_OFF;
+	STOP_Chatter.MaxLogPerMinute = STOP_LOG_MAX_PER_MINUTE;
+
+	STOP_Chatter.LogThisMinute = 0;
+	STOP_Chatter.MinuteTimer   = 0;
+	STOP_Chatter.Suppressed    = 0;
+	STOP_Chatter.Dropped       = 0;
+	STOP_Chatter.RecordIn      = 0;
+	STOP_Chatter.RecordOut     = 0;
+
+	for (i = 0; i < STOP_CHATTER_SLOTS; i++)
+		STOP_Chatter.Slot[i].Used = FALSE;
+}
+
+static t_STOP_chatter_slot *Chatter_Slot(DU16 SCIndex)
+{
+	DU8 i;
+	t_STOP_chatter_slot *pFree = 0;
+
+	for (i = 0; i < STOP_CHATTER_SLOTS; i++)
+	{
+		if (!STOP_Chatter.Slot[i].Used)
+		{
+			if (pFree == 0)
+				pFree = &STOP_Chatter.Slot[i];
+		}
+		else if (STOP_Chatter.Slot[i].SCIndex == SCIndex)
+			return (&STOP_Chatter.Slot[i]);
+	}
+
+	if (pFree != 0)
+	{
+		pFree->SCIndex    = SCIndex;
+		pFree->Toggles    = 0;
+		pFree->Timer      = 0;
+		pFree->Quiet      = 0;
+		pFree->Chattering = FALSE;
+		pFree->Used       = TRUE;
+	}
+	return (pFree);
+}
+
+static void Chatter_Queue(t_STOP_chatter_slot *pSlot)
+{
+	t_STOP_chatter_record *pRecord;
+	DU8 Next = (DU8)((STOP_Chatter.RecordIn + 1) % STOP_CHATTER_RECORDS);
+
+	// queue full: the count stays in the slot for the next record
+	if (Next == STOP_Chatter.RecordOut)
+		return;
+
+	pRecord = &STOP_Chatter.Record[STOP_Chatter.RecordIn];
+	pRecord->SCIndex = pSlot->SCIndex;
+	pRecord->Toggles = pSlot->Toggles;
+	pRecord->Set     = STOP_GetFlag(pSlot->SCIndex);
+	STOP_Chatter.RecordIn = Next;
+
+	pSlot->Toggles = 0;
+	pSlot->Timer   = 0;
+}
+
+// TRUE: write the log line for this change of SCIndex
+DBOOL STOP_Log_Request(DU16 SCIndex)
+{
+	t_STOP_chatter_slot *pSlot;
+
+	pSlot = Chatter_Slot(SCIndex);
+	if (pSlot != 0)
+	{
+		pSlot->Toggles++;
+		pSlot->Quiet = 0;
+
+		if (pSlot->Chattering)
+		{
+			STOP_Chatter.Suppressed++;
+			return (FALSE);
+		}
+		if (pSlot->Toggles >= STOP_Chatter.Toggles)
+		{
+			// from now on one record per hold-off time
+			pSlot->Chattering = TRUE;
+			pSlot->Toggles    = 1;
+			pSlot->Timer      = 0;
+			STOP_Chatter.Suppressed++;
+			return (FALSE);
+		}
+	}
+
+	if (STOP_Chatter.LogThisMinute >= STOP_Chatter.MaxLogPerMinute)
+	{
+		STOP_Chatter.Dropped++;
+		return (FALSE);
+	}
+	STOP_Chatter.LogThisMinute++;
+	return (TRUE);
+}
+
+void STOP_Chatter_control_1000ms(void)
+{
+	DU8 i;
+	t_STOP_chatter_slot *pSlot;
+
+	if (++STOP_Chatter.MinuteTimer >= 60)
+	{
+		STOP_Chatter.MinuteTimer   = 0;
+		STOP_Chatter.LogThisMinute = 0;
+	}
+
+	for (i = 0; i < STOP_CHATTER_SLOTS; i++)
+	{
+		pSlot = &STOP_Chatter.Slot[i];
+		if (!pSlot->Used)
+			continue;
+
+		pSlot->Timer++;
+		pSlot->Quiet++;
+
+		if (!pSlot->Chattering)
+		{
+			// not enough changes within the window
+			if (pSlot->Timer >= STOP_Chatter.Window)
+				pSlot->Used = FALSE;
+			continue;
+		}
+
+		if ((pSlot->Timer >= STOP_Chatter.HoldOff) && pSlot->Toggles)
+			Chatter_Queue(pSlot);
+
+		// quiet for the hold-off time: normal logging again
+		if ((pSlot->Quiet >= STOP_Chatter.HoldOff) && (pSlot->Toggles == 0))
+			pSlot->Used = FALSE;
+	}
+}
+
+// next aggregated record to write into STCLog, FALSE if none
+DBOOL STOP_Chatter_GetRecord(t_STOP_chatter_record *pRecord)
+{
+	if (STOP_Chatter.RecordOut == STOP_Chatter.RecordIn)
+		return (FALSE);
+
+	*pRecord = STOP_Chatter.Record[STOP_Chatter.RecordOut];
+	STOP_Chatter.RecordOut = (DU8)((STOP_Chatter.RecordOut + 1) % STOP_CHATTER_RECORDS);
+	return (TRUE);
+}
+
+
+// ******************************************************************
+// protection enable bitset
+// ******************************************************************
+
+// zero initialized: all protections enabled until STOP_ProtEnable_init() has read the parameters
+DU32 STOP_ProtDisabled[STOP_SET_WORDS];
+
+// the stop conditions of the bits whose bit is 0 in Config
+static void Disable(DU32 *Disabled, DU16 RefInd, DU8 NbrOfBits, DU32 Config)
+{
+	DU16 SCIndex;
+	DU8 Bit;
+
+	for (Bit = 0; Bit < NbrOfBits; Bit++)
+	{
+		if (Config & (1UL << Bit))
+			continue;
+
+		SCIndex = STOP_GetSC_ConfigElProt(RefInd, Bit);
+		if (SCIndex < STOPCONDITION_ARRAY_SIZE)
+			STOP_SET_ON(Disabled, SCIndex);
+	}
+}
+
+// listener of CONFIG_GRID_PROT and CONFIG_GEN_PROT (PAR_NOTIFY_TASK_100MS)
+// the new bitset is built first and written word by word, the protections of the
+// 20ms task read either the old or the new word, never a half updated one
+void STOP_ProtEnable_Update(void)
+{
+	DU32 Disabled[STOP_SET_WORDS];
+	DU16 i;
+
+	for (i = 0; i < STOP_SET_WORDS; i++)
+		Disabled[i] = 0;
+
+	// bit -> stop condition as the parameter description of STOPCONDITIONS.c defines it
+	Disable(Disabled, CONFIG_GRID_PROT__PARREFIND, NBR_CONFIG_GRID_PROT, (DU32)PAR_VALUE(CONFIG_GRID_PROT__PARREFIND));
+	Disable(Disabled, CONFIG_GEN_PROT__PARREFIND, NBR_CONFIG_GEN_PROT, (DU32)PAR_VALUE(CONFIG_GEN_PROT__PARREFIND));
+
+	for (i = 0; i < STOP_SET_WORDS; i++)
+		STOP_ProtDisabled[i] = Disabled[i];
+}
+
+// called from MAIN_control_init(), after PAR_init()
+void STOP_ProtEnable_init(void)
+{
+	STOP_ProtEnable_Update();
+
+	PAR_RegisterListener(PAR_NOTIFY_TASK_100MS, CONFIG_GRID_PROT__PARREFIND, CONFIG_GRID_PROT__PARREFIND, STOP_ProtEnable_Update);
+	PAR_RegisterListener(PAR_NOTIFY_TASK_100MS, CONFIG_GEN_PROT__PARREFIND, CONFIG_GEN_PROT__PARREFIND, STOP_ProtEnable_Update);
+}
+
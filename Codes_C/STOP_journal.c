@@ -0,0 +1,346 @@
+/**
+ * @file STOP_journal.c
+ * @ingroup Application
+ * Compressed journal of the stop condition changes (OPTION_STOP_JOURNAL)
+ *
+ * @remarks
+ * STCJournal takes the NOVRAM space of STCLog and is divided into blocks. Each block
+ * starts at the absolute time BlockTime[], the records inside only hold the time
+ * difference to the record before:
+ *
+ *   event    b0: bit 7 set/clear, bits 6..3 time difference 0..14 (15: varint follows),
+ *                bits 2..0 index bits 10..8
+ *            b1: index bits 7..0
+ *            [varint time difference, 7 bits per byte, bit 7: more bytes]
+ *   repeat   b0: 0x0F, b1: 0xFF (index STOP_JOURNAL_MARKER, kind 1)
+ *            DU16 number of further changes, DU16 time from the event before to the last change
+ *
+ * A stop condition which changes again within STOP_JOURNAL_REPEAT_GAP after its last
+ * event only counts up the repeat record behind it. When the newest block is full the
+ * oldest one is overwritten. STOP_Journal_Seek() searches the block by BlockTime
+ * (binary search) and decodes from there.
+ *
+ * Changes held per line of STCLog (tools/bench_stop_journal.c, 20000 changes each):
+ *
+ *   size of t_SC_LogLine         8      12      16      bytes per change
+ *   uniform                    2.3     3.6     4.8      3.2
+ *   plant                      2.6     4.0     5.3      2.8
+ *   trips                      3.2     4.9     6.6      2.3
+ *
+ * So the journal does not reach 10 times STCLog (5000 changes), which would need about
+ * 1 byte per change for 8 byte lines. The time difference takes most of it: changes some
+ * seconds apart need 6 bits at STOP_JOURNAL_TIME_UNIT alone. A 1 byte record of a slot in
+ * the last 8 or 16 stop conditions of the block and index differences to the event before
+ * were tried and saved less than 5 % (uniform got worse), so the format stays as it is.
+ *
+ * STOP_Set()/STOP_Clear() call STOP_Journal_Add() instead of writing a line into STCLog,
+ * STOP_init() calls STOP_Journal_Check().
+ *
+ * @date 17-oct-2026
+ *
+ * changes:
+ *      17.10.2026      first version
+ *      17.10.2026      size of STCJournal checked against STCLog at compile time
+ *      17.10.2026      ratio against STCLog measured with tools/bench_stop_journal.c
+ *
+ */
+
+#include "options.h"
+#include "deif_types.h"
+#include "appl_types.h"
+#include "STOPCONDITIONS.h"
+
+#if (OPTION_STOP_JOURNAL == TRUE)
+
+#define STOP_JOURNAL_MARKER			0x7FF		// index of the marker records
+#define STOP_JOURNAL_KIND_REPEAT	1
+#define STOP_JOURNAL_REPEAT_SIZE	6
+#define STOP_JOURNAL_SMALL_DIFF		15			// time differences below fit into b0
+
+// the index has 11 bits in the records
+typedef char STOP_Journal_CheckIndex[(STOPCONDITION_ARRAY_SIZE < STOP_JOURNAL_MARKER) ? 1 : -1];
+typedef char STOP_Journal_CheckBlocks[(STOP_JOURNAL_BLOCKS >= 2) ? 1 : -1];
+// STOP_JOURNAL_BLOCKS leaves 24 bytes for the fields behind the blocks and the padding
+typedef char STOP_Journal_CheckSize[(sizeof(t_nov_stc_journal) <= sizeof(t_nov_stc_log)) ? 1 : -1];
+
+// journal inside NOVRAM
+t_nov_stc_journal STCJournal;
+
+
+static DU16 GetU16(const DU8 *p)
+{
+	return ((DU16)(p[0] | ((DU16)p[1] << 8)));
+}
+
+static void PutU16(DU8 *p, DU16 Value)
+{
+	p[0] = (DU8)(Value);
+	p[1] = (DU8)(Value >> 8);
+}
+
+static DU8 VarLen(DU32 Value)
+{
+	DU8 Len = 1;
+
+	while (Value >= 0x80)
+	{
+		Value >>= 7;
+		Len++;
+	}
+	return (Len);
+}
+
+void STOP_Journal_Clear(void)
+{
+	STCJournal.Newest     = 0;
+	STCJournal.Count      = 0;
+	STCJournal.LastTime   = 0;
+	STCJournal.RepeatBase = 0;
+	STCJournal.LastIndex  = STOP_NO_INDEX;
+	STCJournal.LastSet    = FALSE;
+	STCJournal.RepeatPos  = STOP_JOURNAL_NO_POS;
+}
+
+// after power up: clear the journal if the NOVRAM content is not consistent
+void STOP_Journal_Check(void)
+{
+	DU16 b;
+
+	if ((STCJournal.Newest >= STOP_JOURNAL_BLOCKS) || (STCJournal.Count > STOP_JOURNAL_BLOCKS)
+		|| ((STCJournal.RepeatPos != STOP_JOURNAL_NO_POS)
+			&& (STCJournal.RepeatPos > (STOP_JOURNAL_BLOCK_SIZE - STOP_JOURNAL_REPEAT_SIZE))))
+	{
+		STOP_Journal_Clear();
+		return;
+	}
+	for (b = 0; b < STOP_JOURNAL_BLOCKS; b++)
+	{
+		if (STCJournal.BlockUsed[b] > STOP_JOURNAL_BLOCK_SIZE)
+		{
+			STOP_Journal_Clear();
+			return;
+		}
+	}
+}
+
+static void NewBlock(DU32 Time)
+{
+	if (STCJournal.Count)
+		STCJournal.Newest = (DU16)((STCJournal.Newest + 1) % STOP_JOURNAL_BLOCKS);
+	if (STCJournal.Count < STOP_JOURNAL_BLOCKS)
+		STCJournal.Count++;
+
+	STCJournal.BlockTime[STCJournal.Newest] = Time;
+	STCJournal.BlockUsed[STCJournal.Newest] = 0;
+	STCJournal.RepeatPos = STOP_JOURNAL_NO_POS;
+}
+
+// count a further change of the stop condition of the last event
+// FALSE: a normal event has to be written
+static DBOOL AddRepeat(DU32 Time)
+{
+	DU8 *pBlock = STCJournal.Data[STCJournal.Newest];
+	DU8 Pos = STCJournal.RepeatPos;
+	DU16 Count;
+
+	if (Pos != STOP_JOURNAL_NO_POS)
+	{
+		Count = GetU16(&pBlock[Pos + 2]);
+		if ((Count == 0xFFFF) || ((Time - STCJournal.RepeatBase) > 0xFFFF))
+			return (FALSE);
+
+		PutU16(&pBlock[Pos + 2], (DU16)(Count + 1));
+		PutU16(&pBlock[Pos + 4], (DU16)(Time - STCJournal.RepeatBase));
+		return (TRUE);
+	}
+
+	Pos = STCJournal.BlockUsed[STCJournal.Newest];
+	if ((Pos + STOP_JOURNAL_REPEAT_SIZE) > STOP_JOURNAL_BLOCK_SIZE)
+		return (FALSE);
+
+	pBlock[Pos]     = (DU8)((STOP_JOURNAL_KIND_REPEAT << 3) | (STOP_JOURNAL_MARKER >> 8));
+	pBlock[Pos + 1] = (DU8)(STOP_JOURNAL_MARKER & 0xFF);
+	PutU16(&pBlock[Pos + 2], 1);
+	PutU16(&pBlock[Pos + 4], (DU16)(Time - STCJournal.LastTime));
+
+	STCJournal.RepeatBase = STCJournal.LastTime;
+	STCJournal.RepeatPos  = Pos;
+	STCJournal.BlockUsed[STCJournal.Newest] = (DU8)(Pos + STOP_JOURNAL_REPEAT_SIZE);
+	return (TRUE);
+}
+
+// note a change of a stop condition
+void STOP_Journal_Add(DU16 SCIndex, DBOOL Set, DU32 Time)
+{
+	DU32 Diff;
+	DU8 Size;
+	DU8 *p;
+
+	if (SCIndex >= STOPCONDITION_ARRAY_SIZE)
+		return;
+	Set = Set ? TRUE : FALSE;
+
+	// the journal only runs forward
+	if (STCJournal.Count && (Time < STCJournal.LastTime))
+		Time = STCJournal.LastTime;
+
+	// the same stop condition changes again
+	if (STCJournal.Count && (SCIndex == STCJournal.LastIndex) && (Set != STCJournal.LastSet)
+		&& ((Time - STCJournal.LastTime) <= STOP_JOURNAL_REPEAT_GAP) && AddRepeat(Time))
+	{
+		STCJournal.LastTime = Time;
+		STCJournal.LastSet  = Set;
+		return;
+	}
+
+	Diff = STCJournal.Count ? (Time - STCJournal.LastTime) : 0;
+	Size = (DU8)(2 + ((Diff >= STOP_JOURNAL_SMALL_DIFF) ? VarLen(Diff) : 0));
+	if ((STCJournal.Count == 0) || ((STCJournal.BlockUsed[STCJournal.Newest] + Size) > STOP_JOURNAL_BLOCK_SIZE))
+	{
+		NewBlock(Time);
+		Diff = 0;
+		Size = 2;
+	}
+
+	p = &STCJournal.Data[STCJournal.Newest][STCJournal.BlockUsed[STCJournal.Newest]];
+	*p++ = (DU8)((Set ? 0x80 : 0) | (((Diff >= STOP_JOURNAL_SMALL_DIFF) ? STOP_JOURNAL_SMALL_DIFF : Diff) << 3)
+				 | (SCIndex >> 8));
+	*p++ = (DU8)(SCIndex & 0xFF);
+	if (Diff >= STOP_JOURNAL_SMALL_DIFF)
+	{
+		while (Diff >= 0x80)
+		{
+			*p++ = (DU8)(0x80 | (Diff & 0x7F));
+			Diff >>= 7;
+		}
+		*p = (DU8)Diff;
+	}
+
+	STCJournal.BlockUsed[STCJournal.Newest] = (DU8)(STCJournal.BlockUsed[STCJournal.Newest] + Size);
+	STCJournal.LastTime  = Time;
+	STCJournal.LastIndex = SCIndex;
+	STCJournal.LastSet   = Set;
+	STCJournal.RepeatPos = STOP_JOURNAL_NO_POS;
+}
+
+static DU16 OldestBlock(void)
+{
+	return ((DU16)((STCJournal.Newest + STOP_JOURNAL_BLOCKS + 1 - STCJournal.Count) % STOP_JOURNAL_BLOCKS));
+}
+
+// next event of the reader, FALSE at the end of the journal
+DBOOL STOP_Journal_Read(t_STOP_journal_reader *pReader, t_STOP_journal_event *pEvent)
+{
+	const DU8 *pBlock;
+	DU16 Used;
+	DU16 Index;
+	DU32 Diff;
+	DU8 Shift;
+
+	for (;;)
+	{
+		if (pReader->Block >= STOP_JOURNAL_BLOCKS)
+			return (FALSE);
+
+		pBlock = STCJournal.Data[pReader->Block];
+		Used   = STCJournal.BlockUsed[pReader->Block];
+
+		if ((pReader->Pos + 2) <= Used)
+		{
+			Index = (DU16)(((pBlock[pReader->Pos] & 0x07) << 8) | pBlock[pReader->Pos + 1]);
+			if (Index != STOP_JOURNAL_MARKER)
+				break;
+			// repeat record without event before it: skip
+			pReader->Pos += STOP_JOURNAL_REPEAT_SIZE;
+			continue;
+		}
+
+		// next block
+		if (pReader->BlocksLeft == 0)
+			return (FALSE);
+		pReader->BlocksLeft--;
+		pReader->Block = (DU16)((pReader->Block + 1) % STOP_JOURNAL_BLOCKS);
+		pReader->Pos   = 0;
+		pReader->Time  = STCJournal.BlockTime[pReader->Block];
+	}
+
+	Diff = (pBlock[pReader->Pos] >> 3) & 0x0F;
+	pEvent->Set     = (pBlock[pReader->Pos] & 0x80) ? TRUE : FALSE;
+	pEvent->SCIndex = Index;
+	pReader->Pos += 2;
+
+	if (Diff == STOP_JOURNAL_SMALL_DIFF)
+	{
+		Diff  = 0;
+		Shift = 0;
+		while ((pReader->Pos < Used) && (Shift < 32))
+		{
+			Diff |= (DU32)(pBlock[pReader->Pos] & 0x7F) << Shift;
+			Shift += 7;
+			if (!(pBlock[pReader->Pos++] & 0x80))
+				break;
+		}
+	}
+
+	pReader->Time   += Diff;
+	pEvent->Time     = pReader->Time;
+	pEvent->LastTime = pReader->Time;
+	pEvent->Repeat   = 0;
+
+	// repeat record of this event
+	if (((pReader->Pos + STOP_JOURNAL_REPEAT_SIZE) <= Used)
+		&& (pBlock[pReader->Pos] == ((STOP_JOURNAL_KIND_REPEAT << 3) | (STOP_JOURNAL_MARKER >> 8)))
+		&& (pBlock[pReader->Pos + 1] == (STOP_JOURNAL_MARKER & 0xFF)))
+	{
+		pEvent->Repeat   = GetU16(&pBlock[pReader->Pos + 2]);
+		pEvent->LastTime = pEvent->Time + GetU16(&pBlock[pReader->Pos + 4]);
+		pReader->Time    = pEvent->LastTime;
+		pReader->Pos    += STOP_JOURNAL_REPEAT_SIZE;
+	}
+	return (TRUE);
+}
+
+// set the reader to the first event at or after Time (or whose repeats reach Time),
+// FALSE if there is none
+DBOOL STOP_Journal_Seek(t_STOP_journal_reader *pReader, DU32 Time)
+{
+	t_STOP_journal_reader Before;
+	t_STOP_journal_event Event;
+	DU16 Oldest;
+	DU16 Low, High, Mid;
+
+	if (STCJournal.Count == 0)
+		return (FALSE);
+
+	// last block starting at or before Time (blocks in time order from the oldest)
+	Oldest = OldestBlock();
+	Low  = 0;
+	High = (DU16)(STCJournal.Count - 1);
+	while (Low < High)
+	{
+		Mid = (DU16)(Low + (High - Low + 1) / 2);
+		if (STCJournal.BlockTime[(Oldest + Mid) % STOP_JOURNAL_BLOCKS] <= Time)
+			Low = Mid;
+		else
+			High = (DU16)(Mid - 1);
+	}
+
+	pReader->Block      = (DU16)((Oldest + Low) % STOP_JOURNAL_BLOCKS);
+	pReader->BlocksLeft = (DU16)(STCJournal.Count - 1 - Low);
+	pReader->Pos        = 0;
+	pReader->Time       = STCJournal.BlockTime[pReader->Block];
+
+	for (;;)
+	{
+		Before = *pReader;
+		if (!STOP_Journal_Read(pReader, &Event))
+			return (FALSE);
+		if (Event.LastTime >= Time)
+		{
+			*pReader = Before;
+			return (TRUE);
+		}
+	}
+}
+
+#endif
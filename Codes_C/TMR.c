@@ -0,0 +1,150 @@
+/**
+ * @file TMR.c
+ * @ingroup Application
+ * Hierarchical timer wheels for protection and state timeouts
+ *
+ * @remarks
+ * Instead of counting a StateTimer in every cycle, a timeout is armed once in the wheel
+ * of its task and its callback is called when it expires. A timer which is not armed
+ * costs nothing, arm and cancel are O(1) (double linked list of the slot).
+ *
+ * Level 0 has one slot per tick, level 1 one slot per 64 ticks and so on. A timer is put
+ * into the level which covers its remaining ticks; whenever level 0 wraps around, the
+ * next slot of level 1 is distributed into level 0 (and of level 2 into level 1 when
+ * level 1 wraps around, ...). TMR_Tick() only visits the slot of the current tick.
+ *
+ * The timers belong to the modules (e.g. t_PROT_vars.Timer), nothing is allocated.
+ *
+ * @date 17-oct-2026
+ *
+ * changes:
+ *      17.10.2026      first version
+ *
+ */
+
+#include "options.h"
+#include "deif_types.h"
+#include "appl_types.h"
+
+#include "TMR.h"
+
+
+// timer wheels for global use
+t_TMR_wheel TMR_Wheel[TMR_NBR_OF_TASKS];
+
+// ms per tick of each wheel
+const DU16 TMR_CycleTime[TMR_NBR_OF_TASKS] = { 20, 100, 1000 };
+
+
+// put the timer into the slot for its remaining ticks
+static void Insert(t_TMR_wheel *pWheel, t_TMR_timer *pTimer)
+{
+	DU32 Delta = pTimer->Expires - pWheel->Now;
+	DU8 Level = 0;
+	t_TMR_timer **ppSlot;
+
+	while ((Level < (TMR_LEVELS - 1)) && (Delta >= (1UL << ((Level + 1) * TMR_SLOT_BITS))))
+		Level++;
+
+	ppSlot = &pWheel->Slot[Level][(pTimer->Expires >> (Level * TMR_SLOT_BITS)) & TMR_SLOT_MASK];
+
+	pTimer->pNext  = *ppSlot;
+	pTimer->ppPrev = ppSlot;
+	if (*ppSlot)
+		(*ppSlot)->ppPrev = &pTimer->pNext;
+	*ppSlot = pTimer;
+}
+
+static void Unlink(t_TMR_timer *pTimer)
+{
+	*pTimer->ppPrev = pTimer->pNext;
+	if (pTimer->pNext)
+		pTimer->pNext->ppPrev = pTimer->ppPrev;
+	pTimer->pNext  = 0;
+	pTimer->ppPrev = 0;
+}
+
+// distribute one slot of Level into the levels below
+static DU8 Cascade(t_TMR_wheel *pWheel, DU8 Level)
+{
+	DU8 Index = (DU8)((pWheel->Now >> (Level * TMR_SLOT_BITS)) & TMR_SLOT_MASK);
+	t_TMR_timer *pTimer = pWheel->Slot[Level][Index];
+	t_TMR_timer *pNext;
+
+	pWheel->Slot[Level][Index] = 0;
+	while (pTimer)
+	{
+		pNext = pTimer->pNext;
+		Insert(pWheel, pTimer);
+		pTimer = pNext;
+	}
+	return (Index);
+}
+
+// one tick of the wheel of Task, at the beginning of the task cycle
+// calls the callbacks of the timers which expire in this tick
+void TMR_Tick(DU8 Task)
+{
+	t_TMR_wheel *pWheel = &TMR_Wheel[Task];
+	t_TMR_timer *pTimer;
+	t_TMR_timer **ppSlot;
+	DU8 Level;
+
+	pWheel->Now++;
+
+	if (pWheel->Armed == 0)
+		return;
+
+	// level 0 wrapped around: next slot of level 1, if this wrapped around too of level 2, ...
+	if ((pWheel->Now & TMR_SLOT_MASK) == 0)
+	{
+		for (Level = 1; (Level < TMR_LEVELS) && (Cascade(pWheel, Level) == 0); Level++)
+			;
+	}
+
+	ppSlot = &pWheel->Slot[0][pWheel->Now & TMR_SLOT_MASK];
+	while ((pTimer = *ppSlot) != 0)
+	{
+		Unlink(pTimer);
+		pWheel->Armed--;
+		pTimer->Callback(pTimer->pOwner);
+	}
+}
+
+// arm the timer in the wheel of Task, Callback(pOwner) is called after Ticks cycles of
+// the task (at least 1), an armed timer is started again
+void TMR_Arm(DU8 Task, t_TMR_timer *pTimer, DU32 Ticks, t_TMR_callback Callback, void *pOwner)
+{
+	TMR_Cancel(pTimer);
+
+	if (Ticks == 0)
+		Ticks = 1;
+	if (Ticks > TMR_MAX_TICKS)
+		Ticks = TMR_MAX_TICKS;
+
+	pTimer->Task     = Task;
+	pTimer->Callback = Callback;
+	pTimer->pOwner   = pOwner;
+	pTimer->Expires  = TMR_Wheel[Task].Now + Ticks;
+
+	Insert(&TMR_Wheel[Task], pTimer);
+	TMR_Wheel[Task].Armed++;
+}
+
+void TMR_Cancel(t_TMR_timer *pTimer)
+{
+	if (!TMR_IsArmed(pTimer))
+		return;
+
+	Unlink(pTimer);
+	TMR_Wheel[pTimer->Task].Armed--;
+}
+
+// remaining time in ms, 0 if not armed
+DU32 TMR_Remaining(const t_TMR_timer *pTimer)
+{
+	if (!TMR_IsArmed(pTimer))
+		return (0);
+
+	return ((pTimer->Expires - TMR_Wheel[pTimer->Task].Now) * TMR_CycleTime[pTimer->Task]);
+}
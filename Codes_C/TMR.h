@@ -0,0 +1,69 @@
+/**
+ * @file TMR.h
+ * @ingroup Application
+ * Hierarchical timer wheels for protection and state timeouts
+ *
+ * @remarks
+ * One wheel per task, a timer is armed, cancelled and expires only in the task of its
+ * wheel. TMR_Tick() is called at the beginning of MAIN_control_20ms/_100ms/_1000ms.
+ * @date 17-oct-2026
+ *
+ * changes:
+ *      17.10.2026      first version
+ */
+
+#ifndef TMR_H_
+#define TMR_H_
+
+
+#include "deif_types.h"
+#include "appl_types.h"
+
+// wheels
+#define TMR_TASK_20MS			0
+#define TMR_TASK_100MS			1
+#define TMR_TASK_1000MS			2
+#define TMR_NBR_OF_TASKS		3
+
+// 4 levels of 64 slots: 1, 64, 4096 and 262144 ticks per slot
+#define TMR_LEVELS				4
+#define TMR_SLOT_BITS			6
+#define TMR_SLOTS				(1 << TMR_SLOT_BITS)
+#define TMR_SLOT_MASK			(TMR_SLOTS - 1)
+#define TMR_MAX_TICKS			((1UL << (TMR_LEVELS * TMR_SLOT_BITS)) - 1)	// longer delays are cut
+
+// called in the task of the wheel when the timer expires
+typedef void (*t_TMR_callback)(void *pOwner);
+
+typedef struct TMRtimerstruct
+{
+	struct TMRtimerstruct	*pNext;		// list of the slot
+	struct TMRtimerstruct	**ppPrev;	// pointer which points to this timer, 0 if not armed
+	DU32					Expires;	// tick of the wheel
+	t_TMR_callback			Callback;
+	void					*pOwner;	// parameter of Callback
+	DU8						Task;		// wheel
+} t_TMR_timer;
+
+typedef struct
+{
+	DU32					Now;		// ticks since start
+	DU16					Armed;		// number of armed timers
+	t_TMR_timer				*Slot[TMR_LEVELS][TMR_SLOTS];
+} t_TMR_wheel;
+
+extern t_TMR_wheel TMR_Wheel[TMR_NBR_OF_TASKS];
+extern const DU16 TMR_CycleTime[TMR_NBR_OF_TASKS];
+
+extern void  TMR_Tick(DU8 Task);
+extern void  TMR_Arm(DU8 Task, t_TMR_timer *pTimer, DU32 Ticks, t_TMR_callback Callback, void *pOwner);
+extern void  TMR_Cancel(t_TMR_timer *pTimer);
+extern DU32  TMR_Remaining(const t_TMR_timer *pTimer);
+
+// timer armed (a timer which is all 0 is not armed)
+#define TMR_IsArmed(pTimer)		((pTimer)->ppPrev != 0)
+// delay in ms -> ticks of the wheel, rounded up
+#define TMR_TICKS(Task, Delay)	(((Delay) + TMR_CycleTime[Task] - 1) / TMR_CycleTime[Task])
+
+
+#endif /*TMR_H_*/
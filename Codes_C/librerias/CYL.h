@@ -12,6 +12,8 @@
  * changes:
  * xx.xx.xxxx  xxx  xxxx  xxx
  * 1421 22.05.2013 GFH  cleaned up
+ *      17.10.2026      one pass supervision with bitmasks (CYL_Supervision)
+ *      17.10.2026      protections as arrays per member (CYL.Prot[]), CYL_A()/CYL_B(), up to 24 cylinders
  *
  */
 
@@ -25,42 +27,80 @@
 
 #if (OPTION_CYLINDER_MONITORING == TRUE)
 
+// filtering of average cylinder temperature values
+#define   CYL_NUMBER_OF_AVERAGE_VALUES_FOR_FILTERING         10
+
 extern void CYL_init(void);
 extern void CYL_control_100ms(void);
-
-// internal values of each protection
-struct CYL_protection_variables
-{
-	t_protection_state State;
-    t_protection_state LastState;
-    DU32               StateTimer;
-    DS16               Limit;
-    DBOOL              Exceeded;
-};
-
-// protection functions for each cylinder
-struct CYL_protection_variables_cylinder_temperature
-{
-	struct CYL_protection_variables     OvertempStop;
-	struct CYL_protection_variables     Overtemp;
-	struct CYL_protection_variables     Undertemp;
-	struct CYL_protection_variables     AvrDeviation;
-};
-
+extern void CYL_Supervision(void);		// CYL_ext.c, called by CYL_control_100ms()
+
+// protection functions for each cylinder (index of CYL.Prot[] and of the bitmasks CYL.Exceeded[])
+#define CYL_OVERTEMP_STOP			0
+#define CYL_OVERTEMP				1
+#define CYL_UNDERTEMP				2
+#define CYL_AVR_DEVIATION			3
+#define CYL_NBR_OF_SUPERVISIONS		4
+
+// can be set in options.h, 24 for a V24 engine (stop conditions of cylinder 21..24 in
+// STOPCONDITIONS.h behind the ones of cylinder 20, #if (CYL_NBR_OF_CYLINDERS > 20))
+#ifndef CYL_NBR_OF_CYLINDERS
 #define CYL_NBR_OF_CYLINDERS		20
+#endif
+
+#if (CYL_NBR_OF_CYLINDERS > 24)
+#error "CYL_NBR_OF_CYLINDERS: stop conditions exist for 24 cylinders"
+#endif
 
 #define CYL_NBR_OF_CYLINDERS_A		(CYL_NBR_OF_CYLINDERS/2)
 #define CYL_NBR_OF_CYLINDERS_B		(CYL_NBR_OF_CYLINDERS/2)
 
+// cylinders of side A are 0..CYL_NBR_OF_CYLINDERS_A-1 of the arrays, side B behind
+#define CYL_FIRST_A					0
+#define CYL_FIRST_B					CYL_NBR_OF_CYLINDERS_A
+
+// internal values of one protection function of all cylinders, one array per member
+// (cylinder i of side A at CYL_FIRST_A + i, of side B at CYL_FIRST_B + i),
+// Exceeded is the bit of the cylinder in CYL.Exceeded[]
+typedef struct
+{
+	t_protection_state State[CYL_NBR_OF_CYLINDERS];
+	t_protection_state LastState[CYL_NBR_OF_CYLINDERS];
+	DU32               StateTimer[CYL_NBR_OF_CYLINDERS];
+	DS16               Limit[CYL_NBR_OF_CYLINDERS];
+} t_CYL_protections;
+
+// one pass values of one side (CYL_Supervision)
+typedef struct
+{
+   DS16  Min;            // of the valid cylinders, -32768 if none is valid
+   DS16  Max;
+   DS32  Sum;
+   DU8   Count;          // valid cylinders
+
+   // moving average of the average
+   DS16  History[CYL_NUMBER_OF_AVERAGE_VALUES_FOR_FILTERING];
+   DS32  HistorySum;
+   DU8   HistoryIndex;
+   DU8   HistoryCount;
+} t_CYL_side;
+
 // global Variables of CYL
 typedef struct CYLstruct
 {
    // input
    struct Temp_Input TempA[CYL_NBR_OF_CYLINDERS_A];
    struct Temp_Input TempB[CYL_NBR_OF_CYLINDERS_B];
+   DU32  Assigned;       // bit per cylinder: sensor assigned (set by CYL_control_100ms before CYL_Supervision)
 
    // internal
 
+   // all cylinders, one bit per cylinder in the masks
+   DS16  Temp[CYL_NBR_OF_CYLINDERS];                   // TempA[].Value, TempB[].Value
+   DU32  Valid;                                        // assigned and no sensor error (-32768)
+   DU32  Exceeded[CYL_NBR_OF_SUPERVISIONS];            // input beyond Prot[].Limit[], bit per cylinder
+   t_CYL_side  SideA;
+   t_CYL_side  SideB;
+
    // Cylinder temperatures side A
    DS16  TxxxAverageA;   // Average of T16x side A
    DS16  TxxxAverageAFilteredValue;		// Average of T16x side A filtered value
@@ -77,10 +117,8 @@ typedef struct CYLstruct
 
    DS32  MaxPower;       // reduced max power due to too hot cylinders
 
-   // cylinder temperature supervisions
-   struct CYL_protection_variables_cylinder_temperature  A[CYL_NBR_OF_CYLINDERS_A];
-
-   struct CYL_protection_variables_cylinder_temperature  B[CYL_NBR_OF_CYLINDERS_B];
+   // cylinder temperature supervisions, CYL.Prot[CYL_OVERTEMP].Limit[] etc., see CYL_A() / CYL_B()
+   t_CYL_protections  Prot[CYL_NBR_OF_SUPERVISIONS];
 
    //enum t_CYL_state  state;
    //enum t_CYL_mode   mode;
@@ -91,6 +129,14 @@ typedef struct CYLstruct
 
 extern t_CYL CYL;
 
+// the former CYL.A[i].Overtemp.Limit is CYL_A(i, CYL_OVERTEMP, Limit),
+// CYL.B[i].Undertemp.Exceeded is CYL_B_EXCEEDED(i, CYL_UNDERTEMP)
+#define CYL_A(i, Supervision, Member)		(CYL.Prot[Supervision].Member[CYL_FIRST_A + (i)])
+#define CYL_B(i, Supervision, Member)		(CYL.Prot[Supervision].Member[CYL_FIRST_B + (i)])
+#define CYL_EXCEEDED(Cyl, Supervision)		((DBOOL)((CYL.Exceeded[Supervision] >> (Cyl)) & 1UL))
+#define CYL_A_EXCEEDED(i, Supervision)		CYL_EXCEEDED(CYL_FIRST_A + (i), Supervision)
+#define CYL_B_EXCEEDED(i, Supervision)		CYL_EXCEEDED(CYL_FIRST_B + (i), Supervision)
+
 #define		CYL_DELAY_TIME_T152_TEMP_TOO_HIGH	1000L
 #define		CYL_DELAY_TIME_T153_TEMP_TOO_HIGH	1000L
 #define		CYL_DELAY_TIME_T154_TEMP_TOO_HIGH	1000L
@@ -112,9 +158,6 @@ extern t_CYL CYL;
 // activation power for cylinder temp min monitoring
 #define   CYL_UNDERTEMP_ACTIVATION_POWER			         4000
 
-// filtering of average cylinder temperature values
-#define   CYL_NUMBER_OF_AVERAGE_VALUES_FOR_FILTERING         10
-
 
 #endif // OPTION_CYLINDER_MONITORING
 
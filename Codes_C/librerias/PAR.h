@@ -120,6 +120,16 @@
  * 		17.11.2014 MVO  HKS and NKK signal for valve position max value increased to 3
  * 		28.07.2015 MVO  load reduction receiver temp max raised from 100 to 130°C
  * 		16.03.2016 MVO  new unit percent per Kelvin
+ * 		16.10.2026      parameter change notification (dirty bitset, generation counter, listeners)
+ * 		16.10.2026      parameter id lookup table sorted by id (binary search)
+ * 		16.10.2026      incremental NOVRAM save of changed pages with page CRC
+ * 		16.10.2026      const descriptor table PAR_Desc[] generated from the macros below (tools/gen_par_desc.py)
+ * 		16.10.2026      packed parameter image with bit width per parameter (OPTION_PAR_PACKED)
+ * 		16.10.2026      transactions: several parameters staged and applied together
+ * 		17.10.2026      binary delta format for file transfer, applied in steps (PAR_delta.c)
+ * 		17.10.2026      batch range validation of reference index ranges with violation bitset
+ * 		17.10.2026      PAR_VALUE() for module reads, access profiler (OPTION_PAR_PROFILER)
+ * 		17.10.2026      PAR_BUILD_BEGIN()/PAR_BUILD_VALID() for listeners with double buffered data
  */
 
 #ifndef PAR_H_
@@ -135,7 +145,7 @@
 #include "TMP.h"
 
 #define BSPLUS_CUSTOMER_ID	240424L
-#define OPTION_BSPLUS		(PARA[ParRefInd[BSPLUS_CUSTOMER_ID__PARREFIND]].Value == BSPLUS_CUSTOMER_ID)
+#define OPTION_BSPLUS		(PAR_VALUE(BSPLUS_CUSTOMER_ID__PARREFIND) == BSPLUS_CUSTOMER_ID)
 
 // Parameter-Bitmask
 #define PARA_BITMASK_BIT0_RESERVE         0x0001
@@ -4618,6 +4628,244 @@ extern DBOOL PAR_CheckTMPParameters(DU16 RefInd);
 extern void	PAR_SetValue(DU16 RefInd, DS32 Value);
 extern void	PAR_SetTouched(DU16 RefInd, DBOOL Touched);
 
+// parameter change notification
+// PAR_MarkChanged() sets the bit of the reference index in the dirty bitset of every task
+// and increments the generation counter. Every writer of PARA[] has to call it:
+//   - PAR_SetValue() (PAR.c), i.e. HMI, modbus and Bing-Bang writes
+//   - the writers of PAR_ext.c and PAR_delta.c (transactions, factory settings,
+//     range validation, packed image, delta sets) call it themselves
+// PAR_DispatchChanges() is called once per cycle of the task (MAIN_control_100ms/_1000ms),
+// returns immediately if nothing has changed and otherwise calls every listener of that task
+// whose reference index range was touched - exactly once, even if several parameters changed.
+// Each task has two dirty bitsets: PAR_MarkChanged() writes into Dirty[Task][Active[Task]],
+// PAR_DispatchChanges() switches Active[Task] first and then takes over and clears the other
+// one, so a mark made while dispatching is never cleared without being dispatched.
+// As a fallback for writers which do not mark (e.g. a PAR.c without the hook) the listeners
+// with PAR_LISTEN_ALL are called every PAR_NOTIFY_REFRESH_TIME ms anyway.
+#define PAR_NOTIFY_TASK_100MS		0
+#define PAR_NOTIFY_TASK_1000MS		1
+#define PAR_NOTIFY_NBR_OF_TASKS		2
+
+#define PAR_NOTIFY_REFRESH_TIME		1000L		// [ms] fallback refresh of PAR_LISTEN_ALL listeners
+
+#define PAR_DIRTY_WORDS				((HIGHEST_PARREFIND / 32) + 1)
+#define PAR_MAX_LISTENERS			24
+#define PAR_LISTEN_ALL				0			// FirstRefInd: listener is called on any change
+
+typedef void (*t_PAR_listener)(void);
+
+typedef struct PARnotifystruct
+{
+	DU32	Generation;									// incremented with every change
+	DU32	DispatchedGeneration[PAR_NOTIFY_NBR_OF_TASKS];	// generation seen by the last dispatch
+	DU32	ApplySeq;									// odd while a transaction is written into PARA[]
+	DU8		Active[PAR_NOTIFY_NBR_OF_TASKS];			// bitset of Dirty[Task][] written by PAR_MarkChanged()
+	DU32	Dirty[PAR_NOTIFY_NBR_OF_TASKS][2][PAR_DIRTY_WORDS];	// one bit per reference index
+	DU32	RefreshTime[PAR_NOTIFY_NBR_OF_TASKS];		// [ms] since the last PAR_LISTEN_ALL call
+} t_PAR_notify;
+
+extern t_PAR_notify PAR_Notify;
+
+extern void	PAR_MarkChanged(DU16 RefInd);
+extern void	PAR_MarkAllChanged(void);
+extern DBOOL PAR_RegisterListener(DU8 Task, DU16 FirstRefInd, DU16 LastRefInd, t_PAR_listener Listener);
+extern void	PAR_DispatchChanges(DU8 Task);
+
+// consistent derived data (snapshots, curves) of a listener of the 1000ms task:
+// Seq = PAR_BUILD_BEGIN() before reading PARA[] into the standby buffer, switch to the
+// buffer only if PAR_BUILD_VALID(Seq) afterwards. Otherwise a transaction was applied by
+// the preempting 100ms task meanwhile, the old buffer stays in use and
+// PAR_DispatchChanges() calls the listener again in the next cycle.
+#define PAR_BUILD_BEGIN()			(*(volatile DU32 *)&PAR_Notify.ApplySeq)
+#define PAR_BUILD_VALID(Seq)		(((Seq) == PAR_BUILD_BEGIN()) && !((Seq) & 1UL))
+
+// parameter id lookup
+// table of (id, index) sorted by id, built once after PAR_init() (or on first use)
+// PAR_Get_Index() uses PAR_IdLookup_Find() instead of scanning PARA[]
+typedef struct
+{
+	DU16	Id;
+	DU16	Index;
+} t_PAR_id_lookup;
+
+extern void	PAR_IdLookup_Build(void);
+extern void	PAR_IdLookup_Invalidate(void);
+extern DBOOL PAR_IdLookup_Find(DU16 parameter_id, DU16 *Index);
+
+// incremental save of the parameter values in NOVRAM
+// ParaValue[] is divided into pages of PAR_NOV_PAGE_SIZE values, each protected by a CRC
+// in ParaPageCrc[]. PAR_MarkChanged() marks the page, SaveParameter() writes only the
+// marked pages (and only the values that differ).
+// PAR_Nov_Verify() checks all pages once after PAR_init(): the parameters of a page with a
+// wrong CRC are set to their factory setting (clamped into min/max without descriptor),
+// counted in PAR_NovStat.LoadErrors and STOPCONDITION_70209 is set. Until then
+// PAR_Nov_Scrub() does nothing, afterwards it checks one page per call; PARA[] is verified,
+// so a page with a wrong CRC is written again from PARA[], counted in PAR_NovStat.CrcErrors
+// and STOPCONDITION_70209 is set.
+#define PAR_NOV_PAGE_SIZE			32			// parameter values per page (128 bytes)
+#define PAR_NOV_CRC_MAGIC			0x50435243UL	// ParaPageCrcMagic: ParaPageCrc[] written
+#define PAR_NOV_NBR_OF_PAGES		((NBR_OF_PARA + PAR_NOV_PAGE_SIZE - 1) / PAR_NOV_PAGE_SIZE)
+#define PAR_NOV_DIRTY_WORDS			((PAR_NOV_NBR_OF_PAGES / 32) + 1)
+
+typedef struct
+{
+	DU32	BytesLastSave;		// bytes written to NOVRAM by the last save
+	DU32	BytesTotal;			// bytes written since power up
+	DU16	PagesLastSave;		// pages written by the last save
+	DU32	Saves;				// number of saves with at least one page
+	DU16	CrcErrors;			// pages rewritten by PAR_Nov_Scrub()
+	DU16	LoadErrors;			// pages set to the factory settings by PAR_Nov_Verify()
+} t_PAR_nov_stat;
+
+extern t_PAR_nov_stat PAR_NovStat;
+extern DU16 ParaPageCrc[PAR_NOV_NBR_OF_PAGES];		// in NOVRAM next to ParaValue[]
+extern DU32 ParaPageCrcMagic;						// in NOVRAM, PAR_NOV_CRC_MAGIC
+
+extern DU16	PAR_Crc16(DU16 Crc, const DU8 *Data, DU32 Length);
+extern void	PAR_Nov_MarkIndex(DU16 Index);
+extern void	PAR_Nov_MarkAll(void);
+extern DU32	PAR_Nov_SaveDirty(void);
+extern DBOOL PAR_Nov_CheckPage(DU16 Page);
+extern DU16	PAR_Nov_Verify(void);
+extern void	PAR_Nov_Scrub(void);
+
+// const parameter descriptors, indexed by reference index
+// generated by tools/gen_par_desc.py into PAR_desc.c from the __MIN_VALUE, __MAX_VALUE,
+// __FACTORY_SETTING and __ACCESS_LEVEL macros of this file (run it after changes here).
+// Reference indices without a complete macro set (IO terminals, passwords, shared limits)
+// have Valid = 0 and are still initialised individually in PAR_init().
+typedef struct
+{
+	DU8		Valid;
+	DU8		AccessLevel;
+	DU8		Bits;			// bit width in the packed image (32 without descriptor)
+	DS32	MinValue;
+	DS32	MaxValue;
+	DS32	DefValue;
+	DU32	BitOffset;		// position in the packed image
+} t_PAR_desc;
+
+extern const t_PAR_desc PAR_Desc[HIGHEST_PARREFIND+1];
+extern const DU16 PAR_NbrOfDesc;
+
+extern const t_PAR_desc* PAR_Desc_Get(DU16 RefInd);
+extern DU16	PAR_Desc_LoadFactorySettings(void);
+
+// parameter transactions
+// curves and PID sets are written as one: PAR_BeginTransaction(), PAR_StageValue() for each
+// parameter, PAR_CommitTransaction(). The committed values are written into PARA[] together
+// by PAR_ApplyTransaction() at the beginning of MAIN_control_100ms, listeners run once for
+// the whole set. Listeners of other tasks interrupted by the apply run again in their next cycle,
+// their derived data is only switched if no apply came in between (PAR_BUILD_VALID).
+// Two staging buffers: the next transaction can be staged while the last one waits for apply.
+// Only one writer (HMI, modbus or file transfer) may stage at a time.
+#define PAR_TRANS_MAX_VALUES		128
+
+#define PAR_TRANS_FREE				0
+#define PAR_TRANS_OPEN				1
+#define PAR_TRANS_COMMITTED			2
+
+typedef struct
+{
+	DU8		State;
+	DU16	Count;
+	DU16	RefInd[PAR_TRANS_MAX_VALUES];
+	DS32	Value[PAR_TRANS_MAX_VALUES];
+} t_PAR_transaction;
+
+extern DBOOL PAR_BeginTransaction(void);
+extern DBOOL PAR_StageValue(DU16 RefInd, DS32 Value);
+extern DBOOL PAR_CommitTransaction(void);
+extern void	PAR_AbortTransaction(void);
+extern void	PAR_ApplyTransaction(void);
+
+// batch range validation
+// PAR_Validate_Init() copies min/max of all parameters into two arrays (after PAR_init),
+// PAR_ValidateRange() checks (and clamps) a range of reference indices in one loop and
+// marks each violation in a bitset (one bit per reference index, PAR_DIRTY_WORDS words).
+// Used at boot and after file transfer instead of PAR_Check...Parameters() per parameter.
+#define PAR_VALIDATE_CAI_FIRST		CAI_SENSOR_ZERO_1__PARREFIND
+#define PAR_VALIDATE_CAI_LAST		CAI_CONF_DO__24_4__PARREFIND
+#define PAR_VALIDATE_TMP_FIRST		TMP_SENSOR_FAULT_DELAY_1__PARREFIND
+#define PAR_VALIDATE_TMP_LAST		TMP_CONF_DO__20_4__PARREFIND
+#define PAR_VALIDATE_MES_FIRST		MES_PDI_SC_LEVEL_1__PARREFIND
+#define PAR_VALIDATE_MES_LAST		MES_PDI_CONF_DO__60_2__PARREFIND
+
+extern void	PAR_Validate_Init(void);
+extern DU16	PAR_ValidateRange(DU16 FirstRefInd, DU16 LastRefInd, DBOOL Clamp, DU32 *Violations);
+extern DU16	PAR_ValidateAll(DBOOL Clamp, DU32 *Violations);
+
+// binary delta parameter file transfer (PAR_delta.c)
+#define PAR_DELTA_MAGIC				0x4450		// 'PD'
+#define PAR_DELTA_VERSION			2
+#define PAR_DELTA_HEADER_SIZE		16
+#define PAR_DELTA_RECORD_SIZE		6			// DU16 id, DS32 value
+#define PAR_DELTA_CRC_SIZE			2
+
+#define PAR_DELTA_BYTES_PER_CYCLE	2048		// CRC check per 100ms cycle
+#define PAR_DELTA_VALUES_PER_CYCLE	512			// CRC of the base image per 100ms cycle
+#define PAR_DELTA_RECORDS_PER_CYCLE	200			// validated per 100ms cycle, written all in one cycle
+#define PAR_DELTA_SW_NUMBER_TEST	900			// SW_NUMBER of test versions (MAIN_control_init)
+
+// base of the delta
+#define PAR_DELTA_BASE_FACTORY		0			// differences to the factory settings
+#define PAR_DELTA_BASE_IMAGE		1			// differences to the image of the target
+
+// states of the applier
+#define PAR_DELTA_IDLE				0
+#define PAR_DELTA_CHECK_CRC			1
+#define PAR_DELTA_CHECK_BASE		2			// PAR_DELTA_BASE_IMAGE: CRC of PARA[]
+#define PAR_DELTA_VALIDATE			3
+#define PAR_DELTA_WRITE				4
+
+// results
+#define PAR_DELTA_OK				0
+#define PAR_DELTA_ERR_FORMAT		1
+#define PAR_DELTA_ERR_VERSION		2			// STOPCONDITION_20004
+#define PAR_DELTA_ERR_CRC			3			// STOPCONDITION_70209
+#define PAR_DELTA_ERR_ID			4			// STOPCONDITION_70209
+#define PAR_DELTA_ERR_RANGE			5			// STOPCONDITION_70209
+#define PAR_DELTA_ERR_ABORTED		6
+#define PAR_DELTA_ERR_PROJECT		7			// STOPCONDITION_20002
+#define PAR_DELTA_ERR_TEST			8			// STOPCONDITION_20003
+#define PAR_DELTA_ERR_SW_VERSION	9			// STOPCONDITION_20004
+#define PAR_DELTA_ERR_BASE			10			// STOPCONDITION_70209, image of the target differs
+
+typedef struct
+{
+	DBOOL		Busy;
+	DU8			State;
+	DU8			Result;
+	DU16		Count;			// records in the delta
+	DU16		Done;			// records validated / written in the actual state
+	DU16		Crc;
+	DU8			Base;			// PAR_DELTA_BASE_xxx
+	DU32		Pos;
+	DU32		Length;
+	const DU8	*pData;
+} t_PAR_delta;
+
+extern t_PAR_delta PAR_Delta;
+
+extern DU16	PAR_Delta_ImageCrc(DU16 Crc, DS32 Value);
+extern DU32	PAR_Delta_Build(DU8 Base, const DS32 *BaseValue, DU8 *Buffer, DU32 Size);
+extern DBOOL PAR_Delta_ApplyStart(const DU8 *Data, DU32 Length);
+extern void	PAR_Delta_Abort(void);
+extern void	PAR_Delta_control_100ms(void);
+
+#if (OPTION_PAR_PACKED == TRUE)
+// packed parameter image: each value is stored as (Value - MinValue) in Bits bits,
+// for NOVRAM and file transfer. Modules keep reading PARA[] or their snapshot structs.
+extern DU32 PAR_PackedValue[];
+extern const DU16 PAR_PackedWords;
+
+extern DBOOL PAR_Packed_Check(void);
+extern DS32	PAR_Packed_Get(DU16 RefInd);
+extern void	PAR_Packed_Set(DU16 RefInd, DS32 Value);
+extern void	PAR_Packed_FromPARA(void);
+extern void	PAR_Packed_ToPARA(void);
+#endif
+
 // parameter values in PSWRAM
 struct pswparameters
 {
@@ -4645,6 +4893,39 @@ extern struct pswparameters PswValue;
 
 extern t_PARA 	PARA[NBR_OF_PARA];
 
+// value of a parameter by reference index, to be used instead of PARA[ParRefInd[x]].Value
+#if (OPTION_PAR_PROFILER == TRUE)
+#define PAR_VALUE(RefInd)	(*PAR_Profile_Value(RefInd))
+#else
+#define PAR_VALUE(RefInd)	(PARA[ParRefInd[RefInd]].Value)
+#endif
+
+#if (OPTION_PAR_PROFILER == TRUE)
+// parameter access profiler: every PAR_VALUE() and PAR accessor counts per reference
+// index and task. The task loops set the actual task with PAR_Profile_EnterTask().
+#define PAR_PROFILE_TASK_20MS		0
+#define PAR_PROFILE_TASK_100MS		1
+#define PAR_PROFILE_TASK_1000MS		2
+#define PAR_PROFILE_TASK_OTHER		3		// init, HMI, communication
+#define PAR_PROFILE_NBR_OF_TASKS	4
+#define PAR_PROFILE_ALL_TASKS		0xFF
+
+typedef struct
+{
+	DU16	RefInd;
+	DU32	Count;
+} t_PAR_profile_entry;
+
+extern DU8	PAR_Profile_EnterTask(DU8 Task);
+extern void	PAR_Profile_LeaveTask(DU8 PrevTask);
+extern void	PAR_Profile_Hit(DU16 RefInd);
+extern DS32	*PAR_Profile_Value(DU16 RefInd);
+extern DU32	PAR_Profile_Count(DU8 Task, DU16 RefInd);
+extern void	PAR_Profile_Reset(void);
+extern DU16	PAR_Profile_Ranking(DU8 Task, t_PAR_profile_entry *List, DU16 MaxEntries);
+extern void	PAR_Profile_Dump(DU16 MaxLines);
+#endif
+
 /* Template
 // xxx
 // to replace  yyy
@@ -64,6 +64,25 @@
  * 1410 22.03.2012 GFH  gas warning without stop
  * 1421 22.05.2013 GFH  grid protection and control according to VDE AR-N 4105 - 2013
  * 1422 16.09.2013 GFH  support of gas mixer with analogue control
+ *      16.10.2026      stop condition code lookup table sorted by code (binary search)
+ *      17.10.2026      STC.STOPFlag and STOP_Tripped as bitsets, STOP_is_Set() as bit test
+ *      17.10.2026      incremental aggregation of actualLevel/actualBitMask (STOP_Aggr)
+ *      17.10.2026      set stop conditions per level, STOP_ClearActive() for the clear functions
+ *      17.10.2026      set stop conditions in priority order: STOP_Active_First(), STOP_Active_Page()
+ *      17.10.2026      set stop conditions per bitmask bit for STOP_findIndex()
+ *      17.10.2026      const descriptor table STOP_Desc[] (OPTION_STOP_CONST_DESC), STOP_DESC_... access
+ *      17.10.2026      STOP_BeginCycle()/STOP_CommitCycle(): changes of a task cycle applied together
+ *      17.10.2026      cycle per task, STOP_is_Set() sees the changes of the running cycle
+ *      17.10.2026      chatter suppression and rate limit for the STCLog lines
+ *      17.10.2026      compressed journal STCJournal in the NOVRAM space of STCLog (OPTION_STOP_JOURNAL)
+ *      17.10.2026      protection enable bitset STOP_ProtEnabled, SC_ENABLE_xxxxx without parameter read
+ *      17.10.2026      STOP_ProtDisabled instead, all enabled until STOP_ProtEnable_init()
+ *      17.10.2026      STOP_Tripped renamed STOP_TrippedBits, accessors as static inline functions,
+ *                      layout version STC.Version (STOP_NOV_STC_VERSION)
+ *      17.10.2026      only the 20ms task commits, the other cycles hand their changes over,
+ *                      STOP_Aggr_Check() of the counters in the 1000ms task
+ *      17.10.2026      STOP_SetTripped() of the 100ms / 1000ms task written by the 20ms commit
+ *      17.10.2026      stop conditions of cylinder 21..24 (CYL_NBR_OF_CYLINDERS > 20)
  *
  */
  
@@ -538,6 +557,13 @@ typedef enum
   STOPCONDITION_50118,
   STOPCONDITION_50119,
   STOPCONDITION_50120,
+#if (CYL_NBR_OF_CYLINDERS > 20)
+  // cylinder 21..24 (CYL.h)
+  STOPCONDITION_50921,
+  STOPCONDITION_50922,
+  STOPCONDITION_50923,
+  STOPCONDITION_50924,
+#endif
 #endif // OPTION_CYLINDER_MONITORING
   
   // rmiIGNA
@@ -657,6 +683,13 @@ typedef enum
   STOPCONDITION_50148,
   STOPCONDITION_50149,
   STOPCONDITION_50150,
+#if (CYL_NBR_OF_CYLINDERS > 20)
+  // cylinder 21..24 (CYL.h)
+  STOPCONDITION_50951,
+  STOPCONDITION_50952,
+  STOPCONDITION_50953,
+  STOPCONDITION_50954,
+#endif
 #endif // OPTION_CYLINDER_MONITORING
 
   // ZS3
@@ -758,6 +791,13 @@ typedef enum
   STOPCONDITION_60078,
   STOPCONDITION_60079,
   STOPCONDITION_60080,
+#if (CYL_NBR_OF_CYLINDERS > 20)
+  // cylinder 21..24 (CYL.h)
+  STOPCONDITION_60161,
+  STOPCONDITION_60162,
+  STOPCONDITION_60163,
+  STOPCONDITION_60164,
+#endif
   STOPCONDITION_60081,
   STOPCONDITION_60082, 
   STOPCONDITION_60083,
@@ -778,6 +818,13 @@ typedef enum
   STOPCONDITION_60098,
   STOPCONDITION_60099,
   STOPCONDITION_60100,
+#if (CYL_NBR_OF_CYLINDERS > 20)
+  // cylinder 21..24 (CYL.h)
+  STOPCONDITION_60181,
+  STOPCONDITION_60182,
+  STOPCONDITION_60183,
+  STOPCONDITION_60184,
+#endif
   STOPCONDITION_60101,
   STOPCONDITION_60102,
   STOPCONDITION_60103,
@@ -798,6 +845,13 @@ typedef enum
   STOPCONDITION_60118,
   STOPCONDITION_60119,
   STOPCONDITION_60120,
+#if (CYL_NBR_OF_CYLINDERS > 20)
+  // cylinder 21..24 (CYL.h)
+  STOPCONDITION_60201,
+  STOPCONDITION_60202,
+  STOPCONDITION_60203,
+  STOPCONDITION_60204,
+#endif
 #endif // OPTION_CYLINDER_MONITORING
 
   STOPCONDITION_60121,
@@ -2109,6 +2163,15 @@ typedef enum
 // total number of StopConditions:
 #define STOPCONDITION_ARRAY_SIZE		(STOPCONDITION_LAST+1)		// rmiBOPS
 
+// bitsets over all stop conditions, one bit per index, 32 per word
+#define STOP_SET_WORDS					((STOPCONDITION_ARRAY_SIZE + 31) / 32)
+#define STOP_NO_INDEX					0xFFFF		// returned by the queries if no bit is set
+
+#define STOP_SET_TEST(Set, Index)		(((Set)[(Index) >> 5] >> ((Index) & 31)) & 1UL)
+#define STOP_SET_ON(Set, Index)			((Set)[(Index) >> 5] |= (1UL << ((Index) & 31)))
+#define STOP_SET_OFF(Set, Index)		((Set)[(Index) >> 5] &= ~(1UL << ((Index) & 31)))
+#define STOP_SET_WRITE(Set, Index, On)	((On) ? STOP_SET_ON(Set, Index) : STOP_SET_OFF(Set, Index))
+
 // defines for the SC BitMask bits:
 // ===============================
 // - regular stop
@@ -2182,12 +2245,19 @@ struct s_OneStopCondition
 #define SC_LOG_NUMBER_OF_LINES  500 //number of lines to log
 
 // stc
+// STOP_NOV_STC_VERSION changes with the layout, STOP_Nov_CheckVersion() clears STC if
+// the NOVRAM holds another one (version 1: STOPFlag as DBOOL array)
+#define STOP_NOV_STC_VERSION			0x53544302UL	// 'STC' 2: STOPFlag as bitset
+
 typedef struct
 {
-	DBOOL 		STOPFlag[STOPCONDITION_ARRAY_SIZE];
+	DU32		Version;							// STOP_NOV_STC_VERSION
+	DU32 		STOPFlag[STOP_SET_WORDS];			// bitset, see STOP_SET_TEST()
    DTIMESTAMP	STOPTime[STOPCONDITION_ARRAY_SIZE];
 }t_nov_stc;
 extern t_nov_stc STC;
+
+extern DBOOL STOP_Nov_CheckVersion(void);
 // stc log
 typedef struct
 {
@@ -2197,15 +2267,103 @@ typedef struct
 extern t_nov_stc_log STCLog;
 
 extern t_SC_LogLine STOP_GetLog (DU16 STOPIndex);
-extern DBOOL        STOP_GetFlag (DU16 STOPIndex);
+// flag as committed in STC
+static inline DBOOL STOP_GetFlag(DU16 STOPIndex)
+{
+	return ((DBOOL)STOP_SET_TEST(STC.STOPFlag, STOPIndex));
+}
 extern DTIMESTAMP   STOP_GetTime (DU16 STOPIndex);
 
+#if (OPTION_STOP_JOURNAL == TRUE)
+// compressed journal in the NOVRAM space of STCLog (STOP_journal.c)
+// blocks of STOP_JOURNAL_BLOCK_SIZE bytes, each starting at BlockTime; per event 2 bytes
+// (state, time difference 0..14, index), bigger differences follow as varint; a stop condition
+// changing again within STOP_JOURNAL_REPEAT_GAP is counted in one repeat record.
+// The oldest block is overwritten. Time in units of STOP_JOURNAL_TIME_UNIT ms.
+#define STOP_JOURNAL_TIME_UNIT			100
+#define STOP_JOURNAL_BLOCK_SIZE			128
+#define STOP_JOURNAL_BLOCKS				((sizeof(t_nov_stc_log) - 24) / (STOP_JOURNAL_BLOCK_SIZE + 5))	// 24: fields behind the blocks, padding
+#define STOP_JOURNAL_REPEAT_GAP			600			// 60 s
+#define STOP_JOURNAL_NO_POS				0xFF
+
+typedef struct
+{
+	DU32	BlockTime[STOP_JOURNAL_BLOCKS];			// time of the block start
+	DU8		BlockUsed[STOP_JOURNAL_BLOCKS];			// bytes used
+	DU8		Data[STOP_JOURNAL_BLOCKS][STOP_JOURNAL_BLOCK_SIZE];
+	DU16	Newest;									// block written
+	DU16	Count;									// blocks in use
+	DU32	LastTime;								// time of the last change written
+	DU32	RepeatBase;								// time of the event before the repeat record
+	DU16	LastIndex;
+	DBOOL	LastSet;
+	DU8		RepeatPos;								// repeat record in the newest block
+} t_nov_stc_journal;
+extern t_nov_stc_journal STCJournal;
+
+// one decoded event; Repeat: number of further changes up to LastTime
+typedef struct
+{
+	DU32	Time;
+	DU32	LastTime;
+	DU16	SCIndex;
+	DU16	Repeat;
+	DBOOL	Set;
+} t_STOP_journal_event;
+
+typedef struct
+{
+	DU16	Block;
+	DU16	BlocksLeft;								// blocks after Block
+	DU16	Pos;
+	DU32	Time;
+} t_STOP_journal_reader;
+
+extern void  STOP_Journal_Clear(void);
+extern void  STOP_Journal_Check(void);
+extern void  STOP_Journal_Add(DU16 SCIndex, DBOOL Set, DU32 Time);
+extern DBOOL STOP_Journal_Seek(t_STOP_journal_reader *pReader, DU32 Time);
+extern DBOOL STOP_Journal_Read(t_STOP_journal_reader *pReader, t_STOP_journal_event *pEvent);
+#endif
+
 //---------------------------------definitions for logging stop-conditions------------------
 
 extern struct s_commonStopVariables STOP;
+#if (OPTION_STOP_CONST_DESC == TRUE)
+// code, bitmask and level in flash (STOP_desc.c, generated by tools/gen_stop_desc.py from
+// the enum above and STOP_initialize()), only the texts stay in RAM.
+// STOP_SetCode(), STOP_SetLevel(), STOP_SetBitMask() and STOP_SetSC() of the parameterizable
+// messages call STOP_Desc_Override(), STOP_initialize() only sets STOP_Text[].
+typedef struct
+{
+	DU32	Code;
+	DU16	BitMask;
+	DU8		Level;
+} t_STOP_desc;
+
+#define STOP_DESC_MAX_OVERRIDES		64
+
+extern const t_STOP_desc STOP_Desc[STOPCONDITION_ARRAY_SIZE];
+extern DU8* STOP_Text[STOPCONDITION_ARRAY_SIZE];
+extern DU32 STOP_DescOverridden[STOP_SET_WORDS];
+
+extern const t_STOP_desc *STOP_Desc_Get(DU16 SCIndex);
+extern DBOOL STOP_Desc_Override(DU16 SCIndex, DU32 Code, DU8 Level, DU16 BitMask);
+
+#define STOP_DESC_CODE(SCIndex)		(STOP_Desc_Get(SCIndex)->Code)
+#define STOP_DESC_LEVEL(SCIndex)	(STOP_Desc_Get(SCIndex)->Level)
+#define STOP_DESC_BITMASK(SCIndex)	(STOP_Desc_Get(SCIndex)->BitMask)
+#define STOP_DESC_TEXT(SCIndex)		(STOP_Text[SCIndex])
+#else
 extern struct s_OneStopCondition STOPCondition[STOPCONDITION_ARRAY_SIZE];
-extern DBOOL STOP_is_Set( DU16 enum_identifier );
-extern DBOOL STOP_Tripped[STOPCONDITION_ARRAY_SIZE];                     // determines if the SC can be acknowledged
+
+#define STOP_DESC_CODE(SCIndex)		(STOPCondition[SCIndex].Code)
+#define STOP_DESC_LEVEL(SCIndex)	(STOPCondition[SCIndex].Level)
+#define STOP_DESC_BITMASK(SCIndex)	(STOPCondition[SCIndex].BitMask)
+#define STOP_DESC_TEXT(SCIndex)		(STOPCondition[SCIndex].Text)
+#endif
+extern DU32 STOP_TrippedBits[STOP_SET_WORDS];                            /* bitset, determines if the SC can be acknowledged */
+
 extern void STOP_Set( DU16 enum_identifier );                 /* make one Sc active using its code */
 extern void STOP_Clear( DU16 enum_identifier );               /* make one Sc inactive using its code */
 extern void STOP_ClearLevel( DU8 level_of_StopCondition );               /* clear an entier level 0..7 of Sc's */
@@ -2223,8 +2381,250 @@ extern void STOP_UpdateLevelAndBitmask(void);                            /* upda
 
 extern DU16 STOP_Get_Index(DU32 stopcondition_code);
 
-extern DBOOL STOP_GetTripped(DU16 SCIndex);
-extern void  STOP_SetTripped(DU16 SCIndex, DBOOL Set);
+// stop condition code lookup
+// table of (code, index) sorted by code, built after STOP_initialize() (or on first use)
+// STOP_SetCode() invalidates it, STOP_Get_Index() uses STOP_CodeLookup_Find()
+typedef struct
+{
+	DU32	Code;
+	DU16	Index;
+} t_STOP_code_lookup;
+
+extern void  STOP_CodeLookup_Build(void);
+extern void  STOP_CodeLookup_Invalidate(void);
+extern DBOOL STOP_CodeLookup_Find(DU32 stopcondition_code, DU16 *Index);
+
+// word wise queries over a stop condition bitset (STC.STOPFlag, STOP_TrippedBits, ...)
+extern DBOOL STOP_Set_Any(const DU32 *Set, DU16 First, DU16 Last);
+extern DU16  STOP_Set_Count(const DU32 *Set, DU16 First, DU16 Last);
+extern DU16  STOP_Set_Next(const DU32 *Set, DU16 From, DU16 Last);
+
+// incremental aggregation of STOP.actualLevel, actualBitMask and actualIndex
+// STOP_Set()/STOP_Clear() call STOP_Aggr_On()/STOP_Aggr_Off() after the flag in STC.STOPFlag changed,
+// STOP_UpdateLevelAndBitmask() calls STOP_Aggr_Update(), which does nothing if no flag changed.
+// Stop conditions with STOP_BITMASK_ISLAND do not count for actualLevel and actualBitMask.
+#define STOP_NBR_OF_LEVELS				8						// levels 0..7, 0 is the most severe
+#define STOP_LEVEL_NONE					STOP_NBR_OF_LEVELS		// actualLevel without stop condition
+#define STOP_NBR_OF_MASK_BITS			16
+
+typedef struct
+{
+	DU16	LevelCount[STOP_NBR_OF_LEVELS];			// set stop conditions per level
+	DU16	MaskClearCount[STOP_NBR_OF_MASK_BITS];	// set stop conditions with this bit cleared in BitMask
+	DBOOL	Changed;								// a flag changed since the last STOP_Aggr_Update()
+	volatile DBOOL	Rebuild;						// STOP_Aggr_Rebuild() by the next commit of the 20ms task
+	volatile DU16	Commits;						// commits which changed flags, for STOP_Aggr_Check()
+} t_STOP_aggregate;
+
+extern t_STOP_aggregate STOP_Aggr;
+
+extern void  STOP_Aggr_On(DU16 SCIndex);
+extern void  STOP_Aggr_Off(DU16 SCIndex);
+extern void  STOP_Aggr_Rebuild(void);
+extern void  STOP_Aggr_Update(void);
+extern void  STOP_Aggr_Check(void);
+
+// set stop conditions per level (all, also island), kept by STOP_Aggr_On()/STOP_Aggr_Off()
+// STOP_ClearLevel(), STOP_ClearLevels(), STOP_ClearAllLevels(), STOP_ResetAllLevels() and
+// STOP_ClearLevelsWithoutCertianStopCond() call STOP_ClearActive() and only visit set ones
+typedef struct
+{
+	DU32	Active[STOP_NBR_OF_LEVELS][STOP_SET_WORDS];
+	DU16	Count[STOP_NBR_OF_LEVELS];
+} t_STOP_level_sets;
+
+extern t_STOP_level_sets STOP_LevelSet;
+
+extern DU16  STOP_ClearActive(DU8 FirstLevel, DU8 LastLevel, DU16 SCIndexNotClear, DBOOL ClearTripped);
+
+// set stop conditions in priority order (= index order of STOPCondition[])
+// STOP_ActiveSummary has one bit per word of STC.STOPFlag which is not 0
+#define STOP_SUMMARY_WORDS				((STOP_SET_WORDS + 31) / 32)
+
+extern DU32  STOP_ActiveSummary[STOP_SUMMARY_WORDS];
+
+extern DU16  STOP_Active_First(void);
+extern DU16  STOP_Active_Total(void);
+extern DU16  STOP_Active_Page(DU16 From, DU16 *List, DU16 MaxEntries);
+
+// set stop conditions per bitmask bit (bit set in BitMask), kept by STOP_Aggr_On()/STOP_Aggr_Off()
+// STOP_findIndex(RefMask) returns STOP_Bit_First(RefMask)
+typedef struct
+{
+	DU32	Active[STOP_NBR_OF_MASK_BITS][STOP_SET_WORDS];
+	DU32	Summary[STOP_NBR_OF_MASK_BITS][STOP_SUMMARY_WORDS];
+	DU16	Count[STOP_NBR_OF_MASK_BITS];
+} t_STOP_bit_sets;
+
+extern t_STOP_bit_sets STOP_BitSet;
+
+extern DBOOL STOP_Bit_Any(DU16 RefMask);
+extern DU16  STOP_Bit_First(DU16 RefMask);
+
+// changes of one task cycle applied together
+// The task loops bracket their body with STOP_BeginCycle(Task) / STOP_CommitCycle(Task).
+// Inside, STOP_Set()/STOP_Clear() only note the change (STOP_Cycle_Record() returns TRUE),
+// STOP_is_Set() sees the changes noted in the running cycle, STOP_GetFlag() only the last
+// commit. STOP_CommitCycle() writes the net changes with STOP_Set()/STOP_Clear() (flag,
+// time, log line), then updates the aggregate and requests the NOVRAM update once.
+// Each task has its own cycle; the running one is the open cycle of the task with the
+// highest priority, as a preempted task cannot go on before the preempting one is done.
+// STOP_FlushCycle() commits within the cycle, for the readers of STOP.actualLevel/BitMask.
+// Only the 20ms task writes STC.STOPFlag and the aggregate (single writer, the tasks preempt
+// each other and the counters are no atomic operations): the commit of the 100ms and the
+// 1000ms cycle hands the net changes over (HandSet/HandClear, Handed), the next commit of the
+// 20ms task writes them before its own. A task sees its handed over changes in STOP_is_Set(),
+// STOP.actualLevel/BitMask at the latest 20ms later.
+// STOP_SetTripped() of the 100ms and the 1000ms task is noted the same way (PendingTrip/
+// PendingUntrip, HandTrip/HandUntrip), STOP_TrippedBits is written by the 20ms task only.
+#define STOP_CYCLE_TASK_20MS			0
+#define STOP_CYCLE_TASK_100MS			1
+#define STOP_CYCLE_TASK_1000MS			2
+#define STOP_CYCLE_NBR_OF_TASKS			3
+#define STOP_CYCLE_NONE					0xFF
+
+typedef struct
+{
+	DU32	PendingSet[STOP_SET_WORDS];
+	DU32	PendingClear[STOP_SET_WORDS];
+	DU32	PendingTrip[STOP_SET_WORDS];	// STOP_SetTripped() of the 100ms / 1000ms task
+	DU32	PendingUntrip[STOP_SET_WORDS];
+	DU32	HandSet[STOP_SET_WORDS];	// net changes handed over to the 20ms task
+	DU32	HandClear[STOP_SET_WORDS];
+	DU32	HandTrip[STOP_SET_WORDS];
+	DU32	HandUntrip[STOP_SET_WORDS];
+	volatile DBOOL	Handed;				// HandSet/.../HandUntrip not yet written by the 20ms task
+	DBOOL	Open;
+	DBOOL	Committing;
+	DU16	Recorded;					// STOP_Set()/STOP_Clear() calls in the actual cycle
+	DU16	Changes;					// flags changed (20ms) or handed over by the last commit
+} t_STOP_cycle;
+
+extern t_STOP_cycle STOP_Cycle[STOP_CYCLE_NBR_OF_TASKS];
+extern DU8 STOP_CommitTask;				// task whose changes the commit writes, else STOP_CYCLE_NONE
+
+extern void  STOP_BeginCycle(DU8 Task);
+extern DBOOL STOP_Cycle_Record(DU16 SCIndex, DBOOL Set);
+extern DBOOL STOP_Cycle_RecordTripped(DU16 SCIndex, DBOOL Set);
+extern DU16  STOP_CommitCycle(DU8 Task);
+extern DU16  STOP_FlushCycle(DU8 Task);
+
+// task of the running cycle, STOP_CYCLE_NONE outside of the cycles
+static inline DU8 STOP_Cycle_Running(void)
+{
+	DU8 Task;
+
+	for (Task = 0; Task < STOP_CYCLE_NBR_OF_TASKS; Task++)
+	{
+		if (STOP_Cycle[Task].Open)
+			return (Task);
+	}
+	return (STOP_CYCLE_NONE);
+}
+
+// flag including the changes noted in the running cycle
+static inline DBOOL STOP_is_Set(DU16 enum_identifier)
+{
+	DU8 Task = STOP_Cycle_Running();
+
+	if (Task != STOP_CYCLE_NONE)
+	{
+		if (STOP_SET_TEST(STOP_Cycle[Task].PendingSet, enum_identifier))
+			return (TRUE);
+		if (STOP_SET_TEST(STOP_Cycle[Task].PendingClear, enum_identifier))
+			return (FALSE);
+		if (STOP_Cycle[Task].Handed && STOP_SET_TEST(STOP_Cycle[Task].HandSet, enum_identifier))
+			return (TRUE);
+		if (STOP_Cycle[Task].Handed && STOP_SET_TEST(STOP_Cycle[Task].HandClear, enum_identifier))
+			return (FALSE);
+	}
+	return ((DBOOL)STOP_SET_TEST(STC.STOPFlag, enum_identifier));
+}
+
+// tripped bit including the changes noted in the running cycle
+static inline DBOOL STOP_GetTripped(DU16 SCIndex)
+{
+	DU8 Task = STOP_Cycle_Running();
+
+	if ((Task != STOP_CYCLE_NONE) && (Task != STOP_CYCLE_TASK_20MS))
+	{
+		if (STOP_SET_TEST(STOP_Cycle[Task].PendingTrip, SCIndex))
+			return (TRUE);
+		if (STOP_SET_TEST(STOP_Cycle[Task].PendingUntrip, SCIndex))
+			return (FALSE);
+		if (STOP_Cycle[Task].Handed && STOP_SET_TEST(STOP_Cycle[Task].HandTrip, SCIndex))
+			return (TRUE);
+		if (STOP_Cycle[Task].Handed && STOP_SET_TEST(STOP_Cycle[Task].HandUntrip, SCIndex))
+			return (FALSE);
+	}
+	return ((DBOOL)STOP_SET_TEST(STOP_TrippedBits, SCIndex));
+}
+
+// 100ms / 1000ms task: noted for the 20ms commit (single writer of STOP_TrippedBits)
+static inline void STOP_SetTripped(DU16 SCIndex, DBOOL Set)
+{
+	if (STOP_Cycle_RecordTripped(SCIndex, Set))
+		return;
+	STOP_SET_WRITE(STOP_TrippedBits, SCIndex, Set);
+}
+
+// chatter suppression and rate limit of the log lines
+// STOP_Set()/STOP_Clear() write a line into STCLog only if STOP_Log_Request() returns TRUE.
+// A stop condition which changes STOP_Chatter.Toggles times within STOP_Chatter.Window seconds
+// is chattering: its lines are suppressed and STOPCONDITIONS_control_1000ms() writes one
+// record with the number of changes per hold-off time (STOP_Chatter_GetRecord()).
+// Not more than STOP_Chatter.MaxLogPerMinute lines per minute are written.
+// The flags themselves are always set and cleared, only the logging is reduced.
+#define STOP_CHATTER_SLOTS				16			// stop conditions watched at the same time
+#define STOP_CHATTER_RECORDS			8			// queue of aggregated records
+#define STOP_CHATTER_WINDOW				10			// s
+#define STOP_CHATTER_TOGGLES			6			// changes within the window
+#define STOP_CHATTER_HOLD_OFF			60			// s
+#define STOP_LOG_MAX_PER_MINUTE			30
+
+typedef struct
+{
+	DU16	SCIndex;
+	DU16	Toggles;					// changes in the window / suppressed changes
+	DU16	Timer;						// s since the first change in the window / the last record
+	DU16	Quiet;						// s since the last change
+	DBOOL	Chattering;
+	DBOOL	Used;
+} t_STOP_chatter_slot;
+
+typedef struct
+{
+	DU16	SCIndex;
+	DU16	Toggles;					// suppressed changes
+	DBOOL	Set;						// state after the last change
+} t_STOP_chatter_record;
+
+typedef struct
+{
+	// settings
+	DU16	Window;
+	DU16	Toggles;
+	DU16	HoldOff;
+	DU16	MaxLogPerMinute;
+
+	// statistics
+	DU16	LogThisMinute;
+	DU16	MinuteTimer;
+	DU32	Suppressed;					// lines suppressed by chatter detection
+	DU32	Dropped;					// lines dropped by the rate limit
+
+	t_STOP_chatter_slot		Slot[STOP_CHATTER_SLOTS];
+	t_STOP_chatter_record	Record[STOP_CHATTER_RECORDS];
+	DU8		RecordIn;
+	DU8		RecordOut;
+} t_STOP_chatter;
+
+extern t_STOP_chatter STOP_Chatter;
+
+extern void  STOP_Chatter_init(void);
+extern DBOOL STOP_Log_Request(DU16 SCIndex);
+extern void  STOP_Chatter_control_1000ms(void);
+extern DBOOL STOP_Chatter_GetRecord(t_STOP_chatter_record *pRecord);
 extern DU32  STOP_GetCode(DU16 SCIndex);
 extern void  STOP_SetCode(DU16 SCIndex, DU32 Code);
 extern DU8   STOP_GetLevel(DU16 SCIndex);
@@ -2271,56 +2671,64 @@ extern void  STOP_SetSC(DU16 SCIndex, struct s_OneStopCondition SC);
 #define SC_BIT30   0x40000000
 #define SC_BIT31   0x80000000
 
+// protections switched off in CONFIG_GRID_PROT / CONFIG_GEN_PROT, one bit per stop condition,
+// built on parameter change by STOP_ProtEnable_Update() (STOP_ext.c); 0: enabled
+extern DU32 STOP_ProtDisabled[STOP_SET_WORDS];
+#define STOP_ProtEnable(enum_identifier)	((DBOOL)!STOP_SET_TEST(STOP_ProtDisabled, enum_identifier))
+
+extern void  STOP_ProtEnable_init(void);
+extern void  STOP_ProtEnable_Update(void);
+
 // GRID_PROTECTION
 #define NBR_CONFIG_GRID_PROT	25
-#define SC_ENABLE_30674         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT0 ))
-#define SC_ENABLE_30675         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT1 ))
-#define SC_ENABLE_30671         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT2 ))
-#define SC_ENABLE_30672         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT3 ))
-#define SC_ENABLE_30673         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT4 ))
-#define SC_ENABLE_30670         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT5 ))
-#define SC_ENABLE_30667         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT6 ))
-#define SC_ENABLE_30668         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT7 ))
-#define SC_ENABLE_30665         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT8 ))
-#define SC_ENABLE_30666         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT9 ))
-#define SC_ENABLE_30661         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT10))
-#define SC_ENABLE_30660         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT11))
-#define SC_ENABLE_30676         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT12))
-#define SC_ENABLE_30677         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT13))
-#define SC_ENABLE_30669         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT14))
-#define SC_ENABLE_30663         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT15))
-#define SC_ENABLE_30664         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT16))
-#define SC_ENABLE_30657         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT17))
-#define SC_ENABLE_30662         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT18))
-#define SC_ENABLE_30654         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT19))
-#define SC_ENABLE_30655         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT20))
-#define SC_ENABLE_30651         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT21))
-#define SC_ENABLE_30652         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT22))
-#define SC_ENABLE_30653         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT23))
-#define SC_ENABLE_30650         (TRUE && (PARA[ParRefInd[CONFIG_GRID_PROT__PARREFIND]].Value & SC_BIT24))
+#define SC_ENABLE_30674         STOP_ProtEnable(STOPCONDITION_30674)
+#define SC_ENABLE_30675         STOP_ProtEnable(STOPCONDITION_30675)
+#define SC_ENABLE_30671         STOP_ProtEnable(STOPCONDITION_30671)
+#define SC_ENABLE_30672         STOP_ProtEnable(STOPCONDITION_30672)
+#define SC_ENABLE_30673         STOP_ProtEnable(STOPCONDITION_30673)
+#define SC_ENABLE_30670         STOP_ProtEnable(STOPCONDITION_30670)
+#define SC_ENABLE_30667         STOP_ProtEnable(STOPCONDITION_30667)
+#define SC_ENABLE_30668         STOP_ProtEnable(STOPCONDITION_30668)
+#define SC_ENABLE_30665         STOP_ProtEnable(STOPCONDITION_30665)
+#define SC_ENABLE_30666         STOP_ProtEnable(STOPCONDITION_30666)
+#define SC_ENABLE_30661         STOP_ProtEnable(STOPCONDITION_30661)
+#define SC_ENABLE_30660         STOP_ProtEnable(STOPCONDITION_30660)
+#define SC_ENABLE_30676         STOP_ProtEnable(STOPCONDITION_30676)
+#define SC_ENABLE_30677         STOP_ProtEnable(STOPCONDITION_30677)
+#define SC_ENABLE_30669         STOP_ProtEnable(STOPCONDITION_30669)
+#define SC_ENABLE_30663         STOP_ProtEnable(STOPCONDITION_30663)
+#define SC_ENABLE_30664         STOP_ProtEnable(STOPCONDITION_30664)
+#define SC_ENABLE_30657         STOP_ProtEnable(STOPCONDITION_30657)
+#define SC_ENABLE_30662         STOP_ProtEnable(STOPCONDITION_30662)
+#define SC_ENABLE_30654         STOP_ProtEnable(STOPCONDITION_30654)
+#define SC_ENABLE_30655         STOP_ProtEnable(STOPCONDITION_30655)
+#define SC_ENABLE_30651         STOP_ProtEnable(STOPCONDITION_30651)
+#define SC_ENABLE_30652         STOP_ProtEnable(STOPCONDITION_30652)
+#define SC_ENABLE_30653         STOP_ProtEnable(STOPCONDITION_30653)
+#define SC_ENABLE_30650         STOP_ProtEnable(STOPCONDITION_30650)
 
 // GEN_PROTECTION
 #define NBR_CONFIG_GEN_PROT		20
-#define SC_ENABLE_20503         (TRUE && (PARA[ParRefInd[CONFIG_GEN_PROT__PARREFIND ]].Value & SC_BIT0 ))
-#define SC_ENABLE_20502         (TRUE && (PARA[ParRefInd[CONFIG_GEN_PROT__PARREFIND ]].Value & SC_BIT1 ))
-#define SC_ENABLE_20506         (TRUE && (PARA[ParRefInd[CONFIG_GEN_PROT__PARREFIND ]].Value & SC_BIT2 ))
-#define SC_ENABLE_20504         (TRUE && (PARA[ParRefInd[CONFIG_GEN_PROT__PARREFIND ]].Value & SC_BIT3 ))
-#define SC_ENABLE_20505         (TRUE && (PARA[ParRefInd[CONFIG_GEN_PROT__PARREFIND ]].Value & SC_BIT4 ))
-#define SC_ENABLE_30634         (TRUE && (PARA[ParRefInd[CONFIG_GEN_PROT__PARREFIND ]].Value & SC_BIT5 ))
-#define SC_ENABLE_30635         (TRUE && (PARA[ParRefInd[CONFIG_GEN_PROT__PARREFIND ]].Value & SC_BIT6 ))
-#define SC_ENABLE_30636         (TRUE && (PARA[ParRefInd[CONFIG_GEN_PROT__PARREFIND ]].Value & SC_BIT7 ))
-#define SC_ENABLE_30678         (TRUE && (PARA[ParRefInd[CONFIG_GEN_PROT__PARREFIND ]].Value & SC_BIT8 ))
-#define SC_ENABLE_30656         (TRUE && (PARA[ParRefInd[CONFIG_GEN_PROT__PARREFIND ]].Value & SC_BIT9 ))
-#define SC_ENABLE_30630         (TRUE && (PARA[ParRefInd[CONFIG_GEN_PROT__PARREFIND ]].Value & SC_BIT10))
-#define SC_ENABLE_30631         (TRUE && (PARA[ParRefInd[CONFIG_GEN_PROT__PARREFIND ]].Value & SC_BIT11))
-#define SC_ENABLE_50070         (TRUE && (PARA[ParRefInd[CONFIG_GEN_PROT__PARREFIND ]].Value & SC_BIT12))
-#define SC_ENABLE_30638         (TRUE && (PARA[ParRefInd[CONFIG_GEN_PROT__PARREFIND ]].Value & SC_BIT13))
-#define SC_ENABLE_30639         (TRUE && (PARA[ParRefInd[CONFIG_GEN_PROT__PARREFIND ]].Value & SC_BIT14))
-#define SC_ENABLE_30632         (TRUE && (PARA[ParRefInd[CONFIG_GEN_PROT__PARREFIND ]].Value & SC_BIT15))
-#define SC_ENABLE_30633         (TRUE && (PARA[ParRefInd[CONFIG_GEN_PROT__PARREFIND ]].Value & SC_BIT16))
-#define SC_ENABLE_70680         (TRUE && (PARA[ParRefInd[CONFIG_GEN_PROT__PARREFIND ]].Value & SC_BIT17))
-#define SC_ENABLE_50680         (TRUE && (PARA[ParRefInd[CONFIG_GEN_PROT__PARREFIND ]].Value & SC_BIT18))
-#define SC_ENABLE_50679         (TRUE && (PARA[ParRefInd[CONFIG_GEN_PROT__PARREFIND ]].Value & SC_BIT19))
+#define SC_ENABLE_20503         STOP_ProtEnable(STOPCONDITION_20503)
+#define SC_ENABLE_20502         STOP_ProtEnable(STOPCONDITION_20502)
+#define SC_ENABLE_20506         STOP_ProtEnable(STOPCONDITION_20506)
+#define SC_ENABLE_20504         STOP_ProtEnable(STOPCONDITION_20504)
+#define SC_ENABLE_20505         STOP_ProtEnable(STOPCONDITION_20505)
+#define SC_ENABLE_30634         STOP_ProtEnable(STOPCONDITION_30634)
+#define SC_ENABLE_30635         STOP_ProtEnable(STOPCONDITION_30635)
+#define SC_ENABLE_30636         STOP_ProtEnable(STOPCONDITION_30636)
+#define SC_ENABLE_30678         STOP_ProtEnable(STOPCONDITION_30678)
+#define SC_ENABLE_30656         STOP_ProtEnable(STOPCONDITION_30656)
+#define SC_ENABLE_30630         STOP_ProtEnable(STOPCONDITION_30630)
+#define SC_ENABLE_30631         STOP_ProtEnable(STOPCONDITION_30631)
+#define SC_ENABLE_50070         STOP_ProtEnable(STOPCONDITION_50070)
+#define SC_ENABLE_30638         STOP_ProtEnable(STOPCONDITION_30638)
+#define SC_ENABLE_30639         STOP_ProtEnable(STOPCONDITION_30639)
+#define SC_ENABLE_30632         STOP_ProtEnable(STOPCONDITION_30632)
+#define SC_ENABLE_30633         STOP_ProtEnable(STOPCONDITION_30633)
+#define SC_ENABLE_70680         STOP_ProtEnable(STOPCONDITION_70680)
+#define SC_ENABLE_50680         STOP_ProtEnable(STOPCONDITION_50680)
+#define SC_ENABLE_50679         STOP_ProtEnable(STOPCONDITION_50679)
 
 extern DU16 STOP_GetSC_ConfigElProt( DU16 RefInd, DU8 cnt);
 
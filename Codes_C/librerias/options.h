@@ -11,6 +11,22 @@
 // if develop version, set DEVELOP here to TRUE
 #define DEVELOP FALSE
 
+// packed parameter image with bit width per parameter (PAR_desc.c)
+#define OPTION_PAR_PACKED           FALSE
+
+// parameter access counters per task, instrumentation build only (PAR_ext.c)
+#define OPTION_PAR_PROFILER         FALSE
+
+// const stop condition descriptors in flash (STOP_desc.c, tools/gen_stop_desc.py)
+#define OPTION_STOP_CONST_DESC      FALSE
+
+// compressed stop condition journal instead of STCLog (STOP_journal.c), holds 2.3 to 6.6 times
+// the changes of STCLog (tools/bench_stop_journal.c), not the 10 times asked for
+#define OPTION_STOP_JOURNAL         FALSE
+
+// trip latency histograms per stop condition, instrumentation build only (LAT.c)
+#define OPTION_TRIP_LATENCY         FALSE
+
 // define client-version here
 #define DEIF       		1
 #define IET        		2
@@ -0,0 +1,243 @@
+/**
+ * @file bench_cyl.c
+ * @ingroup Tools
+ * Host check and benchmark of the one pass cylinder supervision (CYL_Supervision)
+ *
+ * @remarks
+ * Random temperatures (some with sensor error -32768), assignments and limits of the
+ * CYL_NBR_OF_CYLINDERS cylinders are given to CYL_Supervision() and to a supervision
+ * per cylinder and protection (the loops of CYL_control_100ms() before). The averages,
+ * the filtered averages, TMax, the number of valid cylinders and the Exceeded of every
+ * protection (CYL_EXCEEDED()) have to be equal, the times of BENCH_CYCLES calls of
+ * each are printed. Build it with -DCYL_NBR_OF_CYLINDERS=24 for 24 cylinders.
+ *
+ * Build on the host together with the objects of the host simulation (CYL.c, CYL_ext.c
+ * and their stubs), e.g.
+ *     gcc -O2 -I. -Ilibrerias <simulation includes> tools/bench_cyl.c <objects> -o bench_cyl
+ * The exit code is the number of differences.
+ *
+ * @date 17-oct-2026
+ *
+ * changes:
+ *      17.10.2026      first version
+ *      17.10.2026      limits in CYL.Prot[], 24 cylinders
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "options.h"
+#include "deif_types.h"
+#include "appl_types.h"
+
+#include "CYL.h"
+
+#define BENCH_STEPS			20000
+#define BENCH_CYCLES		200000
+
+static DU32 Seed = 1;
+static volatile DS32 Sink;
+
+// results of the supervision per cylinder
+typedef struct
+{
+	DS16	AverageA;
+	DS16	AverageB;
+	DS16	FilteredA;
+	DS16	FilteredB;
+	DS16	CylinderAverage;
+	DS16	TMax;
+	DU8		CountA;
+	DU8		CountB;
+	DBOOL	Exceeded[CYL_NBR_OF_CYLINDERS][CYL_NBR_OF_SUPERVISIONS];
+} t_reference;
+
+static t_reference Reference;
+
+// last averages of each side for the filtered value
+static DS16 History[2][CYL_NUMBER_OF_AVERAGE_VALUES_FOR_FILTERING];
+static DU8 HistoryCount[2];
+
+
+static DU16 Random(DU16 Range)
+{
+	Seed = Seed * 1103515245UL + 12345UL;
+	return ((DU16)((Seed >> 8) % Range));
+}
+
+static DS16 Temperature(DU8 i)
+{
+	return ((i < CYL_NBR_OF_CYLINDERS_A) ? CYL.TempA[i].Value : CYL.TempB[i - CYL_NBR_OF_CYLINDERS_A].Value);
+}
+
+// mean of the last averages of Side, shifted through the history
+static void Filter(DU8 Side, DS16 Average, DS16 *pFiltered)
+{
+	DS32 Sum = 0L;
+	DU8 k;
+
+	if (Average == -32768)
+		return;
+
+	for (k = CYL_NUMBER_OF_AVERAGE_VALUES_FOR_FILTERING - 1; k > 0; k--)
+		History[Side][k] = History[Side][k - 1];
+	History[Side][0] = Average;
+	if (HistoryCount[Side] < CYL_NUMBER_OF_AVERAGE_VALUES_FOR_FILTERING)
+		HistoryCount[Side]++;
+
+	for (k = 0; k < HistoryCount[Side]; k++)
+		Sum += History[Side][k];
+	*pFiltered = (DS16)(Sum / HistoryCount[Side]);
+}
+
+// one side cylinder by cylinder, First..First+Count-1
+static DS16 PerCylinderSide(DU8 First, DU8 Count, DU8 *pCount, DS16 *pMax, DS32 *pSum)
+{
+	DS32 Sum = 0L;
+	DS16 Average = -32768;
+	DS16 T;
+	DU8 Number = 0;
+	DU8 i;
+
+	for (i = First; i < (First + Count); i++)
+	{
+		T = Temperature(i);
+		if (!((CYL.Assigned >> i) & 1) || (T == -32768))
+			continue;
+		Sum += T;
+		Number++;
+		if (T > *pMax)
+			*pMax = T;
+	}
+	if (Number)
+		Average = (DS16)(Sum / Number);
+
+	for (i = First; i < (First + Count); i++)
+	{
+		T = Temperature(i);
+		memset(Reference.Exceeded[i], 0, sizeof(Reference.Exceeded[i]));
+		if (!((CYL.Assigned >> i) & 1) || (T == -32768))
+			continue;
+
+		Reference.Exceeded[i][CYL_OVERTEMP_STOP] = (T > CYL.Prot[CYL_OVERTEMP_STOP].Limit[i]);
+		Reference.Exceeded[i][CYL_OVERTEMP]      = (T > CYL.Prot[CYL_OVERTEMP].Limit[i]);
+		Reference.Exceeded[i][CYL_UNDERTEMP]     = (T < CYL.Prot[CYL_UNDERTEMP].Limit[i]);
+		if (Number)
+			Reference.Exceeded[i][CYL_AVR_DEVIATION] = (((T > Average) ? (T - Average) : (Average - T)) > CYL.Prot[CYL_AVR_DEVIATION].Limit[i]);
+	}
+
+	*pCount = Number;
+	*pSum   = Sum;
+	return (Average);
+}
+
+static void PerCylinder(void)
+{
+	DS32 SumA, SumB;
+
+	Reference.TMax     = -32768;
+	Reference.AverageA = PerCylinderSide(CYL_FIRST_A, CYL_NBR_OF_CYLINDERS_A, &Reference.CountA, &Reference.TMax, &SumA);
+	Reference.AverageB = PerCylinderSide(CYL_FIRST_B, CYL_NBR_OF_CYLINDERS_B, &Reference.CountB, &Reference.TMax, &SumB);
+	Filter(0, Reference.AverageA, &Reference.FilteredA);
+	Filter(1, Reference.AverageB, &Reference.FilteredB);
+
+	if (Reference.CountA + Reference.CountB)
+		Reference.CylinderAverage = (DS16)((SumA + SumB) / (Reference.CountA + Reference.CountB));
+	else
+		Reference.CylinderAverage = -32768;
+}
+
+static DU32 Compare(void)
+{
+	DU32 Differences = 0;
+	DU8 i, s;
+
+	Differences += (Reference.AverageA != CYL.TxxxAverageA);
+	Differences += (Reference.AverageB != CYL.TxxxAverageB);
+	Differences += (Reference.FilteredA != CYL.TxxxAverageAFilteredValue);
+	Differences += (Reference.FilteredB != CYL.TxxxAverageBFilteredValue);
+	Differences += (Reference.CylinderAverage != CYL.CylinderAverageTemp);
+	Differences += (Reference.CountA != CYL.NumberOfAssignedCylindersA);
+	Differences += (Reference.CountB != CYL.NumberOfAssignedCylindersB);
+	Differences += ((Reference.CountA + Reference.CountB) && (Reference.TMax != CYL.TMax));
+
+	for (i = 0; i < CYL_NBR_OF_CYLINDERS; i++)
+	{
+		for (s = 0; s < CYL_NBR_OF_SUPERVISIONS; s++)
+			Differences += (Reference.Exceeded[i][s] != CYL_EXCEEDED(i, s));
+	}
+	return (Differences);
+}
+
+// new temperatures, assignment and limits
+static void Inputs(void)
+{
+	DS16 T;
+	DU8 i;
+
+	CYL.Assigned = (Random(10) == 0) ? 0 : (((DU32)Random(0x8000) << 15) | Random(0x8000) | 0xFFF0F);
+
+	for (i = 0; i < CYL_NBR_OF_CYLINDERS; i++)
+	{
+		T = (Random(50) == 0) ? -32768 : (DS16)(3000 + Random(3000));
+		if (i < CYL_NBR_OF_CYLINDERS_A)
+			CYL.TempA[i].Value = T;
+		else
+			CYL.TempB[i - CYL_NBR_OF_CYLINDERS_A].Value = T;
+
+		CYL.Prot[CYL_OVERTEMP_STOP].Limit[i] = (DS16)(5500 + Random(200));
+		CYL.Prot[CYL_OVERTEMP].Limit[i]      = (DS16)(5000 + Random(200));
+		CYL.Prot[CYL_UNDERTEMP].Limit[i]     = (DS16)(3200 + Random(200));
+		CYL.Prot[CYL_AVR_DEVIATION].Limit[i] = (DS16)(600 + Random(400));
+	}
+}
+
+static double Seconds(clock_t Start)
+{
+	return ((double)(clock() - Start) / CLOCKS_PER_SEC);
+}
+
+int main(void)
+{
+	DU32 Differences = 0;
+	DU32 Step;
+	clock_t Start;
+	double TimeReference, TimeSupervision;
+
+	memset(&CYL, 0, sizeof(CYL));
+
+	for (Step = 0; Step < BENCH_STEPS; Step++)
+	{
+		Inputs();
+		PerCylinder();
+		CYL_Supervision();
+		Differences += Compare();
+	}
+	printf("\n %u cylinders, %lu steps, %lu differences", (unsigned)CYL_NBR_OF_CYLINDERS,
+		   (unsigned long)BENCH_STEPS, (unsigned long)Differences);
+
+	Start = clock();
+	for (Step = 0; Step < BENCH_CYCLES; Step++)
+	{
+		CYL.TempA[Step % CYL_NBR_OF_CYLINDERS_A].Value ^= 1;
+		PerCylinder();
+		Sink += Reference.AverageA;
+	}
+	TimeReference = Seconds(Start);
+
+	Start = clock();
+	for (Step = 0; Step < BENCH_CYCLES; Step++)
+	{
+		CYL.TempA[Step % CYL_NBR_OF_CYLINDERS_A].Value ^= 1;
+		CYL_Supervision();
+		Sink += CYL.TxxxAverageA;
+	}
+	TimeSupervision = Seconds(Start);
+
+	printf("\n per call: per cylinder %7.3f us  one pass %7.3f us\n",
+		   TimeReference * 1e6 / BENCH_CYCLES, TimeSupervision * 1e6 / BENCH_CYCLES);
+
+	return ((int)Differences);
+}
@@ -0,0 +1,141 @@
+/**
+ * @file bench_lookup.c
+ * @ingroup Tools
+ * Host check and benchmark of the parameter id and stop condition code lookup
+ *
+ * @remarks
+ * Looks up every parameter id and every stop condition code once with a linear search
+ * (the search PAR_Get_Index()/STOP_Get_Index() did before) and with PAR_IdLookup_Find()/
+ * STOP_CodeLookup_Find(), counts the results which differ and prints the time of
+ * BENCH_ROUNDS bulk lookups of each.
+ *
+ * Build on the host together with the objects of the host simulation (PAR.c,
+ * STOPCONDITIONS.c, PAR_ext.c, PAR_desc.c, STOP_ext.c, STOP_desc.c and their stubs), e.g.
+ *     gcc -O2 -I. -Ilibrerias <simulation includes> tools/bench_lookup.c <objects> -o bench_lookup
+ * The exit code is the number of differences.
+ *
+ * @date 17-oct-2026
+ *
+ * changes:
+ *      17.10.2026      first version
+ *
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#include "options.h"
+#include "deif_types.h"
+#include "appl_types.h"
+
+#include "PAR.h"
+#include "STOPCONDITIONS.h"
+
+#define BENCH_ROUNDS		100
+#define NOT_FOUND			0xFFFF
+
+static volatile DU32 Sink;
+
+
+// linear search over PARA[], lowest index first
+static DU16 Linear_ParIndex(DU16 Id)
+{
+	DU16 Index;
+
+	for (Index = 0; Index < NBR_OF_PARA; Index++)
+	{
+		if (PAR_GetId(PAR_GetRefInd(Index)) == Id)
+			return (Index);
+	}
+	return (NOT_FOUND);
+}
+
+// linear search over the stop conditions, lowest index first
+static DU16 Linear_StopIndex(DU32 Code)
+{
+	DU16 i;
+
+	for (i = 0; i < STOPCONDITION_ARRAY_SIZE; i++)
+	{
+		if (STOP_GetCode(i) == Code)
+			return (i);
+	}
+	return (NOT_FOUND);
+}
+
+static DU16 Lookup_ParIndex(DU16 Id)
+{
+	DU16 Index;
+
+	return (PAR_IdLookup_Find(Id, &Index) ? Index : NOT_FOUND);
+}
+
+static DU16 Lookup_StopIndex(DU32 Code)
+{
+	DU16 Index;
+
+	return (STOP_CodeLookup_Find(Code, &Index) ? Index : NOT_FOUND);
+}
+
+static double Seconds(clock_t Start)
+{
+	return ((double)(clock() - Start) / CLOCKS_PER_SEC);
+}
+
+int main(void)
+{
+	static DU16 Id[NBR_OF_PARA];
+	static DU32 Code[STOPCONDITION_ARRAY_SIZE];
+	DU32 Differences = 0;
+	DU16 i, r;
+	clock_t Start;
+	double Linear, Lookup;
+
+	PAR_init();
+	STOP_initialize();
+
+	for (i = 0; i < NBR_OF_PARA; i++)
+		Id[i] = PAR_GetId(PAR_GetRefInd(i));
+	for (i = 0; i < STOPCONDITION_ARRAY_SIZE; i++)
+		Code[i] = STOP_GetCode(i);
+
+	PAR_IdLookup_Build();
+	STOP_CodeLookup_Build();
+
+	// same result for every id and code, and for ones which do not exist
+	for (i = 0; i < NBR_OF_PARA; i++)
+		Differences += (Linear_ParIndex(Id[i]) != Lookup_ParIndex(Id[i]));
+	Differences += (Linear_ParIndex(0xFFFF) != Lookup_ParIndex(0xFFFF));
+	for (i = 0; i < STOPCONDITION_ARRAY_SIZE; i++)
+		Differences += (Linear_StopIndex(Code[i]) != Lookup_StopIndex(Code[i]));
+	Differences += (Linear_StopIndex(0xFFFFFFFFUL) != Lookup_StopIndex(0xFFFFFFFFUL));
+
+	printf("\n %u parameters, %u stop conditions, %lu differences", (unsigned)NBR_OF_PARA,
+		   (unsigned)STOPCONDITION_ARRAY_SIZE, (unsigned long)Differences);
+
+	Start = clock();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+		for (i = 0; i < NBR_OF_PARA; i++)
+			Sink += Linear_ParIndex(Id[i]);
+	Linear = Seconds(Start);
+	Start = clock();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+		for (i = 0; i < NBR_OF_PARA; i++)
+			Sink += Lookup_ParIndex(Id[i]);
+	Lookup = Seconds(Start);
+	printf("\n all parameter ids x %u:      linear %8.3f s  lookup %8.4f s", BENCH_ROUNDS, Linear, Lookup);
+
+	Start = clock();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+		for (i = 0; i < STOPCONDITION_ARRAY_SIZE; i++)
+			Sink += Linear_StopIndex(Code[i]);
+	Linear = Seconds(Start);
+	Start = clock();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+		for (i = 0; i < STOPCONDITION_ARRAY_SIZE; i++)
+			Sink += Lookup_StopIndex(Code[i]);
+	Lookup = Seconds(Start);
+	printf("\n all stop condition codes x %u: linear %8.3f s  lookup %8.4f s\n", BENCH_ROUNDS, Linear, Lookup);
+
+	return ((int)Differences);
+}
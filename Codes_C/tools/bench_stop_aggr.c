@@ -0,0 +1,174 @@
+/**
+ * @file bench_stop_aggr.c
+ * @ingroup Tools
+ * Host check and benchmark of the incremental level and bitmask aggregation (STOP_Aggr)
+ *
+ * @remarks
+ * Random sequences of set and clear, with STOP_Aggr_On() of flags already set and
+ * STOP_Aggr_Off() of flags already clear in between, are applied like STOP_Set()/
+ * STOP_Clear() do. After each step STOP.actualLevel and STOP.actualBitMask of
+ * STOP_Aggr_Update() have to be equal to a scan over all stop conditions (the former
+ * STOP_UpdateLevelAndBitmask()). Then the time per cycle of the scan and of
+ * STOP_Aggr_Update() is printed for 0, 10 and 200 set stop conditions.
+ *
+ * Build on the host together with the objects of the host simulation (STOPCONDITIONS.c,
+ * STOP_ext.c, STOP_desc.c and their stubs), e.g.
+ *     gcc -O2 -I. -Ilibrerias <simulation includes> tools/bench_stop_aggr.c <objects> -o bench_stop_aggr
+ * The exit code is the number of differences.
+ *
+ * @date 17-oct-2026
+ *
+ * changes:
+ *      17.10.2026      first version
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "options.h"
+#include "deif_types.h"
+#include "appl_types.h"
+
+#include "STOPCONDITIONS.h"
+
+#define BENCH_STEPS			20000
+#define BENCH_CYCLES		20000
+
+static DU32 Seed = 1;
+static volatile DU32 Sink;
+
+
+static DU16 Random(DU16 Range)
+{
+	Seed = Seed * 1103515245UL + 12345UL;
+	return ((DU16)((Seed >> 8) % Range));
+}
+
+// like STOP_Set()/STOP_Clear(): flag first, then the aggregate on a change
+static void Write(DU16 SCIndex, DBOOL Set)
+{
+	DBOOL Was = STOP_GetFlag(SCIndex);
+
+	STOP_SET_WRITE(STC.STOPFlag, SCIndex, Set);
+	if (Set && !Was)
+		STOP_Aggr_On(SCIndex);
+	else if (!Set && Was)
+		STOP_Aggr_Off(SCIndex);
+}
+
+// level and bitmask by a scan over all stop conditions
+static void Scan(DU8 *pLevel, DU16 *pMask)
+{
+	DU16 i;
+	DU8 Level = STOP_LEVEL_NONE;
+	DU16 Mask = 0xFFFF;
+
+	for (i = 0; i < STOPCONDITION_ARRAY_SIZE; i++)
+	{
+		if (!STOP_GetFlag(i) || (STOP_DESC_BITMASK(i) & STOP_BITMASK_ISLAND))
+			continue;
+		if (STOP_DESC_LEVEL(i) < Level)
+			Level = (STOP_DESC_LEVEL(i) < STOP_NBR_OF_LEVELS) ? STOP_DESC_LEVEL(i) : (STOP_NBR_OF_LEVELS - 1);
+		Mask &= STOP_DESC_BITMASK(i);
+	}
+	*pLevel = Level;
+	*pMask  = Mask;
+}
+
+static double Seconds(clock_t Start)
+{
+	return ((double)(clock() - Start) / CLOCKS_PER_SEC);
+}
+
+int main(void)
+{
+	static const DU16 Active[] = { 0, 10, 200 };
+	DU32 Differences = 0;
+	DU32 Step;
+	DU16 SCIndex;
+	DU16 Mask;
+	DU8 Level;
+	DU8 a;
+	clock_t Start;
+	double TimeScan, TimeAggr, TimeIdle;
+
+	STOP_initialize();
+	memset(STC.STOPFlag, 0, sizeof(STC.STOPFlag));
+	STOP_Aggr_Rebuild();
+
+	for (Step = 0; Step < BENCH_STEPS; Step++)
+	{
+		SCIndex = Random(STOPCONDITION_ARRAY_SIZE);
+		switch (Random(4))
+		{
+			case 0:  STOP_Aggr_On(SCIndex);		// no change of the counters if set
+					 if (!STOP_GetFlag(SCIndex))
+						 STOP_Aggr_Off(SCIndex);
+					 break;
+			case 1:  if (!STOP_GetFlag(SCIndex))
+						 STOP_Aggr_Off(SCIndex);	// not counted: nothing to do
+					 Write(SCIndex, FALSE);
+					 break;
+			default: Write(SCIndex, Random(3) != 0);
+					 break;
+		}
+
+		STOP_Aggr_Update();
+		Scan(&Level, &Mask);
+		if ((Level != STOP.actualLevel) || (Mask != STOP.actualBitMask))
+			Differences++;
+	}
+	printf("\n %lu steps, %u stop conditions, %lu differences", (unsigned long)BENCH_STEPS,
+		   (unsigned)STOPCONDITION_ARRAY_SIZE, (unsigned long)Differences);
+
+	for (a = 0; a < (sizeof(Active) / sizeof(Active[0])); a++)
+	{
+		memset(STC.STOPFlag, 0, sizeof(STC.STOPFlag));
+		STOP_Aggr_Rebuild();
+		while (STOP_Set_Count(STC.STOPFlag, 0, STOPCONDITION_ARRAY_SIZE - 1) < Active[a])
+			Write(Random(STOPCONDITION_ARRAY_SIZE), TRUE);
+
+		Start = clock();
+		for (Step = 0; Step < BENCH_CYCLES; Step++)
+		{
+			Scan(&Level, &Mask);
+			Sink += Level + Mask;
+		}
+		TimeScan = Seconds(Start);
+
+		// one change per cycle
+		Start = clock();
+		for (Step = 0; Step < BENCH_CYCLES; Step++)
+		{
+			SCIndex = STOP_Set_Next(STC.STOPFlag, 0, STOPCONDITION_ARRAY_SIZE - 1);
+			if (SCIndex != STOP_NO_INDEX)
+			{
+				Write(SCIndex, FALSE);
+				Write(SCIndex, TRUE);
+			}
+			else
+				STOP_Aggr.Changed = TRUE;
+			STOP_Aggr_Update();
+			Sink += STOP.actualLevel;
+		}
+		TimeAggr = Seconds(Start);
+
+		// no change
+		Start = clock();
+		for (Step = 0; Step < BENCH_CYCLES; Step++)
+		{
+			STOP_Aggr_Update();
+			Sink += STOP.actualLevel;
+		}
+		TimeIdle = Seconds(Start);
+
+		printf("\n %3u set: scan %7.3f us  aggregate %7.3f us (changed), %7.3f us (unchanged) per cycle",
+			   (unsigned)Active[a], TimeScan * 1e6 / BENCH_CYCLES, TimeAggr * 1e6 / BENCH_CYCLES,
+			   TimeIdle * 1e6 / BENCH_CYCLES);
+	}
+	printf("\n");
+
+	return ((int)Differences);
+}
@@ -0,0 +1,233 @@
+/**
+ * @file bench_stop_journal.c
+ * @ingroup Tools
+ * Host check of the compressed stop condition journal (STOP_journal.c, OPTION_STOP_JOURNAL)
+ *
+ * @remarks
+ * Three sequences of BENCH_STEPS changes are written with STOP_Journal_Add():
+ *   uniform  any stop condition, 40 % of the changes followed by a change of the same one
+ *            at once, else 0..10 s later
+ *   plant    60 % one of BENCH_NOISY stop conditions (sensor near a limit), 25 % one of a
+ *            group of 24 neighbours (cylinders), 15 % any stop condition, 0..5 s apart
+ *   trips    2..8 stop conditions (half of them neighbours) set in the same 20ms cycle and
+ *            cleared together by the acknowledge 10..60 s later, in between one of
+ *            BENCH_NOISY stop conditions changing 0..1.5 s apart
+ * Then the journal is read from the oldest block: the events and their repeats have to be
+ * the newest changes written, in order and with their time, and STOP_Journal_Seek() has to
+ * find the first event of each of them. The number of changes in the journal is printed
+ * per STCLog line (SC_LOG_NUMBER_OF_LINES).
+ *
+ * Build on the host with OPTION_STOP_JOURNAL TRUE together with STOP_journal.c, e.g.
+ *     gcc -O2 -I. -Ilibrerias <simulation includes> tools/bench_stop_journal.c STOP_journal.c -o bench_stop_journal
+ * The exit code is the number of differences.
+ *
+ * @date 17-oct-2026
+ *
+ * changes:
+ *      17.10.2026      first version
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "options.h"
+#include "deif_types.h"
+#include "appl_types.h"
+
+#include "STOPCONDITIONS.h"
+
+#define BENCH_STEPS			20000
+#define BENCH_NOISY			12
+
+typedef struct
+{
+	DU32	Time;
+	DU16	SCIndex;
+	DBOOL	Set;
+} t_bench_change;
+
+static t_bench_change Changes[BENCH_STEPS];
+static DBOOL State[STOPCONDITION_ARRAY_SIZE];
+static DU32 Seed = 1;
+
+
+static DU16 Random(DU16 Range)
+{
+	Seed = Seed * 1103515245UL + 12345UL;
+	return ((DU16)((Seed >> 8) % Range));
+}
+
+static void Change(DU16 Step, DU32 Time, DU16 SCIndex)
+{
+	State[SCIndex] = !State[SCIndex];
+	Changes[Step].Time    = Time;
+	Changes[Step].SCIndex = SCIndex;
+	Changes[Step].Set     = State[SCIndex];
+	STOP_Journal_Add(SCIndex, State[SCIndex], Time);
+}
+
+static void Uniform(void)
+{
+	DU32 Time = 1000;
+	DU16 SCIndex = 0;
+	DU16 Step;
+
+	for (Step = 0; Step < BENCH_STEPS; Step++)
+	{
+		if (Step && (Random(100) < 40))
+			Time += Random(3);
+		else
+		{
+			SCIndex = Random(STOPCONDITION_ARRAY_SIZE);
+			Time += Random(100);
+		}
+		Change(Step, Time, SCIndex);
+	}
+}
+
+static void Plant(void)
+{
+	DU16 Noisy[BENCH_NOISY];
+	DU16 Group = Random(STOPCONDITION_ARRAY_SIZE - 24);
+	DU32 Time = 1000;
+	DU16 SCIndex;
+	DU16 Step;
+	DU16 n;
+
+	for (n = 0; n < BENCH_NOISY; n++)
+		Noisy[n] = Random(STOPCONDITION_ARRAY_SIZE);
+
+	for (Step = 0; Step < BENCH_STEPS; Step++)
+	{
+		n = Random(100);
+		if (n < 60)
+			SCIndex = Noisy[Random(BENCH_NOISY)];
+		else if (n < 85)
+			SCIndex = (DU16)(Group + Random(24));
+		else
+			SCIndex = Random(STOPCONDITION_ARRAY_SIZE);
+		Time += Random(50);
+		Change(Step, Time, SCIndex);
+	}
+}
+
+static void Trips(void)
+{
+	DU16 Noisy[BENCH_NOISY];
+	DU16 Tripped[8];
+	DU32 Time = 1000;
+	DU16 Step = 0;
+	DU16 Count;
+	DU16 Base;
+	DU16 n;
+
+	for (n = 0; n < BENCH_NOISY; n++)
+		Noisy[n] = Random(STOPCONDITION_ARRAY_SIZE);
+
+	while (Step < BENCH_STEPS)
+	{
+		// trip
+		Count = (DU16)(2 + Random(7));
+		Base  = Random(STOPCONDITION_ARRAY_SIZE - 24);
+		Time += Random(100);
+		for (n = 0; (n < Count) && (Step < BENCH_STEPS); n++)
+		{
+			Tripped[n] = (n & 1) ? (DU16)(Base + Random(24)) : Random(STOPCONDITION_ARRAY_SIZE);
+			if (State[Tripped[n]])
+				Tripped[n] = (DU16)((Tripped[n] + 1) % STOPCONDITION_ARRAY_SIZE);
+			if (State[Tripped[n]])
+				break;
+			Change(Step++, Time, Tripped[n]);
+		}
+		Count = n;
+
+		// chatter until the acknowledge
+		for (n = (DU16)(Random(20)); n && (Step < BENCH_STEPS); n--)
+		{
+			Time += Random(15);
+			Change(Step++, Time, Noisy[Random(BENCH_NOISY)]);
+		}
+
+		// acknowledge
+		Time += 100 + Random(500);
+		for (n = 0; (n < Count) && (Step < BENCH_STEPS); n++)
+		{
+			if (State[Tripped[n]])
+				Change(Step++, Time, Tripped[n]);
+		}
+	}
+}
+
+// the journal has to hold the newest changes; returns the number of differences
+static DU16 Check(const char *pName)
+{
+	t_STOP_journal_reader Reader;
+	t_STOP_journal_event Event;
+	DU32 Events = 0;
+	DU32 Held = 0;
+	DU32 Step;
+	DU16 Errors = 0;
+
+	memset(&Reader, 0, sizeof(Reader));
+	if (!STOP_Journal_Seek(&Reader, 0))
+		return (1);
+	while (STOP_Journal_Read(&Reader, &Event))
+		Held += 1U + Event.Repeat;
+
+	Step = BENCH_STEPS - Held;
+	STOP_Journal_Seek(&Reader, 0);
+	while (STOP_Journal_Read(&Reader, &Event))
+	{
+		if ((Event.SCIndex != Changes[Step].SCIndex) || (Event.Set != Changes[Step].Set)
+			|| (Event.Time != Changes[Step].Time)
+			|| (Event.LastTime != Changes[Step + Event.Repeat].Time))
+		{
+			if (Errors++ < 5)
+				printf("%s: difference at change %lu\n", pName, (unsigned long)Step);
+		}
+		Step += 1U + Event.Repeat;
+		Events++;
+	}
+
+	// seek to each change of a sample: the event found is the one of the change or a
+	// repeat record reaches it
+	for (Step = BENCH_STEPS - Held; Step < BENCH_STEPS; Step += 97)
+	{
+		if (!STOP_Journal_Seek(&Reader, Changes[Step].Time) || !STOP_Journal_Read(&Reader, &Event)
+			|| (Event.Time > Changes[Step].Time) || (Event.LastTime < Changes[Step].Time))
+		{
+			if (Errors++ < 5)
+				printf("%s: seek to change %lu\n", pName, (unsigned long)Step);
+		}
+	}
+
+	printf("%-8s %5lu changes in %lu events, %.2f bytes per change, %.1f changes per log line\n",
+		   pName, (unsigned long)Held, (unsigned long)Events,
+		   (double)sizeof(STCJournal.Data) / Held, (double)Held / SC_LOG_NUMBER_OF_LINES);
+	return (Errors);
+}
+
+int main(void)
+{
+	DU16 Errors = 0;
+
+	printf("journal %lu bytes in %lu blocks, STCLog %lu bytes\n", (unsigned long)sizeof(STCJournal),
+		   (unsigned long)STOP_JOURNAL_BLOCKS, (unsigned long)sizeof(t_nov_stc_log));
+
+	STOP_Journal_Clear();
+	Uniform();
+	Errors += Check("uniform");
+
+	memset(State, 0, sizeof(State));
+	STOP_Journal_Clear();
+	Plant();
+	Errors += Check("plant");
+
+	memset(State, 0, sizeof(State));
+	STOP_Journal_Clear();
+	Trips();
+	Errors += Check("trips");
+
+	return (Errors);
+}
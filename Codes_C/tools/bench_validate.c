@@ -0,0 +1,122 @@
+/**
+ * @file bench_validate.c
+ * @ingroup Tools
+ * Host check and benchmark of the batch range validation over a full parameter image
+ *
+ * @remarks
+ * Every BENCH_STEP-th parameter is put out of range, then the image is checked once per
+ * parameter with PAR_GetMinValue()/PAR_GetMaxValue() (like PAR_Check...Parameters()) and
+ * once with PAR_ValidateAll(). The violation bitsets have to be equal, the times of
+ * BENCH_ROUNDS checks of each are printed; at last PAR_ValidateAll(TRUE) has to leave
+ * no violation.
+ *
+ * Build on the host together with the objects of the host simulation (PAR.c, PAR_ext.c,
+ * PAR_desc.c and their stubs), e.g.
+ *     gcc -O2 -I. -Ilibrerias <simulation includes> tools/bench_validate.c <objects> -o bench_validate
+ * The exit code is the number of differences.
+ *
+ * @date 17-oct-2026
+ *
+ * changes:
+ *      17.10.2026      first version
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "options.h"
+#include "deif_types.h"
+#include "appl_types.h"
+
+#include "PAR.h"
+
+#define BENCH_ROUNDS		100
+#define BENCH_STEP			37
+
+static DU32 Reference[PAR_DIRTY_WORDS];
+static DU32 Batch[PAR_DIRTY_WORDS];
+
+
+// one parameter after the other through the accessors
+static DU16 PerParameter(DU32 *Violations)
+{
+	DU16 RefInd;
+	DU16 Count = 0;
+	DS32 Value;
+
+	for (RefInd = 1; RefInd <= HIGHEST_PARREFIND; RefInd++)
+	{
+		if (ParRefInd[RefInd] >= NBR_OF_PARA)
+			continue;
+
+		Value = PARA[ParRefInd[RefInd]].Value;
+		if ((Value < PAR_GetMinValue(RefInd)) || (Value > PAR_GetMaxValue(RefInd)))
+		{
+			Violations[RefInd >> 5] |= (1UL << (RefInd & 31));
+			Count++;
+		}
+	}
+	return (Count);
+}
+
+static double Seconds(clock_t Start)
+{
+	return ((double)(clock() - Start) / CLOCKS_PER_SEC);
+}
+
+int main(void)
+{
+	DU32 Differences = 0;
+	DU16 RefInd;
+	DU16 CountReference, CountBatch;
+	DU16 r, w;
+	clock_t Start;
+	double Time1, Time2;
+
+	PAR_init();
+	PAR_Validate_Init();
+
+	for (RefInd = 1; RefInd <= HIGHEST_PARREFIND; RefInd += BENCH_STEP)
+	{
+		if (ParRefInd[RefInd] >= NBR_OF_PARA)
+			continue;
+		if (PAR_GetMaxValue(RefInd) < MAX_DS32)
+			PARA[ParRefInd[RefInd]].Value = PAR_GetMaxValue(RefInd) + 1;
+		else if (PAR_GetMinValue(RefInd) > (-2147483647L - 1))
+			PARA[ParRefInd[RefInd]].Value = PAR_GetMinValue(RefInd) - 1;
+	}
+
+	CountReference = PerParameter(Reference);
+	CountBatch     = PAR_ValidateAll(FALSE, Batch);
+	Differences   += (CountReference != CountBatch);
+	for (w = 0; w < PAR_DIRTY_WORDS; w++)
+		Differences += (Reference[w] != Batch[w]);
+
+	printf("\n %u reference indices, %u violations per parameter, %u batch, %lu differences",
+		   (unsigned)HIGHEST_PARREFIND, (unsigned)CountReference, (unsigned)CountBatch, (unsigned long)Differences);
+
+	Start = clock();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		memset(Reference, 0, sizeof(Reference));
+		PerParameter(Reference);
+	}
+	Time1 = Seconds(Start);
+	Start = clock();
+	for (r = 0; r < BENCH_ROUNDS; r++)
+	{
+		memset(Batch, 0, sizeof(Batch));
+		PAR_ValidateAll(FALSE, Batch);
+	}
+	Time2 = Seconds(Start);
+	printf("\n full image x %u: per parameter %8.4f s  batch %8.4f s", BENCH_ROUNDS, Time1, Time2);
+
+	// clamped: nothing left
+	PAR_ValidateAll(TRUE, 0);
+	Differences += (PAR_ValidateAll(FALSE, 0) != 0);
+	printf("\n after clamping %lu differences\n", (unsigned long)Differences);
+
+	return ((int)Differences);
+}
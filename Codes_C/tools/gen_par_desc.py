@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+#
+# gen_par_desc.py
+# generates PAR_desc.c, the const parameter descriptor table, from librerias/PAR.h
+#
+# For every parameter reference index (enum in PAR.h, in order) with a complete set of
+#   <NAME>__MIN_VALUE, <NAME>__MAX_VALUE, <NAME>__FACTORY_SETTING, <NAME>__ACCESS_LEVEL
+# one initialised entry is written, all other reference indices get an empty entry
+# (Valid = 0), so PAR_Desc[RefInd] is indexed directly by the reference index.
+# The macros are written by name, the compiler evaluates them.
+#
+# For the packed parameter image (OPTION_PAR_PACKED) the generator evaluates min and max
+# itself and writes the bit width (max - min) needs and the bit offset of every reference
+# index. Parameters without descriptor, or whose limits cannot be evaluated here (macros
+# from other headers, different values per CLIENT_VERSION), keep 32 bits.
+#
+# usage (from Codes_C):  python3 tools/gen_par_desc.py [librerias/PAR.h] [PAR_desc.c]
+#
+# 16.10.2026  first version
+# 16.10.2026  bit width and bit offset for the packed parameter image
+
+import ast
+import re
+import sys
+
+FIELDS = ('MIN_VALUE', 'MAX_VALUE', 'FACTORY_SETTING', 'ACCESS_LEVEL')
+
+# constants from deif_types.h used in PAR.h
+BUILTINS = {
+    'MAX_DS32': 2147483647,
+    'MIN_DS32': -2147483648,
+    'MAX_DU32': 4294967295,
+    'MAX_DS16': 32767,
+    'MAX_DU16': 65535,
+    'MAX_DU8': 255,
+    'TRUE': 1,
+    'FALSE': 0,
+}
+
+
+def strip_comments(text):
+    text = re.sub(r'/\*.*?\*/', lambda m: '\n' * m.group(0).count('\n'), text, flags=re.S)
+    return re.sub(r'//[^\n]*', '', text)
+
+
+def read_refinds(text):
+    # enum which starts with FACTORY__PARREFIND = 1
+    m = re.search(r'enum\s*\{\s*(FACTORY__PARREFIND\s*=\s*1\s*,.*?)\}', text, re.S)
+    if not m:
+        sys.exit('gen_par_desc: parameter reference index enum not found')
+    names = []
+    for item in m.group(1).split(','):
+        item = item.strip()
+        if not item:
+            continue
+        name = item.split('=')[0].strip()
+        if not re.match(r'^[A-Za-z0-9_]+PARREFIND$', name):
+            sys.exit('gen_par_desc: unexpected enumerator "%s"' % item)
+        names.append(name)
+    return names
+
+
+def read_defines(text):
+    # object-like macros; names defined more than once (#if branches) are left out
+    defines = {}
+    twice = set()
+    for m in re.finditer(r'^\s*#\s*define\s+([A-Za-z_][A-Za-z0-9_]*)[ \t]+([^\n]*)$', text, re.M):
+        name, value = m.group(1), m.group(2).strip()
+        if name in defines:
+            twice.add(name)
+        defines[name] = value
+    for name in twice:
+        del defines[name]
+    return defines
+
+
+class Evaluator:
+    def __init__(self, defines):
+        self.defines = defines
+        self.cache = {}
+
+    def value(self, name, depth=0):
+        if name in BUILTINS:
+            return BUILTINS[name]
+        if name in self.cache:
+            return self.cache[name]
+        if name not in self.defines or depth > 20:
+            raise ValueError(name)
+        result = self.expr(self.defines[name], depth + 1)
+        self.cache[name] = result
+        return result
+
+    def expr(self, text, depth=0):
+        text = re.sub(r'\b(0[xX][0-9a-fA-F]+|[0-9]+)[uUlL]+\b', r'\1', text)
+        text = re.sub(r'\((DS32|DU32|DS16|DU16|DU8|DS8)\)', '', text)
+        return self.node(ast.parse(text, mode='eval').body, depth)
+
+    def node(self, n, depth):
+        if isinstance(n, ast.Constant) and isinstance(n.value, int):
+            return n.value
+        if isinstance(n, ast.Name):
+            return self.value(n.id, depth)
+        if isinstance(n, ast.UnaryOp) and isinstance(n.op, ast.USub):
+            return -self.node(n.operand, depth)
+        if isinstance(n, ast.BinOp):
+            a = self.node(n.left, depth)
+            b = self.node(n.right, depth)
+            if isinstance(n.op, ast.Add):
+                return a + b
+            if isinstance(n.op, ast.Sub):
+                return a - b
+            if isinstance(n.op, ast.Mult):
+                return a * b
+            if isinstance(n.op, ast.Div):
+                q = abs(a) // abs(b)            # C: truncation towards zero
+                return q if (a >= 0) == (b >= 0) else -q
+        raise ValueError(ast.dump(n))
+
+
+def bit_width(evaluator, name):
+    try:
+        lo = evaluator.value(name + '__MIN_VALUE')
+        hi = evaluator.value(name + '__MAX_VALUE')
+    except (ValueError, SyntaxError, ZeroDivisionError):
+        return 32
+    if hi < lo:
+        return 32
+    return min(32, max(1, (hi - lo).bit_length()))
+
+
+def base_name(refind):
+    if refind.endswith('__PARREFIND'):
+        return refind[:-len('__PARREFIND')]
+    return refind[:-len('_PARREFIND')]
+
+
+def main():
+    src = sys.argv[1] if len(sys.argv) > 1 else 'librerias/PAR.h'
+    dst = sys.argv[2] if len(sys.argv) > 2 else 'PAR_desc.c'
+
+    text = strip_comments(open(src, encoding='utf-8', errors='replace').read())
+    refinds = read_refinds(text)
+
+    evaluator = Evaluator(read_defines(text))
+
+    macros = {}
+    for m in re.finditer(r'^\s*#\s*define\s+([A-Za-z0-9_]+?)__(%s)\b' % '|'.join(FIELDS), text, re.M):
+        macros.setdefault(m.group(1), set()).add(m.group(2))
+
+    out = []
+    out.append('/**')
+    out.append(' * @file PAR_desc.c')
+    out.append(' * @ingroup Application')
+    out.append(' * const parameter descriptors (min, max, factory setting, access level,')
+    out.append(' * bit width and bit offset in the packed parameter image)')
+    out.append(' *')
+    out.append(' * GENERATED by tools/gen_par_desc.py from librerias/PAR.h - do not edit,')
+    out.append(' * run the generator again after changing parameters in PAR.h')
+    out.append(' */')
+    out.append('')
+    out.append('#include "deif_types.h"')
+    out.append('#include "appl_types.h"')
+    out.append('')
+    out.append('#include "PAR.h"')
+    out.append('')
+    out.append('// PAR.h changed without running the generator')
+    out.append('typedef char PAR_Desc_CheckSize[(HIGHEST_PARREFIND == %d) ? 1 : -1];' % len(refinds))
+    out.append('')
+    out.append('const t_PAR_desc PAR_Desc[HIGHEST_PARREFIND+1] =')
+    out.append('{')
+    out.append('\t{ 0, 0, 32, 0L, 0L, 0L, 0UL },')
+    valid = 0
+    offset = 32
+    for refind in refinds:
+        name = base_name(refind)
+        if macros.get(name) == set(FIELDS):
+            bits = bit_width(evaluator, name)
+            out.append('\t{ 1, %s__ACCESS_LEVEL, %d, %s__MIN_VALUE, %s__MAX_VALUE, %s__FACTORY_SETTING, %dUL },'
+                       % (name, bits, name, name, name, offset))
+            valid += 1
+        else:
+            bits = 32
+            out.append('\t{ 0, 0, 32, 0L, 0L, 0L, %dUL },\t// %s' % (offset, name))
+        offset += bits
+    out[-1] = out[-1].replace('},', '} ', 1)
+    out.append('};')
+    out.append('')
+    out.append('const DU16 PAR_NbrOfDesc = %d;' % valid)
+    out.append('')
+    words = (offset + 31) // 32
+    out.append('#if (OPTION_PAR_PACKED == TRUE)')
+    out.append('// packed parameter image: %d bits instead of %d' % (offset, 32 * (len(refinds) + 1)))
+    out.append('DU32 PAR_PackedValue[%d];' % words)
+    out.append('const DU16 PAR_PackedWords = %d;' % words)
+    out.append('#endif')
+    out.append('')
+
+    with open(dst, 'w', encoding='utf-8', newline='\r\n') as f:
+        f.write('\n'.join(out))
+
+    print('gen_par_desc: %d reference indices, %d descriptors, packed image %d of %d bytes'
+          % (len(refinds), valid, words * 4, 4 * (len(refinds) + 1)))
+
+
+if __name__ == '__main__':
+    main()
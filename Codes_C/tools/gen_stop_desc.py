@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+#
+# gen_stop_desc.py
+# generates STOP_desc.c, the const stop condition descriptor table (OPTION_STOP_CONST_DESC),
+# from the enum t_STOPCONDITION in librerias/STOPCONDITIONS.h and STOP_initialize() in
+# STOPCONDITIONS.c
+#
+# One entry { Code, BitMask, Level } is written per enumerator, in enum order, so
+# STOP_Desc[SCIndex] is indexed directly by the stop condition. #if / #ifdef blocks of the
+# enum (OPTION_CYLINDER_MONITORING, CANDEFINED) are copied around their entries.
+#
+# Code, Level and BitMask are taken from the assignments of STOP_initialize():
+#   STOPCondition[STOPCONDITION_xxx].Code    = <expr>;
+#   STOPCondition[STOPCONDITION_xxx].Level   = <expr>;
+#   STOPCondition[STOPCONDITION_xxx].BitMask = <expr>;
+# or the setters STOP_SetCode / STOP_SetLevel / STOP_SetBitMask (STOPCONDITION_xxx, <expr>);
+# the expressions are written as they are, the compiler evaluates them.
+# Without a Code assignment the code is the number of the enumerator name.
+# Texts depend on the language and stay in RAM (STOP_Text[]).
+#
+# usage (from Codes_C):
+#   python3 tools/gen_stop_desc.py [librerias/STOPCONDITIONS.h] [STOPCONDITIONS.c] [STOP_desc.c]
+#
+# 17.10.2026  first version
+
+import re
+import sys
+
+FIELDS = ('Code', 'Level', 'BitMask')
+SETTERS = {'STOP_SetCode': 'Code', 'STOP_SetLevel': 'Level', 'STOP_SetBitMask': 'BitMask'}
+
+
+def strip_comments(text):
+    text = re.sub(r'/\*.*?\*/', lambda m: '\n' * m.group(0).count('\n'), text, flags=re.S)
+    return re.sub(r'//[^\n]*', '', text)
+
+
+def read_enum(text):
+    # list of enumerator names and preprocessor lines, in order
+    m = re.search(r'typedef\s+enum\s*\{(.*?)\}\s*t_STOPCONDITION\s*;', text, re.S)
+    if not m:
+        sys.exit('gen_stop_desc: enum t_STOPCONDITION not found')
+    items = []
+    for line in m.group(1).split('\n'):
+        line = line.strip()
+        if not line:
+            continue
+        if line.startswith('#'):
+            items.append(('#', line))
+            continue
+        for name in line.split(','):
+            name = name.strip()
+            if not name:
+                continue
+            if not re.match(r'^STOPCONDITION_[A-Za-z0-9_]+$', name) or '=' in name:
+                sys.exit('gen_stop_desc: unexpected enumerator "%s"' % name)
+            items.append(('', name))
+    if not items or items[-1] != ('', 'STOPCONDITION_LAST'):
+        sys.exit('gen_stop_desc: STOPCONDITION_LAST is not the last enumerator')
+    return items
+
+
+def read_init(text):
+    m = re.search(r'void\s+STOP_initialize\s*\(\s*void\s*\)\s*\{', text)
+    if not m:
+        sys.exit('gen_stop_desc: STOP_initialize() not found')
+    # body up to the matching brace
+    depth, pos = 1, m.end()
+    while depth and pos < len(text):
+        depth += {'{': 1, '}': -1}.get(text[pos], 0)
+        pos += 1
+    body = text[m.end():pos - 1]
+
+    values = {}
+    for m in re.finditer(r'STOPCondition\s*\[\s*(STOPCONDITION_[A-Za-z0-9_]+)\s*\]\s*\.\s*(%s)\s*=\s*([^;]+);'
+                         % '|'.join(FIELDS), body):
+        values.setdefault(m.group(1), {})[m.group(2)] = ' '.join(m.group(3).split())
+    for m in re.finditer(r'\b(%s)\s*\(\s*(STOPCONDITION_[A-Za-z0-9_]+)\s*,\s*([^;]+)\)\s*;'
+                         % '|'.join(SETTERS), body):
+        values.setdefault(m.group(2), {})[SETTERS[m.group(1)]] = ' '.join(m.group(3).split())
+    return values
+
+
+def main():
+    hdr = sys.argv[1] if len(sys.argv) > 1 else 'librerias/STOPCONDITIONS.h'
+    src = sys.argv[2] if len(sys.argv) > 2 else 'STOPCONDITIONS.c'
+    dst = sys.argv[3] if len(sys.argv) > 3 else 'STOP_desc.c'
+
+    items = read_enum(strip_comments(open(hdr, encoding='latin-1').read()))
+    values = read_init(strip_comments(open(src, encoding='latin-1').read()))
+
+    out = []
+    out.append('/**')
+    out.append(' * @file STOP_desc.c')
+    out.append(' * @ingroup Application')
+    out.append(' * const stop condition descriptors (code, bitmask, level)')
+    out.append(' *')
+    out.append(' * GENERATED by tools/gen_stop_desc.py from librerias/STOPCONDITIONS.h and')
+    out.append(' * STOP_initialize() in STOPCONDITIONS.c - do not edit, run the generator again')
+    out.append(' * after adding or changing stop conditions')
+    out.append(' */')
+    out.append('')
+    out.append('#include "options.h"')
+    out.append('#include "deif_types.h"')
+    out.append('#include "appl_types.h"')
+    out.append('#include "STOPCONDITIONS.h"')
+    out.append('')
+    out.append('#if (OPTION_STOP_CONST_DESC == TRUE)')
+    out.append('const t_STOP_desc STOP_Desc[STOPCONDITION_ARRAY_SIZE] =')
+    out.append('{')
+
+    missing = []
+    entries = 0
+    for kind, name in items:
+        if kind == '#':
+            out.append(name)
+            continue
+        v = values.get(name, {})
+        code = v.get('Code')
+        if code is None:
+            m = re.match(r'^STOPCONDITION_([0-9]+)$', name)
+            code = (m.group(1) + 'UL') if m else None
+        if name == 'STOPCONDITION_LAST':
+            code, v = '0UL', {'Level': '0', 'BitMask': '0'}
+        if code is None or 'Level' not in v or 'BitMask' not in v:
+            missing.append(name)
+            continue
+        out.append('\t{ %s, %s, %s },\t// %s' % (code, v['BitMask'], v['Level'], name))
+        entries += 1
+
+    if missing:
+        sys.exit('gen_stop_desc: no code, level or bitmask in STOP_initialize() for %d stop conditions: %s'
+                 % (len(missing), ', '.join(missing[:10])))
+
+    out[-1] = out[-1].replace('},', '} ', 1)
+    out.append('};')
+    out.append('#endif')
+    out.append('')
+
+    with open(dst, 'w', encoding='latin-1', newline='\r\n') as f:
+        f.write('\n'.join(out))
+
+    print('gen_stop_desc: %d stop conditions' % entries)
+
+
+if __name__ == '__main__':
+    main()